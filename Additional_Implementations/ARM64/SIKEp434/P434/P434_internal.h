@@ -48,6 +48,7 @@
 #define SECRETKEY_A_BYTES       ((OALICE_BITS + 7) / 8)
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
+#define INV_BATCH_SIZE          16                                  // Number of batch operations whose conversions to affine share an inversion
 
 #ifdef COMPRESS
     #define MASK2_BOB               0x00
@@ -97,6 +98,7 @@
 typedef digit_t felm_t[NWORDS_FIELD];                                 // Datatype for representing 434-bit field elements (448-bit max.)
 typedef digit_t dfelm_t[2*NWORDS_FIELD];                              // Datatype for representing double-precision 2x434-bit field elements (2x448-bit max.) 
 typedef felm_t  f2elm_t[2];                                           // Datatype for representing quadratic extension field elements GF(p434^2)
+typedef dfelm_t df2elm_t[2];                                          // Datatype for representing double-precision GF(p434^2) elements
         
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
@@ -176,6 +178,9 @@ void fpinv434_mont(digit_t* a);
 // Field inversion, a = a^-1 in GF(p434) using the binary GCD 
 void fpinv434_mont_bingcd(digit_t* a);
 
+// Constant-time field inversion, a = a^-1 in GF(p434) using the safegcd algorithm of Bernstein and Yang
+void fpinv434_mont_safegcd(digit_t* a);
+
 // Chain to compute (p434-3)/4 using Montgomery arithmetic
 void fpinv434_chain_mont(digit_t* a);
 
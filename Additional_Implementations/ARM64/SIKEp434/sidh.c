@@ -5,6 +5,9 @@
 *********************************************************************************************/ 
 
 #include "random/random.h"
+#if defined(_PARALLEL_ISOGENY_)
+    #include "parallel.c"
+#endif
 
 
 static void init_basis(digit_t *gen, f2elm_t XP, f2elm_t XQ, f2elm_t XR)
@@ -37,11 +40,11 @@ void random_mod_order_B(unsigned char* random_digits)
 }
 
 
-int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
-{ // Alice's ephemeral public key generation
+static void KeyGeneration_A_proj(const unsigned char* PrivateKeyA, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{ // Alice's isogeny computation for the ephemeral public key generation
   // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
-  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0}, pts[MAX_INT_POINTS_ALICE];
+  // Output: the images phiP, phiQ and phiR of Bob's basis points in projective coordinates.
+    point_proj_t R, pts[MAX_INT_POINTS_ALICE];
     f2elm_t XPA, XQA, XRA, coeff[3], A24plus = {0}, C24 = {0}, A = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
     digit_t SecretKeyA[NWORDS_ORDER] = {0};
@@ -49,6 +52,9 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     // Initialize basis points
     init_basis((digit_t*)A_gen, XPA, XQA, XRA);
     init_basis((digit_t*)B_gen, phiP->X, phiQ->X, phiR->X);
+    fp2zero(phiP->Z);
+    fp2zero(phiQ->Z);
+    fp2zero(phiR->Z);
     fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
     fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
     fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
@@ -62,7 +68,11 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyA, SecretKeyA, SECRETKEY_A_BYTES, NWORDS_ORDER);
-    LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);       
+#ifdef _FIXED_BASE_LADDER_
+    LADDER3PT_fixed(XPA, XRA, SecretKeyA, ALICE, R);
+#else
+    LADDER3PT(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);
+#endif
 
 #if (OALICE_BITS % 2 == 1)
     point_proj_t S;
@@ -88,12 +98,18 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
         }
         get_4_isog(R, A24plus, C24, coeff);        
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_4_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_4_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_4_isog(pts[i], coeff);
         }
         eval_4_isog(phiP, coeff);
         eval_4_isog(phiQ, coeff);
         eval_4_isog(phiR, coeff);
+#endif
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -105,6 +121,16 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
     eval_4_isog(phiP, coeff);
     eval_4_isog(phiQ, coeff);
     eval_4_isog(phiR, coeff);
+}
+
+
+int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* PublicKeyA)
+{ // Alice's ephemeral public key generation
+  // Input:  a private key PrivateKeyA in the range [0, 2^eA - 1]. 
+  // Output: the public key PublicKeyA consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t phiP, phiQ, phiR;
+
+    KeyGeneration_A_proj(PrivateKeyA, phiP, phiQ, phiR);
 
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
@@ -120,11 +146,11 @@ int EphemeralKeyGeneration_A(const unsigned char* PrivateKeyA, unsigned char* Pu
 }
 
 
-int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
-{ // Bob's ephemeral public key generation
+static void KeyGeneration_B_proj(const unsigned char* PrivateKeyB, point_proj_t phiP, point_proj_t phiQ, point_proj_t phiR)
+{ // Bob's isogeny computation for the ephemeral public key generation
   // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
-  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
-    point_proj_t R, phiP = {0}, phiQ = {0}, phiR = {0}, pts[MAX_INT_POINTS_BOB];
+  // Output: the images phiP, phiQ and phiR of Alice's basis points in projective coordinates.
+    point_proj_t R, pts[MAX_INT_POINTS_BOB];
     f2elm_t XPB, XQB, XRB, coeff[3], A24plus = {0}, A24minus = {0}, A = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
@@ -132,6 +158,9 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     // Initialize basis points
     init_basis((digit_t*)B_gen, XPB, XQB, XRB);
     init_basis((digit_t*)A_gen, phiP->X, phiQ->X, phiR->X);
+    fp2zero(phiP->Z);
+    fp2zero(phiQ->Z);
+    fp2zero(phiR->Z);
     fpcopy((digit_t*)&Montgomery_one, (phiP->Z)[0]);
     fpcopy((digit_t*)&Montgomery_one, (phiQ->Z)[0]);
     fpcopy((digit_t*)&Montgomery_one, (phiR->Z)[0]);
@@ -145,7 +174,11 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
 
     // Retrieve kernel point
     decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+#ifdef _FIXED_BASE_LADDER_
+    LADDER3PT_fixed(XPB, XRB, SecretKeyB, BOB, R);
+#else
     LADDER3PT(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+#endif
     
     // Traverse tree
     index = 0;  
@@ -160,12 +193,18 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
         } 
         get_3_isog(R, A24minus, A24plus, coeff);
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_3_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_3_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_3_isog(pts[i], coeff);
         }     
         eval_3_isog(phiP, coeff);
         eval_3_isog(phiQ, coeff);
         eval_3_isog(phiR, coeff);
+#endif
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -177,6 +216,16 @@ int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* Pu
     eval_3_isog(phiP, coeff);
     eval_3_isog(phiQ, coeff);
     eval_3_isog(phiR, coeff);
+}
+
+
+int EphemeralKeyGeneration_B(const unsigned char* PrivateKeyB, unsigned char* PublicKeyB)
+{ // Bob's ephemeral public key generation
+  // Input:  a private key PrivateKeyB in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  // Output: the public key PublicKeyB consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    point_proj_t phiP, phiQ, phiR;
+
+    KeyGeneration_B_proj(PrivateKeyB, phiP, phiQ, phiR);
 
     inv_3_way(phiP->Z, phiQ->Z, phiR->Z);
     fp2mul_mont(phiP->X, phiP->Z, phiP->X);
@@ -240,9 +289,15 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
         }
         get_4_isog(R, A24plus, C24, coeff);        
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_4_isog_parallel(pts, npts, NULL, NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_4_isog_avx2(pts, npts, NULL, NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_4_isog(pts[i], coeff);
         }
+#endif
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -261,14 +316,13 @@ int EphemeralSecretAgreement_A(const unsigned char* PrivateKeyA, const unsigned
 }
 
 
-int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
-{ // Bob's ephemeral shared secret computation
-  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+static void SecretAgreement_B_proj(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, f2elm_t jA, f2elm_t jC)
+{ // Bob's isogeny computation for the ephemeral shared secret computation
   // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
   //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
-  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+  // Output: the projective coefficients (jA:jC) of the shared curve.  
     point_proj_t R, pts[MAX_INT_POINTS_BOB];
-    f2elm_t coeff[3], PKB[3], jinv;
+    f2elm_t coeff[3], PKB[3];
     f2elm_t A24plus = {0}, A24minus = {0}, A = {0};
     unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
     digit_t SecretKeyB[NWORDS_ORDER] = {0};
@@ -301,9 +355,15 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
         }
         get_3_isog(R, A24minus, A24plus, coeff);
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_3_isog_parallel(pts, npts, NULL, NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_3_isog_avx2(pts, npts, NULL, NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_3_isog(pts[i], coeff);
         } 
+#endif
 
         fp2copy(pts[npts-1]->X, R->X); 
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -312,11 +372,268 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
     }
      
     get_3_isog(R, A24minus, A24plus, coeff);    
-    fp2add(A24plus, A24minus, A);                 
-    fp2add(A, A, A);
-    fp2sub(A24plus, A24minus, A24plus);                   
-    j_inv(A, A24plus, jinv);
+    fp2add(A24plus, A24minus, jA);                 
+    fp2add(jA, jA, jA);
+    fp2sub(A24plus, A24minus, jC);                   
+}
+
+
+int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned char* PublicKeyA, unsigned char* SharedSecretB)
+{ // Bob's ephemeral shared secret computation
+  // It produces a shared secret key SharedSecretB using his secret key PrivateKeyB and Alice's public key PublicKeyA
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: a shared secret SharedSecretB that consists of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t jA, jC, jinv;
+
+    SecretAgreement_B_proj(PrivateKeyB, PublicKeyA, jA, jC);
+    j_inv(jA, jC, jinv);
     fp2_encode(jinv, SharedSecretB);    // Format shared secret
 
     return 0;
-}
\ No newline at end of file
+}
+
+#if defined(_AVX512_IFMA_)
+
+static void KeyGeneration_A_proj_x8(const unsigned char** PrivateKeyA, f2elm_t* X, f2elm_t* Z, const unsigned int nlanes)
+{ // Alice's isogeny computation for nlanes <= IFMA_LANES private keys computed simultaneously
+  // Input:  private keys PrivateKeyA[j] in the range [0, 2^eA - 1], j = 0..nlanes-1. 
+  // Output: the images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Bob's basis points in projective coordinates.
+    f2elm_t XL[3*IFMA_LANES], ZL[3*IFMA_LANES];
+    digit_t SecretKeyA[IFMA_LANES*NWORDS_ORDER] = {0};
+    unsigned int j;
+
+    // Unused lanes repeat the first private key
+    for (j = 0; j < IFMA_LANES; j++) {
+        decode_to_digits(PrivateKeyA[j < nlanes ? j : 0], SecretKeyA + j*NWORDS_ORDER, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    }
+    keygen_A_x8(SecretKeyA, XL, ZL);
+
+    memcpy(X, XL, 3*nlanes*sizeof(f2elm_t));
+    memcpy(Z, ZL, 3*nlanes*sizeof(f2elm_t));
+}
+
+
+static void KeyGeneration_B_proj_x8(const unsigned char** PrivateKeyB, f2elm_t* X, f2elm_t* Z, const unsigned int nlanes)
+{ // Bob's isogeny computation for nlanes <= IFMA_LANES private keys computed simultaneously
+  // Input:  private keys PrivateKeyB[j] in the range [0, 2^Floor(Log(2,oB)) - 1], j = 0..nlanes-1. 
+  // Output: the images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Alice's basis points in projective coordinates.
+    f2elm_t XL[3*IFMA_LANES], ZL[3*IFMA_LANES];
+    digit_t SecretKeyB[IFMA_LANES*NWORDS_ORDER] = {0};
+    unsigned int j;
+
+    // Unused lanes repeat the first private key
+    for (j = 0; j < IFMA_LANES; j++) {
+        decode_to_digits(PrivateKeyB[j < nlanes ? j : 0], SecretKeyB + j*NWORDS_ORDER, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    }
+    keygen_B_x8(SecretKeyB, XL, ZL);
+
+    memcpy(X, XL, 3*nlanes*sizeof(f2elm_t));
+    memcpy(Z, ZL, 3*nlanes*sizeof(f2elm_t));
+}
+
+
+static void EphemeralSecretAgreement_A_x8(const unsigned char** PrivateKeyA, const unsigned char** PublicKeyB, unsigned char** SharedSecretA, const unsigned int nlanes)
+{ // Alice's ephemeral shared secret computation for nlanes <= IFMA_LANES key pairs computed simultaneously
+  // Inputs: Alice's PrivateKeyA[j] is an integer in the range [0, oA-1], j = 0..nlanes-1. 
+  //         Bob's PublicKeyB[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: shared secrets SharedSecretA[j] that consist of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t PKB[3*IFMA_LANES], A[IFMA_LANES], jA[IFMA_LANES], jC[IFMA_LANES], jinv;
+    digit_t SecretKeyA[IFMA_LANES*NWORDS_ORDER] = {0};
+    unsigned int j;
+
+    // Initialize images of Bob's basis and the curve coefficients, unused lanes repeat the first lane
+    for (j = 0; j < IFMA_LANES; j++) {
+        if (j < nlanes) {
+            decode_to_digits(PrivateKeyA[j], SecretKeyA + j*NWORDS_ORDER, SECRETKEY_A_BYTES, NWORDS_ORDER);
+            fp2_decode(PublicKeyB[j], PKB[3*j]);
+            fp2_decode(PublicKeyB[j] + FP2_ENCODED_BYTES, PKB[3*j+1]);
+            fp2_decode(PublicKeyB[j] + 2*FP2_ENCODED_BYTES, PKB[3*j+2]);
+            get_A(PKB[3*j], PKB[3*j+1], PKB[3*j+2], A[j]);
+        } else {
+            memcpy(SecretKeyA + j*NWORDS_ORDER, SecretKeyA, NWORDS_ORDER*sizeof(digit_t));
+            memcpy(PKB[3*j], PKB[0], 3*sizeof(f2elm_t));
+            fp2copy(A[0], A[j]);
+        }
+    }
+    agreement_A_x8(SecretKeyA, PKB, A, jA, jC);
+
+    for (j = 0; j < nlanes; j++) {
+        j_inv(jA[j], jC[j], jinv);
+        fp2_encode(jinv, SharedSecretA[j]);    // Format shared secret
+    }
+}
+
+
+static void SecretAgreement_B_proj_x8(const unsigned char* PrivateKeyB, const unsigned char** PublicKeyA, f2elm_t* jA, f2elm_t* jC, const unsigned int nlanes)
+{ // Bob's isogeny computation for the shared secrets of nlanes <= IFMA_LANES public keys computed simultaneously
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes, j = 0..nlanes-1.
+  // Output: the projective coefficients (jA[j]:jC[j]) of the shared curves.  
+    f2elm_t PKB[3*IFMA_LANES], A[IFMA_LANES], jAL[IFMA_LANES], jCL[IFMA_LANES];
+    digit_t SecretKeyB[IFMA_LANES*NWORDS_ORDER] = {0};
+    unsigned int j;
+
+    // Initialize images of Alice's basis and the curve coefficients, unused lanes repeat the first lane
+    decode_to_digits(PrivateKeyB, SecretKeyB, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    for (j = 0; j < IFMA_LANES; j++) {
+        if (j > 0) {
+            memcpy(SecretKeyB + j*NWORDS_ORDER, SecretKeyB, NWORDS_ORDER*sizeof(digit_t));
+        }
+        if (j < nlanes) {
+            fp2_decode(PublicKeyA[j], PKB[3*j]);
+            fp2_decode(PublicKeyA[j] + FP2_ENCODED_BYTES, PKB[3*j+1]);
+            fp2_decode(PublicKeyA[j] + 2*FP2_ENCODED_BYTES, PKB[3*j+2]);
+            get_A(PKB[3*j], PKB[3*j+1], PKB[3*j+2], A[j]);
+        } else {
+            memcpy(PKB[3*j], PKB[0], 3*sizeof(f2elm_t));
+            fp2copy(A[0], A[j]);
+        }
+    }
+    agreement_B_x8(SecretKeyB, PKB, A, jAL, jCL);
+
+    memcpy(jA, jAL, nlanes*sizeof(f2elm_t));
+    memcpy(jC, jCL, nlanes*sizeof(f2elm_t));
+}
+
+#endif
+
+
+static void EphemeralKeyGeneration_B_batch(const unsigned char** PrivateKeyB, unsigned char** PublicKeyB, const unsigned int n)
+{ // Bob's ephemeral public key generation for n <= INV_BATCH_SIZE private keys
+  // The projective images of Alice's basis of all the public keys are converted to affine with a single inversion.
+  // Input:  private keys PrivateKeyB[j] in the range [0, 2^Floor(Log(2,oB)) - 1], j = 0..n-1. 
+  // Output: the public keys PublicKeyB[j] consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    f2elm_t X[3*INV_BATCH_SIZE], Z[3*INV_BATCH_SIZE], T[3*INV_BATCH_SIZE];
+    point_proj_t phiP, phiQ, phiR;
+    unsigned int j = 0;
+
+#if defined(_AVX512_IFMA_)
+    unsigned int nlanes;
+
+    while (fp_ifma_enabled && n - j >= IFMA_MIN_LANES) {
+        nlanes = (n - j < IFMA_LANES) ? n - j : IFMA_LANES;
+        KeyGeneration_B_proj_x8(PrivateKeyB + j, X + 3*j, Z + 3*j, nlanes);
+        j += nlanes;
+    }
+#endif
+    for (; j < n; j++) {
+        KeyGeneration_B_proj(PrivateKeyB[j], phiP, phiQ, phiR);
+        fp2copy(phiP->X, X[3*j]);
+        fp2copy(phiQ->X, X[3*j+1]);
+        fp2copy(phiR->X, X[3*j+2]);
+        fp2copy(phiP->Z, Z[3*j]);
+        fp2copy(phiQ->Z, Z[3*j+1]);
+        fp2copy(phiR->Z, Z[3*j+2]);
+    }
+
+    inv_n_way(Z, T, 3*n);
+    for (j = 0; j < 3*n; j++) {
+        fp2mul_mont(X[j], Z[j], X[j]);
+    }
+
+    // Format public keys
+    for (j = 0; j < n; j++) {
+        fp2_encode(X[3*j], PublicKeyB[j]);
+        fp2_encode(X[3*j+1], PublicKeyB[j] + FP2_ENCODED_BYTES);
+        fp2_encode(X[3*j+2], PublicKeyB[j] + 2*FP2_ENCODED_BYTES);
+    }
+}
+
+
+static void EphemeralKeyGeneration_A_batch(const unsigned char** PrivateKeyA, unsigned char** PublicKeyA, const unsigned int n)
+{ // Alice's ephemeral public key generation for n <= INV_BATCH_SIZE private keys
+  // The projective images of Bob's basis of all the public keys are converted to affine with a single inversion.
+  // Input:  private keys PrivateKeyA[j] in the range [0, 2^eA - 1], j = 0..n-1. 
+  // Output: the public keys PublicKeyA[j] consisting of 3 elements in GF(p^2) which are encoded by removing leading 0 bytes.
+    f2elm_t X[3*INV_BATCH_SIZE], Z[3*INV_BATCH_SIZE], T[3*INV_BATCH_SIZE];
+    point_proj_t phiP, phiQ, phiR;
+    unsigned int j = 0;
+
+#if defined(_AVX512_IFMA_)
+    unsigned int nlanes;
+
+    while (fp_ifma_enabled && n - j >= IFMA_MIN_LANES) {
+        nlanes = (n - j < IFMA_LANES) ? n - j : IFMA_LANES;
+        KeyGeneration_A_proj_x8(PrivateKeyA + j, X + 3*j, Z + 3*j, nlanes);
+        j += nlanes;
+    }
+#endif
+    for (; j < n; j++) {
+        KeyGeneration_A_proj(PrivateKeyA[j], phiP, phiQ, phiR);
+        fp2copy(phiP->X, X[3*j]);
+        fp2copy(phiQ->X, X[3*j+1]);
+        fp2copy(phiR->X, X[3*j+2]);
+        fp2copy(phiP->Z, Z[3*j]);
+        fp2copy(phiQ->Z, Z[3*j+1]);
+        fp2copy(phiR->Z, Z[3*j+2]);
+    }
+
+    inv_n_way(Z, T, 3*n);
+    for (j = 0; j < 3*n; j++) {
+        fp2mul_mont(X[j], Z[j], X[j]);
+    }
+
+    // Format public keys
+    for (j = 0; j < n; j++) {
+        fp2_encode(X[3*j], PublicKeyA[j]);
+        fp2_encode(X[3*j+1], PublicKeyA[j] + FP2_ENCODED_BYTES);
+        fp2_encode(X[3*j+2], PublicKeyA[j] + 2*FP2_ENCODED_BYTES);
+    }
+}
+
+
+static void EphemeralSecretAgreement_A_batch(const unsigned char** PrivateKeyA, const unsigned char** PublicKeyB, unsigned char** SharedSecretA, const unsigned int n)
+{ // Alice's ephemeral shared secret computation for n pairs of Alice's private keys and Bob's public keys
+  // Inputs: Alice's PrivateKeyA[j] is an integer in the range [0, oA-1], j = 0..n-1. 
+  //         Bob's PublicKeyB[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes.
+  // Output: shared secrets SharedSecretA[j] that consist of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    unsigned int j = 0;
+
+#if defined(_AVX512_IFMA_)
+    unsigned int nlanes;
+
+    while (fp_ifma_enabled && n - j >= IFMA_MIN_LANES) {
+        nlanes = (n - j < IFMA_LANES) ? n - j : IFMA_LANES;
+        EphemeralSecretAgreement_A_x8(PrivateKeyA + j, PublicKeyB + j, SharedSecretA + j, nlanes);
+        j += nlanes;
+    }
+#endif
+    for (; j < n; j++) {
+        EphemeralSecretAgreement_A(PrivateKeyA[j], PublicKeyB[j], SharedSecretA[j]);
+    }
+}
+
+
+static void EphemeralSecretAgreement_B_batch(const unsigned char* PrivateKeyB, const unsigned char** PublicKeyA, unsigned char** SharedSecretB, const unsigned int n)
+{ // Bob's ephemeral shared secret computation for n <= INV_BATCH_SIZE of Alice's public keys
+  // The j-invariants of all the shared curves are computed with a single inversion.
+  // Inputs: Bob's PrivateKeyB is an integer in the range [0, 2^Floor(Log(2,oB)) - 1]. 
+  //         Alice's PublicKeyA[j] consists of 3 elements in GF(p^2) encoded by removing leading 0 bytes, j = 0..n-1.
+  // Output: shared secrets SharedSecretB[j] that consist of one element in GF(p^2) encoded by removing leading 0 bytes.  
+    f2elm_t jA[INV_BATCH_SIZE], jC[INV_BATCH_SIZE], jnum[INV_BATCH_SIZE], jden[INV_BATCH_SIZE], T[INV_BATCH_SIZE];
+    unsigned int j = 0;
+
+#if defined(_AVX512_IFMA_)
+    unsigned int nlanes;
+
+    while (fp_ifma_enabled && n - j >= IFMA_MIN_LANES) {
+        nlanes = (n - j < IFMA_LANES) ? n - j : IFMA_LANES;
+        SecretAgreement_B_proj_x8(PrivateKeyB, PublicKeyA + j, jA + j, jC + j, nlanes);
+        j += nlanes;
+    }
+#endif
+    for (; j < n; j++) {
+        SecretAgreement_B_proj(PrivateKeyB, PublicKeyA[j], jA[j], jC[j]);
+    }
+
+    for (j = 0; j < n; j++) {
+        j_inv_proj(jA[j], jC[j], jnum[j], jden[j]);
+    }
+    // A zero jden, e.g. from a malformed ciphertext, gives j = 0 as in j_inv() and leaves the other j-invariants unchanged
+    inv_n_way(jden, T, n);
+    for (j = 0; j < n; j++) {
+        fp2mul_mont(jnum[j], jden[j], jnum[j]);    // j-invariant = jnum/jden
+        fp2_encode(jnum[j], SharedSecretB[j]);     // Format shared secret
+    }
+}
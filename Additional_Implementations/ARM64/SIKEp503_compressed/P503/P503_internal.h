@@ -99,6 +99,7 @@
 typedef digit_t felm_t[NWORDS_FIELD];                                 // Datatype for representing 503-bit field elements (512-bit max.)
 typedef digit_t dfelm_t[2*NWORDS_FIELD];                              // Datatype for representing double-precision 2x503-bit field elements (2x512-bit max.) 
 typedef felm_t  f2elm_t[2];                                           // Datatype for representing quadratic extension field elements GF(p503^2)
+typedef dfelm_t df2elm_t[2];                                          // Datatype for representing double-precision GF(p503^2) elements
         
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
@@ -178,6 +179,9 @@ void fpinv503_mont(digit_t* a);
 // Field inversion, a = a^-1 in GF(p503) using the binary GCD 
 void fpinv503_mont_bingcd(digit_t* a);
 
+// Constant-time field inversion, a = a^-1 in GF(p503) using the safegcd algorithm of Bernstein and Yang
+void fpinv503_mont_safegcd(digit_t* a);
+
 // Chain to compute (p503-3)/4 using Montgomery arithmetic
 void fpinv503_chain_mont(digit_t* a);
 
@@ -1,23 +1,55 @@
 /********************************************************************************************
 * Hardware-based random number generation function
 *
-* It uses /dev/urandom in Linux and CNG's BCryptGenRandom function in Windows
-*********************************************************************************************/ 
+* Each thread draws from its own buffered SHAKE256 generator, which is seeded from the
+* operating system: getrandom() (or /dev/urandom) in Linux and CNG's BCryptGenRandom function
+* in Windows. The generator erases its key on every refill, reseeds after RANDOM_RESEED_BYTES
+* bytes and reseeds in a child process after fork().
+*********************************************************************************************/
 
 #include "random.h"
+#include "../sha3/fips202.h"
 #include <stdlib.h>
+#include <string.h>
 #if defined(__WINDOWS__)
     #include <windows.h>
     #include <bcrypt.h>
+    #define RANDOM_TLS __declspec(thread)
 #elif defined(__NIX__)
+    #include <errno.h>
     #include <unistd.h>
     #include <fcntl.h>
+    #include <pthread.h>
+    #if defined(__linux__) && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+        #include <sys/random.h>
+        #define HAVE_GETRANDOM
+    #endif
+    #define RANDOM_TLS __thread
     static int lock = -1;
+    static pthread_once_t lock_once = PTHREAD_ONCE_INIT;
+    static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
 #endif
 
-#define passed 0 
+#define passed 0
 #define failed 1
 
+#define RANDOM_SEED_BYTES      32                                    // Generator key and fresh seed length
+#define RANDOM_BUFFER_BLOCKS   8                                     // SHAKE256 blocks squeezed per refill
+#define RANDOM_BUFFER_BYTES    (RANDOM_BUFFER_BLOCKS*SHAKE256_RATE)
+#define RANDOM_RESEED_BYTES    (1 << 20)                             // Output bytes between reseeds
+
+typedef struct {
+    unsigned char key[RANDOM_SEED_BYTES];
+    unsigned char buffer[RANDOM_BUFFER_BYTES];
+    unsigned int position;                  // Next unused byte in buffer
+    unsigned long long output;              // Bytes output since the last reseed
+    unsigned long generation;               // Fork generation at the last reseed
+    int seeded;
+} random_state;
+
+static RANDOM_TLS random_state state;
+static volatile unsigned long fork_generation = 0;
+
 
 static __inline void delay(unsigned int count)
 {
@@ -25,25 +57,53 @@ static __inline void delay(unsigned int count)
 }
 
 
-int randombytes(unsigned char* random_array, unsigned long long nbytes)
-{ // Generation of "nbytes" of random values
-    
-#if defined(__WINDOWS__)   
+static void clear_bytes(void* mem, size_t nbytes)
+{ // Zeroing memory in a way the compiler cannot elide
+    volatile unsigned char *v = mem;
+
+    while (nbytes--) *v++ = 0;
+}
+
+
+#if defined(__NIX__)
+static void lock_open(void)
+{ // Open /dev/urandom once, for all the threads
+    do {
+        lock = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+        if (lock == -1) {
+            delay(0xFFFFF);
+        }
+    } while (lock == -1);
+}
+#endif
+
+
+static int system_randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // Read "nbytes" of random values from the operating system
+
+#if defined(__WINDOWS__)
     if (!BCRYPT_SUCCESS(BCryptGenRandom(NULL, random_array, (unsigned long)nbytes, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
         return failed;
     }
 
 #elif defined(__NIX__)
     int r, n = (int)nbytes, count = 0;
-    
-    if (lock == -1) {
-        do {
-            lock = open("/dev/urandom", O_RDONLY);
-            if (lock == -1) {
-                delay(0xFFFFF);
-            }
-        } while (lock == -1);
+
+#if defined(HAVE_GETRANDOM)
+    while (n > 0) {
+        r = (int)getrandom(random_array+count, n, 0);
+        if (r == -1) {
+            if (errno == ENOSYS) break;     // Kernel without getrandom(), fall back to /dev/urandom
+            delay(0xFFFF);
+            continue;
+        }
+        count += r;
+        n -= r;
     }
+    if (n == 0) return passed;
+#endif
+
+    pthread_once(&lock_once, lock_open);
 
     while (n > 0) {
         do {
@@ -58,4 +118,82 @@ int randombytes(unsigned char* random_array, unsigned long long nbytes)
 #endif
 
     return passed;
-}
\ No newline at end of file
+}
+
+
+#if defined(__NIX__)
+static void atfork_child(void)
+{ // Invalidate the generators inherited by a child process
+    fork_generation++;
+}
+
+
+static void atfork_register(void)
+{
+    pthread_atfork(NULL, NULL, atfork_child);
+}
+#endif
+
+
+static void random_refill(void)
+{ // Squeeze a fresh buffer from the current key. The first RANDOM_SEED_BYTES replace the key
+    uint64_t s[25] = {0};
+
+    shake256_absorb(s, state.key, RANDOM_SEED_BYTES);
+    shake256_squeezeblocks(state.buffer, RANDOM_BUFFER_BLOCKS, s);
+    memcpy(state.key, state.buffer, RANDOM_SEED_BYTES);
+    clear_bytes(state.buffer, RANDOM_SEED_BYTES);
+    clear_bytes(s, sizeof(s));
+    state.position = RANDOM_SEED_BYTES;
+}
+
+
+static int random_reseed(void)
+{ // Mix a fresh seed from the operating system into the key and discard buffered output
+    unsigned char seed[2*RANDOM_SEED_BYTES];
+
+#if defined(__NIX__)
+    pthread_once(&atfork_once, atfork_register);
+#endif
+    memcpy(seed, state.key, RANDOM_SEED_BYTES);
+    if (system_randombytes(seed + RANDOM_SEED_BYTES, RANDOM_SEED_BYTES) != passed) {
+        clear_bytes(seed, sizeof(seed));
+        return failed;
+    }
+    shake256(state.key, RANDOM_SEED_BYTES, seed, sizeof(seed));
+    clear_bytes(seed, sizeof(seed));
+
+    random_refill();
+    state.output = 0;
+    state.generation = fork_generation;
+    state.seeded = 1;
+    return passed;
+}
+
+
+int randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // Generation of "nbytes" of random values
+    unsigned long long n;
+
+    if (!state.seeded || state.generation != fork_generation || state.output >= RANDOM_RESEED_BYTES) {
+        if (random_reseed() != passed) {
+            return failed;
+        }
+    }
+    state.output += nbytes;
+
+    while (nbytes > 0) {
+        if (state.position == RANDOM_BUFFER_BYTES) {
+            random_refill();
+        }
+        n = RANDOM_BUFFER_BYTES - state.position;
+        if (n > nbytes) n = nbytes;
+        memcpy(random_array, state.buffer + state.position, (size_t)n);
+        clear_bytes(state.buffer + state.position, (size_t)n);
+        state.position += (unsigned int)n;
+        random_array += n;
+        nbytes -= n;
+    }
+
+    return passed;
+}
@@ -0,0 +1,158 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the fixed-base three-point ladder used in key generation
+*********************************************************************************************/ 
+
+
+// Benchmark and test parameters  
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) 
+    #define BENCH_LOOPS       10      // Number of iterations per bench 
+    #define TEST_LOOPS        10      // Number of iterations per test
+#else
+    #define BENCH_LOOPS      100
+    #define TEST_LOOPS       100      
+#endif
+
+
+static void ladder_setup(const unsigned int AliceOrBob, f2elm_t XP, f2elm_t XQ, f2elm_t XR, f2elm_t A)
+{ // Fixed generators of Alice or Bob and the starting curve constant A = 6
+    fp2zero(A);
+    fpcopy((digit_t*)&Montgomery_one, A[0]);
+    fp2add(A, A, A);
+    fp2add(A, A, XR);
+    fp2add(A, XR, A);
+
+    if (AliceOrBob == ALICE) {
+        init_basis((digit_t*)A_gen, XP, XQ, XR);
+    } else {
+        init_basis((digit_t*)B_gen, XP, XQ, XR);
+    }
+}
+
+
+static void ladder_random_scalar(const unsigned int AliceOrBob, digit_t* m)
+{ // Random scalar in Alice's or Bob's key range
+    unsigned char sk[SECRETKEY_B_BYTES > SECRETKEY_A_BYTES ? SECRETKEY_B_BYTES : SECRETKEY_A_BYTES] = {0};
+
+    memset(m, 0, NWORDS_ORDER*sizeof(digit_t));
+    if (AliceOrBob == ALICE) {
+        random_mod_order_A(sk);
+        decode_to_digits(sk, m, SECRETKEY_A_BYTES, NWORDS_ORDER);
+    } else {
+        random_mod_order_B(sk);
+        decode_to_digits(sk, m, SECRETKEY_B_BYTES, NWORDS_ORDER);
+    }
+}
+
+
+static bool proj_equal(const f2elm_t X1, const f2elm_t Z1, const f2elm_t X2, const f2elm_t Z2)
+{ // Is X1/Z1 = X2/Z2?
+    f2elm_t t0, t1;
+
+    fp2mul_mont(X1, Z2, t0);
+    fp2mul_mont(X2, Z1, t1);
+    fp2correction(t0);
+    fp2correction(t1);
+    return compare_words((digit_t*)t0, (digit_t*)t1, 2*NWORDS_FIELD) == 0;
+}
+
+
+int ladder_test(const unsigned int AliceOrBob)
+{ // Checking the table and the fixed-base ladder against the variable-base ladder
+    unsigned int i, nbits = (AliceOrBob == ALICE) ? OALICE_BITS : OBOB_BITS - 1;
+    const digit_t* table = (AliceOrBob == ALICE) ? (const digit_t*)Alice_ladder : (const digit_t*)Bob_ladder;
+    f2elm_t XP, XQ, XR, A, A24plus = {0}, C24 = {0}, xT, one = {0};
+    point_proj_t Q = {0}, R0, R1;
+    digit_t m[NWORDS_ORDER];
+    bool passed = true;
+
+    ladder_setup(AliceOrBob, XP, XQ, XR, A);
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2add(one, one, C24);
+    fp2add(A, C24, A24plus);
+    fp2add(C24, C24, C24);                             // A24plus = A+2, C24 = 4
+
+    fp2copy(XQ, Q->X);
+    fpcopy((digit_t*)&Montgomery_one, Q->Z[0]);
+    for (i = 0; i < nbits; i++) {
+        fpcopy((digit_t*)table + 2*i*NWORDS_FIELD, xT[0]);
+        fpcopy((digit_t*)table + (2*i+1)*NWORDS_FIELD, xT[1]);
+        if (!proj_equal(Q->X, Q->Z, xT, one)) {
+            passed = false;
+            break;
+        }
+        xDBL(Q, Q, A24plus, C24);
+    }
+
+    for (i = 0; i < TEST_LOOPS && passed; i++) {
+        ladder_random_scalar(AliceOrBob, m);
+        LADDER3PT(XP, XQ, XR, m, AliceOrBob, R0, A);
+        LADDER3PT_fixed(XP, XR, m, AliceOrBob, R1);
+        passed = proj_equal(R0->X, R0->Z, R1->X, R1->Z);
+    }
+
+    if (passed == true) printf("  Fixed-base ladder tests for %s ............................... PASSED", (AliceOrBob == ALICE) ? "Alice" : "Bob  ");
+    else { printf("  Fixed-base ladder tests for %s ... FAILED", (AliceOrBob == ALICE) ? "Alice" : "Bob"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
+
+int ladder_run(const unsigned int AliceOrBob)
+{ // Benchmarking the variable-base and the fixed-base ladders in isolation
+    unsigned int n;
+    f2elm_t XP, XQ, XR, A;
+    point_proj_t R;
+    digit_t m[NWORDS_ORDER];
+    unsigned long long cycles_var = 0, cycles_fixed = 0, cycles1, cycles2;
+
+    ladder_setup(AliceOrBob, XP, XQ, XR, A);
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        ladder_random_scalar(AliceOrBob, m);
+
+        cycles1 = cpucycles();
+        LADDER3PT(XP, XQ, XR, m, AliceOrBob, R, A);
+        cycles2 = cpucycles();
+        cycles_var = cycles_var+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        LADDER3PT_fixed(XP, XR, m, AliceOrBob, R);
+        cycles2 = cpucycles();
+        cycles_fixed = cycles_fixed+(cycles2-cycles1);
+    }
+
+    printf("  %s variable-base ladder runs in ...................... %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ", cycles_var/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  %s fixed-base ladder runs in ......................... %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ", cycles_fixed/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING FIXED-BASE THREE-POINT LADDER %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    
+    Status = ladder_test(ALICE);
+    Status |= ladder_test(BOB);
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: LADDER_ERROR \n\n");
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING FIXED-BASE THREE-POINT LADDER %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    ladder_run(ALICE);
+    ladder_run(BOB);
+
+    return Status;
+}
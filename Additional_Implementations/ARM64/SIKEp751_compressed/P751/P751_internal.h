@@ -99,6 +99,7 @@
 typedef digit_t felm_t[NWORDS_FIELD];                                 // Datatype for representing 751-bit field elements (768-bit max.)
 typedef digit_t dfelm_t[2*NWORDS_FIELD];                              // Datatype for representing double-precision 2x751-bit field elements (2x768-bit max.) 
 typedef felm_t  f2elm_t[2];                                           // Datatype for representing quadratic extension field elements GF(p751^2)
+typedef dfelm_t df2elm_t[2];                                          // Datatype for representing double-precision GF(p751^2) elements
         
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
@@ -178,6 +179,9 @@ void fpinv751_mont(digit_t* a);
 // Field inversion, a = a^-1 in GF(p751) using the binary GCD 
 void fpinv751_mont_bingcd(digit_t* a);
 
+// Constant-time field inversion, a = a^-1 in GF(p751) using the safegcd algorithm of Bernstein and Yang
+void fpinv751_mont_safegcd(digit_t* a);
+
 // Chain to compute (p751-3)/4 using Montgomery arithmetic
 void fpinv751_chain_mont(digit_t* a);
 
@@ -6,6 +6,9 @@
 
 #include "../P434_internal.h"
 #include "../../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../../fp_dispatch.h"
+#endif
 
 
 // Global constants
@@ -17,7 +20,11 @@ extern const uint64_t p434x4[NWORDS_FIELD];
 
 __inline void mp_sub434_p2(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction with correction with 2*p, c = a-b+2p.    
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) || (TARGET == TARGET_ARM64 && NBITS_FIELD == 610)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->mp_sub_p2(a, b, c);
+
+#elif (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) || (TARGET == TARGET_ARM64 && NBITS_FIELD == 610)
     unsigned int i, borrow = 0;
 
     for (i = 0; i < NWORDS_FIELD; i++) {
@@ -39,7 +46,11 @@ __inline void mp_sub434_p2(const digit_t* a, const digit_t* b, digit_t* c)
 
 __inline void mp_sub434_p4(const digit_t* a, const digit_t* b, digit_t* c)
 { // Multiprecision subtraction with correction with 4*p, c = a-b+4p.    
-#if (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) || (TARGET == TARGET_ARM64 && NBITS_FIELD == 610)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->mp_sub_p4(a, b, c);
+
+#elif (OS_TARGET == OS_WIN) || defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) || (TARGET == TARGET_ARM64 && NBITS_FIELD == 610)
     unsigned int i, borrow = 0;
 
     for (i = 0; i < NWORDS_FIELD; i++) {
@@ -64,7 +75,11 @@ __inline void fpadd434(const digit_t* a, const digit_t* b, digit_t* c)
   // Inputs: a, b in [0, 2*p434-1] 
   // Output: c in [0, 2*p434-1] 
     
-#if (OS_TARGET == OS_WIN)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->fpadd(a, b, c);
+
+#elif (OS_TARGET == OS_WIN)
     unsigned int i, carry = 0;
     digit_t mask;
 
@@ -96,7 +111,11 @@ __inline void fpsub434(const digit_t* a, const digit_t* b, digit_t* c)
   // Inputs: a, b in [0, 2*p434-1] 
   // Output: c in [0, 2*p434-1] 
     
-#if (OS_TARGET == OS_WIN)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->fpsub(a, b, c);
+
+#elif (OS_TARGET == OS_WIN)
     unsigned int i, borrow = 0;
     digit_t mask;
 
@@ -167,7 +186,11 @@ void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int n
         
     UNREFERENCED_PARAMETER(nwords);
 
-#if (OS_TARGET == OS_WIN)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->mul(a, b, c);
+
+#elif (OS_TARGET == OS_WIN)
     digit_t t = 0;
     uint128_t uv = {0};
     unsigned int carry = 0;
@@ -345,7 +368,11 @@ void rdc_mont(digit_t* ma, digit_t* mc)
   // If ma < 2^448*p434, the output mc is in the range [0, 2*p434-1].
   // ma is assumed to be in Montgomery representation.
         
-#if (OS_TARGET == OS_WIN)
+#if defined(_RUNTIME_DISPATCH_)
+
+    fp_backend->rdc(ma, mc);
+
+#elif (OS_TARGET == OS_WIN)
     unsigned int carry;
     digit_t t = 0;
     uint128_t uv = {0};
@@ -0,0 +1,43 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny evaluations in the lanes of AVX2 vectors for P434
+*           This file is compiled once with VEC_LANES = 2 and once with VEC_LANES = 4
+*********************************************************************************************/
+
+#include "../P434_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_28         16      // Number of limbs in radix 2^28, 28*16 >= 448 = 64*NWORDS_FIELD
+#define ZERO_LIMBS_28     7       // Number of "0" limbs in the least significant part of p434 + 1 in radix 2^28
+
+// p434, 2*p434, 4*p434 and p434 + 1 in radix 2^28
+static const uint64_t p_28[4][NLIMBS_28] = {
+    {
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xE2FFFFF, 0xDC1767A, 0x58AEA3F, 0x65C7831, 0x20567BC,
+      0xFD681C5, 0x446CFC5, 0xF271773, 0x0002341 },
+    {
+      0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xC5FFFFF, 0xB82ECF5, 0xB15D47F, 0xCB8F062, 0x40ACF78,
+      0xFAD038A, 0x88D9F8B, 0xE4E2EE6, 0x0004683 },
+    {
+      0xFFFFFFC, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0x8BFFFFF, 0x705D9EB, 0x62BA8FF, 0x971E0C5, 0x8159EF1,
+      0xF5A0714, 0x11B3F17, 0xC9C5DCD, 0x0008D07 },
+    {
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+      0x0000000, 0xE300000, 0xDC1767A, 0x58AEA3F, 0x65C7831, 0x20567BC,
+      0xFD681C5, 0x446CFC5, 0xF271773, 0x0002341 } };
+
+
+#if (VEC_LANES == 4)
+    #define eval_4_isog_vec           eval_4_isog434_x4
+    #define eval_3_isog_vec           eval_3_isog434_x4
+#elif (VEC_LANES == 2)
+    #define eval_4_isog_vec           eval_4_isog434_x2
+    #define eval_3_isog_vec           eval_3_isog434_x2
+#endif
+
+#include "../../ec_isogeny_avx2.c"
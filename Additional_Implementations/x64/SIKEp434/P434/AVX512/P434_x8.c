@@ -0,0 +1,53 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny computations in eight lanes for P434 using AVX-512 IFMA
+*********************************************************************************************/
+
+#include "../P434_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_52       9         // Number of limbs in radix 2^52, R' = 2^468
+
+// p434, 2*p434 and 4*p434 in radix 2^52
+static const uint64_t p_52[3][NLIMBS_52] = {
+    {
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x0003FDC1767AE2FF, 0x000C65C783158AEA, 0x000FD681C520567B, 0x000271773446CFC5,
+      0x000000000002341F },
+    {
+      0x000FFFFFFFFFFFFE, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x0007FB82ECF5C5FF, 0x0008CB8F062B15D4, 0x000FAD038A40ACF7, 0x0004E2EE688D9F8B,
+      0x000000000004683E },
+    {
+      0x000FFFFFFFFFFFFC, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FF705D9EB8BFF, 0x0001971E0C562BA8, 0x000F5A07148159EF, 0x0009C5DCD11B3F17,
+      0x000000000008D07C } };
+
+// Conversion constants: R'^2/R mod p434 maps the Montgomery representation with R = 2^448 to the one with R',
+// and R mod p434 maps it back
+static const uint64_t to_mont_52[NLIMBS_52] = {
+    0x00042C6B854089A1, 0x0000000000000007, 0x0000000000000000, 0x0000000000000000,
+    0x00048944F93C3D00, 0x000AFF347A606F4C, 0x000C432687B6D670, 0x00024AECC7938CE9,
+    0x000000000001450D };
+static const uint64_t from_mont_52[NLIMBS_52] = {
+    0x000000000000742C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0004B90FF404FC00, 0x00001A4FB559FACD, 0x0004545F77410CD8, 0x000A7BD2EDAE9325,
+    0x000000000000ECEE };
+
+// Value one in Montgomery representation with R'
+static const uint64_t one_52[NLIMBS_52] = {
+    0x0000000742C6B854, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000428CB3A858400, 0x0005776FEC6D4724, 0x000D2D0AD9D41CF5, 0x0008B890471DE8D4,
+    0x00000000000012F4 };
+
+
+#define keygen_A_x8                   keygen_A434_x8
+#define keygen_B_x8                   keygen_B434_x8
+#define agreement_A_x8                agreement_A434_x8
+#define agreement_B_x8                agreement_B434_x8
+#define fp_ifma_enabled               fp434_ifma_enabled
+#define fp_ifma_supported             fp434_ifma_supported
+
+#include "../../sidh_x8.c"
@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp434
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P434/P434.c"
+
+
+#define SCHEME_NAME       "SIKEp434"
+#define fprandom_test     fprandom434_test
+#define fp2random_test    fp2random434_test
+
+
+#include "test_inversion.c"
@@ -0,0 +1,16 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the 4-way SHAKE256 for SIKEp434
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P434/P434.c"
+
+
+#define SCHEME_NAME       "SIKEp434"
+
+
+#include "test_keccak.c"
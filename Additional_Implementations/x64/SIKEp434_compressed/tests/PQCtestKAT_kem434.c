@@ -11,6 +11,9 @@
 #include <ctype.h>
 #include "rng/rng.h"
 #include "../P434/api.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 #define MAX_MARKER_LEN      50
@@ -20,12 +23,36 @@
 #define KAT_DATA_ERROR      -3
 #define KAT_CRYPTO_FAILURE  -4
 
+int     kat_test(void);
 int     FindMarker(FILE *infile, const char *marker);
 int     ReadHex(FILE *infile, unsigned char *A, int Length, char *str);
 void    fprintBstr(FILE *fp, char *S, unsigned char *A, unsigned long long L);
 
 int
 main()
+{
+#if defined(_RUNTIME_DISPATCH_)
+    // Run the KATs with every field arithmetic backend supported by the processor
+    unsigned int        backend;
+    int                 ret_val;
+
+    for (backend = 0; backend < FP_BACKEND_COUNT; backend++) {
+        if ( fp_backend_select(backend) != 0 ) {
+            printf("Field arithmetic <%s> is not supported by this processor, skipped\n\n", fp_backends[backend].name);
+            continue;
+        }
+        printf("Field arithmetic <%s>\n", fp_backend->name);
+        if ( (ret_val = kat_test()) != KAT_SUCCESS )
+            return ret_val;
+    }
+    return KAT_SUCCESS;
+#else
+    return kat_test();
+#endif
+}
+
+int
+kat_test()
 {
     char                fn_rsp[64];
     FILE                *fp_rsp;
@@ -0,0 +1,247 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the 4-way AVX2 SHAKE256 and the incremental SHAKE256 against
+*           the one-shot scalar SHAKE256
+*********************************************************************************************/
+
+#include <pthread.h>
+#include <time.h>
+#include "../sha3/fips202x4.h"
+
+
+// Benchmark and test parameters
+#define BENCH_LOOPS        10000      // Number of iterations per bench
+#define MAX_INPUT_BYTES      700      // Largest input length in the tests
+#define MAX_OUTPUT_BYTES     300      // Largest output length in the tests
+#define MAX_THREADS            4
+#define THREAD_HASHES     100000      // Number of hashes per thread in the multi-threaded bench
+
+// Scalar permutation in fips202.c
+void KeccakF1600_StatePermute(uint64_t *state);
+
+
+static void shake256_x1(unsigned char* out[4], unsigned long long outlen, const unsigned char* in[4], unsigned long long inlen)
+{
+    for (int i = 0; i < 4; i++) {
+        shake256(out[i], outlen, in[i], inlen);
+    }
+}
+
+
+static void shake256_x4(unsigned char* out[4], unsigned long long outlen, const unsigned char* in[4], unsigned long long inlen)
+{
+    shake256x4(out[0], out[1], out[2], out[3], outlen, in[0], in[1], in[2], in[3], inlen);
+}
+
+
+int keccak_test()
+{ // Test that shake256x4 matches four calls to shake256, over all the input lengths across the block boundaries
+    bool passed = true;
+    unsigned char in[4][MAX_INPUT_BYTES], out[4][MAX_OUTPUT_BYTES], ref[MAX_OUTPUT_BYTES];
+    unsigned char *po[4] = {out[0], out[1], out[2], out[3]};
+    const unsigned char *pi[4] = {in[0], in[1], in[2], in[3]};
+    const unsigned long long outlens[] = {16, 32, SHAKE256_RATE, SHAKE256_RATE + 1, MAX_OUTPUT_BYTES};
+
+    randombytes(in[0], sizeof(in));
+    for (unsigned long long inlen = 0; inlen <= MAX_INPUT_BYTES && passed; inlen++) {
+        for (unsigned int k = 0; k < sizeof(outlens)/sizeof(outlens[0]); k++) {
+            shake256_x4(po, outlens[k], pi, inlen);
+            for (int i = 0; i < 4; i++) {
+                shake256(ref, outlens[k], in[i], inlen);
+                if (memcmp(ref, out[i], (size_t)outlens[k]) != 0) { passed = false; break; }
+            }
+        }
+    }
+    if (passed == true) printf("  4-way SHAKE256 tests ................................................... PASSED");
+    else { printf("  4-way SHAKE256 tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    // Incremental SHAKE256 over two pieces split at every position, squeezed in two calls
+    for (unsigned long long inlen = 0; inlen <= MAX_INPUT_BYTES && passed; inlen += 7) {
+        shake256(ref, MAX_OUTPUT_BYTES, in[0], inlen);
+        for (unsigned long long split = 0; split <= inlen; split++) {
+            shake256_inc_state state;
+            shake256_inc_init(&state);
+            shake256_inc_absorb(&state, in[0], split);
+            shake256_inc_absorb(&state, in[0] + split, inlen - split);
+            shake256_inc_finalize(&state);
+            shake256_inc_squeeze(out[0], split % MAX_OUTPUT_BYTES, &state);
+            shake256_inc_squeeze(out[0] + split % MAX_OUTPUT_BYTES, MAX_OUTPUT_BYTES - split % MAX_OUTPUT_BYTES, &state);
+            if (memcmp(ref, out[0], MAX_OUTPUT_BYTES) != 0) { passed = false; break; }
+        }
+    }
+    if (passed == true) printf("  Incremental SHAKE256 tests ............................................. PASSED");
+    else { printf("  Incremental SHAKE256 tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    // Incremental 4-way SHAKE256 over two pieces split at every position, squeezed in two calls
+    for (unsigned long long inlen = 0; inlen <= MAX_INPUT_BYTES && passed; inlen += 7) {
+        for (unsigned long long split = 0; split <= inlen && passed; split++) {
+            shake256x4_inc_state state;
+            unsigned long long outsplit = split % MAX_OUTPUT_BYTES;
+            shake256x4_inc_init(&state);
+            shake256x4_inc_absorb(&state, in[0], in[1], in[2], in[3], split);
+            shake256x4_inc_absorb(&state, in[0] + split, in[1] + split, in[2] + split, in[3] + split, inlen - split);
+            shake256x4_inc_finalize(&state);
+            shake256x4_inc_squeeze(out[0], out[1], out[2], out[3], outsplit, &state);
+            shake256x4_inc_squeeze(out[0] + outsplit, out[1] + outsplit, out[2] + outsplit, out[3] + outsplit, MAX_OUTPUT_BYTES - outsplit, &state);
+            for (int i = 0; i < 4; i++) {
+                shake256(ref, MAX_OUTPUT_BYTES, in[i], inlen);
+                if (memcmp(ref, out[i], MAX_OUTPUT_BYTES) != 0) { passed = false; break; }
+            }
+        }
+    }
+    if (passed == true) printf("  Incremental 4-way SHAKE256 tests ....................................... PASSED");
+    else { printf("  Incremental 4-way SHAKE256 tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    return PASSED;
+}
+
+
+static unsigned long long kem_hashes(void (*shake)(unsigned char**, unsigned long long, const unsigned char**, unsigned long long), unsigned int n)
+{ // Cycles of the hashes of n decapsulations, n is a multiple of 4: h over the j-invariant, G over m||pk and H over m||ct
+    unsigned char in[4][MSG_BYTES + CRYPTO_CIPHERTEXTBYTES], out[4][SECRETKEY_A_BYTES + SECRETKEY_B_BYTES];
+    unsigned char *po[4] = {out[0], out[1], out[2], out[3]};
+    const unsigned char *pi[4] = {in[0], in[1], in[2], in[3]};
+    unsigned long long cycles, cycles1, cycles2;
+
+    randombytes(in[0], sizeof(in));
+    cycles1 = cpucycles();
+    for (unsigned int j = 0; j < n; j += 4) {
+        shake(po, MSG_BYTES, pi, FP2_ENCODED_BYTES);
+        shake(po, SECRETKEY_A_BYTES, pi, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+        shake(po, CRYPTO_BYTES, pi, MSG_BYTES + CRYPTO_CIPHERTEXTBYTES);
+    }
+    cycles2 = cpucycles();
+    cycles = cycles2 - cycles1;
+
+    return cycles;
+}
+
+
+static void* bench_thread(void* arg)
+{ // arg points to the hashing function
+    void (*shake)(unsigned char**, unsigned long long, const unsigned char**, unsigned long long) = *(void (**)(unsigned char**, unsigned long long, const unsigned char**, unsigned long long))arg;
+    unsigned char in[4][MSG_BYTES + CRYPTO_CIPHERTEXTBYTES] = {{0}}, out[4][CRYPTO_BYTES];
+    unsigned char *po[4] = {out[0], out[1], out[2], out[3]};
+    const unsigned char *pi[4] = {in[0], in[1], in[2], in[3]};
+
+    for (int i = 0; i < THREAD_HASHES; i += 4) {
+        shake(po, CRYPTO_BYTES, pi, MSG_BYTES + CRYPTO_CIPHERTEXTBYTES);
+        in[0][0] = out[0][0];
+    }
+    return NULL;
+}
+
+
+static double bench_threads(void (*shake)(unsigned char**, unsigned long long, const unsigned char**, unsigned long long), int nthreads)
+{ // Millions of hashes per second over nthreads threads
+    pthread_t threads[MAX_THREADS];
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < nthreads; i++) {
+        pthread_create(&threads[i], NULL, bench_thread, &shake);
+    }
+    for (int i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return (double)THREAD_HASHES*nthreads / ((end.tv_sec - start.tv_sec)*1e6 + (end.tv_nsec - start.tv_nsec)/1e3);
+}
+
+
+int keccak_run()
+{
+    unsigned char in[4][MAX_INPUT_BYTES] = {{0}}, out[4][MAX_OUTPUT_BYTES];
+    unsigned char *po[4] = {out[0], out[1], out[2], out[3]};
+    const unsigned char *pi[4] = {in[0], in[1], in[2], in[3]};
+    unsigned long long cycles, cycles1, cycles2, cycles_x1, cycles_x4;
+    const unsigned long long inlens[] = {FP2_ENCODED_BYTES, MSG_BYTES + CRYPTO_PUBLICKEYBYTES, MSG_BYTES + CRYPTO_CIPHERTEXTBYTES};
+    __m256i s[25];
+    uint64_t s1[25];
+
+    cycles = 0;
+    for (int n = 0; n < BENCH_LOOPS; n++) {
+        memset(s1, 0, sizeof(s1));
+        cycles1 = cpucycles();
+        KeccakF1600_StatePermute(s1);
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  Keccak-f[1600] runs in ................................................ %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    cycles = 0;
+    for (int n = 0; n < BENCH_LOOPS; n++) {
+        for (int i = 0; i < 25; i++) s[i] = _mm256_setzero_si256();
+        cycles1 = cpucycles();
+        KeccakF1600_StatePermute4x(s);
+        cycles2 = cpucycles();
+        cycles = cycles + (cycles2 - cycles1);
+    }
+    printf("  4-way Keccak-f[1600] runs in .......................................... %10lld ", cycles/BENCH_LOOPS); print_unit;
+    printf("\n\n");
+
+    for (unsigned int k = 0; k < sizeof(inlens)/sizeof(inlens[0]); k++) {
+        cycles_x1 = 0; cycles_x4 = 0;
+        for (int n = 0; n < BENCH_LOOPS; n++) {
+            cycles1 = cpucycles();
+            shake256_x1(po, CRYPTO_BYTES, pi, inlens[k]);
+            cycles2 = cpucycles();
+            cycles_x1 = cycles_x1 + (cycles2 - cycles1);
+            cycles1 = cpucycles();
+            shake256_x4(po, CRYPTO_BYTES, pi, inlens[k]);
+            cycles2 = cpucycles();
+            cycles_x4 = cycles_x4 + (cycles2 - cycles1);
+        }
+        printf("  4 x SHAKE256 of %3lld bytes runs in ..................................... %10lld ", inlens[k], cycles_x1/BENCH_LOOPS); print_unit;
+        printf("\n");
+        printf("  4-way SHAKE256 of %3lld bytes runs in ................................... %10lld ", inlens[k], cycles_x4/BENCH_LOOPS); print_unit;
+        printf("\n");
+    }
+    printf("\n");
+
+    // KEM level: hashing work of a batch of 16 decapsulations
+    cycles_x1 = 0; cycles_x4 = 0;
+    for (int n = 0; n < BENCH_LOOPS/16; n++) {
+        cycles_x1 += kem_hashes(shake256_x1, 16);
+        cycles_x4 += kem_hashes(shake256_x4, 16);
+    }
+    printf("  Hashes of 16 decapsulations, scalar, run in ........................... %10lld ", cycles_x1/(BENCH_LOOPS/16)); print_unit;
+    printf("\n");
+    printf("  Hashes of 16 decapsulations, 4-way, run in ............................ %10lld ", cycles_x4/(BENCH_LOOPS/16)); print_unit;
+    printf("\n\n");
+
+    for (int nthreads = 1; nthreads <= MAX_THREADS; nthreads *= 2) {
+        printf("  %d thread(s), scalar H(m||ct) ......................................... %10.2f Mhashes/s\n", nthreads, bench_threads(shake256_x1, nthreads));
+        printf("  %d thread(s), 4-way H(m||ct) .......................................... %10.2f Mhashes/s\n", nthreads, bench_threads(shake256_x4, nthreads));
+    }
+
+    return PASSED;
+}
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING 4-WAY SHAKE256 %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    Status = keccak_test();
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KECCAK_ERROR \n\n");
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING 4-WAY SHAKE256 %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    keccak_run();
+
+    return Status;
+}
@@ -0,0 +1,47 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny evaluations in the lanes of AVX2 vectors for P503
+*           This file is compiled once with VEC_LANES = 2 and once with VEC_LANES = 4
+*********************************************************************************************/
+
+#include "../P503_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_28         19      // Number of limbs in radix 2^28, 28*19 >= 512 = 64*NWORDS_FIELD
+#define ZERO_LIMBS_28     8       // Number of "0" limbs in the least significant part of p503 + 1 in radix 2^28
+
+// p503, 2*p503, 4*p503 and p503 + 1 in radix 2^28
+static const uint64_t p_28[4][NLIMBS_28] = {
+    {
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xBFFFFFF, 0x11E7A0A, 0x85BDA22, 0x7DAF130,
+      0x6C87B7E, 0xD01B9BF, 0xDDA77A4, 0x6045C6B, 0x1811E1E, 0x4066F54,
+      0x0000000 },
+    {
+      0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0x7FFFFFF, 0x23CF415, 0x0B7B444, 0xFB5E261,
+      0xD90F6FC, 0xA03737E, 0xBB4EF49, 0xC08B8D7, 0x3023C3C, 0x80CDEA8,
+      0x0000000 },
+    {
+      0xFFFFFFC, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0x479E82A, 0x16F6888, 0xF6BC4C2,
+      0xB21EDF9, 0x406E6FD, 0x769DE93, 0x81171AF, 0x6047879, 0x019BD50,
+      0x0000001 },
+    {
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+      0x0000000, 0x0000000, 0xC000000, 0x11E7A0A, 0x85BDA22, 0x7DAF130,
+      0x6C87B7E, 0xD01B9BF, 0xDDA77A4, 0x6045C6B, 0x1811E1E, 0x4066F54,
+      0x0000000 } };
+
+
+#if (VEC_LANES == 4)
+    #define eval_4_isog_vec           eval_4_isog503_x4
+    #define eval_3_isog_vec           eval_3_isog503_x4
+#elif (VEC_LANES == 2)
+    #define eval_4_isog_vec           eval_4_isog503_x2
+    #define eval_3_isog_vec           eval_3_isog503_x2
+#endif
+
+#include "../../ec_isogeny_avx2.c"
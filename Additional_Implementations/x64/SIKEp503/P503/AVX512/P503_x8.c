@@ -0,0 +1,53 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny computations in eight lanes for P503 using AVX-512 IFMA
+*********************************************************************************************/
+
+#include "../P503_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_52       10         // Number of limbs in radix 2^52, R' = 2^520
+
+// p503, 2*p503 and 4*p503 in radix 2^52
+static const uint64_t p_52[3][NLIMBS_52] = {
+    {
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x0000ABFFFFFFFFFF, 0x000085BDA2211E7A, 0x0006C87B7E7DAF13, 0x000DA77A4D01B9BF,
+      0x00011E1E6045C6BD, 0x00000004066F5418 },
+    {
+      0x000FFFFFFFFFFFFE, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000157FFFFFFFFFF, 0x00010B7B44423CF4, 0x000D90F6FCFB5E26, 0x000B4EF49A03737E,
+      0x00023C3CC08B8D7B, 0x000000080CDEA830 },
+    {
+      0x000FFFFFFFFFFFFC, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x0002AFFFFFFFFFFF, 0x000216F6888479E8, 0x000B21EDF9F6BC4C, 0x00069DE93406E6FD,
+      0x0004787981171AF7, 0x0000001019BD5060 } };
+
+// Conversion constants: R'^2/R mod p503 maps the Montgomery representation with R = 2^512 to the one with R',
+// and R mod p503 maps it back
+static const uint64_t to_mont_52[NLIMBS_52] = {
+    0x0000000003F99AF5, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0003640000000000, 0x0002D869D723B5FC, 0x000E566BD3C9CADC, 0x000339C65A25ED59,
+    0x000371D15B71B194, 0x00000001CB3EFFCA };
+static const uint64_t from_mont_52[NLIMBS_52] = {
+    0x00000000000003F9, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0004B40000000000, 0x000CB1A6EA6DED2B, 0x000D8D667EB37D63, 0x0001AB2414251689,
+    0x000F59538ACD77C7, 0x000000026FBAEC60 };
+
+// Value one in Montgomery representation with R'
+static const uint64_t one_52[NLIMBS_52] = {
+    0x000000000003F99A, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x000C880000000000, 0x000132D6E600D5E0, 0x0008CC349BE21258, 0x00046481D20CCCB1,
+    0x000D3544E37E38E5, 0x00000003DBF3CA7A };
+
+
+#define keygen_A_x8                   keygen_A503_x8
+#define keygen_B_x8                   keygen_B503_x8
+#define agreement_A_x8                agreement_A503_x8
+#define agreement_B_x8                agreement_B503_x8
+#define fp_ifma_enabled               fp503_ifma_enabled
+#define fp_ifma_supported             fp503_ifma_supported
+
+#include "../../sidh_x8.c"
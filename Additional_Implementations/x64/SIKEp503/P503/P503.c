@@ -7,6 +7,9 @@
 #include "api.h" 
 #include "P503_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -73,6 +76,9 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000003F9, 0x00000
 
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P503_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 
 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 
@@ -87,7 +93,13 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 1, 4, 2, 1, 1, 2, 1, 1, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 
 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 
 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
            
+#ifdef _FIXED_BASE_LADDER_
+// Precomputed multiples of the fixed generators for the three-point ladder in key generation
+#include "P503_ladder_tables.c"
+#endif
+
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy503
 #define fpzero                        fpzero503
@@ -101,6 +113,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont                    fpinv503_mont
 #define fpinv_chain_mont              fpinv503_chain_mont
 #define fpinv_mont_bingcd             fpinv503_mont_bingcd
+#define fpinv_mont_safegcd            fpinv503_mont_safegcd
 #define fp2copy                       fp2copy503
 #define fp2zero                       fp2zero503
 #define fp2add                        fp2add503
@@ -116,9 +129,24 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2inv_mont                   fp2inv503_mont
 #define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
 #define fpequal_non_constant_time     fpequal503_non_constant_time
+#define fp_ifma_enabled               fp503_ifma_enabled
+#define keygen_A_x8                   keygen_A503_x8
+#define keygen_B_x8                   keygen_B503_x8
+#define agreement_A_x8                agreement_A503_x8
+#define agreement_B_x8                agreement_B503_x8
+#define eval_4_isog_x4                eval_4_isog503_x4
+#define eval_3_isog_x4                eval_3_isog503_x4
+#define eval_4_isog_x2                eval_4_isog503_x2
+#define eval_3_isog_x2                eval_3_isog503_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add503_asm
 #define mp_subaddx2_asm               mp_subadd503x2_asm
 #define mp_dblsubx2_asm               mp_dblsub503x2_asm
+#endif
 
 
 #include "../fpx.c"
@@ -96,10 +96,17 @@
     #define FAST_IMPLEMENTATION
 #endif
 
+// The generic implementation uses the compiler's 128-bit integers on 64-bit targets that support them, unless _NO_INT128_ is set
+#if defined(GENERIC_IMPLEMENTATION) && (RADIX == 64) && defined(__SIZEOF_INT128__) && !defined(_NO_INT128_)
+    #define GENERIC_INT128
+#endif
+
 
 // Extended datatype support
 
-#if defined(GENERIC_IMPLEMENTATION)                       
+#if defined(GENERIC_INT128)
+    typedef unsigned uint128_t __attribute__((mode(TI)));
+#elif defined(GENERIC_IMPLEMENTATION)                       
     typedef uint64_t uint128_t[2];
 #elif (TARGET == TARGET_AMD64 && OS_TARGET == OS_NIX) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
     typedef unsigned uint128_t __attribute__((mode(TI)));
@@ -175,7 +182,7 @@ static __inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
 
 /********************** Macros for platform-dependent operations **********************/
 
-#if defined(GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+#if (defined(GENERIC_IMPLEMENTATION) && !defined(GENERIC_INT128)) || (TARGET == TARGET_ARM)
 
 // Digit multiplication
 #define MUL(multiplier, multiplicand, hi, lo)                                                     \
@@ -238,7 +245,7 @@ static __inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
       MUL128(multiplier, multiplicand, product);                                                  \
       ADC128(addend, product, carry, result); }
 
-#elif ((TARGET == TARGET_AMD64 || TARGET == TARGET_ARM64) && OS_TARGET == OS_NIX)
+#elif ((TARGET == TARGET_AMD64 || TARGET == TARGET_ARM64) && OS_TARGET == OS_NIX) || defined(GENERIC_INT128)
 
 // Digit multiplication
 #define MUL(multiplier, multiplicand, hi, lo)                                                     \
@@ -246,6 +253,28 @@ static __inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
     *(hi) = (digit_t)(tempReg >> RADIX);                                                          \
     (lo) = (digit_t)tempReg; }
 
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+    #define BUILTIN_ADDC                    // Add/subtract with carry builtins (e.g., clang, GCC 14 and later)
+#endif
+#endif
+
+#if defined(BUILTIN_ADDC)
+
+// Digit addition with carry
+#define ADDC(carryIn, addend1, addend2, carryOut, sumOut)                                         \
+    { unsigned long long carryReg;                                                                \
+    (sumOut) = (digit_t)__builtin_addcll((addend1), (addend2), (carryIn), &carryReg);             \
+    (carryOut) = carryReg; }
+
+// Digit subtraction with borrow
+#define SUBC(borrowIn, minuend, subtrahend, borrowOut, differenceOut)                             \
+    { unsigned long long borrowReg;                                                               \
+    (differenceOut) = (digit_t)__builtin_subcll((minuend), (subtrahend), (borrowIn), &borrowReg); \
+    (borrowOut) = borrowReg; }
+
+#else
+
 // Digit addition with carry
 #define ADDC(carryIn, addend1, addend2, carryOut, sumOut)                                         \
     { uint128_t tempReg = (uint128_t)(addend1) + (uint128_t)(addend2) + (uint128_t)(carryIn);     \
@@ -258,6 +287,8 @@ static __inline unsigned int is_digit_lessthan_ct(digit_t x, digit_t y)
     (borrowOut) = (digit_t)(tempReg >> (sizeof(uint128_t)*8 - 1));                                \
     (differenceOut) = (digit_t)tempReg; }
 
+#endif
+
 // Digit shift right
 #define SHIFTR(highIn, lowIn, shift, shiftOut, DigitSize)                                         \
     (shiftOut) = ((lowIn) >> (shift)) ^ ((highIn) << (RADIX - (shift)));
@@ -0,0 +1,24 @@
+/**********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmarking the field arithmetic backends of SIKEp503
+***********************************************************************************************/ 
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                  // For sched_setaffinity()
+#endif
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/api.h"
+#if defined(_AVX512_IFMA_)
+    #include "../P503/P503_internal.h"
+    #define fp_ifma_enabled     fp503_ifma_enabled
+    #define fp_ifma_supported   fp503_ifma_supported
+#endif
+
+
+#define SCHEME_NAME    "SIKEp503"
+
+
+#include "bench.c"
@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp503
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503.c"
+
+
+#define SCHEME_NAME       "SIKEp503"
+#define fprandom_test     fprandom503_test
+#define fp2random_test    fp2random503_test
+
+
+#include "test_inversion.c"
@@ -99,6 +99,7 @@
 typedef digit_t felm_t[NWORDS_FIELD];                                 // Datatype for representing 503-bit field elements (512-bit max.)
 typedef digit_t dfelm_t[2*NWORDS_FIELD];                              // Datatype for representing double-precision 2x503-bit field elements (2x512-bit max.) 
 typedef felm_t  f2elm_t[2];                                           // Datatype for representing quadratic extension field elements GF(p503^2)
+typedef dfelm_t df2elm_t[2];                                          // Datatype for representing double-precision GF(p503^2) elements
         
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
@@ -178,6 +179,9 @@ void fpinv503_mont(digit_t* a);
 // Field inversion, a = a^-1 in GF(p503) using the binary GCD 
 void fpinv503_mont_bingcd(digit_t* a);
 
+// Constant-time field inversion, a = a^-1 in GF(p503) using the safegcd algorithm of Bernstein and Yang
+void fpinv503_mont_safegcd(digit_t* a);
+
 // Chain to compute (p503-3)/4 using Montgomery arithmetic
 void fpinv503_chain_mont(digit_t* a);
 
@@ -216,5 +220,51 @@ void fp2inv503_mont(f2elm_t a);
 // GF(p503^2) inversion, a = (a0-i*a1)/(a0^2+a1^2), GF(p503) inversion done using the binary GCD 
 void fp2inv503_mont_bingcd(f2elm_t a);
 
+/************ Isogeny computations in eight lanes using AVX-512 IFMA (AVX512/P503_x8.c) *************/
+
+#if defined(_AVX512_IFMA_)
+// Set to 1 at load time if the processor supports AVX-512 IFMA, in which case the batch functions use the lanes
+extern int fp503_ifma_enabled;
+
+// Returns 1 if the processor supports AVX-512 IFMA, 0 otherwise
+int fp503_ifma_supported(void);
+
+#define IFMA_LANES    8                  // Number of operations that are computed simultaneously
+#define IFMA_MIN_LANES    2              // Smallest number of operations that are computed in the lanes, fewer ones use the scalar code
+
+// Alice's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER].
+// Outputs the projective images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Bob's basis points
+void keygen_A503_x8(const digit_t* SecretKeyA, f2elm_t* X, f2elm_t* Z);
+
+// Bob's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER].
+// Outputs the projective images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Alice's basis points
+void keygen_B503_x8(const digit_t* SecretKeyB, f2elm_t* X, f2elm_t* Z);
+
+// Alice's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER], 
+// Bob's public key PK[3*j+k] and its curve coefficient A[j]. Outputs the coefficients (jA[j]:jC[j]) of the shared curve
+void agreement_A503_x8(const digit_t* SecretKeyA, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC);
+
+// Bob's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER], 
+// Alice's public key PK[3*j+k] and its curve coefficient A[j]. Outputs the coefficients (jA[j]:jC[j]) of the shared curve
+void agreement_B503_x8(const digit_t* SecretKeyB, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC);
+#endif
+
+
+/************ Isogeny evaluations in the lanes of AVX2 vectors (AVX2/P503_avx2.c) *************/
+
+#if defined(_AVX2_ISOGENY_)
+// Evaluates a 4-isogeny at the four points P[0], ..., P[3] in radix 2^28, see eval_4_isog()
+void eval_4_isog503_x4(point_proj* const* P, f2elm_t* coeff);
+
+// Evaluates a 3-isogeny at the four points P[0], ..., P[3] in radix 2^28, see eval_3_isog()
+void eval_3_isog503_x4(point_proj* const* P, const f2elm_t* coeff);
+
+// Evaluates a 4-isogeny at the two points P[0] and P[1] in radix 2^28, see eval_4_isog()
+void eval_4_isog503_x2(point_proj* const* P, f2elm_t* coeff);
+
+// Evaluates a 3-isogeny at the two points P[0] and P[1] in radix 2^28, see eval_3_isog()
+void eval_3_isog503_x2(point_proj* const* P, const f2elm_t* coeff);
+#endif
+
 
 #endif
@@ -117,6 +117,7 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
   // Input: projective Montgomery x-coordinates P = (X:Z), where x=X/Z and Montgomery curve constants A24plus = A+2C and A24minus = A-2C.
   // Output: projective Montgomery x-coordinates Q = 3*P = (X3:Z3).
     f2elm_t t0, t1, t2, t3, t4, t5, t6;
+    df2elm_t tt0, tt1;
                                     
     mp2_sub_p2(P->X, P->Z, t0);                     // t0 = X-Z 
     fp2sqr_mont(t0, t2);                            // t2 = (X-Z)^2           
@@ -128,10 +129,11 @@ void xTPL(const point_proj_t P, point_proj_t Q, const f2elm_t A24minus, const f2
     mp2_sub_p2(t1, t3, t1);                         // t1 = 4*X^2 - (X+Z)^2 
     mp2_sub_p2(t1, t2, t1);                         // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
     fp2mul_mont(A24plus, t3, t5);                   // t5 = A24plus*(X+Z)^2 
-    fp2mul_mont(t3, t5, t3);                        // t3 = A24plus*(X+Z)^4
+    mp2_mul(t3, t5, tt0);                           // tt0 = A24plus*(X+Z)^4, unreduced
     fp2mul_mont(A24minus, t2, t6);                  // t6 = A24minus*(X-Z)^2
-    fp2mul_mont(t2, t6, t2);                        // t2 = A24minus*(X-Z)^4
-    mp2_sub_p2(t2, t3, t3);                         // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    mp2_mul(t2, t6, tt1);                           // tt1 = A24minus*(X-Z)^4, unreduced
+    mp2_subx2(tt1, tt0, tt0);                       // tt0 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    rdc2_mont(tt0, t3);                             // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
     mp2_sub_p2(t5, t6, t2);                         // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
     fp2mul_mont(t1, t2, t1);                        // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
     fp2add(t3, t1, t2);                             // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
@@ -219,6 +221,62 @@ void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3)
 }
 
 
+static digit_t fp2_one_if_zero(const f2elm_t a, f2elm_t b)
+{ // b = a, or b = 1 if a = 0, in constant time.
+  // Returns 0xFF...F if a = 0 and 0 otherwise.
+    f2elm_t c;
+    digit_t mask = 0;
+    unsigned int i;
+
+    fp2copy(a, c);
+    fp2correction(c);
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mask |= c[0][i] | c[1][i];
+    }
+    mask = ((mask | (0 - mask)) >> (RADIX-1)) - 1;     // mask = 0xFF...F if a = 0
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        b[0][i] = (a[0][i] & ~mask) | (((digit_t*)&Montgomery_one)[i] & mask);
+        b[1][i] = a[1][i] & ~mask;
+    }
+    return mask;
+}
+
+
+void inv_n_way(f2elm_t* z, f2elm_t* t, const unsigned int n)
+{ // n-way simultaneous inversion using Montgomery's trick, in constant time
+  // Input:  z[0],...,z[n-1] with n >= 1, and scratch space t with n elements
+  // Output: 1/z[0],...,1/z[n-1] (override inputs).
+  // A zero z[i] is replaced by 1 in the products and its output is 0, as fp2inv_mont() gives, so it does not 
+  // affect the other outputs. The inputs can therefore come from untrusted public keys or ciphertexts.
+    f2elm_t t1, t2, zi;
+    digit_t mask;
+    unsigned int i, k;
+
+    fp2_one_if_zero(z[0], t[0]);
+    for (i = 1; i < n; i++) {
+        fp2_one_if_zero(z[i], zi);
+        fp2mul_mont(t[i-1], zi, t[i]);            // t[i] = z[0]*...*z[i]
+    }
+    fp2copy(t[n-1], t1);
+    fp2inv_mont(t1);                              // t1 = 1/(z[0]*...*z[n-1])
+
+    for (i = n-1; i >= 1; i--) {
+        mask = fp2_one_if_zero(z[i], zi);
+        fp2mul_mont(t[i-1], t1, t2);              // t2 = 1/z[i]
+        fp2mul_mont(t1, zi, t1);                  // t1 = 1/(z[0]*...*z[i-1])
+        for (k = 0; k < NWORDS_FIELD; k++) {
+            z[i][0][k] = t2[0][k] & ~mask;
+            z[i][1][k] = t2[1][k] & ~mask;
+        }
+    }
+    mask = fp2_one_if_zero(z[0], zi);
+    for (k = 0; k < NWORDS_FIELD; k++) {          // z[0] = 1/z[0]
+        z[0][0][k] = t1[0][k] & ~mask;
+        z[0][1][k] = t1[1][k] & ~mask;
+    }
+}
+
+
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A)
 { // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
   // Input:  the x-coordinates xP, xQ, and xR of the points P, Q and R.
@@ -362,6 +420,67 @@ static void LADDER3PT(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xPQ, con
     swap_points(R, R2, mask);
 }
 
+#if defined(_FIXED_BASE_LADDER_) && !defined(COMPRESS)    // The compressed variants use their own key generation
+
+static void LADDER3PT_fixed(const f2elm_t xP, const f2elm_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_t R)
+{ // Right-to-left three-point ladder for the fixed generators of the starting curve.
+  // The multiples x(2^i*Q) are read from the precomputed tables Alice_ladder and Bob_ladder, so every step costs one differential addition.
+  // Input:  affine xP = x(P) and xPQ = x(P-Q), where Q is Alice's or Bob's fixed generator, and scalar m.
+  // Output: projective Montgomery point R = (X:Z) such that x(P+m*Q) = X/Z.
+    point_proj_t R2 = {0};
+    f2elm_t xQ, one = {0}, t0, t1, t2, t3;
+    const digit_t* table;
+    digit_t mask;
+    int i, nbits, bit, swap, prevbit = 0;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+        table = (const digit_t*)Alice_ladder;
+    } else {
+        nbits = OBOB_BITS - 1;
+        table = (const digit_t*)Bob_ladder;
+    }
+
+    // Initializing points
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+    fp2copy(xPQ, R2->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R2->Z);
+    fp2copy(xP, R->X);
+    fpcopy((digit_t*)&Montgomery_one, (digit_t*)R->Z);
+    fpzero((digit_t*)(R->Z)[1]);
+
+    // Main loop
+    for (i = 0; i < nbits; i++) {
+        bit = (m[i >> LOG2RADIX] >> (i & (RADIX-1))) & 1;
+        swap = bit ^ prevbit;
+        prevbit = bit;
+        mask = 0 - (digit_t)swap;
+
+        swap_points(R, R2, mask);
+        fpcopy((digit_t*)table + 2*i*NWORDS_FIELD, xQ[0]);
+        fpcopy((digit_t*)table + (2*i+1)*NWORDS_FIELD, xQ[1]);
+
+        // R2 <- R2 + 2^i*Q, with difference R
+        mp2_add(R2->X, R2->Z, t0);                  // t0 = X2+Z2
+        mp2_sub_p2(R2->X, R2->Z, t1);               // t1 = X2-Z2
+        mp2_sub_p2(xQ, one, t2);                    // t2 = xQ-1
+        mp2_add(xQ, one, t3);                       // t3 = xQ+1
+        fp2mul_mont(t0, t2, t0);                    // t0 = (X2+Z2)*(xQ-1)
+        fp2mul_mont(t1, t3, t1);                    // t1 = (X2-Z2)*(xQ+1)
+        mp2_add(t0, t1, R2->X);                     // X2 = (X2+Z2)*(xQ-1)+(X2-Z2)*(xQ+1)
+        mp2_sub_p2(t1, t0, R2->Z);                  // Z2 = (X2-Z2)*(xQ+1)-(X2+Z2)*(xQ-1)
+        fp2sqr_mont(R2->X, R2->X);                  // X2 = [(X2+Z2)*(xQ-1)+(X2-Z2)*(xQ+1)]^2
+        fp2sqr_mont(R2->Z, R2->Z);                  // Z2 = [(X2-Z2)*(xQ+1)-(X2+Z2)*(xQ-1)]^2
+        fp2mul_mont(R2->X, R->Z, R2->X);            // X2 = ZR*[(X2+Z2)*(xQ-1)+(X2-Z2)*(xQ+1)]^2
+        fp2mul_mont(R2->Z, R->X, R2->Z);            // Z2 = XR*[(X2-Z2)*(xQ+1)-(X2+Z2)*(xQ-1)]^2
+    }
+    swap = 0 ^ prevbit;
+    mask = 0 - (digit_t)swap;
+    swap_points(R, R2, mask);
+}
+
+#endif
+
 #ifdef COMPRESS
 
 static void CompletePoint(const point_proj_t P, point_full_proj_t R)
@@ -376,9 +495,7 @@ static void CompletePoint(const point_proj_t P, point_full_proj_t R)
     fpsub(P->X[1], P->Z[0], t1[1]);
     fp2mul_mont(t0, t1, s2);
     fp2mul_mont(xz, s2, r2);
-    sqrt_Fp2(r2, yz);
-    fp2copy(P->Z,invz);
-    fp2inv_mont_bingcd(invz);    
+    sqrtinv2(r2, P->Z, yz, invz);
     fp2mul_mont(P->X, invz, R->X);
     fp2sqr_mont(invz, t0);
     fp2mul_mont(yz, t0, R->Y);
@@ -391,7 +508,7 @@ void CompleteMPoint(const f2elm_t A, point_proj_t P, point_full_proj_t R)
     f2elm_t zero = {0}, one = {0}, xz, yz, s2, r2, invz, temp0, temp1;
 
     fpcopy((digit_t*)&Montgomery_one, one[0]);    
-    if (memcmp(P->Z[0], zero,NBITS_TO_NBYTES(NBITS_FIELD)) != 0 || memcmp(P->Z[1], zero, NBITS_TO_NBYTES(NBITS_FIELD)) != 0) {
+    if (memcmp(P->Z, zero, sizeof(f2elm_t)) != 0) {
         fp2mul_mont(P->X, P->Z, xz);       // xz = x*z;
         fpsub(P->X[0], P->Z[1], temp0[0]);
         fpadd(P->X[1], P->Z[0], temp0[1]);
@@ -401,9 +518,7 @@ void CompleteMPoint(const f2elm_t A, point_proj_t P, point_full_proj_t R)
         fp2mul_mont(A, xz, temp0);
         fp2add(temp0, s2, temp1);
         fp2mul_mont(xz, temp1, r2);        // r2 = xz*(A*xz + s2);
-        sqrt_Fp2(r2, yz);
-        fp2copy(P->Z, invz);
-        fp2inv_mont_bingcd(invz);        
+        sqrtinv2(r2, P->Z, yz, invz);      // yz = sqrt(r2), invz = 1/z
         fp2mul_mont(P->X, invz, R->X);
         fp2sqr_mont(invz, temp0);
         fp2mul_mont(yz, temp0, R->Y);      // R = EM![x*invz, yz*invz^2];
@@ -444,6 +559,7 @@ void xTPL_fast(const point_proj_t P, point_proj_t Q, const f2elm_t A2)
   // Input : projective Montgomery x-coordinates P = (X:Z), where x=X/Z and Montgomery curve constant A/2. 
   // Output: projective Montgomery x-coordinates Q = 3*P = (X3:Z3).
        f2elm_t t1, t2, t3, t4;
+       df2elm_t tt1, tt2;
        
        fp2sqr_mont(P->X, t1);        // t1 = x^2
        fp2sqr_mont(P->Z, t2);        // t2 = z^2
@@ -454,14 +570,15 @@ void xTPL_fast(const point_proj_t P, point_proj_t Q, const f2elm_t A2)
        fp2mul_mont(A2, t4, t4);      // t4 = t4*A2
        fp2add(t3, t4, t4);           // t4 = t4 + t3
        fp2sub(t1, t2, t3);           // t3 = t1 - t2
-       fp2sqr_mont(t3, t3);          // t3 = t3^2
-       fp2mul_mont(t1, t4, t1);      // t1 = t1*t4
-       fp2shl(t1, 2, t1);            // t1 = 4*t1
-       fp2sub(t1, t3, t1);           // t1 = t1 - t3
+       fp2shl(t4, 2, t4);            // t4 = 4*t4
+       mp2_sqr(t3, tt1);             // tt1 = t3^2, unreduced
+       mp2_mul(t1, t4, tt2);         // tt2 = t1*t4, unreduced
+       mp2_subx2(tt2, tt1, tt2);     // tt2 = tt2 - tt1
+       rdc2_mont(tt2, t1);           // t1 = tt2 reduced
        fp2sqr_mont(t1, t1);          // t1 = t1^2
-       fp2mul_mont(t2, t4, t2);      // t2 = t2*t4
-       fp2shl(t2, 2, t2);            // t2 = 4*t2
-       fp2sub(t2, t3, t2);           // t2 = t2 - t3
+       mp2_mul(t2, t4, tt2);         // tt2 = t2*t4, unreduced
+       mp2_subx2(tt2, tt1, tt2);     // tt2 = tt2 - tt1
+       rdc2_mont(tt2, t2);           // t2 = tt2 reduced
        fp2sqr_mont(t2, t2);          // t2 = t2^2
        fp2mul_mont(P->X, t2, Q->X);  // x = x*t2
        fp2mul_mont(P->Z, t1, Q->Z);  // z = z*t1    
@@ -679,4 +796,58 @@ void Ladder(const point_proj_t P, const digit_t* m, const f2elm_t A, const unsig
     fp2copy(R0->Z, R->Z);
 }
 
-#endif
\ No newline at end of file
+#endif
+
+#if defined(_AVX2_ISOGENY_)
+
+#ifndef AVX2_LANES
+    #define AVX2_LANES        4           // Largest number of points per vector, 2 or 4
+#endif
+#define AVX2_MAX_POINTS       (((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB) + 3)
+
+static void eval_isog_avx2(const unsigned int AliceOrBob, point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates an isogeny at the npts points in pts and at the points P, Q and R that are not NULL, in groups of AVX2_LANES 
+  // and then two points in the lanes of AVX2 vectors. A remaining point, and all points on processors without AVX2, use the single-point evaluation.
+    point_proj* points[AVX2_MAX_POINTS];
+    point_proj* extra[3] = {P, Q, R};
+    unsigned int i, n = 0;
+
+    for (i = 0; i < npts; i++) {
+        points[n++] = pts[i];
+    }
+    for (i = 0; i < 3; i++) {
+        if (extra[i] != NULL) points[n++] = extra[i];
+    }
+
+    i = 0;
+    if (__builtin_cpu_supports("avx2")) {
+#if (AVX2_LANES == 4)
+        for (; i+4 <= n; i += 4) {
+            if (AliceOrBob == ALICE) eval_4_isog_x4(&points[i], coeff);
+            else                     eval_3_isog_x4(&points[i], coeff);
+        }
+#endif
+        for (; i+2 <= n; i += 2) {
+            if (AliceOrBob == ALICE) eval_4_isog_x2(&points[i], coeff);
+            else                     eval_3_isog_x2(&points[i], coeff);
+        }
+    }
+    for (; i < n; i++) {
+        if (AliceOrBob == ALICE) eval_4_isog(points[i], coeff);
+        else                     eval_3_isog(points[i], coeff);
+    }
+}
+
+
+static void eval_4_isog_avx2(point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates a 4-isogeny at the stored points pts[0..npts-1] and at P, Q and R (if not NULL)
+    eval_isog_avx2(ALICE, pts, npts, P, Q, R, coeff);
+}
+
+
+static void eval_3_isog_avx2(point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates a 3-isogeny at the stored points pts[0..npts-1] and at P, Q and R (if not NULL)
+    eval_isog_avx2(BOB, pts, npts, P, Q, R, coeff);
+}
+
+#endif
@@ -0,0 +1,45 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: run-time selection of the field arithmetic for x64 platforms
+*********************************************************************************************/
+
+#ifndef FP_DISPATCH_H
+#define FP_DISPATCH_H
+
+#include "config.h"
+
+
+// Field arithmetic backends, from the slowest to the fastest one
+#define FP_BACKEND_GENERIC      0        // Portable C
+#define FP_BACKEND_X64          1        // x64 assembly with mul/adc
+#define FP_BACKEND_MULX         2        // x64 assembly with mulx (BMI2)
+#define FP_BACKEND_ADX          3        // x64 assembly with mulx and adox/adcx (BMI2 and ADX)
+#define FP_BACKEND_COUNT        4
+
+// Field and multiprecision functions that depend on the backend
+typedef struct {
+    const char* name;
+    void (*fpadd)(const digit_t* a, const digit_t* b, digit_t* c);          // c = a+b mod p
+    void (*fpsub)(const digit_t* a, const digit_t* b, digit_t* c);          // c = a-b mod p
+    void (*mp_add)(const digit_t* a, const digit_t* b, digit_t* c);         // c = a+b
+    void (*mp_sub_p2)(const digit_t* a, const digit_t* b, digit_t* c);      // c = a-b+2p
+    void (*mp_sub_p4)(const digit_t* a, const digit_t* b, digit_t* c);      // c = a-b+4p
+    void (*mp_subaddx2)(const digit_t* a, const digit_t* b, digit_t* c);    // c = a-b+(p*2^MAXBITS_FIELD) if a-b < 0, otherwise c = a-b
+    void (*mp_dblsubx2)(const digit_t* a, const digit_t* b, digit_t* c);    // c = c-a-b
+    void (*mul)(const digit_t* a, const digit_t* b, digit_t* c);            // c = a*b
+    void (*rdc)(digit_t* ma, digit_t* mc);                                  // Montgomery reduction
+} fp_backend_t;
+
+// All the backends, indexed by FP_BACKEND_*, and the one in use. At load time the latter is set
+// to the fastest backend supported by the processor
+extern const fp_backend_t fp_backends[FP_BACKEND_COUNT];
+extern const fp_backend_t* fp_backend;
+
+// Returns 1 if the processor supports the given backend, 0 otherwise
+int fp_backend_supported(unsigned int backend);
+
+// Switches to the given backend. Returns 0 on success and -1 if it is not supported
+int fp_backend_select(unsigned int backend);
+
+#endif
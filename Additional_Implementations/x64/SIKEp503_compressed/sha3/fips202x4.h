@@ -0,0 +1,31 @@
+#ifndef FIPS202X4_H
+#define FIPS202X4_H
+
+#include <stdint.h>
+#include <immintrin.h>
+#include "fips202.h"
+
+
+// Keccak-f[1600] on four independent states, one per 64-bit lane of each AVX2 vector
+void KeccakF1600_StatePermute4x(__m256i *s);
+
+// SHAKE256 of four equal-length inputs
+void shake256x4_absorb(__m256i *s, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen);
+void shake256x4_squeezeblocks(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long nblocks, __m256i *s);
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen,
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen);
+
+// Incremental SHAKE256 of four inputs, as shake256_inc_* in fips202.h. Each call absorbs the same number of bytes
+// from the four inputs
+typedef struct {
+    __m256i s[25];
+    unsigned int pos;                    // Bytes absorbed into, or squeezed from, the current block
+} shake256x4_inc_state;
+
+void shake256x4_inc_init(shake256x4_inc_state *state);
+void shake256x4_inc_absorb(shake256x4_inc_state *state, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen);
+void shake256x4_inc_finalize(shake256x4_inc_state *state);
+void shake256x4_inc_squeeze(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, shake256x4_inc_state *state);
+
+
+#endif
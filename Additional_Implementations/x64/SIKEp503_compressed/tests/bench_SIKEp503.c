@@ -0,0 +1,19 @@
+/**********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmarking the field arithmetic backends of SIKEp503_compressed
+***********************************************************************************************/ 
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                  // For sched_setaffinity()
+#endif
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/api.h"
+
+
+#define SCHEME_NAME    "SIKEp503_compressed"
+
+
+#include "bench.c"
@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals of SIKEp503_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp503_compressed"
+#define fp2random_test    fp2random503_test
+
+
+#include "strategy.c"
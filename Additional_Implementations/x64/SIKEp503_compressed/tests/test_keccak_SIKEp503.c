@@ -0,0 +1,16 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the 4-way SHAKE256 for SIKEp503 using compression
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp503_compressed"
+
+
+#include "test_keccak.c"
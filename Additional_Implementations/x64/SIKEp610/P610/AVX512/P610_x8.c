@@ -0,0 +1,59 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny computations in eight lanes for P610 using AVX-512 IFMA
+*********************************************************************************************/
+
+#include "../P610_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_52       13         // Number of limbs in radix 2^52, R' = 2^676
+
+// p610, 2*p610 and 4*p610 in radix 2^52
+static const uint64_t p_52[3][NLIMBS_52] = {
+    {
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x00001FFFFFFFFFFF, 0x000DE8AA5AB02E6E, 0x000048FF9ABB1784,
+      0x0004252A9AE7BF45, 0x0008CB255B2FA10C, 0x00019010C251E7D8, 0x00000027BF6A7688,
+      0x0000000000000000 },
+    {
+      0x000FFFFFFFFFFFFE, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x00003FFFFFFFFFFF, 0x000BD154B5605CDC, 0x000091FF35762F09,
+      0x00084A5535CF7E8A, 0x0001964AB65F4218, 0x0003202184A3CFB1, 0x0000004F7ED4ED10,
+      0x0000000000000000 },
+    {
+      0x000FFFFFFFFFFFFC, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x00007FFFFFFFFFFF, 0x0007A2A96AC0B9B8, 0x000123FE6AEC5E13,
+      0x000094AA6B9EFD14, 0x00032C956CBE8431, 0x0006404309479F62, 0x0000009EFDA9DA20,
+      0x0000000000000000 } };
+
+// Conversion constants: R'^2/R mod p610 maps the Montgomery representation with R = 2^640 to the one with R',
+// and R mod p610 maps it back
+static const uint64_t to_mont_52[NLIMBS_52] = {
+    0x000084AEB32542D9, 0x000670CC8E66A812, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0004E00000000000, 0x000F087CB763FE3C, 0x00025BEB7214AA57,
+    0x000519DB188B3141, 0x000C5859EE73FD6D, 0x000D298407D0FA70, 0x0000000F6A09DA06,
+    0x0000000000000000 };
+static const uint64_t from_mont_52[NLIMBS_52] = {
+    0x00000000670CC8E6, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0003400000000000, 0x0002BD28717A3F9A, 0x000A323D41C4D99C,
+    0x000AD1E20A4A1839, 0x0003DD2B62215D06, 0x000369026E862CAF, 0x00000010894E9641,
+    0x0000000000000000 };
+
+// Value one in Montgomery representation with R'
+static const uint64_t one_52[NLIMBS_52] = {
+    0x000C8E66A812084A, 0x000000000000670C, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0006C00000000000, 0x000A502006930023, 0x000A4D5619B4F9A3,
+    0x000FFB03540D27AE, 0x000C7B720CC2376A, 0x000FC70D6C82AA29, 0x0000002484872F7C,
+    0x0000000000000000 };
+
+
+#define keygen_A_x8                   keygen_A610_x8
+#define keygen_B_x8                   keygen_B610_x8
+#define agreement_A_x8                agreement_A610_x8
+#define agreement_B_x8                agreement_B610_x8
+#define fp_ifma_enabled               fp610_ifma_enabled
+#define fp_ifma_supported             fp610_ifma_supported
+
+#include "../../sidh_x8.c"
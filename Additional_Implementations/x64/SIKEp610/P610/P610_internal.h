@@ -48,6 +48,7 @@
 #define SECRETKEY_A_BYTES       ((OALICE_BITS + 7) / 8)
 #define SECRETKEY_B_BYTES       ((OBOB_BITS - 1 + 7) / 8)
 #define FP2_ENCODED_BYTES       2*((NBITS_FIELD + 7) / 8)
+#define INV_BATCH_SIZE          16                                  // Number of batch operations whose conversions to affine share an inversion
 
 #ifdef COMPRESS
     #define MASK2_BOB               0x07
@@ -100,6 +101,7 @@
 typedef digit_t felm_t[NWORDS_FIELD];                                 // Datatype for representing 610-bit field elements (640-bit max.)
 typedef digit_t dfelm_t[2*NWORDS_FIELD];                              // Datatype for representing double-precision 2x610-bit field elements (2x640-bit max.) 
 typedef felm_t  f2elm_t[2];                                           // Datatype for representing quadratic extension field elements GF(p610^2)
+typedef dfelm_t df2elm_t[2];                                          // Datatype for representing double-precision GF(p610^2) elements
         
 typedef struct { f2elm_t X; f2elm_t Z; } point_proj;                  // Point representation in projective XZ Montgomery coordinates.
 typedef point_proj point_proj_t[1]; 
@@ -179,6 +181,9 @@ void fpinv610_mont(digit_t* a);
 // Field inversion, a = a^-1 in GF(p610) using the binary GCD 
 void fpinv610_mont_bingcd(digit_t* a);
 
+// Constant-time field inversion, a = a^-1 in GF(p610) using the safegcd algorithm of Bernstein and Yang
+void fpinv610_mont_safegcd(digit_t* a);
+
 // Chain to compute (p610-3)/4 using Montgomery arithmetic
 void fpinv610_chain_mont(digit_t* a);
 
@@ -217,5 +222,51 @@ void fp2inv610_mont(f2elm_t a);
 // GF(p610^2) inversion, a = (a0-i*a1)/(a0^2+a1^2), GF(p610) inversion done using the binary GCD 
 void fp2inv610_mont_bingcd(f2elm_t a);
 
+/************ Isogeny computations in eight lanes using AVX-512 IFMA (AVX512/P610_x8.c) *************/
+
+#if defined(_AVX512_IFMA_)
+// Set to 1 at load time if the processor supports AVX-512 IFMA, in which case the batch functions use the lanes
+extern int fp610_ifma_enabled;
+
+// Returns 1 if the processor supports AVX-512 IFMA, 0 otherwise
+int fp610_ifma_supported(void);
+
+#define IFMA_LANES    8                  // Number of operations that are computed simultaneously
+#define IFMA_MIN_LANES    2              // Smallest number of operations that are computed in the lanes, fewer ones use the scalar code
+
+// Alice's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER].
+// Outputs the projective images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Bob's basis points
+void keygen_A610_x8(const digit_t* SecretKeyA, f2elm_t* X, f2elm_t* Z);
+
+// Bob's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER].
+// Outputs the projective images (X[3*j+k]:Z[3*j+k]), k = 0, 1, 2, of Alice's basis points
+void keygen_B610_x8(const digit_t* SecretKeyB, f2elm_t* X, f2elm_t* Z);
+
+// Alice's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER], 
+// Bob's public key PK[3*j+k] and its curve coefficient A[j]. Outputs the coefficients (jA[j]:jC[j]) of the shared curve
+void agreement_A610_x8(const digit_t* SecretKeyA, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC);
+
+// Bob's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER], 
+// Alice's public key PK[3*j+k] and its curve coefficient A[j]. Outputs the coefficients (jA[j]:jC[j]) of the shared curve
+void agreement_B610_x8(const digit_t* SecretKeyB, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC);
+#endif
+
+
+/************ Isogeny evaluations in the lanes of AVX2 vectors (AVX2/P610_avx2.c) *************/
+
+#if defined(_AVX2_ISOGENY_)
+// Evaluates a 4-isogeny at the four points P[0], ..., P[3] in radix 2^28, see eval_4_isog()
+void eval_4_isog610_x4(point_proj* const* P, f2elm_t* coeff);
+
+// Evaluates a 3-isogeny at the four points P[0], ..., P[3] in radix 2^28, see eval_3_isog()
+void eval_3_isog610_x4(point_proj* const* P, const f2elm_t* coeff);
+
+// Evaluates a 4-isogeny at the two points P[0] and P[1] in radix 2^28, see eval_4_isog()
+void eval_4_isog610_x2(point_proj* const* P, f2elm_t* coeff);
+
+// Evaluates a 3-isogeny at the two points P[0] and P[1] in radix 2^28, see eval_3_isog()
+void eval_3_isog610_x2(point_proj* const* P, const f2elm_t* coeff);
+#endif
+
 
 #endif
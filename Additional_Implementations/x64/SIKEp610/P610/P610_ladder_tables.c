@@ -0,0 +1,3057 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: precomputed tables for the fixed-base three-point ladder on E0 for P610
+*********************************************************************************************/  
+
+
+// x(2^i*QA) for i = 0..OALICE_BITS-1, where QA is Alice's fixed generator, expressed in Montgomery representation.
+const uint64_t Alice_ladder[OALICE_BITS*2*NWORDS64_FIELD] = { 
+0x1D7C945D3DBCC38C, 0x9A5F7C12CA8BA5B9, 0x1E8F87985B01CBE3, 0xD2CABF82F5BC5235,
+0x3BDE474ECCA9FAA2, 0xB98CD975DF9FB0A8, 0x444E4464B9C67790, 0xCB2E888565CE6AD9,
+0xDB64FFE2A1C350E2, 0x00000001D7532756, 0x1E8B3AA2382C9079, 0x28CB31E08A943C00,
+0xE04D02266E8A63E1, 0x84A2D260214EF65F, 0xD5933DA25018E226, 0xBC8BF038928C4BA9,
+0x91E9D0CB7EAF58A9, 0x04A4627B75E008E1, 0x58CEF27583E50C2E, 0x00000002170DDF44,
+0x6A1780C944B6E895, 0xAE6AD143803EF81C, 0x77AA275877E979D8, 0x9A6995A8FF1213BF,
+0x343C9D5ABDE07434, 0x2F8970300D9FE1FB, 0x50B0122B247B1C08, 0x1A08CE2E1D4EB760,
+0xCC149C30349E70A7, 0x000000016E601486, 0xB7710CD4834A4806, 0x1D097F82A83E41DF,
+0x0AF24F05CB1D4770, 0xD305F5B593673883, 0x16D0D5A1BB928C11, 0x23C8EF0280A4625E,
+0x0B20BF19CA660F7F, 0xC49461DDF609A35B, 0x645D3BF49283254A, 0x00000001B2DE4918,
+0xE3D0FAB69CF49B68, 0xF509DF1AAA382089, 0xF18A7C0CB65F126D, 0x41B85FBBE2E77BE4,
+0xCE7B5BADAE158B6E, 0xDAC17A6702B60506, 0xAA7D0BAB64A4D878, 0x5DC25FB308D4CD83,
+0xBBC280F72321B342, 0x000000012BE39F82, 0x34C31600B44CB559, 0x4BDDF078844DB923,
+0x311FB02E1493AB90, 0xBFFAD53C4A76BCE8, 0xD1B745BB599558F6, 0x36B0379AA0B588C8,
+0xC667BC08934BEC67, 0xDF2EA28825120C6D, 0x9F479B7F330C36B2, 0x000000010243E7C3,
+0x403F19F34B43DFB0, 0xF704B4BDDD817D94, 0xFE16AF8F5B73D6C3, 0x8A676C1FE38000B1,
+0x384057F2F3670E73, 0xB39236A724F1E740, 0xCCAB975C4B3A212D, 0x0D57BA6ED43A598D,
+0x5565F0E02D1F737F, 0x000000020F4AF260, 0xCB41A528A2F27483, 0x8CD7F22A50318918,
+0x4A56F8D3F2274B50, 0x8314DD29361EB172, 0x1F43D7EB4FE26325, 0xC02E03336A04E9AB,
+0x77D2B823A2197F90, 0x75446B3292528C20, 0xAC84B293AAFEB669, 0x00000000BBDED5D8,
+0x4F7F959802B9C5CA, 0x674D14AAC584D184, 0xDC6C11918FC3D511, 0x09459A3680327CBD,
+0xEF77AA914BE36054, 0x6B70B30994BDF9A0, 0x62E71D48DDB4CD90, 0x69CB6D7ACB7BC762,
+0x5F966C3E13CB0BAA, 0x0000000209D21882, 0xC70E6C94641E29CB, 0x1495A110816A0B34,
+0x83806B6B651CDA66, 0x49DADCF870C6E815, 0xAD2F3F2B98F29EA0, 0xC3102CCBE4C8F169,
+0xF690CC2B1CCB221A, 0x00805762B43A48D7, 0xBFE0D60C45576A23, 0x00000000AF8349F4,
+0x32729317AE0B949C, 0x1859E2C73DFBD5B1, 0x7C8525F327962A2F, 0x1C24CA2B778B8B21,
+0x89F9D9F4BE76E52C, 0xA183621047D5538D, 0xC25F31075F4905EE, 0x3B216C394F5B73D7,
+0x6E9AC97917041A10, 0x000000007F6430F1, 0x37D0201D6337DDD5, 0x2F05078B89AF05BC,
+0xF1A5B4C9D94CA02A, 0xECE52A24E49BED44, 0xF6BA3B006A20D5A9, 0x7135410ACC6678BE,
+0x5C6C49CF2F7A3979, 0x3AD7095EFC3BFE08, 0xAE9CD92359783259, 0x000000014D11A9F1,
+0x2A46D0AFAAF09C22, 0x8A9DBC3B5E8A5658, 0x30FBF8581583166A, 0xAD6999550090E2DC,
+0x164F9E7821BB2E47, 0x21251956E04859F4, 0x27B4A7C05338A683, 0xB1CA07FF920447BB,
+0x251A9F236B2C095C, 0x00000002799B00D9, 0x20750E6B5E1B8C5C, 0xE389EC5415F4442A,
+0x0062EA296CF87218, 0x723FC5E833499692, 0x29DB857B11B77800, 0xBAA7115DA31012AD,
+0x5173BC99DA748057, 0x2A8A114CE20B6C62, 0x2D1077D996DEE370, 0x000000024E61FFBB,
+0x422A3F1BFAC9E9FC, 0x280ADBAF5225D48D, 0xD37E30990DEEC816, 0x9FB1F2B48AFA8347,
+0x837F74927E4AE47B, 0x0B1434645E3E77B1, 0x7F85425162C115AE, 0xAC20012F96B09D28,
+0xC42C15DEFB47D4A2, 0x000000015993F600, 0xAE9C19B8968C1B63, 0x52C25422378B4810,
+0x391BED0F0E5199B5, 0xC86640CA6C572901, 0x9509B9D484A60BBE, 0x6A5636DA0019B48B,
+0x352F8D7A8B73BB6D, 0xF4248DB19CD9DC5C, 0xB92A47FA65FC7F12, 0x000000014A6C0B92,
+0x45D3DDBA3BE2C508, 0x9308DFFAF0A5571C, 0x68C06EEA7FDE0B17, 0xC95D2B7E02F03AD0,
+0xF763B90787A9D14C, 0xB548375E9EAF14E7, 0xCDDEDFA6F63D3A8D, 0xF5DB131C18A833E9,
+0x8C68E537AC488EAB, 0x000000022C9EA284, 0xF50594577459BFB3, 0xAB87FB66C59EFE28,
+0x6889733435399FF5, 0x1D1294704CBB0452, 0x992C583907675A33, 0x01EF05A42032799A,
+0x754C8E0F8E8277B8, 0x3D80AB2973DD2633, 0x70E26B54C278E227, 0x000000024D6EB9E3,
+0x846B55A6495D93E9, 0xF55BF5D207F818EF, 0xC53FCE9F037D74A4, 0x566F26CE86C5FFC5,
+0x5B167EBB299B448E, 0x06796B52E8414F2C, 0xE7449204A0A061CB, 0x56C59045136B4D83,
+0xC8EB79A84F8FBF76, 0x00000001B6FC8141, 0x36F524DF25748F4A, 0x0482169D4EBD03E7,
+0x6857FF71A886228E, 0x369B15B50EE93484, 0x8269C370AAB9273D, 0xA2DE0173A32C4AC1,
+0x62656A73B261E575, 0x9DAC098CAE16CEE2, 0xB50B3C18400F273E, 0x000000003E9D4257,
+0xADBFC87E4A18C860, 0x68A05493BE2D3855, 0x9D86D62FF8EF3462, 0xB7FBE783E91A42CE,
+0xD82F97345D46A376, 0xCF4E43013E384035, 0x83794AAE2A82F9B3, 0x4873392BDFCA36B7,
+0xB30518E45B50CB50, 0x00000000C83AD707, 0x52BA654B03C17EB5, 0x7B04FB42F13E9F75,
+0x95FBF4EA6919DDDC, 0x7286D2BD47E2A501, 0xB9DF9FDCCF80E603, 0x9C9C68C7DA7914DA,
+0x5485EA5CC3FCCC23, 0x2734D6B08BB1494B, 0x6DC6082ABCA982F4, 0x00000000C07CBBED,
+0x91D33D7CB0F8045C, 0xE731D8281192511B, 0x23C0D3D28E3116B0, 0x1504DB94FD7D97B5,
+0xB17FE4C75D105EAB, 0xFE84B1709F3277DB, 0x1E54C1E96977BFC9, 0xB79DF6B9379C89D0,
+0x5E13871D1981DEE1, 0x00000002259B9019, 0x7A5B310E9E56ACBC, 0x14BF1A7B8204F169,
+0x7518F71AD8F15D2D, 0xC6C69C4D174A8548, 0x19FD58C004A38175, 0x3CC24C0CD1AF69C0,
+0xF84F34A348AEF220, 0xFC4699C8C6EEB79E, 0x87E35AA41FAB59C3, 0x000000003B4C9C47,
+0x20474FEA27889D4B, 0x817A1F4B7006F72D, 0x98C6780F0D3B1C5C, 0xCB8D5F7F81E7B96D,
+0x94E222B0744E1E11, 0xB8D5E2B12D4AF0AD, 0x4506990E01DAB90F, 0xAD985EE4156CC02D,
+0xA2B1997F7A8710D1, 0x000000004775D4D5, 0x4283E20023F506AB, 0xBEF1AC3587F59504,
+0x7F3405DA67E6DB7A, 0x75E1291F60BDDCFF, 0xB98F085FD4D2DC98, 0xA2B4BE825994175B,
+0x329BB685C7139087, 0x3CF751E04B9DD51E, 0xE5A7FB1AF3473E5A, 0x00000000943475B1,
+0xE2C24E4AB9AF2665, 0x2E16274B319094A6, 0x78956411CF0BC9CC, 0x30931D6C65615DFC,
+0x9DFE0B9805EFFE29, 0x62062EF9B7CB4D6C, 0x330732A2C3FC9684, 0x2CD3721087945B0B,
+0x96807B437278FE4E, 0x00000000206CFBFA, 0x06237818D33FB52A, 0xC8823C35A672C4D0,
+0x00288C7816479B40, 0x116E0CBA7FD54BF3, 0xC23170A4B4DD1DDB, 0xE4B62339C6BEFB03,
+0xA7BF82F899F9F32F, 0xBB71EA323364395C, 0x24204491711ED387, 0x0000000173EAF828,
+0x2BD096DA8186FA36, 0x126FDA30AFBAAF56, 0x8E3ED3F087A1DFA1, 0xD429C7FD0D3DB7F5,
+0xCBD6EEC9B3397989, 0xD964D0B6AEFA6D9E, 0x092441276355F4B6, 0xE9466823FF43C275,
+0x2CB0C364ACEFF28B, 0x000000003A2E60C6, 0x217D4B5967013B4D, 0xEAE7EDEF729CE520,
+0xBDB067658FB941E1, 0xBB2B32676E4B47F9, 0xCE6D757C72E917DB, 0xE15767F70F3D18A1,
+0x3AC21425673B05F0, 0x4D2023C49619E3EB, 0xB5AE977B4C5C599A, 0x00000001688EE629,
+0x1897E23701779BDB, 0x6026F644A89FB15D, 0x54CEF68A220AA577, 0xCD59F2C3496ABB6B,
+0x52DE495CEC395E52, 0x817D187A66DD3008, 0xDF65424A5C9F6FB0, 0xCFE459C0DED38B24,
+0x6237BA9F03ABBAAC, 0x00000000C939334A, 0x6358D06B60F8EB27, 0x2C3FDD40BE8BACD6,
+0x9D94C6ADFD76A579, 0xC459410F8FC8E068, 0x6058D1E7313667B1, 0x16BE36F7DB1D4F0F,
+0x1CDF77CA60CB8092, 0x08046E116C0AAF5C, 0x01CAAE1E59C00596, 0x00000000BFE87E0E,
+0x7877602A4A7FF6E6, 0xE97273791E5E53B5, 0xE1BB20C68721BDB1, 0x6CC3DF184912BBDC,
+0x42EC7CC14455B5BA, 0x60BD78B8C16F31C8, 0x34FBB7BC3A9E38C7, 0x8D3960627E2F08AB,
+0x2370018C531EA611, 0x000000009BFC1733, 0x632E5159CB9850B1, 0xACC1F020D44ABC14,
+0xA325A21E7F1EC412, 0x9576C93BBEE8578C, 0x23C95C2547990513, 0x4FE7C88099ECDEE8,
+0xDB060D7B3E7F346D, 0xBA6B289B563705A9, 0x466ECC999169EAC6, 0x00000000A7814EB7,
+0x9A6A541A1E319F31, 0x0CC90D8FBE68B128, 0x7A8201A9BD7FAB88, 0x7619CB1E1B800C50,
+0x090AB1476B280460, 0x33F9AFBC63D7A317, 0x3E9BB10C80453CD0, 0xFEB5AAD9BFE7F4DA,
+0x68E71EA6E28C5B27, 0x000000006A79F3BD, 0x71DA8482FE174EC4, 0x6ACDC45E4716CB80,
+0x00D0293C9561A1FB, 0x094B1095A223ECF8, 0x3BFFBC496F43CA9D, 0x1530F6A206DE4C7A,
+0x7DEE21B98D40A3CE, 0xF03C5F60C7B22485, 0x69224D4AB6538069, 0x00000000A5B9CB24,
+0x811CE85EFF3A9F87, 0x746B410D71687272, 0x2B7CBC1E1AE3CC5F, 0x35402B4D698C7AB1,
+0x094623FC8455DA12, 0xBACAD1ADF3C7BC9F, 0x056B43D2153122F4, 0xD56B61C7FF09DF5F,
+0x54BC498050DC96F3, 0x000000011510ECB7, 0x958BB536BF33324A, 0x3621FDCB81DB6E60,
+0x7074D8C3FEA39417, 0x28EB1FF4849FD0DB, 0xFC9D2256990B9600, 0xECED4A942E2EC738,
+0xED182A91D52CF448, 0x5D2DD5C3222A1644, 0xE850BA2F3B14C864, 0x00000001D6E8528D,
+0xB8D29474626D2B93, 0x23936AC63200B63C, 0x30DEFFDC936A52C1, 0x35C855B79B2B2146,
+0x459C9C8FED92DD12, 0x476BC3146A6A54A5, 0x0F8833FB1231D5D3, 0xD200544B03F5D785,
+0x247AB814734CF00C, 0x000000004BD0A817, 0xE8835187A3227126, 0x3448C0ED6AAFABB2,
+0xBB863C788A9D0709, 0x34BC5FD97F05C09B, 0x00F9B8475B51C9DA, 0xAB7BF9EDE61A819C,
+0x1BEA1F7A649495FA, 0x2B48621A924D48C2, 0xEA2363A7B3BC60C9, 0x0000000220D74D6F,
+0x8A98FEC57A72AEF0, 0x3B8AB7599381FE17, 0xD70BAC5C0BFF87BE, 0xBD9DBE9FF306E45A,
+0x1A8EB8157DB4307D, 0xB027FDE7CD98FEBC, 0xAF62FEC96361E139, 0x4E00308F3945140B,
+0x6A0DF39056B86D6A, 0x000000017BA4D1AF, 0x2E3B45B9554F4763, 0x2FCD1CF4D3A30E09,
+0xE5EE3062A255501C, 0x0F1DD769BBEA4003, 0xDE08D4C4974CEB71, 0xBC7FD9BB7614F765,
+0xBD191EC197100EF6, 0x137801D85769FDAD, 0x140CEAFDAE4E87CA, 0x0000000210F82F27,
+0x41A70C5D12556B80, 0x391877B0CAD4682D, 0x52B5665D9A56BAD9, 0xD3B2C01841CF582E,
+0xA071C0EABA2EDC38, 0xA4DC4A19B56C0AD7, 0xD95B8C5DA81FA0BD, 0x571C747C072FBCFF,
+0xA8BEC77078870BC7, 0x000000009F717298, 0x2F791FB0DBA6EF8F, 0x292CC1AA39252BA5,
+0x2BEEC8D21F91B565, 0x30520DD4D94A19DD, 0x65739963FD9D28D8, 0x5CCFFE2F7F8A4234,
+0x969D09C2AF1C8EC0, 0x6EE5AF50067D7EEC, 0x2C514972EC697C3E, 0x00000000AACBF5F9,
+0x3A195998D1E99F6C, 0xEDDBD1B898A6B01E, 0x8F88563C4F4DAF6F, 0x58B22D3149CBFD3C,
+0xA91A475DC7ABE75E, 0x040080AB3FCDEF6D, 0x160612FE9EFD48F9, 0x4D43F8FFC6DF43EE,
+0x941931648E328CB1, 0x0000000012DA5C47, 0xB2404EDDF0BDBA8B, 0xB1D730BEAE57E83C,
+0xC91C6335D52BD0D3, 0xBBA1BFDE169F7E96, 0x311F14029AC94FDD, 0x19397A154B31CA00,
+0x6074FC6E7327BB7E, 0xB036B0BDCED1696E, 0x0166E64A353DDD3E, 0x000000003BFA2DD4,
+0xDFBDFA0F2BD28DBE, 0x35A5D0B683B0CCB6, 0x3C20B22BACCB0045, 0xEB25677FBFA5F12B,
+0x00A75DA113A1E0E1, 0x097E7E50443854FB, 0xC50EC8EBFA497E3A, 0x395E443032859A91,
+0xC6193590C2827394, 0x000000025C0E0738, 0xA251CAED4BBFDEDD, 0xBBDEFAD7ECB16935,
+0x95E135493C3CFEF7, 0xEB9E7363F3910644, 0x3DC121E8B73FF9D4, 0x0EED9159E7CFE4BA,
+0x4AB0EBCDEBA7A6F7, 0xE1808DFB4D04D8B3, 0x16F724D304E7AFFF, 0x000000019C6072D1,
+0xFC603A80DAE8E6D0, 0xA79A24E5A57B007F, 0x30F679644F622F94, 0xA9045E9E96D5E608,
+0x2C1B36648AB6F518, 0x56956F87417F5A93, 0x29BBE7D4236B5465, 0x6B3E6697309DA5C8,
+0x938BB171255969A8, 0x00000000B400DE47, 0x939F1CDDAB0CE5E7, 0xCFBF09E154885127,
+0xDFBD74FC594C21CB, 0xCCDD5B911A321DB2, 0x6EFB11F1655505A3, 0x058E5DE2E8E3E911,
+0xD42EBA87EC5651D8, 0x8660E2B5BEC9B21F, 0xA89AEEB92054BED0, 0x00000000BCC98613,
+0x30C961D5565CDDD8, 0x65B0F3FADA87D712, 0x1229339598B8AC47, 0x579C0FB292E2C65A,
+0x276B58B97A01AA5D, 0x271266E453952E67, 0x5437DB763CD889D1, 0xD7E17C5A5A1B01A8,
+0xB957A90B9DC986A4, 0x0000000022998D66, 0xAD1A5ED73875C517, 0x57E1B51D00132060,
+0x87349DC712D9AB9B, 0x4E704655638E03FE, 0xA491A35A2C790C76, 0xB691C86969C570AC,
+0x6A40DC2B475CD998, 0x5BAB014128ECA908, 0x75A0791C0EED010C, 0x0000000044802AF3,
+0x024176E9C10425E4, 0xD6F8AE8454DA8210, 0xB5F744C9C734009F, 0xC112D094F2F34EBE,
+0xFCDC767B332EC428, 0x2199D7BD298FEABE, 0x620C30FD613FAD28, 0x1B1041FE99ED2F1B,
+0xB770FCF35211B685, 0x00000001D38A2FF1, 0x6ED0D172547EEA26, 0xC812BE40923196B4,
+0xD602E3110EF4AB4D, 0xE37EE6A2966E2F32, 0x35953FA7E984DD37, 0xFEE78876EF28C7E2,
+0x178D4EEE672963FC, 0xD2E7C1BAD806BA98, 0x7C607DF659D70E35, 0x0000000226358608,
+0xC37226A84015CC01, 0x14787DCC880C0B8B, 0xEC3C6459AC3C9F14, 0x8BEA57B7CCCA5CEC,
+0x9FB21644997B8CF4, 0xD851C012D6B6FB5C, 0x5B0197985D77FE14, 0x6F1F62003E8FF656,
+0x6CBCD9B6A7D98786, 0x0000000195D33298, 0x7F8E6F96E1B52BEA, 0xEA21BAFBE3F2F69A,
+0x07B46A30773C0E52, 0x7177ADB09F785064, 0x50017F9D862217A0, 0xB90ACA8AC42AC7C4,
+0x3F0C9352B97B34DD, 0x85E26274CF5D81DF, 0x03AE4ACA75DB653F, 0x000000014402B671,
+0x970B28E8DC3B0F41, 0xF0A1346869DB7CEC, 0x83B99459CC60F81B, 0x569E573942E61F9D,
+0xC03BECA8CC373F4E, 0xA5AB1584406DE96F, 0xAAB5B94FCEF6DFF2, 0xB550079D553A95EB,
+0x946F5CF1CF460D13, 0x00000002552DD9EA, 0xE9A7C405957CB6C4, 0xB926D356BB82E653,
+0xBDAA2588660D1E98, 0x88B1CC9FD25178DF, 0x99C7551B334EF35F, 0xE34C9680ECC272A3,
+0x8932973F275B7DFE, 0xCDEA26F8F5747DF3, 0x9932371B8DDFDA3F, 0x000000014B610AC2,
+0xA37884D4E7DD4209, 0x08CA1A33BF9AD55C, 0xACAA74AF31C30495, 0x3F899A4EA76A66AF,
+0x43385D33B10D3D9E, 0x4801779E129A6438, 0x0A94E019AEDA185A, 0xFC5FDEE87A7F5614,
+0x8CCCD51147E1E558, 0x000000022C1A8778, 0x13883CA957576646, 0xA83FAE83CCBC339F,
+0x7C18282669ACDEE9, 0xAFE31B6AF8CD7477, 0x14A09BDCFE9E2851, 0x3F0AA8D8588CF42E,
+0x6E4EB2E6E78C0EB5, 0x5931BB95FCA8975B, 0x610927D44A556221, 0x00000000E6E70E9C,
+0x70083D6FFE511DF6, 0x833C031BCB0B0868, 0x149313AF23DF11A8, 0x6985C6585DE59008,
+0xF88767186C5FDB04, 0x4CC9005337AB79B4, 0x4108AEC77A03A1BF, 0xEFFB045C0691A84D,
+0x085A2D4A25996FC8, 0x00000000EE4176F0, 0xA95AAB159D657BFF, 0x9CDD34C1B0564499,
+0xCC63592BB7077AEB, 0xB45AD39DDC48E5FF, 0xB6F67D091092C7E0, 0xED7638CBEDB67184,
+0x838798BA22347F57, 0x146F174C7F78E63C, 0xE1BEF5152EC91739, 0x000000006FFF2672,
+0x67AE7AAF84A44D2F, 0x03D5A29E8DCC93BD, 0xD9DA2256D3F45FAE, 0x3601821572CCD0D2,
+0xEF808F4C78B4AF33, 0x642CEECD54BFA6AC, 0x55FF98E7212E052A, 0x4EEB08B5EF5B235F,
+0x24344419EDBCA180, 0x00000002744721D4, 0xCF5FB8015E259FF9, 0xC87F06FF00033702,
+0x3E1D9D5517AE390B, 0xBACBE5571FF211E6, 0x0BF29F0FE05BED14, 0x98B8942FF85B8C00,
+0xEF8AEDB47DE9D4FF, 0xECED505B2F93A7FF, 0x946E3F178127AA0A, 0x000000006EA147A9,
+0xE079F8130F045251, 0x086C3AFC42C13AD9, 0x5D08862DA833C536, 0x9D2D38AD24A2CAFC,
+0x49A8F0468D944B70, 0x450218D7240B99D2, 0xE304A18937E31F27, 0xB21BDE7B506E2F91,
+0x09BAA56F241C8364, 0x000000019F86B5D6, 0x3AF58BD0E3EFBD1B, 0xC6C969D511CB8885,
+0xEA9F09D720C9B7EA, 0x366A0CBF145E907D, 0xBDE0940FCB80BF82, 0x762078F241821637,
+0xE029A5C5DF952A32, 0x153FC2956383560B, 0xD5E3EF76379436FB, 0x0000000007BBF1DC,
+0x15B40C0433F9A4A3, 0xCCF99F55A58FE4F6, 0x6F81B4B132A90245, 0xDDB9B34ED3B77F41,
+0x862059341129C4D7, 0xD763705F8BD98C30, 0x257803EB0D273E6D, 0x03EEDC927347FE8F,
+0x46D53F10CC244D39, 0x000000021C82F6CF, 0x025B29301B745CC2, 0x430C449FFC11908E,
+0x677B91B120496EF1, 0xE114E70B13A076AB, 0x11948457A29BC338, 0xD3E0E554E5E984CF,
+0xB219A513CB237349, 0xB2BC3D700F657A83, 0xC1B7C5A3AD9EB5F9, 0x0000000135CF9AEB,
+0xEA45488BE0498346, 0xBE8D33478B27A819, 0x4115DCB8EF8BBB00, 0xBF281E560C8F04FE,
+0xB8A93ED580E32507, 0x9CFF3C80720EFD44, 0x36D0311872085383, 0xC3199D9EEADB3DBC,
+0xBDAE061B69314125, 0x00000001693A0016, 0x031B37DBD8350E58, 0x1DB89F4BDDBBC68B,
+0x9909F85D4C289476, 0xE2FABB6F2FDF0C9D, 0xFEE7DCC5E38573AB, 0x9E17160A9176BA88,
+0xC088A98F2DE01EC4, 0x4638834F106A3A4A, 0xE219E9C160BC7BC7, 0x00000001D306CE52,
+0xB734A6B66D2DE414, 0xB094135A0C1FC7BF, 0xC35BDCC1D27260AE, 0xAE94880E9FC197B1,
+0xC77EA2B6520B0428, 0xAB8D38FDC4F6A08A, 0x095EDDAEBB6833D0, 0xDFEFCE12F323472B,
+0xD6912047CC178A5B, 0x00000000E9D97EB0, 0x4C699E111B7234F1, 0x6578B2269EF092FD,
+0x1AAF28F9F1E00115, 0x8367746530D582E4, 0x6E3C5B5617BB7C68, 0x22F2A9E1374052FC,
+0xCE3D089D727785C3, 0x30598F002AF028FE, 0xA7CFC09E0BC5AAC5, 0x00000000A9F597A6,
+0x7088F6980B41675B, 0xBD66785755EC433D, 0x919A8653317318CB, 0x33A5C9E2AF164FA8,
+0x72425AC3898DCDEC, 0xDF1235430766E204, 0x6F6A8C2D448E78F8, 0xD6BC24C6A4FC6825,
+0xFFD2145AF7AE81FC, 0x00000000DBFC4851, 0xDF0F39DD06D40264, 0xD87C704DF32FA599,
+0xD07FCD826E2C49AE, 0xF1790001BF7DA0A4, 0x6D189B98FB42328B, 0xF367DEF9C6916CD6,
+0xA3FBD29415567247, 0xBFC8D56C645E2D14, 0x9D5F7A24AB2D4F79, 0x0000000186643FA5,
+0xC5E96E1854BD20B8, 0xC80560490D7DF439, 0x7B78F95AF9500A4A, 0x17E96E51590FBEBD,
+0xBFADDAE81AD967E1, 0xE64488988C4AD0D6, 0x170DA963F09A9779, 0x8A02AE2622A46C8E,
+0xCFCCA9FDC32B5EEA, 0x0000000267DF1C27, 0x6ECD3DDCD6E30FBD, 0xFF768A15623E86C6,
+0xE4015BDD678AD25B, 0x29C007191B772ECD, 0x247348D11F7063E6, 0xD6A174076EF3093A,
+0xC915DB6921F14C0F, 0xC3DB488B4AE3507C, 0x5622E1659C87FAF2, 0x00000002794D1C58,
+0x737C4F304CC6E17B, 0x79A0B3780A766481, 0xC54880326E280AD2, 0x62DFA010EC965E0A,
+0x74B9FEF209035F5A, 0x1416D29A6C85185D, 0x2FDB6D730FD09FCA, 0x0527A8938448A8C4,
+0x3EAD7AC28E48C61E, 0x00000001A339FF44, 0x9D6533104B8248D9, 0x3F2C675A7D92F6F0,
+0x4829615685571B6E, 0x9C0E7174C6ABD3F1, 0xC55AD7F352316FD3, 0xCB0C411844EF14AA,
+0x9959D5F23A8F77F8, 0xDF4A9C50CD9D1890, 0x52929F5C3B6F655A, 0x000000018D193CA5,
+0xEBAB6F05B5330FAB, 0x811A09008B099821, 0xE83912171C32F9B2, 0xACCA4FD4677AC828,
+0xADC0DE7C0534A8C2, 0x2105FAFDAA275F97, 0xD19E870F4993959C, 0xB0EA9ED85F3D9387,
+0x839DB5AB47F0BCEF, 0x00000001DE7CD71C, 0x42BA35A79027A170, 0x464E3838860161D6,
+0xD853704DA3B0739B, 0x192DA20F92BF07D6, 0x703B242AE171EB1E, 0xB2F803BAE67FFB2D,
+0x28D4429E69ECE9ED, 0xB859785F7EC40254, 0x9AF198306E96D6A9, 0x00000002734DB172,
+0x5BB031CE5E908B4D, 0x88B7E048F6AD8B3D, 0xDCA5A2EB62D1C259, 0xBB979AEC05355B87,
+0x268E647995C8EBFE, 0xE34CB9E2F9D4B8FD, 0xEE4481445252F2F8, 0xAAF68F90EAF24D97,
+0xC3A70187BA907844, 0x00000002392B52EE, 0xD87EA26E3678E8A5, 0x3FEC14814A39DCE6,
+0x89C3419551E22619, 0xEEE8599D90B8AE44, 0xD8F3C6B6D1A27535, 0xBDD7F5029324FF79,
+0x674512456EF96168, 0x352D400C6698C431, 0x91514DD360050F8C, 0x00000001B2711580,
+0x4B343F36DC268366, 0x37B51DDE99743FB1, 0x2EE8F8AA6192FE7F, 0x04FE79020EFF3233,
+0x939ED034253A2499, 0xCC002E1A5F7467DE, 0x7E27EBFB99EAB94D, 0x7A7C134A5530E2FD,
+0x4D233032A7D05CF5, 0x000000000397E5C1, 0x8964968CACCA20D4, 0x6EF030C42937B254,
+0xFE2CAA54FC88BFC3, 0x9AB59771B5D954CC, 0x86E18D16F53879E4, 0x4F8185FBCAB55CB2,
+0xCB00A9C077D1EA94, 0x3A63701982800046, 0xD555904AF34CB4DD, 0x00000001D3E5D169,
+0x52DF437C7A578F89, 0x38B4DBE98A48DDF1, 0x86379F9911BA0AA9, 0xE405AF1D1B52696F,
+0x481A04DF0A473775, 0xEB0699877B07960C, 0x7F9C10089ABC4EA0, 0xD3963A0FC17AC07E,
+0x8673434153A749C8, 0x00000000470CDD0E, 0x020B26D82828FB86, 0xCA06A94F5A694F72,
+0xC93E0CBC80B59B3F, 0xC3DF57CFD2D1B545, 0x4DBDB94FB57767ED, 0xE2844A108894B401,
+0x51ECF1BDCC936360, 0x8FE7E8314971115A, 0xD7E5F350A992FB5F, 0x000000017290516B,
+0xC0E36AC3F5D58384, 0x6B86AE2C85A726CE, 0x6C5F054881BCB3E4, 0xD59C503353EFF7A9,
+0xFCD5098895BED507, 0x59A6AFDDA4E1C07D, 0x0836EBD48CC114F8, 0x3EA2EE7C13932953,
+0xDBB779BB9C21865D, 0x00000001379F8A1B, 0xB820970CFC2DD08A, 0xF559721B7EE9CEA5,
+0x73549A46E6FA5AAF, 0xA6E166A5482A589E, 0x7FBF7CC20CF41C52, 0x25871E632E679749,
+0x866C449475E339B0, 0xD1F7E4B00FF33CCC, 0x6BEB063B976A21EF, 0x00000001FD8DB837,
+0x340DC515C2280174, 0x7E27F07FF6C070C1, 0xE46F80A2C8AF88C7, 0xB6148527E185C324,
+0x9DB1B292FFCADD01, 0x5AC1E304C1988797, 0x11AFC680EEF8A82D, 0xB775DFA0B7848435,
+0xB096BE9C9F70FD0F, 0x0000000089ADBD9B, 0x647C59994D9D6C5D, 0xF771FE04AF53F0DA,
+0xD216A1D9D833F47F, 0x1E367F0F2C2429C7, 0x07233D17ED1B95FB, 0x2018BBC7C1595691,
+0x32C0008012A9FB5E, 0x44C27E16113C6DC3, 0xEABD87FDAAF1044A, 0x00000001C0D680E3,
+0x48D958544F45B52E, 0x634E6C5371F148AC, 0x93EFC936F398EF1C, 0x30031570A952D671,
+0x9850302C219FCD54, 0x1CF8A871F0E8CAEB, 0x157FB35C596E4445, 0x020ED7FBE9B8D9EB,
+0xC72B98AD645EA174, 0x000000007342BB6A, 0xF2AE282B99CB310A, 0xDD178A0A0D7B2FA2,
+0xFE3FE9067DDFC5E0, 0xDCFE2652A4C03FB7, 0x7AF3FF9D37FA9A60, 0x40F990CB651FDA21,
+0x764E142A5325ACFE, 0x53884F59CAD7D46D, 0x25AF612761A66048, 0x000000008C5C6CAC,
+0xE0E4F4694FA5549C, 0x4C42FAC20FFC0181, 0xB134C132EA14A0E8, 0xBCC86DF690D5055E,
+0x27F8EC840B7C3674, 0xA5A4ECEB6F2F700D, 0x8307876EBE9C895F, 0xA72C3060B88A5ED1,
+0x3F36100BF9644E4B, 0x00000000BD8BD902, 0x2E1B0B57E1981618, 0xFCA3B53902FD1474,
+0xA561BD5C6771BE36, 0x8F304D31B6D9CDAF, 0xC50C8EDAEBA77700, 0xD9F1A587DEA2F5ED,
+0x8E99E1D794DEF8EE, 0x984E3ADE1845D7DE, 0x3830FDA2845D348E, 0x00000002010963F2,
+0xA58606BAAE02FFDE, 0x7A13AD5D23BB8864, 0x21A41CEB3BA86254, 0x05D91B6D26EFF999,
+0x58A7C6037A711EE7, 0x44184EFE5D97598B, 0xDB471BEC20130E52, 0x4A65C2A87C4D156C,
+0x85D3B12C556F9E0D, 0x000000024E81EFB7, 0x2F2278DBCCACEB9E, 0xC2B5D884D72C7600,
+0x8F30205D89012C98, 0x9BA096490F0C5ABF, 0xA0419E7368D25995, 0xA7EB3D4117BA3A9B,
+0x5B0E495B250488F6, 0x32037BFDDAD15BA2, 0x21D4721F324E5056, 0x0000000151CA6420,
+0x882338544255F9FC, 0x1FA575F3CC81CB17, 0xE421EB1503082629, 0xD29DF6D3421D26CF,
+0xF2A1AFBBF42BE4D8, 0x3B905730069C9E70, 0x959946C465F6A0F3, 0x11938E2DB5516164,
+0x15254C454E2C0EDF, 0x00000000E798343B, 0x752295FB3769F9C3, 0xDF004020D303656D,
+0x9B692C6D14705CA6, 0x1C89FD538E271351, 0x46A57D797F9BE5E7, 0x235E698C7A9B4A5C,
+0xB5B953E372EC580C, 0xC8D2A435104C6BD0, 0xB93A88EE744436A5, 0x0000000045AF4A2C,
+0x5FCC60BB490F3EAE, 0x2F0D5E51B346DE75, 0x7DF0168BFA008B19, 0xDAAFE00316119D90,
+0x87E70DE4E425F8B2, 0x958BEED5916ED00E, 0xE869F8C84A463008, 0xEC24C8F39DF39E53,
+0x1842856D4E2A11D8, 0x000000026EE5D362, 0x34FB2AB4183993ED, 0x42E498D38A2B578F,
+0xE5D73A098F4E85D9, 0x0879FFCD61FFA1CA, 0xBCED3252FBB72890, 0x1872E4E484DC1275,
+0x5CD658AD32DE0CAE, 0x59F22AE3C45E93F6, 0x62B202BCF0FF1797, 0x00000000DE3C7D68,
+0x3EC40AC38AF0084E, 0xEF2893C721073040, 0xBA3FF22D37815290, 0xCFF1CA28459EF332,
+0x88A6ADB8499447F1, 0xF7859EBF976E5EEA, 0xC9AD5308BE8FCA68, 0x896D7E874915316E,
+0x27CFCA75E050ADE0, 0x000000016D79FA20, 0x01EFCB8656E5214F, 0x7C716D3368607BD3,
+0xDD845BB0880245E9, 0x65D5A40174C16D92, 0xECC9238DA3ECDCA5, 0xC14C1298D7E801B7,
+0xD9F52C22338FFFE3, 0xF38BCA9CBEAED804, 0x72DD65200E1D5997, 0x00000001FA5A7176,
+0x2906E58D42EF99EC, 0x17D976E2F9E22495, 0xB13FA3F00833E054, 0xEE9F0714C094C91A,
+0xAAF44409F3BFA8A1, 0x23CFFD77AC86AC4E, 0x0556C7696F9264A9, 0xBEAAE814DBDF78BD,
+0x14F2C07E9D5513EB, 0x0000000089A6D5AA, 0x23FC6C495A4B72F3, 0xA7FFE6A9C4791AB8,
+0xDF8A132B610E3565, 0x6ABF8BD9CBB5975F, 0xDA8196DDD418B932, 0xCFBF08A275360ECC,
+0x508D06F607426F42, 0x5CD8E5C27484AD38, 0x4E781AE3292F79A4, 0x000000003D6F048E,
+0xD289C1381422FCBD, 0x6DCCC5AF8B0EB3E7, 0x4ABD1ED8A1D01E9D, 0xAA6759C8DF5778DC,
+0xDB79CCD489E63496, 0xDE8734CEEC0A781F, 0x61578506FE07C205, 0x8E99F9EC026FEDA3,
+0x4FB524BA37D6C0E2, 0x00000002136B6A5C, 0xAC1F2E0DD02591BB, 0x8ADB05E0511A9CCF,
+0xDEF6E948215C1F24, 0xBD3A7B20D78ED39A, 0xD811CC55C089EF18, 0xE46B7EF95F079D08,
+0xACCD5B7D71F9379B, 0xA71216767404A8B5, 0xD2D21A255F8D9A31, 0x0000000114DD1E73,
+0xC8BC335AA8C00A6F, 0x604E926A18C499B7, 0x7ED82944F528D6A4, 0x8C75D74BFAB72C86,
+0xFEF7D7D5AAD17005, 0x233A866F20F812C9, 0x26DC0A2B1E0280E0, 0x4C160FDFC70C6F86,
+0x3A90C7A12A47514E, 0x0000000230A6DFB7, 0xCCC6B08018CBAD0B, 0x07E121EF6C92D035,
+0x5DE1DA18FE6AC770, 0x3B85C9295974C0DD, 0x42AA250EF9E6EEEF, 0xD27CDEFA912264CD,
+0x3D9EF11B0DC7F199, 0x9DEA88B539911086, 0x885A6EBE90D11CD7, 0x00000001EDA1D3D4,
+0x3DD2986BB60D7A2D, 0x7D364CE60EF92849, 0xAC5935DB74F5B49E, 0x10B6F8293D792534,
+0xFFC4F482B488FEE8, 0x6DE2ADC8C0439B51, 0x4CD3B2BB59729511, 0xBE833D662307290D,
+0x9B327B3FF5CCB5BA, 0x0000000032D94E94, 0x457283F6B62C130D, 0x832F3EFC5F48642D,
+0xCCA0FF03F8E47E9A, 0xBAAAB33AC2B79962, 0x540A34C471DF017E, 0x38476C8DA987C500,
+0x505C3D04DD8607F2, 0x43E133093942867B, 0xF4DD53FD783AB3C5, 0x000000005E5459EC,
+0xFD1038CBDB3ECAD6, 0x5E3F6E4BB30CA3E6, 0x5D56D0A1103135EF, 0x2AB8DAFC1C8730C5,
+0x9FEFF4022B0BF136, 0xA51778AE4BBA92AB, 0x45B6C82775F1C0E8, 0xAF3376FB766F295D,
+0x107761EA974BED9F, 0x00000000B936DB5A, 0x74D86016145EACEF, 0xA402A47630A3BC02,
+0x73CE8E16522F8EBB, 0xC7AAA67D1E760BCD, 0x181089E9205DA24B, 0x04D541D8205EA50E,
+0xF6D35B2D80AE8D97, 0xF663F8F7D32B08B3, 0x830A7CD565EC4542, 0x00000001B47E8CC9,
+0xCA5F145601C05201, 0xD584BA60860E3FB9, 0xB07CD334EE51D963, 0xD74AEA818391FA51,
+0x0E6DA64458A45A7A, 0xE534A874F2239211, 0xB79DF12499ACA289, 0x3B37A1C1E4606EE2,
+0x4CDBC207FE218AD1, 0x000000017BCA269E, 0x0AA6064A5235274C, 0xEBD22C6F09CC236A,
+0xA63848FD31D2F1EB, 0xA2E575992A6A410B, 0x99A8A9E523496240, 0xE2E699FA192A9979,
+0x821B1F1C9DD3ABB5, 0x48F03632BA086435, 0xF68F307E5B6E48B6, 0x00000000676C9C03,
+0x8CC26E4BE5340111, 0x20323FCF033F9E95, 0xABDCAD222491AAA9, 0x55AE68F8224230FB,
+0xC8FF6D14FA4859BC, 0xFE1865083145657E, 0x2482DB24AA1BC5E5, 0xB866C32D7C1A7162,
+0xF4EE4BF985F4D81C, 0x00000001923CF437, 0xCC2B33D879077BDA, 0x53134997A105AAA1,
+0x14E42E4279810CCA, 0xC8868BED50C04C14, 0x28AAA88EBAF5557E, 0x9B34D2847B91547D,
+0xB70B67E45083C64F, 0xAC101080068A0885, 0x7EB1B1C552BD1328, 0x00000001A7AE328A,
+0xD8239F705BEA09F1, 0x390FACF9801B824B, 0x6092185B4D00276E, 0x4B1B348B3766F678,
+0xFBDF8BDB2B5FA991, 0x5E55953C2F583735, 0x7185F2C7D8962323, 0x3294A765E6B9E0D9,
+0x974F0BD5338308B7, 0x00000001C221F722, 0xE0CF136900DBB8F0, 0x16AB9295D08EEF9F,
+0x2D0B0F2E4E5AE756, 0x31E5AB39057A96D4, 0x0A52D00DD853E1FC, 0x25E7E69EC7BF0A9F,
+0x78231009CA7B579F, 0xCCBAD05F1ADD22BB, 0x880ED5646F4BF851, 0x00000001C8FF9390,
+0x86A14571EF590009, 0x216F0F76B9F4BE3A, 0xFB5D4031A085EA44, 0x3BEE9A778CF43ED4,
+0xF37FB2F5CC6B45C9, 0x373311279BA000BD, 0x62807035FA8BDDDA, 0xD805425965F13CAB,
+0x210AA1A5433EEFAD, 0x000000018444CB41, 0x9AFA50BAF3A36E54, 0xD867689E0C34578C,
+0xF2D7C4855B2B1A97, 0x1C56034E971836B7, 0xAB607A201C944E88, 0x36B39E241670449E,
+0xB91D8847239B9B72, 0x8B5CBF44BF1D72FC, 0x1B5F43FA73DF99C9, 0x00000001882639AF,
+0x8B42E5C0469667C3, 0x93441A1F9107B929, 0x5C7162F5F10616E7, 0x3F655404EB870176,
+0xFA5B676FCCEBB121, 0x7FD4265CE3357CD4, 0x77C8A4E8AEE2451A, 0x8FF90003CD2166BA,
+0xDE8333F353ACD72C, 0x0000000103A5C314, 0xFD5915368D2A9A40, 0xE590CE07256D2F4A,
+0x282D4894289B048D, 0xC6FA4150B9A0860D, 0xB6478660F1389C51, 0xBE1223993CD70D4A,
+0x0A531DCB86664493, 0xF69640C6F6868A13, 0xC386D818B5D8DF33, 0x0000000055E96F59,
+0x183CE36E35EC5098, 0xB4A1C8FF8354516F, 0xF889D40DAB4C7A6E, 0xCD8D65828C0D4CEF,
+0xE8CE810775DF0FA3, 0xFF396F0728A795F8, 0xC93710F1F0871B4D, 0x85E84E8A3F784D8C,
+0xEA87290818E13B26, 0x000000014CED0C64, 0x73949ACB13A970DC, 0x6A3284B21ECF1B1B,
+0x2E7FBECB9EDADDBE, 0x8F3596EE0161E98B, 0x4F4C75E814FE61E4, 0x2F828BD931C85AD6,
+0x7C39F9A4C725F021, 0x036F0534EB6E4408, 0xC9152B61D01603C6, 0x000000010CF8C994,
+0x34DEEC544EA6ACE8, 0x1206594139D8EBE2, 0x815EC836CF2C3440, 0x786EA6E1990EB151,
+0x4BB405E106774495, 0xBF1AC27036336908, 0x1178804442486C9F, 0xDB714607319E584F,
+0x9022C5525ED40BB9, 0x0000000098AD220E, 0x2B11885B660C050B, 0xE05E60C0A737E383,
+0x17AB30E5D388493F, 0x82B58309ABFB0002, 0x295E633D7C44350E, 0xBBF178B4EA54B7D3,
+0x55C8357C02BE71A0, 0x7A8AC6FACBD1E61B, 0xB7852BD6D14689A4, 0x00000001B677DA95,
+0x36BFCC796EFBBD7D, 0xA782383F68174FCB, 0x404E91C824D70627, 0x77FDBFD9D6C6E131,
+0xC574F63431BD7A13, 0xA82188FD2135B59A, 0x1ADA1DB1771A2D1A, 0xD21EF12A7604B9A6,
+0x34C019A1DD065E40, 0x0000000197304DEE, 0xC9F895FE2089CC3D, 0xF11D716AB85B5A7C,
+0x936B5C49E953C7C3, 0xC5222E2F0D6E4DB4, 0xDE1E73A4EE27A159, 0x9B43EF3C1ECEEA6A,
+0x8E4D43B4EEA2D942, 0xAA0B86077C7536F7, 0x7DAADD4B48052B3A, 0x000000007265EC4C,
+0x3DF03664F03142D4, 0x15BC164D180FC5E1, 0x4DD1ACAC52804657, 0x79F1A2809BE7B93F,
+0xA06D683476AFEEE2, 0x3CB52A4EF51460C9, 0x97B223DDEBD0B1F7, 0xD8A571217D7E50EA,
+0xD0B64D173C244199, 0x0000000279DADD80, 0xFD334B5F11C7DFB8, 0x80B4BC5BF818A556,
+0x7D6248AAC4AE4D6A, 0xA4CAEDEFF6899326, 0xF7A99A0ED4579813, 0xC46956CEA6DD8A1B,
+0xE02810EBFEC5D45E, 0x9CE2E78ACC1604F0, 0xDC3D433FE851C0F5, 0x00000000277D808A,
+0xE277798CCE316CB7, 0x52CCC30F23FD7762, 0x563ED1CE99D28EDB, 0x17289A10FCF87B93,
+0xB314F0587FEAD969, 0x0C579F7152C1C51A, 0x0A05E91A5C9F54F3, 0x7F71A7A13A1B0668,
+0x9AF580AB4AB33735, 0x000000022F62931B, 0x68FABF39C17E5B85, 0xCCD37CC0E2775423,
+0x17EA222CA8E35C32, 0x5E398563E7A65DC0, 0xE3F8036A5C115B26, 0xEAC967777963DA82,
+0xC619DE7FF146A6DE, 0x0211F70C939308DF, 0x9F365BD941DE3AD1, 0x000000016D075BE2,
+0xBAB9C52FEAF5AF05, 0x98D161830C33E2B7, 0x32CA36C73454DEB2, 0xEA814CDDE2B0C224,
+0x1CCA1FB2F33EAD37, 0x5FBF7D9D4D6F7497, 0x1E899A983F68A864, 0x5A3C4816D6CE223E,
+0xB255D7306B9A84C2, 0x0000000148D443A4, 0x290F23177F1149D6, 0x7A26C5406DF06CEE,
+0xB50F27D1310F2D7C, 0xA6C35441139F678E, 0x2E7F00F1712E1495, 0x2D682D3A86BEEEAB,
+0x60EC381A18FE944F, 0x46990BF5F7BE0B17, 0x7ADEA78DDA1D36FA, 0x000000024CEF3781,
+0x057FB3013E040FDF, 0x01941E8BB56BDBA7, 0x2E0E53254842447C, 0x74E4C3A9790DC98E,
+0xFD6734E003DC11DA, 0xBBC21C244C648027, 0x368D70054FED1090, 0xAD4B24543F9FA3E3,
+0x7F90DA9C5CC11F39, 0x00000001E9F2CBC3, 0x2B349DCE6386D907, 0xBAA84AF2CDB5F015,
+0x8F8C1B944A7A8997, 0xF5488D2E6EE471E1, 0x2935BFA9FE32222C, 0x380BF493D0E548F4,
+0x6F3FFC67326BEAEA, 0x9D724916409FCBC9, 0x9C471993D3B61899, 0x000000022C6963E2,
+0xD70EEF8D4C25CDDB, 0x5001E05AF07B45B0, 0x2D88C98C7463EE2D, 0xCBF52998D3D48242,
+0x3DF21C6B0BE3917C, 0xF3E34B4D2346FAD9, 0xC04BF476C2038F50, 0x1066E9DAAABA93DF,
+0x5C7BA398E89B877E, 0x000000026B830615, 0x8111A238620A91C5, 0x3009489C1B87554C,
+0x8C08367864AFBE7A, 0xBDB21A259C915106, 0xFFC6702C60D115C1, 0x85EE4C423DEEFE1E,
+0xB8BE40CC2E611065, 0xE69962ACE947D5A5, 0x59BF84D20434E978, 0x00000001D8622B31,
+0x7D2305659BAD6949, 0xCEE2AD5AFA3C2D57, 0x3CE6EF3DA421BA49, 0xA9937660B14B4939,
+0x9FB9A411BB116107, 0xE4296B23C3AF9B98, 0x01072C942E3BED5B, 0xF91885A59CAC385C,
+0xAC499D546B957D26, 0x000000026A61D399, 0xCD7EC6983B40F20A, 0x88903B0D51B10D4D,
+0x64F3B3DEB6BC5D7B, 0x3F681AE1FE80799B, 0x5144014EC54D0B22, 0xF63B466E248B6C77,
+0x97A8CC687849E5BE, 0x1D338415705578EF, 0xC28110E451033FFF, 0x000000007A7FCECB,
+0x421E0E269DC5268C, 0xEE3779C279AAF9B8, 0x8DE0533006BD5156, 0x4E02268C7F1B9CFB,
+0xF78DEDD3565B3A99, 0x78305814359D1277, 0xEDDC43A0FC4940C0, 0x6889F33524CBF361,
+0xF485845E7F2902C6, 0x00000000AB07BD50, 0x7F63B5F60C25E359, 0x6C31D76DCD485896,
+0x66431760549129D6, 0x9B6AD0909C0CAB52, 0x232E161BB9AE4B7A, 0xDFFEDDB0E0E862E0,
+0xC8EDF8FE01082EFF, 0x97C489E57F9E524C, 0x36529A60BAFA603F, 0x00000000134E694C,
+0x76725D65E89948C3, 0x5516936ED7E2248B, 0x6C0F2CD6BBA3FE0A, 0x3FA64294E5247E81,
+0x220285AC225C5773, 0x3B206C50B881682E, 0xEDC387F0A23346C0, 0xF94F78751508A006,
+0x08FD6DBE5EE4857C, 0x0000000217A97557, 0xAB9638B2CD05AD13, 0xD19446BC3B343AF4,
+0x34C7E5E2F68ED621, 0x5370054B12C92627, 0x0DD7B0B4D5833D88, 0xFDDA36B7739241E0,
+0x0D6EEB364B8FEB67, 0xC6D538636C045669, 0xC18B5C0BDE06C1EC, 0x00000001CB3F39C8,
+0x767B51D89AF5686E, 0x3074746795C5BA19, 0xDF66DAE1CB22692E, 0x7E25FA2202516113,
+0x137D1AA883AA9147, 0x00B5921430BE88A6, 0x861A3E0B1FDEBDB5, 0x2F934E49C0E5B59B,
+0x12B4F5CDE43E8F2C, 0x000000023F0FB4DA, 0x8F1438081D444EE5, 0x7DA93D87284AE12C,
+0x1937C35D3A9DC3C0, 0x26E3771C698BB38E, 0x478CB39951713923, 0x914943570FC52A2A,
+0x50D983E0557C0FFA, 0x2BCD61D376DCF687, 0xA0E0D605C98D17F9, 0x00000001CD8B8280,
+0x76F821D0FA395C4B, 0x5259B4881B11A256, 0xC8D3FC382F60F6B3, 0x161C3256CF926703,
+0x799450D357490221, 0xC6684E05748AE4E6, 0xD88924F0C7916FF1, 0xDEF88F1E478A550A,
+0xD7D8F733A383D56E, 0x00000001E83721BC, 0x29283CA4238528F3, 0xB5B97C1AA6D6E488,
+0xAE8C7D8A14B509E6, 0xA4C386BBC77746A1, 0xED7527F196A863E9, 0xB1E3394103140ABA,
+0x9EC267967F8CBC43, 0x2D6DBE27283229BC, 0xBFE4AC943912F4CD, 0x00000001213F4E03,
+0x4C2695DFB4B0595E, 0x23B6EC35F9576638, 0xD8F7258764435FF2, 0xD6A86BAE8D5FC7B7,
+0xC5489864026FD9B1, 0x7DD684CD24546D62, 0xB96FA14A7AF33773, 0x65687EA767F3B9F7,
+0x6901AF5299981349, 0x00000001631F2C8E, 0x76905810A2A76CB1, 0xAAD1CF1FF8D3AD67,
+0xAAF1BC8C46275DB5, 0x222A6FC666CF5F79, 0x714B93D521211541, 0x0372235A59A811CD,
+0xB300BFB0525E083E, 0x4A5FBB8446182020, 0xEBF6E277537A8D5B, 0x0000000120716D8E,
+0x30E2D23E8A3F94A6, 0xD09F9BBF9744D131, 0xE795A1ACF7E8020A, 0x7BF2B183A271CADB,
+0xB6AF18DB91397569, 0xB880444F3ED786F2, 0xAB7566B8A2E625F6, 0x396D0F3980B76CC7,
+0x90BC0E8F7EEEEDDF, 0x00000001B4C7CA59, 0xAA28576F9490BAC2, 0x7B8FCD28487C3D06,
+0x404F37A721464A66, 0xCBFD6C6959FBCD0B, 0x4EE718B11EA56712, 0xDD7FBEAA0D6AFF66,
+0x2E110862894D0ABF, 0x83D8ECBAA3D51D38, 0xB10D2690DD8488DE, 0x000000021B5DA2D3,
+0x67D9D9ED45CE1B6F, 0x9CB085CD4B3FBA4D, 0xB79D7691AC72BB0A, 0xD8442519F9DFB640,
+0xEA70B1ED3ABC877D, 0x675918091E9774F0, 0x38921C54074CAC9C, 0x414BE326ABDF658E,
+0xFBBF10F2E3092619, 0x000000009D727CDA, 0x5160E871017D5396, 0x83DD6A8BA61EB17C,
+0x6C8C8C85232A0BC0, 0x0F943E6972259A03, 0x6028883FC550C6FA, 0xBA5F45EF9602792E,
+0x1AECEA3F21EFC258, 0xDC27C10E042F950B, 0x852256E5E449E186, 0x00000000CAD61030,
+0x4D25BE0773DA071D, 0x09C60B9C2E3066BE, 0x54B6D7C29717998C, 0x51996294468826C0,
+0x2BA02361ED6A737F, 0x4BDB54D19385874F, 0x5F488F4E26D130C0, 0xB6ACC32877A37D2F,
+0x6CF8C73DF4C19F5F, 0x000000017B8D1DD6, 0xF666424F8619DC20, 0x3D3DBE37E5E1A816,
+0x6A97F30182D2A987, 0x5CAD31A7F1026059, 0xAAD6F839D4581C43, 0x33F13667F4FE86D3,
+0x0C7BE1B8319594E6, 0xBB08D63AEC26DE03, 0x423F21DD1AA66EBF, 0x00000002588306F5,
+0xF808A81EF1B80378, 0x3629F8EA95A63DF1, 0x5B18440096C11FAB, 0xF6B52AA4DE5CD2B7,
+0x29878A0CE76D0257, 0x169EE638B0E816E1, 0xCEAB1BF6AAFF4C82, 0x7DFC3EEFFA1491F7,
+0x61AA903A87E7DCD4, 0x00000001B32CB207, 0x4ECE833506C5F3F7, 0xDED455964CB0EEB3,
+0x2384723E78221170, 0x050C36C3818358E6, 0x200D41C67504FE20, 0x41EE1990409E88FF,
+0x7446B3A36E37136C, 0x11E45FFB40A06061, 0x960F59FE59B6E3C6, 0x000000005D42EFCB,
+0x744ABCCE3F02EB9A, 0x1A6C1CB185C038B5, 0xF3E69C2336523326, 0x61C6E965D707B0AF,
+0x1AC3531B31F4D262, 0x600D686B2B9A318C, 0x60E4802E540EE021, 0xCFB44845A7ADEF45,
+0x2A73F4C178255891, 0x000000020C214D39, 0xF71A82F2F1A7EC75, 0x761ED133AC902BC0,
+0x4B3C5FFE7255FE42, 0x27166C26578EFAD2, 0xE8DD262A32A07BC6, 0x6E90A98AD8EAF8BF,
+0x335BF0DF6367F799, 0x57EF143EBB70DB92, 0x03270E1E6BBFF4F3, 0x00000001F2E15A54,
+0xE264DC64C1C51AC1, 0x2ACEC0D6C49C1A00, 0xF366F42370F09A8C, 0x85389EE88770DE46,
+0x4F8F8B47563AC6AD, 0xA11FC7FA7A18123E, 0x109B19790A70216F, 0xC7EF51D22ED7E03B,
+0xF040C6C43433A4C7, 0x00000001CF943B7D, 0xE71262D1AB72749F, 0xCD14C439674C8D95,
+0x7C7CB88600F37963, 0x35642CD4258235A2, 0x53EAE2E7A2DA325D, 0x2EE154D4B526C69E,
+0x4E7DF5B87456A15C, 0x47CCEDB9532E47F5, 0x5F495796C7768B07, 0x0000000166C53FEC,
+0xAC1DD44651438506, 0x4A3461ABF97D57C7, 0x91506554D06AD359, 0x49A816A6AA540B13,
+0x08E31DBBE7DB2DC4, 0xCF3A695FBA6CF6C6, 0xF2457501B2BA2065, 0x0FF306B8C7992E6A,
+0x7FC7B6BB70C2E743, 0x000000013CA7922B, 0xC2975707EB040177, 0x30AC042A5F87D74F,
+0xD7773388B74B731C, 0x76C379D53C7E6D87, 0x3C24C987A42EBDA4, 0xC5F8D6E73A2A8221,
+0x693700A2A3453CD1, 0xC125C9190D6F923B, 0x5979309023F2F4F8, 0x00000000F31E3F05,
+0xCDDACD00500EA505, 0xF98F53DAE59A2CED, 0x9E663AC7A178D136, 0xAB19DB534DE35718,
+0x1447483FA085CCB0, 0x9B21984DC4FB397C, 0xE77BBEFE59B0380E, 0xFA933466F6F75745,
+0x3F994C6003C00341, 0x000000019D9D2E30, 0x7A0E7C323D5D4039, 0x90C9F3FDC2D58363,
+0x618C495DB53DA071, 0xC007F61A259AF027, 0x74B0D348CF5294CA, 0xF6D445265E4C375A,
+0xB84E128191F25ED2, 0x780FC82C5E959A8D, 0x4243E0B576CADF63, 0x00000000509686DD,
+0xC4EC0D4703286EA1, 0x8A6D94CF717705D9, 0xE0DAF4D9BB54DC53, 0xA59B1A4926428516,
+0x6C97BFB279B1CE2C, 0x90903DF1077F634F, 0x92F5E413D1F58ADF, 0x0B0E6D4A144554EC,
+0x7C2B7A5408DD82A1, 0x000000010A425CE1, 0x1EDCC99DC4EDACD3, 0x75DBBB15DD28D8E6,
+0x5A13144D63D2BA3E, 0x4283C24A209347E3, 0x114E2F37F69AC4C0, 0x664CDACBF89D870B,
+0x99FF11B8A23F17B4, 0x659988D2E12196B4, 0x3E2C1EB2ACE69733, 0x000000026428A787,
+0xE4C1DA52AA968C97, 0x7936469C10D90111, 0x0948F0F15C9A5F7D, 0xE800AFB45BF97E34,
+0x54B228F64021CC06, 0x54406022DC0D397A, 0xACFD32CA280FA3F3, 0x6ACD46A8A31A34B7,
+0xBF07FFEC85B2030B, 0x0000000259B5D4D9, 0xF6A4C9115DE93993, 0xE686E796E49EF9E4,
+0xB232653BA5F1CB13, 0xA728365D6277B3FD, 0x8BB9F1141CD0BB26, 0xDD3ED227FB42B71C,
+0xA31A674D5F2C1904, 0x3221E6A551065BDE, 0xCA7D3AE32B012CFC, 0x000000017A73D57A,
+0x9A306A007A7B85C6, 0xD1C8DA0A24712054, 0xEDFDB1FC859243DA, 0x225D5B3CFA9947FD,
+0x16BC80619DB2E452, 0xCEBCAF953933B339, 0xD3ADAF0465984AA3, 0x7E568957F30B88ED,
+0x5CEB57ADB8B8ED60, 0x00000000E600F6C3, 0x24B27FD9EAE3A484, 0xB10C45E76804B499,
+0xE417C48201DFF5FE, 0x29C74AA8D5265682, 0xB2BBE6BD58017447, 0x905302E711053B1C,
+0xF136470653195980, 0x234684CD15EC0A5B, 0x3CD5937FB3073A96, 0x00000000F62C5992,
+0x75A387DC861536E8, 0xD2EFD8D8C8C3954A, 0xC2B726C21EC9CA29, 0xAF0E45A9719712EE,
+0x3910364140BC2E2A, 0x9EA1EB85091A254C, 0xC047D1A54BD11F62, 0xE48D7549E0631471,
+0x3760EA0CDC0ECF7E, 0x000000022BB89C52, 0x4ECFE3DB3EB02082, 0xF561DC42171D2785,
+0x337A5F52B3951C58, 0x874FDD6D5B2F2FD1, 0xEAAB4117AE29ED2D, 0x9C0687A36E542F2B,
+0x1050243BD470856E, 0x78E9B89083653BDE, 0x7225854E792EA664, 0x0000000176777AE0,
+0xCF210DA23B2FDFE6, 0xE3D5E5981716BD5E, 0xAD8E52B49188696E, 0x682326FC9B8C3BE0,
+0xDB449375C5F9ADCC, 0xF81AA9E64B44FD2A, 0x31A5BCC3F3C86FC3, 0xC7DB62D820FE582F,
+0xB17BAF1C04DFA920, 0x0000000056E87D82, 0x3068E4D0BB611226, 0x606864424E424F9E,
+0x5D49A6B156C79401, 0xB74E67346A8A76B0, 0x75126396EE7C7B0B, 0x771D4ECE44A48F63,
+0x7294978FCB25EC3D, 0x0EC48E9BD0312143, 0x6A344C3FB9C1FA70, 0x0000000196EAEE27,
+0x961A064EFD304B14, 0x42CF56B1A70DF90F, 0x62488C9C0AD44F68, 0x56FCD59BB274BECE,
+0x31088BA4E8D932E4, 0xEC65ADC52084D2BB, 0x3D127E1ED04FC89E, 0xAE04186BACA4A3A2,
+0xAE5529634DFCE230, 0x000000006FEFE736, 0xB89F86CA3B529BA7, 0xEF623B2AB4C92DBC,
+0x1AF9D00ECFDFC55D, 0xA6280E83B4A55D14, 0xC665512B2F5E4658, 0xAFC85726B9FE3CBA,
+0x7FC6FC133A88E7BA, 0xDCACDF35684E5D6B, 0x3C6DD1BB262DC9E7, 0x000000002B5A106F,
+0xE6D035252ED6BD56, 0x5F8F5C305DC9407D, 0x47E31DDF3C59684A, 0x8805C59C095C4AE9,
+0x9A09EAAF92AC285D, 0x1BE7538EF492C48D, 0x658B3C237C51078F, 0xF2322A202ABD98A5,
+0x404932520FBE10C5, 0x00000001BABA22FE, 0xACB72DFDC48D2B53, 0x5A4284AD6279EB57,
+0x55C06DF51CA5E2C4, 0x4297B06DE564F96E, 0x27F8A0314E800DA7, 0x2F6BBEC59D45D42C,
+0xB5C2487CD8B15626, 0xE0860FC3E7AB6D48, 0x01E214B23F8726B5, 0x0000000166D3B35A,
+0xF3CF643806B95821, 0x24F86D88C33E1D59, 0x9FB3838E04489F95, 0x782C3B911D73805E,
+0x7162345C1807B0A3, 0xD08B1947EB16274F, 0xDDD1DA9A1E8531A2, 0x014275DE3E9D78E6,
+0x0B042D67EB6BA28E, 0x00000000E94F6551, 0x39BB0E328B864D33, 0x380B3A2F08195958,
+0xC97568675367BCE9, 0x2EE4EBA66EEDC54E, 0x6097BC6992E590E5, 0xB8064D9CA090F714,
+0x3D06C4294EE47FCC, 0x463840DEDF60FC4F, 0x15D3673800A7CD85, 0x000000009EEFA478,
+0x16760BEE480FA50D, 0xFFD3AEB7BFF21000, 0xBC578028A81962FB, 0x8ACF02CB3CC8C3C2,
+0x478EC1E08FA6F940, 0xCA981AF5C9C64CD6, 0x76A41DC2017A08EB, 0xEA746F553F39C0A0,
+0x17D1552BC96F6612, 0x000000014DE82F25, 0x9588BB10F18BD043, 0xDC255A6E4099CCB2,
+0xAA037BD70FFE3F5B, 0x4312DC23020B9511, 0x1B66A4A3CA8E71C0, 0xBC4C17430929BE64,
+0xDBE36843CB5B3910, 0xB76021095BEFB02E, 0xC4F15FC9A7914573, 0x000000012A2EDB72,
+0xF46B963C8DAFB6EF, 0x12EDB4406513B360, 0xEFB4473770906C32, 0x4F00BF325BB9EE20,
+0x803B11602A96FCFD, 0xA9E482C4F4243CDE, 0x741652C33BD671D6, 0x784251E11960FC44,
+0xFECF2B4852C791D6, 0x000000000E4CC127, 0xB161A13CA42C4874, 0x0CC37E7B5CA27C55,
+0x985BFF0D9037AC34, 0x0AAD7239872E1F49, 0xD7494D2E3218AB13, 0x098665641A03D253,
+0x4251A7A27A872FC6, 0xBFB89F59C3DFA1AC, 0xEBD2EA37F2BFEA7D, 0x00000000F76516D2,
+0xF51DC2001066A564, 0xBA225895B2A427C0, 0x6A6D66F7C657DCD8, 0xB4B3EEE90ED91427,
+0x51C270C4C0053701, 0xE40A5F166CBF2CA8, 0xE6D4F5C68E9AC67D, 0xBA2DD966EF01EE0C,
+0x925626AB021E8A09, 0x00000000B6666F44, 0x10EB1C67C3E2F8AD, 0x264BE37D53E74483,
+0x90A83C00C447084D, 0x712C0F511DAA18AF, 0x72546CDC8ACA266A, 0x2313A70ABA2F7B9C,
+0x6B96EBC5975BA355, 0x783F79ADB7BC20B2, 0xCE1491CDB712A6CE, 0x00000000073314AA,
+0xEC9FE1019E9ABFDA, 0x40BA0D8560D96075, 0x85CA32C76CA34C1A, 0xE45B4F0D8215493A,
+0xCE3645502F9E9927, 0xDE037C0174151D67, 0xC5BD6AF9F4E68516, 0xE345ABF7065F1946,
+0x5941E342AAC62746, 0x000000020492582F, 0xC429FC147ACE7A35, 0x03B6244AD9F22FDD,
+0xF831BFC3240FB8C4, 0xA7379EE0D9540E84, 0xC88B365AFD2F1366, 0x0EADED848B34405C,
+0x4D55209ADDA18272, 0x63E79A9C885C392A, 0xAC5DF661FE398F72, 0x00000001B5254F35,
+0xABE9038FCEBA7215, 0x2F0F187D7F0D56F3, 0x7DB170DDB2F56BEE, 0xB105E684CD27ECA4,
+0xE84FDBBAF5AB91EA, 0x5C629239D0C0E360, 0xF50F7252D58B8E20, 0xE0DB56B30DF1AD6B,
+0xF8401C81D728E71C, 0x0000000037E80FBB, 0xA67D9F730BC99559, 0x029039A70C1CF9A9,
+0xC402F1AB3FCEFC4D, 0x446A24F5FFC6B466, 0x49A63FED7AFDD6B7, 0x8D00DB364524060E,
+0xE2F1643B8E07B538, 0x90DDC5DE67783F78, 0x92EC43FC0BB3CBA8, 0x00000000CAC7D33F,
+0x91C661676DC27BEC, 0xA7DF25BA7A99046E, 0x4C7B6CF1173120B7, 0x1B71BB5484CA150C,
+0xBF891BF336175DBE, 0x475B50126449D1A0, 0xFC7C52A64D5EA7D6, 0x348C46BDEA5CBFA3,
+0x25D995F372D4227A, 0x00000001B9FC6083, 0x1F3C0C7628C146CB, 0xB988E7D565113D55,
+0xD56C6B0CEA82554B, 0x3AD32585849FE1A5, 0xD494E843BEBAB5C1, 0xCADD338CD42FD659,
+0xE5EA64B3A3A87D31, 0xB6027FAD03477EE0, 0x6334E00886ACF4D8, 0x000000020F321F2E,
+0x8CCFAA8CF1D05EAF, 0x783D6FBAE6EB4502, 0x68C2693E23250991, 0xF6B0F4E37337C6DA,
+0x8689BF21271FC1FE, 0x7C6A19539D040ED4, 0x09143909355C518B, 0xB900330895CE1D9B,
+0xB9FCAC1AAB9E3400, 0x0000000037BB6687, 0x1EDBBA9FF8D84757, 0x72D72C6757BD3259,
+0xD877FA8F60FE188C, 0x473B64529149D8CD, 0xD7EE61C979DE34EB, 0xE003CEEC49535B54,
+0x1D5B872F969BC328, 0x846739E12AAF4C3E, 0x60F47A117B376ADD, 0x00000001327703EF,
+0xA958E9824B00E646, 0x1334C3DF11DD48AB, 0x3CB3052503337261, 0x2AE42CDB329F52E9,
+0x5B5BF70474B6F901, 0xB7D511E71451D815, 0x83B9A101B0CA74C9, 0x113CA9A89BB368CC,
+0xAEADD593FCDC693B, 0x000000006C2EF0E2, 0x205F120500B7E3A3, 0xE7790D7AE8E1B71D,
+0x9809882DF547F300, 0x9801F2B47AD9E050, 0xD6959C6C9445795E, 0x1C4B7DCC64F6473F,
+0x68DD7DD7E535974E, 0x2D4D9BEA30DD1090, 0x568E1A6F3B00BEBC, 0x00000002173A8FC4,
+0x3BD15324F71EB592, 0xD6F1931F1534CE7A, 0xF87741242056F773, 0xCF4F011D7F581E4A,
+0x6104641047AE822D, 0xE8EBB5AFA7A4F203, 0x8B9E30BF5510A6DD, 0x9B6D5A55C74C8035,
+0xEF52D0BB4E0217D8, 0x000000026A6A67A7, 0xCED25460DEE7D9FC, 0x86204D692E6CB465,
+0xEA35F5E4F8B30679, 0xDAAD935B86342452, 0xDEE23D57DC961EF8, 0x19E7E6FECBDACE50,
+0x770B2658B12EFB0C, 0xC0E55F0B988F0474, 0x0206A89299CF2292, 0x000000006163294C,
+0x0AAB1B7A9D011BA5, 0x010B1E451B644D40, 0x6CB0769070571B96, 0xD7C60C88D44F453A,
+0x0C0A504F0A29B29F, 0xFD1CC768E5380A74, 0xE29B77AA8AD98F77, 0x11AC95AE34FA58C9,
+0x17C6DDC501C735BA, 0x00000001055944CD, 0x0C3A444E5DBAE21E, 0x449F7DD702ABEF7A,
+0x4069979C62DFB737, 0xEBC46C1D319765C9, 0x651ED1C7B31D56A4, 0x17683B8BB7810ECE,
+0xE3BEFE86334D7791, 0xB71D0056F3B84347, 0x3EBC5DFE45D12D32, 0x00000002461802FB,
+0xCB1CD8F10F845420, 0xE6A187AB64C73BC3, 0x02434868ACFCA034, 0x062DEDACD29A8393,
+0x1775984A2EE24840, 0xEC1202249A775D74, 0x8EA1E3EDFD2D21A5, 0x8209C63EE7B6A362,
+0x143F49EC1B5065E6, 0x0000000091359CC1, 0x1589023D1EC4AC04, 0x10A52D387497EBBE,
+0x5322B3C2A7E57FB6, 0x46628517FF41E578, 0x2D06A0E193D7F535, 0x7A8F5FBF86D48D41,
+0x0A0DF3D5635480BE, 0xC73A8077F2D410F8, 0x156C6F81D1CB747D, 0x000000021AD6D9F9,
+0x9D42824254DB1587, 0x8E0D09E6700A3B53, 0x662E08B70B5D7D52, 0x7D7F184CFB5F375D,
+0xB400CE4ABAD242F1, 0x7A5006A48A5F5BD1, 0x4CB4B3812CB57311, 0x65A3B3C88DF6FE38,
+0xFF035BC710852D53, 0x00000001BFF5D0CC, 0x366A8959C48490FE, 0xABB63850214A5EDA,
+0x9442CAF53D2F029F, 0x7BE606B0E8F6DD85, 0xA1488005CDED0F2D, 0xC941BF864F9EE3A6,
+0x2B87C2ADA2511A60, 0xF9D2BECA33FA0A60, 0xA2D42E04B1A86833, 0x0000000128578828,
+0xC130ED3BD9742EEA, 0x0AAD35BC5EDC828A, 0xB4ED18E823FB46B5, 0xEACD444FA8679B5C,
+0xC651B433804BF3D9, 0xB263F6566687B0AB, 0xAB869F95FCFC1FB6, 0x84EEBC30917B9CD6,
+0x2B8A1DA3E1AD4A03, 0x000000026C784F93, 0x523923B01C37F52F, 0x02376D92D2F82026,
+0xF6AD056E8C19EB9A, 0xDCE3B40184B352EC, 0x5F9E316D19C2E13D, 0x758F1D02755B71DE,
+0xE59C6E947FF55862, 0x18889595396859E7, 0x6DB35513679F23E4, 0x000000006F72B9B0,
+0xBCD3B74F03F4D216, 0x4B31972A9D319E01, 0x4863D92C9EE16706, 0x87147ADF0E35B6F6,
+0x35B5C60600577504, 0xCD6E42C1F99F481B, 0x9C50D607FC5A0F5B, 0x3EF88508448AC5E5,
+0x6EA3321F9689C346, 0x000000003F4E2EFE, 0xA7C304965C80C209, 0xFE9D322A37820F81,
+0xBF9680716D4D6978, 0xC8F179A856493A9C, 0x9EB5624D8FAC0C1A, 0xAC29B80B549E259E,
+0x109D0E77A501D92F, 0x45A84E6C295D6F72, 0x59D9CAFC224A3A99, 0x0000000223008308,
+0xE7E0A938A617647E, 0x3BD322D2DEBDBC4C, 0xF9EDA33182CA1AE1, 0x431276AA2D2F3C8B,
+0x6A0E84F9634E06AB, 0xB1EC230F34EF480B, 0x241FE94D01802AA5, 0x64F4632A7D833631,
+0x0996BCA79D3DC466, 0x00000000B1136AEB, 0x6C05985FFCA14DFB, 0x5836EBE6F02ACF51,
+0xAB6D28C9D9321141, 0x5C31BE16E28B6945, 0x7984CD34141F2819, 0xC2B98E03FA797634,
+0x6EABE24D14CD3727, 0x033F5D3E0A6DB502, 0x1337A62D919A19B2, 0x00000002177C8A93,
+0x4B7008EE3D259C0C, 0xCDB2379DC8F5B771, 0xF4D4D3066735EF07, 0x754F0288A7FCD428,
+0xAF62F315330E058F, 0x09D7E4287EBCDFD8, 0x51B222AE9FB515C4, 0xD9650FE01C2E77C9,
+0x542369D9AE00086C, 0x00000000F1AB333E, 0x5BD885F088CD806F, 0xD9EC1C179DCDC406,
+0x6B1D0F9A390A94ED, 0x4D425B78A749DACD, 0xA9F0DB80ABEB9514, 0xDB5AD8656F5A55D5,
+0xEB4093BD8D349CE6, 0xDF3C0A721FF83E28, 0xB566939D9316A7CF, 0x0000000012513C97,
+0xE87FD6E3BD91174A, 0x2BFA3109E7229A15, 0x45A771C71BAF8A90, 0x899A3AB75DC6594C,
+0x462B003D512AB49B, 0x7197C4A42FB584E3, 0x575E2BA534DD3E39, 0xDC47A36153654536,
+0xDD898021DB90B5B4, 0x000000013E3640B2, 0x93E9D2110455C7FF, 0x22B8D894ADC77FAC,
+0x1DEBA49561A422FF, 0xB38A414457D009E9, 0xC84F7EE3DB7313B6, 0x7CC78E5EFB442D3E,
+0xE954EBFAB820F77A, 0x24BB5CC156C061B2, 0x711BFA44454B3BA9, 0x000000009DA08992,
+0x97B1498329DF3EB3, 0x881C86F1F66E9D6C, 0xC17028DB442AA62E, 0xA373607591D895E5,
+0xA8053F25F7F939D5, 0x6526F0C3EF2C4890, 0xD54A0B775D6361F6, 0xEB31F1408BBD8264,
+0x5DC6BF6F711EF64F, 0x000000002A742D6D, 0x62196C2500288EC6, 0x967A0E6DE53DB6A2,
+0x6233B9C9DA68D3FC, 0x7300A93219994965, 0x7D8E2F7AC6E5E42F, 0xA316B707F7F76456,
+0xB311D4448617BA6A, 0x391E064384781F8B, 0x0E94350E2E434C81, 0x0000000177B52FB4,
+0xEDC570A90DB3F49C, 0xB7101B87C29CAF16, 0xA0282146C7A1116A, 0x2DE2F240F644A2DC,
+0xD58038B17303C172, 0x079D3399020F3900, 0x11E3D083BD20597F, 0xB91728A8EDF695FE,
+0x45C1DAEF1A4E0CDE, 0x00000000692C6D79, 0x80D489D3F53E42CB, 0xDAC004E39A52D6BD,
+0xE67AEA876EE8AF2B, 0xD10411F021C589BD, 0x68D4958731B3DB9E, 0xE320813992E52396,
+0x3C50A3CAA80EF8F5, 0x15E9C6205E526DFC, 0x841AE1700A0E7F39, 0x00000000629B7C5C,
+0x8C5E717141FE32B7, 0x5E8EAFC37356888C, 0x6447D608C13BA575, 0xF7B412A596E3A9A0,
+0x26B527C35777CE7A, 0xE92373ACE4C6506F, 0x70C46CF368E284B6, 0x4286EB5F033A8183,
+0x5A9B4503BFC88279, 0x0000000129D3859D, 0x3FA864A235B4EF07, 0x88E68B435B36A297,
+0x488059E79A1B392A, 0xF87FE6AD459F4F19, 0xF37F5B1A7A24A23F, 0x17D3954DD00A29B4,
+0xEE534704266D6F69, 0x2BC65DBA3A618618, 0x00BCD60BDB46C198, 0x00000002308EB79E,
+0x0FFC104EB1CBA6E0, 0x851BF99EEAA23B66, 0x31213B06D1F4E452, 0x6C1F56E50B360D03,
+0x4C18D42970D5AE58, 0x837B595BA03DD806, 0x41020804C19C25E2, 0x274318ED805D774E,
+0x915ACCC35D26BE85, 0x000000023CFDB29F, 0x1A12C47C94348FC8, 0x38700FAF36EA163C,
+0x29714410213547B9, 0x6664D4A460F8BF9C, 0x5E7F0D90FAE4BF55, 0x793F22535037F651,
+0xE96C9B0C59A60F41, 0xFD9D0D7AC4CE0F94, 0xB9666AD2CD0E3C3D, 0x000000022BFDFD3D,
+0x1B7DD7ABDBD47511, 0x088D8D01ADE962D9, 0xE3E81E84B829AA43, 0x3809D5E8DB7A88AC,
+0xFFB1C03C8458B7C7, 0x869FA8F18E22DE96, 0x90E4BE941AC38926, 0x88CAD0FC50DC3C4B,
+0x9E0ED53093BB64FB, 0x000000003FF88EBC, 0xB4F3F3DB5E4682E7, 0xF6A36331EEDEFAF8,
+0x1ECB806311809972, 0xEDE8584F4454FDE6, 0x31596D8193DAB0D0, 0xB86E689D8B64E053,
+0x809DBEFA5B1D585B, 0x4627883F189C096F, 0x9E97CA24D890B974, 0x00000000F600C322,
+0xE5AA4E2AA115360A, 0x3A30655EF5126EF3, 0x60CDCB2352BEB4CA, 0xF56E324948A3F5F8,
+0xC194B648CFAB3F13, 0xA6F9A8D0A8D7D990, 0x4CC66BCA523883CC, 0x92501C13D1A95C29,
+0xAF907100E78D2479, 0x00000001D5E58283, 0x7043E290662D17D7, 0x0E52F5F395213FC0,
+0xADE43BB95BC21B75, 0xF28DF2BD064849EB, 0x1B6DFA6949D22CAA, 0x6E39AE414D2071FD,
+0x28376E6EF4A209A1, 0x5D1007FEC4393A92, 0x0B4E3A6F51EF247F, 0x00000000D495D249,
+0xEA64AEB7C068D4B0, 0x9C1ABD1546BDA759, 0x21D7538F001CB4FB, 0x0B840E7D4D728424,
+0x33F6F2D5D23B3BE0, 0x867927BBE5437F52, 0x1FE861056B9BA75C, 0xED24A8639D0FA1AE,
+0x5B5C8440B62561E2, 0x000000022CE27BE3, 0x6F7AFABACABB4DF2, 0xDBC77578B58E6034,
+0xB12DE74AFF49FED7, 0x95C2B3E037C22711, 0x61F1C5AC84F4CB5D, 0x2ADB835736C8CF4F,
+0x1A2F95E97DCED686, 0x5A1486A2AC352ACD, 0x3A60EAFBD7779985, 0x00000000BF4C9866,
+0x6CE9F9432C714843, 0xA50DAD1D63BF898D, 0xF5AFE311484E6ACF, 0x4D1C2BE4D837E4A4,
+0xF6A352A5D0FB02BF, 0x1395EC312EE3FD72, 0x061433BBC39F961D, 0x36EF6BFD9D89E345,
+0x4761E7717B4D8480, 0x00000000E27392E3, 0x52234BB3EE92A061, 0x31645B43064EF5E8,
+0x8C4C580B2119C295, 0xB2DD065FFD3E67E5, 0xCAEBFEDC58422A42, 0xA3A8FA533F089F3D,
+0x62D7C197B894AF9C, 0xFEA92CB3AB3F6A6F, 0x090EA16B5D2B90FF, 0x00000000799D99CD,
+0xF2E0562E9EB63670, 0x8BAD0904C82BDD18, 0x9861FD7F11136655, 0xEE599B1FF67C10F6,
+0x26DD1C99A89389FF, 0x89E51EEFB11B9FD6, 0x45FBDAF6F5960AB4, 0x1A3DFC223383D259,
+0x4AFF93540E99026E, 0x000000004783CC24, 0xA818E8DD2E51DD90, 0x0BBFE80C901103CA,
+0x85098752EAC0FE2B, 0x0EF5E6E824F4AB41, 0x84E8505238A5F935, 0x2D1D24BCC5BE964A,
+0xBC2A382B3C7A9B70, 0x138E10D7D9C4A6A9, 0x4C555256D22BE139, 0x00000001D0CF8D49,
+0xB2BB8E8EF19F10F8, 0x2250A76566B6F7B4, 0xEB313CC246B42C2D, 0xDC45E7FA36ABA872,
+0x19EAF206EBE0AE89, 0x77260CB4F15646D3, 0x902A3C30550654A6, 0x7F33BE2188FA4B6F,
+0x5ED65DA0042C2447, 0x00000001B405EE64, 0xE7A5B1F9AF96FF08, 0x7A3E2ED1C713106A,
+0x8B2691685E76C2B0, 0x58EBF5E45FDDC67A, 0xD7622378D8DC6124, 0x8D098B5DBD99D7F4,
+0x0734B5713C6E0CBF, 0x5AC163A572172270, 0x3F997C91DAE6A8B2, 0x000000007F325E15,
+0x91C74CB393E1C7A6, 0x20B905D1DC1AFA10, 0x9E5DED534A825C63, 0xC884058CC92EC0E0,
+0xA372369C1895D3C4, 0x9FAA2B0C85D3C17E, 0xD58DE68C48CAE010, 0xEE0EA409FC0A9BF5,
+0x143357BF26E9F051, 0x000000017F00B9C3, 0x53C6BDF8ADEAA56E, 0x73A2BA293ADD0C4F,
+0x9C0BA8AE0C485F39, 0x5DC32E575D3E02C3, 0xD54A1B5456030BD3, 0x36F1F242A923B52B,
+0xCBCF79370C4997FD, 0x0AEA1D620685C4D7, 0xC6DD6D7124E285DD, 0x00000002483C4C33,
+0x4CCCF89E55359AB5, 0xC75322435241D709, 0xF8C988E2DCF6E6A2, 0x5734FAA703F8F923,
+0x90369E9383CDDE6B, 0x854C42E08E9C3DAC, 0x1D60770C953EC319, 0xB4E816A1A6B96F94,
+0x3F58EEF701FA54C9, 0x000000013038D439, 0x95A3A1D5D183CC35, 0x15B03D1848F18993,
+0xB1D219520AFFCF9D, 0xCBFBC6ECB2AAB737, 0x1F90D8313179DDC0, 0x22633E414F4E8601,
+0xD965E69BA3F34BDA, 0xF959589A89D8BC3B, 0x4E7351D8B2723AEA, 0x000000016B315870,
+0x5F7F82C3632E6B8A, 0xC83A7DAF3CB33DF3, 0xAA870A6B7EDA7FB9, 0x024CEA3BA1ED3F08,
+0x598192A2849271A7, 0x5523EE25C23B40D2, 0xF2A20B9397B1065F, 0xBC9E5F251298A0C6,
+0xB2FDB5645BA9CB54, 0x00000000F72D05D0, 0x8E66E17DBEBD4DCC, 0x8BDDB7606879CFB1,
+0x1CC2D8E6E2B40BC4, 0x58E7C7D1710BDB6D, 0xC0B49C18FFDA87AF, 0xF45D037DBC4794D7,
+0x9DBDD036A340B137, 0x136F6F925E36B5F8, 0x937E08C40092607B, 0x0000000109C9AD47,
+0x1AD21F629F39DF53, 0x5815EB9E3984D3D6, 0xBEFEC6D0498F7284, 0x7B3D0233E947122A,
+0xCB05FEA1FD0159DD, 0x681652D8B2D7AB84, 0xFB6AE9F24F0C3646, 0x000F767887500B89,
+0x918E58AC9BDE05A4, 0x00000001020AED50, 0x3AF31CD17737ED20, 0xE5322FADAAE76A66,
+0x7AEB0D33BBE11FA9, 0x71ED022BC055BA50, 0x54D0A5CD7FC5F96C, 0xC4AA3A1F9A2B36DE,
+0x4D07CCF958DCF4F9, 0xF4352D8CAD9B1322, 0x6522E6AFDEDE90DA, 0x0000000107C091B6,
+0xCFB2D86818B3D133, 0x65A82E6DED913DC9, 0x5420336671D9024D, 0x835BFBA2D465CDB3,
+0x629B072C3A48A45F, 0x891263DE04C44FC8, 0x6209B67CCC4BC165, 0x406247E7D393F36F,
+0xC995D476AC420DD3, 0x00000001CA932B0D, 0xFFACD4BB7EB308E7, 0x0156B609AFEA3AD8,
+0x624E45A01B898C75, 0x771DC728BFD5C738, 0xFD3E71147ECCC7AB, 0x2C3E530EA0137780,
+0x22F60C44F19B6B36, 0xA60B1EA39FE24760, 0xE607B7F6884C2650, 0x00000002042C9939,
+0x595B1E76102C7403, 0x7F0754932E5FABCC, 0xD9E0CB72B6467B05, 0xA7A3E5000263DA4C,
+0x360DADBE7F9E790C, 0x494751DECB4A0C8B, 0x2553300F036EB0B2, 0x219C909418780AF5,
+0x58522E27EB0BA31F, 0x00000001006C031B, 0xB4CAE8F4524507B0, 0x86B3D2D78ECB66F7,
+0xD2588043877AF75A, 0x9D5C23FC7DD2D17C, 0x5E45EBC747322EBA, 0xA92DCAAD742E1D80,
+0xF459C08AB1A48A5E, 0xE587ACCEF3CF8EEC, 0x1FFABC48E7824160, 0x00000001BCCBE4E0,
+0x3DBEEE2163D53182, 0x1A68E6EE3385ED3C, 0x64BD2975317730A6, 0xE05BABCB4A58FB87,
+0x3266CCC0E2443D02, 0x36079E4C8AFB5A5B, 0x3DC6B8A0787C710A, 0xB6C53EEA142D09EE,
+0x63CD674204D30119, 0x00000002233531E6, 0x2C66A575E083818F, 0xE2BB91A9188655CA,
+0x92D4C4C283333EDA, 0x0C6329D3AA482E13, 0xD4C6B6CB7544E455, 0x1E26B0A0C0096795,
+0xEB37169C28B09B23, 0xFC9494337459C295, 0xACAE1E0E91239643, 0x00000000A0A00D7D,
+0x0D81783CB262F40B, 0x0F897DC3DB1E9570, 0xE9F6963791C1E061, 0x000F7B2BAAD5C8E6,
+0x53D5F413C895D324, 0x14332B8D91C33B38, 0xD11112D3E6CEA2A5, 0xA510059B58514585,
+0xB2C907F77D1E75A4, 0x00000001F542AD5B, 0x5C2E24058A0CFBA3, 0x83DBE0B0D361E5B5,
+0x455CC900189A862D, 0x7F552897125655CC, 0xE60CF2B102B6484D, 0x8E94C928B9068B5B,
+0xAD9B05D5A3CAB1A0, 0x91D185EA10F9CFD1, 0x351F8983B99F9DAC, 0x00000000C1236B7C,
+0x11B60BD319F1E626, 0x13616942E2BAF2D4, 0x20306A88C8CB2A40, 0x03BC34B5681BAB87,
+0x6CB634332957E432, 0x04844A8DB2C23C1C, 0x7EB44562FBE8EAD7, 0x716C48DA1E1D1D9C,
+0xF9C7F88F2E232CCE, 0x00000000A0C8D488, 0x287FABEBBFFD4E42, 0x3D80C6BED80290B9,
+0xAD5F242ACB9C3E77, 0xA74F508244EDB948, 0x71B43BA7A206D9D7, 0x728939A64AF82655,
+0xE725DA56990E8D48, 0x3C46339FF1AD8117, 0x2A73A5926F332797, 0x0000000015A90D6E,
+0xEC239A052A11E681, 0x652BFB24E4259E50, 0x01E4A8D495D98EAC, 0x7B42E36E88D4915E,
+0x090B7822F3BB4E6E, 0x2D215756C96F5605, 0xF1408A018B896ADA, 0xF50EC8A520503817,
+0xB55F9F23BA58107F, 0x0000000229951C8B, 0x781F1191FCEFD2DA, 0x1968851139653499,
+0x6A7A27F993DB133F, 0xD27BCF4A5793F57C, 0xF70D925292A697EE, 0xDF9C0B6F973936A6,
+0xD5147F5F6823FF92, 0x35499D80E8AA3378, 0xB11933F869444276, 0x00000000B67EE2CC,
+0xEA6994A1DCA691DB, 0x13872903477EB3AA, 0xC87EAEF04C5CC015, 0x4199F4D9DF886F01,
+0xD3B87CC49BAFB2E3, 0x483B36BA01534C23, 0x8FECEC6337CB3856, 0xE3BE9B698D6E86A0,
+0xBE0A1DDFA7A00255, 0x0000000059176DC9, 0x7F46924D5B18AC3C, 0x1EF86AB9A4F11BF5,
+0xC048BEDCF48D7A2F, 0xB6CB41BF94AF4982, 0x9D9AC573DBFED6F6, 0x24FB733C108EC8D6,
+0xC3AE4A5E0FA11EF2, 0x82A46DBF6F0BF1B1, 0x28F6C358122BFF5A, 0x000000004CA2FFBD,
+0x57B29EBF7A68C624, 0x59439A0166F79156, 0x2DAE6D5FD9FA6F12, 0x26E76FDBCA88C291,
+0x13663B9846077E61, 0x0EF79C2A9EB2BC91, 0x33B127726136230D, 0xBEABD799F767248E,
+0x6395033F7AB826D9, 0x000000006C1632B2, 0x00F6FAB76167C2F6, 0x4590885AB8DC9F3E,
+0x75E050AD62BE1DDF, 0x8728BF176461FFCB, 0x438324057A9BBD28, 0x7B7AF2BDAE6BAB17,
+0xEF4E14E93C603EDF, 0x27A67FB98CFF8EA9, 0x6CB42CFCB8D3D599, 0x000000004E4612DF,
+0x3DBDF4489B763972, 0xE703E7C8910B6D67, 0xC63455F373B09FDB, 0x19060C3E8726FD35,
+0x5245BA2672E60641, 0xAF92026C71BA441E, 0xA74E6B91B331C297, 0x1B754DC99A6873B3,
+0xD589B899328588AC, 0x00000000AC88DED9, 0x756D84E291515FE9, 0x41AA5F8C3AF997F1,
+0x6DB8606A4D47644F, 0xDB73761D2424AB4D, 0x8A2EA4F919C39F84, 0x49440BC3E6C64B59,
+0x10C23F453EB4927D, 0xC63101DABF510402, 0x78DF049DADC88ED5, 0x00000000E9F97B00,
+0x8BB08FC78BC67742, 0xAD34A531E375119D, 0x3729D383FC69073B, 0x7E1370B699365B2B,
+0x500564AF737EF147, 0x066749DB2F5C5BB4, 0x33544297BBF96F4B, 0xE45859BB2F347EBA,
+0x4F676EBF1321130F, 0x00000002559AFF11, 0x4AC315BCC7CFEEB2, 0x0DC709AF2E8C1D23,
+0x897EA6C1D92421E7, 0xB87956381C45A015, 0x28459613B4A45509, 0xF205C4D57DE09887,
+0x4E64BA837833D299, 0xF9043FD352A03C08, 0xCF8E42A262E64998, 0x00000000069B6B0A,
+0x2DFDBF198181A562, 0xEEB7051147EEA9D8, 0xB33B9CA9F7F98BD7, 0xB59AE575C7E3B25F,
+0xAD61EDD8FE9E06CF, 0xBBF5EBBE007F8D1A, 0xA8A913FF6096EA4E, 0xEB2F2B39497337D1,
+0xF866F263B866CADF, 0x00000001043C67AD, 0x61D00818758C7875, 0x7D8C53CFFFF23C79,
+0x80F735337771BA2C, 0xB9A23E61695175B3, 0x9585BA9A5AB4181A, 0xEEF1993AC30FE88B,
+0xB0BCFEB39F27028E, 0xE4A24263E5CCB7AC, 0x0F0BCB6170676540, 0x00000001EA0C3543,
+0x5C1D499087162892, 0x45BEB7C81B52DAFD, 0x8795D2725D608152, 0x1B2F11D56E690DFC,
+0xB495EF45DA5B92D1, 0x4CFD4F25B85104D9, 0x2063D5FF517756EA, 0x8B7EB01B1315D6BD,
+0xA4DC1E78A90ED3CF, 0x00000000DFB7336A, 0x69E7875CFAFFFFDA, 0x41E637C770C80073,
+0x549A0F3BF2FD2BAE, 0x01F54696A667B6E6, 0xB0CA1A5353FE55E9, 0x1E552E0D151E2B60,
+0x7E83353B65561151, 0x8B42F0C59261E0CD, 0x4ED8BA719B2AD7C3, 0x0000000246306C95,
+0x11FD3662020F4155, 0x4676E1C4C1C7FF9A, 0x2613C4B72CB56B66, 0xED2F1890F553705F,
+0xD59388C64B56DF51, 0x6D0AE3D5B27C3661, 0x566B22E8D64AAB2B, 0xC6B97F08077D1A43,
+0x1001CDCB54298D21, 0x00000001F12B5705, 0x219248BEEA7023C5, 0xDBDF531783042B6E,
+0x7E7529B1056C0AC5, 0x8633C3BF229F2071, 0x64060557E402622E, 0xBD74E2D1CDB5E007,
+0x53F3EBC4141C5126, 0x8ACF14BEBE604E73, 0xBFC0990D15CB5E44, 0x0000000016AE8F47,
+0x35E1AB9EDA354E73, 0xD8499422B9730617, 0x3C3970785B1D285E, 0x5E7E6A89A1315A67,
+0xB2330B5F39CC8359, 0x1B2CF01D30ED012D, 0xE032C1CCEEB102E2, 0x18D6738A63B80093,
+0x85E28BB275E5D150, 0x00000000D0D1C5B2, 0x4BFF9C7E29E51B74, 0x81D8E1C924D1DE53,
+0x212BD8A6807889DE, 0x1B604364E4F3F3B8, 0x9BCB7242171F7741, 0x536FBD5A5983321E,
+0x7F949E21703A7A64, 0x7ABBEDC07859CF59, 0xFF4580410B8D4276, 0x00000002171D56D8,
+0x4DE1DA615D538A90, 0x340F8EF5175FFA32, 0x56B503A27FF60427, 0x267326A09BDE3975,
+0x8F8BDF51D85DBEB1, 0xED7B45773D383A50, 0x639161FBE99AF50D, 0x37346B5AD50921A1,
+0x7FE0FFAC236778FB, 0x0000000032EFE504, 0xDB6C45969367CD6B, 0xCA6EB062C74DAB97,
+0x38F2DC0FBF535B8B, 0x4C5573611DBB11CD, 0x8AC17FF9AF266C67, 0x13E767375B532879,
+0x35F5CD62EA2BA21C, 0x998D6EA1E2BF64E1, 0xED74EF98D1DEDD36, 0x00000000483AD112,
+0x8F9114592F6F5D85, 0x93F49284B49B7488, 0x5A7BAA3F2792EED3, 0x8396A762CE5BAFB0,
+0x679E7120B200BBBB, 0x910F52E0B4663A4B, 0x26C4075838D7FC5A, 0xC122803999D8659C,
+0x1C22C71F867BD951, 0x00000000FE15BB96, 0x936C15F505D32BA6, 0xB0B0B6EF035FBD27,
+0x8B731215A0C7193E, 0x1918DD7634386AB4, 0x1CAB74602C016160, 0x2C6836DA70FC0264,
+0x2D2C7ADED92E1C53, 0x8B86BD02E973F09F, 0x6CBF5A343DA9D439, 0x00000000E7234A6A,
+0x89EFEA6CCA1D7F58, 0x3E59745D5BDD565D, 0x710E2365F6D8B740, 0xE2A7F800DD64D68F,
+0x9E22E48C119CA777, 0x6F11A74D3CE5C70F, 0x15AB80FEF565A202, 0x3AC9D57FD478D66D,
+0x5F02CD66D8C27A3D, 0x000000016208C255, 0x3C03FF2754712629, 0xE69D2EAF32EE821E,
+0x910EBF94E7886668, 0x22EFCF54670C0992, 0x133ECF4071CD3E14, 0xB5A11AB03BBC0C6B,
+0xD078376A09BE0708, 0x764E7B97D22B7ADA, 0x0402B3B04BD8636E, 0x00000000B0FE9C4A,
+0x2A710A5D90CA1E75, 0x201F1B513502ADB3, 0xB424D14F401CBC6F, 0x7FC55DD556CED66E,
+0xAECB1D2EFEAAEDDE, 0xBF967F94C3C4856B, 0xEE8F630F52F0D162, 0xD04FB6AC9CC0B502,
+0x796D5C832D302262, 0x00000000792811BC, 0xA374BA75D317DF26, 0x571F94619B10A6F4,
+0xFF85E0F3035FFF26, 0xBD2BA1F11E2E848C, 0xB9FA9D506491DD55, 0x7DCCA3272488C12C,
+0x30491A681724A925, 0xAD5C4AB99D286144, 0xD178C06F1EA3ECE3, 0x00000001AD058D64,
+0x6925EC1E328B8973, 0xDA25C74EF6DD797F, 0x19C8FC6006CB1FEC, 0x3FA6DC793A53092E,
+0xB3B4C09C076D4983, 0xA037FD998E073B91, 0x9A37C4BD8C10071C, 0x5FBF83E4B3152A54,
+0xFED72BC66A30C249, 0x0000000088A9AD6D, 0x05F5707CA066ACB5, 0x733C091F0EC20A24,
+0x89D34214B71E5EC4, 0x514C535D98275394, 0x5854213BBD51436F, 0xE5DAFF60482A8987,
+0xB60916F2224BB95C, 0x4C027F52662E175B, 0x9DEDF918DFE39977, 0x00000000424B3915,
+0x6B552E699E742096, 0xC082D3B6BB6B1411, 0xC55721982FFC5ED0, 0x242CFA5139A45D64,
+0x21E92CA13713236F, 0x495A39BA52C92ED5, 0x418665991A9EB814, 0x41227E6ECD732BD9,
+0xF17529D4C6143B1F, 0x000000017CD9DF57, 0xAFA6BD1F0F23E566, 0xA07B820B48654F4A,
+0x95A12A1397C6FF1E, 0xBADA7B173C86058C, 0x1D7BD4A46F16DDAB, 0x284439B28B405194,
+0xDE47F981192452C2, 0xDC911E0813C5F45D, 0x1625DB2478DFDAFC, 0x000000007397B76B,
+0x8C6D6D2958E1EA98, 0x2AEB8F0EE95117E5, 0x3A3D174C656409B3, 0x86CF9ADFAB0BA3E8,
+0x4D9980B82F552DC1, 0xDA745ECBAF94D7A8, 0x4D3732C97B4C91D8, 0xC1B9D2A538ED0365,
+0x8B965511ABAFDE8E, 0x0000000127A3B60D, 0x83DBDF39BEF48304, 0xEB536E3188DF0547,
+0x0FC4FEB27630A841, 0xDB6405BE27151EF1, 0xED1CAD19BB6EA414, 0x87AC18F68F0CE79A,
+0x8D1AED974B264845, 0x5E7A2856DC00EC0C, 0x9FEA617BEBBB77D8, 0x00000001D4270C1E,
+0x829751F728180CE3, 0xBB9C23B467BD8B29, 0xF002AA4B493CA450, 0x12F12BF5971FC36A,
+0x84C741C48165329F, 0xBD5616C8301D5332, 0x80F0FCA47960AFA7, 0xB56F243B841506CC,
+0x3938479B2A75682C, 0x0000000050A5F4A1, 0x6C2EDFCA6A85B2CD, 0x55BF8C8D4D8B3D5C,
+0xC08B6FF49F6D1256, 0x9373BA55549223BE, 0x60111D448B905155, 0xA1E66077F50BC74E,
+0x9B8F3D6C1B171EBF, 0x0159233260F39269, 0x0FD21AEC9E5B8576, 0x000000002EF9D73E,
+0xC91678BA4783C1EE, 0xA094D16EEBBA36AE, 0xBC764ADF25743C3B, 0x44A7B6FE469F7775,
+0x39F5416C39A676E1, 0xBD8A6BFBCFE8B902, 0xEEA3A9D244898B7F, 0xC6D6F003E9D59E8D,
+0x5704679D13AEFAAE, 0x000000011343B2B2, 0xC57D7D278C8F4829, 0x24F4C70630C59423,
+0x60EFE7F006406167, 0xCDEA5A4D72539994, 0x6658C96A611BA518, 0x8094216225861A1F,
+0xFF33AC0ABD2CE6CD, 0xCE27BA656D3DB1D8, 0xE910A8D72A4088A0, 0x00000002240AD4A3,
+0xEE80F7B02F18A581, 0x394831B1FEB21E5E, 0x93DED9AA234AF17D, 0x4CD20D581E2A0D5B,
+0xD81CD8766CB5241D, 0x5A239E743011F5EF, 0x44052FBA12C99C11, 0x9A94CDF2E9CAD6DB,
+0x616047F1E3B9F97C, 0x000000009731514A, 0xDE95C15AA7F9AE24, 0x76B17B524DE9536C,
+0x4204665E50A46933, 0x014A597FB102A203, 0xDBBD3F778A92228C, 0xD423291BC2494171,
+0x1328297049606F28, 0xD4484637519047B9, 0x6867145134EF379D, 0x00000002481707C0,
+0x9D9C04B1E5895570, 0xB4AA1C48BC8EE7F3, 0xA745F0236E8EF12A, 0xD82CD86352A9C6C4,
+0x01C578F3C2F9029B, 0x15CBBAAFEBD6719D, 0x441E566BB1E7BA6E, 0x5DBA89B8ED698E44,
+0xDB06D96BC8D06BD1, 0x00000000820EC412, 0x6F375301ABD53697, 0x0569E5EA31BFF39C,
+0x108606CB1EFD3E80, 0x9F2689DDC38AB290, 0xE7BF8E4293F15DA2, 0xF0400B02A57584F1,
+0x102EE2949E52F31C, 0x16E966E449641741, 0xBBBAA7305E962955, 0x000000014B73565F,
+0xC609EE40A0307370, 0x6DCB40ABD6F9A9DB, 0x4E6B5E8002CD011C, 0x49F840568A749312,
+0xF44161E3EFD3EDA8, 0xB87EE312299A533D, 0x2BAE485DCCBA42E6, 0xA2B78A118D533ED9,
+0xB0C697B202FD08F2, 0x000000015E0B29D2, 0x8813C4C20252297F, 0xF5B384B2FAEA4730,
+0x7E18BDEC01303036, 0x1BC6F56C2ED6FF98, 0xC2C702DC94B2A54D, 0x94061687A30416D5,
+0xCB9DA437508A60EB, 0x2B91D888577C5942, 0xAE38EACECA8ADA2A, 0x00000000FCF65FEE,
+0x0B59313B18D7760B, 0x811789086E9B207F, 0x8509D28ABFCF0B0E, 0x364A60496BBF9C2F,
+0x85076BD54B63B9A6, 0x3316B4F8597261F7, 0x0B61D408816556D8, 0x3DA8FA15BFDEACC2,
+0xFB412BC3D5796CD0, 0x00000000B21141AF, 0xB41CE5D4D7435CA5, 0xCFC43574A40A0778,
+0x1650E72B60685600, 0x2ABCAFE30B084ABF, 0x85E783F7AE156FFF, 0xC324C4865FC32452,
+0xD7E8D0135394D6D5, 0x8060BC8BF27A82FA, 0x552E267146CC5B6D, 0x0000000246089540,
+0x8BA6C6EE810B11C5, 0x41C2CBB32F986B78, 0xA6A9DAE0E9DA87D3, 0x91E6F289E617E830,
+0xD780933D15D6EAD2, 0xBD8823E1294A0B29, 0xAC3C1A1838B0192A, 0xC046DE3484097879,
+0x33CBE927629CA3F1, 0x0000000038D1C948, 0x6024C56707B44D34, 0xE16E38E6342A4A6F,
+0x8CFDF1C4DF1B1A0A, 0x03AC6F83D8A7B85F, 0xE94FE4592173983D, 0x0037CA775DBB27A9,
+0x15149CDF83B8A5A2, 0xE90BBF04AD0B07DF, 0x91B2D9EEF47F2084, 0x0000000125512A09,
+0x6BA9916243D303A6, 0xFC1B1BB643A3C505, 0x6664B401C46F2DEC, 0xBEB7BD9AE522C349,
+0xADCD774363A66B9A, 0x9B2FB631AB80BB90, 0x2C1E1D7D07766C7C, 0x2E84257F0CB00AE5,
+0xD3626EF6916D76FC, 0x00000001C01E9674, 0x21E0C4E64FB80D88, 0x3FDD7F392491A6C5,
+0xBDCACBC0F3D76A1C, 0xDDF8436D73CBC9B4, 0x57CA67BBD6AC16DD, 0xD1484D28CA740ED7,
+0x6EC66EC8E6F469E9, 0x1E4254AB06E337BD, 0x21CC95C785610C65, 0x00000002028A0508,
+0x8FEDF6F6776C4D3C, 0x38C29FA7E09D500B, 0xC0CAF6712BD0D67F, 0x1EBFDF9945DA3FFB,
+0xF770EE0A11199FD4, 0xB62F80731C882DB4, 0x9FD505165FDC5AA8, 0x877E6E6F8FD7F1E1,
+0x6FC2D180DDD706E2, 0x0000000236465370, 0xDC4DBCF29EA78617, 0x1B59E1FD0D5E2371,
+0x1F769517996B916E, 0xD68460021BA6E60D, 0xB9ECAAED5C5B9D62, 0x8DAB4D6A77E79331,
+0xA06DDA53EAFD1241, 0xDDB92C26663A87E5, 0x0B5086AF7FBA7925, 0x00000000C7DE39DE,
+0x0F811140F04C8262, 0xF5D62A7E4B3A19CA, 0x4816BDC4C019382E, 0x0F152D245BE57110,
+0xBF796DA50992C420, 0xA4FBD34A88F26A98, 0x4AB1D5F6015991A6, 0x0F2DBF3724D661E7,
+0xB339A397ED9E843C, 0x000000026968FD95, 0x5D594944456DFAF7, 0x82BF39BEC7D68806,
+0x357E32A8D5BD1325, 0x6BD5D3DFB896848C, 0x4C0E26CC628EA0E6, 0xD0EBE44CDE0A599E,
+0xC2F83DB4C1AEA1A4, 0xF6CFEA235F59797D, 0xB34E98F173E018DE, 0x000000025003FE25,
+0x7D1E27A5611CACFF, 0x2A608B84F6FE5B99, 0xD06037557D3E0FFA, 0x6DE15BBA1D1C0830,
+0x68EB379CF6054367, 0x7B445F61FC5C2FB3, 0xDEB2451A92D82E29, 0xE062E04C5F72414B,
+0xD0AAFF03E5E6FB15, 0x00000002075B0833, 0x17F8FE716EB4CD05, 0x37A951C3424E22BB,
+0xFC7D8E5844163169, 0x796FE70EEB009D21, 0x716BA4CA5E1A516F, 0xDFBF2163666BC165,
+0x7683D7A62F1FA0FF, 0x80FBE25CE32CFF5E, 0xBEE6B999C3A5D7FC, 0x00000001D837127B,
+0x79C5928A14851452, 0xA9FC0556E6808B3A, 0x296396563E076907, 0x7734098C18118F0E,
+0x361C1FCB3E88D579, 0x93358A1854AF2F59, 0xF377D3E88874E4E7, 0x8E9F80897D0BBDA2,
+0xEED79B52909F83E3, 0x0000000276733490, 0x0C4B5F2EB8EBCE0D, 0x0E22A4F0265009A7,
+0x3122CD9656DFA522, 0xB89655BC79C68501, 0xCC251A0B6A073130, 0x4E66BD4E04716909,
+0x7AE5616A9D5AF1D4, 0xDA8C862E1D607C0A, 0x1D724AF53C6A214F, 0x00000001B5545A7E,
+0xC5AAEB6997102A49, 0xCC606350F04D0A48, 0x7F533A8D10EDCA3F, 0xB68A26655FF5D685,
+0x2E3FBD902E99D5DF, 0xDB04741738FB25BF, 0x02B25DB443A316A8, 0x9F9D9F2B9E8676E3,
+0xB69E7C51389130ED, 0x000000015C6576BC, 0x3AE43A2C673DD4FB, 0xB46B770D2192421F,
+0x285E6750271693C2, 0xBA47BCB70BB20261, 0x697A7BF783171742, 0x4BF347778BB16FC5,
+0x240EEA5F3BBB3563, 0x3012BFDFF1759155, 0xDD30CBE2D9885A1F, 0x00000001D466C59C,
+0x26466A9E754C9D5B, 0x3FCEE8D5B8F682BB, 0xA9475A30269D1813, 0xAF0952643A1340BD,
+0x3903A3CD3F9EC80C, 0x09477025C363512F, 0x4FE3466EB1663D1E, 0x096D6C7266532BAE,
+0xD6BB1EFA00C37D36, 0x0000000015C30A13, 0xA9B9D705BBFB5030, 0x28A17126135976DB,
+0xDAF5CF337FEB2888, 0x79564672A2A10F77, 0xC1954A2AB37F0CFB, 0xB42BBFAE39C85571,
+0x62292DB13044EE2F, 0x5DA9C7488F9ADF98, 0x1EE17E1A694F0584, 0x00000000701FF64F,
+0xBBF6E96D3FB818D2, 0xF4FD384680B578AC, 0xBEEAF3A3C6209B89, 0xCF5098D31929C77E,
+0xAD599C3588049D03, 0x2B963F6595D56E68, 0x3BE20424644F3F73, 0x0F03990813600323,
+0xFF259D61E67514F1, 0x000000003D5863C3, 0x844ACDE06C725233, 0x83653116E08B1F8C,
+0x7308912158065A1A, 0xFF0B88AE4AB24B3E, 0x8FDBE7DC6204379B, 0x2576128198124CE3,
+0xB263178701DDCCFC, 0x90C4B43A410DAB13, 0x1DD25CCD2587ACAE, 0x000000012D99AE53,
+0xEFDA07298CEE43CA, 0x1540136D0815EA90, 0x2F3A8C9B34A8054B, 0x101DA503751A1F15,
+0xA492FF674E47E7C6, 0x48FB01C66C48C606, 0x56A3AA46FB111F79, 0x55A6CE5A22339E08,
+0x08C3054ABEBDAB4D, 0x000000015FE811F3, 0x0B550ACEC341765A, 0x5B3725F957955B36,
+0xB3A974059B9AD72D, 0x9B61D5E4F8935F2F, 0x2FB5E8F1497C6912, 0xEC45D281F614916D,
+0xC0C931FC280D1071, 0x150C05BB0E267FE5, 0x7AD91C2A5DFA334F, 0x000000022FC71B55,
+0x3475BFECA7F6CE22, 0x166FD17555032527, 0xA2334F3D00D5C03A, 0xC1ECAB7FD93C4C9A,
+0xC6A87FBEC6550F6A, 0x194FB5DE1731BD82, 0xF698AA2B36BE71A7, 0x93866821164CB10B,
+0xB7C93FA6BC535D4C, 0x000000013CAA5400, 0x3F8380911013705B, 0xC4DFA804A99C3F1B,
+0x76ECE3EAA0744C31, 0xE5028F700DD92E6A, 0xB1026AABA5FBA0F8, 0x9745AB282C7B6368,
+0x85D22BD3F884ED02, 0x7F2D9BDE90D1BE49, 0xF35876A87357387C, 0x000000024FC7971A,
+0x42564716E3A0D66F, 0xD9AB6B44FA90F28E, 0xE7EF0F1F33212DE6, 0x80F3052E3FE88584,
+0x11F86DE2F4078949, 0xCCBA2E5B7199F799, 0xEA888D963A0A6476, 0x3CBB29E6A6B567BB,
+0x2642287108052FC1, 0x0000000145C8697B, 0xB0C51AEFB34D0775, 0x040AF4544F3307E3,
+0x4F6524C443957B11, 0xABE3F7236FD68016, 0xCE8A115595FC624C, 0xBB5D306BE231D5DC,
+0x6A2DA9987ADE3ADB, 0x6B6B80A1DC667502, 0xB2A7C5B905ADCEDE, 0x00000000271259A6,
+0x272790A5143C6C56, 0x8FDD496C7B73380F, 0xE82475728590D819, 0x25442C9A7AEB4537,
+0xFD275F483FCCC004, 0x028D47A0F4B6DE23, 0xAE0A03AB8CC51E77, 0xFF615C0FB2F562DC,
+0x206088DA7F3DCDE6, 0x00000000C48085AB, 0xAB67A27786D31C20, 0xDACBB6DE318A008E,
+0x37023A9C009FA596, 0xC1C12ED211FC8989, 0x967832B357908980, 0xC299A8A4F7D7EA5A,
+0x79ED4FEE28DA64C3, 0xACED534684707C03, 0xDE835985D7EC1E9F, 0x00000000B142D1D7,
+0xE015BC80904C8037, 0x90B2E62F3582052C, 0xF23846DFA9E2EAB2, 0x20425E515F17274A,
+0x245C6D4520EC9188, 0x74BC48825B71EAA4, 0x609C022224D2E807, 0x47EF27FF8CC5BFCB,
+0xB80311AF1FF930E7, 0x00000001D86352F6, 0xF3918A29A84C55D4, 0xA9918FED71255E31,
+0xB79202DA60E58F86, 0x3EE4AFCAB3728756, 0xD05B65E2AE7B8C54, 0xA0983FE94A343F35,
+0xC8FB0D1070F698DA, 0x5DA9620CB10A7DEF, 0x61C54073136B7DF1, 0x000000005D41564D,
+0x29AC2551A04359E5, 0x26B0AB5FBE421E8E, 0x8597958FC008DF30, 0xF6813BEF1568F1E5,
+0x3466C182154AA59C, 0x35DFC124694A308F, 0xECC10E79972F0323, 0x254BE856CB64CFB4,
+0x50E1DDD665342399, 0x00000001D4175290, 0xE1F0E465AC4DFCF3, 0x0DC2C8162B90443A,
+0xEFB5CA5B7DC7FEF4, 0x5A45244958F5BDEB, 0x641E687BF1259685, 0x7F68FB26DA7F97EB,
+0xF2E77E676D9FBC00, 0xD7CD57D77E615165, 0x0B45CF80B19C173A, 0x000000016B53B003,
+0xC7FF490CD37D16FB, 0x8741D3876667880B, 0xB7F57B9ACD8AA940, 0x64792888CD8E5C68,
+0xE2BB541C45871D82, 0x8698421C567F7D2E, 0x21981A80BC4444D5, 0x483CB62FD36A803C,
+0x4FCCA0FA92F4D19C, 0x0000000106516A64, 0xDC4F009E36AC2D8E, 0xF851789AFDE9FAFF,
+0xD50582D780B2D6E6, 0x60481F1025D4184F, 0x2319AF7AD3E9F5C0, 0x1EC69789181E1D78,
+0xAB919F3EA0A8449F, 0xF6EEDF2347371C6F, 0x889633AC9B57BDD7, 0x00000001EAED21AB,
+0x1BC5E4928FDF6CF3, 0xC37E5093DC14090C, 0x9E98571F03D32631, 0x900C3901CDC0BD4F,
+0x9AD664478EA717DE, 0xBC20A2FF46841687, 0xBF0BFDC9B4AF07DC, 0x95D27F1A1224672E,
+0x48E398FEA6A87EAF, 0x0000000256AEEFE0, 0xCC04C01AF7AB2384, 0x19E3621674163DF0,
+0x86F3F95A85C237F7, 0x555C3F58B49A4AA7, 0xFA490322B4CE928D, 0xE9F7A6E55BE96F28,
+0xFD4C9379A1C33A87, 0x3E1D7898A5F7BD84, 0x4ECE81F79A42B9A0, 0x00000001E0224527,
+0x532F8B51FEBC2376, 0x70381A4D6392F9BD, 0xA8D2818821D09C41, 0x7096DE3D4675A46A,
+0x2510783D3AA89188, 0xCCAC5DFE22A68F01, 0x9E43374DAE0CBA21, 0x2E332EF1A51D5E0E,
+0xF89DB77A48E6717E, 0x000000008029AB5B, 0x2B5C192D4DCE43D8, 0x52D2438E896A9794,
+0x379A4350D883570A, 0xA1655B98B8FC4943, 0x986143C3BA3147E2, 0xF1E72EE0C89B3FD3,
+0xDB8ED7F83E5C9221, 0x66F0DEAE03221D37, 0xF397E59BFE2EF677, 0x00000000B4AF7141,
+0xB194546BC2B8AF02, 0x53FC46E4B15D0CA1, 0x811A14447B7951B8, 0xE423C168CAB3798F,
+0x5BAD02F502E0786E, 0xE9D05DDB5C815913, 0xA4FC7D82850E631C, 0x1CC2F6F20FD1F6AC,
+0x83C6CFF1D4E45F9F, 0x000000008A9E213A, 0x9AB90CA1E33B72A4, 0xADB56EC3F0753BDA,
+0xA2E37E5BFE89623E, 0xE733FE1F41260CBC, 0xEF0A81F2FFAF9D59, 0x037A7D2070AEEEF6,
+0x9E596F32B9B7BC3E, 0xBB2A73580D450C48, 0x76CE6B6420824902, 0x000000027BCDF1A1,
+0x85B658C372BAEC31, 0x89295F0C96E40286, 0xC2CC7B987185F94E, 0x8D2980213DD3E99A,
+0x9338B62AEE6FA690, 0x5AAD12EB8AB439D9, 0x41235AF6ABFB90E8, 0xB94F028587BD4786,
+0xFC950E55B5F1B079, 0x00000001828BE334, 0x43D27A4EE316AB73, 0xFCC9F9815BDF70D5,
+0x6A2DB9E7DD16A6F1, 0x79485EC999E9F4C6, 0x62883755A37C1511, 0x0366879488421C01,
+0x0E11C8E39899BE0A, 0xD1A1D1FD11C74B60, 0xCF21D76EFA756F15, 0x00000001252C1E50,
+0x6F990D7A58333E31, 0x7608F32330A02173, 0x81C32631FD2B00B1, 0xC3638A208792C769,
+0x52F4D26E37F5BD06, 0x581FF9764A234796, 0x16B65206517CF92F, 0xD151DE6255D107D3,
+0xEAD0995340FEF17E, 0x0000000083FCB8D5, 0x0F629C77481A205B, 0xA9B1759A9A2BCC5C,
+0xFF176EFB99451332, 0x0E3D3EEDF3DD88D1, 0xB9D21638884618A8, 0x0C093A23D8794921,
+0xE289C24C91BCF186, 0x8272674EC3A8FF99, 0xF5CEFF9934828B82, 0x0000000198161A18,
+0xC01E41A4A517AA19, 0x7C20E15AAEBD7984, 0x82843532F5943433, 0xC7D8F5D0D17E6725,
+0x56B3EB5DC7B9B717, 0xD2CADF601DEBC9C3, 0x97F84FA62C7F3A6E, 0x0C1DF9931BBE806D,
+0xA6A1013E45938291, 0x00000001EB49A76C, 0xCEA02AA43E45F390, 0x2BFB8AFA6D8F3B02,
+0x2FF32866D3F5943E, 0xB3DDBEFAEA54AC57, 0x3B2E00677F542AC4, 0x0BF2790EB59BC263,
+0x7CF8B03D08921635, 0x05EE6B8A443B308F, 0x6E4B0F0BC22BCDD9, 0x0000000167ACEDB1,
+0x82F727F597DD9ABA, 0x22B6F502468A6F1F, 0xAED312109146B051, 0x1EE8127B21D928B6,
+0xFD8DD3A168D4A31E, 0xA2FCCC2B1C2C1685, 0xC4B125D9C93F7CB8, 0xA6C6CA7A8C6BF93D,
+0x0251F5A2BC2F3BA0, 0x0000000014250471, 0x81CB1088A46C8B61, 0x32527CAA968EA68A,
+0x3D73D8786B0B9997, 0xF711FE11BE170558, 0x26F56C49AC46E298, 0xA2417138438CAF47,
+0x0CDB4778FFE907C4, 0x62EA2DF11253B5D2, 0x5BD304A934C1B850, 0x00000001EA4DAB8D,
+0xCEE159984E6295F3, 0xE2735CA22391A4A0, 0x1F3FB84ED5794D2E, 0xF51301D6CC43F589,
+0xE582735FCA4F1C21, 0x94F75A8592F257F6, 0x6346F55CDC6B53DF, 0x46B09E59B51F42C3,
+0xC2B40041EC6323A2, 0x00000001F00340A8, 0x06AA757E435D63CB, 0x9DCDB068FB623786,
+0x0E5F933338104614, 0xB894CA463D04796D, 0xC35A844049D5F285, 0x2A632A5EBF5F7F9D,
+0xEC097FE9581B9B28, 0x8488FB6EAB74A7EE, 0x183E13BD6F337620, 0x00000001C101113E,
+0xAEA89085047FAA12, 0xFAB97A4ACEF2CBF9, 0x69282A902F431777, 0x4EEC2CF0F60F8D85,
+0xDCC43063F961E0F3, 0xF114FAED159050FC, 0xEAF5CC96BF09D48E, 0x1D5E3EEC0D63EFD8,
+0x87EFBE1EA978D443, 0x00000002152C0C91, 0x43EBF3504FDBF297, 0x3FE2180D6D2B3A08,
+0x6966131032B189D6, 0xDC5DC2B8C8B7F67C, 0x72A78E0DA74C1B76, 0x49CFC8E0AFB9D75C,
+0x37FED01B6AD7B7C9, 0x28B21EC3EBE3E93F, 0x4F21C21A3AF894D9, 0x000000019715FD9A,
+0xD0A7E4F875722AD2, 0xB5BA1A8CD3BF84EC, 0x7AFB2E0224FF670D, 0x528BBA7BAFE52F78,
+0xA096AB6408B779BB, 0xC19BA7FB36A54944, 0xAF7F9BD2ED6C742C, 0x55815269909FF6B9,
+0x3285FA44C31F0AF1, 0x00000001BC1E670E, 0x0A1C2ADBBB17E90F, 0x9974582234CCB8A4,
+0x3B7C8989C2425601, 0x7A0216E249609245, 0x1D1AA56510C66546, 0x908C7FD98463E388,
+0xE4E7D5419979F669, 0x6E29918880302B74, 0x937697D1B2330FE4, 0x00000001FADD5F2E,
+0x98331A43A838C563, 0xEA82F635AE6B89DF, 0x601CB06F0D55924F, 0xD1CC2A54421847CA,
+0x843DF31B5B40705D, 0x2347B17E4613C973, 0xDDCD0D8C31F41B16, 0x9F24F942F93156A7,
+0xAB8449AAD261B874, 0x0000000092CD4221, 0xCDF801FFDF7205C8, 0x25496B9B117D5053,
+0xDDD5BDBE624CCD39, 0x8160168943935D35, 0x1920C619324BF6F0, 0x4FD58334CA33107F,
+0x7D72D8175E535662, 0x5F57A6872E96617E, 0x19A6FF3021D1743D, 0x0000000262BAF074,
+0xB79858426229F150, 0x014ED19F2613A3B7, 0xD6066C029E1B3166, 0x18C6606F206CF925,
+0xD7D38D6EAF0167E0, 0xF0B019991A566411, 0x4090C33CB48334E7, 0x387F950E373B7EF1,
+0x0805FC5DE19C7A87, 0x00000001DC94B69F, 0x08B15BBB41EC8D3F, 0x350D92232E1397F9,
+0xA6B6B33CEDB63176, 0x2CA9457CF765A975, 0x1E1C2E86133B4626, 0x28472C89877C52C3,
+0x8B604C55F7700018, 0xB8E2DFA16299ECB4, 0xED9637D7BC8E463A, 0x000000018F5A515C,
+0x6D8F13C675B45E90, 0xBD4175A4601F81A6, 0x0FC90B750377E9E5, 0x75AB4F6371AACD03,
+0xA7A352CE6BDE5104, 0xD9D8F5730F8CCA66, 0x63FA9CA8C2E87AB8, 0x1C1DA1F22D0D4F75,
+0xF7597008AF2976D1, 0x000000010CE1D699, 0x2B98786071727DAE, 0x45DA0DB715B3200E,
+0xB0DEC9EB078C53F9, 0xD2FCE7978BC5D64D, 0x0029527A38CC7AFF, 0xD29923B83A7E2BAE,
+0x3E22967C960C21E7, 0x777F2C41597F76A7, 0xDC0A6D8578DE1A51, 0x000000021D27C6E0,
+0xBF6085A416114994, 0xF75EFB560ECF08B4, 0x56DA505FD73E2619, 0x65E196E7F9B5C8E8,
+0xB6FF63E0350CEABE, 0x1332F7160D1EABC7, 0x715B31FB922CEBEE, 0x2EDE0A67800B40E2,
+0xD3C5D2113DCC52E0, 0x00000000430AFFBE, 0x64424A462103BEA4, 0xF8D23010C695B6D1,
+0x0DBFA89C2F8DED4C, 0x1D360E8A5D3592D3, 0xF208CCE9BE3EBDFC, 0x1BE8533479D95DA2,
+0xE53ECEF171D39A56, 0x8A30328F55A9EF1B, 0x15F2D0B4CB9E588D, 0x00000000C1F5495D,
+0xF4BFABB674AE2D02, 0xA3275283EBD3F5A3, 0x13C582DF19A838C9, 0xF627EA7CBE4945BD,
+0xE30D1CE4DB34AF4A, 0x1F2BEA765E97615C, 0xDD8DE85DDBDCCEE3, 0x242E3F0EF90ED5BF,
+0x4A78309273EE2214, 0x000000020DFB1C33, 0xCE57AF1C148B010C, 0x9014AF9162C9C6FE,
+0x0643760920E62C70, 0x846C7701C750C11F, 0xB40C39FAC1AD5458, 0xA369EC64BA56C097,
+0x3A0E19662BE6FF0E, 0x50856E4C5FE85E3B, 0x435B8C1A82237640, 0x0000000272DC6573,
+0x8649588216DA1EE7, 0xDF779D67E0EAF546, 0x4DDCF370963C1077, 0xC94FA087C8BE26F9,
+0xE43C4A7F98C30DB3, 0x060DF9F5AFF866B1, 0x23187A30031E1E0A, 0xE8BCEEF0353BEADC,
+0x53F9F68A1C2682FF, 0x0000000146AE4703, 0x657756A456D3A874, 0x7A04F650620C8AD9,
+0x01B1D164A6AF5F77, 0x049ADED358BC11A0, 0x1D148A1E74449095, 0xDB0220ABF0A98F72,
+0x4C5C1180C24E68D6, 0xF154EE5B0FB8024A, 0xE6C5BC26E9860C61, 0x000000019E4C1D75,
+0x509E2F5F1C1AD563, 0x9CA30DE13E17647D, 0xA6BE4199D8EB88B4, 0xB6FBDAE2D33FE441,
+0xBA6AA6150F8E0D6F, 0x7F84E03DF712D7EE, 0xB7225C9BEAF9E3B1, 0x31381C755C2FB7D2,
+0x4B04951D25BE6F1B, 0x0000000150139CD8, 0x8EFB1CCA165FC47B, 0xF4275CCA2B63AD81,
+0x305F474B9E25C5CB, 0xE35DECEE90D1AD00, 0xB514ECA95B68024C, 0x4EED6CEC2649F391,
+0xEA1ED7C2241B0C8C, 0x55A78FA9574EAE2B, 0x8DDE4DF0F85133E8, 0x00000001D63EE698,
+0xF57812312F670696, 0xA57EBF873E30B609, 0xD8034A2616A11284, 0xBCABD48F0EC572FC,
+0x5F5E5039701FA593, 0xEDD6CF444D0F709C, 0x536F0EE1E54BFF4A, 0x942DE519AFA47B15,
+0x465708FBEF3A0BD7, 0x00000000F4A1EA79, 0xAAB21CD7F9156D20, 0xC3E7916F77BA3860,
+0x7E7D9A0F01FE692B, 0x0B24E5E0116B0DC5, 0xA0CB33E76818208D, 0xBC8FABBA9AF57E0D,
+0xA2CED88963CECCC1, 0x081695F122EEF857, 0x559DB59794A126BF, 0x000000006E10F4C6,
+0xEC4465FB5AFA9B01, 0xFF4D8F77279ABA20, 0xB22F4F53EA131442, 0xF65A6286941B52CE,
+0x426D33371C680E79, 0xED1F29147581DD37, 0xF84A8C5808A1B2AF, 0x3D106E00BE20181C,
+0x1FC746A1A152C4E9, 0x00000000D98A9062, 0x93362332179CBB5F, 0x4715E20596B6FF5B,
+0x92CBA526FC978A7F, 0x84871F8BB596CB30, 0x23F25AB948F40372, 0xC352CBC687515778,
+0x627D3217AF831E82, 0xE4073CB33FB1544D, 0xCBE17DABA0561D4A, 0x000000002C47276D,
+0x4F26FCCE9C421510, 0x57927768E4D00999, 0xE31172BD6AC74863, 0xAE78552BDFD6FDE2,
+0x1CE04BE87194267A, 0x8BCC6C96A775CF47, 0x96BCDEA8C7268E67, 0xD05D9868587B4938,
+0x376E262281FB0790, 0x00000002397B8697, 0x64A75E23A7394BB4, 0xEC1064520085753C,
+0x83281A2D7096E80F, 0x639DCE27378F14A9, 0x4757412B6B804715, 0x6DB92ADBA3944D4B,
+0x51760926335E23B6, 0x11C7290946507D9B, 0xD7DEA68898BD7EE0, 0x0000000110C86A5B,
+0x7FB007CDDC3BD1C5, 0xE2B4CB006BE3C118, 0x6B37812134EEA997, 0x8B5856595A8AB7D4,
+0xDDDE9FF4B57907F4, 0xFF5E62E976401707, 0x96A67420C9943107, 0xA20C8E5E73226F37,
+0x534BE09269998C07, 0x00000001C4CD20D3, 0x56602201D4D2E95F, 0xC292301F29E01757,
+0x77CB0AE117A6D303, 0x134B60F9FF4589D0, 0x4C2A73E894A0EA17, 0xFD7F57682B2CBE21,
+0xB147E16E4C3E809F, 0xFA917D1911F71975, 0x0E00FDECB8CB8785, 0x000000016098EA27,
+0x3CFFACB2F550C5BA, 0x22EF9CBCD5088405, 0x2072F63D109B1F82, 0xFB1F30E9A2792E78,
+0xC69802EBE8D7E9D0, 0xB869EE737341F300, 0xD4098B2F34B1EF58, 0xA6859D1A14C2B6B9,
+0x752D4C116123DBC2, 0x000000025C1E3C22, 0xC8E140CC52E6AE12, 0xA5A4EFB1C5D0BF99,
+0x3EBE3B8C27E5E504, 0xA21E4E29E857AEAB, 0xDBD501A03C4F05DA, 0x9B3710CFD445CA9B,
+0x4AC98E655EE5FE02, 0xA3394D4B4658C5E6, 0x5975D9A40506D2E8, 0x00000000E17EE8B9,
+0x59ECF5A4B21901FD, 0x9135CC12B91FBE54, 0x596E62DF9D268617, 0xA75CA6CE4630E7F5,
+0x71E0F5D14D92C56C, 0x5EE519347BDD179E, 0xBE7E61E1C6D0A072, 0xB4E3E44F15E6BD72,
+0xCE01155EA60FBBB2, 0x00000001E50BA9DA, 0x84D8D84E952F6787, 0x885D69BA81EE8447,
+0xAA7B035705E93C2F, 0x5961B15F1C2522C8, 0xDF67D1D887E4A3C3, 0xA85F4A8E946492C9,
+0x5B605207B20D4B04, 0xAE770BB906F20823, 0xDB264733D3638511, 0x000000008E1474BA,
+0xB543759E1BA9F4A3, 0x68B310FCBC409C57, 0xC4DD1B0BA3241E94, 0x7CFC45236269B59A,
+0x61BEC8BB5B70E8EC, 0x216F0DB8DD4BD216, 0xA3FDB7E0B3317D34, 0x4DD5C9829E0E5D30,
+0x0FDC1FC8682B6F84, 0x000000018366E98E, 0x65B9A9641E38D34F, 0xC34CE9F0D9246CBC,
+0xB3BE6003AB4FFCF8, 0xD445BB851F588081, 0x1CB1001A4A77F34C, 0xA55471B2A0B8AA03,
+0xC0E59633266D6291, 0x51E740E10C177602, 0x1CCD6567F26E3EF3, 0x000000010FE1916B,
+0x49D4DA4B3B9BE052, 0x1EE6AD36CEDE15B1, 0xE6CBB8AB62486BDE, 0xE842E3801062F562,
+0xD430B40C6E00DA3A, 0x6166D154B4D99C9D, 0x1E23FD10DBCCD0EE, 0x9F6777986F8B6B77,
+0x0A1C4271D64CEAD5, 0x0000000003A8CBFA, 0x9519A2EBA173E250, 0x5276960FD30BDD33,
+0xC4284C8248DA71FF, 0xBC27E62D8E79BF3B, 0x743CEF0D0744FEF1, 0xE75F88E7693CD17D,
+0xD5D31FD74D2FA356, 0x190E4F8FDCD14C49, 0x765F003418237633, 0x000000015FE92322,
+0x0270D3AFD04EFBBE, 0x71CC205B156E3539, 0xAB0558187EAD8FB4, 0xC88346674817EE29,
+0x668FB7A4F8E4CF77, 0xB7E8DC85F8076651, 0xAAC8AAB41C4BF064, 0x0454C1B0432E918C,
+0x17D04408203D7EAC, 0x0000000047C3AD93, 0x3B5ECC63BB25B8A3, 0x54EBEB88E69CD516,
+0x0041212458E7F349, 0x607C4D4B1E6252D9, 0x8ECE47B66AD751A6, 0x584C4BD9FB3146B1,
+0xC7CB2B2A814F755C, 0x0E84A2D4C9F2657C, 0x7202104A4DC3B3E0, 0x0000000240AAD25F,
+0x57741417F4126610, 0xEE05DDB2D1D3BC71, 0x319E7C748F98BCE2, 0x972617803C957B4E,
+0xE503A329E0BE9116, 0x6D8B5022537E7EC8, 0x49602C160E9849BC, 0xF8263E498A4758F1,
+0x182BB898CB13C5F8, 0x000000013EDF18E9, 0xECBE589EBB8E733E, 0x2155AB262CC293F0,
+0xFC47B3F8AD892323, 0x80E4AFE1E16CA555, 0x99D855B068A7C074, 0x564BA9F748F1558C,
+0x6DBCA106EF000887, 0x411E5ABE97C6F996, 0xE72B6B40549D8ED7, 0x000000011AE6160B,
+0x53AAB77EAEE9E61D, 0xB6C8500280D6141F, 0x95DF30D676DF50B2, 0x207CFE37D76823F8,
+0x0B1623A5D1FAC6E4, 0x062599D08EF97662, 0x1C4F8D8752F31224, 0xBFFC3E18E77675EB,
+0x1A79C248DA607B72, 0x0000000101257867, 0xA8C398067F578F12, 0x34459DC41A455F29,
+0xAECD5BF58260287A, 0xC090340E5E5B75A1, 0x361436018A7473BF, 0x78E52AEDF87D0201,
+0x5324D03306E4F58B, 0xD5A5D163F4B833C4, 0xE08BAC06B5489603, 0x00000001627424D0,
+0x5D82BAD36E107C98, 0x57BDB6644CBFB6C2, 0x2503B45965D39BFC, 0x8ADB368936BC6ED3,
+0x1B84ADE313CC0BFC, 0x15D5CFC405AFB323, 0x8E9191C68DD65062, 0xDFC778CE0EEFE52A,
+0x6FA146978387E900, 0x000000026F124146, 0x6CD406AD76FA31F3, 0xCBCE38457FE4E360,
+0xFBB447302A695C8A, 0x1B18506C6E54E559, 0x370385287C6E1A9C, 0x4688C90D762F0BAA,
+0x9A49634ECA61F818, 0x935E773F8B69938B, 0x49206D8F00020C36, 0x00000001AC2E0314,
+0xB9A84C769F9AE3A2, 0x1E68A1BF9751FD4E, 0x92F99E6F30601585, 0x20A5D1429D8EF320,
+0x21FACCBFCC43CD6E, 0x4DF521B9B772CBFA, 0x4724035788512413, 0x239D0FB707B9E8FD,
+0x716F2C1871F9331B, 0x0000000126EE5341, 0xC4ABA83E7046828D, 0x221CBDE5DB1275FA,
+0x3CA6AECFBFB2337C, 0xE4952FE6D2128A10, 0xE2BF5F2D3A77B0DD, 0x2111AFACDDE6F7FC,
+0x815F2BD16B9E9189, 0xA1B49DAB15D13753, 0x6038DB9444DB3D58, 0x000000002AAA9CFC,
+0x45C7AA24EB8BB7D7, 0xC003D56B86E194E2, 0x3F2D9192FEE736F5, 0x13C9711A49A54BE6,
+0x0567ADBA9AA4559B, 0x47A7E35455C6666C, 0x1BE96E514BA3BFF4, 0xB17B18DE967DC282,
+0xAD393C1DC3A415BB, 0x00000001DEF0A535, 0xD387A83F16E81D14, 0x9C72780CE4DFBBC2,
+0xB1AE055A841644EA, 0x8C9D9F8AAFA13902, 0x549D03BDD714AD05, 0x1E53ED97F116B13E,
+0xB9414B0B6B316CB1, 0x4F95325909CC4022, 0x3B56EC06B52ABED4, 0x00000001E6189AC1,
+0x82401316DE015859, 0xCFBAA9AA91EC8D36, 0x9BA8D17592B02205, 0x7915BA55CF725213,
+0x9BB4E2C486B16BDD, 0x50EDC34163A040AB, 0xFEDFAA9B1A5A9FBC, 0xEAA6AB81BA662948,
+0x1889A300E603CC56, 0x000000001AD82625, 0x7156492B3318007F, 0xBA6A26B9E57E7A18,
+0xB61EA97BE5366E3B, 0x971ED666B02E4B28, 0x6A1675CF78313BC6, 0x6D8CD08DD9C9C6AD,
+0xD5B24ACECFD803B6, 0xD06F443CBF2C231E, 0x057CFA0BC7685E44, 0x0000000245ED0F5F,
+0x11160FB9F2B53933, 0x97B710450E27C84B, 0x98F03908C04D90F0, 0xB4BE257009611813,
+0x7BE59A1A0F18B0EA, 0x9F72EC7A8E34A935, 0x682C59D03EFBD891, 0x118E78DC308B30C7,
+0x2294BF1A130F302E, 0x000000021D379F5A, 0xD17B9698BF4431B4, 0xA98B5BF5E911E1FB,
+0x5A14501E938BBCA8, 0x33167F14BD5BFADA, 0x1D36097112E8952E, 0xA16DD42A03EF81D1,
+0xB4021BA18A5A627C, 0x5E14364FB9971A3F, 0x70F04ABD8C00F539, 0x00000001716F3753,
+0x32515E038C62E913, 0x7354313689CC8200, 0x3180FF951807B460, 0xB2CE4CCC9B9CA544,
+0xE4BF383CD299C269, 0x3F73374A1B9EEFE4, 0x090FBAF8CF82B2C7, 0x5CD2760FF84121AD,
+0xBB80B2344754DD9A, 0x000000003DA7A9C5, 0xA8EA4715C8EB7B06, 0x4A5A70E5C521F381,
+0x39869562107A1723, 0x47AB765616E550F8, 0x8D3C103FD1A185F1, 0x4A15AF0FE359F4DF,
+0xF511965E259D60A6, 0x03DCAE5EF3E0D210, 0x6A1585E80B699AC6, 0x00000000BEA6159D,
+0x877DA8F680CD22DA, 0x9E5D283330D8818C, 0x8236E5B488EF9EEA, 0xF59BE50DB0473120,
+0x4554A550EB48D003, 0x04A17F7D2C25BC50, 0x8937A4FCBB7A6759, 0xDDF8864211B7308E,
+0xACB739820D752E76, 0x0000000218B0A5F7, 0x36EA22071B5F9482, 0xAF3307AB2EC91C97,
+0x524C2B8CD67B9497, 0x7D34449C8D56FC36, 0x5E505B4539C2DEA3, 0x17B9C87BABD26730,
+0xA07EF0B62F9271A8, 0x333355343B5339FA, 0x9A5216B10873281A, 0x00000001EC26D9EC,
+0x10D41C2C3129D63E, 0x4F8AD037839B2082, 0xE26F163C44040103, 0x1702E2B737CC290E,
+0x5653043269F1C74E, 0x998386B04991915D, 0x6A5258650ADA222F, 0xE2F606F35C0461E7,
+0xE80CB385E87C8B30, 0x000000020D256695, 0x4061A3EB501F7B1C, 0x197B9668B79726AE,
+0x2A743CE79F27CA6A, 0x95387BCCDB54B261, 0x6C088FFBD69D57D0, 0x40451A5E368E4C27,
+0x0CDA11B3567C8727, 0x7EB76A7933366C3A, 0x5E213DFB9E71107D, 0x00000001DFC94EA9,
+0x31D7000D4A223367, 0x04B4C2E4296E5179, 0xC70C10980EF610AC, 0xD5F56203720EC273,
+0xB1D58B2B83C1E5E8, 0x1AE5D7C3CAD5CB8C, 0x19051A9E2DBA2BB1, 0xAA6E042AE3A786A6,
+0x4DCD1A7D89A9463A, 0x00000000BCE917AD, 0xA9593EAA8A68DA9E, 0xB6E9FF69F0D5DB42,
+0x159D1F59782EFC3A, 0x812FA23D4D933598, 0xEB9E9813BEC4C089, 0x83CC4BBC3C85CBCE,
+0xF0C42365BD928458, 0xAD475B983FA5B321, 0x370825C77E8B9C19, 0x00000000D8F95DFA,
+0x1F9DFE3856BC7A23, 0x6D6290C3F16C69D7, 0x9D2A989C54B9E252, 0x0DE6E75F28BBD7C4,
+0x186BAA77D8052315, 0x718C1CCD584104B3, 0xD69919CBE3BB0EE0, 0x5355AA9163E071F5,
+0x88DD750458A33FD7, 0x00000001769E11D9, 0x65AA84CD6A73C760, 0x04686B8840CC4CE0,
+0x00F6C62BA63AC85F, 0xCC63B79797180E7A, 0x571B8786CC9966D4, 0x8857D5694607C8AB,
+0x0015CE9CE57E3F2B, 0xC363B144C2C998DD, 0x329053CA1FD57293, 0x00000000EF8EEC9F,
+0x1DD2560BABCA6D63, 0x59C205EEF651B328, 0x49621E12ED3B2917, 0xE46EA9BC247151E9,
+0x222B18F03D5AE5FB, 0x6B6DD238F8751CEF, 0x872B73D7ABBA6CD0, 0xF142696156954AEA,
+0x4C82AAB4709E08A9, 0x00000000EDD2BDA8, 0x5F19F193D9A9920F, 0xA1663A24A5EBBAD2,
+0xCD2AD25D0ADDD92C, 0x9D9FB5AE4140E022, 0x2CCDC6D83B3CCC32, 0xBC6C8029712510E8,
+0x46E7DAE5CAAEE6C9, 0xE973FB142D23ADCD, 0x13C73EB0219E2C6B, 0x0000000041A7AA30,
+0xD8845091495F4C97, 0x9CB50D211493124C, 0x9E6E53F8DFF2C6CF, 0x50F83F549CF3407B,
+0x6E26E10AD0F4FF53, 0x0AE2B9F92E58995F, 0x1166FEEDE755ED2F, 0x2D7C2C167D4B9DCF,
+0x1005D0BD1FEDA077, 0x00000000FFA50EDF, 0x37CDCAE13F968C73, 0xC03A9E7D0CDDB71B,
+0x8C899B420252C84A, 0xB3602A4F812D4017, 0x83584A9BD2DDA89E, 0x7AA0E539322B2DAE,
+0x6A3B6BDFEB57FECD, 0xCD118D14ACC6F84E, 0xED8490F149CD1F30, 0x000000012964EC3E,
+0xEA8CF553FC0B8DA1, 0x7E2A5C24C647553F, 0xB9FD20B0A7B2E84B, 0x840D27ED0A724BDE,
+0xA17501E58E7BA22A, 0x5CC60085DEF19304, 0xD82C09B76CA26826, 0x5C2E561615E3C658,
+0xA9744553CD441CD5, 0x000000002FE0C518, 0x5547DC614F3A129F, 0xD0EE87AC764A5D08,
+0x4427661895E11AEF, 0xF84F8D8BF21B25A9, 0xB392DD1807B12D78, 0x885C44A94A3979EE,
+0xFE21F9F368BBAB9D, 0xC58009255C775506, 0x0B950C39CA4D3D31, 0x0000000106FFAADE,
+0xA6E561104080CB34, 0xCC13CC13B070DC76, 0x942BC5B57E1B0EA0, 0x58CFB9EE7C11B509,
+0xE0714EC4E6E4CDCF, 0x8E94487BE7E49EBA, 0x09D60CF0EBB42BF0, 0xC933E8E439A103E6,
+0xEA92063857A3EAB1, 0x00000001D0DF8182, 0xEE77721C9E2E01DE, 0x7D5C6D00DDAD42E0,
+0xB72971821EE1AAAE, 0xA766EF3ABE5FDB85, 0x1F93A947934162BC, 0xF18A89F4CDEA8377,
+0x2A4718DD17EF1976, 0xF56CB21A1D91B321, 0x945C997E3C3C1872, 0x000000017C428303,
+0xF94C1C95C4C92765, 0xF152013437DD38A8, 0x80F1F817AD41203C, 0x816707ED301BDE02,
+0xE267730D20BF2E26, 0x652A54A3A74758E2, 0xB90CA1D682CA3EFF, 0x60FF36839047C78C,
+0x4302386028E7AB5D, 0x000000023F3DF56B, 0x571E2CFC53C528DC, 0x99C04453C0F8E3AE,
+0xD12BBAF5F9FCAF31, 0x32E47DE662AC79B2, 0x479EED7AC6C2A3A3, 0x957FFE629C13C769,
+0x780DE1D4E62DF6A7, 0x522082BE1E464191, 0xAFB539BC0D963320, 0x00000000CB983E1C,
+0xCA97382419E842B4, 0x14F983E66E33C82E, 0x05B353F40BF59FD8, 0x10E7E996E6735F26,
+0xA6D0E7064EB80C91, 0xD6AAE48456626BF7, 0x3D6DFF4B2A3D9672, 0x636EC8CA2C3EC219,
+0x64C647BE8E4A8BD8, 0x00000001F7F4264F, 0xB1981FE814666254, 0xDAB8C9F3BD9B04F0,
+0xF4BB4BD4EA98D568, 0x23E7578BF9DAFF26, 0xFC1DCB2A5ADDA3C5, 0x4F9F4F8DF674101E,
+0x5D0B9A76FC54406A, 0xC2867D000CC7AFDA, 0x04E2FEE26D561022, 0x00000001A641BAB8,
+0x997A5BA4B34B6BC3, 0x40B05ECEFB59980C, 0xA7D5F49042173592, 0x2F74A02A82EB05E5,
+0x0AAFF81C14B0946B, 0x4FA39034731B81A2, 0xC2CE29D68E410F6D, 0xA5C5E50AA089DEAB,
+0x01AE0512A3759244, 0x000000005549C2D4, 0x5F39944058A2D996, 0x10913C66C4913DDD,
+0xF93EE15BA9A5623E, 0xF1C7F17AB3A9CBDC, 0x4DED58FA0B22693E, 0xAFD3D1B4F3145269,
+0x625BC7AFB5410865, 0xD37FF82327FBF6FF, 0x291E4D1108FDD048, 0x00000001873FD9A7,
+0x33865AF9953E65BB, 0x7656020820135F40, 0xE2AAC3B5CD23F04D, 0xFE7F3E97BECD6573,
+0xACA8F6BA429A08D7, 0x8F4C465C7CAC8173, 0x9A0326060E5F4743, 0x5C91F73B5A794BA8,
+0x4131731DE2BE086B, 0x000000020EB223FC, 0x42CC3588DE4D13B5, 0x35490C01FF96F909,
+0xADC8F8A7290084D8, 0x5E5F38B0F13859FA, 0x14A6CB5442832462, 0x302C015183270ACB,
+0xE9BF075431582F13, 0xA38A33CCEFF528B2, 0x1CD69AA8AABDC8F4, 0x000000007D3DB767,
+0xE8D08E0AFB14AFFB, 0x6081DA317E6F7FD6, 0x440FA1133CD1C92E, 0x84BF3373AC7DB861,
+0x7A13B598DF8FA50D, 0x41D914993B9BE0CC, 0x8DA928CDAC116178, 0x9A9F6F1DC65C926F,
+0xA3CB4855BBC1CE44, 0x0000000207087B57, 0xC70BB586D85593AA, 0x5C1C9014A733CC49,
+0x68FFBA2D10072A27, 0xBCB4141F95572714, 0x88DE1C8E28C391E2, 0x3014FC3730F6D502,
+0x254EF8A83ED47DC3, 0xD571A287963B5978, 0xD8ACC47B11187617, 0x00000001EC63E524,
+0x36FDFB45A8F50FEE, 0x96096B84404A7EA3, 0xFA5DDB28C765AA8B, 0x28E675D99491E20F,
+0xB93A7C4BA725055E, 0xC590E3FC9E7F59E1, 0x94852E65876A7A78, 0xFCD2E671283F5995,
+0xE477A9C56FE121D1, 0x00000001FDCDB1C9, 0x19A644999C641EAF, 0x24AAC5D8A16ECE79,
+0x1FC62AFC97C0B888, 0x6A41C667BE4336CC, 0xB3EFD03EC2FF39BE, 0x0CA4CF40DCCBEFF6,
+0xFA88B4AA7E085816, 0x516BE00F989FA52E, 0xBB8684BD008038EB, 0x00000001829FCC34,
+0x440AE1896C9276E5, 0xDF7B217048B64B88, 0xC570179DF63820EC, 0x3A9E567C6C2DBA05,
+0xF3062155D44D7C34, 0xE465CCAD964E3C5C, 0x6B39C30D6F03D8AB, 0x2156E6622007DA7A,
+0x51C4F760856F4DFC, 0x000000013B3632C6, 0xC0F425FC4E5852D7, 0x40323B20E24D1A4F,
+0xC109A87F903244BF, 0x73560B0648434C0C, 0x19E948D07A4F1D29, 0x8C37BD9835819B0A,
+0x6B3FECBBA1AEE418, 0x3BDB01C8CEDACDF1, 0x6DBAA87626D52999, 0x0000000225C0170B,
+0xC9F06F389E62CD67, 0x28F89C96C31BD697, 0x6BB4195721D9ADBF, 0x3D8FF3022FD068F8,
+0x68D39428BE6F8580, 0x30C200C130AE0BA2, 0x94AAD6C2A2DB2BFD, 0xB97A07ACE226D509,
+0x281AD7AF58B838FF, 0x000000022FF406A4, 0x603716711AA7F3DB, 0xD7FEAA0327761018,
+0xEF3AC0784D4BB8F7, 0x7B68B4C71E7FE3C0, 0x3BD31F024B9DCF57, 0xBC5B3605ED2BC373,
+0x79D2C7A681E73C29, 0x050C19201D9503E4, 0x1FED9812D0F1D947, 0x00000001420EE2D8,
+0x4BFA1A739A6C3139, 0xC2DF5E4984D8F74B, 0x99E94F4D936B2A92, 0x6A52A198ADE7295E,
+0x6B44B5585129F307, 0xC46E5EC7B539EDE5, 0x82A6F93F75F4A847, 0xB6DF68234DCB06BE,
+0xB6C73DC2E0B24958, 0x00000001F3BE0C34, 0xD249F2C7C6079034, 0xCB0632D192CDC196,
+0x01461B89D3057223, 0x01677A0699B88284, 0x270103984BA12A95, 0x8378BDADEB907674,
+0x3CC1E39081C73E65, 0x82AA24669A0F4ED6, 0x49E5E18E014389FA, 0x0000000266601A6D,
+0xF25468E6713675E0, 0x0639463AC30F52E4, 0x93D8B4D8B1703135, 0x43EF9B2126EF3BE2,
+0x5F487B47B8ABD2C8, 0x7BE363D0FF61E1AF, 0x6D6A956E43568947, 0x977A6CD84B6301BC,
+0xE051BBFFB755C2A9, 0x0000000033592254, 0xC9B4B4F36559B249, 0x1FA5964436A82939,
+0xA4AE60383DBD1415, 0xF7A3C8EF3A47F621, 0x8D98DDF46EFE98EA, 0x5968CE39C041C9A5,
+0xE062EBEE662D69EE, 0xCF599E39161517A3, 0xCF530A0311430228, 0x0000000110281B41,
+0x28E4E7BD5D7BD767, 0x80AEC94E5E0A32AD, 0x0EBE4BC475A2AEEB, 0x55B6193951C01E99,
+0xB952635C82320DE6, 0x49901D2243E44A99, 0xF3679BD0B72B1D57, 0xB29FF6239A76C323,
+0xDE715B97A031FA0A, 0x00000000039DBF33, 0xAA7BC08BDD083D19, 0x29BFAC8717208182,
+0x1757159FB311D4F2, 0x63789BF7E882553C, 0x33C08D0861A6133F, 0xA724C2482D8BE79C,
+0xAE75455F8E05DB7D, 0x8B54E86CA6BF6C02, 0x4E782A759FC6B17B, 0x00000001EDAF219D,
+0x6D4CAF27059334EA, 0x5E02F3DE57FFADA6, 0x9957EF7343381448, 0x0E6D6EB9BC74D5E7,
+0xFF4235AE4BD1B8A2, 0x565F5873D9866472, 0x21DB39FDF108632C, 0x8FF3C0D10D400297,
+0xAFB9AE424CE12C5F, 0x00000001B726569F, 0x3711B70B29B94079, 0x4B3A892351FF61B3,
+0x6BD8429F9FA722BB, 0xAD55B3A53AF8D8ED, 0x0C2BF9E6110CA6F8, 0xE65F83902B3D58A3,
+0x5177D5CFF6F5C608, 0x650909C22CF9CB47, 0x07FA777F0D060013, 0x00000000CA30761F,
+0x3162123DB57268A6, 0x667B2597E1B7055B, 0xE2104ED388611CC7, 0xA83DD8FB4DEDDC28,
+0x03EED570B8DA3856, 0x0B15FC76EADD0117, 0x945207046E34DA1D, 0x482CA0FDAC8C41B4,
+0xB1FE4B386A8452AE, 0x000000007E5C56B1, 0x37DF7980263D4EF9, 0xF32268EA4EB93496,
+0xF72179D40E8F8288, 0xC1F148F48D7E2FD1, 0xBDCA4400AAE36803, 0x9754D906EB1989F7,
+0x171A810A4245A602, 0x50A792C19142C442, 0xC6FD8E7EBCBD6E1C, 0x0000000143D6A60F,
+0x515FCFF488FE7F41, 0xF323A01544159862, 0xA2D7007B8361E5EE, 0x41AF0308EF19AC96,
+0x2C2AE9C46F2F6BB5, 0xD5F0EC8CF03DF540, 0x7367985A111D672B, 0x13EC318AFF338FB4,
+0xF8972407D6FD0342, 0x0000000254D907F9, 0x5D2ACAB73D521F61, 0x2BD7B198F8C5ACE3,
+0x2F050360F519252F, 0x0904C4E072F6B7EA, 0xFD3C99D35DC75536, 0xCA3A4291C2A626A8,
+0x2F65547815BCAC18, 0x1EBC4AB5FFB038CC, 0x3002BD392FED747E, 0x00000001E5E39544,
+0x8E55BABBD10C4911, 0x06F7B15B80B77A88, 0x77B79FC453A795E7, 0x00C3E00D6D399D2C,
+0x029AFB7330B5A469, 0xD7400AE4CD0B5B3D, 0x56D16E9A450F003A, 0xE86F66DEBE7FDA55,
+0xEC10F8CCB44D6E45, 0x0000000059E17299, 0x38648C36888548D8, 0xDB2DB2CA59A4BB3A,
+0xF162EE55D39C09F1, 0xB14B296DCF9F49B3, 0xA29BB3F1BD193CC4, 0x037FAFA115593747,
+0x3826BA6359AEB02A, 0xA6C4390934B2F487, 0xAE10B4733FC60D1E, 0x00000000D14D4C2A,
+0x3445521EE8B26C19, 0x126E6E68D408C95E, 0x07249BC5762F6DB4, 0xE07875A645A312AF,
+0xC756D600EA271339, 0x6A448DAF3AE66E13, 0x71A2B87E35E7C44A, 0xBC6096845A9B4BC1,
+0x6D195780FCADC2A0, 0x0000000065AF46C7, 0xAA81351F8D37EEA7, 0x0EB4591EF8D63191,
+0xFFD5CB489235BF84, 0x8060236AA26335B7, 0xFD86B7BCC943A4EF, 0xE1BCB30E23F9DF40,
+0x5EEAEDF3BDCCD32C, 0x9D70B69C52D09FBB, 0xB175F687145ED271, 0x000000016F80D5D1,
+0x9C487CE56794DC6E, 0x0D05734551909027, 0x7AC14C40B838834F, 0xA2896116B2AC82FE,
+0x1F06C6377CF63515, 0x6E6E93FF23CB7A3C, 0xE96CA6FE85194554, 0xE133E24F2642F0B0,
+0x3751E8D848B8F45B, 0x0000000147766909, 0x281993D4D992B36B, 0xDB0129792EE18A0E,
+0x99712658898F3032, 0xCBFFA436982C7A0D, 0x0D7B42A332724B13, 0x4D779421209BA87C,
+0x9ADCD62A39701D4C, 0xF7A7749E544D07A4, 0x284A684B3143DF08, 0x00000001E379CAD6,
+0x046F30551B673377, 0x1E3B8E3F82E22DD6, 0xE23B821A325D3272, 0x3C53ED524FFD1431,
+0xA65F9887CD3A70B6, 0xF68408F85EBE0B9E, 0xB003ECF6BC6F3685, 0x255D5A3046AE6960,
+0xAFCFC62E5298B3ED, 0x000000015A039DBE, 0xEA901A3BA3A6285B, 0x3850053D11CA289D,
+0x016C4DC7D9FD04F5, 0x4C5E71EAA15FA897, 0x93ECCBC73B14E51E, 0x818FDB0F62928676,
+0x40A2F2A58BD5521F, 0x9163EB76B5813664, 0xBC3B78543359D752, 0x0000000120981C65,
+0x62F5212955AEE7C8, 0x318858FF94253E29, 0x62B9F3A972FEFC2C, 0x44BDE780EF782A76,
+0x01D9A780E92E8C0A, 0x48676B18059DEB99, 0x08741CCDECCE702D, 0x894E1A4086E0906C,
+0x6A60DD9FD73732A3, 0x000000014893723E, 0xCA3516F9D7668165, 0x6B86E1C114CF2DB6,
+0x1B767A3206D2B689, 0xD2BCD9B6BC1D89B5, 0x28BABEDA6FADA363, 0x30B482204EDF1571,
+0x1F9B7A6F394DFBFF, 0x0EF253ECECE95247, 0x0339D9399C2A6F86, 0x00000002519CABF0,
+0xDC39C46081A6162F, 0x45F5527E92720D33, 0x86832CFE1552938D, 0x15D94FE487BFE07C,
+0x355DCAF447AD41F1, 0x29577BB1FE560773, 0x7D41D4D308958ED1, 0x24670AA7B1BC0955,
+0x452CF90A67C48EE3, 0x0000000208650273, 0xCD450BAB462EC742, 0x4C69C29D7CB1A732,
+0xACFDCD48CB051856, 0x991B77DE45CE572A, 0x5F13F279E926CFE7, 0xF9F69713DB48C7D6,
+0x713837AD7917D7FE, 0x2BE61E3F7F5F4117, 0xC2EDB4BBB5E5378A, 0x000000024186D2A4,
+0x5F5FBD0EC33D88C1, 0x38A59854085FFA01, 0xD4414A11F8E377D5, 0x7C3762A73E67FF84,
+0xEF074B5F3DB89F28, 0xC222383B689B0B08, 0x714CB69502409934, 0x687A42B46D9C474D,
+0xA94B9B69562BF903, 0x00000001CE837E7C, 0x4D330077D1F560E8, 0xDD51ADCDF85F75DC,
+0x5BE90C35DC1D7D09, 0xB2556C3542740429, 0x4FD2FD3FCCB4D748, 0x040C398CA1607A9F,
+0x4A11A07064B6854C, 0xBD46DAD1E797C62F, 0xFE2769EF1C654DA1, 0x0000000081F8FB1E,
+0xD59AA55CC2175389, 0xFE9AC4E55068D24A, 0x4B2F7BD429A9561C, 0xDAB6939142B4425B,
+0x724369DA42011218, 0xF012EB7FA0BC6DB4, 0x01FAE60B20403587, 0x1B93604B78254070,
+0x28248B4FE1E47765, 0x00000001CF4999DC, 0x6E93AE69B34F8435, 0x84D0A7C6745CB7E0,
+0xBBCEACE65486617F, 0xBC6B0DE41375E16A, 0x24907D4C23A11006, 0xBB0EF4F1EF76130D,
+0x27F73DCECB1FA4A8, 0x920D6399CCDE968F, 0x6C59A5361C0BC73F, 0x000000003093A873,
+0x12A9E00EA9E9D3EE, 0xB1A32D1F7FAE259C, 0xD62ED64A93FC68F1, 0x4938793561DEF850,
+0xB164CED4115F92E9, 0x87BAA8794F92E16E, 0xD1DFB6E42AC0F87A, 0x280EF8B126EA0F95,
+0x6D21F892F9C4DA56, 0x00000002558975FE, 0x4CC78B7737B77188, 0xE84E6ED6E6793B1D,
+0x4D4481F7EBAF2ED6, 0x0CAB7B5C7BEA4B33, 0x3EFFFA5A3BD5F410, 0xE7897DDFF173176C,
+0xF3DCFFFDC846C724, 0xEB4E6C53BA3E9ACA, 0xAF0E732FD1F78B45, 0x0000000041B15251,
+0x30B28A41B59C2D35, 0xA3B2653112C21AC5, 0x0E93250BEF2B613C, 0xB834466CFD8BDF48,
+0xBC42906F5784A272, 0xFAE8278D69C77CC8, 0x33AC863DC884C9EE, 0x4E7333B9FA2D4FCE,
+0xDA3C7098A8D60F69, 0x000000026E3009ED, 0x055D5B22752BFD94, 0x75AE32E6706E3A79,
+0x18BF7B79846113F2, 0x75C06DA76DCCB156, 0x5CBB6D4BC43550FA, 0xF3ECD532F77F83AC,
+0x2DE69C6DB213F775, 0xEE3E63668B9F00E3, 0x6BC7364B8F8F52B7, 0x000000005781544E,
+0xBE6AE48763C10C85, 0x2E11060BBBCA0E3E, 0x0AD24FC607135422, 0x505C938AE06ECD79,
+0x82BFF582F3347E6B, 0x8D6C3D5E8A017338, 0xAB6F43BA8EF5B7E1, 0x24638FBB9FA267CE,
+0x5961CD52A4CDB363, 0x00000001496C0676, 0xCED45463D534F345, 0xA2F2381FF2E7292A,
+0xFDA8B52E12EFD63F, 0xA4453EE25BC94921, 0x06C8FC6CB328F06B, 0xB7A10B3BA7B2B17A,
+0xC4D7DE81BD4D6E7D, 0x4B9C96163D91869A, 0xF906DE110ADE21FB, 0x0000000074746909,
+0x593E4472FD8A60D5, 0x681599B203B616C8, 0x6AAF6F575469C7F3, 0x6EA6CC45C263CDB4,
+0x9A093B8F62D9CE08, 0x086AD2964C0BADAA, 0x486AF5E7E348C9A5, 0xCC28A89CDD4199A4,
+0xA7E8DFAAE2A2A6B8, 0x0000000074B627D4, 0xF2D7E308CE225413, 0x0FA0806A502839E7,
+0x07CCC86F9E42E354, 0xED935F87642F309E, 0xE2C79901756E73EE, 0x05C12F79EB5D8395,
+0x2F67375B64903347, 0xF27085FD4C07C244, 0x4615270460C90578, 0x0000000121320A2B,
+0x890873E5F78ACF97, 0x1A7C0BA93868497D, 0x04028B004A750CC7, 0xA1D3ACDEC400B9DB,
+0x132E7AECDE89B692, 0x8D5AEE965513E614, 0x82218C03F325DE75, 0xBC888E29AEEE7969,
+0x98503681CB5F9EBE, 0x00000001D1A7941B, 0x5688621B71CF864E, 0x4267D9FFE2591EB7,
+0xC39A6E14C5B6B8A1, 0x219F3855E69F44DE, 0x28B83B0BB4CA243C, 0x4FA27C8F30C82A21,
+0x6C6FAAFEE11043AF, 0x4A009FE75BCAB00C, 0xD1B137632A89909A, 0x00000000244C2D0F,
+0xCFD000DCAEDE3325, 0x4B30DB459895ACF2, 0x9C738D134F8D83E2, 0x91DC7A4D1B5DB9C3,
+0x276A73AC8EAA41D1, 0xF76A1574D96881CF, 0xEDBA5ABD1DDB3D48, 0xDB2C0980BB02EA41,
+0xCD90CE5BAC95FBC2, 0x00000001C5AEAA27, 0x7E3E985B277D34C2, 0x7CE22DBC8A5C94BE,
+0x48DF2BF5CF9111E0, 0x0C34F9B942C0103D, 0xA3658CFE2EA74F5C, 0xD65F3B63AF4E2E3C,
+0x279C8DAF2279435B, 0x7352951466334203, 0x43533F4A6338040F, 0x0000000188F32A06,
+0x54FD9FB8674B5864, 0x55A86E96AC668A84, 0xB2120058C489A74F, 0xD1D9EE1ABDF3A84F,
+0xC0522E2B287F004A, 0x91102E4D44A5661E, 0xC982786F91D0E14A, 0x32E571CC361268F4,
+0x151AA39A825CA66E, 0x000000004AC115B9, 0x6A84C8A014A9B9AB, 0x3E890B04D5301D78,
+0x7806AD7969CF3F5F, 0x6921729B8AA3E9DE, 0x2939A27D0730434E, 0x964F3E320B797FFB,
+0xD4E4D10CD3356D97, 0x96F43A198F74C418, 0x5125308807D8375A, 0x00000000B6E45915,
+0xB31F4165D1792866, 0x3C15DF79A0BA2295, 0xD2B0A7B363AF96FD, 0x6F29E2FE1ACA097C,
+0x91007967D2C8985B, 0xB6C6EB5C363DD320, 0x632FA92502EBFA17, 0x53F18FBA146E33BC,
+0x95E0E1C4D1D3E834, 0x000000017004DC39, 0xFE6903775509E44C, 0x7647DC0625D2A4E8,
+0xD61BBCE86F843444, 0x5485E9B1D3D61E00, 0xF3D137EA0AA3D982, 0x280EADDB98EA7590,
+0xEF0820DE2B55907C, 0x90B63403BE03C9B3, 0xCC9A5193744C9857, 0x00000001C7350418,
+0xBDEFE69C557DF0F0, 0x5275128259BF7A6F, 0x8D4FA7E4A586C4CC, 0x20CCF99ECAB2DAD2,
+0x063367C3D545ED31, 0x25CE51AA5C5A4C7F, 0xFE96C283CCA3458C, 0xDBE383513468250F,
+0xEBEADB4EC37BEF3E, 0x00000000C4213B25, 0x19B68C7FF09CDF77, 0x002949011B3F94BF,
+0x0DBFCED8FB735A0F, 0x2976BE3D3DF9594D, 0x4472ED4D7368E86A, 0x4A70994C36B652B4,
+0xB98464ED14CCEB32, 0xBC3258D1920A3BEE, 0xEF71B8848434EC56, 0x00000001C63BA4A7,
+0xEC1DDA903C6E5A24, 0x0117EFFBA4E6735D, 0xF06D104919BF1398, 0xAAAC9AF0212677BD,
+0x49DD8EA8D1A05CE7, 0xEFA3DB4507DC5C07, 0x559E266170CCCFFB, 0x8774E7910939EC7E,
+0x1CF9DA43826440A7, 0x0000000199653025, 0xC4678D7A9B9E1FAE, 0x7FB2EBDD78598038,
+0xCAA38ABB62753403, 0x2C6A7E52B7A381F2, 0xE0E88E519AEBDB69, 0x8F7F516AE5569C98,
+0xF7F91F18CF29F389, 0xE143600250C7BCAC, 0x15E08B86362D01F7, 0x000000007EF3FFE0,
+0xCF06325430D140B2, 0x89A7EF09612496AA, 0xA2A463246C71A990, 0x6949273C7104929F,
+0xC58ABC9D9583B8CF, 0x6825AB72754B9860, 0xB5C06C738BBF56BC, 0xD5D9A8A8CFC31879,
+0xC96936B12391BBFC, 0x00000001CECE25E8, 0x6506F5603DA09887, 0xEDC452DE4013801D,
+0x25A83800377B3614, 0xF6F4DBCC24F3866E, 0xCA39912A5D74D2ED, 0x06BD410177254EA7,
+0x220D35123DD64783, 0x6FD54D56CC3A1B27, 0xEB3F04A89ED5DC60, 0x00000000B32DC474,
+0xA142A9A0C96B4618, 0xD16AF62B17B34C9F, 0x09E555FBC9D2D465, 0x5060C96C845E8978,
+0x0D30D007AD37C0A1, 0x201BAE71ED7D169C, 0xB0E6EA961DDA1A6A, 0x55A2DC840E0F44A7,
+0x92E46D43B27EA556, 0x00000000149B8320, 0xDDB776B68D84B7A2, 0x5F3F932A51359C01,
+0x7FD559FB7ACD0864, 0x14467A46A5DC5870, 0xEB39C0A18E51C497, 0xBB2BF90545155C69,
+0x63FB5188C7FD128C, 0x8E487D9A721ED707, 0xDD60E7D84BA50FC6, 0x0000000092091422,
+0x1F4CC4C07C284F6E, 0x41533DA4772E82A1, 0x150B17AA2FD499EE, 0x764AA2C732D2896C,
+0xC965965718BE4AB6, 0xF293DFF3C1DFB38E, 0xD6D2D7BB67DB9312, 0x3823109393AC51BF,
+0x20ADC3BEA47D8397, 0x00000000F1D7B3E7, 0x5056AA4AF6687B85, 0x998C7D502CED6D98,
+0xF924E3C92C514F68, 0x2473F8EEC5A2E584, 0x8D85B67C1325275D, 0x83C0C9E20EE8F2CB,
+0xE2E3A7B43785D934, 0xC540AB3B1F2B1BF4, 0xC25B9D5C9E6CFCF8, 0x000000010852613F,
+0xCE1CB3CB2308CA84, 0xF758D9846107861B, 0x25AC4205AE502D62, 0x4FF5715A9B82B4D6,
+0xC62E7713218E72F5, 0x4D008B3F7DAA9D05, 0xB25DCC3E1F0B9AD5, 0x17200E3E131F7B55,
+0x0C3F31DDBE59D8C0, 0x00000000D206AF46, 0x66DAF430D78BDFA2, 0x2D1A8654B357E8D6,
+0x2DF3787BCB354CE5, 0xF0993C6B7254EAA4, 0x811AC79D82AF70AD, 0xE2D1E82C074FA7B5,
+0x06339A9EC3BEAAA4, 0x61D543828B259D79, 0xFCE998AA7A67C04E, 0x000000016A695A56,
+0x81F2D740FAE609B2, 0x815ECA7B4E14C46B, 0xBB6EBA692A599CF0, 0x0D54A6E2B888AA80,
+0xDE137C31A0984F27, 0xD2E66E66253878AF, 0x5F91EC1F13B3C35D, 0x70BE2C7BB86EAC4B,
+0x544AE5448E2F2C88, 0x00000001BE48CC8A, 0x05386B683AE15DF0, 0x0427BAC0D68C0727,
+0xB86EFB57C059F45A, 0xE543A50EDD6C2AF5, 0xFB02F6011F3582BA, 0xB045DEC3D7A6C527,
+0x264102AA7CFC4CF6, 0xFD0E2139A8589CB7, 0x288C7EEA42DBE54C, 0x000000004137D807,
+0x0149437FE0D49FCF, 0x97418E16F717CBA3, 0xA2F88294C7B01674, 0x5AD465F40B96C1B8,
+0x9E525200505E9008, 0xE68866AF8F2930E4, 0xB5DA9940CF80DF55, 0x3286245A0A5C5CFB,
+0x2E997FD864EA8494, 0x0000000195453F5E, 0xFFC8FE45D77B1C3B, 0x796DC3648CB6EBC3,
+0xA59148110FDDE21A, 0x1042A6154264753A, 0x9A89847F6E341584, 0x108731207B6907DC,
+0xF5A4420090080B3E, 0xBE21A6EC165582D8, 0xF73B4E2E4D386EDA, 0x0000000187C0407D,
+0x6189FEF732FEE020, 0x0319BAA11BD8A337, 0x961E7E617FA844E2, 0x591D2FB722810115,
+0x8347D9E312429BD4, 0x857D463381DFE826, 0xD19559FF0652ED89, 0xA691A0AC7EBD54D6,
+0x7BCAFCEDEF4E36C7, 0x00000002565F1491, 0x0EDF1807F59EF2EC, 0xB90CB24220E13D64,
+0x556D61CF4F6170FD, 0x012443F97D51C69D, 0x295D5F2429D9A4E9, 0x76351FE2A9D62D92,
+0x627CEDA0765DC7EF, 0xFD7A96A9F5033EDA, 0x1B0D8FE7C30A0AEC, 0x000000006C5758C6,
+0x9EC9FD3A376D8767, 0xF9AB8B6C65C99751, 0xF2E1943A37A239F2, 0x955545E1E347E844,
+0xB0994C5D6835BC65, 0x5D131DBE8D21EEFA, 0x0D7153684EE2ED73, 0x5462A71DB07CC91A,
+0xB1AE6223BE82C641, 0x000000002226E693, 0xE492F47B2B90B161, 0x795C6168F4D1BAE3,
+0xCD07B66C9EAACCF9, 0x36DF914B9DE6E00B, 0x03F37FBB7CDDB38E, 0x43BE7AA0E0C362A1,
+0xB4A29F327AAA755A, 0xC27366148A71AF67, 0xB025B79247D33471, 0x00000001CDDEE2F8,
+0xADF1CB69AAE194B0, 0xCF13F0A016A9B20A, 0x5D04C28D6F1E00B9, 0xF6B2D240A4BFAE4A,
+0x5482609492908A2E, 0xA0C27E8E3DFED265, 0x0B1B825E64D5973B, 0xC7141C0033D16CEE,
+0x307504DBF1D84C39, 0x00000000AFB0D738, 0xF245FCEEA9D8D73C, 0xAC2B6BB09EF8DCF6,
+0xD767395C84798D62, 0xD69E27088ACEFEE4, 0x8DF67E418C41BE8D, 0x83F15169301E7190,
+0xB76FF93B50D28327, 0x451462FADB6DEE96, 0xD7F096A39F464190, 0x000000006A7BF340,
+0x246F078D4CFE7591, 0xC52AEFE6E1F56884, 0x0D1663BD2B2C4E88, 0xFADC63A1C1D475FB,
+0x2D37CD38DB3D5069, 0xBC30A3428272798B, 0xE8C485283852F227, 0x198276A79008725F,
+0xB045F82ED936E9FA, 0x0000000039F1586C, 0x9D047D84E1055888, 0x7014F44A5E2055C7,
+0xC2783B54BFDF0F45, 0x471D1CF0F4BE9D7F, 0x4F781C6D3212F2B4, 0xE6E4AD24AACDC5B9,
+0x629C2F3D728AD749, 0xF352E58FE027E189, 0x7CF41519E0447234, 0x00000001C7794D92,
+0x4C5528120460CE2B, 0x58CC7A92627327B5, 0x8072DA3743C06C4A, 0x2D653DFE2363D8CE,
+0x4FDA035905B6B126, 0xA7DA4BAC8352DE9C, 0x54486AF3C0A76864, 0xD27E32E54747BD2A,
+0x4F36AEBF75631823, 0x000000025C9C1F6B, 0xA43B73D3F101002D, 0xEAFA206EC37F3C84,
+0x8560D9DDE2007C56, 0xDB14975FCB4F8CA5, 0x9BE24B29E4ED2EF2, 0xEB2B2432C3D3B06E,
+0xA79AB30EE3E280EB, 0xA26D27E5C72242F4, 0xA835B6D1DC77823C, 0x0000000091E4086D,
+0xA205475D99A625E0, 0x3BB64496A9DF5756, 0x1308BBD54CF2E086, 0x99895C6B4B3BE0F9,
+0xA404DB7BD643AAE9, 0xCEEF96A6BA1F9C90, 0x3D862BD28D991605, 0x97765D8F3E40CFF9,
+0x852E968A35EEE683, 0x000000009FEFD64E, 0xA88027133F0AF507, 0x1CDDF31FEB43C9B3,
+0x3E24F00F23811E4D, 0x4463E403B9D232A6, 0x775E6EBC77024AFF, 0xE3C6F3AC83CB3AFF,
+0xCCEE41C4FF76AEE5, 0xE909394BA3D59C5E, 0x6AF395932B7A7078, 0x000000024B0383E3,
+0x6780933560CB4C35, 0x6181260948AC8D2A, 0x9A9C94469A532B81, 0x90765FFAC6E1395E,
+0xC456E00783A050BD, 0xA26B2FF20E1DEB8F, 0x2B63D77C070117F2, 0xA25E2DCA40F7D5C3,
+0xD301141F19C6CF6B, 0x000000016C9CDABE, 0x4959061D9533F009, 0xDA2B2F8025981E25,
+0xA522AA500FEE8A13, 0x4B1B6E0B09360B5C, 0x6CE90F7296993E25, 0x8AEF3C18CCEB4259,
+0x734A8E7EE8109910, 0x0F875FD833940555, 0x9E4B8AAE03672851, 0x00000001E6E4354F,
+0x3D5673D25D1E2732, 0x879759E069682C9A, 0x898DDC05646EFD63, 0x366089B8815B776C,
+0x6FCCD83999F7F3BC, 0xD2124620EB6A4B0E, 0xD4AE27E905DD260A, 0xA836601B51A1775F,
+0x09F42CFEEA3665EF, 0x00000000D2C054A0, 0x38090A0D4D159D3E, 0x40F32F44FFD9F83C,
+0xC9BE6D28C34F18E0, 0x7CE16D8686E16363, 0x52660935F7A0D8DC, 0xC35D3633824C2ABD,
+0x6F2E898AADE639EF, 0x7099C4C7F421842D, 0x3548EF1FEECDE47D, 0x000000015EC05102,
+0x42055E56AFDF71B7, 0x270EBDE30B854DFE, 0x19049DF138DF81B3, 0x93DF57C35C456E4F,
+0x8A326515AE3DF7A3, 0x7CB7CD116570905F, 0xC4B8D965E8ACBC46, 0xC656C8696EFF4696,
+0x186785D2A3676E3F, 0x00000001BF9E3F7B, 0xA3AE3BF05BB512C0, 0xC018ECEC908E63ED,
+0x46703CA6A132C57E, 0x299E05A3BA13746C, 0x0428AE4407353F62, 0x1B342DE96938B3D7,
+0xA32C12237FBFFF8F, 0xB51846451C69B075, 0x490E9CD5E15A8C13, 0x000000011F8A38B5,
+0x64EC2AB28C923EF6, 0x020F6F1C84315A6D, 0x9A186E3BDA2B140A, 0xCB7B2C8CB27A5C36,
+0xBA4ED0EE660A456A, 0x6D518542A2A16C48, 0x1242195055BB0D6A, 0x759F4077637654EC,
+0xD3C93F547B534305, 0x00000001DEC8A248, 0x3038B4783358B31E, 0x3B02386A38C54320,
+0x9E4A06A117457AD4, 0xD5FBF8AB67E9A1FD, 0xAE8ADAB865A5A981, 0xC15B2E7C3C57F296,
+0x3E48ACFC579EE13E, 0x83221F0E4CAF0180, 0x563706B4D2CD71B6, 0x0000000106A44CF1,
+0x97992E093AA28734, 0x734BF323BF9AC37E, 0xF6DFACD4C159B274, 0x13A544515642F7BE,
+0x4E95A8E931167A42, 0xDE94D0E09B67B9B8, 0x0D37A419F07CE1EC, 0x631E5956E466A4DF,
+0x39FD212A3CCCC9FD, 0x000000022699E364, 0x75D2BF0A241A655B, 0xF8970A4BBE43EFCB,
+0x82F68C6D1B5B44ED, 0x2F8D5AAF8FFEF27D, 0x2DBD11E2D4187152, 0x44F68A5D717D654F,
+0x6C00E1AC325AFF87, 0x3FC4A656306859C5, 0x4D623FC93FDC30EC, 0x0000000177055F70,
+0x9FB3CA13BB6AA9A4, 0x442646010A630F22, 0x6413C9C025C15CE8, 0xDAB8EFF04F9DBDFE,
+0x41F2EA25C6F52654, 0x19C9A95EA9B408FB, 0xB4CE48F5226255B6, 0x275C7DF19B4FCCCF,
+0x2B5F6C41D921F9FF, 0x0000000121A14071, 0x71424BB7CE6F18EB, 0xAEB801CF797DC322,
+0x545D68BC240A987D, 0x386A9807CBF81CF4, 0x82225CCDDC87B534, 0x523C687B3C15A8BF,
+0x6B8DD6DA5CB4D22F, 0x135BFAA30AAA2B94, 0x4E24DE3AB25086A9, 0x0000000008347C55,
+0xEE0107D7D8A2B7DB, 0xD62E628C5E87C9E3, 0x05D53D8E44365C67, 0xD5704358093DBD6D,
+0xFA120B9D50DEA419, 0xCB1E74EA90E7ACA8, 0xA074C1281B64621C, 0x9E4D45BEFDB1327E,
+0xF1539C5195010377, 0x00000001EAF30DDE, 0x773497D5C2BB094D, 0x19C3A811B4C3A932,
+0xA526101E79B6DD3D, 0x3E94E49AF7515ABC, 0x08EB415EBD68F1A5, 0xB9A74C30952512DB,
+0x55BFAD7B64834379, 0xB1F71F0A237BB855, 0x736201FF3A89C3B1, 0x000000008935F60A,
+0x14227D42D70380E9, 0x656B3F394A75A124, 0x76FA4278CE69C544, 0x7B7E0363B9BD797E,
+0x52DD6EA6B83312CA, 0x76514D741AF493C4, 0x00F56622C13CC13B, 0x5D76585DB7630592,
+0x7972802BCB508B38, 0x0000000105B64937, 0x5CDA0AA74B9D8D89, 0xC18A6B42D381C4FD,
+0x246814A73F386FBD, 0xD8107554FE07CE0B, 0x25BB7088E37560F1, 0x40ABF1D4F7FBFE8A,
+0xD0F9A9DC4A69CCFC, 0x5F70E13A249E27EE, 0xC108A2B38D2CD18E, 0x000000005F6B3C5D,
+0x848AADA1DBA53AF5, 0xF320F79513892640, 0xBD9EF0509ABC82D3, 0xD52D27B40030212A,
+0xC5B04802D3D55E3E, 0x062AEDBF7DF13516, 0xB82F4DC6AE0F627C, 0xF9978681E8FE5197,
+0x56EDBBCA38F4227F, 0x00000000DB65AFAF, 0x21CC2F57FC059DDF, 0xAFBCE20B24C26D98,
+0xF75F08F23E611B72, 0x669A8AC2A4DC7705, 0xE96FD97E504FF362, 0x55D0DF61269E6BEA,
+0xF24C1E5D4EBF8E14, 0x4D779566818BC944, 0x8208DBAEEC2E7620, 0x000000002D00559A,
+0xB13C1C46A7349333, 0x4A11353B0C8B7EA5, 0xAFF001BFA282E584, 0x4D93B9FFC4702389,
+0x1122F7354AADBBDA, 0x88807C2224499BAA, 0x1C63B04751FB2557, 0xE10B971537CD8A76,
+0x13A472A6CA671829, 0x000000014EA2289A, 0x18960C3AC7376BC0, 0x319675636FD5C989,
+0xBCB28DDEE93FE57B, 0x880EB5A540A546D1, 0x23C2A0F185ADA2A8, 0xF4405E8F48056DCD,
+0x522B7591FCD6810B, 0x110C00D293F234DF, 0xBBF3248D4AB148A7, 0x0000000048C29970,
+0x772E453551D53A21, 0xBEBB51CCE35F1145, 0x74B8B6A939AA1251, 0xB2853EBF098B4055,
+0xD5E2CCD3B3C53684, 0x45074E53702DA567, 0xB36B223ED5C546CB, 0x3B3E2218249653FF,
+0x01705E9D247AA84B, 0x000000024D776F44, 0x742BD5E6600DC616, 0xCFD8B81707DAFFAF,
+0x697C7BE26E18AD8E, 0xFEE75E2118E799B1, 0x938F857E2DEDA4D3, 0x29B4A2748725EED7,
+0x215D9E31D3AB137C, 0x67AFF4ABA22F65E5, 0x06986173668FE0FD, 0x000000020FEA2A49,
+0x88A2B0C87120389D, 0xBE4D2A906BDF0351, 0x7D0746B99AA6A0BE, 0x5D4190FB578F7A2C,
+0x557DF747A35C6B90, 0x17802632EBF9C9F5, 0x28538F00EAAFCC2B, 0xA78B7B16B57F9971,
+0xB97182A2B6B3D8FF, 0x00000000FC5BB795, 0x5BFC140065B34964, 0xB014EFFDA42D736F,
+0xB847FD56C75D02CF, 0xA179296DF5E00199, 0x8E54EC5D090A24CD, 0x2D97A52DA75DC0B4,
+0x2B4A983C9F7B1789, 0x8B38AAD896A5311A, 0x960AABC60F580D0F, 0x0000000251DDC3E9,
+0x814C6728413836E2, 0x1B84126F3CF535A0, 0x63A5701D15FD3129, 0xAD80E241D1810173,
+0x67934219FCA3EC98, 0xD8EC7B503975B6AD, 0x72AAC85338F7AD64, 0x4557ADBD50542DD8,
+0x71374B872F37CD6F, 0x0000000257B2C53F, 0xEFFFAA7CDB12A92B, 0x39FD0A001E3944B0,
+0x8E47B5FE21DB804B, 0xE885FCF3E512E04A, 0xE64BCDEE33106ABE, 0xF581798F63D21535,
+0x2D5FBE2132C947DE, 0x7CDE778886A702EC, 0x58F5A013BB499BA2, 0x000000001C3BC915,
+0xC8CE3C35C28B3403, 0x1F6CDFE296519499, 0xB2483BA214D67293, 0xC29DC93721B7FDB4,
+0xFC38951A8E9CBB8E, 0xDF70E548FCEB3D19, 0x9BF1C49ECAD96E1C, 0x5804497CEBA8D6B3,
+0x1DCD2174EED6D4FE, 0x00000001ACA88E93, 0x793A9811F5EA2C9A, 0x0298612CC51D4CF1,
+0x8925E926F9C09FA8, 0xA305FF4C00C6526A, 0x0FB056F2FF9402E3, 0x4AE155756AD637AE,
+0xB03DCD781766F5D0, 0x2F52F86493DC40AD, 0x717080ED8965EC7A, 0x0000000133EE3F8F,
+0xF497DC5C350D6B07, 0x1CB8EDEB4D22A534, 0x8BEB17FEB752B079, 0xB6472BC79AA1CB49,
+0x410F2065D0C0ED01, 0x7E56BEB885B4E155, 0xED418983498B04E1, 0x58912A974E4073CD,
+0x2952967DFBAB5A6C, 0x000000024C1AAA36, 0x04A4A79AC051E19C, 0x7B981691200F500C,
+0xF7577A0846B1E02A, 0x310B33ED11B4B13C, 0xAB50F2C815359392, 0x72B46BBFFC1A5E36,
+0x7193F757544370E5, 0xDB94EC32E914E510, 0x9A61F132456EB822, 0x00000001B2027403,
+0x68843333C10ACBFC, 0xD44E386B182F7708, 0xB542D30A894575A6, 0xBFD177FBB2A8EF43,
+0xFC36D3ADCAAD80C8, 0x28DD9E285B05D637, 0x78852D1D8DAF6B02, 0x4DD6DD3E2EB51181,
+0xBE8418B667BAC1F1, 0x0000000113EA50B0, 0xFFD44B8D059A96F1, 0x936DEB9BD84A4B51,
+0xE077BAD8F37B760D, 0x48204650D9B6D6FC, 0xFBFDEEE0DAAF438F, 0xDE3D396C85207919,
+0xE8B3C89E3C7A2680, 0x58DEBE651E7387EA, 0xAF3F1EFB2EF7476D, 0x00000001AAA620A3,
+0x5F6A57818B362405, 0x1434A71D41F8AB58, 0x30DD2FDCD1B6AFE8, 0x9182C49EFA68E4C9,
+0xDA1EFE4BE2E7069A, 0x95759D017511D6DD, 0x9AA5611A6A6E9FFA, 0x559943C4EB81C187,
+0xC70EEF460AE9D7E2, 0x00000001B4B1AF27, 0x92F26F66E1AD3B18, 0x360F0E94205781A0,
+0x1D26CC3AAB8E9C34, 0xA362B02CD21F10F5, 0x3E3B11E37151488B, 0x226C166AB1370256,
+0xBE870417CDAE26FD, 0xCD64CDCB7FE28A1F, 0x8E62785CAA7EA420, 0x00000000C76130F9,
+0xCD78EF1CCF6F9EA3, 0x8E6CE41525356C1A, 0x0B3F4F957C527840, 0xD392CD90809F11CA,
+0x16572C3B9B99A5EB, 0xECF7A48F1B9DD8E2, 0x217AE608DD8DBAEF, 0xB2E06DF5B5E20440,
+0xB6D4ED3B861678CB, 0x000000018DA472D0, 0xD45DC5DEA99CF33D, 0x51E6A121A018AFDD,
+0x7EAD24AE13D22379, 0xC506D236173523A9, 0xFA2EAEC4CE86087A, 0x1091DA9E73DB2C09,
+0x53F57366181E6A06, 0x797D738F9F15B751, 0xAF1A42AB36EBD393, 0x0000000059C2D08D,
+0x2B0358F1E49FCD60, 0xE00AFD89F34AFE39, 0x03D376484B582EAD, 0x8BFFB75EA34AC696,
+0xF4882EB183878494, 0x6A2DF50194CF1C9E, 0x5AFD17D49D012B45, 0xC37530D564DEC76E,
+0x674F061837E07F13, 0x000000017F6EDFE2, 0x385348F38AE5C985, 0x5ABB4106A01B895D,
+0x7BC4C5A1F6C010E0, 0xCF0B09E207321BE7, 0x4D8C344149FEE108, 0xFE2E4D6D95194229,
+0x9AC5DCC6F24E1783, 0xE3DD121619FEDE4C, 0x8B6F66DE1BC00D46, 0x00000001BAF175B3,
+0x7C920992D268D4C8, 0x70FE18849EB5AA40, 0x7F80A37E02BD4FFA, 0xDDCD8329288FA6D7,
+0x0D1F84FF789AD527, 0x88B480BF26D58DB6, 0x0E0FAF81B65248D9, 0xA39FA103A662BC1E,
+0x7DE795F0B9FC82E4, 0x00000001F0D63C81, 0xE64732886912351A, 0xABA2F2532DD5A1BC,
+0xB77D68A1D74404FA, 0x244E7C10F6D27A84, 0x5835E4BC7E36008D, 0xFB6F133F4C763723,
+0x2F90203C4BC22ADA, 0x67DA8598F0A96433, 0xEF9F27868F7D53D8, 0x00000001BB13898B,
+0x0334AF2F59625DAE, 0xBA333B1532F73778, 0x4D71095605AF426C, 0x2609D7130561E393,
+0x17323CC0E389E392, 0x6EFDB7926CE2377E, 0x7922459B29A5523E, 0x42F1D2D1EC47F172,
+0xC5089323708CFC52, 0x0000000121BDD9C7, 0xB0D56BAE3A241D9B, 0xB0E9C8C8C2A47F0A,
+0x685DD480310947DC, 0xC3F475EC56867CFA, 0x17AB2A210D78E4A5, 0x802AE68FF994AF9F,
+0x16B77C524FFC02E2, 0x580D3F592F0509EF, 0x71118A2A2697160D, 0x00000001FFDAD49F,
+0xED19D19EB4A66029, 0x276F22875A56D70F, 0x21CD217641DE6F15, 0x848F941AAF05F40B,
+0x6414B3967B735F49, 0x82CF0A6090BFB423, 0xF09C03D92E5FB383, 0xB21DC86D26DC8EF3,
+0x6B752A8B9E80744B, 0x000000026A1C0728, 0xEAD379AFDE7AE877, 0x3BAFFE26E542CCC4,
+0xBB448E3828623AAB, 0xCFD6F60D6028E599, 0x610EF26F80FE334D, 0xEA006689551A5DE8,
+0x97161B2EAE5DBCFB, 0x9DDDDB67038ADA42, 0x60C7AF599EB00E0D, 0x000000015FAEC579,
+0x35498F9F20595F86, 0xAEE0211781CE6277, 0x88F4DADCA0DDD1A0, 0xE57A7A0F7C8775AF,
+0x1D2B5F054F5829AD, 0xA7548A41471B666D, 0xA3A8EC609F868F63, 0xDBA0AA1234B90349,
+0x6DF910537A4A0A20, 0x00000000F19388E2, 0x3A9623777C6CAA99, 0xB7ED400E8AE7D36C,
+0xC1DCFE4F6991F108, 0x3020AECEA6D86A91, 0x9485487EA36CBCC6, 0x0B3DD5E13E820D97,
+0x8DD1F0FD20B0B494, 0xADD9868D12185D4C, 0x46E7BF34D712901B, 0x00000001FFD78C90,
+0x4482C171C383676E, 0x6DEF184FA0A30035, 0x101DB389B4F5820F, 0xA840595A8D7A6C29,
+0x72B124BF2A32CF6B, 0xA43DD05429AAC574, 0x830847E86FE26957, 0xDD6AEE07C8ED813C,
+0x780B7074D837FF93, 0x0000000230F4439C, 0xCD524DC8F880375B, 0xFF5E36EF5E5BC5BA,
+0x52A740FCEB56D15E, 0x64FBBE25280FBAE5, 0x0EDF520FB1B0312A, 0x137470E705156306,
+0x199726C1051337C3, 0xDD4E3340D7871608, 0x5FF9EDDCC36AAA68, 0x000000017B815F74,
+0x72759086E8CB39A0, 0xD9FBE07F3683F579, 0xC61B5864DA4549AB, 0x46EF520799F58FB5,
+0x52DA0B6439CB4F25, 0xF5AB0393BEA7C216, 0xD988BE4BA84C4640, 0x92D8574B780C6E2A,
+0x05F39F87426B2029, 0x000000007684DBD7, 0x526FA00E1DE5543E, 0x06B512C69E22BDF6,
+0x6ABB6F15A6B36BBB, 0xAF885D6B178DA24A, 0x4DEAD722438E223B, 0x9DB989BB514290C7,
+0x7FA75E0849B75DB0, 0x0287AE058EF6C8F2, 0x3B558477491D980C, 0x000000012DDCC92A,
+0x600C50A877D09F37, 0xF66F0059CDA06EB9, 0xFFAC3D292945DCD7, 0x3D13A52189548EB3,
+0xA014B00C13A08D70, 0xD0A2837E4DDBE1E8, 0x1FCFD45F804888FD, 0xD1EE066F2610CD91,
+0x4112514AB7BBC456, 0x000000015C5724A7, 0xD48C336941723E24, 0x52E752B1F6A22C79,
+0x1593EF5FCC6AFF04, 0x4510A1218D78007D, 0x1B211E33C657D4FE, 0x7DD27BAC1B825232,
+0xA5AC96714EBEE3BF, 0x43876D274DA01B46, 0xBC982EF90C654679, 0x000000005B822709,
+0x849482E24ADE368D, 0x4C0B6881D4BB558E, 0xE74E223B2661100D, 0x09F6A15466E19DC1,
+0x53BFC1D343DD58E6, 0xC10FDE6A8F763D36, 0x2212E99C3DBF02FC, 0x06D52E37B7C31C9F,
+0x6880E55007F2ADBD, 0x0000000231EFCD82, 0xE8D901FABAD5A9CA, 0x0122732360DF997A,
+0x7222155E8B5B6442, 0x9D4B7CC6CB19420C, 0x8014713BA0AE9CEF, 0x114FD374A92096AD,
+0x75FABA5091704057, 0x66D24748864AD006, 0xFBAE1ADEA46433AD, 0x0000000069FDCCB7,
+0x26B1FB68C5B43811, 0xD6FA50DA3C35BD08, 0xDE62D1FBFD35EE0C, 0x7EC73314018AFD10,
+0x9207793648E9156C, 0x1C78C8ED5CE446D5, 0xE7FC2C9BFBA2CD76, 0x1AED5CBA779F8E5C,
+0xDF42FA4F5A43D086, 0x00000000D102699D, 0x088A8CDAD67F0EDF, 0xC84F03AAB440130F,
+0xC46CE0567294F5E3, 0x4865CD4777D7C84E, 0xE10422BDA8156800, 0x68E842CBBCFE0C54,
+0xA1CA9685CB5D47D1, 0xC0A10745B9E0872E, 0xE3BD441957CA7072, 0x00000000A006A6DD,
+0x32C36CDB1862A55B, 0x88CCC86241B1F06A, 0xA13BC0DF75C1B6E2, 0x4E667E316713B375,
+0x2B024EEA11DB643F, 0x1778CF18BF3C50F9, 0xE967211106A0B7FB, 0xD1145CF1A1748FA8,
+0xC576469098CFBF57, 0x0000000119B35C7F, 0x8575253190A10B23, 0x898AAE36C9BB5C09,
+0xBF1400EC932EAA1C, 0x8E5DB12BC547DD1F, 0x1810BD3448E3E39E, 0x91F762B8FA495F37,
+0xC842658B94AE3CA4, 0x0C5D357F8A112651, 0xE55035E4F5BD4633, 0x000000000C05D650,
+0x0DE6DC01C27997EA, 0x91206BD00A3C377D, 0xC6489AA5B680E570, 0xDB3B2668BBE0AA67,
+0x391BBF63CB65755A, 0x2236B4909A54AAB7, 0x8E9376F5355E8710, 0x3E0A49CD06410276,
+0xDBB1DCE525F78403, 0x000000016FC66360, 0xF718F060742C6453, 0x5F81B8FD4A9F9206,
+0xF698FC9E48404784, 0xA0464509ECFD240E, 0xBE3F20A8AED8F9C5, 0x38A74115399D3EBE,
+0xEB916DA2F56B49EB, 0x300E5E2262868311, 0x44641B8A83C812C6, 0x00000000CBE2E350,
+0x173E2670EC2C7361, 0x90F4A11A85AA726E, 0x16CB5CFEDD8F1775, 0x8AD457C7A90A72B5,
+0xD692AEC8211F7E5B, 0x0D0566C4D5204542, 0x598D0AD5C7AECCAD, 0x626941E2A27CA325,
+0x20F8103B4BDAA287, 0x00000000DA49ED34, 0x17ADA2855E59BD10, 0x8AE7FED15B35D67C,
+0x36A930AAF25A9CF2, 0xC2DF74199A56D290, 0xF513B1A2EBC3EEA3, 0xB74C2092575BF9F4,
+0x5090839A42630698, 0x0168E8165FBC4134, 0x0052891543D51A1C, 0x00000000CFCFF94D,
+0x9C354B3D20CCE6C6, 0xC5F7FB75DB77D8E9, 0xDDDA64B2EDB0860D, 0x9F7E3052628DDB71,
+0x1A157BB5BEFDC8BD, 0xABAECBEBA75EECD8, 0x3E204ED4EEFE07E5, 0xB12449D171E289D7,
+0xF13240CAC7AC2D56, 0x0000000139FED7EA, 0xF566DC0A7BBC7E07, 0xAD2FDD9A469A1B10,
+0xCB34184193565384, 0x84AFC584C7174434, 0x7028FD22BD9FA4BB, 0xFC2954C9E8E6BFC5,
+0x42C325DDEB3CB2CD, 0x0CAFD1150EB1D0F8, 0x6EB787D024214088, 0x0000000096FD3D93,
+0x0EF4FAE604280793, 0xCD1D22B54751B035, 0x8FBCAD4F73992CD5, 0x807798749C017F2B,
+0x47F65476741A521E, 0x7455CAC63E7A4AF4, 0x05033FB51C48C966, 0x4F5C9A7DF79667FC,
+0x228F97691C438486, 0x00000001A58CF151, 0xA47B1F9161684164, 0xB7EE74F3031623A3,
+0x33D1E2943597BA6D, 0x5DEE00762FA8254E, 0x8EFA0B16D1CC854A, 0x2B4CA6D442B4C8C6,
+0xD9AFF5936B495133, 0x70A8288B878CB73F, 0x3616E741277F5197, 0x0000000003BC1B3E,
+0x252DB4EBB4A27265, 0xBEC19CC74EC32D49, 0xC2BEA1831985AC80, 0x51B9B1E81F6194DC,
+0x3276D92CB928898E, 0xC1ECB67DCFA1A773, 0x49FDFC1012E87609, 0x0C62BC3D9BE99A8C,
+0xCE4E1B0816A58B2A, 0x00000001C5DA7B10, 0xE61F6D3B1E95765D, 0xD62BFDBFF3280A32,
+0x57DC24FB0501CC47, 0xF0428C110C7B6DCD, 0xA1E523A0F6A2147B, 0xE3FFF11FBDC796C0,
+0xB6CEE237AF804F05, 0xE3243BF6928008F3, 0xFFD78DF3DA83834F, 0x000000022D8E76C5,
+0x0A40862B13AD9AEC, 0xDDC85A4220D5968C, 0x21FFE5C9041ADA78, 0x84151A2BFBBDABC4,
+0x36C79E2CB35D2327, 0xCA09C7A77DDADB8F, 0xCE714832B55DCDED, 0xCB3712C025A3BA41,
+0x9F2AF4895B12DADB, 0x00000001CF9DD78D, 0xE5E5D3020503E766, 0x1DEE353310484E32,
+0x14FBA994E74269C2, 0xAE5448386C2C3D30, 0xF925601A1DA9FB6D, 0x7FCB06CDB00E60DA,
+0xBE966082411F33EC, 0x6FF0C4B919BE463E, 0x63B4A9BBFDA85128, 0x0000000257622695,
+0x7CF328DD6D5EB45E, 0x12205F9AF9469374, 0x79682E4EE0F06440, 0xE9D55884F8CF620F,
+0x6CF959ABD6EEBD8D, 0x764678147B9767E0, 0x3D06252388D10F46, 0x789238BD9A3AFD89,
+0xDB38C118C7FB3E46, 0x00000000677B1CC1, 0x9FD91B18BC43029F, 0xDE8FEE5DE2B2FCB2,
+0x0F2E1FB3E274F1E3, 0x0F6DE008378E0220, 0xE6D2FFDA6AFDD145, 0xA43B14612DFC948B,
+0x2E59033B79F12996, 0x333059699444383F, 0x6C253FED7B9F789F, 0x000000001BA534B1,
+0xA2931083C97F641B, 0x325506923E8A8063, 0xF218AD60CAE9E38D, 0xE6FBC221A42B520A,
+0xFCDC7E8B967F7926, 0x396FD7370A7EC4E9, 0x2CDFCA384B01D7F6, 0x777A3B784C50D41F,
+0xFD781B6384A83DF2, 0x000000018302C728, 0x0203E4E6BFC93D15, 0x81DA76D1C1DE18C1,
+0x5261D8AB2E4C2B88, 0x890818C0E4055EC1, 0x7653957A3A04A857, 0xB2D8DDA4943EB038,
+0xAC8151932EB3C018, 0x0C5EB56D13468E7F, 0x6C8AAF1E9E507B24, 0x000000015B64B33F,
+0xD0B0D8B84F5517FE, 0x465E09C8C1C0427A, 0x8A61FB73DBD45DAF, 0x0393CB28FF00FC08,
+0xA4EB05E03652A596, 0x79663E0DE4C2D589, 0xDA9DBCF280EABF32, 0x4240A467C1DF60D0,
+0x87DA7129C16F92DC, 0x0000000009F04A63, 0x759955B64329BAB9, 0xCB812B073557BA1A,
+0x55729914DF718D2E, 0x73432F6ADA1BC12C, 0x35A39D11CD95B440, 0x210D85715E293438,
+0x99A24878A3BBEAE3, 0xCD137BADB5791387, 0x9D8DD4F8A6787A05, 0x00000001E936F501,
+0xF1160ABE7CE5F0CD, 0xE2DF34B1E08B7AF1, 0xEC1374E2652D073F, 0xB6E78BCF0BC4F64C,
+0x04D8705A3663FE61, 0x0FD7EA8E223C530A, 0x887130CA104CA7ED, 0x7F08D906F4B68F1E,
+0xD67661C58075DC46, 0x00000000C549FC8D, 0x24C4B9EA7CDE018C, 0x4F4BF0031587B567,
+0x2E7913A1045BD5AF, 0xDF4335C17D3F7532, 0xB09407C0BBA64E64, 0xCFD0349CFC90FDB3,
+0x3C79571A878C56F8, 0xF062BB62038A9C39, 0x1DDE9F66D7160730, 0x00000000C52CB48B,
+0xF864FF0B1CE1F751, 0x799391554D4C3ABE, 0xADE683C4D41247F9, 0xE6470697CC857E13,
+0x8D273CE301B68EBA, 0x6D736479691DC923, 0x224793E08E7129E8, 0x537719B34233E9AF,
+0xA72EEC0F4E942D9F, 0x0000000217BA9D3C, 0x0868707C8FD3D826, 0x9FFE23D1AFC6B87B,
+0xCDF8197983D9DEA8, 0x3DC09645F6F2239A, 0x7F561D0910F15E02, 0x511902517875EF01,
+0x5B6F860D3BDC6F6D, 0x251BC6786416BF99, 0x211C4D7C44E138BE, 0x0000000184DC7C11,
+0x19EDBEB5419EBE92, 0xCDA540D4054D36D8, 0x35258DE27C4F7047, 0x5E0B2E3A718E84E5,
+0xA4F8A7A8535BBA75, 0xDF273A174DCCD578, 0x8C1A545AC88EEDB5, 0x37891C9CD36C4D32,
+0xB264E628EBB40C89, 0x000000011BCA635E, 0x8EB9094CFBB90FDD, 0x527F0AFA871F1F74,
+0xCE304F2C5DB76575, 0x5615B0C9E4BBA213, 0xB1F0A339E1A8D49A, 0x1637D2CA3FB22B23,
+0x2CCB42984264BBB0, 0x710A068463E9EB28, 0xB21633A0A9C35E62, 0x00000001268E8EB8,
+0x4D194B9B82CEE2DD, 0xDD2BAF4AD848556D, 0xD9B45AE223B9EE0B, 0x388D9F07E8DEDA0B,
+0x812508D98E8BBA0F, 0x74DA47E43DDF1A87, 0x7573F56A39CC52FE, 0x65A3181227557284,
+0xF7A1E0AAC2EF9138, 0x0000000173279A55, 0x3FE22DB3E7B2DACB, 0x50CFDD21C859A40C,
+0x0243AD455FCA12C7, 0x390DAECC26532762, 0x2533A0F4CCF3443C, 0x265B73D6DB1443DF,
+0x9801B3744C218F69, 0x42739A9D43097747, 0x9A2D43D26E300818, 0x0000000149518097,
+0x009C849F8986E252, 0xD089D859ADD79034, 0xB272D110B47A66C1, 0xCCFE404D8FE1A5A9,
+0x0FD215AD404D00F7, 0x5A393DA598956AD0, 0x75F11BD8BF26F9AA, 0xA37B8F9A81728AE0,
+0x17E50DF10CC1F80A, 0x00000000D24DB342, 0xB3AB34ED8E1C42DD, 0xC335AB1709D79ECC,
+0x7DBB9AB7FFB337B8, 0x169441EC30B8366C, 0x7338990752719734, 0x3727A0CDBAA9668A,
+0xFA21775FB70A306D, 0x7C9314EB2C2F0FB1, 0xCC8A76C2C5C8E7C8, 0x000000013B470BDE,
+0x93D360D7345515E4, 0x5D5558750874AC75, 0x1A9FE1B05DE18248, 0xBC4E9272416FD610,
+0x090EF2FA3C2F0309, 0x314BF6CDC7AD7B71, 0xAFE27D7A9EC3BA6B, 0xB00A33707948F5EC,
+0xB73EDB38F6318FA6, 0x0000000113EAFFF2, 0xCA8F544F87FE37FC, 0x48351BFF0A7EB141,
+0x9B4CDD7277C0BE77, 0x529CC3DAC5FE514D, 0x7BC2E45DB15D91E5, 0x6A6AFF081C320839,
+0x121B9B71217C49E6, 0x181F0CD75FC5D535, 0xBDB3A1D93D9D48E2, 0x00000001D09095D6,
+0xAD8A9F8EBCEB7E09, 0x3FB4C25F7EF9F07F, 0x4867A59E4494CC4D, 0x009BF6345D3105A6,
+0x63399BEAAE3F08A3, 0xE1F712800AAB72F1, 0xBF33BE29C29FA03E, 0xBFC12CC89E7C8773,
+0x17D40FD3337AD239, 0x0000000209D6414D, 0x3F9DF72749254CFB, 0xB1E9D65EC55DC2A9,
+0x3B4E1E1B1B12B59C, 0x0866A51277018DCD, 0x4233C6841025A863, 0xC0E09D1D306FD8C8,
+0x5AB0374A59328FAB, 0x6A455BA25824FBE6, 0xCC1D07470911C7E9, 0x00000001B6EE79B5,
+0x9C5509E21044B1F3, 0xB8F0B10490686662, 0x98DC90221E812A53, 0xE9A91F5393A73BB2,
+0x4142A1B9EAA1FC3A, 0xFB64EE28D9579C4F, 0xD658A578C73C60F2, 0x494181FC289773FB,
+0x428ACD7A9F7F4878, 0x00000001DE9EC671, 0xAD508C6F2BC1417B, 0x9D5F8508636329B6,
+0xE385D4E22866FA76, 0x66414187D3B5CC96, 0xB7278D125D38BC65, 0xC58819CD3E730F5E,
+0xCDB361210CE51F62, 0x563BF80E508FEA99, 0x406B71AD72DB1047, 0x00000000F648AD69,
+0x375177B7BBD76691, 0x3AB1C860D5C88D9A, 0xB972CCB261DF531F, 0xB7BAF7171445DA2F,
+0xFCFDBB62879664F7, 0xC4F593A33670CC7A, 0x2D581511FC996B1C, 0xECEA9373F97B181A,
+0x5846638A6F2B5117, 0x000000026EF0D49E, 0xB19CB14EBDD294B6, 0xA7DD6A4071B5EB88,
+0xA9FE4FB9BAE5F0A2, 0xB29119C626439E4C, 0x2BB3C6D6F49CD180, 0xC3B2327FC6AE9FA5,
+0x1D49A650D2ABF10B, 0x24E659547DB33907, 0x30608EF770310099, 0x00000001AEBCE8D2,
+0x35FAFF84D7864BBE, 0x849F5AC836DEAEEE, 0x141A8EB928B72754, 0xC04CB4BB82771DAE,
+0x8608EEF6BE8ABD5D, 0x965A8E25A2792769, 0x4FBCF0A169CB488D, 0xA364081BEC87463C,
+0x6C31D40F745D5115, 0x000000000A691159, 0x5F81D43F3C51742A, 0x3CAFB1ACE92ED5B5,
+0x34938E329A657D2B, 0x352C3C7F08A866F2, 0x4653BAB4CEDFEF0D, 0x341154E46D48C978,
+0xD548D1662BE93CA9, 0x38FF8AB888BA3285, 0xAE2149B2EC80168A, 0x000000001D03768B,
+0x7148F04E4F73359B, 0x3CBC5A9920C53337, 0x8DD663173E89EA31, 0x847D7322063DC94F,
+0x842A7ADE5E18861C, 0x3C3CBBF62D3F236B, 0xE4DA70E4F05D5444, 0x3CA16992CF56EBDE,
+0x9D8DC95D1A58ECFC, 0x0000000079A3B4CC, 0x80ED23B77CA45986, 0x8A09F1E5F9614CCD,
+0xDB2E1CE7AA07E1E0, 0x52BDFC88D647A3D9, 0x78D1A2B9FB11F92E, 0xCBEC6FB0120B263E,
+0xD75DAD7B5D6C7390, 0x29D04A4152C58928, 0x9020B34960DBE9B3, 0x000000007357F271,
+0x60C2C45216EE3A2C, 0xB5640DF13A25D344, 0x5F11B287352B08C8, 0xCD2CC315B5A564CB,
+0x313394238B1486E0, 0x49B831A8DFE1581D, 0x1057300E0BE4BD9F, 0x6D2C3C8E5E19F4CD,
+0x1DC96F9FC57E35BB, 0x00000000D25B8CBC, 0x822EEE4816E2A899, 0x102437642BA62A91,
+0xCFC178E26BF12F14, 0xD3BA64C4FDBBF67B, 0xE6B9880CDF4B980F, 0x8DB1A79FD32C7BCF,
+0x270C117FA4105F6A, 0x782BD4B5D8A1DBCD, 0x7B35B56EAA167DF8, 0x00000001F4516F34,
+0x47BFA3372EF3148E, 0x23098EB0F8CD819C, 0xF3068D5CE4BDE95A, 0xB7A0BEAF07E107AC,
+0x32A14001F6A02551, 0x4904BF006DB6A54D, 0xB1FDD5CECDABB65B, 0xD1784FA1C9E3FE38,
+0xC57A7F3E3BD485B5, 0x000000026DE0F8FF, 0xF58654EF9CF3A3FD, 0xB776C96C6265538F,
+0x68B2D5DEE3EC1E25, 0x315270FE7FB22ED5, 0x1C230B4773A6C029, 0x004B5416768837F6,
+0xD9BAD2ED12825EC0, 0x211627261015A86E, 0x9B34A36D2A141558, 0x000000023E914B98,
+0x5372ED2AC613F8A2, 0xEE1718B9AB87182C, 0x5E5B03814564DC49, 0xBD7FE7AE2826DF7D,
+0x3C30E730BAEE2E13, 0xAE76F9D282BA867B, 0xDB056FBDFD7B2CDE, 0x8B8E4674A95AC29B,
+0x723BF4F77178AF8E, 0x00000000E6CEE89E, 0x0FDFC3E1F47CBC0A, 0xCBC953BFA5113328,
+0x6E6864EDAFA7FF2B, 0xFB429204E2C397B2, 0x518C3E97DAA08198, 0x488BC39D5602F9DE,
+0x63C59F08768A690A, 0x7AE8B5666521745D, 0xA6ECA4F63C6249E3, 0x00000001B683742E,
+0xFFFFFFFF98F33719, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF,
+0xD3CDFFFFFFFFFFFF, 0x63DE8B2B81E935EE, 0x909DA70B616C258F, 0xDF9F90E440595348,
+0x6E270E53CBBB294E, 0x000000017361BE04, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
+
+// x(2^i*QB) for i = 0..(OBOB_BITS-1)-1, where QB is Bob's fixed generator, expressed in Montgomery representation.
+const uint64_t Bob_ladder[(OBOB_BITS-1)*2*NWORDS64_FIELD] = { 
+0xF586DB4A16BE1880, 0x712F10D95E6C65A9, 0x9D5AAC3B83584B87, 0x4ECDAA98182C8261,
+0xAD7D4C15588FD230, 0x4197C54E96B7D926, 0xED15BB13E8C588ED, 0x3E299AEAD5AAD7C7,
+0xF36B25F1BD579F79, 0x000000021CE65B5B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x48A520C31C801ABE, 0xCC83F8BED969C221, 0x0664FFA1BF7C6CC8, 0x6597DA8B77ECD74B,
+0xEF4AD1DF9A502F2B, 0xCFB7D846209C8A82, 0xAC47BA18CA520093, 0x635A97496B841763,
+0x3ADF15C997E43B57, 0x000000014EB83C3E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x72BF0087E7256C36, 0x9B09ACC09E289913, 0x22596BD577DD0720, 0xAA5E304A5280A773,
+0xA7097E85E70CE0A7, 0x4C9D2063282C86C8, 0x8BF455783659A514, 0x4B24FDFF27D37E93,
+0xD6A962BE561AFA49, 0x00000000CD6CDBC1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89FDB59A195AA807, 0x45F852FA679C00AF, 0xD8BA7F4070F4CA47, 0x5A5C3CA041A72EBB,
+0x3FB91DC2E76563B3, 0x02888C501256BF23, 0xC0019000B42AF3FC, 0x34D4342A0018C293,
+0x4283C62B1795DFEF, 0x00000001B8CC83BF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0DFA5704FBA564B, 0x4A8B60C5DA158FF0, 0x2CA8A9CC920945BF, 0x3F58D684FC313D30,
+0xE4EF899927108D91, 0xE06890E8D0A5F35A, 0x387BA8A3A3D8D90E, 0x9229AD7C34575763,
+0xAB32CB66608114B2, 0x00000000457FA9B6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3357F7C810436CDF, 0x549FD4512B9EF8A4, 0x903C091996F431BB, 0xD0D4DDBB5925E3F2,
+0x78EAF1CB82ADF854, 0xF6A26347092AEE19, 0x608655D576588CBC, 0xE8F6C824E813C70A,
+0x363B6F24636A4DEE, 0x00000000A0C943A1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1F3C4E310ABBEA0, 0x9DD529413E43EB35, 0x52D1CA407FC2D763, 0xBA33D725FA1BB7BD,
+0x53EFF8EABEB5B4BF, 0x27FCDD4AA671F14C, 0x211BABE39F027BA3, 0x92BDE8D0AE8D9178,
+0xADFB87D2E58A7F61, 0x000000014BB4361F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF040ED19F5DE8BA6, 0xBAA96FEC1A0B7531, 0x10BFDEB320F78182, 0x810F7F44EE324758,
+0x6369496942BE3C8C, 0x39D63812D242E81C, 0x0743FAF7CE08DEEB, 0x4C6D91D408039584,
+0x9EBFCDF54E7EF182, 0x00000001EF3C0914, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC353D56AFB823082, 0x846D7916CDC76320, 0xF06F033417B54B7B, 0x95324C498E853363,
+0xCCE945790518AEAA, 0x020183A4F18D9A4D, 0xF9571B70F5CFEC98, 0x2CA14BFC52906A64,
+0xF173718CF842BDB0, 0x00000000464C95CC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6047CC7922CC016F, 0xB68B73ABDEBDB82C, 0x0A538B34288FFB64, 0x4B67BBC9B70EC94F,
+0x9DF9EEA363E3EFAA, 0xC4208FB5DF399321, 0x8278BEAE31CC1E1E, 0x47BC4999BE803705,
+0x81F4A4D03F860DD6, 0x00000000E1D5F9C1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC6FD5391E1805581, 0xA03428CA8ED1163B, 0xA5328A0B3325CFFF, 0x425E73D086D96384,
+0xE34BDABEA48C2F60, 0xD19A863884123BFD, 0x56B523C28DA9CACD, 0xBDD0043F91C9EA68,
+0x4C1314FF0217D898, 0x000000022B02FFDD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEEDC506C1B1ECB55, 0x25733C9CC18F06E2, 0x6F386B5D0D4BB1C8, 0x05E5A54DEF1ED7AE,
+0xBEB50140123C30E1, 0x96B1B2509B056EBA, 0x08F94820C9EAF71C, 0x85F3E424821EB06D,
+0x04551CC6D56CA00C, 0x0000000004031FC2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x342372E16B5075E9, 0x2690FA5D84F94BB2, 0xDFA3272D8B41D1CB, 0x2091FF888ECBA412,
+0x675BDD61261868FA, 0x3810FF69D3B0A2EA, 0xF5CCF6BD28305005, 0x7CF95A0AC2A07FD9,
+0x9B9DD4F92425B44F, 0x000000012EEA4470, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32C366E51ABEC563, 0xC39BB847111FA0E3, 0x788DBAB5C503D24E, 0x3DC4BF23943BC121,
+0x52CB4059B6E9BB0D, 0xB7E07DB6E6E368DF, 0xE235BB61B1049A80, 0x72300C169819B57E,
+0x146A51C3ACEE677D, 0x000000004FEA54F9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED2713A1CB009EC4, 0xE76EFDA840361B1D, 0x8CC6199E1499085A, 0x035B0BF0F001999C,
+0xEF4D4044B3174CA0, 0xEDF8AF7809F3EE60, 0xD37C78F4F1EF504D, 0x99F4A93E02A8DB21,
+0xE854BB31C4237F73, 0x000000007518D4CA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2F3C8A673AB484DA, 0x9A86F1CA34F01B12, 0x33AAB494F8EB7D06, 0x835081FEC8432351,
+0xFB31F9A8819E9D32, 0x5A2D6F3A054FC5C2, 0xC80103CF5E1F7C74, 0xB899DAD46B52C0C4,
+0x30C44005265924C4, 0x00000001AB970F7E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB86B58CF1AF7DE34, 0x2159AEE431067A39, 0x1DB5B23BE57C5EAC, 0x446C6594DC67EAD7,
+0xED9A27A10F8B32D1, 0x100DF0EF27AAEC12, 0xA713F67583DAF793, 0x6215010588F796EA,
+0xB6E096CDC27CC865, 0x000000023F843CCF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x68826FF0B79012CB, 0xD5F703927A7EF47C, 0x6C33A456A214AA35, 0xF7E918C0DAF4F6C4,
+0x943ED7FD7D90DC93, 0x483D619823461744, 0xFEA54B84B7058ACF, 0x63E8AF922D9FA190,
+0x69777C62A176A7B5, 0x00000001095C5D01, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x57141726A69FF017, 0xE026BD9C6F0F2F3A, 0xE402B1FAD338EAF2, 0x0B05D7A909CC91E9,
+0x6F5697A506E5233D, 0x59AB32015F07321F, 0x0CBD8CEA4E07F0D6, 0xBF64AD11F8DDFF42,
+0x2AC78935B1627CA7, 0x0000000242858772, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x09E7218CACA7EC27, 0x006ECD53E40C5806, 0xF1D29AB5AF87D490, 0x9A509B4F303551A2,
+0xF5F1885FEE7E5087, 0xB4F3DA3049400488, 0x9EBCBE160C16B54C, 0xE58AD3D04C99CCB8,
+0x1DD2B02E2C9577A7, 0x000000022C30C4F9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C4AD7735C5DE88A, 0x2EDC66E8FAB33062, 0xC9A1AE79A4349D6D, 0x5799C803318651B9,
+0x1EF96F8BF8D75FCB, 0x617F23835D953D1A, 0x1AE20C7A59023AC4, 0x048C741FA91C52E8,
+0xC34D2412A0D07441, 0x000000015152B7E7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x18CFBB3D5FF71359, 0x483BC36772A26B10, 0xF6C128333549591E, 0x385A94E2C949E4CB,
+0xFF43898EB30DEED1, 0x1EB0DA5E61AE835A, 0xC5D71C9967BC567D, 0xD3DB03386AC74D71,
+0x1FC93D79E3C7747A, 0x0000000241F49B92, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1F9342DDDAC76E4, 0x546DD670A3D567DC, 0xF193E2105573DF64, 0xACB9CF65B3C08F30,
+0x0BA2128226FB9591, 0xC7A0DE45567FB785, 0xE121B434C0E3BC8E, 0x9A9B284A098CA1A3,
+0x0CEB958ECA4C1FE3, 0x000000022EC45EE3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4253B07A4C45E755, 0x03B1E42B76C987BA, 0x504AE37C38B8AAD4, 0x985AE9C80B3E16B8,
+0x807D59F451C8E63F, 0x264CB1D832393225, 0xBB1B8A8C41844E2D, 0xF2B6B935DC06A2D8,
+0x8A0AA284D1BFF9D2, 0x000000022C3BF8C8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA9D4E189B1AF63C0, 0x24CD395CABD71806, 0xEE4E8F618143C43E, 0x1262F2B01B0FE2FD,
+0x057920FB0CFBF122, 0x743E5E0B64CB9ABD, 0xEAF02E31530755CF, 0xD23C739C6D151828,
+0x41F21B97DCCB7882, 0x000000012F4FCD73, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA3CF666ABE0EA628, 0xD9D6647DC8F31593, 0xF2E5FF8E49EF3A62, 0x071FEE321EEA2942,
+0x0CDB5E2C4CC28D88, 0xC57C52925987C9E8, 0x7F8F23A0F62D6355, 0x28686CE7C8A56581,
+0x394C9749303EEB66, 0x00000000786C0E22, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA18490AD2DFC95C1, 0x0CFED65F88C83B6C, 0xF0922C45F094B914, 0x28532B75CD0A0FCC,
+0xFF04CAC3B15A1889, 0x265FF74512568552, 0x185962AA05A7D20E, 0x6DA62061BDAFF2DD,
+0x23CB1F7FDE347472, 0x00000001FFA522C8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6B9C92E41E5C072E, 0xC7302AA820C58CFD, 0x96F65F99CE19E3A5, 0x2DE8BC43C44ADA4A,
+0x994323C6D3C82A41, 0x07D46FC87B7E5084, 0x4112349A68E80F13, 0x52D23A09BFF2B42C,
+0xF6635631894EE998, 0x000000009BFB68A3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x353BCC9D208BE7D2, 0xBF4CA92030BAEF2E, 0x1502D0DD5D730B73, 0x2A9C28A2BACFE4F0,
+0xA63D3FF53AA6E9EA, 0x3AD8A0AF08454F58, 0xDBD6764CC254D5CC, 0xD0D428EAFB477AD7,
+0x4E9433E36F4DDE11, 0x000000026A05427D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D74B6B290948A87, 0x016F93A181B97B62, 0x20AC1DA5198D8254, 0x7395FAA2F76AC007,
+0x96F4B4039DF4A1C3, 0xD18CF1D3F45808BC, 0x4F0F24F2E79594AC, 0x72C514634085CD6B,
+0x44D872BC4A16CADB, 0x00000001A1CEFFEE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36EA720225D57364, 0xDDB57D6DD1B5F944, 0x1D2EFD2A97A44CF0, 0xB5B1AAFE082A8176,
+0xE76C68545976223D, 0x0D0855E9567E65B2, 0x88CCF8B5EBCBC7F6, 0x63F3BE91043B56D9,
+0x1B1594F502B99B4D, 0x00000002766D2726, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xACEB94BF830C8BA9, 0x94C0256171F1BE60, 0x53354DF95F2E86E1, 0x7B0AE7B6FA6D5E0D,
+0x5F74C60DAEE1836D, 0xEAD64073BBD68C42, 0x9E451F6BE09ED4D6, 0x9A70955BCED2BEFC,
+0x44CCB560DCE896A5, 0x0000000181CA7199, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0C066EC64FA0FA45, 0x4A3B27ED94B4794A, 0x7946776F6F0B2DB4, 0xB7DE7560FC45638D,
+0xD1A946B419913073, 0x793A773924E2ADAF, 0xD4233923BB116D11, 0xFC9C7F0BED78EAC1,
+0x366C5F41E0517236, 0x000000026BFB16AF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5679D02DCEB229F8, 0xBB78B5B0457BFF0E, 0x14DAC73EFE18FD5B, 0x8398C659C1FAE464,
+0xFF182F5BE6310FE9, 0xBE53E7AFF4814850, 0x3CCF075480D494CC, 0xBCA8FE9BDEBFF0AD,
+0x9CFA9D22CFC86224, 0x000000005A05D2EA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9E49C02D8247FF91, 0x1C402195F97F795B, 0x2E1FBB95B599071E, 0x87226245A7EE1678,
+0xF8CE36DE89E8CCF4, 0xBE2A621A0A96B41F, 0x6492257B54627A2E, 0x0ADA49645DE32124,
+0x4FC394BD0FDC71A1, 0x000000019004D393, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF504F8E83D505A64, 0x4B8F5486525222B8, 0x77EB6707A599203E, 0x9A7D8B5304B97D80,
+0xD78B7D14C89A8243, 0xF65BCAF94C512A46, 0x5F7EF42385141B2F, 0xEE66DB7C75DE2324,
+0x64B540CD6C1FE4F9, 0x000000011EE54FD0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x144799153803E5D1, 0x9ACF9665DE2BEDD6, 0xB761D9D21D23721D, 0xEA4DDF99EBF43590,
+0x4F1996BF0AB28DC4, 0xD927D11643AF52EA, 0xEE85E092E52351E1, 0xA348D5F905E6D7EB,
+0xF09AE1B65F415CBA, 0x00000000D9EE8AA2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCECD0295D338C652, 0xB2C2DD2D6D92653E, 0x1F67FCB3938A8890, 0x3CE5C92427627A29,
+0xEE1270ADA0AD521B, 0x2B204E20C6FCCFA4, 0x72BD6452CF148FFD, 0x227682594161814A,
+0x2BE828D4DA04E5C2, 0x00000000CA58BE3F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x118B031B6E662F46, 0x7C6DF00876210661, 0xCE67B9403243E144, 0xBCEF12669F25ADDD,
+0x44141ACC4952C374, 0x3DFFB47EC0123041, 0xC70F704E884D4828, 0xEDD39ECE71F3D250,
+0x72FFFBBA3A925B4C, 0x00000001FFEAD5BC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA4DA0F6D90A6723E, 0xA3B86497B9474CB3, 0xB6B1EE251127D8BC, 0xB97BA00E476E7B58,
+0x1C0C759BF2CE49E9, 0xF834C94A2AE93494, 0x37F4D23E982DD758, 0xDAC208CE8AAEB986,
+0x313614368C9732E6, 0x0000000208CF362D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x49EC8443B4DFE604, 0x9CB09218F6634C46, 0x1C759D2BDA1382E6, 0x0A7488298FDC40BA,
+0x09D44B47F8CFF7DB, 0xFFBADD1C76E1FA28, 0xCD021A717659A9CF, 0x8A53A274DF05A4EA,
+0xB992E5B78E7FBB10, 0x00000001282E05EB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3A92133040035C47, 0xAE533BC3F21971DB, 0x45EEAF33AD723AE1, 0x7F33882B7DEDAD59,
+0x61A52C580CAF17E7, 0x8D0048CB147EEED5, 0xF6A283420C0AD409, 0x0E80D8C7A43DD26B,
+0xC2B3FA391733DB78, 0x00000002485BC665, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x358C22C743D327E1, 0x59E7966F57F99DAE, 0x3DBC73C3BA48E042, 0x46079E5C7C398A56,
+0xA1AD01D5047240AA, 0x18E181377944FBD0, 0x5A38BA421330AB3C, 0x6FEE4E79EF78FD0D,
+0x07F5DD38BFDAD377, 0x000000022B6FA403, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2FC84D94C0BBA99D, 0xA919472A94B46751, 0xC22AD66F4E346BD6, 0xD02280AFCFDABC3F,
+0x34E63A3DC6AF20AD, 0xC465F45194C556DB, 0x080BC7B3C95298C3, 0x9EABE04AB37701E3,
+0x479A5CE2298E887E, 0x000000010A4FE657, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x85B8934896B1662A, 0x667FB165E2C0979E, 0x4A15449AAA27FC70, 0x6E34E39F26FBEC14,
+0xD2A3F39E9A554CB2, 0x28987A34AE353AEE, 0x1DDD315FE1C6B3B5, 0xDEE310E7F88D2859,
+0xDDA98F00670670F7, 0x000000017FB91F75, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB4189FEF31EEA0AC, 0xD5AB30C59615B3A9, 0x248691CA63B9BEEB, 0x8338F417A19E9D08,
+0xF8A431BCA5EE0C64, 0x1682ABD55D529318, 0x644988BE5AFD4BD8, 0x879C7C2E1E9C93EB,
+0xE493734924E46B62, 0x00000000F54E07D5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAF575C1FCA506669, 0xC2CA06A0D0B19EA2, 0x2296F700A706997D, 0xEFE87E776102B5F0,
+0x9F348ED0755BE7F5, 0xFA91DDE738AEA455, 0xEA6B6A956DC725CE, 0x496CD7D287E5DC09,
+0x1F8B6251966A2A03, 0x000000009DB858D5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBF9A1D66F7CB2378, 0x152660003C67645B, 0x31E144F0EE52BF2D, 0x30D8FA7DF655F99F,
+0xE6EDF1DB42D687C7, 0x5F0F9B0F2D8C0E49, 0x0FE657B3E853D167, 0x80DDCD980D2F5D88,
+0x2B7C3D798CDD3E02, 0x00000000630FDF90, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDAD273F27929A0A0, 0x1BD66DA2D0CF493A, 0xEAC205850EDAD16D, 0xFD0F758DE7F0863C,
+0x4AD321D1C7957E12, 0xCDCED16148E3751D, 0x39823491B4F1E212, 0x34D118598C1BF431,
+0xA30D878D33CBED11, 0x0000000231BF1F59, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC5BDFDB008ADF823, 0x93A553E225956112, 0xA9C2B36BA910C999, 0x2EE63C36074F14DD,
+0x7FF20BF2F077C2E3, 0x9230A9EB862DB51B, 0xEC44EDD3DC0FA693, 0x87780E5D1D54F8AF,
+0xC6A905CF060B69B9, 0x0000000054ACBC91, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5579852F94864C70, 0xEDF2376F76BFED8B, 0x80218F83565ACE67, 0xED759A93C451A318,
+0xC878DC9305E78C53, 0x6F378A5B2986A599, 0xA9997A54BB84C7E2, 0xD84847CCBD45D4BD,
+0x6DC4A0447345DB2B, 0x00000000F84870EB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD0ADFF0CA7DD64C0, 0x673DA1B720216F50, 0xC7C44312580ED274, 0x9C4EF989A35E6C60,
+0x704F9F2B0971F475, 0x42E7CF3F18C34811, 0x1CEEE8207EC466F9, 0x813D3C9B36DE8DC2,
+0x49742EBB033E937F, 0x000000012F7F63DF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0519023D74987D37, 0xADB96D6BA2201A29, 0xEEB09AF0FD415DFD, 0x5F713ACF4DC067F1,
+0x3BAEF7F256BCD00D, 0x5900903F25EBBBFB, 0x558EBFF9C6E0ECA7, 0xDFF0551902DFD18E,
+0x584C0D6EEEFAA076, 0x000000015C0665FF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D5704DA6907C5F1, 0x33280B73CFAFBB88, 0x79F7D4C3198CA2D7, 0xF6042073BEBF2BEB,
+0x4CDD7E7DFEA0A685, 0xD91C2F5212614744, 0xF03F98BB7CECEB91, 0x4A19BFEAA39D0A87,
+0x799CF8895370435D, 0x00000001F3B49001, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x666BAA052466F385, 0x53629F96782DE71B, 0x79D2B1441C5F27B0, 0x2AE5B8191F0E53C9,
+0x74470720BE596E85, 0x21DB9BBDF3A81013, 0xC9700B8FC67166CC, 0x70CC714964F8D5B4,
+0x64EDB0F213CAAE46, 0x000000019FCDE80A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x775B9352CDD14342, 0x91BC06EF27F92BEE, 0x929125BAB175E6AD, 0x058CC796156E2E04,
+0xAA74B2A45C600BDA, 0x03285A47665AF5B8, 0x8129E021A4996160, 0x0CF784CE49AD3A38,
+0xC039CB31C06125CB, 0x0000000249060363, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAAFB65C7FA8F56CA, 0x7ADBCA12ABF9DF4F, 0x1BF1D5E29EBD9A74, 0x53AFC04E3AFEFD81,
+0x44E78AA77331B668, 0x0329E5A48DDDBDEA, 0x586F1B79A90153D3, 0x5BFC22382765781B,
+0x970F49EB0F02DB20, 0x0000000234F10283, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC962CDC6A0FB6378, 0x82FB0D140C683FBF, 0xF913A657D807D4A5, 0x1AC9EFD418004ED9,
+0x077CAE18E256AEC8, 0xD88C7DEF903BD85C, 0xFEF5A8FCB55E6B6D, 0xEFEC91D789F25454,
+0xEF40A355055826F5, 0x00000000C2D6D7BD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFF2CA25015B351E1, 0x18B497596B57685A, 0xF671B62A2AF4FB05, 0xB1E00BBD3ADBACC6,
+0x7AD0C70AC174A01B, 0x0EA7FBF48A3BB4E3, 0xCE341E30017FE7CE, 0x2C1F027B67628723,
+0x877498F6218C2395, 0x000000013BA2F1E1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x72EF68849A8C5C4A, 0xA51ACC41E13254B8, 0x43EA62DBA4AFD2E5, 0xDB4CE418D2060FF1,
+0xC8EC99030FCF5D8F, 0xE7BEC4C1ED350029, 0xFB462D3C100C244A, 0x999C1AFBCB709C46,
+0xACBB549A7FDB22B8, 0x000000009AC17C17, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9AB1C7FE652E6B01, 0x40559AF7AB43BFD2, 0x50D2AE14DC6D1F82, 0xBEFB72A366F067C7,
+0x690764255A19E827, 0x4D81B9600820B0BE, 0xC0ABEFDECD079E04, 0xAECBDFC7ECE13864,
+0x69A0D6AC244490D8, 0x000000024317F427, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3A4A3798C13C37D0, 0x2EAC1AD6AE5A7FE2, 0x6CDF668CAB5B6622, 0x15612DC9060B49BE,
+0x8A216BF148FA5E1A, 0x3F954AD536C51D38, 0x7DFB1B74F4391E07, 0x7DD05A0AC955AB50,
+0x5232D766859EF886, 0x000000005A458D30, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8655399621E999C4, 0x1BF42531F25FAE33, 0xB0F2DBE6AEBCB02C, 0xECC9991C64DE183E,
+0x33148E7CC2613CED, 0x8107706BE8F4B6D4, 0x213986723101DEF1, 0x1DA3145CE72E3A4C,
+0x98E800B18145FB2C, 0x000000011F3FE86D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD98D97433E2D3577, 0x9EB913D7F10B31E5, 0xFAA8F49BC35E9227, 0xFC3CE6B00A25A84F,
+0x8A78F39DB4D83F5C, 0x803E36B9B74DA439, 0xACA90A6CEE9BA28C, 0x6EA65BADCFD53475,
+0x0AA7264144DD25F9, 0x0000000256659353, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x470D6AB32BD9B1BA, 0xD5C7F49252599C9D, 0xEFE7C13E084FF2BD, 0x77A35A59450F19CD,
+0xE76201B4883FEA98, 0xA81C75178A164B8E, 0x8273B832C371CA2C, 0x49F58F78CC10DECB,
+0xA782EFCBAA9DE129, 0x000000015613A73D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x095AF598A287369F, 0xAC781D9ED89E844E, 0x2573B079F3CD6CD1, 0xD6D2ABB4F78D2FF6,
+0x51EBFDECA1F96A78, 0x21650F3A4D19BD4D, 0x5B0358545D3559D0, 0x14EE3C30D275BBC3,
+0x8002A175BCFCEFCD, 0x00000000A48C74DE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA3D2CC8C224D3C7C, 0x69FBE9B822335819, 0xFF68F8A092F9B515, 0x709E64F40EF18674,
+0xE0C090FB73CA6A2D, 0x9FACAABBF19CEF18, 0x96A9BA392B874D36, 0x448057D116FCB1CA,
+0x145B49D5DB56419F, 0x00000001D9463AE8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6044D78CC96C3EE8, 0x0114A5522E038829, 0x31C0492D4DDFC08C, 0xDEBE00D04A5C200B,
+0x1F767DD6432D9D71, 0xF7B3DA4765611F5E, 0xB64277F7E6C311B3, 0x2010D6A5AE97C1EB,
+0xD592E5DF122E4BDE, 0x00000001FC25B328, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9717EFAF82819B2B, 0xDFDDB1CDE97318DF, 0xD4AC57928824E12B, 0x40A7AF0C353030FC,
+0x869F75282B8EA706, 0xCE26B6AC52A4D629, 0xCB58C43A32643692, 0x91E24ED7BC604131,
+0x55A14FC5BABA0721, 0x000000011F0D0589, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x280A0C94AC323C1D, 0xD9E5B5AC26EB80AC, 0xE6839656DEAC42AB, 0x97E6EF57CAC0C144,
+0x5BAF1981FF6B5C8D, 0x2A701784DE4B1F67, 0x752B3B58550EE09F, 0x0B53055ABDDA709E,
+0xE9DCDA670CE1C0B6, 0x000000020BEA0AB8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1DEC1552A2F8C898, 0x1276FA077623F620, 0xFF3BC7C28A950A80, 0xC8C7CA3B02156A5C,
+0x163CFD3F61D27FE2, 0x6002829E3AF640C4, 0x2A1198371D1DE057, 0x838EE184C99D1BF3,
+0xCA1886DBC140A591, 0x00000000B8A28B16, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9A327916CD15B0D7, 0x3D7A91EEAC871303, 0x7D1261B0146CCAFE, 0xD2870B0876CAD6B3,
+0xBB28469A16E56E82, 0x3F2F0E831871EFC2, 0x0E851DF74D139CC8, 0x496BD88E5002A9FD,
+0xAEA72FE827D2567B, 0x00000000186D65E0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E97AC6AC76F8928, 0x526ED5C7B60E57BC, 0xC19392821E8820F5, 0x2941F563F6A6E16F,
+0xFBCFAC3B55EC4E82, 0x5ECE083FFE00FFCC, 0x81A4F16A2EC786F8, 0xBBBD34B695BC73A6,
+0xEE8A50AAE4DF0A2D, 0x00000001C7249CDC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B88751F95E4E630, 0x76F32E85D056B95D, 0xF4B77C8B019D9739, 0x2EE23D6B56F2275E,
+0x9E2976013C9F5C5A, 0xBBB361F34C6C44B6, 0x477A30AB0AC0D3AE, 0x1676EEC434A00A1C,
+0x4FCC141BDF7373B2, 0x0000000225B285A1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6AF545D3C274B744, 0xB7D4A305C49DAAAC, 0x9E4D0BBD9972E283, 0xB420475704522711,
+0x62261301E55FC92A, 0x0D4B3FFEC3A0BFF1, 0xD7E8D3E551137F06, 0x69B9D2A6B98D1151,
+0xDD70274C82C3F346, 0x000000013CEF5919, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x98E0522A3D6115FF, 0x9E7CA06F76D99AE0, 0xD916CE2D9A1168AB, 0x774C36DECE85F937,
+0x58E5D5C424471D55, 0x1D43B309EA62FE28, 0x296327750EF50BB3, 0xE900414F594B2141,
+0x64E6D7FDE2915C97, 0x000000003D3D5EAC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00CFF90D6B8B9782, 0x349DE2E1CD8196B3, 0x599C9CFF0CD8A814, 0x4823AEFBC4490FC5,
+0x49CDF1F94C76127F, 0x416D932C9F565721, 0x9E96033ED78C1C64, 0x0B801C5D9E23CC2C,
+0x4E4B78DD7E6E38D0, 0x0000000180F16F63, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDF839E753B8316D8, 0x9322110378C12478, 0xF90D612BF077D9C6, 0x4F9F42537A5146FD,
+0x789600779C3BE6FF, 0x9D1745EBC91CE2C4, 0xBA1A568667D38B93, 0xA2B29D6CED8BB049,
+0x23FA64A06DC7104E, 0x0000000202819DD1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x289374586D5EF378, 0xAA14F336B6E06811, 0x65E04D5A9D8ED6A2, 0x6B90039A3B5EA0B0,
+0x275D4F9A2C8D60A3, 0x5EF3D26CCDF61C70, 0x372B09C06A8AB820, 0x26C2A9B7F324B9A8,
+0xF33E655787927AF3, 0x00000000D6014C86, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37318AAD7830EF6F, 0xA98E34E2BECA0242, 0xE6CD6B9403FB2E76, 0x8B25B144ED0E6F84,
+0xB9A197022F1A5754, 0xFCAF3990AF85596E, 0xE59F3D03668EAAF8, 0x6035BD9E5D1E1A3E,
+0x5C09BF301E8D60A1, 0x000000015CC086B0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBD39070161835FDE, 0xEFDB61940F2043DB, 0x089188421D82ACF3, 0x7E96B828400F5327,
+0x4E9FF73B4A560A3D, 0x771732A0C2C4C24A, 0x95EC14C24A0ED98A, 0x3E3B8E441167AD8B,
+0x99F7111631F7B9E5, 0x0000000113700CFE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCC6C67F404E1AA21, 0x52FCECA7FDB974EB, 0xBE970CD20E46C073, 0xA9AF540320CE0C3D,
+0xB8B89EE7207D645D, 0x1E068C263BD1954B, 0xA0C7FCD27B57C31A, 0xB5C1CFB2250107DE,
+0xB5BD628A8823535A, 0x00000000B7864B50, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B8C82DCC6B7A13D, 0xED3606066AFF0AA3, 0x335A5B4814548DD9, 0x09A0D8D75335AE4E,
+0x81C934A1711DE312, 0xED017CB4DBBAC2FF, 0xA309130298D9C2BA, 0xC0815E18117051FE,
+0xCFA295BFB196D49B, 0x000000020577F433, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C6F23D9546E05AE, 0x5D98F4C4E875039C, 0x13AB2AE33D5C7BD9, 0xD94DEBA74F78CE84,
+0xB0374718AD7DDBD3, 0x308C9FD261139674, 0x4857C24CFFEE38BC, 0x18D5EDDE5D9B59E6,
+0x03F0AFF2A90C85AF, 0x000000006F49AD05, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x382E92713517461A, 0x1EE40799274BFDB2, 0xD6C7A67EB5AFE1E0, 0x65F9DC86B2CE964D,
+0xE1E7FE8FECB61215, 0x1EDFA9E8DB096003, 0xF0A1B4E252A7613B, 0x6299A67B93ABBA46,
+0x4E6C21E18F4D8E3C, 0x0000000183199961, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEAD5304327BED66B, 0x1FFD101DC547747F, 0x4CF88ED5F5FD812C, 0x26541694BC9BD4F4,
+0x2E08397373BC6034, 0xE446D2B8981955C5, 0xCB8F40828B6C7816, 0xE41941364F0F3CFC,
+0x18E982B4024CC9CB, 0x00000000D68E1122, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD188772EE3D72050, 0x3C8CF70CA627131E, 0xE1BE93645D24866E, 0xFFFDE2EFBEFA74EB,
+0xF6BDB1F1E4ED9219, 0x92243F1817B83780, 0x067350B1D997B84B, 0xE3EB368D7091C42F,
+0xE5B97ADDF102D2EE, 0x00000001B68F6A3B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDD1FEDBDD7366AD2, 0x3ED843C76270F030, 0x8071A1935E422B1B, 0x74466F507C18EC6A,
+0x5334D519466CE28C, 0x71C99D7225EB61C0, 0xC0D874347682AB17, 0x623DEF73BE6F425A,
+0x909035754CF9D8FD, 0x0000000137B092B4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9F89824CBC5CB122, 0x4C6195344F1170BD, 0x96554EFDC7A8CB86, 0x6CF860AA0E8C050F,
+0xD10993804730F2AC, 0x22F03122E702443C, 0x0350121F12174BD2, 0x4DD54461DDE612D2,
+0xD8CE937D122AF74E, 0x0000000111C22260, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA630D0E04B7509B4, 0xAE3CE1D23F4F1041, 0xC3515B6C64E510B2, 0x5B96270283023FB0,
+0x9A1914FD5EEA0AB7, 0x4CF3CCE935494AA3, 0xE9B817FAD2C42DA9, 0x27DEB5ECB88FCA02,
+0x011D907E9C063EC7, 0x000000017C40C171, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0EDECF91B3D6BC86, 0x29D342887E5D4732, 0x2C47415142DBA3CF, 0x81AF821E72750D74,
+0x81AAD5E0AEA0C83B, 0x60D35976D0F30723, 0x0B1AC1F3C10CDAB5, 0x1EFF524972FA0BCA,
+0x9D25E247DB0E3BD2, 0x0000000044E74B06, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBE0AD1EC185A9CA4, 0x634A941A9B53B2BB, 0x5CEA310A308E58B5, 0xE1F9A2709CF9BB94,
+0x2231C11C57943EBF, 0x8DE3E50399687AA9, 0xE3312B79A0EF0B48, 0xE8AA193EA000EB47,
+0x502E807D1F042166, 0x00000000D0A3DCE3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6825F05DDA045CD5, 0xE2EB51BAFF2D4EF3, 0x00069A780BD52A34, 0x9ED57E9361C43B3C,
+0xC1BEEAB8798DE73D, 0x4D37DEE431C102A6, 0x78BEFC5F926EEB93, 0x922C084F6088AE53,
+0x736F230EA0673584, 0x0000000164FB0A6D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64C8641D5DB7EB64, 0xECE19B53AB7FCA40, 0x49EFD78A7991F46B, 0x61CD18D088BFDFAD,
+0x770C4B206E8CB680, 0x592507D0FF283D9B, 0xBD14D6E9BA331EE3, 0xEFE5E94592ED33C6,
+0xCCDECBB92DB306BE, 0x000000019AB6E042, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBB1F603A6AF98FE6, 0xB0814AA062A5338C, 0x7E3615CB5EDF1A5E, 0xD453F5A8F728F833,
+0x4AF83C287535810E, 0x8A6102F3C9A4FF3F, 0x7BF253524C4808F4, 0xD9AF4A2F4E340CC4,
+0x9FBB4CBDE074BF10, 0x0000000058A0EE43, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5451311C4B8FCE5D, 0x7D59A024FABE57AF, 0x0FEE90F138B0A793, 0x6DA2B9D194166383,
+0x1E50FE5C6FBA359A, 0x2163E7CE5BBF553E, 0x493C1BDAEBFCDE7F, 0xDE9759C6B8C10223,
+0x1DD0B238252A0FF6, 0x000000006B10DE6B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x38C313BC9081098B, 0x40E25EF54576A4E6, 0xB882095924AC238C, 0x2D6F55E4093BF787,
+0x0458B6A0F0525678, 0xA035656AF7107793, 0x3F961745878BD152, 0xCA9A12F449643694,
+0xFA17C76A4066D26B, 0x00000000281FDC8B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB1A32B5848AC69DC, 0x2FF361C248EF8181, 0x5F430DE57E955B6F, 0x0CCB1B597AAF2C73,
+0x7A805968A6F64E9A, 0xC3D3853A8919FD7E, 0x2020D0D9B533BF64, 0x45DB64DE18B85E0E,
+0xD90F01D0D67E3480, 0x00000000AD19209E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x06E98FEDFD78625D, 0xBB056DAFCC393869, 0x15EBAF0B2FC011D7, 0x31D59B99331C6E9A,
+0x8DC3EF984671B894, 0x2EBD8ABAD0C1C7AB, 0x705A4F53331CA55B, 0xFA3E3B83CB2A9CB1,
+0xE97059E613455511, 0x0000000033DCD618, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA79403372D3E60B0, 0x1C987379BB28544F, 0x120A45E52DCE1C62, 0xCCF1CFEBD8CD34DA,
+0x98FA4C95364A786E, 0x69A1C3027A8C6577, 0x02D0FADE4E15CE2A, 0x24806730441F8A49,
+0x2886D26AF1508D14, 0x000000010184631B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3008B30CDD50404D, 0x834A9F62499C5B03, 0x2D79D9D89F3AD90B, 0x97C39D178877D813,
+0x9A7D863D1CFC1C3B, 0x7F41432ACC6D03C4, 0x3879F5AE7AB53EA9, 0x0561A3C150F16EF4,
+0x2C34AA5CE7B5B92B, 0x000000023426035C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC187A3EF948097B9, 0xFCA43031EC342666, 0x19B7D1254C3910EF, 0x57171E6C0AB26084,
+0x975725D166C18551, 0xCF964B25A33559C9, 0x32888BECF732DC77, 0x0135BD71452E3227,
+0x62540E93C1EB1787, 0x000000006DEF8788, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33AA803C637B8D44, 0xD4F79C3D0540D71F, 0x71B2066B6F8791EC, 0x3844AA794A56FD28,
+0x0CBCA386972C3538, 0xF0A892204E887ED6, 0x85283CA554ACEC78, 0x58BDE659328B4E77,
+0xAD8B640256B1ED7F, 0x00000001AFC4583E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE89094A7F793C0D9, 0x9DCEB7D8B2D33E63, 0xF5004E272AD6E40E, 0xB858D433D036E64C,
+0xFC54B210A3BBBB8B, 0x190D0268E88892CC, 0xF46122F6A62662F5, 0x3BB59E7071C27C47,
+0x6185DD4E7F98E3FD, 0x000000000ADFD572, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x025DB4F2CBF98848, 0xE79371B5B636C451, 0x3B7BDB732A25F712, 0x66DA3BBDCC2F8663,
+0x51645A94C1384CF3, 0x419502FC4A13286A, 0x39C81AEC4EB6ABA2, 0x6050B5BA539F70B1,
+0x653E2E1081DE3D37, 0x0000000165E519CC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9A98D3CF97BAC7CB, 0x38C0BCC06E4F295E, 0xDBCE56DE591971E6, 0xA0C9064BFDFD13AF,
+0x2A4FC9815A663413, 0x02B84C8ABCB56B43, 0xCBE3F9EC40C90767, 0x03DC8B6CE53C01E4,
+0x516AEDE1F11C3E2F, 0x0000000131BC889A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x47493C7BF16DEA4E, 0x72E06CAB191FC827, 0x98230F089BFBAB43, 0xE0E0564A1F076600,
+0x4CAB868F4E2FBB56, 0x7604C54FE3EF58D4, 0x8C4B63983726E05F, 0xDCE925A6587D0927,
+0xD570ABC93180F831, 0x000000017AC3AEC0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAFE342E26FF8E2C0, 0x0282E5F62BE3EE15, 0x106B629574D0B86D, 0x6AC3C8CFCA61C170,
+0x5BCF04861BA1D015, 0x45FD7D48033BFD5E, 0x44195480BE4F7D23, 0xB399DD4271849C6E,
+0xC28D61EE282783E1, 0x0000000253E402BE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B768F5ADA4B764B, 0xD847D7C47976B0E1, 0x46717685EEADEA81, 0xED03D8708D06D5EB,
+0x9512D4DEF99D4C9D, 0x06171CF4ED67C76E, 0x561BAA3DE1A3A8F1, 0x61EB421BA7A6319B,
+0xB60AB76237902FBF, 0x0000000130ACC1F3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36C99E54B3B6890B, 0x40C987CCEAC0D891, 0x92AFFE4537F613FD, 0x8DDECB4088E8B62F,
+0x939AE3ABEF675BDE, 0xD5EE943488151E54, 0x5AE52770667CC729, 0xFC7C44F487E283BC,
+0x1440A7C8AB679B6E, 0x000000001FF37AAF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC2BF73E602E4D240, 0x5E264544B921123E, 0x4CA1ED612496F327, 0x8B6EAD83FEFD0D4F,
+0xB5090C53D7032F92, 0x8276595B735F0D96, 0x4E6ACC0C2CCDF68D, 0xEF25AC53098784F5,
+0x6A07C4D646A583BA, 0x0000000154CCD257, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x721138B796B331EC, 0x94B21BB240DAC06A, 0x791D7957036A1675, 0xBB6C5A18BAC5E764,
+0x9EC76DF30DFBF605, 0xA66EE85D3172487E, 0xC69D6CFECE81DDF6, 0x49958CCFD0F54B86,
+0xBA5362DD61D4F6BA, 0x0000000270AAE029, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5696C29C72C209FA, 0x7BFA27BE3A154B8C, 0x2C045DB6C350AA16, 0x1EF7435E85410079,
+0x1DA783F6E9A4B1FF, 0x816810EADC0B5409, 0x8F7298615BFDFD05, 0xB771D063734DB688,
+0xCFC4F69334A1F18B, 0x00000000D694CD93, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x55CDB224BFC87180, 0x500F627A41C98F48, 0x0BDB0A9C14CD0724, 0x5D9E28EB01CA2AD7,
+0x7E12A2AD36C15559, 0x5E2D7FB46541A4BC, 0xFD3B72BB8D9B01BD, 0x5F5314AE4381DDFF,
+0x4AE2A87B78928CD1, 0x00000000E3366ED5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02127BF2C8FE60B9, 0x814D55AB5EC52301, 0x69B214FE53D2CC0F, 0x9E221E561FD3D6E9,
+0x517F64F4EC8C26BC, 0xBDA9D6C964EEDF1E, 0xD0458ECBEA121602, 0xB161A6D5B4A041B7,
+0xF0971F89F5A2E750, 0x000000004DBBCEB6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x338D840B35E6B280, 0x3F7C8F669B9E7D6F, 0x75EB6281638EF6CF, 0xF9F756181975C48A,
+0xA21CBD43EDB2CDC5, 0x3B2C61CD24627DAA, 0x827D879E9412CC00, 0xAE5DDEDE8884FCB3,
+0x0EAAFEEAEC23E7E5, 0x000000018AA85899, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x378B69E084B5EA0A, 0xEDD591B3B95B415E, 0x92F99318BB7A4E3B, 0xD2175F1F0FCEF58A,
+0x0C006DD2C8C73F84, 0x6AFB2E75EB2DE69A, 0x0385F7548CF7AEF1, 0xCD2A97B1B07F50EA,
+0x49C40DD3CD5EFF2B, 0x000000009CBDBDA4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x94D66B5AF3026F10, 0xE2691BBD10AE6D40, 0x2AFAC912167DD9E1, 0x0A5AC11DE4A1DAF8,
+0x58DB36D7E7062569, 0xC93FA402CFEF32FF, 0xB031D63242F54E37, 0x01464DC2F2B7BAB3,
+0xC782DBFD66096E53, 0x0000000116E0B75A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFBBA18D2BF4C1461, 0x81692A4A14F656C6, 0x263E1E400301926C, 0x575D0F5652B81F5C,
+0x1F30C72F1F1F7566, 0x02E3AAD07171EDEE, 0xA6319F7111A18C62, 0x6BCFC82429A3BF74,
+0xFFD661FB4A6B38C1, 0x00000000B3B812C0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64A6AFB14BF35ACA, 0x8025636652D17E7F, 0x5E25D0D1ED432FD7, 0x1EF1E3BECD0D17DE,
+0xFC33DB689FF85A51, 0xE19AB14286BBAF57, 0x90736506AA7EA8F0, 0xC90230895CD20DCB,
+0x8B4C46BAF0659D2B, 0x0000000129AB5C21, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x56B1444F6382400A, 0x2B4ACA2CC98CC351, 0xB25605E58B24E90E, 0x46B3C214FFD52755,
+0x4BFA8047BE7AEDD9, 0x7BF3880463A4DD5E, 0x15690B1730F6A426, 0xDCF43ADAC24C5B2F,
+0xDD8D1421A781B771, 0x000000015ED10BF7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x256731815CC958B3, 0x8D2C5F40441B9BF6, 0xF5230CB73D6AA700, 0x9D26176DE7C5CAC4,
+0x61D4C27B94316292, 0x590584F0C8AF143B, 0xBBAB19403562966B, 0x1E29F356EEB6455D,
+0x1E190036C7704C6D, 0x0000000129B1EFE8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCF622C248DAC1FA2, 0x8C9667729206F258, 0x158368C9C6E0B324, 0xAED6B2236E657981,
+0xD8BF0C27CDADA66A, 0xB8CE4EA82796E57D, 0xACE45D955BE9A980, 0x283E4DA26179D83D,
+0x1972637BE7742162, 0x00000000DB080681, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEB6C259640FD8077, 0x619F87906BEB5068, 0x1A716B7E55210A95, 0xB1958994F33F5DEC,
+0xA2E4AF3322211269, 0x051CE1D5CCFA63C2, 0xC759BB66A9B67EA2, 0x4117CDCAC91571B8,
+0x68AE839AB5DEC1C4, 0x00000001B42A1F3B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3EBE54D4CC182D58, 0x309F3EDD7568F662, 0xA0C1197CC5594F78, 0x3D07CD8099C12984,
+0x3E5BFA2034A982B2, 0x666EC9F766AAE31A, 0xDCB4DC36EFEA1929, 0x0B44D79A14DC6AFB,
+0x6122C813F153D532, 0x00000001160741FC, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x55BFAA0263AADB25, 0x05A8723ACDC28CD7, 0xB92E5BFEAC02CC63, 0xECA70A833A77FF58,
+0x02AC34E6032E39EE, 0x0C4A5BB893F21D83, 0xCB27CB1972DC7EE8, 0x97F1C947A96C9FAE,
+0x49156BFC1D0A0879, 0x00000000E0F05788, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDF9774B07C3BF734, 0x7523E403867B5930, 0x9F071C0D1DA4D034, 0x7239DECBA41FBABD,
+0x573260D7828DC0DA, 0x504B3EF45B6E4500, 0xD61A1CFE06B94E53, 0x5CDCF330AE423193,
+0xFEF40EDE5353E339, 0x000000008D5E7E0C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2F84A002C33A5999, 0x2D6BFA890959BF29, 0xC6AA6B68ADBB0391, 0x8BF3A19046725C96,
+0xEA0CC1BEEE015632, 0xAED9182108CA8E16, 0x9C1CC3B48CADABCF, 0xC0DE77D65430E0CA,
+0x378E03C77AF303C5, 0x00000000BF4AB277, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4543F9983DFB6D0B, 0xE8CA947A55953BCB, 0x5BADDD647532028E, 0x121A213B77EC2871,
+0xDD85143AA2D3D253, 0x2C6AD074453EE15D, 0x7C1251223E43F61F, 0x6C8D6FD60807712E,
+0x1053E350C3B5B5E3, 0x00000000E0BE8226, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x972CAF8229C70557, 0xE3DA92D645BA6169, 0xE09C8E0E4C8EF0FC, 0x0D2FA3F559A635A2,
+0x488A7A54950F71D1, 0xC77C4B405F20EDA2, 0x600623A18AA90730, 0xC84DD0771B9E898C,
+0x218D0840C35D1EF6, 0x0000000172D6ED4E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4C05C84A335A03E, 0xB681902EC8134DD1, 0x76960DC6B9B43C42, 0xDD2CE6F92554B6CF,
+0x1ECB7E6A006B8341, 0xE5B86706F801EB77, 0xFD45D592B4390F74, 0x2E232802A0502799,
+0x94F3C30643FE5D4A, 0x0000000120BEF953, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEA563DFF232C87F2, 0x45E36D4863205D4A, 0x0050AA46D9472E36, 0x2F518A18689CA36B,
+0x4AE2AD06A018BA10, 0x2875A92436834CA1, 0x5260E220F456FAF8, 0x32817A99B24BA11C,
+0x92BE66CAC53A3226, 0x00000000F40420E8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x75D67006A7746095, 0xDE6BDB26CC063751, 0x1E0B37B647C75721, 0x5005BF5FFCF7D8D2,
+0xBA80D52674D6972D, 0x4A5FD54939503B9F, 0x29A8E8DC74F09774, 0x8C54BB4182506076,
+0xD1BA9D372E2CA745, 0x00000000A7D5B8DF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9F06099074B43BA5, 0xF8B8BBEA12301244, 0xC091D4127224D0C4, 0xFA5BF6D05C187CE8,
+0x3765A0CB3B16D64D, 0xD9645C7CC60DFCF4, 0x033167F7DB857FDC, 0xB9C7780D21E5FD9A,
+0xF5160CA1FF174811, 0x000000012FFE4F9C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9DBB136DF066F22B, 0xE2D73B32FBB9A825, 0xB44CCF46D979442A, 0xDBAA86BDEC5C08D0,
+0xDA06BA6C9C5AE19B, 0xEDDF0E157225B92E, 0x24FE550D8707A481, 0x5CD131DF8DB08E3E,
+0x98B131E09766CD9E, 0x000000019C42A079, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD558F2C44F5DF63F, 0x10613EE78DF28107, 0x446F4DB395F16AD2, 0x3F6BCF17EB275B8F,
+0x6763EBC008FFB5E6, 0xE10F135D85C7FC12, 0xC942E03EF4C9F186, 0xD4B01504A7C11A07,
+0x8334173FFA501900, 0x00000001A420F6AF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x35E5C06BA49A9434, 0x1F19351571BE390E, 0xF79F9B6AA134F2C4, 0x92985E56C3CE36DE,
+0x7ACA0772EF7413B1, 0x73464245E878C725, 0x6A33BFAE46245810, 0xFBBA78AE966516B6,
+0x7FAA4E9DA80A0BEF, 0x0000000018008CEB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD84CCEF0D11D167D, 0x6C5188C50E24A60B, 0xB624AA709BBA1C03, 0x3B6E9F46DF4342BB,
+0xE5BC4833B9AB25FC, 0x4400B3DD4A85F3E7, 0x8D31D3E5FA178E06, 0x8EC0D59A56437953,
+0x7DB942DE30D67529, 0x00000001CFF428D7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0FB3E0F60B6F56C3, 0x1616798E24851F4D, 0x9681757D11C04EE1, 0xC3AFCE1C10C25020,
+0xDBB585047A8255E3, 0x20A80C88D7209D66, 0x5E69ED538C6CE060, 0xB16AC49036CF0F96,
+0x8948415CDD60D9ED, 0x00000000B307CD61, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1375A3B27B2089F7, 0x12033D8CEB96F6B3, 0xFB089922A23C9ADB, 0x8DABFDAF45952D9B,
+0x49E088DC015883B8, 0x4DD85BFA6588351B, 0xFB5338AC6ADDF3A5, 0x0BF4776D3B630679,
+0x0D0ADFDCBB822862, 0x000000008B847DB9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3097E0E53A4498EC, 0x7EA0DE833A25DB04, 0xB2252EEF36CB40E6, 0x5329B290B7602338,
+0x4181C008A780FD0C, 0x8A4558BC820D9892, 0x0984A6647F4FB10E, 0x0F7ADB8C0C814395,
+0x75C488E75351A5ED, 0x0000000197EB6635, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x750EDC7A259CFDAB, 0x59328CC40F61A285, 0x2ACC9465E0573E99, 0x87EAAB19F336D480,
+0x1AE19CBD110BE43D, 0x2EC28881E305B648, 0xE0D1C7CF73D4D3E2, 0x12094278DB1CBA75,
+0xBDBBF6754D76A79A, 0x00000000CE169CEF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD9EE0369D71245E, 0x25E514D05E4810F1, 0xAEABBC7C7C5A8980, 0xB16F449808BF5307,
+0xEF35AAAEF99D0B54, 0xA560845907C3CCCB, 0x1F55E18FEE1D0D28, 0x6EA5E5DC5FFE4C85,
+0x46F2898045D2A64A, 0x000000026ECE3EB1, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC361AC14A625C215, 0x87DD6BEFBA73D55E, 0x2F835C17F6C0695E, 0x6819BC46DA090724,
+0xF8034D2D6785B66C, 0xBCD8EA757B7E779B, 0xA2FC92D1F96DD878, 0x301254FD406CFE8A,
+0x3DF4B351793C9935, 0x0000000147915A3D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC3005135A9854449, 0x66B5B759C1B97C8B, 0x2A71550968C06340, 0x322AB1195CCF7D61,
+0xD2E51FF17FAE364A, 0xA885619B588E5F95, 0x087244E9E08E671B, 0x8C582253D011B3FE,
+0x5FB94058280F3A48, 0x000000014F33009C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x400B18CBBE7C3F69, 0x52CC8D1DB13E43F6, 0x373381C1A2413DC6, 0x4090ECAE3ECF6E4A,
+0x5394709CE9572996, 0xA3D5E68BD81DB10F, 0x5F95D696465B3B61, 0x19AD38794539F53F,
+0x34F6CD7AADA04420, 0x000000003AADDB66, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF7C9F35DA4233381, 0x886D48F66400B083, 0x84C610296E9F31AC, 0x5BD12A8FEAF8F3B7,
+0x1E827D2FAB2C45EB, 0xA3FEFA76995655FB, 0xDB86F28FFB450F7E, 0xED6B792C61D2478F,
+0xA146ECB79B6E3E8F, 0x000000020CD392C5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3BC25049A62CEA53, 0x7EC9BE14EC8CAA23, 0x37676C2DBFED4039, 0xC5E69CF09E2CDF6F,
+0xC91989B8A4653176, 0x349B46E8A1982407, 0x255E2B899FEBBA84, 0xADC82BFAD32464FE,
+0x0A0802E18A723C07, 0x000000010E0471B2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF2106FC9C63E2655, 0x72133D2364450E5B, 0x78C097C64CAB9C1B, 0x398E8F2991E9434D,
+0x61F5BE629E8500A9, 0x961DAA64841FE364, 0x7D0AD2F3688B0583, 0xA892FFC6179C1C54,
+0x5C31633FA4626F6D, 0x000000008C857E14, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5812BCCEA083C0C5, 0xDABC43B7869BDF77, 0x727146DE7C67CB54, 0x5A91983CC8F51D10,
+0x46DBD4171871D781, 0x641F14151069F358, 0xA4F753F921B9AFBA, 0x6F455AF18C5E9A58,
+0x98B9D300D2848CBB, 0x000000015BBD58E0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x582CB99765F29444, 0x363750B16B0DCDD1, 0x1C79EF98D6E2F851, 0x6EE1565B5B23E60C,
+0xCF7132E7DBCD81FD, 0xF5F959DF0564C7B0, 0x9EC2E0C21F240F2B, 0xF83EFBAC096336C1,
+0xB1DEE49E410EA684, 0x00000000D774DFA7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0EDB61D6DC2836EC, 0x1E95CCB9B0E636E0, 0x94FF339908487066, 0x4468161670CC8611,
+0x23C1B907F519FAB1, 0x45750C3B3922720E, 0x7DEF8BAE66DB0BAE, 0xCCB9978F9271977E,
+0x180BDD3EABF3C021, 0x00000001C8D866C7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2098BC5CD8D79FA7, 0xA06AFE8916538926, 0x32437E089C9B6003, 0x9264EB0D24EE73F4,
+0xE7E3EFF0A0AE9F37, 0xC40BEC07D4C3AE11, 0x10FCFB7F6F9D81CA, 0xCC60B25C3EFC2320,
+0x15A250B14010921C, 0x00000001AA325EBD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4094FF4940993525, 0x93E630A19F3EFFB0, 0xF8C3ABAA866CB0A3, 0x42B59526B2988986,
+0xF5DEBF4F232E2F8C, 0xC5BD9B724C724AD9, 0x7ED59BFCA3074406, 0x22C4DB76E3297A52,
+0xA5C764FF26AD5388, 0x0000000118731862, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9C8A132A26459E1A, 0x7C8CC4B5664774D6, 0xC38A36F6AD00C81B, 0xBE208DDDFC5438E8,
+0x37AC677F87D452D1, 0xF7BEB00C7B7FE558, 0x9B9877599496B704, 0xF74FC63DE0678270,
+0x34F6F6DBD9106DAF, 0x00000001C58F0C44, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x93A904C2F7CAE29A, 0x8DBD3B407DA86A79, 0xCF50BD0C1D5B317A, 0x079280A05989CB39,
+0x9B33B11A02F5545F, 0x4365D6C0A7F005AA, 0x46ECAF8FA32767C2, 0x4179DCD735A2BDEC,
+0x46F020667A10BB4E, 0x000000016BEF2859, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1BE93B09F970BFEA, 0x0C18BBA08B1A53A7, 0x7B71B0791A5B2FFD, 0x38A71279A10D1B0C,
+0x92AE908978A35503, 0x94B7BF7BE296BD57, 0xDBC77889E46CAF67, 0x616431F9194C698F,
+0x02A5778E1E8C7BA6, 0x0000000158590C24, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDE9C3C2E2113C5E0, 0x78FBF77C888DB1E2, 0x143F9FCDC744ED23, 0xCB042C41DDF955DE,
+0x26FA4BCA0BFCD68F, 0xE380E6F88DA44813, 0x0C20FB067DE01723, 0xAAECE7C0330B20AF,
+0xB0BC0D8FCE2A1E9D, 0x00000000B4C7DAF0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD322D3432F42E55, 0x8CFE80A02DD9BF47, 0x98669BF86F93D7F1, 0x06BC0FAF82B50FFF,
+0x87F20F4CAAADA970, 0xF4D26BEC13B1F99D, 0xDA6C269957102D35, 0x96BBD688F4952916,
+0xAD7EE463270CC19D, 0x000000008D734EEF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2EA85E41D35C414E, 0x9FCFD6E756EA1D8E, 0x2409D674A87F6CF2, 0x0EF280C8EB15C5D5,
+0x6B5EF23D9C8DC08E, 0xB69C79ECAA227358, 0xE1F9C33AA020DDB1, 0x68BD2185BE691D9C,
+0x3269E36C6ABD48EE, 0x000000026CB05035, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF6AB8D3DACA961BD, 0x4EE7593DFFCF69A0, 0x73C3AE907FEC5B08, 0x2731EF3110D41BD4,
+0xB5BDBF74510FCF23, 0x30D01C0F7499BF52, 0xFFA961CEF1B60594, 0xB2C27539C7884B8B,
+0xAEAD2CD6AA9FF556, 0x0000000022BBD56E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x892B1BD2820B24BE, 0xB1623BFD2C1A73C4, 0xEF035FFB8B26F353, 0x69748A28EF27D1CD,
+0xF6FD76CABD4A09A5, 0xD6D32D7C00283B71, 0x4036A6966A52C02E, 0xEAC9802C9DBFE6BB,
+0xF0D573FA9214741E, 0x00000000241DB85A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3494A4252A3636B4, 0x06AF6680F655C19C, 0xB19E60E35C94672B, 0x33F7DFFA9226FA28,
+0xF90208A81D43B13E, 0x5E54E122AEF1F96B, 0xEA9FBBE9781DE039, 0x75072B9098B0721B,
+0x578209A9D2CA6E48, 0x00000001990A8D5C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4C194672F7A24B28, 0x28419B3955DF5869, 0xA1709333E88D307B, 0x4C9DE590438D2418,
+0x241F5CCA01FFBB2A, 0x550CF0F6D5F3F352, 0xADADE21A32597963, 0x9FA421C92D81C557,
+0xDAB69FBDA1D502C9, 0x000000003600DF99, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xABE2A14FD8736DDC, 0xDF53F430D47E26C7, 0x7A64A1DB4F1B7895, 0xC899881DB61158D1,
+0x970F45BB1D609451, 0x9BB8FF766CE0140A, 0x0E292B7BA87B2B39, 0x0EA865146AAB4734,
+0x78D4485E2F73EAE1, 0x000000023EF20968, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBEC88F0EC7DD3F31, 0x939477248B2B201B, 0x12D84AB932468A14, 0x7135C6227BBF3BFC,
+0xBC9AC32ACBF66533, 0x1484DF6445EFF0AB, 0x2F9305D0E0171051, 0xFBFE97B6A685E382,
+0x3BE3EDF7F89DACDE, 0x000000010C9D8F20, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9D9CD5ED3AA5E7F, 0x43FDADB80AD1140F, 0x09D97CD678DE9D98, 0x952DA71ED1434B91,
+0xB971917B74832380, 0x518C11A1F23E1F46, 0xD051C431182B16E7, 0x977E0EF36FF2DBF5,
+0x453251A004FD1AB2, 0x00000002544B9F7C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF8459C583FC282B5, 0xA933197DC2A7C82A, 0xD71D6E8820010A5A, 0x2F4A3B510CCE1608,
+0x0E2BE75455D9A36A, 0x478F97846995958F, 0x5F9EBC8ACBA7495E, 0x8EA74EA0B03E29D1,
+0xBA48620ADADEF333, 0x00000001C3958015, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBFE78EC830C9EC7A, 0xA1BD98BE6B3F5271, 0xF7993820B925584A, 0x7D2E96FD881F757F,
+0x23ED485C9F965ACD, 0x27024D8C7AF7118A, 0xF6E682358C3111E5, 0x8E0A022F969722C9,
+0xCE7986750A6C6E5E, 0x0000000199FF7060, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46C8E9E5D88D5F6C, 0xD0C443CE461C915F, 0x8190836A490DEF92, 0x691C53B4402B5B07,
+0x3F8E75ACC1377034, 0x5FE6DF2DC77B043B, 0x8E3FCC1D2852535D, 0x48CB74714A105FAC,
+0xCC0CAF009272B8F3, 0x0000000091DE831B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDC8BE9D1F64B48CE, 0xE0E4843FBC35541D, 0x9EBBA8BB7B68CFFD, 0xC481B9942EB0D323,
+0x0A6872B97BD8A110, 0x33EFEAEE8B58131F, 0x568B1923D9DC438A, 0x48DB77A07067236A,
+0xD60C3184CF30031E, 0x0000000153991869, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x391DCD31A86C132F, 0x8786256C75289C63, 0xCC9DADE2C1E81650, 0xCAF8C70CA2E7C499,
+0xB305F530CEB05599, 0xF43FF3B54C5197B6, 0x1EA5EF8BD5A3778A, 0xC9BD9385C5ADBDE4,
+0x1A29525418B3D83B, 0x000000011D5386A4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xACCC80BBB3F64D12, 0x8C82533D471FA627, 0x41BF04A15B6DA075, 0x6BBFE0276284F8EA,
+0x0B27041B34EF5CF8, 0xF74A99426CBE058A, 0xC4AB5FD9A70523E5, 0x0CBB7BD5828E072F,
+0x0A4A2E4332A92949, 0x00000001AE35B9DE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5A2B47C82269F7AA, 0x8DB3B37E3C5BBFED, 0xE9C55F80AC532891, 0x9D4B61CF533EE34C,
+0xEF88FAEDD86015F1, 0x6419D7871C5B3B50, 0xD9FA094239B9DD8B, 0x069206B663043103,
+0x82A3C327C2D00C7B, 0x00000001836DA26C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x728B7C6EECD60BE2, 0x99840A53BF2FA42C, 0x479B6998F4D84E8F, 0xE79C75791BB31EAD,
+0x8C727FD535F2065A, 0x876265E9CC941FD7, 0x1F9AED911E796158, 0x8FF4602DBC581025,
+0x887BDD2F13416765, 0x00000000A5F450E5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCCFC7CBBA7B2FCA3, 0x56AE34668924AA1F, 0xF4CAE840C885A3E6, 0xA160FC6350DA0257,
+0x81E1601DDDC2455B, 0x9D6460716D2B59F9, 0x06049C2D977B481B, 0x74EC735BD5A77A7F,
+0xD26AE53C3CEB0C60, 0x00000001587E2981, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6375ADD0289BC3B2, 0x5DB26A44E28E3BE0, 0x1068CB1895C65EAE, 0xBCD63F8E0C510AD5,
+0x51D0CE903DC93464, 0xF40F66B40BBFA26F, 0x922F06B880B6B0E7, 0x14E0845F35DBABA2,
+0x51CA80A8DC40385A, 0x00000001C6FF4A3A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x90E18D1A638086C6, 0xE32B70149770A9E7, 0x5BF1F0218D71FBB9, 0xDEF707C50A815C89,
+0xA68C6647981018C7, 0x66C1F7E01EEFD1FB, 0x8A2A82D8185D7EFA, 0xB25F66E67FE0E175,
+0x92955A1F74E0B7BF, 0x00000000864C1AE5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA514B82BB3A4D46A, 0x58254ABCF151875B, 0x525E6B10ED5B70C0, 0x6E022A1C412388CB,
+0xA606C516E8711152, 0x7A738A3DF802CBB3, 0xA91F20F575387E7D, 0xD3691B45CBA466BC,
+0xD0307B1BECE0086D, 0x00000001A73432BF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC576015AD62FF50A, 0x048654FEF05E5A15, 0x931419DFDFBE814C, 0x3358635B7AA2537C,
+0x7C72037167E86D28, 0x019A06B3AB78FC5B, 0x494638F83FDC059A, 0x57196C19AC48F8B4,
+0xBE0AABF769EF25A5, 0x0000000255725BA5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x80A23F15EBB74681, 0x810C9FBD40E1054C, 0xBD83A9CD030905D4, 0x560BA6D11C1DA9A0,
+0xCCF3AD756AFBAE1B, 0xA2CFC318E956D895, 0x46022FAA4329783D, 0x21522F1DDEE215F3,
+0x100F66283C07CC24, 0x00000001961A2026, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x023BED3582CECCA5, 0x7499481D6B4E0BBD, 0x6CF0A295480EDF50, 0x2A0FE12E9EAD8841,
+0x2773600AC17828CA, 0x4DD06841ACB33E3A, 0xED2F6759A1A42AD9, 0xB42ACAA5B1BEE2E7,
+0x3D5336D6DA3F085C, 0x0000000012CEE734, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEDF7F93EB5C444E1, 0x800566DAE01BF5F6, 0x09173CF46757033A, 0x308D062BB3376D49,
+0xD82F61B18707FFA7, 0xBBB27245AA33A57E, 0x9CAA9A643257B9FD, 0x45E29D9BCCC0AD3A,
+0x5472FC4EACD868DB, 0x0000000028165949, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C5F285FA166EFB9, 0xFF5BB817C9198484, 0xE1F28F46E90D31A7, 0x2B27A17686134CFA,
+0xF039B25A4F864AA6, 0x0132AA2479EE3681, 0xDED93140A3E6FB7B, 0x13787BA6BFF26463,
+0x78F7D9F8AD598846, 0x000000024E806755, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A5250C27148FAD7, 0x11A31A5265CB84D2, 0x941CA0F4DF882CED, 0x5CCF1DD19B1FAA15,
+0x9EB9DC8DA1B9E18F, 0xDE4C3D0B773019CD, 0x16E37DE2CE57F6F5, 0xCDB2036F2962609C,
+0xDD600450E15B8409, 0x000000025E72E791, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8C1AFF81892D4FE0, 0x05BD1D68C1709733, 0xB9276EFD5850957A, 0x8334C73B2371AAFF,
+0xE25632C930025314, 0xB21950D5899AFB83, 0xBDA5F9D817E819BC, 0xB8AE3565F81DBD33,
+0xD82DCD48994E51B2, 0x000000023311D42D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCB0FBA736F2FFA68, 0x9A2A983762F13E64, 0xC8BA41B7453B6701, 0x8D23AAE926F2DF8F,
+0x1252DC72AC81E7C2, 0xB515A0308EDEAA7E, 0xC7F107D12C9866AB, 0xC261622C3AA07E2B,
+0x8E877A73121856C8, 0x0000000120F2BB81, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC9D2DF47185FEB7E, 0xB862AE25935E6D93, 0xED504A38E17E76AE, 0x35447035F1DD54C6,
+0xD2C3011AA9813C10, 0x4FE590E0CC16F7BC, 0x511D9019847B194F, 0xB092F5647445F147,
+0x0503C04C87710B26, 0x00000001A9935622, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D651D47A372515E, 0xBD7B107E65FBC4CA, 0xDE46047C9ECFE7C7, 0xD996F5778FF2DD90,
+0xA1C7F47C2603367A, 0xCC0CCAAED89EFA4D, 0xF32107191789E712, 0x57AE2714A83B7D8C,
+0x4E6C07017338851B, 0x000000003D47E7F4, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3706CFD52D444CA0, 0xE7EE797F3B3FFBB8, 0x7DD10A3851DABAA9, 0x1FE8AFCC9FBA80D9,
+0x07E7DB594D3D969A, 0x4F97F04C020FC396, 0x90DFF8F4CB1E5C40, 0xAB61907C590D6A6F,
+0x90BEA7AAA0C2D07C, 0x000000011D038717, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B38A4E1E4CBB4E2, 0x12940E77725B4272, 0x5622E1A4639084CD, 0xD2B6452EF1765C3A,
+0x32A403A09D88D119, 0x374D63595A1EDA48, 0xBA12D68B385B1C13, 0x662C7FFBD00DBFF1,
+0x326A0D3BFE9AE02E, 0x0000000117D7CCC0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDDF0F9441CF87146, 0x9C7E0079DB4F6F1E, 0x350A9393F1130DA9, 0x64CA957C66C2A0DA,
+0x6B8441074284DE97, 0xB8845A7DD51505FC, 0x5B1D0FDBFD658A60, 0xDE105EA09F6B3CE4,
+0x11872E1DD2388682, 0x00000000F619AA29, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3655C4992BE573AA, 0x40AEA1B3B85C3B6F, 0xF6FA3A5D6CC30ACF, 0x115FDA8E2E3B26A7,
+0xC7A836F0A5E2B8A4, 0xDDAF94F60550272C, 0xB7AFBFD796C2C039, 0x6F938901E9147E21,
+0xBA3F9348B95C141B, 0x000000003D72A18C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA8935F5012230BEC, 0xE9D7927D840358C8, 0x198FA40FDC49FB1F, 0x4F24E628C7566DAD,
+0x96A28D3004E9B5D5, 0xB1BDA28EAE017960, 0xFF7B291969656F29, 0x450EC1615A96A58C,
+0x991D07C8B33697FC, 0x000000002C4BF06D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3DBD805BCD50EEEF, 0x55306C3146976CC2, 0x09CF6C18B3C2E3C4, 0xA813C7381623392B,
+0x4AB956AFD0A9D6F7, 0x108EB50B6D66AB89, 0x3A40F58C4D4F0417, 0xAD78E9AE60C6D233,
+0xF4D9780A2A4B9E55, 0x00000000D2062178, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x95721317B78343D5, 0x5E777FB1DAD543CE, 0x43A5129CB6E5E15C, 0xA61A4D1B0F402B5F,
+0xCD7C7C1C690E545F, 0x59E58992A276E249, 0x6BF89B5D3208A9B1, 0x482927FFC9FAEDDD,
+0xCA06AAD32317C414, 0x000000008845DD2E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5F5443ACDE7C75C1, 0xE5DB2BD2B3455FF3, 0x90EF3D70A818EBD2, 0x4CF4D5A3084E35E8,
+0xBDBF8F640512F0DB, 0x22531158CF96B0BD, 0x40E142352B8DF849, 0x7CB714204C429F9A,
+0x8242B4B50E1AF822, 0x0000000163C7CF3D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB973E9B74358A947, 0xC588029D217CA57A, 0x88BA227DFC7C40F5, 0xBE9A08869A8F80D3,
+0x9AD2C38BB49C754F, 0xA6C0780D9492C93F, 0x19364BD0E8CCB2B9, 0x2B481E28F6AA5B5A,
+0x83B2923E11F0B41F, 0x000000015B169BDF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0D8DFDD326188E6C, 0x2A139A9ED1C3830F, 0x47EC4615577A96C5, 0xD2A77EF3FC589101,
+0xAB5B64746007C185, 0x9B941D1B1462BBF6, 0xB02E0899D67D6AC1, 0x3C11FC24D62FE740,
+0xC3BCBBBA9C98CE6F, 0x00000000F58D3543, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x38626565B6EA5A8E, 0x3941142C235F1B4C, 0xA9B26A72F962892C, 0x9465F44F6E99D39E,
+0x327D0289DC2FC5A7, 0x7F5A973A6A8FDF56, 0x6CA9717C7B6471A2, 0x5654DA150A6E59CA,
+0x428F3ACBE0A26A36, 0x00000000D343F8A8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF0D4F781160A1BED, 0xB8574251B3791FF8, 0x94DF53F19D38D89A, 0x34BFF639159126B5,
+0x6167DAD6018C1A03, 0x46E244003B0BCB39, 0x125618C57474D9F5, 0xA3013583E233067A,
+0xF0C28CDB3CC73BA8, 0x00000000AC725F88, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEE3123D99C15EAC0, 0xF0E6A347CF45673D, 0xA26AC3237D194FAB, 0x1C097F1D1C1C0000,
+0xC3A0D920A872E6BB, 0x2B4B5A3AFFF0C113, 0x8E390AAF699C5536, 0xB0C1A2BD7AE7F6FB,
+0xDD32D807034FB35D, 0x00000000A431C415, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDECE7F707CE3E2AC, 0xAFBC548E6B4571B7, 0xF7ADECE6500DCCBA, 0x3A4C67757601E0A3,
+0x82491D499C93A487, 0xCDAB1319DD987B93, 0x027536A2293EF0BA, 0xEFF5B193F64D2CCD,
+0x1D8FE88D5F778843, 0x000000005DA2405C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1353796B03BA20A1, 0xE60A5AE584A75B4D, 0x63F45A0250AD25BD, 0x51E2C29EB3B51AE1,
+0xC8A56687EFC8617D, 0x0B9B51B517D2BF2F, 0x1824228AE7253BA7, 0xA0C4C5870A99A796,
+0x873B9B64498D679E, 0x0000000213220213, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1F0709FEA1CB467F, 0x43F81EF3117AF94D, 0xFC21E37DC1CA687B, 0x600AC277525207B8,
+0x29F21B799A9C0A32, 0x222CD09DD79521E5, 0xBB21769AF4AA1C3D, 0xAAE4496CBE6AFF21,
+0xA0474E0B6F9585D2, 0x0000000135406958, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6B71C3225F54E13D, 0x0AC7073A6D07135A, 0x9EAF2D3F3B30DF58, 0x61172D50FF6EA982,
+0x7A4DF6A7822BBA5E, 0x2B55E3F38989F040, 0x68423EF76C8F6F59, 0x73200CB115F5BD8D,
+0xC1583F7415BAF03F, 0x00000001E257BA3C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x96660916AEB8BFBF, 0x9DF5C84E0BF7539D, 0x3EFD30F5E1332547, 0x2EB8DCD71CB2256A,
+0xDB9B7EBB0B3F52F6, 0x64138E77B3D917B5, 0x3BFC6D76F43BE8C0, 0x69CFD19AEED04A08,
+0xE83FCBA813309DBE, 0x000000008F94B709, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1C23B252E756780, 0x34DC69C6F638B171, 0xE17B242D80BE1E94, 0xDE1812B6DA2A5167,
+0x4709128B213E17BB, 0xBE14E6F6FE08394C, 0x08B5769519A1AF1D, 0x63340CA1D2DA2CF7,
+0xE2D1A7B4D1BA3FFD, 0x0000000004354A2C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA128EEEE9B6F2710, 0x03BD87D19A40D5E5, 0x743DD581ED93A96C, 0x027993282BD0E59C,
+0x6A662E1AE15CDC99, 0x65179CBC8EA7B7E0, 0xD2A8BED3E09FA864, 0x9381E4AAFA25F7FF,
+0x7E303D64EFDDB69C, 0x00000002176B19D0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9487C0CF256B0E4D, 0x91BC5E7F15F21A5A, 0xD3AD1894F84A77DD, 0x79BD275148D11D76,
+0x4BFF768503B517DB, 0x076B3C73B2721904, 0xE974343EFE1DEBC5, 0x3317C8C321170D3F,
+0xDFEBF9E25BBDE0A0, 0x00000001D951C6B3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA137393F17DFC0B5, 0xDDD35E67B675DF5C, 0x7A0FA7776F87A90D, 0x19410A5853313827,
+0xEE7B5FF7717AD1A0, 0x0CC622D518D1D501, 0xE35B75C7CD908970, 0x08BC26297363B014,
+0x45ACEBAAEAED7330, 0x0000000020DC5323, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0DEBBEE03CB9017E, 0x75FAB8B9962D2A09, 0x796F225AC362DB00, 0x246D45E3C6613EE8,
+0x1551EE5B31D37558, 0xE6CE71C11C8D992B, 0x2F374A55BAD1C00E, 0x6A33E63B371A6F4F,
+0xF45BAB69DBC081D8, 0x000000023E2EC923, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4D6AA9ECE505CD30, 0xC1121893FDDB9DD8, 0x98D02102125D7903, 0x1D6B5C0435113E48,
+0x460F976443C81EA1, 0x6D81160A00222EC9, 0xE94715870E70BF47, 0xB4D09DF6F4C34093,
+0x54B173C07FF92ED8, 0x00000002662790C5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4F589EA919A6E6F4, 0xEB64EF8FB14B2F16, 0x76D368C2AC44ED35, 0x4BE523A912A53747,
+0x7415D3DBA9C1F2AC, 0x122884A51A293699, 0x08AF04512369D09F, 0x98A885F28BC1EF95,
+0x916BF01301AF9B72, 0x000000016D9D4F9D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8ED805F0E287DFEE, 0x1571112AC612BEBC, 0x4342ACA6968B1EC3, 0xFB72123D8FCBA610,
+0x3F29BD57B0DEC289, 0xF480CF65B5D8E042, 0x9EE358A3A945B576, 0x40BE7CD989DF2240,
+0x365C708EAADD7954, 0x000000015A0D3AE8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x054C0CE58B768CFD, 0x65A1FDBECE378127, 0x88F00208D94E20EA, 0x5F4CE271C1944173,
+0x541BACB01877A07C, 0x1F0A941E38ABE958, 0xD906713833D58822, 0x7FD66B00E898F44F,
+0x540329E1DC6CD2D6, 0x000000014265628D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0EC6437179E58037, 0xB8B270BD1F95EB85, 0xA7C9E1866B985F86, 0x73A94BEBDE419EF1,
+0x91C2342D1E4B11A2, 0x5F974C75A8162651, 0x7F67B2DA7804CDC0, 0xAF006B3201305E94,
+0x726DAF38057A2CA9, 0x0000000006711939, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x892CF68A6D9C5811, 0xF2F84500304ACF02, 0xF44C4B7D45F20558, 0xA53516ACD12D35FB,
+0x295C5A29F22F52BA, 0xA115683CE2DCA8AC, 0x93221C68EE13A0C8, 0x11DDE45F5B308096,
+0xBFDC6D66E633637A, 0x00000001D6231821, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFBE40FBA18C55CD5, 0x2AB10E0A9FCB0548, 0xFA1685DF455C635D, 0xDE4B0C3629100AC3,
+0x0207C63ADBF73C2D, 0xEBB78AB83906CB2F, 0xB8A342941A96192A, 0x5F2306D7F7F20517,
+0x89935A6B4DDBF86C, 0x000000017F5B5198, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8CDCC213D055EF75, 0xB6E64A79047BE9DC, 0x3003A537265FDA7D, 0xE149991FB9DDA563,
+0x0916A05C22860433, 0x1D05F646077B1113, 0x9C47A67B903BDE33, 0x7D7D19E958B615B6,
+0x90A2DF72117FB5FB, 0x00000001DF42BF68, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x726FF37ADC79885F, 0xA0CFFBCAA5A60BD6, 0xEB339C37AB26B7A2, 0x7E238E7FB37B3CEB,
+0xAC25FC43AF59E459, 0xA6AF056955E18825, 0x993F5ACE4A643266, 0xF55033B29AE75111,
+0xF3FC4125F00C8CC5, 0x000000011AAFD30D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x61CF7D7AC0CCE3C5, 0x2D2B697CDC3E5FA9, 0x86911B5B27AC6786, 0x423EA0402DE262C5,
+0x52D68157FCCEF589, 0x6AAA402D48124D38, 0x9847E7390823D846, 0x1F3652FC8170C8FE,
+0xE9D80C185EC73175, 0x000000018D8C6EBD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E1BF5603544F1DE, 0x6355CEDEC57B059A, 0x103F974D78E14756, 0xAB42ABB89DDEB9B9,
+0x95B0F8CF085D4B5F, 0x3977FE188DE8B1C4, 0x612CE9575D9BFCAC, 0x6C915108E6FF43A7,
+0xB59CAD21313E095F, 0x000000025BFDE496, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2BB56EFFC6668317, 0xF18CA69B7C2042E9, 0x3151685CE38E8626, 0x067E2EDE05937068,
+0xC40834C9BCAF8B10, 0xB46C0580E9DDA040, 0x5E1B797BD5B423FA, 0xEAFD8C1C4AFF4D60,
+0x5949654543C8DF4D, 0x00000001031D620E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8E964BCD5C13C2AD, 0xE793CB7B2AC8266C, 0xD22324C50686FBA4, 0xFE16D88B11D0B55B,
+0x8A3CE913A8950861, 0x7C2EBA5FF6FC08C4, 0x62B15F0E9FF88462, 0x50A8A30EC7FFC309,
+0x2742C2DE8CD2489C, 0x00000001736342C9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C1C0340ED9FA833, 0xB7E540604C121EFD, 0x323B5939BDC1F2E4, 0x7FD6B0EB6047DE2C,
+0xDE8FBBCCFAD3D4A9, 0xE7367A3B0C0D2626, 0x0C42E6DC1EF7F598, 0x328D8451D7122EB3,
+0xA707DF5511C627B2, 0x000000003434DEA9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4B08470EB3E16B04, 0x6FEA696D842F07E6, 0x580D333F8DA6F446, 0xE80917DBE6D54B8D,
+0x830EDA96A7F33F0A, 0xF7B40E182E049814, 0x9396C03B9A9B522A, 0x0C83454B093501E3,
+0x1CF1F7FAA3679CBA, 0x0000000121463E2A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFD5072A478BE72F9, 0x36B6DAC302216499, 0x4B62FC31711CE8A7, 0xF8EB0A0F7AF05310,
+0x51733D92B9F51D7E, 0xDE390940AFA3F668, 0x45479FC2FB822A2B, 0x96DFB56F31BE224A,
+0x59F4A925A316A8EC, 0x000000021CCA18D0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF0C3A317B70472E6, 0xA30190992A8309CF, 0x66FB6C200B7967D9, 0x10C3B5A0681058B1,
+0x1DE6A87ECFC3E08A, 0xFDB025408666DA03, 0x96EE60F4E1BF1757, 0x90659C158982551C,
+0x2E2E09B6A056973A, 0x00000000007D89C9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDA83BC7928F79DEE, 0x75881D4743099658, 0x99B2774CAF9D0671, 0x1F88BF5576E93061,
+0xCB5D795F9D9936AC, 0x6133923B50E9B698, 0x6C0675D238127970, 0x5CEBBC2771E4E33F,
+0x0C99EB4898045682, 0x000000003539BFF8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFB76F6AF0BCBC200, 0x107BE273339A05E9, 0x12E9FEB37A0092CC, 0x6F6AFB0982B1C8AF,
+0x5D5E87FCD18FD63F, 0x513939A529B1527C, 0x6C04EF7598AA1E30, 0x652DE0BDE605EDB5,
+0xB75B09137731C643, 0x000000014B5819E9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4E823DF26C8B864E, 0xEF7FA0316119A996, 0x12E9279AE6AA7F8E, 0x7ABCCAB11471628C,
+0x6EC68742B686FD7A, 0x624CDEDA9518A9CD, 0x21F18ECBC1720082, 0x9BAEF615499963E6,
+0x39035A3B62E278D3, 0x00000001BE3783C5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE25641CAC5D860B2, 0xD0F6C0AE4D00B72B, 0xBAFB2DECDCF835AF, 0xA9194E75569F8B98,
+0x112B2B0A43EE5767, 0x40C6A747EFDF443A, 0x626B1476D8AA533B, 0xB56789A2619E2D35,
+0xBE4054700026A0BB, 0x00000001F5222655, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4D0CDEF1A8FDC388, 0x9C3E9315F9F71538, 0x2A3F727773760153, 0x45BB262270C7D9FD,
+0xB313ACE207A59A6D, 0xF12E0544CFDAF94A, 0xF1A0524CB5D54640, 0x80EBBFBAEA24F973,
+0xB768363EE95A41C1, 0x0000000013B624A9, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCD9C29AACE716354, 0x293A4AB651ED87A4, 0xB676D9C4E8C1224D, 0x8885560F7135883A,
+0xEC357447BC09C946, 0x24DD315A8D75059F, 0x438B19091EBF29FF, 0x0EFCC6C6326966D7,
+0xB5A7D8BFDB540A46, 0x000000010CFDE5FE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7F7A66EAAECA1E95, 0xC48E7977CB03A456, 0xB94FB83FB36E51D4, 0x604B6A5C55C9BD80,
+0x5158B73AAB9EEE57, 0x083C7582C8C0ADB2, 0x752A0CF034590F07, 0x96E0BA614880F0D2,
+0x2D4C27B5015BD292, 0x000000015CB461AA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC827BF56D7433237, 0x92FEBBC3637BFCE9, 0x6AC3A55733CB5EB7, 0xCF83DD28CC90D223,
+0x31FAD2F84A5AAA95, 0x03D272C5BA1933CD, 0x940968856DE2B604, 0x10E5AE4B613C7998,
+0x6B3CD232629467B7, 0x00000000F509D5E2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAA0EAD56AA335CB0, 0xA3F0CE6AF025E277, 0x1210FFB4F5EB35BD, 0xA6CE645178E0D07F,
+0x557865413CCEC006, 0x00F852E5C74133C1, 0x83E1A674726F1755, 0x38D255F04A26D66B,
+0x89C049EEE664CBA9, 0x00000000449AB75B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3D8BC3A41A9AD40B, 0x108F066AA7B707A6, 0xA33672DC884B0C93, 0xD88114B0FF947D1F,
+0x357B26AB10878656, 0x49DA20260234331C, 0xA1423CB026E6B306, 0x0356180C75827D7A,
+0x5D4A2E3ABC01FF71, 0x000000019453E6EA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x71AF4C5E7D7ACD4E, 0x6618AAAB756EB69A, 0x8E00FD89D4CEF936, 0x304499872D395B85,
+0x3356E5E9D5663700, 0x2EFB546BB17D3D4F, 0xB4FDF334B28CFFB8, 0x6EAE625207149C12,
+0x0EFBDA735C416661, 0x000000004B4F17AA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB70529AEE1BD9A2E, 0x6DC0AE614EB0526C, 0xBAEA5A3FABAAB802, 0x7F89EA35FB2E4319,
+0x1BAB84173BC938FA, 0xAAFC799D9455CC21, 0x1397D11AC1C75D91, 0x4D0ED1A89CCF58EC,
+0xF99142438682EA84, 0x0000000214CF3BE7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6E276794578F09FF, 0x488C9ADA1C6007F8, 0x1FA98DD70FD520D5, 0xF4529498575064FB,
+0xBB6FA7D55680330B, 0xC210D69E04432CC1, 0x6BF119696C301C46, 0x04B710F3B20CACE8,
+0x298E463466E173D3, 0x000000014462AA09, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEB1CEA714A543476, 0xA5DEAD6D45AAE617, 0x809DC5E40BEBD41D, 0xC01E3795C8E70EB1,
+0xCDBD353DC084CF31, 0x4664D7EA2D29D20B, 0x3651A9A091E7A40A, 0xB7F7E3807D497588,
+0x0E7C17170D67BDA5, 0x000000009C4D54A7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x76E4BDA9BEC01013, 0xEE769826CC053D3E, 0x633317432AA3FD45, 0x9B162D26B6C8329B,
+0x6661F4018C6A380E, 0x1215B6FBDD6C55E5, 0x3FF6DDE8D5ADF5B9, 0xE32D2C7BDCC84578,
+0xCE9CC8BB230A0FD5, 0x00000000374581B7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x785C56C158CFEE61, 0xD7C07ECB9D047FD5, 0xCD51A9667461EDEB, 0xD8A75226D811FFCE,
+0x85F96FA5D4A00BBF, 0x53DB38B874DE6B9B, 0x92993AF81E303320, 0x88AE44BEA55E24B5,
+0x3306EE785FE11F1D, 0x0000000104568EF7, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCDBFC12A4A46B142, 0xA46858CDB7D8D474, 0x766F07ACAB7B8687, 0x3778988816E96CA8,
+0x40C85B4F8AFD8A2C, 0x5A8B558C5C9F64F6, 0x9F98AB2C28FA896D, 0x72DA91E5FB7F0B72,
+0x2510C30988506B5C, 0x000000017B7F8168, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x01700CE709959EC5, 0x5870D4D1305519C9, 0xF30D39A940D9034B, 0xC42C566082E500CC,
+0x29F199277D464897, 0x7039B0F0AAC40552, 0x459CE7E72FF33D3C, 0xEA1E24BBD862BE42,
+0x47D1FF3F62435AAA, 0x0000000171815B5B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAEFD61D9DECB3056, 0x687B04684BE450BA, 0xFA5F5CEBA74E8893, 0x2A659ED1036E041A,
+0x2BAD33A56E23A57C, 0xEACEE63141701107, 0xFDE5BCAADEC54F9A, 0x8DAB6FF45E116749,
+0xC66AB0C003326F50, 0x00000000FFF3667A, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6794F9D7CB1AD557, 0x9A89596214426CAE, 0x16233946B2109F93, 0x7EED04EA9D0B1F58,
+0x264421643A040286, 0x9C43355AA66B9716, 0x31B148672155C55D, 0x71103DA89F110AA7,
+0xFE8B199405A0BD14, 0x000000015946CB34, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF54F182227432979, 0xEAF840C0B04A5DCE, 0x3219AFA44E46DC57, 0x84089AA871DB44F5,
+0x6D60FCBC7DA6B280, 0x8B48801A570E5B3F, 0xD7986A50588EB5A8, 0x31E21D2864726FA9,
+0xACB20E0C3F392667, 0x000000026B9F49B8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1932E81F15AF77DC, 0xD4CFED87131A5875, 0xDDC562736CD12CDE, 0x8CC48E00FE9FC970,
+0xB0CBB658DB55F930, 0xE6D5B2C5B5DFE56A, 0x7EF95C5010018EC3, 0xE40DEC8766D365D2,
+0x18CAEA5A523ED180, 0x0000000236AAC170, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x723D0392A65366C2, 0xBAB7EFDAA5CAADF6, 0xA762E6B84B9392D6, 0xE0136583C12992C4,
+0x7AB7B50A3DD21E2B, 0x0F0AB09E12DEAFCC, 0x40423151BDD278B6, 0xA9758EAA50605723,
+0x147F8BD54B39E05C, 0x000000006DAE8AE8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA56792B6396460BB, 0xC920B7A842EA2342, 0xD74BB707EB26F4EA, 0xFB9BC04691ABB339,
+0x53FA442B60AB06E2, 0xE581ACB7CD98A70D, 0x251F31DAF624CE2C, 0x591D78C810F48252,
+0x6E46355345ADCF4F, 0x00000002632349AB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7F5DFAB12BD3E13F, 0x2221BEB204339F79, 0x734C06DC7148A16D, 0x3B5BCD32277E94E1,
+0x583575E97A511BEE, 0x6B18D2188526B9BF, 0xC25BC41B332C84E8, 0xC1FF31F6C0020E31,
+0x4C98E3B4DB5B662B, 0x0000000097494F76, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x39D660DF64DBD04D, 0x50E0997B5056C831, 0x3DD32AAAE8A3A54E, 0xFDBD71BE7D91D2C8,
+0x2A69101FEE8DD687, 0xF61C59F13E12BBB1, 0x5CED2F083CEB277C, 0xBB2ED68E003BEC74,
+0xF7A454F36AB92420, 0x000000021EA174E3, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B5C3A12B973C382, 0xCF6005A6E7A864D1, 0x6356B1F36FB15275, 0x1AB1E4C5914EA854,
+0x84326E5B8F5EB354, 0x1C873CA9E2B15A25, 0xEB86586084FD1CD4, 0x105B09D080CE826E,
+0x18CF5DE1A1BBA395, 0x00000001DFCCA304, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8362B22D65E7D1C9, 0x7683F659ACF18B08, 0x32F01F437E04AAC1, 0xF8982E96B6075255,
+0x216B6A8755487735, 0x1DF00FF58A0A776D, 0x4FF7D689EC7135BE, 0xD87855EFC2F04547,
+0x172A86047D5A564F, 0x0000000044660E35, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7C74D5A41A3802FA, 0x319ABC987570C9AA, 0xFF98FC18EC4397FD, 0xF5E9850C561EA62F,
+0xD6FA62FF9E701DC4, 0x2205F5C5BC6F8D62, 0x966870B8CD28DD3F, 0x15D539FA687EA4E4,
+0xEA94E2AD22249220, 0x000000017709E54E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBAE3858126725459, 0x11E7E39B8CE2956F, 0x8C78A9E85F73D170, 0xC5377F1297C5F4F7,
+0x7969768428DB7826, 0x152A72A2D3C30C53, 0x7B74762EF9D383CC, 0xC61A6F18E4D1AFA6,
+0xE6CEABEF5717050E, 0x0000000250CB37C6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D8E3160D285BE69, 0xD7E868737B94CD08, 0x57C460D132127F95, 0xADE5783457F4EBB9,
+0x4036E11719B3EC3B, 0x6CCAABDE7A8F2F51, 0x2D00C290A5041726, 0x094558DE403FA040,
+0x3F884D31611EC547, 0x0000000185C7A07C, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3EFB28DC20796CA8, 0xA897D6F0B17C3A1C, 0x202A1F5BFAA28105, 0x4F2F9D880DAC41F7,
+0xB43E99080E237304, 0xB0C6130066139643, 0x67B0486BF895153B, 0x785427E0093145B2,
+0x726237726B3E2D1C, 0x0000000141B21D00, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x13B45E555AFEB1C3, 0x4ADDE4D8229CE03A, 0x176CF9711F5DBAAF, 0x666B15AA244B63F1,
+0xAE87492DD5D2E1DF, 0xC33FE18E59469A61, 0x5471B6382F0701DF, 0xCA97E4E05DA58C49,
+0x7AB7AEE6753ABC1E, 0x00000000622C3F71, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD574BB38A56C3837, 0x56C0794C57EA8CD4, 0xBC455EAB21CB1990, 0xAD729C3269DF79FD,
+0x783B0567D751EA76, 0x0EFA972793EFE290, 0x64BCFB14860181E6, 0x31A0B51C3F6BC015,
+0x96C989AFF3A80367, 0x0000000175B4A58F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x80AB27D98A7B6F82, 0x1CE9538A6FD32FE7, 0x9F8E57053FBBF685, 0x077425BEBD3DDA5C,
+0x54739B6229EF1D96, 0x5D602EE5EB5F1FE0, 0x3F40C04EE0C9D4C7, 0x8CB20AAFC4400E50,
+0x5C8C6D82464D7F27, 0x0000000141221939, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14BA04E0363D8BCA, 0x3F97D761F1F095DF, 0x04AD289A7F4F414C, 0x948DBA68E073A81D,
+0xAF4823B88CA405F2, 0xB21972455407AB28, 0xE7BAB557DD011175, 0xBD0B469BFE63DDF0,
+0x794A221A120431C4, 0x000000013AC9F79B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1DB4275B8710F589, 0x935E9C6FB0B77829, 0x8D0F26A69730BDA3, 0xBE31C8CADACC3E70,
+0x17B4B91D98508674, 0x01A04684FB2789AF, 0x4780BAEC9B4839C2, 0x025570E38E4BC1E7,
+0x11339B272C996BE3, 0x00000000554D45D5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF6CCD369BC08729D, 0xEAFE548CC369BDD7, 0x0DC0FBC70B39D7C8, 0xA26BF87DF209CB63,
+0xC612919F43686EBE, 0x232AFD252EC9E982, 0x693447E3C027E4D3, 0x86920C638F63E0E8,
+0x8A229BAACC5CA2DB, 0x000000015152D6FF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5F841D0FA75DD022, 0x2E35C94FBDAB8560, 0x706F961C047439CF, 0xE9A347624A713767,
+0xDE1C74E0F252B0B9, 0x26C8E106B1C6D5FF, 0x19B796172AAF2AD1, 0x65DA1804A4A6A3C5,
+0x06D945AAD7297B17, 0x000000002501D1BB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x03A698084D7A5A28, 0x15C5E2AF8A17343F, 0x8CED5417CB71D3B9, 0xDF22DD622FC059A9,
+0x35BD224CB0ECB04D, 0xF10362AB7974C927, 0xCA646FA222E1DA25, 0xB98485035083C7A3,
+0xF01AE126D1E78590, 0x00000001C7981B68, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1CAF5BE407CC8056, 0x10D532DBA907913C, 0x2C3508BF84992C5F, 0x175216658E7C52BB,
+0x2B908A1D0443BA15, 0xAD85CF185C3CC90C, 0x366B080ABCEBA243, 0xE6F2C24154349EEC,
+0xD6E45A8801B69435, 0x000000013F920698, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0ED4F7E5B883D3FE, 0x65B1A1AA75281B17, 0xDD55EAD7CCE272EB, 0xAE09B66AA9E3213D,
+0xFBC749CA9F11EA71, 0x60FBF7E84186E155, 0xE6EE9FB04683DFC1, 0x24A5CBF6C51F7A4A,
+0x28B2B5BF9A415E86, 0x000000022B470BC5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3033D3ECB436E363, 0xDE8C0689B872D945, 0xEE32F8140D02BF13, 0xB5A86282FEED8FCA,
+0xA15B7732614D68B8, 0x4A37AC0C581E1AEB, 0x5F7B3331516B35B1, 0xC3527A7B93228664,
+0x1D26CECA906F1BCE, 0x00000000AE99E502, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x156FA78D5648F371, 0x0E5F8AD7AD27DFAA, 0x46FA53CFF2C2357D, 0x45119F07BF10D45C,
+0xCE720B41315BE875, 0x26B4414B2E582A51, 0x8C934B9B62541EB0, 0x75B1BB15750FE398,
+0x4E0AEFF0D33158AB, 0x000000022A12BBCE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC0B8A8FBDF80FD28, 0x54DC32CD082F12C9, 0x8735237FE6251E15, 0x14ABC8F5019DF452,
+0x5EE519A270291FA4, 0xD78C1E4DE83D5009, 0x950CB3267BB7B4FA, 0x18741AC72541BBDE,
+0x9BF45AA2BE38781A, 0x00000000B64E9AAA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB473C33B3488CD0A, 0xCF3D452A7B5E060E, 0x078E9C71E57E1221, 0x6CB9F7F6383480CD,
+0x30824315FBC2E58B, 0x320C24E6A4569E63, 0x257E56DC8E860358, 0x76ED18E7C53BE943,
+0x33BF05034121A34A, 0x00000000EB88B0A2, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB94D6F9C6BEA528B, 0x57E23F0394B26C03, 0xD5CAA385219105E5, 0x4A82773305B2C2D2,
+0x61A8E7985EBBB630, 0x632C54C386125BC1, 0xEB7A41B34047A0D1, 0x9ABCC45E1D587A0F,
+0x8BA6D22E47642C2D, 0x00000000170554F8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4211B4112FF449E6, 0x1FF957A16BEB6A54, 0x7B0CADF8A7A8B588, 0xCD1C057581E3B1E9,
+0xBECD0BD669ABB1BA, 0xB8B9C50D2316324F, 0xFE7DCBFBDAACD9C5, 0xB7EE18C3E8087E0E,
+0x64B6D9C837CE01D9, 0x0000000267E5AF5E, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x39138E3B935C0C98, 0xF1D14DC536084273, 0x3C12C0A505A3BED7, 0x96DD5D716A6D4841,
+0x9F650171FDA30666, 0x8CD3F08287D009AE, 0x4AA7434E8A438562, 0x1677953E15228D7A,
+0x517DDF5A36C169C5, 0x000000013E9310F8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x20320C8720EFF139, 0x7BB6C22143BF5FD9, 0x9E2DDB7F129709B0, 0x6BB19A9C13E809E5,
+0x27F9601C5381B1F8, 0xB97E6CE05035C0DA, 0x97B61879696D0080, 0x6D84AE8E2E31394B,
+0xE4888C21FF784327, 0x0000000246CEB729, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC229F2C46480F5D6, 0xD0D9CB9E4E34D5DA, 0xE11A83CAADC2F322, 0x270B6B52CB9DBF24,
+0x25E9749A5E4D98BF, 0x7E76836DBB679CDD, 0xEE9247BFCED2946A, 0x46D4D88B5692A2C7,
+0x03618ABBD0F9D705, 0x000000010E9810BF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x52F2DE6707E8B294, 0xFB974E217244451D, 0x18F61708F6956E5F, 0x1F86D7A32AB535C1,
+0xBF6AB0551D9C5900, 0x44E7E1600BC4153E, 0x8B2E5DFC4847E85C, 0x3A45EACA94EA5F0C,
+0x2FD9E5D268F8BBC2, 0x00000001BF975AEE, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDB71CC75CC58EBEF, 0x7BBFB7FACDA0CADF, 0xAC44ACAA23AA8452, 0x57316EBB85301BE6,
+0x793DD9B223623C13, 0xCE0168FEC8BA40C2, 0xA014B86CB02DBD2B, 0x7055CAF1A2398FB2,
+0x7F2ED2FE00D0AA2E, 0x00000000E0F4C66F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4F92839FBE0B2C88, 0x751B7F5F1F92A637, 0xA32C2C887064D895, 0xBBFD418E19FF2800,
+0xC7C9794229B923DE, 0xF6C49D307F921140, 0xCEEA449F1BA1031C, 0xF82EE6ECD79A1A84,
+0xCFDFC366D3C31F0E, 0x00000000BBC2DB9F, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1F5DF45F0C9A385, 0x82BA013B0CFB0922, 0x9B47E02F15F5E1A2, 0x891799A00298F2B4,
+0x9627A466FA2C630B, 0x803895221500D2F4, 0xD4296CE01FC4C83D, 0x1FF2A8228EDE1F76,
+0x42F3E4A57DFEAD04, 0x0000000024CF6979, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC3EDB5E4F674E780, 0xED5096F2B9EB193D, 0x741104925C936041, 0x26D899BF440A7312,
+0x65A12F8359A3D398, 0xFCA63BA560058963, 0xFC5F66F36DE38BD1, 0x69DE274E86BA59CE,
+0x4868428C0F510047, 0x0000000261E43412, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9F741BB6AA1DB94, 0x182F24D77397A47B, 0x17C07AE34D7AA0CF, 0x220A64AE7C0885D1,
+0xA7C2163380CB975E, 0x6375087C96CBB7E4, 0x14E352607D67291B, 0x956199656A371138,
+0x1171AE4BF927AE70, 0x00000000CEB0ABE5, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD4D60E17D957A86B, 0x18824F5E2FA23FC7, 0x3E5F6FCE99BBE06F, 0x060B7A44ADE56528,
+0x3819C7249D765E1A, 0x3B860BD514242FBD, 0x0DEF0E1A05738436, 0x3F4A1024B6457EB0,
+0x1E24A089B3E9AB25, 0x00000001B08E31AF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE307248783A54301, 0x073156EC2222DBAF, 0xE84F820F51B8D24D, 0x1F986818FE449D6D,
+0x2615A5F35ABCC79D, 0x2DDE1E64CDF19130, 0x0D61AF078DFB3DA2, 0x631FA698C42D3C68,
+0x28CB53381B46B678, 0x00000000CE0023F0, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x070673A93BAA7970, 0x488836B9907CDF05, 0x5C53A18C7AE9D3E5, 0xA9FF251A5171366D,
+0xA9439160C55ED48D, 0x890026A2EB502CF9, 0x3225E9858093AC7F, 0xAE5DCBC5AFCCB90A,
+0xA3EDA779E656740A, 0x00000000BFBA2125, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB0ECAFB6D9756C6A, 0xC2072130F1B25678, 0x43F2FE62A87263DC, 0x5544AB3C8BC63993,
+0x56E7AEFEE834B782, 0x7B31C5B1F352EA0E, 0x90F045BF0884E47F, 0x7045E953559E2121,
+0x77A104849453B3D4, 0x0000000028B82A06, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x459A2EFB4C3F95C2, 0xDDBFCB8424ACE610, 0x38BD0DC0C40330CC, 0x5F233B04E66C065C,
+0x9F0B08029DF7A383, 0x5B55E787B743D570, 0xCB2F1A1A5041F785, 0xC38E4A797679C4E8,
+0xB7F121985E3CEA5A, 0x00000001C8E7B30B, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x602E925D70F8D88B, 0x0DEB7D49F6832A29, 0x449DB50D52C443A0, 0x4E1508B9553722D0,
+0x5526417BCC0B9CFA, 0xBA39AF3358E6E499, 0x0F6A4FA84474A00A, 0xC693A14E7BAB85CC,
+0x2415692B76270B50, 0x00000001C8A0BFDB, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4E26A54FBDE83029, 0xA56530D3724D874A, 0x9CE1C3FC06072D63, 0x8F0BA9B5C55152C6,
+0xFAEBBB7DF9625D3F, 0xD460BC4DF4530584, 0xC68BEEE878451F93, 0x7A4A6310D42798D4,
+0x65CB17ABB94B2E3A, 0x0000000177BA19E6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3DFA642399DBA7B5, 0xC0FDCF7316742061, 0xAD9253D23AC0A78E, 0x09CB7EDC8231E7C1,
+0xC8DDDD9CA424CEBC, 0xF945F626D09C0970, 0x04478D5AE5894885, 0x234260B01E0A664B,
+0x027633436EB27B54, 0x00000002563011DF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x69E0E3B8DF58713D, 0xF9193EEAAAF5419A, 0x54D3D548A1706360, 0x81868582121A40A1,
+0x6B4A48A180F87A56, 0xDDCE3E6778AF1BD5, 0x930AFB2A0493187E, 0x433F574C69A21752,
+0xFDFAFE5DB75577CD, 0x0000000174FB65F8, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEEA32B806493A746, 0x190B22AF44F16175, 0x587CA34E05851A72, 0xAD5EC81CD56960BC,
+0x7A6FD60F5CF5215E, 0x8D7DAF4E432A0DC9, 0x19D5A09EB9F1ADFA, 0xC8A7F3031D733513,
+0x7F8C7A8D5F27B8BD, 0x0000000030933395, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x58B5BC53F9365891, 0x1036808C72173298, 0x4B96AE375123F6C5, 0x8B20969118629BB0,
+0x454CFD590CBA1049, 0x282461FF7B761226, 0x4B4C44AD9828A17B, 0x488F63F5880EF0FF,
+0xCC8CD536A25E7468, 0x0000000233A024E6, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x84BB8AE155E9107C, 0xBBB7A76AD942AE87, 0xB4502EEA7547A661, 0xE9D81C056B877E9B,
+0xC32A5DC9F689C088, 0x8EB47ECF007A3383, 0x9E415274B0B97073, 0xABFE3436889036F0,
+0xB650D06850367C94, 0x00000000D3699BDF, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x87B8A44046356CA2, 0x118E9AD6548C6591, 0x08236940D2CE6131, 0x21953FDA21E8D842,
+0x005BB77076784A82, 0xE32F5D40647C382B, 0xF2D858EC100768A7, 0xEA97B8FD9B6B603E,
+0x5728927E1558F378, 0x000000003418E8AD, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6028015063017CAF, 0x35AA10592FE86102, 0xC14B5DBB622C7E8E, 0x232C6CF4C9CEE153,
+0x78B9F826A4458D95, 0xDD2F376A8776754C, 0x719BA4D4D1F104E3, 0x5AF1DB13B991C45C,
+0xE9F6B90C9E3400DE, 0x000000024E9A6F51, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A1B47AA615AFF53, 0xA8A845A84A047C42, 0x4421BD6D1ED16A93, 0x32434271E1233C7C,
+0x88379BDDA87BB415, 0xBA3DCA55BDBF8AE2, 0x855BF204D12EF635, 0xF9D27AE8658F33B8,
+0xFEF232FF95A8FBE5, 0x00000001B4D45646, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE711AA79560029DE, 0xBBD016DC17CEF7EF, 0x20A3CBB7659FD980, 0x4AB289222E32590D,
+0x8D69672502A16C78, 0xED9136E582832830, 0x525BB21375343A49, 0xEF4388A0B05258FB,
+0x563117226F7DAF6A, 0x00000001883A80EA, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37460326B24CA32D, 0xED2DD31701A08519, 0x6B2BC58066DA247A, 0xE08384D4BAAD8B6E,
+0x69E8C7970CD1066D, 0x3345EDDCDEEE82BA, 0xF49BC7C08EA96B1A, 0xFD405DBA74D5B1D8,
+0xD7A07CE7B85DA1C7, 0x0000000183DE5E15, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE99C86CA5E3C16FA, 0xB1E211BD74F357D0, 0xF62351A14180041D, 0x5E659CC99D4A8690,
+0x76F3CFF9FA16C289, 0xBAA146E611D73F42, 0x2361C8BB75B563E8, 0x36FA530EF63473DA,
+0x0F4297B209BADF5C, 0x0000000051A89D1D, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
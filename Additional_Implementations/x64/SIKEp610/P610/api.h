@@ -36,6 +36,23 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
 // Outputs: shared secret ss      (CRYPTO_BYTES = 24 bytes)
 int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
 
+// SIKE's key generation of n key pairs
+// Outputs: n secret keys sk (n*CRYPTO_SECRETKEYBYTES bytes, one after the other)
+//          n public keys pk (n*CRYPTO_PUBLICKEYBYTES bytes, one after the other)
+int crypto_kem_keypair_batch(unsigned int n, unsigned char *pk, unsigned char *sk);
+
+// SIKE's encapsulation under n public keys, the i-th ciphertext and shared secret are computed with the i-th public key
+// Input:   n public keys pk          (n*CRYPTO_PUBLICKEYBYTES bytes, one after the other)
+// Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes, one after the other)
+//          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes, one after the other)
+int crypto_kem_enc_batch(unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+
+// SIKE's decapsulation of n ciphertexts under the same secret key
+// Input:   secret key sk             (CRYPTO_SECRETKEYBYTES bytes)
+//          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes, one after the other)
+// Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes, one after the other)
+int crypto_kem_dec_batch(unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
 
 // Encoding of keys for KEM-based isogeny system "SIKEp610" (wire format):
 // ----------------------------------------------------------------------
@@ -0,0 +1,198 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: worker pool for the parallel evaluation of isogenies at the points stored
+*           during the isogeny tree traversals
+*********************************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#ifndef NTHREADS
+    #define NTHREADS          4           // Maximum number of threads evaluating isogenies, including the calling thread
+#endif
+#define POOL_SPINS            (1 << 16)   // Number of polls of an idle worker before it goes to sleep
+#define POOL_MAX_POINTS       (((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB) + 3)
+
+#if (TARGET == TARGET_AMD64 || TARGET == TARGET_x86) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    #define cpu_relax()       __builtin_ia32_pause()
+#elif (TARGET == TARGET_ARM64) && (COMPILER == COMPILER_GCC || COMPILER == COMPILER_CLANG)
+    #define cpu_relax()       __asm__ __volatile__ ("yield")
+#else
+    #define cpu_relax()
+#endif
+
+
+static struct {
+    pthread_once_t once;
+    pthread_mutex_t owner;              // Held by the thread that dispatches the current job
+    pthread_mutex_t lock;               // Protects the sleeping workers
+    pthread_cond_t wake;
+    atomic_uint generation;             // Incremented for every new job
+    atomic_uint sleepers;
+    atomic_uint done;                   // Number of workers that finished the current job
+    unsigned int nthreads;
+    // Current job
+    point_proj* points[POOL_MAX_POINTS];
+    unsigned int npoints;
+    unsigned int AliceOrBob;
+    f2elm_t* coeff;
+} pool = { PTHREAD_ONCE_INIT, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, 0, 0, 1 };
+
+
+static void pool_eval_share(const unsigned int id)
+{ // Evaluates the isogeny of the current job at every nthreads-th point, starting at point id
+    unsigned int i;
+
+    for (i = id; i < pool.npoints; i += pool.nthreads) {
+        if (pool.AliceOrBob == ALICE) {
+            eval_4_isog(pool.points[i], pool.coeff);
+        } else {
+            eval_3_isog(pool.points[i], pool.coeff);
+        }
+    }
+}
+
+
+static void* pool_worker(void* arg)
+{ // Spin-waits for new jobs, and sleeps after POOL_SPINS unsuccessful polls
+    const unsigned int id = (unsigned int)(uintptr_t)arg;
+    unsigned int seen = 0, generation, spins = 0;
+
+    while (true) {
+        generation = atomic_load_explicit(&pool.generation, memory_order_acquire);
+        if (generation == seen) {
+            if (++spins < POOL_SPINS) {
+                cpu_relax();
+                continue;
+            }
+            pthread_mutex_lock(&pool.lock);
+            atomic_fetch_add(&pool.sleepers, 1);
+            while (atomic_load(&pool.generation) == seen) {
+                pthread_cond_wait(&pool.wake, &pool.lock);
+            }
+            atomic_fetch_sub(&pool.sleepers, 1);
+            pthread_mutex_unlock(&pool.lock);
+            spins = 0;
+            continue;
+        }
+        seen = generation;
+        spins = 0;
+        pool_eval_share(id);
+        atomic_fetch_add_explicit(&pool.done, 1, memory_order_release);
+    }
+    return NULL;
+}
+
+
+static void pool_atfork_child(void)
+{ // The workers do not exist in a forked child, so it evaluates serially
+    pool.nthreads = 1;
+}
+
+
+static void pool_init(void)
+{ // Starts up to NTHREADS-1 workers, each pinned to its own available CPU. The first available CPU is left to the calling thread.
+    unsigned int i, n = 0, cpus[NTHREADS];
+    pthread_t thread;
+    pthread_attr_t attr;
+#if defined(__linux__)
+    cpu_set_t set;
+
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (i = 0; i < CPU_SETSIZE && n < NTHREADS; i++) {
+            if (CPU_ISSET(i, &set)) cpus[n++] = i;
+        }
+    }
+#else
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+
+    for (i = 0; (long)i < online && n < NTHREADS; i++) {
+        cpus[n++] = i;
+    }
+#endif
+    if (n < 2 || pthread_attr_init(&attr) != 0) return;
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    pool.nthreads = n;
+    for (i = 1; i < n; i++) {
+#if defined(__linux__)
+        CPU_ZERO(&set);
+        CPU_SET(cpus[i], &set);
+        pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+#endif
+        if (pthread_create(&thread, &attr, pool_worker, (void*)(uintptr_t)i) != 0) {
+            pool.nthreads = i;
+            break;
+        }
+    }
+    pthread_attr_destroy(&attr);
+    pthread_atfork(NULL, NULL, pool_atfork_child);
+}
+
+
+static void pool_eval(const unsigned int AliceOrBob, point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates an isogeny at the npts points in pts and at the points P, Q and R that are not NULL, distributed over the pool.
+  // Falls back to serial evaluation on single-CPU hosts, for single points and while the pool is in use by another thread.
+    unsigned int i, n = 0, spins = 0;
+    point_proj* extra[3] = {P, Q, R};
+
+    pthread_once(&pool.once, pool_init);
+    n = npts + (P != NULL) + (Q != NULL) + (R != NULL);
+    if (pool.nthreads < 2 || n < 2 || pthread_mutex_trylock(&pool.owner) != 0) {
+        for (i = 0; i < npts; i++) {
+            if (AliceOrBob == ALICE) eval_4_isog(pts[i], coeff);
+            else                     eval_3_isog(pts[i], coeff);
+        }
+        for (i = 0; i < 3; i++) {
+            if (extra[i] == NULL) continue;
+            if (AliceOrBob == ALICE) eval_4_isog(extra[i], coeff);
+            else                     eval_3_isog(extra[i], coeff);
+        }
+        return;
+    }
+
+    n = 0;
+    for (i = 0; i < npts; i++) {
+        pool.points[n++] = pts[i];
+    }
+    for (i = 0; i < 3; i++) {
+        if (extra[i] != NULL) pool.points[n++] = extra[i];
+    }
+    pool.npoints = n;
+    pool.AliceOrBob = AliceOrBob;
+    pool.coeff = coeff;
+    atomic_store_explicit(&pool.done, 0, memory_order_relaxed);
+
+    // Publish the job, waking up the workers that went to sleep
+    atomic_fetch_add(&pool.generation, 1);
+    if (atomic_load(&pool.sleepers) != 0) {
+        pthread_mutex_lock(&pool.lock);
+        pthread_cond_broadcast(&pool.wake);
+        pthread_mutex_unlock(&pool.lock);
+    }
+
+    pool_eval_share(0);
+    while (atomic_load_explicit(&pool.done, memory_order_acquire) != pool.nthreads-1) {
+        if (++spins < POOL_SPINS) {
+            cpu_relax();
+        } else {    // A worker was preempted, possibly on the CPU of the calling thread
+            sched_yield();
+        }
+    }
+    pthread_mutex_unlock(&pool.owner);
+}
+
+
+static void eval_4_isog_parallel(point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates a 4-isogeny at the stored points pts[0..npts-1] and at P, Q and R (if not NULL)
+    pool_eval(ALICE, pts, npts, P, Q, R, coeff);
+}
+
+
+static void eval_3_isog_parallel(point_proj_t* pts, const unsigned int npts, point_proj* P, point_proj* Q, point_proj* R, f2elm_t* coeff)
+{ // Evaluates a 3-isogeny at the stored points pts[0..npts-1] and at P, Q and R (if not NULL)
+    pool_eval(BOB, pts, npts, P, Q, R, coeff);
+}
@@ -0,0 +1,849 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: ephemeral SIDH isogeny computations in eight lanes using AVX-512 IFMA
+*********************************************************************************************/
+
+#include <immintrin.h>
+#include <cpuid.h>
+#include <string.h>
+
+// Every lane of a vector belongs to a different operation, and a field element is spread over NLIMBS_52 vectors
+// that hold its limbs in radix 2^52. Elements are in Montgomery representation with R' = 2^(52*NLIMBS_52) >= R,
+// so the functions below accept and return values in the same ranges as their single-lane counterparts
+#define MASK_52         0xFFFFFFFFFFFFFULL
+
+typedef __m512i felm_x8_t[NLIMBS_52];
+typedef felm_x8_t f2elm_x8_t[2];
+typedef struct { f2elm_x8_t X; f2elm_x8_t Z; } point_proj_x8;
+typedef point_proj_x8 point_proj_x8_t[1];
+
+extern const uint64_t A_gen[6*NWORDS64_FIELD];
+extern const uint64_t B_gen[6*NWORDS64_FIELD];
+extern const unsigned int strat_Alice[MAX_Alice-1];
+extern const unsigned int strat_Bob[MAX_Bob-1];
+
+// Set when the processor supports AVX-512 IFMA, see fp_ifma_init()
+int fp_ifma_enabled = 0;
+
+
+static inline __attribute__((always_inline)) void normalize_x8(felm_x8_t a)
+{ // Carry propagation, leaves limbs in [0, 2^52-1] except the most significant one, which keeps the sign of a
+    const __m512i mask = _mm512_set1_epi64(MASK_52);
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52-1; i++) {
+        a[i+1] = _mm512_add_epi64(a[i+1], _mm512_srai_epi64(a[i], 52));
+        a[i] = _mm512_and_si512(a[i], mask);
+    }
+}
+
+
+static inline void fpcopy_x8(const felm_x8_t a, felm_x8_t c)
+{ // Copy of eight field elements, c = a
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = a[i];
+}
+
+
+static inline void fpset_x8(const uint64_t* a, felm_x8_t c)
+{ // Broadcast of a constant in radix 2^52 to all the lanes
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = _mm512_set1_epi64((long long)a[i]);
+}
+
+
+static void fpmul_mont_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Montgomery multiplication in each lane, c = a*b*R'^-1 mod p.
+  // If a*b < R'*p, the outputs are in the range [0, 2*p-1].
+    const __m512i mask = _mm512_set1_epi64(MASK_52), zero = _mm512_setzero_si512();
+    __m512i t[NLIMBS_52], bi, q, carry;
+    unsigned int i, j;
+
+    for (j = 0; j < NLIMBS_52; j++)
+        t[j] = zero;
+
+    for (i = 0; i < NLIMBS_52; i++) {
+        bi = b[i];
+        for (j = 0; j < NLIMBS_52; j++)
+            t[j] = _mm512_madd52lo_epu64(t[j], a[j], bi);
+
+        // -p^-1 = 1 mod 2^52, so the quotient digit is the lowest limb. Adding q*p clears its 52 lower bits
+        q = _mm512_and_si512(t[0], mask);
+        for (j = 0; j < NLIMBS_52; j++)
+            t[j] = _mm512_madd52lo_epu64(t[j], _mm512_set1_epi64((long long)p_52[0][j]), q);
+
+        // Division by 2^52, the high halves of the products land on the shifted limbs
+        carry = _mm512_srli_epi64(t[0], 52);
+        for (j = 0; j < NLIMBS_52-1; j++)
+            t[j] = t[j+1];
+        t[NLIMBS_52-1] = zero;
+        t[0] = _mm512_add_epi64(t[0], carry);
+        for (j = 0; j < NLIMBS_52; j++)
+            t[j] = _mm512_madd52hi_epu64(t[j], a[j], bi);
+        for (j = 0; j < NLIMBS_52; j++)
+            t[j] = _mm512_madd52hi_epu64(t[j], _mm512_set1_epi64((long long)p_52[0][j]), q);
+    }
+
+    normalize_x8(t);
+    fpcopy_x8(t, c);
+}
+
+
+static inline void mp_add_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Addition without reduction, c = a+b
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = _mm512_add_epi64(a[i], b[i]);
+    normalize_x8(c);
+}
+
+
+static inline void mp_sub_px_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c, const unsigned int k)
+{ // Subtraction followed by the addition of a multiple of p, c = a-b+2^k*p for k = 1 or 2
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = _mm512_add_epi64(_mm512_sub_epi64(a[i], b[i]), _mm512_set1_epi64((long long)p_52[k][i]));
+    normalize_x8(c);
+}
+
+
+static inline void fpcorrect_x8(felm_x8_t a)
+{ // Adds 2*p to the lanes in which a is negative, a is normalized
+    __mmask8 neg = _mm512_cmplt_epi64_mask(a[NLIMBS_52-1], _mm512_setzero_si512());
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        a[i] = _mm512_mask_add_epi64(a[i], neg, a[i], _mm512_set1_epi64((long long)p_52[1][i]));
+    normalize_x8(a);
+}
+
+
+static void fpadd_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Modular addition, c = a+b mod p. Inputs and outputs are in [0, 2*p-1]
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = _mm512_sub_epi64(_mm512_add_epi64(a[i], b[i]), _mm512_set1_epi64((long long)p_52[1][i]));
+    normalize_x8(c);
+    fpcorrect_x8(c);
+}
+
+
+static void fpsub_x8(const felm_x8_t a, const felm_x8_t b, felm_x8_t c)
+{ // Modular subtraction, c = a-b mod p. Inputs and outputs are in [0, 2*p-1]
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        c[i] = _mm512_sub_epi64(a[i], b[i]);
+    normalize_x8(c);
+    fpcorrect_x8(c);
+}
+
+
+static void fpdiv2_x8(const felm_x8_t a, felm_x8_t c)
+{ // Modular division by two, c = a/2 mod p
+    const __m512i mask = _mm512_set1_epi64(MASK_52);
+    __mmask8 odd = _mm512_test_epi64_mask(a[0], _mm512_set1_epi64(1));
+    felm_x8_t t;
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_52; i++)
+        t[i] = _mm512_mask_add_epi64(a[i], odd, a[i], _mm512_set1_epi64((long long)p_52[0][i]));
+    normalize_x8(t);
+    for (i = 0; i < NLIMBS_52-1; i++)
+        c[i] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(t[i], 1), _mm512_slli_epi64(t[i+1], 51)), mask);
+    c[NLIMBS_52-1] = _mm512_srli_epi64(t[NLIMBS_52-1], 1);
+}
+
+
+static inline void fp2copy_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // Copy of eight GF(p^2) elements, c = a
+    fpcopy_x8(a[0], c[0]);
+    fpcopy_x8(a[1], c[1]);
+}
+
+
+static inline void fp2set_x8(const uint64_t* a, f2elm_x8_t c)
+{ // Broadcast of a constant a in GF(p), in radix 2^52, to all the lanes of c = a+0*i
+    fpset_x8(a, c[0]);
+    memset(c[1], 0, sizeof(felm_x8_t));
+}
+
+
+static inline void mp2_add_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition without reduction, c = a+b
+    mp_add_x8(a[0], b[0], c[0]);
+    mp_add_x8(a[1], b[1], c[1]);
+}
+
+
+static inline void mp2_sub_p2_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) subtraction with correction with 2*p, c = a-b+2p
+    mp_sub_px_x8(a[0], b[0], c[0], 1);
+    mp_sub_px_x8(a[1], b[1], c[1], 1);
+}
+
+
+static inline void fp2add_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) addition, c = a+b in GF(p^2)
+    fpadd_x8(a[0], b[0], c[0]);
+    fpadd_x8(a[1], b[1], c[1]);
+}
+
+
+static inline void fp2sub_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) subtraction, c = a-b in GF(p^2)
+    fpsub_x8(a[0], b[0], c[0]);
+    fpsub_x8(a[1], b[1], c[1]);
+}
+
+
+static inline void fp2div2_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // GF(p^2) division by two, c = a/2 in GF(p^2)
+    fpdiv2_x8(a[0], c[0]);
+    fpdiv2_x8(a[1], c[1]);
+}
+
+
+static void fp2mul_mont_x8(const f2elm_x8_t a, const f2elm_x8_t b, f2elm_x8_t c)
+{ // GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2).
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1]
+    felm_x8_t t1, t2, tt1, tt2, tt3;
+
+    mp_add_x8(a[0], a[1], t1);                      // t1 = a0+a1
+    mp_add_x8(b[0], b[1], t2);                      // t2 = b0+b1
+    fpmul_mont_x8(a[0], b[0], tt1);                 // tt1 = a0*b0
+    fpmul_mont_x8(a[1], b[1], tt2);                 // tt2 = a1*b1
+    fpmul_mont_x8(t1, t2, tt3);                     // tt3 = (a0+a1)*(b0+b1)
+    fpsub_x8(tt1, tt2, c[0]);                       // c0 = a0*b0 - a1*b1
+    fpsub_x8(tt3, tt1, tt3);
+    fpsub_x8(tt3, tt2, c[1]);                       // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+}
+
+
+static void fp2sqr_mont_x8(const f2elm_x8_t a, f2elm_x8_t c)
+{ // GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2).
+  // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1]
+    felm_x8_t t1, t2, t3;
+
+    mp_add_x8(a[0], a[1], t1);                      // t1 = a0+a1
+    mp_sub_px_x8(a[0], a[1], t2, 2);                // t2 = a0-a1+4p
+    mp_add_x8(a[0], a[0], t3);                      // t3 = 2a0
+    fpmul_mont_x8(t1, t2, c[0]);                    // c0 = (a0+a1)(a0-a1)
+    fpmul_mont_x8(t3, a[1], c[1]);                  // c1 = 2a0*a1
+}
+
+
+static void fp2_to_x8(const f2elm_t* a, const unsigned int stride, f2elm_x8_t c)
+{ // Conversion of eight GF(p^2) elements in Montgomery representation with R to the lanes of c, in Montgomery
+  // representation with R'. Lane j receives a[j*stride], so that stride = 0 broadcasts a[0] to all the lanes
+    uint64_t t[NLIMBS_52][IFMA_LANES] __attribute__((aligned(64)));
+    felm_x8_t r;
+    unsigned int i, j, k, w, s;
+
+    fpset_x8(to_mont_52, r);
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < IFMA_LANES; j++) {
+            const digit_t* x = a[j*stride][k];
+            for (i = 0; i < NLIMBS_52; i++) {
+                w = (52*i) / 64;
+                s = (52*i) % 64;
+                t[i][j] = x[w] >> s;
+                if (s > 12 && w+1 < NWORDS_FIELD) {
+                    t[i][j] |= x[w+1] << (64-s);
+                }
+                t[i][j] &= MASK_52;
+            }
+        }
+        for (i = 0; i < NLIMBS_52; i++)
+            c[k][i] = _mm512_load_si512(t[i]);
+        fpmul_mont_x8(c[k], r, c[k]);
+    }
+}
+
+
+static void fp2_from_x8(const f2elm_x8_t a, f2elm_t* c, const unsigned int stride)
+{ // Conversion of the lanes of a to GF(p^2) elements in Montgomery representation with R, lane j is written to c[j*stride].
+  // The outputs are in the range [0, 2*p-1]
+    uint64_t t[NLIMBS_52][IFMA_LANES] __attribute__((aligned(64)));
+    felm_x8_t r, u;
+    unsigned int i, j, k, w, s;
+
+    fpset_x8(from_mont_52, r);
+    for (k = 0; k < 2; k++) {
+        fpmul_mont_x8(a[k], r, u);
+        for (i = 0; i < NLIMBS_52; i++)
+            _mm512_store_si512(t[i], u[i]);
+        for (j = 0; j < IFMA_LANES; j++) {
+            digit_t* x = c[j*stride][k];
+            for (w = 0; w < NWORDS_FIELD; w++)
+                x[w] = 0;
+            for (i = 0; i < NLIMBS_52; i++) {
+                w = (52*i) / 64;
+                s = (52*i) % 64;
+                x[w] |= t[i][j] << s;
+                if (s > 12 && w+1 < NWORDS_FIELD) {
+                    x[w+1] |= t[i][j] >> (64-s);
+                }
+            }
+        }
+    }
+}
+
+
+static void xDBL_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24plus, const f2elm_x8_t C24)
+{ // Doubling of a Montgomery point in projective coordinates (X:Z), see xDBL()
+    f2elm_x8_t t0, t1;
+
+    mp2_sub_p2_x8(P->X, P->Z, t0);                  // t0 = X1-Z1
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = X1+Z1
+    fp2sqr_mont_x8(t0, t0);                         // t0 = (X1-Z1)^2
+    fp2sqr_mont_x8(t1, t1);                         // t1 = (X1+Z1)^2
+    fp2mul_mont_x8(C24, t0, Q->Z);                  // Z2 = C24*(X1-Z1)^2
+    fp2mul_mont_x8(t1, Q->Z, Q->X);                 // X2 = C24*(X1-Z1)^2*(X1+Z1)^2
+    mp2_sub_p2_x8(t1, t0, t1);                      // t1 = (X1+Z1)^2-(X1-Z1)^2
+    fp2mul_mont_x8(A24plus, t1, t0);                // t0 = A24plus*[(X1+Z1)^2-(X1-Z1)^2]
+    mp2_add_x8(Q->Z, t0, Q->Z);                     // Z2 = A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2
+    fp2mul_mont_x8(Q->Z, t1, Q->Z);                 // Z2 = [A24plus*[(X1+Z1)^2-(X1-Z1)^2] + C24*(X1-Z1)^2]*[(X1+Z1)^2-(X1-Z1)^2]
+}
+
+
+static void xDBLe_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24plus, const f2elm_x8_t C24, const int e)
+{ // Computes [2^e](X:Z) via e repeated doublings, see xDBLe()
+    int i;
+
+    memmove(Q, P, sizeof(point_proj_x8));
+    for (i = 0; i < e; i++) {
+        xDBL_x8(Q, Q, A24plus, C24);
+    }
+}
+
+#if (OALICE_BITS % 2 == 1)
+
+static void get_2_isog_x8(const point_proj_x8_t P, f2elm_x8_t A, f2elm_x8_t C)
+{ // Computes the 2-isogenous curve of a point of order 2, see get_2_isog()
+
+    fp2sqr_mont_x8(P->X, A);                        // A = X2^2
+    fp2sqr_mont_x8(P->Z, C);                        // C = Z2^2
+    mp2_sub_p2_x8(C, A, A);                         // A = Z2^2 - X2^2
+}
+
+
+static void eval_2_isog_x8(point_proj_x8_t P, const point_proj_x8_t Q)
+{ // Evaluates a 2-isogeny with kernel Q at the point P, see eval_2_isog()
+    f2elm_x8_t t0, t1, t2, t3;
+
+    mp2_add_x8(Q->X, Q->Z, t0);                     // t0 = X2+Z2
+    mp2_sub_p2_x8(Q->X, Q->Z, t1);                  // t1 = X2-Z2
+    mp2_add_x8(P->X, P->Z, t2);                     // t2 = X+Z
+    mp2_sub_p2_x8(P->X, P->Z, t3);                  // t3 = X-Z
+    fp2mul_mont_x8(t0, t3, t0);                     // t0 = (X2+Z2)*(X-Z)
+    fp2mul_mont_x8(t1, t2, t1);                     // t1 = (X2-Z2)*(X+Z)
+    mp2_add_x8(t0, t1, t2);                         // t2 = (X2+Z2)*(X-Z) + (X2-Z2)*(X+Z)
+    mp2_sub_p2_x8(t0, t1, t3);                      // t3 = (X2+Z2)*(X-Z) - (X2-Z2)*(X+Z)
+    fp2mul_mont_x8(P->X, t2, P->X);                 // Xfinal
+    fp2mul_mont_x8(P->Z, t3, P->Z);                 // Zfinal
+}
+
+#endif
+
+static void get_4_isog_x8(const point_proj_x8_t P, f2elm_x8_t A24plus, f2elm_x8_t C24, f2elm_x8_t* coeff)
+{ // Computes the 4-isogenous curve of a point of order 4 and the coefficients used by eval_4_isog_x8(), see get_4_isog()
+
+    mp2_sub_p2_x8(P->X, P->Z, coeff[1]);            // coeff[1] = X4-Z4
+    mp2_add_x8(P->X, P->Z, coeff[2]);               // coeff[2] = X4+Z4
+    fp2sqr_mont_x8(P->Z, coeff[0]);                 // coeff[0] = Z4^2
+    mp2_add_x8(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 2*Z4^2
+    fp2sqr_mont_x8(coeff[0], C24);                  // C24 = 4*Z4^4
+    mp2_add_x8(coeff[0], coeff[0], coeff[0]);       // coeff[0] = 4*Z4^2
+    fp2sqr_mont_x8(P->X, A24plus);                  // A24plus = X4^2
+    mp2_add_x8(A24plus, A24plus, A24plus);          // A24plus = 2*X4^2
+    fp2sqr_mont_x8(A24plus, A24plus);               // A24plus = 4*X4^4
+}
+
+
+static void eval_4_isog_x8(point_proj_x8_t P, f2elm_x8_t* coeff)
+{ // Evaluates a 4-isogeny at the point P, see eval_4_isog()
+    f2elm_x8_t t0, t1;
+
+    mp2_add_x8(P->X, P->Z, t0);                     // t0 = X+Z
+    mp2_sub_p2_x8(P->X, P->Z, t1);                  // t1 = X-Z
+    fp2mul_mont_x8(t0, coeff[1], P->X);             // X = (X+Z)*coeff[1]
+    fp2mul_mont_x8(t1, coeff[2], P->Z);             // Z = (X-Z)*coeff[2]
+    fp2mul_mont_x8(t0, t1, t0);                     // t0 = (X+Z)*(X-Z)
+    fp2mul_mont_x8(coeff[0], t0, t0);               // t0 = coeff[0]*(X+Z)*(X-Z)
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    mp2_sub_p2_x8(P->X, P->Z, P->Z);                // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_mont_x8(t1, t1);                         // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_mont_x8(P->Z, P->Z);                     // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    mp2_add_x8(t1, t0, P->X);                       // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    mp2_sub_p2_x8(P->Z, t0, t0);                    // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_mont_x8(P->X, t1, P->X);                 // Xfinal
+    fp2mul_mont_x8(P->Z, t0, P->Z);                 // Zfinal
+}
+
+
+static void xTPL_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24minus, const f2elm_x8_t A24plus)
+{ // Tripling of a Montgomery point in projective coordinates (X:Z), see xTPL()
+    f2elm_x8_t t0, t1, t2, t3, t4, t5, t6;
+
+    mp2_sub_p2_x8(P->X, P->Z, t0);                  // t0 = X-Z
+    fp2sqr_mont_x8(t0, t2);                         // t2 = (X-Z)^2
+    mp2_add_x8(P->X, P->Z, t1);                     // t1 = X+Z
+    fp2sqr_mont_x8(t1, t3);                         // t3 = (X+Z)^2
+    mp2_add_x8(P->X, P->X, t4);                     // t4 = 2*X
+    mp2_add_x8(P->Z, P->Z, t0);                     // t0 = 2*Z
+    fp2sqr_mont_x8(t4, t1);                         // t1 = 4*X^2
+    mp2_sub_p2_x8(t1, t3, t1);                      // t1 = 4*X^2 - (X+Z)^2
+    mp2_sub_p2_x8(t1, t2, t1);                      // t1 = 4*X^2 - (X+Z)^2 - (X-Z)^2
+    fp2mul_mont_x8(A24plus, t3, t5);                // t5 = A24plus*(X+Z)^2
+    fp2mul_mont_x8(t3, t5, t3);                     // t3 = A24plus*(X+Z)^4
+    fp2mul_mont_x8(A24minus, t2, t6);               // t6 = A24minus*(X-Z)^2
+    fp2mul_mont_x8(t2, t6, t2);                     // t2 = A24minus*(X-Z)^4
+    mp2_sub_p2_x8(t2, t3, t3);                      // t3 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    mp2_sub_p2_x8(t5, t6, t2);                      // t2 = A24plus*(X+Z)^2 - A24minus*(X-Z)^2
+    fp2mul_mont_x8(t1, t2, t1);                     // t1 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2add_x8(t3, t1, t2);                          // t2 = [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2] + A24minus*(X-Z)^4 - A24plus*(X+Z)^4
+    fp2sqr_mont_x8(t2, t2);                         // t2 = t2^2
+    fp2mul_mont_x8(t4, t2, Q->X);                   // X3 = 2*X*t2
+    fp2sub_x8(t3, t1, t1);                          // t1 = A24minus*(X-Z)^4 - A24plus*(X+Z)^4 - [4*X^2 - (X+Z)^2 - (X-Z)^2]*[A24plus*(X+Z)^2 - A24minus*(X-Z)^2]
+    fp2sqr_mont_x8(t1, t1);                         // t1 = t1^2
+    fp2mul_mont_x8(t0, t1, Q->Z);                   // Z3 = 2*Z*t1
+}
+
+
+static void xTPLe_x8(const point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t A24minus, const f2elm_x8_t A24plus, const int e)
+{ // Computes [3^e](X:Z) via e repeated triplings, see xTPLe()
+    int i;
+
+    memmove(Q, P, sizeof(point_proj_x8));
+    for (i = 0; i < e; i++) {
+        xTPL_x8(Q, Q, A24minus, A24plus);
+    }
+}
+
+
+static void get_3_isog_x8(const point_proj_x8_t P, f2elm_x8_t A24minus, f2elm_x8_t A24plus, f2elm_x8_t* coeff)
+{ // Computes the 3-isogenous curve of a point of order 3 and the coefficients used by eval_3_isog_x8(), see get_3_isog()
+    f2elm_x8_t t0, t1, t2, t3, t4;
+
+    mp2_sub_p2_x8(P->X, P->Z, coeff[0]);            // coeff0 = X-Z
+    fp2sqr_mont_x8(coeff[0], t0);                   // t0 = (X-Z)^2
+    mp2_add_x8(P->X, P->Z, coeff[1]);               // coeff1 = X+Z
+    fp2sqr_mont_x8(coeff[1], t1);                   // t1 = (X+Z)^2
+    mp2_add_x8(P->X, P->X, t3);                     // t3 = 2*X
+    fp2sqr_mont_x8(t3, t3);                         // t3 = 4*X^2
+    fp2sub_x8(t3, t0, t2);                          // t2 = 4*X^2 - (X-Z)^2
+    fp2sub_x8(t3, t1, t3);                          // t3 = 4*X^2 - (X+Z)^2
+    mp2_add_x8(t0, t3, t4);                         // t4 = 4*X^2 - (X+Z)^2 + (X-Z)^2
+    mp2_add_x8(t4, t4, t4);                         // t4 = 2(4*X^2 - (X+Z)^2 + (X-Z)^2)
+    mp2_add_x8(t1, t4, t4);                         // t4 = 8*X^2 - (X+Z)^2 + 2*(X-Z)^2
+    fp2mul_mont_x8(t2, t4, A24minus);               // A24minus = [4*X^2 - (X-Z)^2]*[8*X^2 - (X+Z)^2 + 2*(X-Z)^2]
+    mp2_add_x8(t1, t2, t4);                         // t4 = 4*X^2 + (X+Z)^2 - (X-Z)^2
+    mp2_add_x8(t4, t4, t4);                         // t4 = 2(4*X^2 + (X+Z)^2 - (X-Z)^2)
+    mp2_add_x8(t0, t4, t4);                         // t4 = 8*X^2 + 2*(X+Z)^2 - (X-Z)^2
+    fp2mul_mont_x8(t3, t4, A24plus);                // A24plus = [4*X^2 - (X+Z)^2]*[8*X^2 + 2*(X+Z)^2 - (X-Z)^2]
+}
+
+
+static void eval_3_isog_x8(point_proj_x8_t Q, const f2elm_x8_t* coeff)
+{ // Evaluates a 3-isogeny at the point Q, see eval_3_isog()
+    f2elm_x8_t t0, t1, t2;
+
+    mp2_add_x8(Q->X, Q->Z, t0);                     // t0 = X+Z
+    mp2_sub_p2_x8(Q->X, Q->Z, t1);                  // t1 = X-Z
+    fp2mul_mont_x8(coeff[0], t0, t0);               // t0 = coeff0*(X+Z)
+    fp2mul_mont_x8(coeff[1], t1, t1);               // t1 = coeff1*(X-Z)
+    mp2_add_x8(t0, t1, t2);                         // t2 = coeff0*(X+Z) + coeff1*(X-Z)
+    mp2_sub_p2_x8(t1, t0, t0);                      // t0 = coeff1*(X-Z) - coeff0*(X+Z)
+    fp2sqr_mont_x8(t2, t2);                         // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2sqr_mont_x8(t0, t0);                         // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
+    fp2mul_mont_x8(Q->X, t2, Q->X);                 // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2mul_mont_x8(Q->Z, t0, Q->Z);                 // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+}
+
+
+static void xDBLADD_x8(point_proj_x8_t P, point_proj_x8_t Q, const f2elm_x8_t xPQ, const f2elm_x8_t A24)
+{ // Simultaneous doubling and differential addition, see xDBLADD()
+    f2elm_x8_t t0, t1, t2;
+
+    mp2_add_x8(P->X, P->Z, t0);                     // t0 = XP+ZP
+    mp2_sub_p2_x8(P->X, P->Z, t1);                  // t1 = XP-ZP
+    fp2sqr_mont_x8(t0, P->X);                       // XP = (XP+ZP)^2
+    mp2_sub_p2_x8(Q->X, Q->Z, t2);                  // t2 = XQ-ZQ
+    mp2_add_x8(Q->X, Q->Z, Q->X);                   // XQ = XQ+ZQ
+    fp2mul_mont_x8(t0, t2, t0);                     // t0 = (XP+ZP)*(XQ-ZQ)
+    fp2sqr_mont_x8(t1, P->Z);                       // ZP = (XP-ZP)^2
+    fp2mul_mont_x8(t1, Q->X, t1);                   // t1 = (XP-ZP)*(XQ+ZQ)
+    mp2_sub_p2_x8(P->X, P->Z, t2);                  // t2 = (XP+ZP)^2-(XP-ZP)^2
+    fp2mul_mont_x8(P->X, P->Z, P->X);               // XP = (XP+ZP)^2*(XP-ZP)^2
+    fp2mul_mont_x8(A24, t2, Q->X);                  // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]
+    mp2_sub_p2_x8(t0, t1, Q->Z);                    // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+    mp2_add_x8(Q->X, P->Z, P->Z);                   // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2
+    mp2_add_x8(t0, t1, Q->X);                       // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+    fp2mul_mont_x8(P->Z, t2, P->Z);                 // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+    fp2sqr_mont_x8(Q->Z, Q->Z);                     // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+    fp2sqr_mont_x8(Q->X, Q->X);                     // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+    fp2mul_mont_x8(Q->Z, xPQ, Q->Z);                // ZQ = xPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+}
+
+
+static void swap_points_x8(point_proj_x8_t P, point_proj_x8_t Q, const __mmask8 option)
+{ // Swaps P and Q in the lanes selected by option
+    __m512i* p = (__m512i*)P;
+    __m512i* q = (__m512i*)Q;
+    __m512i t;
+    unsigned int i;
+
+    for (i = 0; i < 4*NLIMBS_52; i++) {
+        t = _mm512_mask_blend_epi64(option, p[i], q[i]);
+        q[i] = _mm512_mask_blend_epi64(option, q[i], p[i]);
+        p[i] = t;
+    }
+}
+
+
+static void LADDER3PT_x8(const f2elm_x8_t xP, const f2elm_x8_t xQ, const f2elm_x8_t xPQ, const digit_t* m, const unsigned int AliceOrBob, point_proj_x8_t R, const f2elm_x8_t A)
+{ // Three-point ladder for eight scalars, lane j uses m[j*NWORDS_ORDER], see LADDER3PT()
+    point_proj_x8_t R0, R2;
+    f2elm_x8_t A24;
+    __mmask8 bit, swap, prevbit = 0;
+    int i, j, nbits;
+
+    if (AliceOrBob == ALICE) {
+        nbits = OALICE_BITS;
+    } else {
+        nbits = OBOB_BITS - 1;
+    }
+
+    // Initializing constant
+    fp2set_x8(one_52, A24);
+    mp2_add_x8(A24, A24, A24);
+    mp2_add_x8(A, A24, A24);
+    fp2div2_x8(A24, A24);
+    fp2div2_x8(A24, A24);  // A24 = (A+2)/4
+
+    // Initializing points
+    fp2copy_x8(xQ, R0->X);
+    fp2set_x8(one_52, R0->Z);
+    fp2copy_x8(xPQ, R2->X);
+    fp2set_x8(one_52, R2->Z);
+    fp2copy_x8(xP, R->X);
+    fp2set_x8(one_52, R->Z);
+
+    // Main loop, the bits of the eight scalars select the swaps lane by lane
+    for (i = 0; i < nbits; i++) {
+        bit = 0;
+        for (j = 0; j < IFMA_LANES; j++) {
+            bit |= (__mmask8)(((m[j*NWORDS_ORDER + (i >> LOG2RADIX)] >> (i & (RADIX-1))) & 1) << j);
+        }
+        swap = bit ^ prevbit;
+        prevbit = bit;
+
+        swap_points_x8(R, R2, swap);
+        xDBLADD_x8(R0, R2, R->X, A24);
+        fp2mul_mont_x8(R2->X, R->Z, R2->X);
+    }
+    swap_points_x8(R, R2, prevbit);
+}
+
+
+static void init_basis_x8(const uint64_t* gen, f2elm_x8_t XP, f2elm_x8_t XQ, f2elm_x8_t XR)
+{ // Initialization of basis points in all the lanes
+
+    fp2_to_x8((const f2elm_t*)gen, 0, XP);
+    fp2_to_x8((const f2elm_t*)gen + 1, 0, XQ);
+    fp2_to_x8((const f2elm_t*)gen + 2, 0, XR);
+}
+
+
+void keygen_A_x8(const digit_t* SecretKeyA, f2elm_t* X, f2elm_t* Z)
+{ // Alice's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER].
+  // Outputs the projective images (X[3*j+k]:Z[3*j+k]) of Bob's basis points, k = 0, 1, 2, see EphemeralKeyGeneration_A()
+    point_proj_x8_t R, phiP, phiQ, phiR, pts[MAX_INT_POINTS_ALICE];
+    f2elm_x8_t XPA, XQA, XRA, coeff[3], A24plus, C24, A;
+    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+
+    // Initialize basis points
+    init_basis_x8(A_gen, XPA, XQA, XRA);
+    init_basis_x8(B_gen, phiP->X, phiQ->X, phiR->X);
+    fp2set_x8(one_52, phiP->Z);
+    fp2set_x8(one_52, phiQ->Z);
+    fp2set_x8(one_52, phiR->Z);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where A=6, C=1
+    fp2set_x8(one_52, A24plus);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    mp2_add_x8(A24plus, A24plus, C24);
+    mp2_add_x8(A24plus, C24, A);
+    mp2_add_x8(C24, C24, A24plus);
+
+    // Retrieve kernel point
+    LADDER3PT_x8(XPA, XQA, XRA, SecretKeyA, ALICE, R, A);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x8_t S;
+
+    xDBLe_x8(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x8(S, A24plus, C24);
+    eval_2_isog_x8(phiP, S);
+    eval_2_isog_x8(phiQ, S);
+    eval_2_isog_x8(phiR, S);
+    eval_2_isog_x8(R, S);
+#endif
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Alice; row++) {
+        while (index < MAX_Alice-row) {
+            fp2copy_x8(R->X, pts[npts]->X);
+            fp2copy_x8(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Alice[ii++];
+            xDBLe_x8(R, R, A24plus, C24, (int)(2*m));
+            index += m;
+        }
+        get_4_isog_x8(R, A24plus, C24, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_4_isog_x8(pts[i], coeff);
+        }
+        eval_4_isog_x8(phiP, coeff);
+        eval_4_isog_x8(phiQ, coeff);
+        eval_4_isog_x8(phiR, coeff);
+
+        fp2copy_x8(pts[npts-1]->X, R->X);
+        fp2copy_x8(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_4_isog_x8(R, A24plus, C24, coeff);
+    eval_4_isog_x8(phiP, coeff);
+    eval_4_isog_x8(phiQ, coeff);
+    eval_4_isog_x8(phiR, coeff);
+
+    fp2_from_x8(phiP->X, X, 3);
+    fp2_from_x8(phiQ->X, X + 1, 3);
+    fp2_from_x8(phiR->X, X + 2, 3);
+    fp2_from_x8(phiP->Z, Z, 3);
+    fp2_from_x8(phiQ->Z, Z + 1, 3);
+    fp2_from_x8(phiR->Z, Z + 2, 3);
+}
+
+
+void keygen_B_x8(const digit_t* SecretKeyB, f2elm_t* X, f2elm_t* Z)
+{ // Bob's ephemeral public key generation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER].
+  // Outputs the projective images (X[3*j+k]:Z[3*j+k]) of Alice's basis points, k = 0, 1, 2, see EphemeralKeyGeneration_B()
+    point_proj_x8_t R, phiP, phiQ, phiR, pts[MAX_INT_POINTS_BOB];
+    f2elm_x8_t XPB, XQB, XRB, coeff[3], A24plus, A24minus, A;
+    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+
+    // Initialize basis points
+    init_basis_x8(B_gen, XPB, XQB, XRB);
+    init_basis_x8(A_gen, phiP->X, phiQ->X, phiR->X);
+    fp2set_x8(one_52, phiP->Z);
+    fp2set_x8(one_52, phiQ->Z);
+    fp2set_x8(one_52, phiR->Z);
+
+    // Initialize constants: A24minus = A-2C, A24plus = A+2C, where A=6, C=1
+    fp2set_x8(one_52, A24plus);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    mp2_add_x8(A24plus, A24plus, A24minus);
+    mp2_add_x8(A24plus, A24minus, A);
+    mp2_add_x8(A24minus, A24minus, A24plus);
+
+    // Retrieve kernel point
+    LADDER3PT_x8(XPB, XQB, XRB, SecretKeyB, BOB, R, A);
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Bob; row++) {
+        while (index < MAX_Bob-row) {
+            fp2copy_x8(R->X, pts[npts]->X);
+            fp2copy_x8(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Bob[ii++];
+            xTPLe_x8(R, R, A24minus, A24plus, (int)m);
+            index += m;
+        }
+        get_3_isog_x8(R, A24minus, A24plus, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_3_isog_x8(pts[i], coeff);
+        }
+        eval_3_isog_x8(phiP, coeff);
+        eval_3_isog_x8(phiQ, coeff);
+        eval_3_isog_x8(phiR, coeff);
+
+        fp2copy_x8(pts[npts-1]->X, R->X);
+        fp2copy_x8(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_3_isog_x8(R, A24minus, A24plus, coeff);
+    eval_3_isog_x8(phiP, coeff);
+    eval_3_isog_x8(phiQ, coeff);
+    eval_3_isog_x8(phiR, coeff);
+
+    fp2_from_x8(phiP->X, X, 3);
+    fp2_from_x8(phiQ->X, X + 1, 3);
+    fp2_from_x8(phiR->X, X + 2, 3);
+    fp2_from_x8(phiP->Z, Z, 3);
+    fp2_from_x8(phiQ->Z, Z + 1, 3);
+    fp2_from_x8(phiR->Z, Z + 2, 3);
+}
+
+
+void agreement_A_x8(const digit_t* SecretKeyA, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC)
+{ // Alice's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyA[j*NWORDS_ORDER],
+  // Bob's public key PK[3*j+k], k = 0, 1, 2, and its curve coefficient A[j].
+  // Outputs the coefficients (jA[j]:jC[j]) of the shared curve, whose j-invariant is the shared secret, see EphemeralSecretAgreement_A()
+    point_proj_x8_t R, pts[MAX_INT_POINTS_ALICE];
+    f2elm_x8_t coeff[3], PKB[3], A24plus, C24, A_x8;
+    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_ALICE], npts = 0, ii = 0;
+
+    // Initialize images of Bob's basis
+    fp2_to_x8(PK, 3, PKB[0]);
+    fp2_to_x8(PK + 1, 3, PKB[1]);
+    fp2_to_x8(PK + 2, 3, PKB[2]);
+
+    // Initialize constants: A24plus = A+2C, C24 = 4C, where C=1
+    fp2_to_x8(A, 1, A_x8);
+    fp2set_x8(one_52, C24);
+    mp2_add_x8(C24, C24, C24);
+    mp2_add_x8(A_x8, C24, A24plus);
+    mp2_add_x8(C24, C24, C24);
+
+    // Retrieve kernel point
+    LADDER3PT_x8(PKB[0], PKB[1], PKB[2], SecretKeyA, ALICE, R, A_x8);
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_x8_t S;
+
+    xDBLe_x8(R, S, A24plus, C24, (int)(OALICE_BITS-1));
+    get_2_isog_x8(S, A24plus, C24);
+    eval_2_isog_x8(R, S);
+#endif
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Alice; row++) {
+        while (index < MAX_Alice-row) {
+            fp2copy_x8(R->X, pts[npts]->X);
+            fp2copy_x8(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Alice[ii++];
+            xDBLe_x8(R, R, A24plus, C24, (int)(2*m));
+            index += m;
+        }
+        get_4_isog_x8(R, A24plus, C24, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_4_isog_x8(pts[i], coeff);
+        }
+
+        fp2copy_x8(pts[npts-1]->X, R->X);
+        fp2copy_x8(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_4_isog_x8(R, A24plus, C24, coeff);
+    mp2_add_x8(A24plus, A24plus, A24plus);
+    fp2sub_x8(A24plus, C24, A24plus);
+    fp2add_x8(A24plus, A24plus, A24plus);
+
+    fp2_from_x8(A24plus, jA, 1);
+    fp2_from_x8(C24, jC, 1);
+}
+
+
+void agreement_B_x8(const digit_t* SecretKeyB, const f2elm_t* PK, const f2elm_t* A, f2elm_t* jA, f2elm_t* jC)
+{ // Bob's ephemeral shared secret computation in eight lanes, lane j uses the secret key SecretKeyB[j*NWORDS_ORDER],
+  // Alice's public key PK[3*j+k], k = 0, 1, 2, and its curve coefficient A[j].
+  // Outputs the coefficients (jA[j]:jC[j]) of the shared curve, whose j-invariant is the shared secret, see EphemeralSecretAgreement_B()
+    point_proj_x8_t R, pts[MAX_INT_POINTS_BOB];
+    f2elm_x8_t coeff[3], PKB[3], A24plus, A24minus, A_x8;
+    unsigned int i, row, m, index = 0, pts_index[MAX_INT_POINTS_BOB], npts = 0, ii = 0;
+
+    // Initialize images of Alice's basis
+    fp2_to_x8(PK, 3, PKB[0]);
+    fp2_to_x8(PK + 1, 3, PKB[1]);
+    fp2_to_x8(PK + 2, 3, PKB[2]);
+
+    // Initialize constants: A24plus = A+2C, A24minus = A-2C, where C=1
+    fp2_to_x8(A, 1, A_x8);
+    fp2set_x8(one_52, A24minus);
+    mp2_add_x8(A24minus, A24minus, A24minus);
+    mp2_add_x8(A_x8, A24minus, A24plus);
+    mp2_sub_p2_x8(A_x8, A24minus, A24minus);
+
+    // Retrieve kernel point
+    LADDER3PT_x8(PKB[0], PKB[1], PKB[2], SecretKeyB, BOB, R, A_x8);
+
+    // Traverse tree
+    index = 0;
+    for (row = 1; row < MAX_Bob; row++) {
+        while (index < MAX_Bob-row) {
+            fp2copy_x8(R->X, pts[npts]->X);
+            fp2copy_x8(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat_Bob[ii++];
+            xTPLe_x8(R, R, A24minus, A24plus, (int)m);
+            index += m;
+        }
+        get_3_isog_x8(R, A24minus, A24plus, coeff);
+
+        for (i = 0; i < npts; i++) {
+            eval_3_isog_x8(pts[i], coeff);
+        }
+
+        fp2copy_x8(pts[npts-1]->X, R->X);
+        fp2copy_x8(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+
+    get_3_isog_x8(R, A24minus, A24plus, coeff);
+    fp2add_x8(A24plus, A24minus, A_x8);
+    fp2add_x8(A_x8, A_x8, A_x8);
+    fp2sub_x8(A24plus, A24minus, A24plus);
+
+    fp2_from_x8(A_x8, jA, 1);
+    fp2_from_x8(A24plus, jC, 1);
+}
+
+
+int fp_ifma_supported(void)
+{ // Returns 1 if the processor and the operating system support AVX-512F and AVX-512 IFMA, 0 otherwise
+    unsigned int eax, ebx, ecx, edx, xcr0, xcr0_hi;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & bit_OSXSAVE) == 0) {
+        return 0;
+    }
+    __asm__ ("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0 & 0xE6) != 0xE6) {                     // SSE, AVX, opmask and ZMM states
+        return 0;
+    }
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+    return (ebx & bit_AVX512F) != 0 && (ebx & bit_AVX512IFMA) != 0;
+}
+
+
+__attribute__((constructor)) static void fp_ifma_init(void)
+{ // Enables the eight-lane batch computations when the library is loaded, if AVX-512 IFMA is supported
+    fp_ifma_enabled = fp_ifma_supported();
+}
@@ -0,0 +1,499 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmark suite for the field arithmetic backends of the x64 library.
+*           Reports min/median/p90/p99 cycles and nanoseconds of the single and batch KEM
+*           operations under every backend of the build, and writes them as JSON.
+*********************************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
+
+
+// Default number of samples and of untimed warmup runs per measurement
+#if defined(_GENERIC_)
+    #define KEM_SAMPLES        25
+    #define BATCH_SAMPLES       5
+#else
+    #define KEM_SAMPLES       101
+    #define BATCH_SAMPLES      25
+#endif
+#define KEM_WARMUP              3
+#define BATCH_WARMUP            1
+#define BENCH_BATCH             8        // Operations per batch, the number of AVX-512 IFMA lanes
+
+#define MAX_SAMPLES        100000
+#define MAX_RESULTS            64
+#define MAX_BACKEND_NAME       32
+
+#if (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+    #define COUNTER_UNIT   "nsec"        // cpucycles() reads the monotonic clock on ARM
+#else
+    #define COUNTER_UNIT   "cycles"
+#endif
+
+// Field arithmetic of a build without run-time dispatch, named as in fp_backends[]
+#if defined(_GENERIC_)
+    #define BENCH_BACKEND  "generic"
+#elif defined(_ADX_)
+    #define BENCH_BACKEND  "mulx+adx"
+#elif defined(_MULX_)
+    #define BENCH_BACKEND  "mulx"
+#else
+    #define BENCH_BACKEND  "x64"
+#endif
+
+// Suffix of the backend names of a build with the AVX2 isogeny lanes
+#if defined(_AVX2_ISOGENY_)
+    #define AVX2_SUFFIX    "+avx2"
+#else
+    #define AVX2_SUFFIX    ""
+#endif
+
+
+// Order statistics of a measurement
+typedef struct {
+    unsigned long long min, median, p90, p99;
+    double mean;                         // Mean of the samples below the outlier fence
+    unsigned int outliers;               // Number of samples above Q3 + 3*IQR
+} bench_stats_t;
+
+typedef struct {
+    const char* op;
+    char backend[MAX_BACKEND_NAME];      // Field arithmetic the operation was timed with
+    unsigned int batch;                  // Operations per timed run, the statistics are per operation
+    unsigned int samples;
+    bench_stats_t cycles, ns;
+} bench_result_t;
+
+static bench_result_t results[MAX_RESULTS];
+static unsigned int nresults = 0;
+static unsigned long long samples_cycles[MAX_SAMPLES], samples_ns[MAX_SAMPLES];
+
+// Operands of the KEM operations being measured
+static unsigned char kem_sk[BENCH_BATCH*CRYPTO_SECRETKEYBYTES], kem_pk[BENCH_BATCH*CRYPTO_PUBLICKEYBYTES], kem_ct[BENCH_BATCH*CRYPTO_CIPHERTEXTBYTES];
+static unsigned char kem_ss[BENCH_BATCH*CRYPTO_BYTES], kem_ss_[BENCH_BATCH*CRYPTO_BYTES];
+
+
+static void run_keygen(void)
+{
+    crypto_kem_keypair(kem_pk, kem_sk);
+}
+
+
+static void run_encaps(void)
+{
+    crypto_kem_enc(kem_ct, kem_ss, kem_pk);
+}
+
+
+static void run_decaps(void)
+{
+    crypto_kem_dec(kem_ss_, kem_ct, kem_sk);
+}
+
+
+static void run_keygen_batch(void)
+{
+    crypto_kem_keypair_batch(BENCH_BATCH, kem_pk, kem_sk);
+}
+
+
+static void run_encaps_batch(void)
+{
+    crypto_kem_enc_batch(BENCH_BATCH, kem_ct, kem_ss, kem_pk);
+}
+
+
+static void run_decaps_batch(void)
+{
+    crypto_kem_dec_batch(BENCH_BATCH, kem_ss_, kem_ct, kem_sk);
+}
+
+
+static unsigned long long nanoseconds(void)
+{ // Monotonic clock in nanoseconds
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec*1000000000ULL + (unsigned long long)t.tv_nsec;
+}
+
+
+static int compare_samples(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static unsigned long long percentile(const unsigned long long* v, const unsigned int n, const unsigned int p)
+{ // Nearest-rank p-th percentile of n sorted samples
+    unsigned int rank = (p*n + 99)/100;
+
+    return v[(rank > 0) ? rank-1 : 0];
+}
+
+
+static void statistics(unsigned long long* v, const unsigned int n, bench_stats_t* s)
+{ // Order statistics of n samples, v is sorted in place.
+  // Samples above the Tukey fence Q3 + 3*IQR (e.g., interrupts or migrations) are left out of the mean only.
+    unsigned long long q1, q3, fence;
+    double sum = 0;
+    unsigned int i, kept = 0;
+
+    qsort(v, n, sizeof(v[0]), compare_samples);
+    s->min = v[0];
+    s->median = percentile(v, n, 50);
+    s->p90 = percentile(v, n, 90);
+    s->p99 = percentile(v, n, 99);
+
+    q1 = percentile(v, n, 25);
+    q3 = percentile(v, n, 75);
+    fence = q3 + 3*(q3 - q1);
+    for (i = 0; i < n; i++) {
+        if (v[i] <= fence) {
+            sum += (double)v[i];
+            kept++;
+        }
+    }
+    s->mean = sum/kept;
+    s->outliers = n - kept;
+}
+
+
+static void measure(const char* backend, const char* op, void (*run)(void), const unsigned int batch, const unsigned int samples, const unsigned int warmup)
+{ // Times "samples" runs of run() after "warmup" untimed runs, and prints one row of the table.
+  // Each run performs "batch" operations, the samples are divided by it
+    unsigned long long cycles1, cycles2, ns1, ns2;
+    bench_result_t* r = &results[nresults];
+    unsigned int n;
+
+    for (n = 0; n < warmup; n++) {
+        run();
+    }
+    for (n = 0; n < samples; n++) {
+        ns1 = nanoseconds();
+        cycles1 = cpucycles();
+        run();
+        cycles2 = cpucycles();
+        ns2 = nanoseconds();
+        samples_cycles[n] = (cycles2-cycles1)/batch;
+        samples_ns[n] = (ns2-ns1)/batch;
+    }
+
+    r->op = op;
+    snprintf(r->backend, sizeof(r->backend), "%s", backend);
+    r->batch = batch;
+    r->samples = samples;
+    statistics(samples_cycles, samples, &r->cycles);
+    statistics(samples_ns, samples, &r->ns);
+    if (nresults < MAX_RESULTS-1) {
+        nresults++;
+    }
+
+    printf("  %-22s %-14s %14llu %14llu %14llu %14llu %14llu %6u\n", backend, op, r->cycles.min, r->cycles.median, r->cycles.p90, r->cycles.p99, r->ns.median, r->cycles.outliers);
+}
+
+
+static int bench_kem(const char* backend, const unsigned int samples, const unsigned int warmup)
+{ // Benchmarking key generation, encapsulation and decapsulation
+    measure(backend, "keygen", run_keygen, 1, samples, warmup);
+    measure(backend, "encaps", run_encaps, 1, samples, warmup);
+    measure(backend, "decaps", run_decaps, 1, samples, warmup);
+
+    // The ciphertext of the last encapsulation was made with the last key pair
+    if (memcmp(kem_ss, kem_ss_, CRYPTO_BYTES) != 0) {
+        printf("  %-22s shared secrets differ ... FAILED\n", backend);
+        return FAILED;
+    }
+    return PASSED;
+}
+
+
+static int bench_kem_batch(const char* backend, const unsigned int samples, const unsigned int warmup)
+{ // Benchmarking the batch KEM functions, per operation
+    measure(backend, "keygen_batch", run_keygen_batch, BENCH_BATCH, samples, warmup);
+    measure(backend, "encaps_batch", run_encaps_batch, BENCH_BATCH, samples, warmup);
+    measure(backend, "decaps_batch", run_decaps_batch, BENCH_BATCH, samples, warmup);
+
+    // The decapsulations use the first secret key, which only matches the first ciphertext
+    if (memcmp(kem_ss, kem_ss_, CRYPTO_BYTES) != 0) {
+        printf("  %-22s shared secrets differ ... FAILED\n", backend);
+        return FAILED;
+    }
+    return PASSED;
+}
+
+
+static int bench_backend(const char* name, const int batch, const unsigned int kem_samples, const unsigned int batch_samples, const unsigned int kem_warmup, const unsigned int batch_warmup)
+{ // Benchmarking the KEM with the field arithmetic in use. With AVX-512 IFMA the batches are also
+  // timed with the eight-lane backend, whose results are named after the field arithmetic plus "+ifma_x8"
+    char backend[MAX_BACKEND_NAME];
+    int Status = PASSED;
+
+    snprintf(backend, sizeof(backend), "%s%s", name, AVX2_SUFFIX);
+    Status |= bench_kem(backend, kem_samples, kem_warmup);
+    if (!batch) {
+        return Status;
+    }
+#if defined(_AVX512_IFMA_)
+    {
+        int ifma_enabled = fp_ifma_enabled;
+
+        fp_ifma_enabled = 0;
+        Status |= bench_kem_batch(backend, batch_samples, batch_warmup);
+        if (fp_ifma_supported()) {
+            snprintf(backend, sizeof(backend), "%s%s+ifma_x8", name, AVX2_SUFFIX);
+            fp_ifma_enabled = 1;
+            Status |= bench_kem_batch(backend, batch_samples, batch_warmup);
+        } else {
+            printf("  %-22s not supported by this processor, skipped\n", "ifma_x8");
+        }
+        fp_ifma_enabled = ifma_enabled;
+    }
+#else
+    Status |= bench_kem_batch(backend, batch_samples, batch_warmup);
+#endif
+    return Status;
+}
+
+
+static void json_stats(FILE* f, const char* unit, const bench_stats_t* s)
+{
+    fprintf(f, "\"%s\": {\"min\": %llu, \"median\": %llu, \"p90\": %llu, \"p99\": %llu, \"mean\": %.1f, \"outliers\": %u}",
+            unit, s->min, s->median, s->p90, s->p99, s->mean, s->outliers);
+}
+
+
+static int json_write(const char* path, const int cpu, const unsigned int kem_samples, const unsigned int batch_samples, const unsigned int kem_warmup, const unsigned int batch_warmup)
+{ // Writes the build configuration, the benchmark settings and all the results to the file "path"
+    FILE* f = fopen(path, "w");
+    char date[32];
+    time_t now = time(NULL);
+    unsigned int i;
+
+    if (f == NULL) {
+        perror(path);
+        return FAILED;
+    }
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"suite\": \"SIKE x64 benchmark\",\n");
+    fprintf(f, "  \"date\": \"%s\",\n", date);
+    fprintf(f, "  \"alg\": \"%s\",\n", SCHEME_NAME);
+    fprintf(f, "  \"build\": {\n");
+#if defined(__VERSION__)
+    fprintf(f, "    \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(f, "    \"dispatch\": %s,\n",
+#if defined(_RUNTIME_DISPATCH_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"avx512_ifma\": %s,\n",
+#if defined(_AVX512_IFMA_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"avx2_isogeny\": %s,\n",
+#if defined(_AVX2_ISOGENY_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"avx2_keccak\": %s,\n",
+#if defined(_AVX2_KECCAK_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"inversion\": \"%s\",\n",
+#if defined(_SAFEGCD_INVERSION_)
+            "safegcd"
+#else
+            "chain"
+#endif
+            );
+    fprintf(f, "    \"fixed_base_ladder\": %s,\n",
+#if defined(_FIXED_BASE_LADDER_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"tuned_strategy\": %s,\n",
+#if defined(_TUNED_STRATEGY_)
+            "true"
+#else
+            "false"
+#endif
+            );
+#if defined(_PARALLEL_ISOGENY_)
+    fprintf(f, "    \"threads\": %d,\n", NTHREADS);
+#else
+    fprintf(f, "    \"threads\": 1,\n");
+#endif
+    fprintf(f, "    \"counter\": \"%s\"\n", COUNTER_UNIT);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"settings\": {\"kem_samples\": %u, \"batch_samples\": %u, \"kem_warmup\": %u, \"batch_warmup\": %u, \"cpu\": %d},\n",
+            kem_samples, batch_samples, kem_warmup, batch_warmup, cpu);
+    fprintf(f, "  \"results\": [\n");
+    for (i = 0; i < nresults; i++) {
+        fprintf(f, "    {\"alg\": \"%s\", \"op\": \"%s\", \"backend\": \"%s\", \"batch\": %u, \"samples\": %u, ",
+                SCHEME_NAME, results[i].op, results[i].backend, results[i].batch, results[i].samples);
+        json_stats(f, "cycles", &results[i].cycles);
+        fprintf(f, ", ");
+        json_stats(f, "ns", &results[i].ns);
+        fprintf(f, "}%s\n", (i+1 < nresults) ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+
+    return (fclose(f) == 0) ? PASSED : FAILED;
+}
+
+
+static int pin_to_cpu(const int cpu)
+{ // Restricts the process to the given core
+#if defined(__linux__)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        perror("sched_setaffinity");
+        return FAILED;
+    }
+    return PASSED;
+#else
+    (void)cpu;
+    fprintf(stderr, "Pinning to a core is only supported on Linux\n");
+    return FAILED;
+#endif
+}
+
+
+static void usage(const char* prog)
+{
+    printf("Usage: %s [options]\n", prog);
+#if defined(_RUNTIME_DISPATCH_)
+    printf("  --backend NAME        Benchmark only this field arithmetic, e.g., mulx (can be repeated)\n");
+#endif
+    printf("  --samples N           Timed runs per KEM operation (default %d)\n", KEM_SAMPLES);
+    printf("  --batch-samples N     Timed runs per batch of %d KEM operations (default %d)\n", BENCH_BATCH, BATCH_SAMPLES);
+    printf("  --warmup N            Untimed runs before each KEM operation (default %d)\n", KEM_WARMUP);
+    printf("  --batch-warmup N      Untimed runs before each batch (default %d)\n", BATCH_WARMUP);
+    printf("  --cpu N               Pin the benchmark to core N\n");
+    printf("  --no-batch            Only benchmark the single KEM operations\n");
+    printf("  --json FILE           Write the results to FILE as JSON\n");
+}
+
+
+static int parse_count(const char* arg, unsigned int* n)
+{ // Positive count no larger than MAX_SAMPLES
+    char* end;
+    unsigned long v = strtoul(arg, &end, 10);
+
+    if (*arg == '\0' || *end != '\0' || v == 0 || v > MAX_SAMPLES) {
+        return FAILED;
+    }
+    *n = (unsigned int)v;
+    return PASSED;
+}
+
+
+int main(int argc, char* argv[])
+{
+    int Status = PASSED, cpu = -1, batch = 1;
+    unsigned int kem_samples = KEM_SAMPLES, batch_samples = BATCH_SAMPLES, kem_warmup = KEM_WARMUP, batch_warmup = BATCH_WARMUP;
+#if defined(_RUNTIME_DISPATCH_)
+    unsigned int backend, nselected = 0;
+    int selected[FP_BACKEND_COUNT] = {0};
+#endif
+    const char* json = NULL;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        int has_value = (i+1 < argc);
+
+#if defined(_RUNTIME_DISPATCH_)
+        if (strcmp(argv[i], "--backend") == 0 && has_value) {
+            i++;
+            for (backend = 0; backend < FP_BACKEND_COUNT; backend++) {
+                if (strcmp(argv[i], fp_backends[backend].name) == 0) break;
+            }
+            if (backend == FP_BACKEND_COUNT) {
+                fprintf(stderr, "Unknown field arithmetic %s\n", argv[i]);
+                return FAILED;
+            }
+            selected[backend] = 1;
+            nselected++;
+        } else
+#endif
+        if (strcmp(argv[i], "--samples") == 0 && has_value) {
+            if (parse_count(argv[++i], &kem_samples) != PASSED) { usage(argv[0]); return FAILED; }
+        } else if (strcmp(argv[i], "--batch-samples") == 0 && has_value) {
+            if (parse_count(argv[++i], &batch_samples) != PASSED) { usage(argv[0]); return FAILED; }
+        } else if (strcmp(argv[i], "--warmup") == 0 && has_value) {
+            kem_warmup = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--batch-warmup") == 0 && has_value) {
+            batch_warmup = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--cpu") == 0 && has_value) {
+            cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--json") == 0 && has_value) {
+            json = argv[++i];
+        } else if (strcmp(argv[i], "--no-batch") == 0) {
+            batch = 0;
+        } else {
+            usage(argv[0]);
+            return (strcmp(argv[i], "--help") == 0) ? PASSED : FAILED;
+        }
+    }
+    if (cpu >= 0 && pin_to_cpu(cpu) != PASSED) {
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISM %s (FIELD ARITHMETIC BACKENDS)\n", SCHEME_NAME);
+    printf("----------------------------------------------------------------------------------------------------------\n\n");
+    printf("  %-22s %-14s %14s %14s %14s %14s %14s %6s\n", "", "", "min", "median", "p90", "p99", "median", "");
+    printf("  %-22s %-14s %14s %14s %14s %14s %14s %6s\n", "", "", COUNTER_UNIT, COUNTER_UNIT, COUNTER_UNIT, COUNTER_UNIT, "nsec", "outl.");
+
+#if defined(_RUNTIME_DISPATCH_)
+    // Every field arithmetic backend supported by the processor
+    for (backend = 0; backend < FP_BACKEND_COUNT; backend++) {
+        if (nselected > 0 && !selected[backend]) {
+            continue;
+        }
+        if (fp_backend_select(backend) != 0) {
+            printf("  %-22s not supported by this processor, skipped\n\n", fp_backends[backend].name);
+            continue;
+        }
+        Status |= bench_backend(fp_backend->name, batch, kem_samples, batch_samples, kem_warmup, batch_warmup);
+        printf("\n");
+    }
+#else
+    Status |= bench_backend(BENCH_BACKEND, batch, kem_samples, batch_samples, kem_warmup, batch_warmup);
+    printf("\n");
+#endif
+
+    if (json != NULL) {
+        Status |= json_write(json, cpu, kem_samples, batch_samples, kem_warmup, batch_warmup);
+    }
+
+    return Status;
+}
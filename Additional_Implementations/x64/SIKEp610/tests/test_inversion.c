@@ -0,0 +1,283 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions over GF(p) and GF(p^2), the n-way inversion, and the Jacobi symbol
+*********************************************************************************************/
+
+
+// Benchmark and test parameters
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define BENCH_LOOPS      100      // Number of iterations per bench
+    #define TEST_LOOPS       100      // Number of iterations per test
+#else
+    #define BENCH_LOOPS     1000
+    #define TEST_LOOPS      1000
+#endif
+#define NWAY_TEST_SIZE        48      // Number of elements per n-way inversion test
+
+
+static void fpinv_mont_chain(felm_t a)
+{ // GF(p) inversion with the fixed addition chain
+    felm_t tt;
+
+    fpcopy(a, tt);
+    fpinv_chain_mont(tt);
+    fpsqr_mont(tt, tt);
+    fpsqr_mont(tt, tt);
+    fpmul_mont(a, tt, a);
+}
+
+
+static void fp2inv_mont_with(f2elm_t a, void (*fpinv)(felm_t))
+{ // GF(p^2) inversion with the given inversion in GF(p), a = (a0-i*a1)/(a0^2+a1^2)
+    f2elm_t t1;
+
+    fpsqr_mont(a[0], t1[0]);
+    fpsqr_mont(a[1], t1[1]);
+    fpadd(t1[0], t1[1], t1[0]);
+    fpinv(t1[0]);
+    fpneg(a[1]);
+    fpmul_mont(a[0], t1[0], a[0]);
+    fpmul_mont(a[1], t1[0], a[1]);
+}
+
+
+static bool fp_check(const felm_t a, const felm_t b)
+{ // Is a = b mod p?
+    felm_t t0, t1;
+
+    fpcopy(a, t0);
+    fpcopy(b, t1);
+    fpcorrection(t0);
+    fpcorrection(t1);
+    return compare_words(t0, t1, NWORDS_FIELD) == 0;
+}
+
+
+int inversion_test()
+{ // Checking the safegcd inversion against the addition chain, and a*a^-1 = 1
+    unsigned int n, i;
+    felm_t a, b, c;
+    f2elm_t a2, b2, c2, one = {0}, z[NWAY_TEST_SIZE], zinv[NWAY_TEST_SIZE], t[NWAY_TEST_SIZE];
+    bool passed = true;
+
+    fpcopy((digit_t*)&Montgomery_one, one[0]);
+
+    fpzero(a);
+    fpinv_mont_safegcd(a);                                     // The inverse of zero is zero, as with the addition chain
+    fpzero(b);
+    passed = fp_check(a, b);
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        fprandom_test(a);
+        if (n == 1) fpcopy(one[0], a);
+        if (n == 2) { fpcopy(one[0], a); fpneg(a); }
+        fpcopy(a, b);
+        fpcopy(a, c);
+        fpinv_mont_chain(b);
+        fpinv_mont_safegcd(c);
+        passed = fp_check(b, c);
+        fpmul_mont(a, c, c);
+        passed = passed && fp_check(c, one[0]);
+    }
+    if (passed == true) printf("  GF(p) inversion tests .................................................. PASSED");
+    else { printf("  GF(p) inversion tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        fp2random_test((digit_t*)a2);
+        fp2copy(a2, b2);
+        fp2copy(a2, c2);
+        fp2inv_mont_with(b2, fpinv_mont_chain);
+        fp2inv_mont_with(c2, fpinv_mont_safegcd);
+        passed = fp_check(b2[0], c2[0]) && fp_check(b2[1], c2[1]);
+        fp2mul_mont(a2, c2, c2);
+        passed = passed && fp_check(c2[0], one[0]) && fp_check(c2[1], one[1]);
+    }
+    if (passed == true) printf("  GF(p^2) inversion tests ................................................ PASSED");
+    else { printf("  GF(p^2) inversion tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    for (n = 1; n <= NWAY_TEST_SIZE && passed; n++) {                // Every size up to NWAY_TEST_SIZE, with a zero among n = 5 elements
+        for (i = 0; i < n; i++) {
+            fp2random_test((digit_t*)z[i]);
+        }
+        if (n == 5) fp2zero(z[2]);
+        memcpy(zinv, z, n*sizeof(f2elm_t));
+        inv_n_way(zinv, t, n);
+        for (i = 0; i < n; i++) {
+            fp2copy(z[i], c2);
+            fp2inv_mont(c2);                                         // A zero only makes its own output zero
+            passed = passed && fp_check(zinv[i][0], c2[0]) && fp_check(zinv[i][1], c2[1]);
+        }
+    }
+    if (passed == true) printf("  n-way inversion tests .................................................. PASSED");
+    else { printf("  n-way inversion tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int inversion_run()
+{ // Benchmarking the GF(p) inversions
+    unsigned int n;
+    felm_t a, b;
+    unsigned long long cycles_chain = 0, cycles_bingcd = 0, cycles_safegcd = 0, cycles1, cycles2;
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        fprandom_test(a);
+
+        fpcopy(a, b);
+        cycles1 = cpucycles();
+        fpinv_mont_chain(b);
+        cycles2 = cpucycles();
+        cycles_chain = cycles_chain+(cycles2-cycles1);
+
+#ifdef COMPRESS
+        fpcopy(a, b);
+        cycles1 = cpucycles();
+        fpinv_mont_bingcd(b);
+        cycles2 = cpucycles();
+        cycles_bingcd = cycles_bingcd+(cycles2-cycles1);
+#endif
+
+        fpcopy(a, b);
+        cycles1 = cpucycles();
+        fpinv_mont_safegcd(b);
+        cycles2 = cpucycles();
+        cycles_safegcd = cycles_safegcd+(cycles2-cycles1);
+    }
+
+    printf("  Addition chain inversion runs in ...................................... %10lld ", cycles_chain/BENCH_LOOPS); print_unit;
+    printf("\n");
+#ifdef COMPRESS
+    printf("  Binary GCD inversion (not constant time) runs in ...................... %10lld ", cycles_bingcd/BENCH_LOOPS); print_unit;
+    printf("\n");
+#endif
+    printf("  Safegcd inversion runs in ............................................. %10lld ", cycles_safegcd/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+#ifdef COMPRESS
+
+static int fp_legendre(const felm_t a)
+{ // Legendre symbol by exponentiation, a^((p-1)/2) = (a^((p-3)/4))^2*a
+    felm_t t, one = {0}, zero = {0};
+
+    fpcopy(a, t);
+    fpinv_chain_mont(t);
+    fpsqr_mont(t, t);
+    fpmul_mont(t, a, t);
+    fpcopy((digit_t*)&Montgomery_one, one);
+    if (fp_check(t, zero)) return 0;
+    return fp_check(t, one) ? 1 : -1;
+}
+
+
+int jacobi_test()
+{ // Checking the Jacobi symbol against the exponentiation, and the merged square root and inversion against sqrt_Fp2() and fp2inv_mont()
+    unsigned int n;
+    felm_t a;
+    f2elm_t v, z, s1, s2, inv1, inv2;
+    bool passed = true;
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        fprandom_test(a);
+        if (n == 1) fpzero(a);
+        if (n == 2) fpcopy((digit_t*)&Montgomery_one, a);
+        if (n == 3) { fpcopy((digit_t*)&Montgomery_one, a); fpneg(a); }
+        passed = (fp_jacobi(a) == fp_legendre(a));
+    }
+    if (passed == true) printf("  Jacobi symbol tests .................................................... PASSED");
+    else { printf("  Jacobi symbol tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    for (n = 0; n < TEST_LOOPS && passed; n++) {
+        fp2random_test((digit_t*)v);
+        fp2sqr_mont(v, v);
+        fp2random_test((digit_t*)z);
+        if (n == 1) fp2zero(z);
+        if (n == 2 || n == 3) {                                // One of v = 1, -1 leads to a+sqrt(a^2+b^2) = 0
+            fp2zero(v);
+            fpcopy((digit_t*)&Montgomery_one, v[0]);
+            if (n == 3) fpneg(v[0]);
+        }
+        sqrt_Fp2(v, s1);
+        fp2copy(z, inv1);
+        fp2inv_mont(inv1);
+        sqrtinv2(v, z, s2, inv2);
+        passed = fp_check(s1[0], s2[0]) && fp_check(s1[1], s2[1]) && fp_check(inv1[0], inv2[0]) && fp_check(inv1[1], inv2[1]);
+    }
+    if (passed == true) printf("  Merged square root and inversion tests ................................. PASSED");
+    else { printf("  Merged square root and inversion tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int jacobi_run()
+{ // Benchmarking the quadratic residuosity test
+    unsigned int n;
+    felm_t a;
+    volatile int r;
+    unsigned long long cycles_exp = 0, cycles_jacobi = 0, cycles1, cycles2;
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        fprandom_test(a);
+
+        cycles1 = cpucycles();
+        r = fp_legendre(a);
+        cycles2 = cpucycles();
+        cycles_exp = cycles_exp+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        r = fp_jacobi(a);
+        cycles2 = cpucycles();
+        cycles_jacobi = cycles_jacobi+(cycles2-cycles1);
+    }
+    (void)r;
+
+    printf("  Legendre symbol by exponentiation runs in ............................. %10lld ", cycles_exp/BENCH_LOOPS); print_unit;
+    printf("\n");
+    printf("  Jacobi symbol runs in ................................................. %10lld ", cycles_jacobi/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+#endif
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING FIELD INVERSION %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    Status = inversion_test();
+#ifdef COMPRESS
+    Status |= jacobi_test();
+#endif
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: INVERSION_ERROR \n\n");
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING FIELD INVERSION %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    inversion_run();
+#ifdef COMPRESS
+    jacobi_run();
+#endif
+
+    return Status;
+}
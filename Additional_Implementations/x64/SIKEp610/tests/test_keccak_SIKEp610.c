@@ -0,0 +1,16 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the 4-way SHAKE256 for SIKEp610
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610.c"
+
+
+#define SCHEME_NAME       "SIKEp610"
+
+
+#include "test_keccak.c"
@@ -0,0 +1,200 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the buffered random number generator behind randombytes
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include "test_extras.h"
+#include "../random/random.h"
+
+
+// Benchmark and test parameters
+#if (TARGET == TARGET_ARM)
+    #define BENCH_CALLS    20000      // Number of randombytes calls per thread per bench
+#else
+    #define BENCH_CALLS   200000
+#endif
+#define TEST_LOOPS          1000      // Number of iterations per test
+#define REQUEST_BYTES         32      // Bytes per request, the size of a SIKE seed or message
+#define MAX_THREADS            8
+
+
+typedef struct {
+    int (*generate)(unsigned char*, unsigned long long);
+    unsigned char out[REQUEST_BYTES];
+} bench_arg;
+
+static int urandom = -1;
+
+
+static int urandom_randombytes(unsigned char* random_array, unsigned long long nbytes)
+{ // One read() on /dev/urandom per request, as randombytes did before it was buffered
+    int r, n = (int)nbytes, count = 0;
+
+    while (n > 0) {
+        r = (int)read(urandom, random_array+count, n);
+        if (r == -1) return FAILED;
+        count += r;
+        n -= r;
+    }
+    return PASSED;
+}
+
+
+static void* draw_request(void* arg)
+{
+    unsigned char* out = arg;
+
+    randombytes(out, REQUEST_BYTES);
+    return NULL;
+}
+
+
+static void* bench_thread(void* arg)
+{
+    bench_arg* b = arg;
+
+    for (int i = 0; i < BENCH_CALLS; i++) {
+        b->generate(b->out, REQUEST_BYTES);
+    }
+    return NULL;
+}
+
+
+static int64_t nanoseconds(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+
+int rng_test()
+{ // Test that consecutive requests, threads and forked processes never repeat output
+    bool passed = true;
+    unsigned char a[REQUEST_BYTES], b[REQUEST_BYTES], zero[REQUEST_BYTES] = {0}, large[3000];
+    pthread_t thread;
+    pid_t pid;
+    int fd[2], status;
+
+    randombytes(a, REQUEST_BYTES);
+    for (int n = 0; n < TEST_LOOPS; n++) {
+        randombytes(b, REQUEST_BYTES);
+        if (memcmp(a, b, REQUEST_BYTES) == 0 || memcmp(b, zero, REQUEST_BYTES) == 0) { passed = false; break; }
+        memcpy(a, b, REQUEST_BYTES);
+    }
+    // Requests larger than the buffer
+    memset(large, 0, sizeof(large));
+    randombytes(large, sizeof(large));
+    for (size_t i = 0; i + REQUEST_BYTES <= sizeof(large); i += REQUEST_BYTES) {
+        if (memcmp(large + i, zero, REQUEST_BYTES) == 0) { passed = false; break; }
+    }
+    if (passed == true) printf("  Sequential output tests ................................................ PASSED");
+    else { printf("  Sequential output tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    // Each thread gets its own generator
+    randombytes(a, REQUEST_BYTES);
+    pthread_create(&thread, NULL, draw_request, b);
+    pthread_join(thread, NULL);
+    if (memcmp(a, b, REQUEST_BYTES) == 0) passed = false;
+    if (passed == true) printf("  Per-thread generator tests ............................................. PASSED");
+    else { printf("  Per-thread generator tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    // The child must not replay the output buffered in the parent
+    if (pipe(fd) != 0) return FAILED;
+    pid = fork();
+    if (pid == 0) {
+        randombytes(b, REQUEST_BYTES);
+        _exit(write(fd[1], b, REQUEST_BYTES) == REQUEST_BYTES ? 0 : 1);
+    }
+    randombytes(a, REQUEST_BYTES);
+    if (pid < 0 || read(fd[0], b, REQUEST_BYTES) != REQUEST_BYTES) passed = false;
+    waitpid(pid, &status, 0);
+    close(fd[0]);
+    close(fd[1]);
+    if (memcmp(a, b, REQUEST_BYTES) == 0) passed = false;
+    if (passed == true) printf("  Fork reseeding tests ................................................... PASSED");
+    else { printf("  Fork reseeding tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n");
+
+    return PASSED;
+}
+
+
+static int64_t rng_bench_threads(int (*generate)(unsigned char*, unsigned long long), int nthreads)
+{ // Wall-clock nanoseconds for nthreads threads issuing BENCH_CALLS requests each
+    pthread_t threads[MAX_THREADS];
+    bench_arg args[MAX_THREADS];
+    int64_t start, end;
+
+    start = nanoseconds();
+    for (int i = 0; i < nthreads; i++) {
+        args[i].generate = generate;
+        pthread_create(&threads[i], NULL, bench_thread, &args[i]);
+    }
+    for (int i = 0; i < nthreads; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    end = nanoseconds();
+
+    return end - start;
+}
+
+
+int rng_run()
+{
+    int64_t ns_urandom, ns_buffered;
+    double calls;
+
+    urandom = open("/dev/urandom", O_RDONLY);
+    if (urandom == -1) return FAILED;
+
+    for (int nthreads = 1; nthreads <= MAX_THREADS; nthreads *= 2) {
+        ns_urandom = rng_bench_threads(urandom_randombytes, nthreads);
+        ns_buffered = rng_bench_threads(randombytes, nthreads);
+        calls = (double)BENCH_CALLS*nthreads;
+
+        printf("  %d thread(s), read() per request ..................................... %10.1f Mcalls/s\n", nthreads, calls*1000/ns_urandom);
+        printf("  %d thread(s), buffered randombytes ................................... %10.1f Mcalls/s (%.1fx)\n", nthreads, calls*1000/ns_buffered, (double)ns_urandom/ns_buffered);
+    }
+    close(urandom);
+
+    return PASSED;
+}
+
+
+int main()
+{
+    int Status = PASSED;
+
+    printf("\n\nTESTING RANDOM NUMBER GENERATION\n");
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    Status = rng_test();
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: RNG_ERROR \n\n");
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING RANDOM NUMBER GENERATION (%d-byte requests)\n", REQUEST_BYTES);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    Status = rng_run();
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: RNG_ERROR \n\n");
+        return FAILED;
+    }
+
+    return Status;
+}
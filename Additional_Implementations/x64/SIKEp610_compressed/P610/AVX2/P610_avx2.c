@@ -0,0 +1,47 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny evaluations in the lanes of AVX2 vectors for P610
+*           This file is compiled once with VEC_LANES = 2 and once with VEC_LANES = 4
+*********************************************************************************************/
+
+#include "../P610_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_28         23      // Number of limbs in radix 2^28, 28*23 >= 640 = 64*NWORDS_FIELD
+#define ZERO_LIMBS_28     10      // Number of "0" limbs in the least significant part of p610 + 1 in radix 2^28
+
+// p610, 2*p610, 4*p610 and p610 + 1 in radix 2^28
+static const uint64_t p_28[4][NLIMBS_28] = {
+    {
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0x1FFFFFF, 0xB02E6E0,
+      0xDE8AA5A, 0xABB1784, 0x5048FF9, 0x9AE7BF4, 0x0C4252A, 0x55B2FA1,
+      0x7D88CB2, 0x10C251E, 0x7688190, 0x027BF6A, 0x0000000 },
+    {
+      0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0x3FFFFFF, 0x605CDC0,
+      0xBD154B5, 0x5762F09, 0xA091FF3, 0x35CF7E8, 0x1884A55, 0xAB65F42,
+      0xFB11964, 0x2184A3C, 0xED10320, 0x04F7ED4, 0x0000000 },
+    {
+      0xFFFFFFC, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0x7FFFFFF, 0xC0B9B80,
+      0x7A2A96A, 0xAEC5E13, 0x4123FE6, 0x6B9EFD1, 0x31094AA, 0x56CBE84,
+      0xF6232C9, 0x4309479, 0xDA20640, 0x09EFDA9, 0x0000000 },
+    {
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x2000000, 0xB02E6E0,
+      0xDE8AA5A, 0xABB1784, 0x5048FF9, 0x9AE7BF4, 0x0C4252A, 0x55B2FA1,
+      0x7D88CB2, 0x10C251E, 0x7688190, 0x027BF6A, 0x0000000 } };
+
+
+#if (VEC_LANES == 4)
+    #define eval_4_isog_vec           eval_4_isog610_x4
+    #define eval_3_isog_vec           eval_3_isog610_x4
+#elif (VEC_LANES == 2)
+    #define eval_4_isog_vec           eval_4_isog610_x2
+    #define eval_3_isog_vec           eval_3_isog610_x2
+#endif
+
+#include "../../ec_isogeny_avx2.c"
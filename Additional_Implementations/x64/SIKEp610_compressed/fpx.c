@@ -17,6 +17,8 @@ void clear_words(void* mem, digit_t nwords)
 }
 
 
+#ifndef _MULTI_LEVEL_    // In the multi-level library these are shared by all parameter sets
+
 int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len) 
 { // Compare two byte arrays in constant time.
   // Returns 0 if the byte arrays are equal, -1 otherwise.
@@ -37,6 +39,8 @@ void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector)
         r[i] ^= selector & (a[i] ^ r[i]);
 }
 
+#endif
+
 
 __inline static void encode_to_bytes(const digit_t* x, unsigned char* enc, int nbytes)
 { // Encoding digits to bytes according to endianness
@@ -153,6 +157,9 @@ void fpsqr_mont(const felm_t ma, felm_t mc)
 
 void fpinv_mont(felm_t a)
 { // Field inversion using Montgomery arithmetic, a = a^(-1)*R mod p.
+#if defined(_SAFEGCD_INVERSION_)
+    fpinv_mont_safegcd(a);
+#else
     felm_t tt;
 
     fpcopy(a, tt);
@@ -160,6 +167,7 @@ void fpinv_mont(felm_t a)
     fpsqr_mont(tt, tt);
     fpsqr_mont(tt, tt);
     fpmul_mont(a, tt, a);
+#endif
 }
 
 
@@ -259,20 +267,6 @@ __inline unsigned int mp_add(const digit_t* a, const digit_t* b, digit_t* c, con
 }
 
 
-void fp2sqr_mont(const f2elm_t a, f2elm_t c)
-{ // GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2).
-  // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1] 
-  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
-    felm_t t1, t2, t3;
-    
-    mp_addfast(a[0], a[1], t1);                      // t1 = a0+a1 
-    sub_p4(a[0], a[1], t2);                          // t2 = a0-a1
-    mp_addfast(a[0], a[0], t3);                      // t3 = 2a0
-    fpmul_mont(t1, t2, c[0]);                        // c0 = (a0+a1)(a0-a1)
-    fpmul_mont(t3, a[1], c[1]);                      // c1 = 2a0*a1
-}
-
-
 __inline unsigned int mp_sub(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision subtraction, c = a-b, where lng(a) = lng(b) = nwords. Returns the borrow bit.
     unsigned int i, borrow = 0;
@@ -317,22 +311,76 @@ __inline static void mp_dblsubfast(const digit_t* a, const digit_t* b, digit_t*
 }
 
 
-void fp2mul_mont(const f2elm_t a, const f2elm_t b, f2elm_t c)
-{ // GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2).
+__inline static void mp2_mul(const f2elm_t a, const f2elm_t b, df2elm_t c)
+{ // GF(p^2) multiplication without reduction, c = a*b in GF(p^2).
   // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1] 
-  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
+  // Output: c = c0+c1*i, where c0, c1 are in [0, p*2^MAXBITS_FIELD-1] 
     felm_t t1, t2;
-    dfelm_t tt1, tt2, tt3; 
+    dfelm_t tt1;
     
     mp_addfast(a[0], a[1], t1);                      // t1 = a0+a1
     mp_addfast(b[0], b[1], t2);                      // t2 = b0+b1
-    mp_mul(a[0], b[0], tt1, NWORDS_FIELD);           // tt1 = a0*b0
-    mp_mul(a[1], b[1], tt2, NWORDS_FIELD);           // tt2 = a1*b1
-    mp_mul(t1, t2, tt3, NWORDS_FIELD);               // tt3 = (a0+a1)*(b0+b1)
-    mp_dblsubfast(tt1, tt2, tt3);                    // tt3 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
-    mp_subaddfast(tt1, tt2, tt1);                    // tt1 = a0*b0 - a1*b1 + p*2^MAXBITS_FIELD if a0*b0 - a1*b1 < 0, else tt1 = a0*b0 - a1*b1
-    rdc_mont(tt3, c[1]);                             // c[1] = (a0+a1)*(b0+b1) - a0*b0 - a1*b1 
-    rdc_mont(tt1, c[0]);                             // c[0] = a0*b0 - a1*b1
+    mp_mul(a[0], b[0], c[0], NWORDS_FIELD);          // c0 = a0*b0
+    mp_mul(a[1], b[1], tt1, NWORDS_FIELD);           // tt1 = a1*b1
+    mp_mul(t1, t2, c[1], NWORDS_FIELD);              // c1 = (a0+a1)*(b0+b1)
+    mp_dblsubfast(c[0], tt1, c[1]);                  // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+    mp_subaddfast(c[0], tt1, c[0]);                  // c0 = a0*b0 - a1*b1 + p*2^MAXBITS_FIELD if a0*b0 - a1*b1 < 0, else c0 = a0*b0 - a1*b1
+}
+
+
+__inline static void mp2_sqr(const f2elm_t a, df2elm_t c)
+{ // GF(p^2) squaring without reduction, c = a^2 in GF(p^2).
+  // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1] 
+  // Output: c = c0+c1*i, where c0, c1 are in [0, p*2^MAXBITS_FIELD-1] 
+    felm_t t1, t2, t3;
+    
+    mp_addfast(a[0], a[1], t1);                      // t1 = a0+a1 
+    sub_p4(a[0], a[1], t2);                          // t2 = a0-a1
+    mp_addfast(a[0], a[0], t3);                      // t3 = 2a0
+    mp_mul(t1, t2, c[0], NWORDS_FIELD);              // c0 = (a0+a1)(a0-a1)
+    mp_mul(t3, a[1], c[1], NWORDS_FIELD);            // c1 = 2a0*a1
+}
+
+
+__inline static void mp2_subx2(const df2elm_t a, const df2elm_t b, df2elm_t c)
+{ // Subtraction of unreduced GF(p^2) elements, c = a-b mod p*2^MAXBITS_FIELD. 
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, p*2^MAXBITS_FIELD-1] 
+  // Output: c = c0+c1*i, where c0, c1 are in [0, p*2^MAXBITS_FIELD-1] 
+    mp_subaddfast(a[0], b[0], c[0]);
+    mp_subaddfast(a[1], b[1], c[1]);
+}
+
+
+__inline static void rdc2_mont(df2elm_t ma, f2elm_t mc)
+{ // Montgomery reduction of an unreduced GF(p^2) element, mc = ma*R^-1 in GF(p^2), where R = 2^MAXBITS_FIELD.
+  // Input: ma = ma0+ma1*i, where ma0, ma1 are in [0, p*2^MAXBITS_FIELD-1] 
+  // Output: mc = mc0+mc1*i, where mc0, mc1 are in [0, 2*p-1] 
+    rdc_mont(ma[0], mc[0]);
+    rdc_mont(ma[1], mc[1]);
+}
+
+
+void fp2sqr_mont(const f2elm_t a, f2elm_t c)
+{ // GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2).
+  // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1] 
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
+    df2elm_t tt;
+    
+    mp2_sqr(a, tt);                                  // tt = a^2, unreduced
+    rdc_mont(tt[0], c[0]);                           // c0 = (a0+a1)(a0-a1)
+    rdc_mont(tt[1], c[1]);                           // c1 = 2a0*a1
+}
+
+
+void fp2mul_mont(const f2elm_t a, const f2elm_t b, f2elm_t c)
+{ // GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2).
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1] 
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1] 
+    df2elm_t tt; 
+    
+    mp2_mul(a, b, tt);                               // tt = a*b, unreduced
+    rdc_mont(tt[1], c[1]);                           // c[1] = (a0+a1)*(b0+b1) - a0*b0 - a1*b1 
+    rdc_mont(tt[0], c[0]);                           // c[0] = a0*b0 - a1*b1
 }
 
 
@@ -829,6 +877,217 @@ void mp_shiftl1(digit_t* x, const unsigned int nwords)
     x[0] <<= 1;
 }
 
+
+/********** Constant-time inversion via the safegcd algorithm of Bernstein and Yang **********/
+
+// The divsteps run in batches of SG_BITS on the low limbs of f and g, and the resulting transition matrices are
+// applied to the full values. Every value is held in SG_NLIMBS signed limbs of SG_BITS bits, the most significant
+// limb keeps the sign.
+#if (RADIX == 64) && defined(__SIZEOF_INT128__) && !defined(_NO_INT128_)
+    #define SG_BITS           62
+    typedef int64_t           sg_limb_t;
+    typedef uint64_t          sg_ulimb_t;
+    typedef __int128          sg_dlimb_t;
+#else
+    #define SG_BITS           30
+    typedef int32_t           sg_limb_t;
+    typedef uint32_t          sg_ulimb_t;
+    typedef int64_t           sg_dlimb_t;
+#endif
+#define SG_MASK               (((sg_ulimb_t)1 << SG_BITS) - 1)
+#define SG_SIGN(x)            ((x) >> (8*sizeof(sg_limb_t)-1))          // All ones if x < 0, zero otherwise
+#define SG_NLIMBS             (NBITS_FIELD/SG_BITS + 1)
+#define SG_DIVSTEPS           ((49*NBITS_FIELD + 57)/17)                // Number of divsteps that suffice for any input (Bernstein-Yang, Theorem 11.2)
+#define SG_BATCHES            ((SG_DIVSTEPS + SG_BITS - 1)/SG_BITS)
+
+typedef struct { sg_limb_t u, v, q, r; } sg_matrix_t;
+
+
+static void felm_to_sg(const digit_t* a, sg_limb_t* c)
+{ // Conversion of a field element in [0, 2^NBITS_FIELD-1] to signed limbs
+    unsigned int i, w, s;
+    digit_t x;
+
+    for (i = 0; i < SG_NLIMBS; i++) {
+        w = (SG_BITS*i) / RADIX;
+        s = (SG_BITS*i) % RADIX;
+        x = (w < NWORDS_FIELD) ? (a[w] >> s) : 0;
+        if (s + SG_BITS > RADIX && w+1 < NWORDS_FIELD) {
+            x |= a[w+1] << (RADIX-s);
+        }
+        c[i] = (sg_limb_t)(x & SG_MASK);
+    }
+}
+
+
+static void sg_to_felm(const sg_limb_t* a, digit_t* c)
+{ // Conversion of normalized signed limbs of a value in [0, 2^NBITS_FIELD-1] to a field element
+    unsigned int i, w, s;
+
+    fpzero(c);
+    for (i = 0; i < SG_NLIMBS; i++) {
+        w = (SG_BITS*i) / RADIX;
+        s = (SG_BITS*i) % RADIX;
+        if (w < NWORDS_FIELD) {
+            c[w] |= (digit_t)a[i] << s;
+        }
+        if (s + SG_BITS > RADIX && w+1 < NWORDS_FIELD) {
+            c[w+1] |= (digit_t)a[i] >> (RADIX-s);
+        }
+    }
+}
+
+
+static sg_limb_t sg_divsteps(sg_limb_t eta, const sg_ulimb_t f0, const sg_ulimb_t g0, sg_matrix_t* t)
+{ // SG_BITS divsteps on the low bits f0 and g0 of f and g, with eta = -delta. Returns the updated eta and the transition
+  // matrix t, scaled by 2^SG_BITS, such that 2^SG_BITS*(f', g') = t*(f, g). Runs in constant time.
+    sg_ulimb_t u = 1, v = 0, q = 0, r = 1, f = f0, g = g0, c1, c2, x, y, z;
+    unsigned int i;
+
+    for (i = 0; i < SG_BITS; i++) {
+        c1 = (sg_ulimb_t)SG_SIGN(eta);              // delta > 0
+        c2 = 0 - (g & 1);                           // g is odd
+        x = (f ^ c1) - c1;
+        y = (u ^ c1) - c1;
+        z = (v ^ c1) - c1;
+        g += x & c2;                                // g = g-f if delta > 0, g+f otherwise, when g is odd
+        q += y & c2;
+        r += z & c2;
+        c1 &= c2;                                   // delta > 0 and g odd: (delta, f, g) = (1-delta, g, g-f)
+        eta = (sg_limb_t)(((sg_ulimb_t)eta ^ c1) - c1) - 1;
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (sg_limb_t)u;
+    t->v = (sg_limb_t)v;
+    t->q = (sg_limb_t)q;
+    t->r = (sg_limb_t)r;
+
+    return eta;
+}
+
+
+static void sg_update_fg(sg_limb_t* f, sg_limb_t* g, const sg_matrix_t* t)
+{ // (f, g) = t*(f, g)/2^SG_BITS, where the divisions are exact
+    sg_dlimb_t cf, cg;
+    unsigned int i;
+
+    cf = (sg_dlimb_t)t->u*f[0] + (sg_dlimb_t)t->v*g[0];
+    cg = (sg_dlimb_t)t->q*f[0] + (sg_dlimb_t)t->r*g[0];
+    cf >>= SG_BITS;
+    cg >>= SG_BITS;
+    for (i = 1; i < SG_NLIMBS; i++) {
+        cf += (sg_dlimb_t)t->u*f[i] + (sg_dlimb_t)t->v*g[i];
+        cg += (sg_dlimb_t)t->q*f[i] + (sg_dlimb_t)t->r*g[i];
+        f[i-1] = (sg_limb_t)((sg_ulimb_t)cf & SG_MASK);
+        g[i-1] = (sg_limb_t)((sg_ulimb_t)cg & SG_MASK);
+        cf >>= SG_BITS;
+        cg >>= SG_BITS;
+    }
+    f[SG_NLIMBS-1] = (sg_limb_t)cf;
+    g[SG_NLIMBS-1] = (sg_limb_t)cg;
+}
+
+
+static void sg_update_de(sg_limb_t* d, sg_limb_t* e, const sg_matrix_t* t, const sg_limb_t* m, const sg_ulimb_t minv)
+{ // (d, e) = t*(d, e)/2^SG_BITS mod p, where m is p in signed limbs and minv = p^-1 mod 2^SG_BITS.
+  // The inputs and outputs are in (-2*p, p).
+    sg_limb_t sd, se, md, me;
+    sg_dlimb_t cd, ce;
+    unsigned int i;
+
+    // The multiples of p that are added keep the outputs in range: [u, q] if d < 0 and [v, r] if e < 0,
+    // corrected so that the SG_BITS lower bits of t*(d, e) + p*(md, me) are zero
+    sd = SG_SIGN(d[SG_NLIMBS-1]);
+    se = SG_SIGN(e[SG_NLIMBS-1]);
+    md = (t->u & sd) + (t->v & se);
+    me = (t->q & sd) + (t->r & se);
+    cd = (sg_dlimb_t)t->u*d[0] + (sg_dlimb_t)t->v*e[0];
+    ce = (sg_dlimb_t)t->q*d[0] + (sg_dlimb_t)t->r*e[0];
+    md -= (sg_limb_t)((minv*(sg_ulimb_t)cd + (sg_ulimb_t)md) & SG_MASK);
+    me -= (sg_limb_t)((minv*(sg_ulimb_t)ce + (sg_ulimb_t)me) & SG_MASK);
+    cd += (sg_dlimb_t)m[0]*md;
+    ce += (sg_dlimb_t)m[0]*me;
+    cd >>= SG_BITS;
+    ce >>= SG_BITS;
+    for (i = 1; i < SG_NLIMBS; i++) {
+        cd += (sg_dlimb_t)t->u*d[i] + (sg_dlimb_t)t->v*e[i] + (sg_dlimb_t)m[i]*md;
+        ce += (sg_dlimb_t)t->q*d[i] + (sg_dlimb_t)t->r*e[i] + (sg_dlimb_t)m[i]*me;
+        d[i-1] = (sg_limb_t)((sg_ulimb_t)cd & SG_MASK);
+        e[i-1] = (sg_limb_t)((sg_ulimb_t)ce & SG_MASK);
+        cd >>= SG_BITS;
+        ce >>= SG_BITS;
+    }
+    d[SG_NLIMBS-1] = (sg_limb_t)cd;
+    e[SG_NLIMBS-1] = (sg_limb_t)ce;
+}
+
+
+static void sg_carry(sg_limb_t* a)
+{ // Carry propagation to limbs in [0, 2^SG_BITS-1], except the most significant one that keeps the sign
+    unsigned int i;
+
+    for (i = 0; i < SG_NLIMBS-1; i++) {
+        a[i+1] += a[i] >> SG_BITS;
+        a[i] &= SG_MASK;
+    }
+}
+
+
+static void sg_normalize(sg_limb_t* a, const sg_limb_t sign, const sg_limb_t* m)
+{ // Reduction of a in (-2*p, p), negated if sign < 0, to the range [0, p-1]. m is p in signed limbs
+    sg_limb_t mask, negate = SG_SIGN(sign);
+    unsigned int i;
+
+    mask = SG_SIGN(a[SG_NLIMBS-1]);               // a in (-p, p) after adding p if a < 0
+    for (i = 0; i < SG_NLIMBS; i++) {
+        a[i] = ((a[i] + (m[i] & mask)) ^ negate) - negate;
+    }
+    sg_carry(a);
+    mask = SG_SIGN(a[SG_NLIMBS-1]);               // a in [0, p-1] after adding p if a < 0
+    for (i = 0; i < SG_NLIMBS; i++) {
+        a[i] += m[i] & mask;
+    }
+    sg_carry(a);
+}
+
+
+void fpinv_mont_safegcd(felm_t a)
+{ // Field inversion via the safegcd algorithm of Bernstein and Yang using Montgomery arithmetic, a = a^(-1)*R mod p.
+  // Runs the fixed number of divsteps SG_BATCHES*SG_BITS and is constant time.
+    sg_limb_t f[SG_NLIMBS], g[SG_NLIMBS], d[SG_NLIMBS] = {0}, e[SG_NLIMBS], m[SG_NLIMBS], eta = -1;
+    sg_ulimb_t minv = 1;
+    sg_matrix_t t;
+    felm_t x;
+    unsigned int i;
+
+    fpcopy(a, x);
+    fpcorrection(x);
+    felm_to_sg((digit_t*)PRIME, m);
+    memcpy(f, m, sizeof(f));
+    felm_to_sg(x, g);
+    // Starting from e = R^2 instead of 1 turns the inverse (a*R)^-1 into the Montgomery representation a^-1*R
+    felm_to_sg((digit_t*)&Montgomery_R2, e);
+    for (i = 0; i < 6; i++) {
+        minv *= 2 - (sg_ulimb_t)m[0]*minv;          // minv = p^-1 mod 2^SG_BITS by Newton iterations
+    }
+
+    // Invariants: f = d*a*R^-2 mod p and g = e*a*R^-2 mod p. At the end f = +-1 and g = 0
+    for (i = 0; i < SG_BATCHES; i++) {
+        eta = sg_divsteps(eta, (sg_ulimb_t)f[0], (sg_ulimb_t)g[0], &t);
+        sg_update_de(d, e, &t, m, minv);
+        sg_update_fg(f, g, &t);
+    }
+
+    sg_normalize(d, f[SG_NLIMBS-1], m);
+    sg_to_felm(d, a);
+    clear_words((void*)x, NWORDS_FIELD);
+}
+
 #ifdef COMPRESS
 
 static __inline unsigned int is_felm_zero(const felm_t x)
@@ -948,31 +1207,163 @@ static bool is_zero(digit_t* a, unsigned int nwords)
 }
 
 
-unsigned char is_sqr_fp2(const f2elm_t a, felm_t s) 
-{ // Test if a is a square in GF(p^2) and return 1 if true, 0 otherwise
-  // If a is a quadratic residue, s will be assigned with a partially computed square root of a
-    int i;
-    felm_t a0,a1,z,temp;
-    
-    fpsqr_mont(a[0],a0);
-    fpsqr_mont(a[1],a1);
-    fpadd(a0,a1,z);
-    
-    fpcopy(z,s);
-    for (i = 0; i < OALICE_BITS - 2; i++) {             
-        fpsqr_mont(s, s);
+/********** Constant-time Jacobi symbol via the binary GCD **********/
+
+// The optimized binary GCD of Pornin on nonnegative values, in batches of JACOBI_STEPS steps that work on 64-bit
+// approximations made of the 31 low bits and of 33 top bits. The symbol is tracked from the 3 low bits of the values,
+// which stay exact during a batch. Any input converges within 2*NBITS_FIELD-1 steps.
+#define JACOBI_STEPS          29
+#define JACOBI_BATCHES        ((2*NBITS_FIELD - 1 + JACOBI_STEPS - 1)/JACOBI_STEPS)
+
+
+static unsigned int bitlength64(uint64_t x)
+{ // Bit length of x in constant time
+    unsigned int k, n = 0;
+    uint64_t y, mask;
+
+    for (k = 32; k > 0; k >>= 1) {
+        y = x >> k;
+        mask = 0 - ((y | (0 - y)) >> 63);
+        n += k & (unsigned int)mask;
+        x = (y & mask) | (x & ~mask);
     }
-    for (i = 0; i < OBOB_EXPON; i++) {
-        fpsqr_mont(s, temp);
-        fpmul_mont(s, temp, s);
-    }  
-    fpsqr_mont(s,temp);          // s = z^((p+1)/4)
-    fpcorrection(temp);
+    return n + (unsigned int)x;
+}
+
+
+static uint64_t sg_window(const sg_limb_t* a, const unsigned int s)
+{ // 64 bits of a >= 0 starting at bit s, in constant time
+    unsigned int i, q = s / SG_BITS, r = s % SG_BITS;
+    uint64_t w0 = 0, w1 = 0, mask;
+#if (SG_BITS < 32)
+    uint64_t w2 = 0;
+#endif
+
+    for (i = 0; i < SG_NLIMBS; i++) {
+        mask = 0 - (((uint64_t)(i ^ q) - 1) >> 63);
+        w0 |= mask & (uint64_t)a[i];
+        w1 |= mask & ((i+1 < SG_NLIMBS) ? (uint64_t)a[i+1] : 0);
+#if (SG_BITS < 32)
+        w2 |= mask & ((i+2 < SG_NLIMBS) ? (uint64_t)a[i+2] : 0);
+    }
+    return (w0 >> r) | (w1 << (SG_BITS - r)) | (w2 << (2*SG_BITS - r));
+#else
+    }
+    return (w0 >> r) | (w1 << (SG_BITS - r));
+#endif
+}
+
+
+static void jacobi_approx(const sg_limb_t* a, const sg_limb_t* b, uint64_t* xa, uint64_t* xb)
+{ // Approximations of a, b >= 0 made of their 31 low bits and of 33 bits starting at the top bit of max(a, b).
+  // These are the exact values when a and b fit in 64 bits
+    unsigned int i, len, n = 0;
+    uint64_t x, mask;
+
+    for (i = 0; i < SG_NLIMBS; i++) {
+        x = (uint64_t)(a[i] | b[i]);
+        mask = 0 - ((x | (0 - x)) >> 63);
+        len = SG_BITS*i + bitlength64(x);
+        n ^= (n ^ len) & (unsigned int)mask;
+    }
+    mask = 0 - (((uint64_t)n - 64) >> 63);          // n = max(n, 64)
+    n ^= (n ^ 64) & (unsigned int)mask;
+
+    *xa = (sg_window(a, 0) & 0x7FFFFFFF) | (sg_window(a, n - 33) << 31);
+    *xb = (sg_window(b, 0) & 0x7FFFFFFF) | (sg_window(b, n - 33) << 31);
+}
+
+
+static void jacobi_update(sg_limb_t* a, sg_limb_t* b, const sg_limb_t f0, const sg_limb_t g0, const sg_limb_t f1, const sg_limb_t g1)
+{ // (a, b) = (f0*a + g0*b, f1*a + g1*b)/2^JACOBI_STEPS, where the divisions are exact
+    sg_dlimb_t ca = 0, cb = 0;
+    sg_ulimb_t ra, rb, pa = 0, pb = 0;
+    unsigned int i;
+
+    for (i = 0; i < SG_NLIMBS; i++) {
+        ca += (sg_dlimb_t)f0*a[i] + (sg_dlimb_t)g0*b[i];
+        cb += (sg_dlimb_t)f1*a[i] + (sg_dlimb_t)g1*b[i];
+        ra = (sg_ulimb_t)ca & SG_MASK;
+        rb = (sg_ulimb_t)cb & SG_MASK;
+        ca >>= SG_BITS;
+        cb >>= SG_BITS;
+        if (i > 0) {
+            a[i-1] = (sg_limb_t)(((pa >> JACOBI_STEPS) | (ra << (SG_BITS - JACOBI_STEPS))) & SG_MASK);
+            b[i-1] = (sg_limb_t)(((pb >> JACOBI_STEPS) | (rb << (SG_BITS - JACOBI_STEPS))) & SG_MASK);
+        }
+        pa = ra;
+        pb = rb;
+    }
+    a[SG_NLIMBS-1] = (sg_limb_t)(pa >> JACOBI_STEPS) + (sg_limb_t)ca*((sg_limb_t)1 << (SG_BITS - JACOBI_STEPS));
+    b[SG_NLIMBS-1] = (sg_limb_t)(pb >> JACOBI_STEPS) + (sg_limb_t)cb*((sg_limb_t)1 << (SG_BITS - JACOBI_STEPS));
+}
+
+
+int fp_jacobi(const felm_t a)
+{ // Legendre symbol of a in GF(p) in constant time: 1 if a is a nonzero square, -1 if it is not a square, 0 if a = 0.
+  // Values in Montgomery representation have the same symbol, since R is an even power of 2.
+    sg_limb_t x[SG_NLIMBS], y[SG_NLIMBS], sx, sy;
+    uint64_t xa, xb, odd, swap, t, f0, g0, f1, g1, ls = 0;
+    digit_t nz = 0;
+    felm_t z;
+    unsigned int i, j;
+
+    fpcopy(a, z);
     fpcorrection(z);
-    if (memcmp((unsigned char*)temp, (unsigned char*)z, NBITS_TO_NBYTES(NBITS_FIELD)) != 0)  // s^2 !=? z
-        return 0;
-    
-    return 1;
+    felm_to_sg(z, x);
+    felm_to_sg((digit_t*)PRIME, y);
+
+    // Invariant: (a|p) = (-1)^ls * (x|y), with x >= 0 and y > 0 odd. At the end x = 0 and y = 1
+    for (i = 0; i < JACOBI_BATCHES; i++) {
+        jacobi_approx(x, y, &xa, &xb);
+        f0 = 1; g0 = 0; f1 = 0; g1 = 1;
+        for (j = 0; j < JACOBI_STEPS; j++) {
+            odd = 0 - (xa & 1);
+            swap = odd & (0 - (((~xa & xb) | (~(xa ^ xb) & (xa - xb))) >> 63));   // xa odd and xa < xb
+            ls ^= swap & ((xa & xb) >> 1);                                    // Reciprocity: -1 if both are 3 mod 4
+            t = swap & (xa ^ xb); xa ^= t; xb ^= t;
+            t = swap & (f0 ^ f1); f0 ^= t; f1 ^= t;
+            t = swap & (g0 ^ g1); g0 ^= t; g1 ^= t;
+            xa -= odd & xb;
+            f0 -= odd & f1;
+            g0 -= odd & g1;
+            xa >>= 1;
+            f1 <<= 1;
+            g1 <<= 1;
+            ls ^= (xb + 2) >> 2;                                              // (2|y) = -1 if y = 3, 5 mod 8
+        }
+        jacobi_update(x, y, (sg_limb_t)(int64_t)f0, (sg_limb_t)(int64_t)g0, (sg_limb_t)(int64_t)f1, (sg_limb_t)(int64_t)g1);
+
+        // The approximations may have led to negative values
+        sx = SG_SIGN(x[SG_NLIMBS-1]);
+        sy = SG_SIGN(y[SG_NLIMBS-1]);
+        for (j = 0; j < SG_NLIMBS; j++) {
+            x[j] = (x[j] ^ sx) - sx;
+            y[j] = (y[j] ^ sy) - sy;
+        }
+        sg_carry(x);
+        sg_carry(y);
+        ls ^= (uint64_t)sx & ((uint64_t)y[0] >> 1);                          // (-1|y) = -1 if y = 3 mod 4
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        nz |= z[i];
+    }
+    nz = (nz | (0 - nz)) >> (RADIX-1);
+    return (int)nz*(1 - 2*(int)(ls & 1));
+}
+
+
+unsigned char is_sqr_fp2(const f2elm_t a)
+{ // Test if a is a square in GF(p^2) and return 1 if true, 0 otherwise.
+  // a is a square if and only if its norm a0^2+a1^2 is a square in GF(p). Runs in constant time.
+    felm_t t0, t1;
+
+    fpsqr_mont(a[0], t0);
+    fpsqr_mont(a[1], t1);
+    fpadd(t0, t1, t0);
+
+    return (unsigned char)(fp_jacobi(t0) >= 0);
 }
 
 
@@ -1015,6 +1406,81 @@ void sqrt_Fp2(const f2elm_t u, f2elm_t y)
 }
 
 
+void sqrtinv2(const f2elm_t v, const f2elm_t z, f2elm_t s, f2elm_t invz)
+{ // Computes the square root s of v as sqrt_Fp2() does and the inverse of z with a single exponentiation:
+  // with n = z0^2+z1^2, (t0*n^4)^((p-3)/4) = t0^((p-3)/4)*n^-2 and its square times t0*n^3 is +-1/n.
+  // A zero t0 or n is replaced by 1 in the exponentiation. The inverse of z = 0 is 0.
+    felm_t t0, t1, t2, t3, e, n, n2;
+    digit_t *a  = (digit_t*)v[0], *b  = (digit_t*)v[1], mask, maskz;
+    unsigned int i;
+
+    fpsqr_mont(a, t0);                   // t0 = a^2
+    fpsqr_mont(b, t1);                   // t1 = b^2
+    fpadd(t0, t1, t0);                   // t0 = t0+t1
+    fpcopy(t0, t1);
+    for (i = 0; i < OALICE_BITS - 2; i++) {   // t = t3^((p+1)/4)
+        fpsqr_mont(t1, t1);
+    }
+    for (i = 0; i < OBOB_EXPON; i++) {
+        fpsqr_mont(t1, t0);
+        fpmul_mont(t1, t0, t1);
+    }
+    fpadd(a, t1, t0);                    // t0 = a+t1
+    fpdiv2(t0, t0);                      // t0 = t0/2
+    fpsqr_mont(z[0], n);
+    fpsqr_mont(z[1], t3);
+    fpadd(n, t3, n);                     // n = z0^2+z1^2
+    fpcorrection(t0);
+    fpcorrection(n);
+    mask = 0;
+    maskz = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mask |= t0[i];
+        maskz |= n[i];
+    }
+    mask = ((mask | (0 - mask)) >> (RADIX-1)) - 1;     // mask = 0xFF...F if t0 = 0
+    maskz = ((maskz | (0 - maskz)) >> (RADIX-1)) - 1;  // maskz = 0xFF...F if n = 0
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        e[i] = t0[i] | (mask & ((digit_t*)&Montgomery_one)[i]);
+        n[i] |= maskz & ((digit_t*)&Montgomery_one)[i];
+    }
+    fpsqr_mont(n, n2);                   // n2 = n^2
+    fpsqr_mont(n2, t2);
+    fpmul_mont(e, t2, t2);               // t2 = e*n^4
+    fpinv_chain_mont(t2);                // t2 = e^((p-3)/4)*n^-2
+    fpsqr_mont(t2, t3);
+    fpmul_mont(t3, e, t3);
+    fpmul_mont(t3, n2, t3);
+    fpmul_mont(t3, n, t3);               // t3 = e^((p-1)/2)/n = +-1/n
+    fpmul_mont(t2, n2, t2);              // t2 = e^((p-3)/4)
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        t2[i] &= ~mask;                  // t2 = t0^((p-3)/4)
+    }
+    fpmul_mont(t0, t2, t1);              // t1 = t2*t0
+    fpmul_mont(t2, b, t2);               // t2 = t2*b
+    fpdiv2(t2, t2);                      // t2 = t2/2
+    fpsqr_mont(t1, n);                   // n = t1^2
+    fpcorrection(n);
+
+    if (memcmp(t0, n, NBITS_TO_NBYTES(NBITS_FIELD)) == 0) {
+        fpcopy(t1, s[0]);
+        fpcopy(t2, s[1]);
+    } else {                             // t0^((p-1)/2) = -1
+        fpneg(t1);
+        fpcopy(t2, s[0]);
+        fpcopy(t1, s[1]);
+        fpneg(t3);
+    }
+    fpmul_mont(z[0], t3, invz[0]);
+    fpneg(t3);
+    fpmul_mont(z[1], t3, invz[1]);       // invz = (z0-i*z1)/n
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        invz[0][i] &= ~maskz;
+        invz[1][i] &= ~maskz;
+    }
+}
+
+
 static __inline void power2_setup(digit_t* x, int mark, const unsigned int nwords)
 { // Set up the value 2^mark.
     unsigned int i;
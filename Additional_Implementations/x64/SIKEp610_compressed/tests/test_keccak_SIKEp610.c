@@ -0,0 +1,16 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the 4-way SHAKE256 for SIKEp610 using compression
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp610_compressed"
+
+
+#include "test_keccak.c"
@@ -0,0 +1,121 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: run-time selection of the field arithmetic for P751 on x64 platforms
+*********************************************************************************************/
+
+#include <cpuid.h>
+
+// Portable C backend, with its functions renamed so that they can coexist with the x64 ones
+#define mp_sub751_p2              mp_sub751_p2_generic
+#define mp_sub751_p4              mp_sub751_p4_generic
+#define fpadd751                  fpadd751_generic
+#define fpsub751                  fpsub751_generic
+#define fpneg751                  fpneg751_generic
+#define fpdiv2_751                fpdiv2_751_generic
+#define fpcorrection751           fpcorrection751_generic
+#define digit_x_digit             digit_x_digit_generic
+#define mp_mul                    mp_mul_generic
+#define rdc_mont                  rdc_mont_generic
+
+#include "../generic/fp_generic.c"
+#include "../../fp_dispatch.h"
+
+
+// x64 assembly, assembled once per instruction set (see the makefile)
+#define FP_ASM_PROTOTYPES(s)                                                    \
+    void fpadd751_asm##s(const digit_t* a, const digit_t* b, digit_t* c);        \
+    void fpsub751_asm##s(const digit_t* a, const digit_t* b, digit_t* c);        \
+    void mp_add751_asm##s(const digit_t* a, const digit_t* b, digit_t* c);       \
+    void mp_sub751_p2_asm##s(const digit_t* a, const digit_t* b, digit_t* c);    \
+    void mp_sub751_p4_asm##s(const digit_t* a, const digit_t* b, digit_t* c);    \
+    void mp_subadd751x2_asm##s(const digit_t* a, const digit_t* b, digit_t* c);  \
+    void mp_dblsub751x2_asm##s(const digit_t* a, const digit_t* b, digit_t* c);  \
+    void mul751_asm##s(const digit_t* a, const digit_t* b, digit_t* c);          \
+    void rdc751_asm##s(digit_t* ma, digit_t* mc);
+
+FP_ASM_PROTOTYPES(_x64)
+FP_ASM_PROTOTYPES(_mulx)
+FP_ASM_PROTOTYPES(_adx)
+
+
+static void mp_add751_generic(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision addition, c = a+b.
+    mp_add(a, b, c, NWORDS_FIELD);
+}
+
+
+static void mp_subadd751x2_generic(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision subtraction followed by addition with p751*2^MAXBITS_FIELD, c = a-b+(p751*2^MAXBITS_FIELD) if a-b < 0, otherwise c=a-b.
+    felm_t t1;
+
+    digit_t mask = 0 - (digit_t)mp_sub(a, b, c, 2*NWORDS_FIELD);
+    for (int i = 0; i < NWORDS_FIELD; i++)
+        t1[i] = ((digit_t*)p751)[i] & mask;
+    mp_add((digit_t*)&c[NWORDS_FIELD], t1, (digit_t*)&c[NWORDS_FIELD], NWORDS_FIELD);
+}
+
+
+static void mp_dblsub751x2_generic(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision subtraction, c = c-a-b, where lng(a) = lng(b) = 2*NWORDS_FIELD.
+    mp_sub(c, a, c, 2*NWORDS_FIELD);
+    mp_sub(c, b, c, 2*NWORDS_FIELD);
+}
+
+
+static void mul751_generic(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision multiplication, c = a*b.
+    mp_mul_generic(a, b, c, NWORDS_FIELD);
+}
+
+
+const fp_backend_t fp_backends[FP_BACKEND_COUNT] = {
+    { "generic", fpadd751_generic, fpsub751_generic, mp_add751_generic, mp_sub751_p2_generic, mp_sub751_p4_generic,
+      mp_subadd751x2_generic, mp_dblsub751x2_generic, mul751_generic, rdc_mont_generic },
+    { "x64", fpadd751_asm_x64, fpsub751_asm_x64, mp_add751_asm_x64, mp_sub751_p2_asm_x64, mp_sub751_p4_asm_x64,
+      mp_subadd751x2_asm_x64, mp_dblsub751x2_asm_x64, mul751_asm_x64, rdc751_asm_x64 },
+    { "mulx", fpadd751_asm_mulx, fpsub751_asm_mulx, mp_add751_asm_mulx, mp_sub751_p2_asm_mulx, mp_sub751_p4_asm_mulx,
+      mp_subadd751x2_asm_mulx, mp_dblsub751x2_asm_mulx, mul751_asm_mulx, rdc751_asm_mulx },
+    { "mulx+adx", fpadd751_asm_adx, fpsub751_asm_adx, mp_add751_asm_adx, mp_sub751_p2_asm_adx, mp_sub751_p4_asm_adx,
+      mp_subadd751x2_asm_adx, mp_dblsub751x2_asm_adx, mul751_asm_adx, rdc751_asm_adx }
+};
+
+const fp_backend_t* fp_backend = &fp_backends[FP_BACKEND_GENERIC];
+
+
+int fp_backend_supported(unsigned int backend)
+{ // Returns 1 if the processor supports the given backend, 0 otherwise
+    unsigned int eax, ebx = 0, ecx, edx;
+
+    if (backend >= FP_BACKEND_COUNT) {
+        return 0;
+    }
+    if (backend <= FP_BACKEND_X64) {
+        return 1;
+    }
+    __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx);    // Leaves ebx = 0 if leaf 7 is not available
+    if (backend == FP_BACKEND_MULX) {
+        return (ebx & bit_BMI2) != 0;
+    }
+    return (ebx & bit_BMI2) != 0 && (ebx & bit_ADX) != 0;
+}
+
+
+int fp_backend_select(unsigned int backend)
+{ // Switches to the given backend. Returns 0 on success and -1 if it is not supported
+    if (!fp_backend_supported(backend)) {
+        return -1;
+    }
+    fp_backend = &fp_backends[backend];
+    return 0;
+}
+
+
+__attribute__((constructor)) static void fp_backend_init(void)
+{ // Selects the fastest backend supported by the processor when the library is loaded
+    unsigned int backend = FP_BACKEND_COUNT-1;
+
+    while (fp_backend_select(backend) != 0) {
+        backend--;
+    }
+}
@@ -0,0 +1,59 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny computations in eight lanes for P751 using AVX-512 IFMA
+*********************************************************************************************/
+
+#include "../P751_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_52       15         // Number of limbs in radix 2^52, R' = 2^780
+
+// p751, 2*p751 and 4*p751 in radix 2^52
+static const uint64_t p_52[3][NLIMBS_52] = {
+    {
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x00049F878A8EEAFF,
+      0x0007CC76E3EC9685, 0x00076DA959B1A13F, 0x00084E9867D6EBE8, 0x000B5045CB257480,
+      0x000F97BADC668562, 0x00041F71C0E12909, 0x00000000006FE5D5 },
+    {
+      0x000FFFFFFFFFFFFE, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x00093F0F151DD5FF,
+      0x000F98EDC7D92D0A, 0x000EDB52B363427E, 0x00009D30CFADD7D0, 0x0006A08B964AE901,
+      0x000F2F75B8CD0AC5, 0x00083EE381C25213, 0x0000000000DFCBAA },
+    {
+      0x000FFFFFFFFFFFFC, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF,
+      0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x000FFFFFFFFFFFFF, 0x00027E1E2A3BABFF,
+      0x000F31DB8FB25A15, 0x000DB6A566C684FD, 0x00013A619F5BAFA1, 0x000D41172C95D202,
+      0x000E5EEB719A158A, 0x00007DC70384A427, 0x0000000001BF9755 } };
+
+// Conversion constants: R'^2/R mod p751 maps the Montgomery representation with R = 2^768 to the one with R',
+// and R mod p751 maps it back
+static const uint64_t to_mont_52[NLIMBS_52] = {
+    0x00000249AD67C3FF, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000E822291A2EB00,
+    0x000C397715452356, 0x00082A796EA41E7E, 0x000C83FB3EDF886E, 0x00019B40AAC77043,
+    0x000DC309584457DC, 0x000D7CA701397670, 0x000000000067FAC9 };
+static const uint64_t from_mont_52[NLIMBS_52] = {
+    0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000375C6C6683100,
+    0x000F24D05527B1E4, 0x0002E697797BF3F4, 0x00089DB7B2AC5C4E, 0x000B439D2076956C,
+    0x000C7512C7E94CA4, 0x000BCE5E210F7926, 0x00000000002D5B24 };
+
+// Value one in Montgomery representation with R'
+static const uint64_t one_52[NLIMBS_52] = {
+    0x00000000249AD67C, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001F9800C542C00,
+    0x000B326488FE3B2A, 0x000E6176236DB777, 0x000DD6E970232B83, 0x000D4D762277573F,
+    0x00054CD16C015F35, 0x0009FC72438C4FC7, 0x00000000001BF8F6 };
+
+
+#define keygen_A_x8                   keygen_A751_x8
+#define keygen_B_x8                   keygen_B751_x8
+#define agreement_A_x8                agreement_A751_x8
+#define agreement_B_x8                agreement_B751_x8
+#define fp_ifma_enabled               fp751_ifma_enabled
+#define fp_ifma_supported             fp751_ifma_supported
+
+#include "../../sidh_x8.c"
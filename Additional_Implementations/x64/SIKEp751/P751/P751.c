@@ -7,6 +7,9 @@
 #include "api.h" 
 #include "P751_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -72,6 +75,9 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x00000000000249ad, 0x00000
 
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P751_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 
@@ -91,6 +97,12 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+#endif
+
+#ifdef _FIXED_BASE_LADDER_
+// Precomputed multiples of the fixed generators for the three-point ladder in key generation
+#include "P751_ladder_tables.c"
+#endif
 
 // Setting up macro defines and including GF(p), GF(p^2), curve, isogeny and kex functions
 #define fpcopy                        fpcopy751
@@ -105,6 +117,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fpinv_mont                    fpinv751_mont
 #define fpinv_chain_mont              fpinv751_chain_mont
 #define fpinv_mont_bingcd             fpinv751_mont_bingcd
+#define fpinv_mont_safegcd            fpinv751_mont_safegcd
 #define fp2copy                       fp2copy751
 #define fp2zero                       fp2zero751
 #define fp2add                        fp2add751
@@ -120,9 +133,24 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 #define fp2inv_mont                   fp2inv751_mont
 #define fp2inv_mont_bingcd            fp2inv751_mont_bingcd
 #define fpequal_non_constant_time     fpequal751_non_constant_time
+#define fp_ifma_enabled               fp751_ifma_enabled
+#define keygen_A_x8                   keygen_A751_x8
+#define keygen_B_x8                   keygen_B751_x8
+#define agreement_A_x8                agreement_A751_x8
+#define agreement_B_x8                agreement_B751_x8
+#define eval_4_isog_x4                eval_4_isog751_x4
+#define eval_3_isog_x4                eval_3_isog751_x4
+#define eval_4_isog_x2                eval_4_isog751_x2
+#define eval_3_isog_x2                eval_3_isog751_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add751_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
+#endif
 
 
 #include "../fpx.c"
@@ -0,0 +1,349 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: evaluation of 3- and 4-isogenies at two or four points in the lanes of AVX2 vectors
+*********************************************************************************************/
+
+#include <immintrin.h>
+
+// Every lane of a vector belongs to a different point, and a field element is spread over NLIMBS_28 vectors
+// that hold its limbs in radix 2^28, which leaves room in the 64-bit lanes for the columns of the products.
+// The Montgomery reduction divides by R = 2^(64*NWORDS_FIELD) like the single-point one, so the points and
+// coefficients only change radix, and the functions below accept and return values in the same ranges as
+// their single-point counterparts
+#define MASK_28         0xFFFFFFFULL
+#define NSTEPS_28       ((64*NWORDS_FIELD) / 28)                // Number of reduction steps of 28 bits
+#define REM_28          ((64*NWORDS_FIELD) % 28)                // Number of bits reduced by the last, partial step
+#define NQUOT_28        (NSTEPS_28 + (REM_28 != 0))             // Number of quotient digits
+
+#if (VEC_LANES == 4)
+    typedef __m256i vec_t;
+    #define vzero()         _mm256_setzero_si256()
+    #define vset(x)         _mm256_set1_epi64x((long long)(x))
+    #define vload(p)        _mm256_load_si256((const __m256i*)(p))
+    #define vstore(p, a)    _mm256_store_si256((__m256i*)(p), a)
+    #define vadd(a, b)      _mm256_add_epi64(a, b)
+    #define vsub(a, b)      _mm256_sub_epi64(a, b)
+    #define vmul(a, b)      _mm256_mul_epu32(a, b)
+    #define vand(a, b)      _mm256_and_si256(a, b)
+    #define vor(a, b)       _mm256_or_si256(a, b)
+    #define vsrl(a, n)      _mm256_srli_epi64(a, n)
+    #define vsll(a, n)      _mm256_slli_epi64(a, n)
+    #define vsign(a)        _mm256_cmpgt_epi64(_mm256_setzero_si256(), a)
+#elif (VEC_LANES == 2)
+    typedef __m128i vec_t;
+    #define vzero()         _mm_setzero_si128()
+    #define vset(x)         _mm_set1_epi64x((long long)(x))
+    #define vload(p)        _mm_load_si128((const __m128i*)(p))
+    #define vstore(p, a)    _mm_store_si128((__m128i*)(p), a)
+    #define vadd(a, b)      _mm_add_epi64(a, b)
+    #define vsub(a, b)      _mm_sub_epi64(a, b)
+    #define vmul(a, b)      _mm_mul_epu32(a, b)
+    #define vand(a, b)      _mm_and_si128(a, b)
+    #define vor(a, b)       _mm_or_si128(a, b)
+    #define vsrl(a, n)      _mm_srli_epi64(a, n)
+    #define vsll(a, n)      _mm_slli_epi64(a, n)
+    #define vsign(a)        _mm_cmpgt_epi64(_mm_setzero_si128(), a)
+#else
+    #error -- "VEC_LANES must be 2 or 4"
+#endif
+
+typedef vec_t felm_vec_t[NLIMBS_28];
+typedef felm_vec_t f2elm_vec_t[2];
+typedef struct { f2elm_vec_t X; f2elm_vec_t Z; } point_proj_vec;
+typedef point_proj_vec point_proj_vec_t[1];
+
+
+static inline __attribute__((always_inline)) void normalize_vec(felm_vec_t a)
+{ // Carry propagation for non-negative limbs, leaves limbs in [0, 2^28-1] except the most significant one
+    const vec_t mask = vset(MASK_28);
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_28-1; i++) {
+        a[i+1] = vadd(a[i+1], vsrl(a[i], 28));
+        a[i] = vand(a[i], mask);
+    }
+}
+
+
+static inline __attribute__((always_inline)) void normalize_signed_vec(felm_vec_t a)
+{ // Carry propagation, leaves limbs in [0, 2^28-1] except the most significant one, which keeps the sign of a.
+  // AVX2 has no 64-bit arithmetic shift, so the sign is copied into the 28 upper bits of the carries
+    const vec_t mask = vset(MASK_28);
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_28-1; i++) {
+        a[i+1] = vadd(a[i+1], vor(vsrl(a[i], 28), vsll(vsign(a[i]), 36)));
+        a[i] = vand(a[i], mask);
+    }
+}
+
+
+static void fpmul_mont_vec(const felm_vec_t a, const felm_vec_t b, felm_vec_t c)
+{ // Montgomery multiplication in each lane, c = a*b*R^-1 mod p.
+  // If a*b < R*p, the outputs are in the range [0, 2*p-1].
+  // The product and the reduction are accumulated column by column. Since -p^-1 = 1 mod 2^28, the quotient digit
+  // of a column is its lowest 28 bits (REM_28 bits for the last one), and q*p = q*(p+1) - q only adds the nonzero
+  // limbs of p+1 to the following columns. The loops are unrolled so that all the indices are constants
+    const vec_t mask = vset(MASK_28);
+    vec_t q[NQUOT_28], u[2*NLIMBS_28-NSTEPS_28], acc = vzero();
+    unsigned int i, j, k;
+
+    #pragma GCC unroll 64
+    for (k = 0; k < 2*NLIMBS_28; k++) {
+        #pragma GCC unroll 32
+        for (j = 0; j < NLIMBS_28; j++) {
+            if (j <= k && k-j < NLIMBS_28)
+                acc = vadd(acc, vmul(a[j], b[k-j]));
+        }
+        #pragma GCC unroll 32
+        for (i = 0; i < NQUOT_28; i++) {
+            if (i+ZERO_LIMBS_28 <= k && k-i < NLIMBS_28)
+                acc = vadd(acc, vmul(q[i], vset(p_28[3][k-i])));
+        }
+
+        if (k < NSTEPS_28) {
+            q[k] = vand(acc, mask);
+            acc = vsrl(acc, 28);
+        } else {
+            if (k == NSTEPS_28 && REM_28 != 0) {
+                q[k] = vand(acc, vset((1ULL << REM_28) - 1));
+                acc = vsub(acc, q[k]);
+            }
+            u[k-NSTEPS_28] = vand(acc, mask);
+            acc = vsrl(acc, 28);
+        }
+    }
+
+    // Division by 2^REM_28 that completes the division by R
+    for (i = 0; i < NLIMBS_28; i++) {
+        if (REM_28 == 0) {
+            c[i] = u[i];
+        } else {
+            c[i] = vand(vor(vsrl(u[i], REM_28), vsll(u[i+1], 28-REM_28)), mask);
+        }
+    }
+}
+
+
+static inline void mp_add_vec(const felm_vec_t a, const felm_vec_t b, felm_vec_t c)
+{ // Addition without reduction, c = a+b
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_28; i++)
+        c[i] = vadd(a[i], b[i]);
+    normalize_vec(c);
+}
+
+
+static inline void mp_sub_px_vec(const felm_vec_t a, const felm_vec_t b, felm_vec_t c, const unsigned int k)
+{ // Subtraction followed by the addition of a multiple of p, c = a-b+2^k*p for k = 1 or 2
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_28; i++)
+        c[i] = vadd(vsub(a[i], b[i]), vset(p_28[k][i]));
+    normalize_signed_vec(c);
+}
+
+
+static void fpsub_vec(const felm_vec_t a, const felm_vec_t b, felm_vec_t c)
+{ // Modular subtraction, c = a-b mod p. Inputs and outputs are in [0, 2*p-1]
+    vec_t neg;
+    unsigned int i;
+
+    for (i = 0; i < NLIMBS_28; i++)
+        c[i] = vsub(a[i], b[i]);
+    normalize_signed_vec(c);
+
+    neg = vsign(c[NLIMBS_28-1]);                    // Adds 2*p to the lanes in which a-b is negative
+    for (i = 0; i < NLIMBS_28; i++)
+        c[i] = vadd(c[i], vand(vset(p_28[1][i]), neg));
+    normalize_vec(c);
+}
+
+
+static inline void mp2_add_vec(const f2elm_vec_t a, const f2elm_vec_t b, f2elm_vec_t c)
+{ // GF(p^2) addition without reduction, c = a+b
+    mp_add_vec(a[0], b[0], c[0]);
+    mp_add_vec(a[1], b[1], c[1]);
+}
+
+
+static inline void mp2_sub_p2_vec(const f2elm_vec_t a, const f2elm_vec_t b, f2elm_vec_t c)
+{ // GF(p^2) subtraction with correction with 2*p, c = a-b+2p
+    mp_sub_px_vec(a[0], b[0], c[0], 1);
+    mp_sub_px_vec(a[1], b[1], c[1], 1);
+}
+
+
+static void fp2mul_mont_vec(const f2elm_vec_t a, const f2elm_vec_t b, f2elm_vec_t c)
+{ // GF(p^2) multiplication using Montgomery arithmetic, c = a*b in GF(p^2).
+  // Inputs: a = a0+a1*i and b = b0+b1*i, where a0, a1, b0, b1 are in [0, 2*p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1]
+    felm_vec_t t1, t2, tt1, tt2, tt3;
+
+    mp_add_vec(a[0], a[1], t1);                     // t1 = a0+a1
+    mp_add_vec(b[0], b[1], t2);                     // t2 = b0+b1
+    fpmul_mont_vec(a[0], b[0], tt1);                // tt1 = a0*b0
+    fpmul_mont_vec(a[1], b[1], tt2);                // tt2 = a1*b1
+    fpmul_mont_vec(t1, t2, tt3);                    // tt3 = (a0+a1)*(b0+b1)
+    fpsub_vec(tt1, tt2, c[0]);                      // c0 = a0*b0 - a1*b1
+    fpsub_vec(tt3, tt1, tt3);
+    fpsub_vec(tt3, tt2, c[1]);                      // c1 = (a0+a1)*(b0+b1) - a0*b0 - a1*b1
+}
+
+
+static void fp2sqr_mont_vec(const f2elm_vec_t a, f2elm_vec_t c)
+{ // GF(p^2) squaring using Montgomery arithmetic, c = a^2 in GF(p^2).
+  // Inputs: a = a0+a1*i, where a0, a1 are in [0, 2*p-1]
+  // Output: c = c0+c1*i, where c0, c1 are in [0, 2*p-1]
+    felm_vec_t t1, t2, t3;
+
+    mp_add_vec(a[0], a[1], t1);                     // t1 = a0+a1
+    mp_sub_px_vec(a[0], a[1], t2, 2);               // t2 = a0-a1+4p
+    mp_add_vec(a[0], a[0], t3);                     // t3 = 2a0
+    fpmul_mont_vec(t1, t2, c[0]);                   // c0 = (a0+a1)(a0-a1)
+    fpmul_mont_vec(t3, a[1], c[1]);                 // c1 = 2a0*a1
+}
+
+
+static void fp2_to_vec(const f2elm_t* const* a, f2elm_vec_t c)
+{ // Conversion of the GF(p^2) elements *a[0], ..., *a[VEC_LANES-1] to radix 2^28, lane j receives *a[j]
+    uint64_t t[NLIMBS_28][VEC_LANES] __attribute__((aligned(32)));
+    unsigned int i, j, k, w, s;
+
+    for (k = 0; k < 2; k++) {
+        for (j = 0; j < VEC_LANES; j++) {
+            const digit_t* x = (*a[j])[k];
+            for (i = 0; i < NLIMBS_28; i++) {
+                w = (28*i) / 64;
+                s = (28*i) % 64;
+                t[i][j] = x[w] >> s;
+                if (s > 36 && w+1 < NWORDS_FIELD) {
+                    t[i][j] |= x[w+1] << (64-s);
+                }
+                t[i][j] &= MASK_28;
+            }
+        }
+        for (i = 0; i < NLIMBS_28; i++)
+            c[k][i] = vload(t[i]);
+    }
+}
+
+
+static void fp2_from_vec(const f2elm_vec_t a, f2elm_t* const* c)
+{ // Conversion of the lanes of a to GF(p^2) elements in radix 2^64, lane j is written to *c[j]
+    uint64_t t[NLIMBS_28][VEC_LANES] __attribute__((aligned(32)));
+    unsigned int i, j, k, w, s;
+
+    for (k = 0; k < 2; k++) {
+        for (i = 0; i < NLIMBS_28; i++)
+            vstore(t[i], a[k][i]);
+        for (j = 0; j < VEC_LANES; j++) {
+            digit_t* x = (*c[j])[k];
+            for (w = 0; w < NWORDS_FIELD; w++)
+                x[w] = 0;
+            for (i = 0; i < NLIMBS_28; i++) {
+                w = (28*i) / 64;
+                s = (28*i) % 64;
+                x[w] |= t[i][j] << s;
+                if (s > 36 && w+1 < NWORDS_FIELD) {
+                    x[w+1] |= t[i][j] >> (64-s);
+                }
+            }
+        }
+    }
+}
+
+
+static void point_to_vec(point_proj* const* P, point_proj_vec_t Q)
+{ // Conversion of the points P[0], ..., P[VEC_LANES-1] to the lanes of Q
+    const f2elm_t* x[VEC_LANES];
+    const f2elm_t* z[VEC_LANES];
+    unsigned int j;
+
+    for (j = 0; j < VEC_LANES; j++) {
+        x[j] = &P[j]->X;
+        z[j] = &P[j]->Z;
+    }
+    fp2_to_vec(x, Q->X);
+    fp2_to_vec(z, Q->Z);
+}
+
+
+static void point_from_vec(const point_proj_vec_t Q, point_proj* const* P)
+{ // Conversion of the lanes of Q to the points P[0], ..., P[VEC_LANES-1]
+    f2elm_t* x[VEC_LANES];
+    f2elm_t* z[VEC_LANES];
+    unsigned int j;
+
+    for (j = 0; j < VEC_LANES; j++) {
+        x[j] = &P[j]->X;
+        z[j] = &P[j]->Z;
+    }
+    fp2_from_vec(Q->X, x);
+    fp2_from_vec(Q->Z, z);
+}
+
+
+static void coeff_to_vec(const f2elm_t* coeff, const unsigned int n, f2elm_vec_t* c)
+{ // Broadcast of the n isogeny coefficients in coeff to all the lanes of c
+    const f2elm_t* x[VEC_LANES];
+    unsigned int i, j;
+
+    for (i = 0; i < n; i++) {
+        for (j = 0; j < VEC_LANES; j++)
+            x[j] = &coeff[i];
+        fp2_to_vec(x, c[i]);
+    }
+}
+
+
+void eval_4_isog_vec(point_proj* const* P, f2elm_t* coeff)
+{ // Evaluates a 4-isogeny at the VEC_LANES points P[0], ..., P[VEC_LANES-1], see eval_4_isog()
+    point_proj_vec_t Q;
+    f2elm_vec_t c[3], t0, t1;
+
+    coeff_to_vec(coeff, 3, c);
+    point_to_vec(P, Q);
+
+    mp2_add_vec(Q->X, Q->Z, t0);                    // t0 = X+Z
+    mp2_sub_p2_vec(Q->X, Q->Z, t1);                 // t1 = X-Z
+    fp2mul_mont_vec(t0, c[1], Q->X);                // X = (X+Z)*coeff[1]
+    fp2mul_mont_vec(t1, c[2], Q->Z);                // Z = (X-Z)*coeff[2]
+    fp2mul_mont_vec(t0, t1, t0);                    // t0 = (X+Z)*(X-Z)
+    fp2mul_mont_vec(c[0], t0, t0);                  // t0 = coeff[0]*(X+Z)*(X-Z)
+    mp2_add_vec(Q->X, Q->Z, t1);                    // t1 = (X-Z)*coeff[2] + (X+Z)*coeff[1]
+    mp2_sub_p2_vec(Q->X, Q->Z, Q->Z);               // Z = (X-Z)*coeff[2] - (X+Z)*coeff[1]
+    fp2sqr_mont_vec(t1, t1);                        // t1 = [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    fp2sqr_mont_vec(Q->Z, Q->Z);                    // Z = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2
+    mp2_add_vec(t1, t0, Q->X);                      // X = coeff[0]*(X+Z)*(X-Z) + [(X-Z)*coeff[2] + (X+Z)*coeff[1]]^2
+    mp2_sub_p2_vec(Q->Z, t0, t0);                   // t0 = [(X-Z)*coeff[2] - (X+Z)*coeff[1]]^2 - coeff[0]*(X+Z)*(X-Z)
+    fp2mul_mont_vec(Q->X, t1, Q->X);                // Xfinal
+    fp2mul_mont_vec(Q->Z, t0, Q->Z);                // Zfinal
+
+    point_from_vec(Q, P);
+}
+
+
+void eval_3_isog_vec(point_proj* const* P, const f2elm_t* coeff)
+{ // Evaluates a 3-isogeny at the VEC_LANES points P[0], ..., P[VEC_LANES-1], see eval_3_isog()
+    point_proj_vec_t Q;
+    f2elm_vec_t c[2], t0, t1, t2;
+
+    coeff_to_vec(coeff, 2, c);
+    point_to_vec(P, Q);
+
+    mp2_add_vec(Q->X, Q->Z, t0);                    // t0 = X+Z
+    mp2_sub_p2_vec(Q->X, Q->Z, t1);                 // t1 = X-Z
+    fp2mul_mont_vec(c[0], t0, t0);                  // t0 = coeff0*(X+Z)
+    fp2mul_mont_vec(c[1], t1, t1);                  // t1 = coeff1*(X-Z)
+    mp2_add_vec(t0, t1, t2);                        // t2 = coeff0*(X+Z) + coeff1*(X-Z)
+    mp2_sub_p2_vec(t1, t0, t0);                     // t0 = coeff1*(X-Z) - coeff0*(X+Z)
+    fp2sqr_mont_vec(t2, t2);                        // t2 = [coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2sqr_mont_vec(t0, t0);                        // t0 = [coeff1*(X-Z) - coeff0*(X+Z)]^2
+    fp2mul_mont_vec(Q->X, t2, Q->X);                // X3final = X*[coeff0*(X+Z) + coeff1*(X-Z)]^2
+    fp2mul_mont_vec(Q->Z, t0, Q->Z);                // Z3final = Z*[coeff1*(X-Z) - coeff0*(X+Z)]^2
+
+    point_from_vec(Q, P);
+}
@@ -69,6 +69,9 @@ void mont_n_way_inv(const f2elm_t* vec, const int n, f2elm_t* out);
 // Computes the j-invariant of a Montgomery curve with projective constant.
 void j_inv(const f2elm_t A, const f2elm_t C, f2elm_t jinv);
 
+// Computes the j-invariant of a Montgomery curve with projective constant as a fraction jnum/jden.
+void j_inv_proj(const f2elm_t A, const f2elm_t C, f2elm_t jnum, f2elm_t jden);
+
 // Simultaneous doubling and differential addition.
 void xDBLADD(point_proj_t P, point_proj_t Q, const f2elm_t xPQ, const f2elm_t A24);
 
@@ -102,6 +105,9 @@ void eval_3_isog(point_proj_t Q, const f2elm_t* coeff);
 // 3-way simultaneous inversion
 void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 
+// n-way simultaneous inversion in constant time, t is scratch space for n elements. The inverse of a zero input is 0
+void inv_n_way(f2elm_t* z, f2elm_t* t, const unsigned int n);
+
 // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 
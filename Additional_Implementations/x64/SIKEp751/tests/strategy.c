@@ -0,0 +1,318 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals on the build host
+*********************************************************************************************/
+
+
+// Benchmark parameters
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define COST_LOOPS        51      // Number of samples per measured cost
+    #define BENCH_LOOPS       10      // Number of iterations per bench
+#else
+    #define COST_LOOPS       501
+    #define BENCH_LOOPS      100
+#endif
+
+#define MAX_LEAVES           ((MAX_Alice > MAX_Bob) ? MAX_Alice : MAX_Bob)
+#define MAX_POINTS           ((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+
+static unsigned int tuned_Alice[MAX_Alice-1];
+static unsigned int tuned_Bob[MAX_Bob-1];
+
+
+static unsigned long long median(unsigned long long* v, const unsigned int n)
+{ // Median of n samples, v is sorted in place
+    unsigned int i, j;
+    unsigned long long t;
+
+    for (i = 1; i < n; i++) {
+        t = v[i];
+        for (j = i; j > 0 && v[j-1] > t; j--) {
+            v[j] = v[j-1];
+        }
+        v[j] = t;
+    }
+    return v[n/2];
+}
+
+
+static void random_point(point_proj_t P)
+{
+    fp2random_test((digit_t*)P->X);
+    fp2random_test((digit_t*)P->Z);
+}
+
+
+static void measure_costs(const unsigned int AliceOrBob, unsigned long long* step, unsigned long long* eval)
+{ // Cycles of one step down the tree (two doublings or one tripling) and of one isogeny evaluation
+    unsigned int n;
+    unsigned long long s[COST_LOOPS], e[COST_LOOPS], cycles1, cycles2;
+    point_proj_t P, K;
+    f2elm_t A24, C24, coeff[3];
+
+    random_point(P);
+    random_point(K);
+    fp2random_test((digit_t*)A24);
+    fp2random_test((digit_t*)C24);
+
+    for (n = 0; n < COST_LOOPS; n++) {
+        if (AliceOrBob == ALICE) {
+            cycles1 = cpucycles();
+            xDBLe(P, P, A24, C24, 2);
+            cycles2 = cpucycles();
+            s[n] = cycles2-cycles1;
+            get_4_isog(K, A24, C24, coeff);
+            cycles1 = cpucycles();
+            eval_4_isog(P, coeff);
+            cycles2 = cpucycles();
+            e[n] = cycles2-cycles1;
+        } else {
+            cycles1 = cpucycles();
+            xTPL(P, P, A24, C24);
+            cycles2 = cpucycles();
+            s[n] = cycles2-cycles1;
+            get_3_isog(K, A24, C24, coeff);
+            cycles1 = cpucycles();
+            eval_3_isog(P, coeff);
+            cycles2 = cpucycles();
+            e[n] = cycles2-cycles1;
+        }
+    }
+    *step = median(s, COST_LOOPS);
+    *eval = median(e, COST_LOOPS);
+}
+
+
+static unsigned int emit_strategy(unsigned int (*split)[MAX_POINTS+1], const unsigned int n, const unsigned int k, unsigned int* strat)
+{ // Writes the strategy for a subtree with n leaves and k free point slots, returns its length
+    unsigned int b, len;
+
+    if (n == 1) return 0;
+    b = split[n][k];
+    strat[0] = b;
+    len = 1 + emit_strategy(split, n-b, k-1, strat+1);
+    return len + emit_strategy(split, b, k, strat+len);
+}
+
+
+static void optimal_strategy(const unsigned int n, const unsigned int npoints, const unsigned long long step, const unsigned long long eval, unsigned int* strat)
+{ // Optimal strategy for a tree with n leaves that stores at most npoints intermediate points [De Feo, Jao, Plut].
+  // A subtree with i leaves is split at b: b steps down, the subtree with i-b leaves, i-b evaluations of the stored point,
+  // and the subtree with b leaves.
+    static unsigned long long cost[MAX_LEAVES+1][MAX_POINTS+1];
+    static unsigned int split[MAX_LEAVES+1][MAX_POINTS+1];
+    unsigned int i, k, b;
+    unsigned long long c;
+
+    for (k = 0; k <= npoints; k++) {
+        cost[1][k] = 0;
+    }
+    for (i = 2; i <= n; i++) {
+        cost[i][0] = (unsigned long long)-1;
+        for (k = 1; k <= npoints; k++) {
+            cost[i][k] = (unsigned long long)-1;
+            for (b = 1; b < i; b++) {
+                if (cost[i-b][k-1] == (unsigned long long)-1) continue;
+                c = cost[i-b][k-1] + cost[b][k] + b*step + (i-b)*eval;
+                if (c < cost[i][k]) {
+                    cost[i][k] = c;
+                    split[i][k] = b;
+                }
+            }
+        }
+    }
+    emit_strategy(split, n, npoints, strat);
+}
+
+
+static unsigned long long strategy_cost(const unsigned int* strat, const unsigned int n, const unsigned long long step, const unsigned long long eval, unsigned int* len)
+{ // Cost of a strategy under the model used by optimal_strategy()
+    unsigned int b, l1, l2;
+    unsigned long long c;
+
+    if (n == 1) {
+        *len = 0;
+        return 0;
+    }
+    b = strat[0];
+    c = b*step + (n-b)*eval + strategy_cost(strat+1, n-b, step, eval, &l1);
+    c += strategy_cost(strat+1+l1, b, step, eval, &l2);
+    *len = 1 + l1 + l2;
+    return c;
+}
+
+
+static unsigned long long traverse(const unsigned int AliceOrBob, const unsigned int* strat)
+{ // Cycles of a tree traversal as in key generation, including the evaluation of the three basis points
+    point_proj_t R, phiP, phiQ, phiR, pts[MAX_POINTS];
+    f2elm_t A24, C24, coeff[3];
+    unsigned int i, row, m, index = 0, pts_index[MAX_POINTS], npts = 0, ii = 0;
+    unsigned int max = (AliceOrBob == ALICE) ? MAX_Alice : MAX_Bob;
+    unsigned long long cycles1, cycles2;
+
+    random_point(R);
+    random_point(phiP);
+    random_point(phiQ);
+    random_point(phiR);
+    fp2random_test((digit_t*)A24);
+    fp2random_test((digit_t*)C24);
+
+    cycles1 = cpucycles();
+    for (row = 1; row < max; row++) {
+        while (index < max-row) {
+            fp2copy(R->X, pts[npts]->X);
+            fp2copy(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            m = strat[ii++];
+            if (AliceOrBob == ALICE) {
+                xDBLe(R, R, A24, C24, (int)(2*m));
+            } else {
+                xTPLe(R, R, A24, C24, (int)m);
+            }
+            index += m;
+        }
+        if (AliceOrBob == ALICE) {
+            get_4_isog(R, A24, C24, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+            eval_4_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+            eval_4_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
+            for (i = 0; i < npts; i++) {
+                eval_4_isog(pts[i], coeff);
+            }
+            eval_4_isog(phiP, coeff);
+            eval_4_isog(phiQ, coeff);
+            eval_4_isog(phiR, coeff);
+#endif
+        } else {
+            get_3_isog(R, A24, C24, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+            eval_3_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+            eval_3_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
+            for (i = 0; i < npts; i++) {
+                eval_3_isog(pts[i], coeff);
+            }
+            eval_3_isog(phiP, coeff);
+            eval_3_isog(phiQ, coeff);
+            eval_3_isog(phiR, coeff);
+#endif
+        }
+        fp2copy(pts[npts-1]->X, R->X);
+        fp2copy(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    cycles2 = cpucycles();
+
+    return cycles2-cycles1;
+}
+
+
+static void print_table(FILE* f, const char* name, const unsigned int* strat, const unsigned int len)
+{
+    unsigned int i;
+
+    fprintf(f, "const unsigned int %s = { \n", name);
+    for (i = 0; i < len; i++) {
+        fprintf(f, "%u%s", strat[i], (i == len-1) ? " };\n" : ((i % 46 == 45) ? ", \n" : ", "));
+    }
+}
+
+
+static void tune(const unsigned int AliceOrBob)
+{ // Measures the step and evaluation costs, computes the optimal strategy and compares it with the shipped one
+    const unsigned int* shipped = (AliceOrBob == ALICE) ? strat_Alice : strat_Bob;
+    unsigned int* tuned = (AliceOrBob == ALICE) ? tuned_Alice : tuned_Bob;
+    unsigned int n = (AliceOrBob == ALICE) ? MAX_Alice : MAX_Bob;
+    unsigned int npoints = (AliceOrBob == ALICE) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB;
+    unsigned int i, len;
+    unsigned long long step, eval, cycles_shipped = 0, cycles_tuned = 0;
+#if defined(_PARALLEL_ISOGENY_) || defined(_AVX2_ISOGENY_)
+    unsigned int r, candidate[MAX_LEAVES-1];
+    unsigned long long cycles, best = (unsigned long long)-1;
+#endif
+#if defined(_PARALLEL_ISOGENY_)
+    unsigned int ways = pool.nthreads;
+#elif defined(_AVX2_ISOGENY_)
+    unsigned int ways = __builtin_cpu_supports("avx2") ? AVX2_LANES : 1;
+#endif
+
+    measure_costs(AliceOrBob, &step, &eval);
+#if defined(_PARALLEL_ISOGENY_) || defined(_AVX2_ISOGENY_)
+    // The evaluations of a row are distributed over the pool or the vector lanes, so optimal strategies are computed with
+    // the evaluation cost weighted by r/ways, r = 1,...,ways, and the one with the fastest traversal is kept
+    for (r = 1; r <= ways; r++) {
+        optimal_strategy(n, npoints, step, eval*r/ways, candidate);
+        cycles = 0;
+        for (i = 0; i < BENCH_LOOPS/10+1; i++) {
+            cycles += traverse(AliceOrBob, candidate);
+        }
+        if (cycles < best) {
+            best = cycles;
+            memcpy(tuned, candidate, (n-1)*sizeof(unsigned int));
+        }
+    }
+#else
+    optimal_strategy(n, npoints, step, eval, tuned);
+#endif
+
+    for (i = 0; i < BENCH_LOOPS; i++) {
+        cycles_shipped += traverse(AliceOrBob, shipped);
+        cycles_tuned += traverse(AliceOrBob, tuned);
+    }
+
+    printf("  %s step down the tree runs in ............................ %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ", step); print_unit;
+    printf("\n");
+    printf("  %s isogeny evaluation runs in ............................ %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ", eval); print_unit;
+    printf("\n");
+    printf("  %s tree, model cost (shipped/tuned) .......... %10lld / %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ",
+           strategy_cost(shipped, n, step, eval, &len), strategy_cost(tuned, n, step, eval, &len)); print_unit;
+    printf("\n");
+    printf("  %s tree traversal runs in (shipped/tuned) .... %10lld / %10lld ", (AliceOrBob == ALICE) ? "Alice's" : "Bob's  ",
+           cycles_shipped/BENCH_LOOPS, cycles_tuned/BENCH_LOOPS); print_unit;
+    printf("\n\n");
+}
+
+
+int main(int argc, char* argv[])
+{
+    FILE* f;
+
+    printf("\n\nTUNING ISOGENY TREE STRATEGIES FOR %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+#if defined(_PARALLEL_ISOGENY_)
+    pthread_once(&pool.once, pool_init);
+    printf("  Isogeny evaluations distributed over %u threads\n\n", pool.nthreads);
+#elif defined(_AVX2_ISOGENY_)
+    printf("  Isogeny evaluations in groups of up to %u points in AVX2 lanes\n\n", __builtin_cpu_supports("avx2") ? AVX2_LANES : 1);
+#endif
+
+    tune(ALICE);
+    tune(BOB);
+#ifdef COMPRESS
+    // Bob's compressed public keys depend on the projective representatives left by the traversal of his tree,
+    // so his shipped strategy is kept to reproduce the known answers
+    memcpy(tuned_Bob, strat_Bob, sizeof(tuned_Bob));
+    printf("  Bob's shipped strategy is kept, since his compressed public keys depend on it\n\n");
+#endif
+
+    if (argc < 2) return PASSED;
+
+    f = fopen(argv[1], "w");
+    if (f == NULL) {
+        printf("  Cannot write %s\n\n", argv[1]);
+        return FAILED;
+    }
+    fprintf(f, "// Strategies for the isogeny tree computations of %s, tuned on the build host with \"make strategy\"\n", SCHEME_NAME);
+    print_table(f, "strat_Alice[MAX_Alice-1]", tuned_Alice, MAX_Alice-1);
+    fprintf(f, "\n");
+    print_table(f, "strat_Bob[MAX_Bob-1]", tuned_Bob, MAX_Bob-1);
+    fclose(f);
+    printf("  Tuned strategies written to %s\n\n", argv[1]);
+
+    return PASSED;
+}
@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals of SIKEp751
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P751/P751.c"
+
+
+#define SCHEME_NAME       "SIKEp751"
+#define fp2random_test    fp2random751_test
+
+
+#include "strategy.c"
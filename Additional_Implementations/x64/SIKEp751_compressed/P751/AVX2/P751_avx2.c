@@ -0,0 +1,51 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: isogeny evaluations in the lanes of AVX2 vectors for P751
+*           This file is compiled once with VEC_LANES = 2 and once with VEC_LANES = 4
+*********************************************************************************************/
+
+#include "../P751_internal.h"
+#include "../../internal.h"
+
+
+#define NLIMBS_28         28      // Number of limbs in radix 2^28, 28*28 >= 768 = 64*NWORDS_FIELD
+#define ZERO_LIMBS_28     13      // Number of "0" limbs in the least significant part of p751 + 1 in radix 2^28
+
+// p751, 2*p751, 4*p751 and p751 + 1 in radix 2^28
+static const uint64_t p_28[4][NLIMBS_28] = {
+    {
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xA8EEAFF, 0x549F878, 0xE3EC968, 0x3F7CC76, 0x959B1A1,
+      0xBE876DA, 0x9867D6E, 0x748084E, 0x045CB25, 0x68562B5, 0x97BADC6,
+      0xE12909F, 0x41F71C0, 0x06FE5D5, 0x0000000 },
+    {
+      0xFFFFFFE, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0x51DD5FF, 0xA93F0F1, 0xC7D92D0, 0x7EF98ED, 0x2B36342,
+      0x7D0EDB5, 0x30CFADD, 0xE90109D, 0x08B964A, 0xD0AC56A, 0x2F75B8C,
+      0xC25213F, 0x83EE381, 0x0DFCBAA, 0x0000000 },
+    {
+      0xFFFFFFC, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF, 0xFFFFFFF,
+      0xFFFFFFF, 0xA3BABFF, 0x527E1E2, 0x8FB25A1, 0xFDF31DB, 0x566C684,
+      0xFA1DB6A, 0x619F5BA, 0xD20213A, 0x1172C95, 0xA158AD4, 0x5EEB719,
+      0x84A427E, 0x07DC703, 0x1BF9755, 0x0000000 },
+    {
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+      0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000, 0x0000000,
+      0x0000000, 0xA8EEB00, 0x549F878, 0xE3EC968, 0x3F7CC76, 0x959B1A1,
+      0xBE876DA, 0x9867D6E, 0x748084E, 0x045CB25, 0x68562B5, 0x97BADC6,
+      0xE12909F, 0x41F71C0, 0x06FE5D5, 0x0000000 } };
+
+
+#if (VEC_LANES == 4)
+    #define eval_4_isog_vec           eval_4_isog751_x4
+    #define eval_3_isog_vec           eval_3_isog751_x4
+#elif (VEC_LANES == 2)
+    #define eval_4_isog_vec           eval_4_isog751_x2
+    #define eval_3_isog_vec           eval_3_isog751_x2
+#endif
+
+#include "../../ec_isogeny_avx2.c"
@@ -8,6 +8,9 @@
 #define COMPRESS
 #include "P751_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -154,6 +157,9 @@ const uint64_t threeinv[NWORDS64_FIELD] = {0x555555555556188F, 0x555555555555555
                                            0x42DF3D3B8EC96F64, 0x198C3C1346027872, 0xB0528624270642A3, 0xF1E61944CA0};
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P751_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
 80, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 
 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 
@@ -173,6 +179,7 @@ const unsigned int strat_Bob[MAX_Bob-1] = {
 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 
 1, 1, 1, 21, 12, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 5, 3, 2, 1, 1, 1, 1, 
 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
+#endif
 
 // Fixed traversal strategies for Pohlig-Hellman discrete logs
 const unsigned int ph2_path[PLEN_2] = {
@@ -365,6 +372,7 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fpinv_mont                    fpinv751_mont
 #define fpinv_chain_mont              fpinv751_chain_mont
 #define fpinv_mont_bingcd             fpinv751_mont_bingcd
+#define fpinv_mont_safegcd            fpinv751_mont_safegcd
 #define fp2copy                       fp2copy751
 #define fp2zero                       fp2zero751
 #define fp2add                        fp2add751
@@ -380,9 +388,19 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2inv_mont                   fp2inv751_mont
 #define fp2inv_mont_bingcd            fp2inv751_mont_bingcd
 #define fpequal_non_constant_time     fpequal751_non_constant_time
+#define eval_4_isog_x4                eval_4_isog751_x4
+#define eval_3_isog_x4                eval_3_isog751_x4
+#define eval_4_isog_x2                eval_4_isog751_x2
+#define eval_3_isog_x2                eval_3_isog751_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add751_asm
 #define mp_subaddx2_asm               mp_subadd751x2_asm
 #define mp_dblsubx2_asm               mp_dblsub751x2_asm
+#endif
 
 
 
@@ -0,0 +1,558 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: portable modular arithmetic for P751
+*********************************************************************************************/
+
+#include "../P751_internal.h"
+#include "../../internal.h"
+
+
+// Global constants
+extern const uint64_t p751[NWORDS64_FIELD];
+extern const uint64_t p751p1[NWORDS64_FIELD]; 
+extern const uint64_t p751x2[NWORDS64_FIELD];   
+extern const uint64_t p751x4[NWORDS64_FIELD];
+
+
+__inline void mp_sub751_p2(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision subtraction with correction with 2*p, c = a-b+2p.
+    unsigned int i, borrow = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], b[i], borrow, c[i]); 
+    }
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, c[i], ((digit_t*)p751x2)[i], borrow, c[i]); 
+    }
+} 
+
+
+__inline void mp_sub751_p4(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Multiprecision subtraction with correction with 4*p, c = a-b+4p.
+    unsigned int i, borrow = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], b[i], borrow, c[i]); 
+    }
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, c[i], ((digit_t*)p751x4)[i], borrow, c[i]); 
+    }
+}   
+
+
+__inline void fpadd751(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Modular addition, c = a+b mod p751.
+  // Inputs: a, b in [0, 2*p751-1] 
+  // Output: c in [0, 2*p751-1] 
+    unsigned int i, carry = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, a[i], b[i], carry, c[i]); 
+    }
+
+    carry = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(carry, c[i], ((digit_t*)p751x2)[i], carry, c[i]); 
+    }
+    mask = 0 - (digit_t)carry;
+
+    carry = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, c[i], ((digit_t*)p751x2)[i] & mask, carry, c[i]); 
+    }
+} 
+
+
+__inline void fpsub751(const digit_t* a, const digit_t* b, digit_t* c)
+{ // Modular subtraction, c = a-b mod p751.
+  // Inputs: a, b in [0, 2*p751-1] 
+  // Output: c in [0, 2*p751-1] 
+    unsigned int i, borrow = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], b[i], borrow, c[i]); 
+    }
+    mask = 0 - (digit_t)borrow;
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, c[i], ((digit_t*)p751x2)[i] & mask, borrow, c[i]); 
+    }
+}
+
+
+__inline void fpneg751(digit_t* a)
+{ // Modular negation, a = -a mod p751.
+  // Input/output: a in [0, 2*p751-1] 
+    unsigned int i, borrow = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, ((digit_t*)p751x2)[i], a[i], borrow, a[i]); 
+    }
+}
+
+
+void fpdiv2_751(const digit_t* a, digit_t* c)
+{ // Modular division by two, c = a/2 mod p751.
+  // Input : a in [0, 2*p751-1] 
+  // Output: c in [0, 2*p751-1] 
+    unsigned int i, carry = 0;
+    digit_t mask;
+        
+    mask = 0 - (digit_t)(a[0] & 1);    // If a is odd compute a+p751
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(carry, a[i], ((digit_t*)p751)[i] & mask, carry, c[i]); 
+    }
+
+    mp_shiftr1(c, NWORDS_FIELD);
+} 
+
+
+void fpcorrection751(digit_t* a)
+{ // Modular correction to reduce field element a in [0, 2*p751-1] to [0, p751-1].
+    unsigned int i, borrow = 0;
+    digit_t mask;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        SUBC(borrow, a[i], ((digit_t*)p751)[i], borrow, a[i]); 
+    }
+    mask = 0 - (digit_t)borrow;
+
+    borrow = 0;
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        ADDC(borrow, a[i], ((digit_t*)p751)[i] & mask, borrow, a[i]); 
+    }
+}
+
+
+void digit_x_digit(const digit_t a, const digit_t b, digit_t* c)
+{ // Digit multiplication, digit * digit -> 2-digit result    
+    register digit_t al, ah, bl, bh, temp;
+    digit_t albl, albh, ahbl, ahbh, res1, res2, res3, carry;
+    digit_t mask_low = (digit_t)(-1) >> (sizeof(digit_t)*4), mask_high = (digit_t)(-1) << (sizeof(digit_t)*4);
+
+    al = a & mask_low;                        // Low part
+    ah = a >> (sizeof(digit_t) * 4);          // High part
+    bl = b & mask_low;
+    bh = b >> (sizeof(digit_t) * 4);
+
+    albl = al*bl;
+    albh = al*bh;
+    ahbl = ah*bl;
+    ahbh = ah*bh;
+    c[0] = albl & mask_low;                   // C00
+
+    res1 = albl >> (sizeof(digit_t) * 4);
+    res2 = ahbl & mask_low;
+    res3 = albh & mask_low;  
+    temp = res1 + res2 + res3;
+    carry = temp >> (sizeof(digit_t) * 4);
+    c[0] ^= temp << (sizeof(digit_t) * 4);    // C01   
+
+    res1 = ahbl >> (sizeof(digit_t) * 4);
+    res2 = albh >> (sizeof(digit_t) * 4);
+    res3 = ahbh & mask_low;
+    temp = res1 + res2 + res3 + carry;
+    c[1] = temp & mask_low;                   // C10 
+    carry = temp & mask_high; 
+    c[1] ^= (ahbh & mask_high) + carry;       // C11
+}
+
+
+#if defined(GENERIC_INT128) && defined(_UNSATURATED_)
+
+// Unsaturated arithmetic: mp_mul and rdc_mont split their operands in limbs of 58 bits, so that the products
+// of a column are accumulated in 128 bits and the carries are propagated once per column
+#define LIMB_BITS           58
+#define LIMB_MASK           (((digit_t)1 << LIMB_BITS) - 1)
+#define MULADD(x, y)        acc += (uint128_t)(x) * (y)
+#define COLUMN(c)           (c) = (digit_t)acc & LIMB_MASK; acc >>= LIMB_BITS
+
+// p751+1 in radix 2^58, the six least significant limbs are zero
+static const digit_t p751p1_unsat[13] = {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+    0x0000000000000000, 0x0000000000000000, 0x03878A8EEB000000, 0x0331DB8FB25A1527,
+    0x0076DA959B1A13F7, 0x020213A619F5BAFA, 0x00562B5045CB2574, 0x004A427E5EEB719A,
+    0x006FE5D541F71C0E };
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision product scanning multiply in radix 2^58, c = a*b, where lng(a) = lng(b) = nwords = NWORDS_FIELD.
+  // Inputs: a, b in [0, 8*p751-1]
+    digit_t la[13], lb[13], lc[26];
+    uint128_t acc = 0;
+
+    la[0] = a[0] & LIMB_MASK;
+    la[1] = ((a[0] >> 58) | (a[1] << 6)) & LIMB_MASK;
+    la[2] = ((a[1] >> 52) | (a[2] << 12)) & LIMB_MASK;
+    la[3] = ((a[2] >> 46) | (a[3] << 18)) & LIMB_MASK;
+    la[4] = ((a[3] >> 40) | (a[4] << 24)) & LIMB_MASK;
+    la[5] = ((a[4] >> 34) | (a[5] << 30)) & LIMB_MASK;
+    la[6] = ((a[5] >> 28) | (a[6] << 36)) & LIMB_MASK;
+    la[7] = ((a[6] >> 22) | (a[7] << 42)) & LIMB_MASK;
+    la[8] = ((a[7] >> 16) | (a[8] << 48)) & LIMB_MASK;
+    la[9] = ((a[8] >> 10) | (a[9] << 54)) & LIMB_MASK;
+    la[10] = a[9] >> 4 & LIMB_MASK;
+    la[11] = ((a[9] >> 62) | (a[10] << 2)) & LIMB_MASK;
+    la[12] = (a[10] >> 56) | (a[11] << 8);
+    lb[0] = b[0] & LIMB_MASK;
+    lb[1] = ((b[0] >> 58) | (b[1] << 6)) & LIMB_MASK;
+    lb[2] = ((b[1] >> 52) | (b[2] << 12)) & LIMB_MASK;
+    lb[3] = ((b[2] >> 46) | (b[3] << 18)) & LIMB_MASK;
+    lb[4] = ((b[3] >> 40) | (b[4] << 24)) & LIMB_MASK;
+    lb[5] = ((b[4] >> 34) | (b[5] << 30)) & LIMB_MASK;
+    lb[6] = ((b[5] >> 28) | (b[6] << 36)) & LIMB_MASK;
+    lb[7] = ((b[6] >> 22) | (b[7] << 42)) & LIMB_MASK;
+    lb[8] = ((b[7] >> 16) | (b[8] << 48)) & LIMB_MASK;
+    lb[9] = ((b[8] >> 10) | (b[9] << 54)) & LIMB_MASK;
+    lb[10] = b[9] >> 4 & LIMB_MASK;
+    lb[11] = ((b[9] >> 62) | (b[10] << 2)) & LIMB_MASK;
+    lb[12] = (b[10] >> 56) | (b[11] << 8);
+
+    MULADD(la[0], lb[0]); COLUMN(lc[0]);
+    MULADD(la[0], lb[1]); MULADD(la[1], lb[0]); COLUMN(lc[1]);
+    MULADD(la[0], lb[2]); MULADD(la[1], lb[1]); MULADD(la[2], lb[0]); COLUMN(lc[2]);
+    MULADD(la[0], lb[3]); MULADD(la[1], lb[2]); MULADD(la[2], lb[1]); MULADD(la[3], lb[0]);
+    COLUMN(lc[3]);
+    MULADD(la[0], lb[4]); MULADD(la[1], lb[3]); MULADD(la[2], lb[2]); MULADD(la[3], lb[1]);
+    MULADD(la[4], lb[0]); COLUMN(lc[4]);
+    MULADD(la[0], lb[5]); MULADD(la[1], lb[4]); MULADD(la[2], lb[3]); MULADD(la[3], lb[2]);
+    MULADD(la[4], lb[1]); MULADD(la[5], lb[0]); COLUMN(lc[5]);
+    MULADD(la[0], lb[6]); MULADD(la[1], lb[5]); MULADD(la[2], lb[4]); MULADD(la[3], lb[3]);
+    MULADD(la[4], lb[2]); MULADD(la[5], lb[1]); MULADD(la[6], lb[0]); COLUMN(lc[6]);
+    MULADD(la[0], lb[7]); MULADD(la[1], lb[6]); MULADD(la[2], lb[5]); MULADD(la[3], lb[4]);
+    MULADD(la[4], lb[3]); MULADD(la[5], lb[2]); MULADD(la[6], lb[1]); MULADD(la[7], lb[0]);
+    COLUMN(lc[7]);
+    MULADD(la[0], lb[8]); MULADD(la[1], lb[7]); MULADD(la[2], lb[6]); MULADD(la[3], lb[5]);
+    MULADD(la[4], lb[4]); MULADD(la[5], lb[3]); MULADD(la[6], lb[2]); MULADD(la[7], lb[1]);
+    MULADD(la[8], lb[0]); COLUMN(lc[8]);
+    MULADD(la[0], lb[9]); MULADD(la[1], lb[8]); MULADD(la[2], lb[7]); MULADD(la[3], lb[6]);
+    MULADD(la[4], lb[5]); MULADD(la[5], lb[4]); MULADD(la[6], lb[3]); MULADD(la[7], lb[2]);
+    MULADD(la[8], lb[1]); MULADD(la[9], lb[0]); COLUMN(lc[9]);
+    MULADD(la[0], lb[10]); MULADD(la[1], lb[9]); MULADD(la[2], lb[8]); MULADD(la[3], lb[7]);
+    MULADD(la[4], lb[6]); MULADD(la[5], lb[5]); MULADD(la[6], lb[4]); MULADD(la[7], lb[3]);
+    MULADD(la[8], lb[2]); MULADD(la[9], lb[1]); MULADD(la[10], lb[0]); COLUMN(lc[10]);
+    MULADD(la[0], lb[11]); MULADD(la[1], lb[10]); MULADD(la[2], lb[9]); MULADD(la[3], lb[8]);
+    MULADD(la[4], lb[7]); MULADD(la[5], lb[6]); MULADD(la[6], lb[5]); MULADD(la[7], lb[4]);
+    MULADD(la[8], lb[3]); MULADD(la[9], lb[2]); MULADD(la[10], lb[1]); MULADD(la[11], lb[0]);
+    COLUMN(lc[11]);
+    MULADD(la[0], lb[12]); MULADD(la[1], lb[11]); MULADD(la[2], lb[10]); MULADD(la[3], lb[9]);
+    MULADD(la[4], lb[8]); MULADD(la[5], lb[7]); MULADD(la[6], lb[6]); MULADD(la[7], lb[5]);
+    MULADD(la[8], lb[4]); MULADD(la[9], lb[3]); MULADD(la[10], lb[2]); MULADD(la[11], lb[1]);
+    MULADD(la[12], lb[0]); COLUMN(lc[12]);
+    MULADD(la[1], lb[12]); MULADD(la[2], lb[11]); MULADD(la[3], lb[10]); MULADD(la[4], lb[9]);
+    MULADD(la[5], lb[8]); MULADD(la[6], lb[7]); MULADD(la[7], lb[6]); MULADD(la[8], lb[5]);
+    MULADD(la[9], lb[4]); MULADD(la[10], lb[3]); MULADD(la[11], lb[2]); MULADD(la[12], lb[1]);
+    COLUMN(lc[13]);
+    MULADD(la[2], lb[12]); MULADD(la[3], lb[11]); MULADD(la[4], lb[10]); MULADD(la[5], lb[9]);
+    MULADD(la[6], lb[8]); MULADD(la[7], lb[7]); MULADD(la[8], lb[6]); MULADD(la[9], lb[5]);
+    MULADD(la[10], lb[4]); MULADD(la[11], lb[3]); MULADD(la[12], lb[2]); COLUMN(lc[14]);
+    MULADD(la[3], lb[12]); MULADD(la[4], lb[11]); MULADD(la[5], lb[10]); MULADD(la[6], lb[9]);
+    MULADD(la[7], lb[8]); MULADD(la[8], lb[7]); MULADD(la[9], lb[6]); MULADD(la[10], lb[5]);
+    MULADD(la[11], lb[4]); MULADD(la[12], lb[3]); COLUMN(lc[15]);
+    MULADD(la[4], lb[12]); MULADD(la[5], lb[11]); MULADD(la[6], lb[10]); MULADD(la[7], lb[9]);
+    MULADD(la[8], lb[8]); MULADD(la[9], lb[7]); MULADD(la[10], lb[6]); MULADD(la[11], lb[5]);
+    MULADD(la[12], lb[4]); COLUMN(lc[16]);
+    MULADD(la[5], lb[12]); MULADD(la[6], lb[11]); MULADD(la[7], lb[10]); MULADD(la[8], lb[9]);
+    MULADD(la[9], lb[8]); MULADD(la[10], lb[7]); MULADD(la[11], lb[6]); MULADD(la[12], lb[5]);
+    COLUMN(lc[17]);
+    MULADD(la[6], lb[12]); MULADD(la[7], lb[11]); MULADD(la[8], lb[10]); MULADD(la[9], lb[9]);
+    MULADD(la[10], lb[8]); MULADD(la[11], lb[7]); MULADD(la[12], lb[6]); COLUMN(lc[18]);
+    MULADD(la[7], lb[12]); MULADD(la[8], lb[11]); MULADD(la[9], lb[10]); MULADD(la[10], lb[9]);
+    MULADD(la[11], lb[8]); MULADD(la[12], lb[7]); COLUMN(lc[19]);
+    MULADD(la[8], lb[12]); MULADD(la[9], lb[11]); MULADD(la[10], lb[10]); MULADD(la[11], lb[9]);
+    MULADD(la[12], lb[8]); COLUMN(lc[20]);
+    MULADD(la[9], lb[12]); MULADD(la[10], lb[11]); MULADD(la[11], lb[10]); MULADD(la[12], lb[9]);
+    COLUMN(lc[21]);
+    MULADD(la[10], lb[12]); MULADD(la[11], lb[11]); MULADD(la[12], lb[10]); COLUMN(lc[22]);
+    MULADD(la[11], lb[12]); MULADD(la[12], lb[11]); COLUMN(lc[23]);
+    MULADD(la[12], lb[12]); COLUMN(lc[24]);
+    lc[25] = (digit_t)acc;
+
+    c[0] = lc[0] | (lc[1] << 58);
+    c[1] = (lc[1] >> 6) | (lc[2] << 52);
+    c[2] = (lc[2] >> 12) | (lc[3] << 46);
+    c[3] = (lc[3] >> 18) | (lc[4] << 40);
+    c[4] = (lc[4] >> 24) | (lc[5] << 34);
+    c[5] = (lc[5] >> 30) | (lc[6] << 28);
+    c[6] = (lc[6] >> 36) | (lc[7] << 22);
+    c[7] = (lc[7] >> 42) | (lc[8] << 16);
+    c[8] = (lc[8] >> 48) | (lc[9] << 10);
+    c[9] = (lc[9] >> 54) | (lc[10] << 4) | (lc[11] << 62);
+    c[10] = (lc[11] >> 2) | (lc[12] << 56);
+    c[11] = (lc[12] >> 8) | (lc[13] << 50);
+    c[12] = (lc[13] >> 14) | (lc[14] << 44);
+    c[13] = (lc[14] >> 20) | (lc[15] << 38);
+    c[14] = (lc[15] >> 26) | (lc[16] << 32);
+    c[15] = (lc[16] >> 32) | (lc[17] << 26);
+    c[16] = (lc[17] >> 38) | (lc[18] << 20);
+    c[17] = (lc[18] >> 44) | (lc[19] << 14);
+    c[18] = (lc[19] >> 50) | (lc[20] << 8);
+    c[19] = (lc[20] >> 56) | (lc[21] << 2) | (lc[22] << 60);
+    c[20] = (lc[22] >> 4) | (lc[23] << 54);
+    c[21] = (lc[23] >> 10) | (lc[24] << 48);
+    c[22] = (lc[24] >> 16) | (lc[25] << 42);
+    c[23] = lc[25] >> 22;
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction in radix 2^58 exploiting the special form of the prime p751.
+  // mc = ma*R^-1 mod p751x2, where R = 2^768.
+  // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
+  // ma is assumed to be in Montgomery representation.
+  // Since p751 = -1 mod 2^58, adding q*p751 with q = t mod 2^58 drops the low limb of t and adds q*(p751+1).
+  // R = 2^768 is reached with 13 steps of 58 bits and a last step of 14 bits.
+    digit_t t[27], q[14];
+    uint128_t acc = 0;
+
+    t[0] = ma[0] & LIMB_MASK;
+    t[1] = ((ma[0] >> 58) | (ma[1] << 6)) & LIMB_MASK;
+    t[2] = ((ma[1] >> 52) | (ma[2] << 12)) & LIMB_MASK;
+    t[3] = ((ma[2] >> 46) | (ma[3] << 18)) & LIMB_MASK;
+    t[4] = ((ma[3] >> 40) | (ma[4] << 24)) & LIMB_MASK;
+    t[5] = ((ma[4] >> 34) | (ma[5] << 30)) & LIMB_MASK;
+    t[6] = ((ma[5] >> 28) | (ma[6] << 36)) & LIMB_MASK;
+    t[7] = ((ma[6] >> 22) | (ma[7] << 42)) & LIMB_MASK;
+    t[8] = ((ma[7] >> 16) | (ma[8] << 48)) & LIMB_MASK;
+    t[9] = ((ma[8] >> 10) | (ma[9] << 54)) & LIMB_MASK;
+    t[10] = ma[9] >> 4 & LIMB_MASK;
+    t[11] = ((ma[9] >> 62) | (ma[10] << 2)) & LIMB_MASK;
+    t[12] = ((ma[10] >> 56) | (ma[11] << 8)) & LIMB_MASK;
+    t[13] = ((ma[11] >> 50) | (ma[12] << 14)) & LIMB_MASK;
+    t[14] = ((ma[12] >> 44) | (ma[13] << 20)) & LIMB_MASK;
+    t[15] = ((ma[13] >> 38) | (ma[14] << 26)) & LIMB_MASK;
+    t[16] = ((ma[14] >> 32) | (ma[15] << 32)) & LIMB_MASK;
+    t[17] = ((ma[15] >> 26) | (ma[16] << 38)) & LIMB_MASK;
+    t[18] = ((ma[16] >> 20) | (ma[17] << 44)) & LIMB_MASK;
+    t[19] = ((ma[17] >> 14) | (ma[18] << 50)) & LIMB_MASK;
+    t[20] = ((ma[18] >> 8) | (ma[19] << 56)) & LIMB_MASK;
+    t[21] = ma[19] >> 2 & LIMB_MASK;
+    t[22] = ((ma[19] >> 60) | (ma[20] << 4)) & LIMB_MASK;
+    t[23] = ((ma[20] >> 54) | (ma[21] << 10)) & LIMB_MASK;
+    t[24] = ((ma[21] >> 48) | (ma[22] << 16)) & LIMB_MASK;
+    t[25] = ((ma[22] >> 42) | (ma[23] << 22)) & LIMB_MASK;
+    t[26] = ma[23] >> 36;
+
+    acc += t[0]; COLUMN(q[0]);
+    acc += t[1]; COLUMN(q[1]);
+    acc += t[2]; COLUMN(q[2]);
+    acc += t[3]; COLUMN(q[3]);
+    acc += t[4]; COLUMN(q[4]);
+    acc += t[5]; COLUMN(q[5]);
+    acc += t[6]; MULADD(q[0], p751p1_unsat[6]); COLUMN(q[6]);
+    acc += t[7]; MULADD(q[1], p751p1_unsat[6]); MULADD(q[0], p751p1_unsat[7]); COLUMN(q[7]);
+    acc += t[8]; MULADD(q[2], p751p1_unsat[6]); MULADD(q[1], p751p1_unsat[7]); MULADD(q[0], p751p1_unsat[8]);
+    COLUMN(q[8]);
+    acc += t[9]; MULADD(q[3], p751p1_unsat[6]); MULADD(q[2], p751p1_unsat[7]); MULADD(q[1], p751p1_unsat[8]);
+    MULADD(q[0], p751p1_unsat[9]); COLUMN(q[9]);
+    acc += t[10]; MULADD(q[4], p751p1_unsat[6]); MULADD(q[3], p751p1_unsat[7]); MULADD(q[2], p751p1_unsat[8]);
+    MULADD(q[1], p751p1_unsat[9]); MULADD(q[0], p751p1_unsat[10]); COLUMN(q[10]);
+    acc += t[11]; MULADD(q[5], p751p1_unsat[6]); MULADD(q[4], p751p1_unsat[7]); MULADD(q[3], p751p1_unsat[8]);
+    MULADD(q[2], p751p1_unsat[9]); MULADD(q[1], p751p1_unsat[10]); MULADD(q[0], p751p1_unsat[11]); COLUMN(q[11]);
+    acc += t[12]; MULADD(q[6], p751p1_unsat[6]); MULADD(q[5], p751p1_unsat[7]); MULADD(q[4], p751p1_unsat[8]);
+    MULADD(q[3], p751p1_unsat[9]); MULADD(q[2], p751p1_unsat[10]); MULADD(q[1], p751p1_unsat[11]); MULADD(q[0], p751p1_unsat[12]);
+    COLUMN(q[12]);
+    acc += t[13]; MULADD(q[7], p751p1_unsat[6]); MULADD(q[6], p751p1_unsat[7]); MULADD(q[5], p751p1_unsat[8]);
+    MULADD(q[4], p751p1_unsat[9]); MULADD(q[3], p751p1_unsat[10]); MULADD(q[2], p751p1_unsat[11]); MULADD(q[1], p751p1_unsat[12]);
+    q[13] = (digit_t)acc & 0x3FFF; acc -= q[13]; COLUMN(t[0]);
+    acc += t[14]; MULADD(q[8], p751p1_unsat[6]); MULADD(q[7], p751p1_unsat[7]); MULADD(q[6], p751p1_unsat[8]);
+    MULADD(q[5], p751p1_unsat[9]); MULADD(q[4], p751p1_unsat[10]); MULADD(q[3], p751p1_unsat[11]); MULADD(q[2], p751p1_unsat[12]);
+    COLUMN(t[1]);
+    acc += t[15]; MULADD(q[9], p751p1_unsat[6]); MULADD(q[8], p751p1_unsat[7]); MULADD(q[7], p751p1_unsat[8]);
+    MULADD(q[6], p751p1_unsat[9]); MULADD(q[5], p751p1_unsat[10]); MULADD(q[4], p751p1_unsat[11]); MULADD(q[3], p751p1_unsat[12]);
+    COLUMN(t[2]);
+    acc += t[16]; MULADD(q[10], p751p1_unsat[6]); MULADD(q[9], p751p1_unsat[7]); MULADD(q[8], p751p1_unsat[8]);
+    MULADD(q[7], p751p1_unsat[9]); MULADD(q[6], p751p1_unsat[10]); MULADD(q[5], p751p1_unsat[11]); MULADD(q[4], p751p1_unsat[12]);
+    COLUMN(t[3]);
+    acc += t[17]; MULADD(q[11], p751p1_unsat[6]); MULADD(q[10], p751p1_unsat[7]); MULADD(q[9], p751p1_unsat[8]);
+    MULADD(q[8], p751p1_unsat[9]); MULADD(q[7], p751p1_unsat[10]); MULADD(q[6], p751p1_unsat[11]); MULADD(q[5], p751p1_unsat[12]);
+    COLUMN(t[4]);
+    acc += t[18]; MULADD(q[12], p751p1_unsat[6]); MULADD(q[11], p751p1_unsat[7]); MULADD(q[10], p751p1_unsat[8]);
+    MULADD(q[9], p751p1_unsat[9]); MULADD(q[8], p751p1_unsat[10]); MULADD(q[7], p751p1_unsat[11]); MULADD(q[6], p751p1_unsat[12]);
+    COLUMN(t[5]);
+    acc += t[19]; MULADD(q[13], p751p1_unsat[6]); MULADD(q[12], p751p1_unsat[7]); MULADD(q[11], p751p1_unsat[8]);
+    MULADD(q[10], p751p1_unsat[9]); MULADD(q[9], p751p1_unsat[10]); MULADD(q[8], p751p1_unsat[11]); MULADD(q[7], p751p1_unsat[12]);
+    COLUMN(t[6]);
+    acc += t[20]; MULADD(q[13], p751p1_unsat[7]); MULADD(q[12], p751p1_unsat[8]); MULADD(q[11], p751p1_unsat[9]);
+    MULADD(q[10], p751p1_unsat[10]); MULADD(q[9], p751p1_unsat[11]); MULADD(q[8], p751p1_unsat[12]);
+    COLUMN(t[7]);
+    acc += t[21]; MULADD(q[13], p751p1_unsat[8]); MULADD(q[12], p751p1_unsat[9]); MULADD(q[11], p751p1_unsat[10]);
+    MULADD(q[10], p751p1_unsat[11]); MULADD(q[9], p751p1_unsat[12]); COLUMN(t[8]);
+    acc += t[22]; MULADD(q[13], p751p1_unsat[9]); MULADD(q[12], p751p1_unsat[10]); MULADD(q[11], p751p1_unsat[11]);
+    MULADD(q[10], p751p1_unsat[12]); COLUMN(t[9]);
+    acc += t[23]; MULADD(q[13], p751p1_unsat[10]); MULADD(q[12], p751p1_unsat[11]); MULADD(q[11], p751p1_unsat[12]);
+    COLUMN(t[10]);
+    acc += t[24]; MULADD(q[13], p751p1_unsat[11]); MULADD(q[12], p751p1_unsat[12]); COLUMN(t[11]);
+    acc += t[25]; MULADD(q[13], p751p1_unsat[12]); COLUMN(t[12]);
+    acc += t[26]; t[13] = (digit_t)acc;
+
+    mc[0] = (t[0] >> 14) | (t[1] << 44);
+    mc[1] = (t[1] >> 20) | (t[2] << 38);
+    mc[2] = (t[2] >> 26) | (t[3] << 32);
+    mc[3] = (t[3] >> 32) | (t[4] << 26);
+    mc[4] = (t[4] >> 38) | (t[5] << 20);
+    mc[5] = (t[5] >> 44) | (t[6] << 14);
+    mc[6] = (t[6] >> 50) | (t[7] << 8);
+    mc[7] = (t[7] >> 56) | (t[8] << 2) | (t[9] << 60);
+    mc[8] = (t[9] >> 4) | (t[10] << 54);
+    mc[9] = (t[10] >> 10) | (t[11] << 48);
+    mc[10] = (t[11] >> 16) | (t[12] << 42);
+    mc[11] = (t[12] >> 22) | (t[13] << 36);
+}
+
+#elif defined(GENERIC_INT128)
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision schoolbook multiply using 128-bit integers, c = a*b, where lng(a) = lng(b) = nwords.
+    unsigned int i, j;
+    digit_t carry;
+    uint128_t uv;
+
+    for (i = 0; i < nwords; i++) {
+        c[i] = 0;
+    }
+
+    for (i = 0; i < nwords; i++) {
+        carry = 0;
+        for (j = 0; j < nwords; j++) {
+            uv = (uint128_t)a[j] * b[i] + c[i+j] + carry;
+            c[i+j] = (digit_t)uv;
+            carry = (digit_t)(uv >> RADIX);
+        }
+        c[i+nwords] = carry;
+    }
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction using 128-bit integers and exploiting the special form of the prime p751.
+  // mc = ma*R^-1 mod p751x2, where R = 2^768.
+  // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
+  // ma is assumed to be in Montgomery representation.
+    unsigned int i, j;
+    digit_t t[2*NWORDS_FIELD], q, carry, carry2 = 0;
+    uint128_t uv;
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        t[i] = ma[i];
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        // Since p751 = -1 mod 2^RADIX, adding q*p751 with q = t[i] is the same as dropping t[i] and adding q*(p751+1)
+        q = t[i];
+        carry = 0;
+        for (j = p751_ZERO_WORDS; j < NWORDS_FIELD; j++) {
+            uv = (uint128_t)q * ((digit_t*)p751p1)[j] + t[i+j] + carry;
+            t[i+j] = (digit_t)uv;
+            carry = (digit_t)(uv >> RADIX);
+        }
+        uv = (uint128_t)t[i+NWORDS_FIELD] + carry + carry2;
+        t[i+NWORDS_FIELD] = (digit_t)uv;
+        carry2 = (digit_t)(uv >> RADIX);
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = t[i+NWORDS_FIELD];
+    }
+}
+
+#else
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.   
+    unsigned int i, j;
+    digit_t t = 0, u = 0, v = 0, UV[2];
+    unsigned int carry = 0;
+    
+    for (i = 0; i < nwords; i++) {
+        for (j = 0; j <= i; j++) {
+            MUL(a[j], b[i-j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[i] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+
+    for (i = nwords; i < 2*nwords-1; i++) {
+        for (j = i-nwords+1; j < nwords; j++) {
+            MUL(a[j], b[i-j], UV+1, UV[0]); 
+            ADDC(0, UV[0], v, carry, v); 
+            ADDC(carry, UV[1], u, carry, u); 
+            t += carry;
+        }
+        c[i] = v;
+        v = u; 
+        u = t;
+        t = 0;
+    }
+    c[2*nwords-1] = v; 
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Efficient Montgomery reduction using comba and exploiting the special form of the prime p751.
+  // mc = ma*R^-1 mod p751x2, where R = 2^768.
+  // If ma < 2^768*p751, the output mc is in the range [0, 2*p751-1].
+  // ma is assumed to be in Montgomery representation.
+    unsigned int i, j, carry, count = p751_ZERO_WORDS;
+    digit_t UV[2], t = 0, u = 0, v = 0;
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = 0;
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        for (j = 0; j < i; j++) {
+            if (j < (i-p751_ZERO_WORDS+1)) { 
+                MUL(mc[j], ((digit_t*)p751p1)[i-j], UV+1, UV[0]);
+                ADDC(0, UV[0], v, carry, v); 
+                ADDC(carry, UV[1], u, carry, u); 
+                t += carry; 
+            }
+        }
+        ADDC(0, v, ma[i], carry, v); 
+        ADDC(carry, u, 0, carry, u); 
+        t += carry; 
+        mc[i] = v;
+        v = u;
+        u = t;
+        t = 0;
+    }    
+
+    for (i = NWORDS_FIELD; i < 2*NWORDS_FIELD-1; i++) {
+        if (count > 0) {
+            count -= 1;
+        }
+        for (j = i-NWORDS_FIELD+1; j < NWORDS_FIELD; j++) {
+            if (j < (NWORDS_FIELD-count)) { 
+                MUL(mc[j], ((digit_t*)p751p1)[i-j], UV+1, UV[0]);
+                ADDC(0, UV[0], v, carry, v); 
+                ADDC(carry, UV[1], u, carry, u); 
+                t += carry;
+            }
+        }
+        ADDC(0, v, ma[i], carry, v); 
+        ADDC(carry, u, 0, carry, u); 
+        t += carry; 
+        mc[i-NWORDS_FIELD] = v;
+        v = u;
+        u = t;
+        t = 0;
+    }
+    ADDC(0, v, ma[2*NWORDS_FIELD-1], carry, v); 
+    mc[NWORDS_FIELD-1] = v;
+}
+
+#endif
\ No newline at end of file
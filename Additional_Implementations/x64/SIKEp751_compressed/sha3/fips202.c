@@ -453,4 +453,88 @@ void shake256(unsigned char *output, unsigned long long outlen, const unsigned c
     for (i = 0; i < outlen; i++)
       output[i] = t[i];
   }
-}
\ No newline at end of file
+}
+
+/********** Incremental SHAKE256 ***********/
+
+void shake256_inc_init(shake256_inc_state *state)
+{
+  size_t i;
+
+  for (i = 0; i < 25; ++i)
+    state->s[i] = 0;
+  state->pos = 0;
+}
+
+
+void shake256_inc_absorb(shake256_inc_state *state, const unsigned char *input, unsigned long long inlen)
+{ // Absorbs the input in place, whole lanes at a time once the position is aligned to a lane
+  uint64_t *s = state->s;
+  unsigned int pos = state->pos;
+
+  while (inlen > 0 && (pos & 7) != 0) 
+  {
+    s[pos >> 3] ^= (uint64_t)*input++ << (8 * (pos & 7));
+    pos++;
+    inlen--;
+  }
+  while (inlen >= 8) 
+  {
+    if (pos == SHAKE256_RATE) {
+      KeccakF1600_StatePermute(s);
+      pos = 0;
+    }
+    s[pos >> 3] ^= load64(input);
+    pos += 8;
+    input += 8;
+    inlen -= 8;
+  }
+  if (inlen > 0 && pos == SHAKE256_RATE) {
+    KeccakF1600_StatePermute(s);
+    pos = 0;
+  }
+  while (inlen > 0) 
+  {
+    s[pos >> 3] ^= (uint64_t)*input++ << (8 * (pos & 7));
+    pos++;
+    inlen--;
+  }
+  state->pos = pos;
+}
+
+
+void shake256_inc_finalize(shake256_inc_state *state)
+{ // A full block is left unpermuted by shake256_inc_absorb, so the padding always fits
+  if (state->pos == SHAKE256_RATE) {
+    KeccakF1600_StatePermute(state->s);
+    state->pos = 0;
+  }
+  state->s[state->pos >> 3] ^= (uint64_t)0x1F << (8 * (state->pos & 7));
+  state->s[(SHAKE256_RATE - 1) >> 3] ^= (uint64_t)128 << (8 * ((SHAKE256_RATE - 1) & 7));
+  state->pos = SHAKE256_RATE;
+}
+
+
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256_inc_state *state)
+{ // Can be called repeatedly, state->pos is the number of bytes already output from the current block
+  unsigned int pos = state->pos;
+
+  while (outlen > 0) 
+  {
+    if (pos == SHAKE256_RATE) {
+      KeccakF1600_StatePermute(state->s);
+      pos = 0;
+    }
+    if ((pos & 7) == 0 && outlen >= 8) {
+      store64(output, state->s[pos >> 3]);
+      pos += 8;
+      output += 8;
+      outlen -= 8;
+    } else {
+      *output++ = (unsigned char)(state->s[pos >> 3] >> (8 * (pos & 7)));
+      pos++;
+      outlen--;
+    }
+  }
+  state->pos = pos;
+}
@@ -0,0 +1,278 @@
+/********************************************************************************************
+* SHA3-derived function SHAKE256 on four inputs at once
+*
+* The four Keccak-f[1600] states are interleaved, lane i of the vector s[k] holds word k of
+* state i, so that every step of a round is a single AVX2 instruction for the four states.
+* The output is the same as four calls to shake256 in fips202.c.
+*
+*********************************************************************************************/
+
+#include <string.h>
+#include "fips202x4.h"
+
+#define NROUNDS 24
+#define ROL4(a, offset) _mm256_or_si256(_mm256_slli_epi64(a, offset), _mm256_srli_epi64(a, 64-(offset)))
+
+
+static const uint64_t KeccakF_RoundConstants[NROUNDS] =
+{
+    (uint64_t)0x0000000000000001ULL,
+    (uint64_t)0x0000000000008082ULL,
+    (uint64_t)0x800000000000808aULL,
+    (uint64_t)0x8000000080008000ULL,
+    (uint64_t)0x000000000000808bULL,
+    (uint64_t)0x0000000080000001ULL,
+    (uint64_t)0x8000000080008081ULL,
+    (uint64_t)0x8000000000008009ULL,
+    (uint64_t)0x000000000000008aULL,
+    (uint64_t)0x0000000000000088ULL,
+    (uint64_t)0x0000000080008009ULL,
+    (uint64_t)0x000000008000000aULL,
+    (uint64_t)0x000000008000808bULL,
+    (uint64_t)0x800000000000008bULL,
+    (uint64_t)0x8000000000008089ULL,
+    (uint64_t)0x8000000000008003ULL,
+    (uint64_t)0x8000000000008002ULL,
+    (uint64_t)0x8000000000000080ULL,
+    (uint64_t)0x000000000000800aULL,
+    (uint64_t)0x800000008000000aULL,
+    (uint64_t)0x8000000080008081ULL,
+    (uint64_t)0x8000000000008080ULL,
+    (uint64_t)0x0000000080000001ULL,
+    (uint64_t)0x8000000080008008ULL
+};
+
+// Rotation offsets of rho, indexed by x+5*y
+static const unsigned int KeccakF_RotationOffsets[25] =
+{
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14
+};
+
+
+void KeccakF1600_StatePermute4x(__m256i *s)
+{
+    __m256i B[25], C[5], D[5];
+    unsigned int round, x, y;
+
+    for (round = 0; round < NROUNDS; round++) {
+        // Theta
+        for (x = 0; x < 5; x++) {
+            C[x] = _mm256_xor_si256(_mm256_xor_si256(s[x], s[x+5]), _mm256_xor_si256(_mm256_xor_si256(s[x+10], s[x+15]), s[x+20]));
+        }
+        for (x = 0; x < 5; x++) {
+            D[x] = _mm256_xor_si256(C[(x+4)%5], ROL4(C[(x+1)%5], 1));
+        }
+
+        // Rho and pi, B[y, 2x+3y] = ROL(A[x, y] ^ D[x])
+        B[0] = _mm256_xor_si256(s[0], D[0]);
+        for (x = 0; x < 5; x++) {
+            for (y = 0; y < 5; y++) {
+                if (x + y == 0) continue;
+                B[y + 5*((2*x + 3*y) % 5)] = ROL4(_mm256_xor_si256(s[x + 5*y], D[x]), KeccakF_RotationOffsets[x + 5*y]);
+            }
+        }
+
+        // Chi
+        for (y = 0; y < 25; y += 5) {
+            for (x = 0; x < 5; x++) {
+                s[y + x] = _mm256_xor_si256(B[y + x], _mm256_andnot_si256(B[y + (x+1)%5], B[y + (x+2)%5]));
+            }
+        }
+
+        // Iota
+        s[0] = _mm256_xor_si256(s[0], _mm256_set1_epi64x((long long)KeccakF_RoundConstants[round]));
+    }
+}
+
+
+static __m256i load64x4(const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3)
+{ // Gather one little-endian word of each input into the four lanes
+    uint64_t w[4];
+
+    memcpy(&w[0], in0, 8);
+    memcpy(&w[1], in1, 8);
+    memcpy(&w[2], in2, 8);
+    memcpy(&w[3], in3, 8);
+    return _mm256_set_epi64x((long long)w[3], (long long)w[2], (long long)w[1], (long long)w[0]);
+}
+
+
+static void keccakx4_absorb(__m256i *s, unsigned int r, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3,
+                            unsigned long long int inlen, unsigned char p)
+{
+    unsigned long long i, pos = 0;
+    unsigned char t[4][200];
+
+    while (inlen >= r) {
+        for (i = 0; i < r / 8; ++i)
+            s[i] = _mm256_xor_si256(s[i], load64x4(in0 + pos + 8*i, in1 + pos + 8*i, in2 + pos + 8*i, in3 + pos + 8*i));
+
+        KeccakF1600_StatePermute4x(s);
+        inlen -= r;
+        pos += r;
+    }
+
+    memset(t, 0, sizeof(t));
+    memcpy(t[0], in0 + pos, (size_t)inlen);
+    memcpy(t[1], in1 + pos, (size_t)inlen);
+    memcpy(t[2], in2 + pos, (size_t)inlen);
+    memcpy(t[3], in3 + pos, (size_t)inlen);
+    for (i = 0; i < 4; i++) {
+        t[i][inlen] = p;
+        t[i][r - 1] |= 128;
+    }
+    for (i = 0; i < r / 8; ++i)
+        s[i] = _mm256_xor_si256(s[i], load64x4(t[0] + 8*i, t[1] + 8*i, t[2] + 8*i, t[3] + 8*i));
+}
+
+
+static void keccakx4_squeezeblocks(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3,
+                                   unsigned long long int nblocks, __m256i *s, unsigned int r)
+{
+    unsigned int i;
+    uint64_t w[4];
+
+    while (nblocks > 0) {
+        KeccakF1600_StatePermute4x(s);
+        for (i = 0; i < (r>>3); i++) {
+            _mm256_storeu_si256((__m256i*)w, s[i]);
+            memcpy(out0 + 8*i, &w[0], 8);
+            memcpy(out1 + 8*i, &w[1], 8);
+            memcpy(out2 + 8*i, &w[2], 8);
+            memcpy(out3 + 8*i, &w[3], 8);
+        }
+        out0 += r;
+        out1 += r;
+        out2 += r;
+        out3 += r;
+        nblocks--;
+    }
+}
+
+
+/********** SHAKE256 ***********/
+
+void shake256x4_absorb(__m256i *s, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+    keccakx4_absorb(s, SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+}
+
+
+void shake256x4_squeezeblocks(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long nblocks, __m256i *s)
+{
+    keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, s, SHAKE256_RATE);
+}
+
+
+void shake256x4(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen,
+                const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{
+    __m256i s[25];
+    unsigned char t[4][SHAKE256_RATE];
+    unsigned long long nblocks = outlen/SHAKE256_RATE;
+    unsigned int i;
+
+    for (i = 0; i < 25; ++i)
+        s[i] = _mm256_setzero_si256();
+
+    /* Absorb input */
+    keccakx4_absorb(s, SHAKE256_RATE, in0, in1, in2, in3, inlen, 0x1F);
+
+    /* Squeeze output */
+    keccakx4_squeezeblocks(out0, out1, out2, out3, nblocks, s, SHAKE256_RATE);
+
+    outlen -= nblocks*SHAKE256_RATE;
+    if (outlen) {
+        keccakx4_squeezeblocks(t[0], t[1], t[2], t[3], 1, s, SHAKE256_RATE);
+        memcpy(out0 + nblocks*SHAKE256_RATE, t[0], (size_t)outlen);
+        memcpy(out1 + nblocks*SHAKE256_RATE, t[1], (size_t)outlen);
+        memcpy(out2 + nblocks*SHAKE256_RATE, t[2], (size_t)outlen);
+        memcpy(out3 + nblocks*SHAKE256_RATE, t[3], (size_t)outlen);
+    }
+}
+
+
+void shake256x4_inc_init(shake256x4_inc_state *state)
+{
+    unsigned int i;
+
+    for (i = 0; i < 25; ++i)
+        state->s[i] = _mm256_setzero_si256();
+    state->pos = 0;
+}
+
+
+void shake256x4_inc_absorb(shake256x4_inc_state *state, const unsigned char *in0, const unsigned char *in1, const unsigned char *in2, const unsigned char *in3, unsigned long long inlen)
+{ // Absorbs the inputs in place, whole lanes at a time once the position is aligned to a lane
+    __m256i *s = state->s;
+    unsigned int pos = state->pos, shift;
+
+    while (inlen > 0) {
+        if (pos == SHAKE256_RATE) {
+            KeccakF1600_StatePermute4x(s);
+            pos = 0;
+        }
+        if ((pos & 7) == 0 && inlen >= 8) {
+            s[pos >> 3] = _mm256_xor_si256(s[pos >> 3], load64x4(in0, in1, in2, in3));
+            pos += 8;
+            in0 += 8; in1 += 8; in2 += 8; in3 += 8;
+            inlen -= 8;
+        } else {
+            shift = 8 * (pos & 7);
+            s[pos >> 3] = _mm256_xor_si256(s[pos >> 3], _mm256_set_epi64x((long long)((uint64_t)*in3 << shift), (long long)((uint64_t)*in2 << shift),
+                                                                          (long long)((uint64_t)*in1 << shift), (long long)((uint64_t)*in0 << shift)));
+            pos++;
+            in0++; in1++; in2++; in3++;
+            inlen--;
+        }
+    }
+    state->pos = pos;
+}
+
+
+void shake256x4_inc_finalize(shake256x4_inc_state *state)
+{ // A full block is left unpermuted by shake256x4_inc_absorb, so the padding always fits
+    if (state->pos == SHAKE256_RATE) {
+        KeccakF1600_StatePermute4x(state->s);
+        state->pos = 0;
+    }
+    state->s[state->pos >> 3] = _mm256_xor_si256(state->s[state->pos >> 3], _mm256_set1_epi64x((long long)((uint64_t)0x1F << (8 * (state->pos & 7)))));
+    state->s[(SHAKE256_RATE - 1) >> 3] = _mm256_xor_si256(state->s[(SHAKE256_RATE - 1) >> 3], _mm256_set1_epi64x((long long)((uint64_t)128 << (8 * ((SHAKE256_RATE - 1) & 7)))));
+    state->pos = SHAKE256_RATE;
+}
+
+
+void shake256x4_inc_squeeze(unsigned char *out0, unsigned char *out1, unsigned char *out2, unsigned char *out3, unsigned long long outlen, shake256x4_inc_state *state)
+{ // Can be called repeatedly, state->pos is the number of bytes already output from the current block
+    unsigned int pos = state->pos;
+    uint64_t w[4];
+
+    while (outlen > 0) {
+        if (pos == SHAKE256_RATE) {
+            KeccakF1600_StatePermute4x(state->s);
+            pos = 0;
+        }
+        _mm256_storeu_si256((__m256i*)w, state->s[pos >> 3]);
+        if ((pos & 7) == 0 && outlen >= 8) {
+            memcpy(out0, &w[0], 8);
+            memcpy(out1, &w[1], 8);
+            memcpy(out2, &w[2], 8);
+            memcpy(out3, &w[3], 8);
+            pos += 8;
+            out0 += 8; out1 += 8; out2 += 8; out3 += 8;
+            outlen -= 8;
+        } else {
+            *out0++ = (unsigned char)(w[0] >> (8 * (pos & 7)));
+            *out1++ = (unsigned char)(w[1] >> (8 * (pos & 7)));
+            *out2++ = (unsigned char)(w[2] >> (8 * (pos & 7)));
+            *out3++ = (unsigned char)(w[3] >> (8 * (pos & 7)));
+            pos++;
+            outlen--;
+        }
+    }
+    state->pos = pos;
+}
@@ -0,0 +1,93 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: parameter set dispatch and level-independent functions for the multi-level library
+*********************************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include "sike_multi.h"
+
+
+static const sike_kem_t* const sike_kems[SIKE_ALG_COUNT] = {
+    &sike_p434_kem, &sike_p503_kem, &sike_p610_kem, &sike_p751_kem,
+    &sike_p434_compressed_kem, &sike_p503_compressed_kem, &sike_p610_compressed_kem, &sike_p751_compressed_kem
+};
+
+
+const sike_kem_t* sike_kem_params(sike_alg_t alg)
+{ // Parameter set with identifier alg, or NULL if alg is not valid
+    if ((unsigned int)alg >= SIKE_ALG_COUNT) {
+        return NULL;
+    }
+    return sike_kems[alg];
+}
+
+
+sike_alg_t sike_alg_from_name(const char* name)
+{ // Identifier of the parameter set with algorithm name "name", or SIKE_ALG_COUNT if unknown
+    unsigned int i;
+
+    for (i = 0; i < SIKE_ALG_COUNT; i++) {
+        if (strcmp(sike_kems[i]->name, name) == 0) {
+            return (sike_alg_t)i;
+        }
+    }
+    return SIKE_ALG_COUNT;
+}
+
+
+int sike_kem_keypair(sike_alg_t alg, unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation for the parameter set alg
+    const sike_kem_t* kem = sike_kem_params(alg);
+
+    if (kem == NULL) {
+        return -1;
+    }
+    return kem->keypair(pk, sk);
+}
+
+
+int sike_kem_enc(sike_alg_t alg, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation for the parameter set alg
+    const sike_kem_t* kem = sike_kem_params(alg);
+
+    if (kem == NULL) {
+        return -1;
+    }
+    return kem->enc(ct, ss, pk);
+}
+
+
+int sike_kem_dec(sike_alg_t alg, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation for the parameter set alg
+    const sike_kem_t* kem = sike_kem_params(alg);
+
+    if (kem == NULL) {
+        return -1;
+    }
+    return kem->dec(ss, ct, sk);
+}
+
+
+// Constant-time helpers from fpx.c, which leaves them out when compiled with _MULTI_LEVEL_
+
+int8_t ct_compare(const uint8_t *a, const uint8_t *b, unsigned int len)
+{ // Compare two byte arrays in constant time.
+  // Returns 0 if the byte arrays are equal, -1 otherwise.
+    uint8_t r = 0;
+
+    for (unsigned int i = 0; i < len; i++)
+        r |= a[i] ^ b[i];
+
+    return (-(int8_t)r) >> (8*sizeof(uint8_t)-1);
+}
+
+
+void ct_cmov(uint8_t *r, const uint8_t *a, unsigned int len, int8_t selector)
+{ // Conditional move in constant time.
+  // If selector = -1 then load r with a, else if selector = 0 then keep r.
+
+    for (unsigned int i = 0; i < len; i++)
+        r[i] ^= selector & (a[i] ^ r[i]);
+}
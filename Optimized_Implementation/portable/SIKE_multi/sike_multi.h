@@ -0,0 +1,102 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: API header file for the multi-level library (SIKEp434, SIKEp503, SIKEp610,
+*           SIKEp751 and their compressed variants)
+*********************************************************************************************/
+
+#ifndef SIKE_MULTI_H
+#define SIKE_MULTI_H
+
+#include <stddef.h>
+
+
+/*********************** Parameter set identifiers ***********************/
+
+typedef enum {
+    SIKE_P434 = 0,
+    SIKE_P503,
+    SIKE_P610,
+    SIKE_P751,
+    SIKE_P434_COMPRESSED,
+    SIKE_P503_COMPRESSED,
+    SIKE_P610_COMPRESSED,
+    SIKE_P751_COMPRESSED,
+    SIKE_ALG_COUNT                       // Number of parameter sets, also returned for unknown names
+} sike_alg_t;
+
+// Largest sizes over all the parameter sets, for buffers that must hold keys of any level
+#define SIKE_MAX_SECRETKEYBYTES     644
+#define SIKE_MAX_PUBLICKEYBYTES     564
+#define SIKE_MAX_CIPHERTEXTBYTES    596
+#define SIKE_MAX_BYTES               32
+
+// Description of one parameter set: sizes in bytes and its KEM entry points
+typedef struct {
+    const char* name;                    // CRYPTO_ALGNAME, e.g., "SIKEp434" or "SIKEp434_compressed"
+    size_t secretkeybytes;
+    size_t publickeybytes;
+    size_t ciphertextbytes;
+    size_t bytes;
+    int (*keypair)(unsigned char *pk, unsigned char *sk);
+    int (*enc)(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+    int (*dec)(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+} sike_kem_t;
+
+
+/*********************** Dispatch API ***********************/
+
+// Parameter set with identifier alg, or NULL if alg is not valid
+const sike_kem_t* sike_kem_params(sike_alg_t alg);
+
+// Identifier of the parameter set with algorithm name "name" (e.g., "SIKEp503_compressed"), or SIKE_ALG_COUNT if unknown
+sike_alg_t sike_alg_from_name(const char* name);
+
+// SIKE's key generation, encapsulation and decapsulation for the parameter set alg.
+// Keys, ciphertexts and shared secrets have the sizes given by sike_kem_params(alg).
+// They return 0 on success and -1 if alg is not valid.
+int sike_kem_keypair(sike_alg_t alg, unsigned char *pk, unsigned char *sk);
+int sike_kem_enc(sike_alg_t alg, unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_kem_dec(sike_alg_t alg, unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+
+/*********************** Namespaced entry points ***********************/
+// These are crypto_kem_keypair, crypto_kem_enc and crypto_kem_dec of each parameter set, see SIKEpXXX/PXXX/api.h
+
+int sike_p434_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p434_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p434_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p503_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p503_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p503_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p610_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p610_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p610_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p751_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p751_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p751_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p434_compressed_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p434_compressed_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p434_compressed_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p503_compressed_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p503_compressed_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p503_compressed_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p610_compressed_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p610_compressed_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p610_compressed_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+int sike_p751_compressed_kem_keypair(unsigned char *pk, unsigned char *sk);
+int sike_p751_compressed_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk);
+int sike_p751_compressed_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned char *sk);
+
+// Parameter set descriptors, defined by each instance
+extern const sike_kem_t sike_p434_kem, sike_p503_kem, sike_p610_kem, sike_p751_kem;
+extern const sike_kem_t sike_p434_compressed_kem, sike_p503_compressed_kem, sike_p610_compressed_kem, sike_p751_compressed_kem;
+
+#endif
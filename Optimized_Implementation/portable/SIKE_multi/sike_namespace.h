@@ -0,0 +1,274 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: symbol namespacing for the multi-level library
+*
+* Every external symbol of a parameter set is renamed with SIKE_NAMESPACE(), which each 
+* instance defines before including this file (e.g., sike_p434_##s). The symbols that are 
+* level-independent (Keccak, randombytes, ct_compare and ct_cmov) are left untouched so that 
+* a single copy is shared by all the parameter sets.
+*********************************************************************************************/  
+
+#ifndef SIKE_NAMESPACE_H
+#define SIKE_NAMESPACE_H
+
+#define _MULTI_LEVEL_
+
+#define ADD                                           SIKE_NAMESPACE(ADD)
+#define A_basis_zero                                  SIKE_NAMESPACE(A_basis_zero)
+#define A_gen                                         SIKE_NAMESPACE(A_gen)
+#define Alice_ladder                                  SIKE_NAMESPACE(Alice_ladder)
+#define Alice_order                                   SIKE_NAMESPACE(Alice_order)
+#define B_basis_zero                                  SIKE_NAMESPACE(B_basis_zero)
+#define B_gen                                         SIKE_NAMESPACE(B_gen)
+#define B_gen_3_tors                                  SIKE_NAMESPACE(B_gen_3_tors)
+#define BasePoint3n                                   SIKE_NAMESPACE(BasePoint3n)
+#define BasePoint3n_decompression                     SIKE_NAMESPACE(BasePoint3n_decompression)
+#define Bob_ladder                                    SIKE_NAMESPACE(Bob_ladder)
+#define Bob_order                                     SIKE_NAMESPACE(Bob_order)
+#define BuildOrdinaryE3nBasis                         SIKE_NAMESPACE(BuildOrdinaryE3nBasis)
+#define BuildOrdinaryE3nBasis_decompression           SIKE_NAMESPACE(BuildOrdinaryE3nBasis_decompression)
+#define CompleteMPoint                                SIKE_NAMESPACE(CompleteMPoint)
+#define Double                                        SIKE_NAMESPACE(Double)
+#define EphemeralKeyGeneration_A                      SIKE_NAMESPACE(EphemeralKeyGeneration_A)
+#define EphemeralKeyGeneration_B                      SIKE_NAMESPACE(EphemeralKeyGeneration_B)
+#define EphemeralSecretAgreement_A                    SIKE_NAMESPACE(EphemeralSecretAgreement_A)
+#define EphemeralSecretAgreement_B                    SIKE_NAMESPACE(EphemeralSecretAgreement_B)
+#define FormatPrivKey_B                               SIKE_NAMESPACE(FormatPrivKey_B)
+#define Ladder                                        SIKE_NAMESPACE(Ladder)
+#define Mont_ladder                                   SIKE_NAMESPACE(Mont_ladder)
+#define Montgomery_R                                  SIKE_NAMESPACE(Montgomery_R)
+#define Montgomery_R2                                 SIKE_NAMESPACE(Montgomery_R2)
+#define Montgomery_RB1                                SIKE_NAMESPACE(Montgomery_RB1)
+#define Montgomery_RB2                                SIKE_NAMESPACE(Montgomery_RB2)
+#define Montgomery_inversion_mod_order_bingcd         SIKE_NAMESPACE(Montgomery_inversion_mod_order_bingcd)
+#define Montgomery_multiply_mod_order                 SIKE_NAMESPACE(Montgomery_multiply_mod_order)
+#define Montgomery_neg                                SIKE_NAMESPACE(Montgomery_neg)
+#define Montgomery_one                                SIKE_NAMESPACE(Montgomery_one)
+#define Monty2Weier                                   SIKE_NAMESPACE(Monty2Weier)
+#define PointMonty2Weier                              SIKE_NAMESPACE(PointMonty2Weier)
+#define T_tate2_P                                     SIKE_NAMESPACE(T_tate2_P)
+#define T_tate2_Q                                     SIKE_NAMESPACE(T_tate2_Q)
+#define T_tate2_firststep_P                           SIKE_NAMESPACE(T_tate2_firststep_P)
+#define T_tate2_firststep_Q                           SIKE_NAMESPACE(T_tate2_firststep_Q)
+#define T_tate3                                       SIKE_NAMESPACE(T_tate3)
+#define Tate2_pairings                                SIKE_NAMESPACE(Tate2_pairings)
+#define Tate3_pairings                                SIKE_NAMESPACE(Tate3_pairings)
+#define Tate_4_pairings_2_torsion                     SIKE_NAMESPACE(Tate_4_pairings_2_torsion)
+#define Tate_4_pairings_3_torsion                     SIKE_NAMESPACE(Tate_4_pairings_3_torsion)
+#define Tate_pairings_2_torsion                       SIKE_NAMESPACE(Tate_pairings_2_torsion)
+#define Tate_pairings_3_torsion                       SIKE_NAMESPACE(Tate_pairings_3_torsion)
+#define Traverse_w_div_e_fullsigned                   SIKE_NAMESPACE(Traverse_w_div_e_fullsigned)
+#define Traverse_w_notdiv_e_fullsigned                SIKE_NAMESPACE(Traverse_w_notdiv_e_fullsigned)
+#define XQB3                                          SIKE_NAMESPACE(XQB3)
+#define clear_words                                   SIKE_NAMESPACE(clear_words)
+#define cmp_f2elm                                     SIKE_NAMESPACE(cmp_f2elm)
+#define copy_words                                    SIKE_NAMESPACE(copy_words)
+#define cube_Fp2_cycl                                 SIKE_NAMESPACE(cube_Fp2_cycl)
+#define digit_x_digit                                 SIKE_NAMESPACE(digit_x_digit)
+#define eval_2_isog                                   SIKE_NAMESPACE(eval_2_isog)
+#define eval_3_isog                                   SIKE_NAMESPACE(eval_3_isog)
+#define eval_4_isog                                   SIKE_NAMESPACE(eval_4_isog)
+#define fp2_conj                                      SIKE_NAMESPACE(fp2_conj)
+#define fp2add434                                     SIKE_NAMESPACE(fp2add434)
+#define fp2add503                                     SIKE_NAMESPACE(fp2add503)
+#define fp2add610                                     SIKE_NAMESPACE(fp2add610)
+#define fp2add751                                     SIKE_NAMESPACE(fp2add751)
+#define fp2copy434                                    SIKE_NAMESPACE(fp2copy434)
+#define fp2copy503                                    SIKE_NAMESPACE(fp2copy503)
+#define fp2copy610                                    SIKE_NAMESPACE(fp2copy610)
+#define fp2copy751                                    SIKE_NAMESPACE(fp2copy751)
+#define fp2correction434                              SIKE_NAMESPACE(fp2correction434)
+#define fp2correction503                              SIKE_NAMESPACE(fp2correction503)
+#define fp2correction610                              SIKE_NAMESPACE(fp2correction610)
+#define fp2correction751                              SIKE_NAMESPACE(fp2correction751)
+#define fp2div2_434                                   SIKE_NAMESPACE(fp2div2_434)
+#define fp2div2_503                                   SIKE_NAMESPACE(fp2div2_503)
+#define fp2div2_610                                   SIKE_NAMESPACE(fp2div2_610)
+#define fp2div2_751                                   SIKE_NAMESPACE(fp2div2_751)
+#define fp2inv434_mont                                SIKE_NAMESPACE(fp2inv434_mont)
+#define fp2inv434_mont_bingcd                         SIKE_NAMESPACE(fp2inv434_mont_bingcd)
+#define fp2inv503_mont                                SIKE_NAMESPACE(fp2inv503_mont)
+#define fp2inv503_mont_bingcd                         SIKE_NAMESPACE(fp2inv503_mont_bingcd)
+#define fp2inv610_mont                                SIKE_NAMESPACE(fp2inv610_mont)
+#define fp2inv610_mont_bingcd                         SIKE_NAMESPACE(fp2inv610_mont_bingcd)
+#define fp2inv751_mont                                SIKE_NAMESPACE(fp2inv751_mont)
+#define fp2inv751_mont_bingcd                         SIKE_NAMESPACE(fp2inv751_mont_bingcd)
+#define fp2mul434_mont                                SIKE_NAMESPACE(fp2mul434_mont)
+#define fp2mul503_mont                                SIKE_NAMESPACE(fp2mul503_mont)
+#define fp2mul610_mont                                SIKE_NAMESPACE(fp2mul610_mont)
+#define fp2mul751_mont                                SIKE_NAMESPACE(fp2mul751_mont)
+#define fp2neg434                                     SIKE_NAMESPACE(fp2neg434)
+#define fp2neg503                                     SIKE_NAMESPACE(fp2neg503)
+#define fp2neg610                                     SIKE_NAMESPACE(fp2neg610)
+#define fp2neg751                                     SIKE_NAMESPACE(fp2neg751)
+#define fp2shl                                        SIKE_NAMESPACE(fp2shl)
+#define fp2sqr434_mont                                SIKE_NAMESPACE(fp2sqr434_mont)
+#define fp2sqr503_mont                                SIKE_NAMESPACE(fp2sqr503_mont)
+#define fp2sqr610_mont                                SIKE_NAMESPACE(fp2sqr610_mont)
+#define fp2sqr751_mont                                SIKE_NAMESPACE(fp2sqr751_mont)
+#define fp2sub434                                     SIKE_NAMESPACE(fp2sub434)
+#define fp2sub503                                     SIKE_NAMESPACE(fp2sub503)
+#define fp2sub610                                     SIKE_NAMESPACE(fp2sub610)
+#define fp2sub751                                     SIKE_NAMESPACE(fp2sub751)
+#define fp2zero434                                    SIKE_NAMESPACE(fp2zero434)
+#define fp2zero503                                    SIKE_NAMESPACE(fp2zero503)
+#define fp2zero610                                    SIKE_NAMESPACE(fp2zero610)
+#define fp2zero751                                    SIKE_NAMESPACE(fp2zero751)
+#define fp_jacobi                                     SIKE_NAMESPACE(fp_jacobi)
+#define fpadd434                                      SIKE_NAMESPACE(fpadd434)
+#define fpadd503                                      SIKE_NAMESPACE(fpadd503)
+#define fpadd610                                      SIKE_NAMESPACE(fpadd610)
+#define fpadd751                                      SIKE_NAMESPACE(fpadd751)
+#define fpcopy434                                     SIKE_NAMESPACE(fpcopy434)
+#define fpcopy503                                     SIKE_NAMESPACE(fpcopy503)
+#define fpcopy610                                     SIKE_NAMESPACE(fpcopy610)
+#define fpcopy751                                     SIKE_NAMESPACE(fpcopy751)
+#define fpcorrection434                               SIKE_NAMESPACE(fpcorrection434)
+#define fpcorrection503                               SIKE_NAMESPACE(fpcorrection503)
+#define fpcorrection610                               SIKE_NAMESPACE(fpcorrection610)
+#define fpcorrection751                               SIKE_NAMESPACE(fpcorrection751)
+#define fpdiv2_434                                    SIKE_NAMESPACE(fpdiv2_434)
+#define fpdiv2_503                                    SIKE_NAMESPACE(fpdiv2_503)
+#define fpdiv2_610                                    SIKE_NAMESPACE(fpdiv2_610)
+#define fpdiv2_751                                    SIKE_NAMESPACE(fpdiv2_751)
+#define fpinv434_chain_mont                           SIKE_NAMESPACE(fpinv434_chain_mont)
+#define fpinv434_mont                                 SIKE_NAMESPACE(fpinv434_mont)
+#define fpinv434_mont_bingcd                          SIKE_NAMESPACE(fpinv434_mont_bingcd)
+#define fpinv434_mont_safegcd                         SIKE_NAMESPACE(fpinv434_mont_safegcd)
+#define fpinv503_chain_mont                           SIKE_NAMESPACE(fpinv503_chain_mont)
+#define fpinv503_mont                                 SIKE_NAMESPACE(fpinv503_mont)
+#define fpinv503_mont_bingcd                          SIKE_NAMESPACE(fpinv503_mont_bingcd)
+#define fpinv503_mont_safegcd                         SIKE_NAMESPACE(fpinv503_mont_safegcd)
+#define fpinv610_chain_mont                           SIKE_NAMESPACE(fpinv610_chain_mont)
+#define fpinv610_mont                                 SIKE_NAMESPACE(fpinv610_mont)
+#define fpinv610_mont_bingcd                          SIKE_NAMESPACE(fpinv610_mont_bingcd)
+#define fpinv610_mont_safegcd                         SIKE_NAMESPACE(fpinv610_mont_safegcd)
+#define fpinv751_chain_mont                           SIKE_NAMESPACE(fpinv751_chain_mont)
+#define fpinv751_mont                                 SIKE_NAMESPACE(fpinv751_mont)
+#define fpinv751_mont_bingcd                          SIKE_NAMESPACE(fpinv751_mont_bingcd)
+#define fpinv751_mont_safegcd                         SIKE_NAMESPACE(fpinv751_mont_safegcd)
+#define fpmul434_mont                                 SIKE_NAMESPACE(fpmul434_mont)
+#define fpmul503_mont                                 SIKE_NAMESPACE(fpmul503_mont)
+#define fpmul610_mont                                 SIKE_NAMESPACE(fpmul610_mont)
+#define fpmul751_mont                                 SIKE_NAMESPACE(fpmul751_mont)
+#define fpneg434                                      SIKE_NAMESPACE(fpneg434)
+#define fpneg503                                      SIKE_NAMESPACE(fpneg503)
+#define fpneg610                                      SIKE_NAMESPACE(fpneg610)
+#define fpneg751                                      SIKE_NAMESPACE(fpneg751)
+#define fpsqr434_mont                                 SIKE_NAMESPACE(fpsqr434_mont)
+#define fpsqr503_mont                                 SIKE_NAMESPACE(fpsqr503_mont)
+#define fpsqr610_mont                                 SIKE_NAMESPACE(fpsqr610_mont)
+#define fpsqr751_mont                                 SIKE_NAMESPACE(fpsqr751_mont)
+#define fpsub434                                      SIKE_NAMESPACE(fpsub434)
+#define fpsub503                                      SIKE_NAMESPACE(fpsub503)
+#define fpsub610                                      SIKE_NAMESPACE(fpsub610)
+#define fpsub751                                      SIKE_NAMESPACE(fpsub751)
+#define fpzero434                                     SIKE_NAMESPACE(fpzero434)
+#define fpzero503                                     SIKE_NAMESPACE(fpzero503)
+#define fpzero610                                     SIKE_NAMESPACE(fpzero610)
+#define fpzero751                                     SIKE_NAMESPACE(fpzero751)
+#define from_Montgomery_mod_order                     SIKE_NAMESPACE(from_Montgomery_mod_order)
+#define from_base                                     SIKE_NAMESPACE(from_base)
+#define from_fp2mont                                  SIKE_NAMESPACE(from_fp2mont)
+#define from_mont                                     SIKE_NAMESPACE(from_mont)
+#define g_R_S_im                                      SIKE_NAMESPACE(g_R_S_im)
+#define g_phiR_phiS_im                                SIKE_NAMESPACE(g_phiR_phiS_im)
+#define g_phiR_phiS_re                                SIKE_NAMESPACE(g_phiR_phiS_re)
+#define get_2_isog                                    SIKE_NAMESPACE(get_2_isog)
+#define get_2_torsion_entangled_basis_compression     SIKE_NAMESPACE(get_2_torsion_entangled_basis_compression)
+#define get_2_torsion_entangled_basis_decompression   SIKE_NAMESPACE(get_2_torsion_entangled_basis_decompression)
+#define get_3_isog                                    SIKE_NAMESPACE(get_3_isog)
+#define get_4_isog                                    SIKE_NAMESPACE(get_4_isog)
+#define get_A                                         SIKE_NAMESPACE(get_A)
+#define get_A_compression                             SIKE_NAMESPACE(get_A_compression)
+#define inv_3_way                                     SIKE_NAMESPACE(inv_3_way)
+#define inv_n_way                                     SIKE_NAMESPACE(inv_n_way)
+#define inv_mod_orderA                                SIKE_NAMESPACE(inv_mod_orderA)
+#define is_sqr_fp2                                    SIKE_NAMESPACE(is_sqr_fp2)
+#define j_inv                                         SIKE_NAMESPACE(j_inv)
+#define j_inv_proj                                    SIKE_NAMESPACE(j_inv_proj)
+#define mod3                                          SIKE_NAMESPACE(mod3)
+#define mont_n_way_inv                                SIKE_NAMESPACE(mont_n_way_inv)
+#define mont_twodim_scalarmult                        SIKE_NAMESPACE(mont_twodim_scalarmult)
+#define mp_add                                        SIKE_NAMESPACE(mp_add)
+#define mp_mul                                        SIKE_NAMESPACE(mp_mul)
+#define mp_shiftl1                                    SIKE_NAMESPACE(mp_shiftl1)
+#define mp_shiftleft                                  SIKE_NAMESPACE(mp_shiftleft)
+#define mp_shiftr1                                    SIKE_NAMESPACE(mp_shiftr1)
+#define mp_sub                                        SIKE_NAMESPACE(mp_sub)
+#define mp_sub434_p2                                  SIKE_NAMESPACE(mp_sub434_p2)
+#define mp_sub434_p4                                  SIKE_NAMESPACE(mp_sub434_p4)
+#define mp_sub503_p2                                  SIKE_NAMESPACE(mp_sub503_p2)
+#define mp_sub503_p4                                  SIKE_NAMESPACE(mp_sub503_p4)
+#define mp_sub610_p2                                  SIKE_NAMESPACE(mp_sub610_p2)
+#define mp_sub610_p4                                  SIKE_NAMESPACE(mp_sub610_p4)
+#define mp_sub751_p2                                  SIKE_NAMESPACE(mp_sub751_p2)
+#define mp_sub751_p4                                  SIKE_NAMESPACE(mp_sub751_p4)
+#define mul3                                          SIKE_NAMESPACE(mul3)
+#define multiply                                      SIKE_NAMESPACE(multiply)
+#define p434                                          SIKE_NAMESPACE(p434)
+#define p434p1                                        SIKE_NAMESPACE(p434p1)
+#define p434x16p                                      SIKE_NAMESPACE(p434x16p)
+#define p434x2                                        SIKE_NAMESPACE(p434x2)
+#define p434x4                                        SIKE_NAMESPACE(p434x4)
+#define p503                                          SIKE_NAMESPACE(p503)
+#define p503p1                                        SIKE_NAMESPACE(p503p1)
+#define p503p1x64                                     SIKE_NAMESPACE(p503p1x64)
+#define p503x16p                                      SIKE_NAMESPACE(p503x16p)
+#define p503x2                                        SIKE_NAMESPACE(p503x2)
+#define p503x4                                        SIKE_NAMESPACE(p503x4)
+#define p610                                          SIKE_NAMESPACE(p610)
+#define p610p1                                        SIKE_NAMESPACE(p610p1)
+#define p610x16p                                      SIKE_NAMESPACE(p610x16p)
+#define p610x2                                        SIKE_NAMESPACE(p610x2)
+#define p610x4                                        SIKE_NAMESPACE(p610x4)
+#define p751                                          SIKE_NAMESPACE(p751)
+#define p751p1                                        SIKE_NAMESPACE(p751p1)
+#define p751x16p                                      SIKE_NAMESPACE(p751x16p)
+#define p751x2                                        SIKE_NAMESPACE(p751x2)
+#define p751x4                                        SIKE_NAMESPACE(p751x4)
+#define ph2                                           SIKE_NAMESPACE(ph2)
+#define ph2_T                                         SIKE_NAMESPACE(ph2_T)
+#define ph2_T1                                        SIKE_NAMESPACE(ph2_T1)
+#define ph2_T2                                        SIKE_NAMESPACE(ph2_T2)
+#define ph2_path                                      SIKE_NAMESPACE(ph2_path)
+#define ph3                                           SIKE_NAMESPACE(ph3)
+#define ph3_T                                         SIKE_NAMESPACE(ph3_T)
+#define ph3_T1                                        SIKE_NAMESPACE(ph3_T1)
+#define ph3_T2                                        SIKE_NAMESPACE(ph3_T2)
+#define ph3_path                                      SIKE_NAMESPACE(ph3_path)
+#define random_mod_order_A                            SIKE_NAMESPACE(random_mod_order_A)
+#define random_mod_order_B                            SIKE_NAMESPACE(random_mod_order_B)
+#define rdc_mont                                      SIKE_NAMESPACE(rdc_mont)
+#define recover_os                                    SIKE_NAMESPACE(recover_os)
+#define recover_y                                     SIKE_NAMESPACE(recover_y)
+#define solve_dlog                                    SIKE_NAMESPACE(solve_dlog)
+#define sqr_Fp2_cycl                                  SIKE_NAMESPACE(sqr_Fp2_cycl)
+#define sqrt_Fp2                                      SIKE_NAMESPACE(sqrt_Fp2)
+#define sqrtinv2                                      SIKE_NAMESPACE(sqrtinv2)
+#define strat_Alice                                   SIKE_NAMESPACE(strat_Alice)
+#define strat_Bob                                     SIKE_NAMESPACE(strat_Bob)
+#define table_r_qnr                                   SIKE_NAMESPACE(table_r_qnr)
+#define table_r_qr                                    SIKE_NAMESPACE(table_r_qr)
+#define table_v_qnr                                   SIKE_NAMESPACE(table_v_qnr)
+#define table_v_qr                                    SIKE_NAMESPACE(table_v_qr)
+#define threeinv                                      SIKE_NAMESPACE(threeinv)
+#define to_Montgomery_mod_order                       SIKE_NAMESPACE(to_Montgomery_mod_order)
+#define to_fp2mont                                    SIKE_NAMESPACE(to_fp2mont)
+#define to_mont                                       SIKE_NAMESPACE(to_mont)
+#define u0_entang                                     SIKE_NAMESPACE(u0_entang)
+#define u_entang                                      SIKE_NAMESPACE(u_entang)
+#define v_3_torsion                                   SIKE_NAMESPACE(v_3_torsion)
+#define validate_ciphertext                           SIKE_NAMESPACE(validate_ciphertext)
+#define xDBL                                          SIKE_NAMESPACE(xDBL)
+#define xDBLADD                                       SIKE_NAMESPACE(xDBLADD)
+#define xDBLADD_proj                                  SIKE_NAMESPACE(xDBLADD_proj)
+#define xDBL_e                                        SIKE_NAMESPACE(xDBL_e)
+#define xDBLe                                         SIKE_NAMESPACE(xDBLe)
+#define xTPL                                          SIKE_NAMESPACE(xTPL)
+#define xTPL_fast                                     SIKE_NAMESPACE(xTPL_fast)
+#define xTPLe                                         SIKE_NAMESPACE(xTPLe)
+#define xTPLe_fast                                    SIKE_NAMESPACE(xTPLe_fast)
+
+#endif
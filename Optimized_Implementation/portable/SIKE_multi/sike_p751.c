@@ -0,0 +1,22 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: SIKEp751 instance of the multi-level library
+*********************************************************************************************/
+
+#define SIKE_NAMESPACE(s)             sike_p751_##s
+#define crypto_kem_keypair            sike_p751_kem_keypair
+#define crypto_kem_enc                sike_p751_kem_enc
+#define crypto_kem_dec                sike_p751_kem_dec
+#define crypto_kem_keypair_batch      sike_p751_kem_keypair_batch
+#define crypto_kem_enc_batch          sike_p751_kem_enc_batch
+#define crypto_kem_dec_batch          sike_p751_kem_dec_batch
+
+#include "sike_namespace.h"
+#include "../SIKEp751/P751/P751.c"
+#include "../SIKEp751/P751/generic/fp_generic.c"
+#include "sike_multi.h"
+
+
+const sike_kem_t SIKE_NAMESPACE(kem) = { CRYPTO_ALGNAME, CRYPTO_SECRETKEYBYTES, CRYPTO_PUBLICKEYBYTES, CRYPTO_CIPHERTEXTBYTES, CRYPTO_BYTES,
+                                         crypto_kem_keypair, crypto_kem_enc, crypto_kem_dec };
@@ -0,0 +1,401 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmark suite for all the parameter sets of the multi-level library.
+*           Reports min/median/p90/p99 cycles and nanoseconds of the KEM operations and of
+*           their internal phases, optionally pinned to a core, and writes them as JSON.
+*********************************************************************************************/
+
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE                  // For sched_setaffinity()
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+#include "../../SIKEp434/tests/test_extras.h"
+#include "../sike_multi.h"
+#include "bench_phases.h"
+
+
+// Default number of samples and of untimed warmup runs per measurement
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define KEM_SAMPLES        25
+    #define PHASE_SAMPLES     101
+#else
+    #define KEM_SAMPLES       101
+    #define PHASE_SAMPLES    1001
+#endif
+#define KEM_WARMUP              3
+#define PHASE_WARMUP           10
+
+#define MAX_SAMPLES        100000
+#define MAX_RESULTS           (SIKE_ALG_COUNT*16)
+
+#if (TARGET == TARGET_ARM || TARGET == TARGET_ARM64)
+    #define COUNTER_UNIT   "nsec"        // cpucycles() reads the monotonic clock on ARM
+#else
+    #define COUNTER_UNIT   "cycles"
+#endif
+
+// Field arithmetic of this build, recorded with every result
+#if defined(_UNSATURATED_)
+    #define BENCH_BACKEND  "generic_unsaturated"
+#elif defined(_NO_INT128_)
+    #define BENCH_BACKEND  "generic"
+#else
+    #define BENCH_BACKEND  "generic_int128"
+#endif
+
+
+// Order statistics of a measurement
+typedef struct {
+    unsigned long long min, median, p90, p99;
+    double mean;                         // Mean of the samples below the outlier fence
+    unsigned int outliers;               // Number of samples above Q3 + 3*IQR
+} bench_stats_t;
+
+typedef struct {
+    const char* alg;
+    const char* op;
+    const char* backend;
+    unsigned int samples;
+    bench_stats_t cycles, ns;
+} bench_result_t;
+
+static const sike_bench_phases_t* const bench_phases[SIKE_ALG_COUNT] = {
+    &bench_p434_phases, &bench_p503_phases, &bench_p610_phases, &bench_p751_phases,
+    &bench_p434_compressed_phases, &bench_p503_compressed_phases, &bench_p610_compressed_phases, &bench_p751_compressed_phases
+};
+
+static bench_result_t results[MAX_RESULTS];
+static unsigned int nresults = 0;
+static unsigned long long samples_cycles[MAX_SAMPLES], samples_ns[MAX_SAMPLES];
+
+// Operands of the KEM operation being measured
+static sike_alg_t kem_alg;
+static unsigned char kem_sk[SIKE_MAX_SECRETKEYBYTES], kem_pk[SIKE_MAX_PUBLICKEYBYTES], kem_ct[SIKE_MAX_CIPHERTEXTBYTES];
+static unsigned char kem_ss[SIKE_MAX_BYTES], kem_ss_[SIKE_MAX_BYTES];
+
+
+static void run_keygen(void)
+{
+    sike_kem_keypair(kem_alg, kem_pk, kem_sk);
+}
+
+
+static void run_encaps(void)
+{
+    sike_kem_enc(kem_alg, kem_ct, kem_ss, kem_pk);
+}
+
+
+static void run_decaps(void)
+{
+    sike_kem_dec(kem_alg, kem_ss_, kem_ct, kem_sk);
+}
+
+
+static unsigned long long nanoseconds(void)
+{ // Monotonic clock in nanoseconds
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long)t.tv_sec*1000000000ULL + (unsigned long long)t.tv_nsec;
+}
+
+
+static int compare_samples(const void* a, const void* b)
+{
+    unsigned long long x = *(const unsigned long long*)a, y = *(const unsigned long long*)b;
+
+    return (x > y) - (x < y);
+}
+
+
+static unsigned long long percentile(const unsigned long long* v, const unsigned int n, const unsigned int p)
+{ // Nearest-rank p-th percentile of n sorted samples
+    unsigned int rank = (p*n + 99)/100;
+
+    return v[(rank > 0) ? rank-1 : 0];
+}
+
+
+static void statistics(unsigned long long* v, const unsigned int n, bench_stats_t* s)
+{ // Order statistics of n samples, v is sorted in place.
+  // Samples above the Tukey fence Q3 + 3*IQR (e.g., interrupts or migrations) are left out of the mean only.
+    unsigned long long q1, q3, fence;
+    double sum = 0;
+    unsigned int i, kept = 0;
+
+    qsort(v, n, sizeof(v[0]), compare_samples);
+    s->min = v[0];
+    s->median = percentile(v, n, 50);
+    s->p90 = percentile(v, n, 90);
+    s->p99 = percentile(v, n, 99);
+
+    q1 = percentile(v, n, 25);
+    q3 = percentile(v, n, 75);
+    fence = q3 + 3*(q3 - q1);
+    for (i = 0; i < n; i++) {
+        if (v[i] <= fence) {
+            sum += (double)v[i];
+            kept++;
+        }
+    }
+    s->mean = sum/kept;
+    s->outliers = n - kept;
+}
+
+
+static void measure(const char* alg, const char* op, void (*run)(void), const unsigned int samples, const unsigned int warmup)
+{ // Times "samples" runs of run() after "warmup" untimed runs, and prints one row of the table
+    unsigned long long cycles1, cycles2, ns1, ns2;
+    bench_result_t* r = &results[nresults];
+    unsigned int n;
+
+    for (n = 0; n < warmup; n++) {
+        run();
+    }
+    for (n = 0; n < samples; n++) {
+        ns1 = nanoseconds();
+        cycles1 = cpucycles();
+        run();
+        cycles2 = cpucycles();
+        ns2 = nanoseconds();
+        samples_cycles[n] = cycles2-cycles1;
+        samples_ns[n] = ns2-ns1;
+    }
+
+    r->alg = alg;
+    r->op = op;
+    r->backend = BENCH_BACKEND;
+    r->samples = samples;
+    statistics(samples_cycles, samples, &r->cycles);
+    statistics(samples_ns, samples, &r->ns);
+    if (nresults < MAX_RESULTS-1) {
+        nresults++;
+    }
+
+    printf("  %-22s %-12s %14llu %14llu %14llu %14llu %14llu %6u\n", alg, op, r->cycles.min, r->cycles.median, r->cycles.p90, r->cycles.p99, r->ns.median, r->cycles.outliers);
+}
+
+
+static int bench_kem(const sike_alg_t alg, const unsigned int samples, const unsigned int warmup)
+{ // Benchmarking key generation, encapsulation and decapsulation through the dispatch API
+    const char* name = sike_kem_params(alg)->name;
+
+    kem_alg = alg;
+    measure(name, "keygen", run_keygen, samples, warmup);
+    measure(name, "encaps", run_encaps, samples, warmup);
+    measure(name, "decaps", run_decaps, samples, warmup);
+
+    // The ciphertext of the last encapsulation was made with the last key pair
+    if (memcmp(kem_ss, kem_ss_, sike_kem_params(alg)->bytes) != 0) {
+        printf("  %-22s shared secrets differ ... FAILED\n", name);
+        return FAILED;
+    }
+    return PASSED;
+}
+
+
+static void bench_phase(const sike_alg_t alg, const unsigned int samples, const unsigned int warmup)
+{ // Benchmarking the internal phases of one parameter set
+    const sike_bench_phases_t* p = bench_phases[alg];
+    unsigned int i;
+
+    p->setup();
+    for (i = 0; i < p->nphases; i++) {
+        measure(p->name, p->phases[i].name, p->phases[i].run, samples, warmup);
+    }
+}
+
+
+static void json_stats(FILE* f, const char* unit, const bench_stats_t* s)
+{
+    fprintf(f, "\"%s\": {\"min\": %llu, \"median\": %llu, \"p90\": %llu, \"p99\": %llu, \"mean\": %.1f, \"outliers\": %u}",
+            unit, s->min, s->median, s->p90, s->p99, s->mean, s->outliers);
+}
+
+
+static int json_write(const char* path, const int cpu, const unsigned int kem_samples, const unsigned int phase_samples, const unsigned int kem_warmup, const unsigned int phase_warmup)
+{ // Writes the build configuration, the benchmark settings and all the results to the file "path"
+    FILE* f = fopen(path, "w");
+    char date[32];
+    time_t now = time(NULL);
+    unsigned int i;
+
+    if (f == NULL) {
+        perror(path);
+        return FAILED;
+    }
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"suite\": \"SIKE multi-level benchmark\",\n");
+    fprintf(f, "  \"date\": \"%s\",\n", date);
+    fprintf(f, "  \"build\": {\n");
+#if defined(__VERSION__)
+    fprintf(f, "    \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(f, "    \"inversion\": \"%s\",\n",
+#if defined(_SAFEGCD_INVERSION_)
+            "safegcd"
+#else
+            "chain"
+#endif
+            );
+    fprintf(f, "    \"fixed_base_ladder\": %s,\n",
+#if defined(_FIXED_BASE_LADDER_)
+            "true"
+#else
+            "false"
+#endif
+            );
+    fprintf(f, "    \"tuned_strategy\": %s,\n",
+#if defined(_TUNED_STRATEGY_)
+            "true"
+#else
+            "false"
+#endif
+            );
+#if defined(_PARALLEL_ISOGENY_)
+    fprintf(f, "    \"threads\": %d,\n", NTHREADS);
+#else
+    fprintf(f, "    \"threads\": 1,\n");
+#endif
+    fprintf(f, "    \"counter\": \"%s\"\n", COUNTER_UNIT);
+    fprintf(f, "  },\n");
+    fprintf(f, "  \"settings\": {\"kem_samples\": %u, \"phase_samples\": %u, \"kem_warmup\": %u, \"phase_warmup\": %u, \"cpu\": %d},\n",
+            kem_samples, phase_samples, kem_warmup, phase_warmup, cpu);
+    fprintf(f, "  \"results\": [\n");
+    for (i = 0; i < nresults; i++) {
+        fprintf(f, "    {\"alg\": \"%s\", \"op\": \"%s\", \"backend\": \"%s\", \"samples\": %u, ",
+                results[i].alg, results[i].op, results[i].backend, results[i].samples);
+        json_stats(f, "cycles", &results[i].cycles);
+        fprintf(f, ", ");
+        json_stats(f, "ns", &results[i].ns);
+        fprintf(f, "}%s\n", (i+1 < nresults) ? "," : "");
+    }
+    fprintf(f, "  ]\n");
+    fprintf(f, "}\n");
+
+    return (fclose(f) == 0) ? PASSED : FAILED;
+}
+
+
+static int pin_to_cpu(const int cpu)
+{ // Restricts the process to the given core
+#if defined(__linux__)
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        perror("sched_setaffinity");
+        return FAILED;
+    }
+    return PASSED;
+#else
+    (void)cpu;
+    fprintf(stderr, "Pinning to a core is only supported on Linux\n");
+    return FAILED;
+#endif
+}
+
+
+static void usage(const char* prog)
+{
+    printf("Usage: %s [options]\n", prog);
+    printf("  --alg NAME            Benchmark only this parameter set, e.g., SIKEp503_compressed (can be repeated)\n");
+    printf("  --samples N           Timed runs per KEM operation (default %d)\n", KEM_SAMPLES);
+    printf("  --phase-samples N     Timed runs per internal phase (default %d)\n", PHASE_SAMPLES);
+    printf("  --warmup N            Untimed runs before each KEM operation (default %d)\n", KEM_WARMUP);
+    printf("  --phase-warmup N      Untimed runs before each internal phase (default %d)\n", PHASE_WARMUP);
+    printf("  --cpu N               Pin the benchmark to core N\n");
+    printf("  --no-phases           Only benchmark the KEM operations\n");
+    printf("  --json FILE           Write the results to FILE as JSON\n");
+}
+
+
+static int parse_count(const char* arg, unsigned int* n)
+{ // Positive count no larger than MAX_SAMPLES
+    char* end;
+    unsigned long v = strtoul(arg, &end, 10);
+
+    if (*arg == '\0' || *end != '\0' || v == 0 || v > MAX_SAMPLES) {
+        return FAILED;
+    }
+    *n = (unsigned int)v;
+    return PASSED;
+}
+
+
+int main(int argc, char* argv[])
+{
+    int Status = PASSED, cpu = -1, phases = 1;
+    unsigned int kem_samples = KEM_SAMPLES, phase_samples = PHASE_SAMPLES, kem_warmup = KEM_WARMUP, phase_warmup = PHASE_WARMUP;
+    unsigned int alg, nselected = 0;
+    int selected[SIKE_ALG_COUNT] = {0};
+    const char* json = NULL;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        int has_value = (i+1 < argc);
+
+        if (strcmp(argv[i], "--alg") == 0 && has_value) {
+            sike_alg_t a = sike_alg_from_name(argv[++i]);
+            if (a == SIKE_ALG_COUNT) {
+                fprintf(stderr, "Unknown parameter set %s\n", argv[i]);
+                return FAILED;
+            }
+            selected[a] = 1;
+            nselected++;
+        } else if (strcmp(argv[i], "--samples") == 0 && has_value) {
+            if (parse_count(argv[++i], &kem_samples) != PASSED) { usage(argv[0]); return FAILED; }
+        } else if (strcmp(argv[i], "--phase-samples") == 0 && has_value) {
+            if (parse_count(argv[++i], &phase_samples) != PASSED) { usage(argv[0]); return FAILED; }
+        } else if (strcmp(argv[i], "--warmup") == 0 && has_value) {
+            kem_warmup = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--phase-warmup") == 0 && has_value) {
+            phase_warmup = (unsigned int)strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--cpu") == 0 && has_value) {
+            cpu = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--json") == 0 && has_value) {
+            json = argv[++i];
+        } else if (strcmp(argv[i], "--no-phases") == 0) {
+            phases = 0;
+        } else {
+            usage(argv[0]);
+            return (strcmp(argv[i], "--help") == 0) ? PASSED : FAILED;
+        }
+    }
+    if (cpu >= 0 && pin_to_cpu(cpu) != PASSED) {
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISMS (MULTI-LEVEL LIBRARY)\n");
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    printf("  %-22s %-12s %14s %14s %14s %14s %14s %6s\n", "", "", "min", "median", "p90", "p99", "median", "");
+    printf("  %-22s %-12s %14s %14s %14s %14s %14s %6s\n", "", "", COUNTER_UNIT, COUNTER_UNIT, COUNTER_UNIT, COUNTER_UNIT, "nsec", "outl.");
+
+    for (alg = 0; alg < SIKE_ALG_COUNT; alg++) {
+        if (nselected > 0 && !selected[alg]) {
+            continue;
+        }
+        Status |= bench_kem((sike_alg_t)alg, kem_samples, kem_warmup);
+        if (phases) {
+            bench_phase((sike_alg_t)alg, phase_samples, phase_warmup);
+        }
+        printf("\n");
+    }
+
+    if (json != NULL) {
+        Status |= json_write(json, cpu, kem_samples, phase_samples, kem_warmup, phase_warmup);
+    }
+
+    return Status;
+}
@@ -0,0 +1,22 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: SIKEp503 phases for the benchmark suite
+*********************************************************************************************/
+
+#define SIKE_NAMESPACE(s)             bench_p503_##s
+#define crypto_kem_keypair            bench_p503_kem_keypair
+#define crypto_kem_enc                bench_p503_kem_enc
+#define crypto_kem_dec                bench_p503_kem_dec
+#define crypto_kem_keypair_batch      bench_p503_kem_keypair_batch
+#define crypto_kem_enc_batch          bench_p503_kem_enc_batch
+#define crypto_kem_dec_batch          bench_p503_kem_dec_batch
+
+#include <string.h>
+#include "../sike_namespace.h"
+#include "../../SIKEp503/P503/P503.c"
+#include "../../SIKEp503/P503/generic/fp_generic.c"
+#include "bench_phases.h"
+
+
+#include "bench_phases.c"
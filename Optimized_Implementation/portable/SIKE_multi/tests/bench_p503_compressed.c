@@ -0,0 +1,22 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: SIKEp503_compressed phases for the benchmark suite
+*********************************************************************************************/
+
+#define SIKE_NAMESPACE(s)             bench_p503_compressed_##s
+#define crypto_kem_keypair            bench_p503_compressed_kem_keypair
+#define crypto_kem_enc                bench_p503_compressed_kem_enc
+#define crypto_kem_dec                bench_p503_compressed_kem_dec
+#define crypto_kem_keypair_batch      bench_p503_compressed_kem_keypair_batch
+#define crypto_kem_enc_batch          bench_p503_compressed_kem_enc_batch
+#define crypto_kem_dec_batch          bench_p503_compressed_kem_dec_batch
+
+#include <string.h>
+#include "../sike_namespace.h"
+#include "../../SIKEp503_compressed/P503/P503_compressed.c"
+#include "../../SIKEp503_compressed/P503/generic/fp_generic.c"
+#include "bench_phases.h"
+
+
+#include "bench_phases.c"
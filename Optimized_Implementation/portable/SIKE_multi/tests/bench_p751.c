@@ -0,0 +1,22 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: SIKEp751 phases for the benchmark suite
+*********************************************************************************************/
+
+#define SIKE_NAMESPACE(s)             bench_p751_##s
+#define crypto_kem_keypair            bench_p751_kem_keypair
+#define crypto_kem_enc                bench_p751_kem_enc
+#define crypto_kem_dec                bench_p751_kem_dec
+#define crypto_kem_keypair_batch      bench_p751_kem_keypair_batch
+#define crypto_kem_enc_batch          bench_p751_kem_enc_batch
+#define crypto_kem_dec_batch          bench_p751_kem_dec_batch
+
+#include <string.h>
+#include "../sike_namespace.h"
+#include "../../SIKEp751/P751/P751.c"
+#include "../../SIKEp751/P751/generic/fp_generic.c"
+#include "bench_phases.h"
+
+
+#include "bench_phases.c"
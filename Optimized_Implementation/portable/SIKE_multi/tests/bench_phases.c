@@ -0,0 +1,251 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: internal phases of one parameter set for the benchmark suite.
+*           Included by bench_pXXX.c after the sources of the parameter set.
+*********************************************************************************************/
+
+#define MAX_POINTS           ((MAX_INT_POINTS_ALICE > MAX_INT_POINTS_BOB) ? MAX_INT_POINTS_ALICE : MAX_INT_POINTS_BOB)
+
+#ifdef COMPRESS
+    #define G_BYTES          SECRETKEY_B_BYTES         // The compressed variants derive Bob's ephemeral key from G(m||pk)
+#else
+    #define G_BYTES          SECRETKEY_A_BYTES
+#endif
+
+// Inputs of the phases, indexed by ALICE and BOB
+static f2elm_t bench_XP[2], bench_XQ[2], bench_XR[2], bench_A;
+static digit_t bench_sk[2][NWORDS_ORDER];
+static point_proj bench_kernel[2], bench_phi[2][3];
+static f2elm_t bench_curve[2][2];                      // (A24plus, C24) for Alice and (A24minus, A24plus) for Bob
+static f2elm_t bench_z[3];
+static unsigned char bench_m[MSG_BYTES], bench_pk[CRYPTO_PUBLICKEYBYTES], bench_ct[CRYPTO_CIPHERTEXTBYTES];
+static volatile digit_t bench_sink;                    // Keeps the compiler from discarding the phases' outputs
+
+
+static void bench_ladder(const unsigned int AliceOrBob, point_proj_t R)
+{ // Three-point ladder as in key generation
+#if defined(_FIXED_BASE_LADDER_) && !defined(COMPRESS)
+    LADDER3PT_fixed(bench_XP[AliceOrBob], bench_XR[AliceOrBob], bench_sk[AliceOrBob], AliceOrBob, R);
+#else
+    LADDER3PT(bench_XP[AliceOrBob], bench_XQ[AliceOrBob], bench_XR[AliceOrBob], bench_sk[AliceOrBob], AliceOrBob, R, bench_A);
+#endif
+}
+
+
+static void bench_setup(void)
+{ // Random private keys, their kernel points, and random messages, public key and ciphertext
+    unsigned char sk[SECRETKEY_B_BYTES > SECRETKEY_A_BYTES ? SECRETKEY_B_BYTES : SECRETKEY_A_BYTES] = {0};
+    unsigned int k;
+
+    // Starting curve A = 6, Alice's constants A24plus = A+2C, C24 = 4C, and Bob's A24minus = A-2C, A24plus = A+2C
+    fp2zero(bench_A);
+    fpcopy((digit_t*)&Montgomery_one, bench_A[0]);
+    fp2add(bench_A, bench_A, bench_curve[ALICE][0]);
+    fp2add(bench_curve[ALICE][0], bench_curve[ALICE][0], bench_curve[ALICE][1]);
+    fp2add(bench_curve[ALICE][0], bench_curve[ALICE][1], bench_A);
+    fp2add(bench_curve[ALICE][1], bench_curve[ALICE][1], bench_curve[ALICE][0]);
+    fp2copy(bench_curve[ALICE][1], bench_curve[BOB][0]);
+    fp2copy(bench_curve[ALICE][0], bench_curve[BOB][1]);
+
+    init_basis((digit_t*)A_gen, bench_XP[ALICE], bench_XQ[ALICE], bench_XR[ALICE]);
+    init_basis((digit_t*)B_gen, bench_XP[BOB], bench_XQ[BOB], bench_XR[BOB]);
+
+    random_mod_order_A(sk);
+    memset(bench_sk[ALICE], 0, sizeof(bench_sk[ALICE]));
+    decode_to_digits(sk, bench_sk[ALICE], SECRETKEY_A_BYTES, NWORDS_ORDER);
+    random_mod_order_B(sk);
+    memset(bench_sk[BOB], 0, sizeof(bench_sk[BOB]));
+    decode_to_digits(sk, bench_sk[BOB], SECRETKEY_B_BYTES, NWORDS_ORDER);
+
+    // Each traversal evaluates the other party's basis
+    for (k = 0; k < 2; k++) {
+        bench_ladder(k, &bench_kernel[k]);
+        init_basis((digit_t*)((k == ALICE) ? B_gen : A_gen), bench_phi[k][0].X, bench_phi[k][1].X, bench_phi[k][2].X);
+        fp2zero(bench_phi[k][0].Z);
+        fp2zero(bench_phi[k][1].Z);
+        fp2zero(bench_phi[k][2].Z);
+        fpcopy((digit_t*)&Montgomery_one, bench_phi[k][0].Z[0]);
+        fpcopy((digit_t*)&Montgomery_one, bench_phi[k][1].Z[0]);
+        fpcopy((digit_t*)&Montgomery_one, bench_phi[k][2].Z[0]);
+    }
+
+#if (OALICE_BITS % 2 == 1)
+    point_proj_t S;
+
+    xDBLe(&bench_kernel[ALICE], S, bench_curve[ALICE][0], bench_curve[ALICE][1], (int)(OALICE_BITS-1));
+    get_2_isog(S, bench_curve[ALICE][0], bench_curve[ALICE][1]);
+    eval_2_isog(&bench_phi[ALICE][0], S);
+    eval_2_isog(&bench_phi[ALICE][1], S);
+    eval_2_isog(&bench_phi[ALICE][2], S);
+    eval_2_isog(&bench_kernel[ALICE], S);
+#endif
+
+    fp2copy(bench_kernel[ALICE].Z, bench_z[0]);
+    fp2copy(bench_kernel[BOB].Z, bench_z[1]);
+    fp2copy(bench_kernel[ALICE].X, bench_z[2]);
+
+    randombytes(bench_m, MSG_BYTES);
+    randombytes(bench_pk, CRYPTO_PUBLICKEYBYTES);
+    randombytes(bench_ct, CRYPTO_CIPHERTEXTBYTES);
+}
+
+
+static void bench_traversal(const unsigned int AliceOrBob)
+{ // Tree traversal as in key generation, including the evaluation of the other party's basis
+    point_proj_t R, phiP, phiQ, phiR, pts[MAX_POINTS];
+    f2elm_t C0, C1, coeff[3];
+    unsigned int i, row, m, index = 0, pts_index[MAX_POINTS], npts = 0, ii = 0;
+    unsigned int max = (AliceOrBob == ALICE) ? MAX_Alice : MAX_Bob;
+
+    *R = bench_kernel[AliceOrBob];
+    *phiP = bench_phi[AliceOrBob][0];
+    *phiQ = bench_phi[AliceOrBob][1];
+    *phiR = bench_phi[AliceOrBob][2];
+    fp2copy(bench_curve[AliceOrBob][0], C0);
+    fp2copy(bench_curve[AliceOrBob][1], C1);
+
+    for (row = 1; row < max; row++) {
+        while (index < max-row) {
+            fp2copy(R->X, pts[npts]->X);
+            fp2copy(R->Z, pts[npts]->Z);
+            pts_index[npts++] = index;
+            if (AliceOrBob == ALICE) {
+                m = strat_Alice[ii++];
+                xDBLe(R, R, C0, C1, (int)(2*m));
+            } else {
+                m = strat_Bob[ii++];
+                xTPLe(R, R, C0, C1, (int)m);
+            }
+            index += m;
+        }
+        if (AliceOrBob == ALICE) {
+            get_4_isog(R, C0, C1, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+            eval_4_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+            eval_4_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
+            for (i = 0; i < npts; i++) {
+                eval_4_isog(pts[i], coeff);
+            }
+            eval_4_isog(phiP, coeff);
+            eval_4_isog(phiQ, coeff);
+            eval_4_isog(phiR, coeff);
+#endif
+        } else {
+            get_3_isog(R, C0, C1, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+            eval_3_isog_parallel(pts, npts, phiP, phiQ, phiR, coeff);
+#elif defined(_AVX2_ISOGENY_)
+            eval_3_isog_avx2(pts, npts, phiP, phiQ, phiR, coeff);
+#else
+            for (i = 0; i < npts; i++) {
+                eval_3_isog(pts[i], coeff);
+            }
+            eval_3_isog(phiP, coeff);
+            eval_3_isog(phiQ, coeff);
+            eval_3_isog(phiR, coeff);
+#endif
+        }
+        fp2copy(pts[npts-1]->X, R->X);
+        fp2copy(pts[npts-1]->Z, R->Z);
+        index = pts_index[npts-1];
+        npts -= 1;
+    }
+    bench_sink ^= R->X[0][0] ^ phiP->X[0][0] ^ phiQ->X[0][0] ^ phiR->X[0][0];
+}
+
+
+static void bench_ladder_A(void)
+{
+    point_proj_t R;
+
+    bench_ladder(ALICE, R);
+    bench_sink ^= R->X[0][0];
+}
+
+
+static void bench_ladder_B(void)
+{
+    point_proj_t R;
+
+    bench_ladder(BOB, R);
+    bench_sink ^= R->X[0][0];
+}
+
+
+static void bench_traversal_A(void)
+{
+    bench_traversal(ALICE);
+}
+
+
+static void bench_traversal_B(void)
+{
+    bench_traversal(BOB);
+}
+
+
+static void bench_fp2inv(void)
+{ // Single inversion in GF(p^2), as used for the j-invariant
+    f2elm_t z;
+
+    fp2copy(bench_z[0], z);
+    fp2inv_mont(z);
+    bench_sink ^= z[0][0];
+}
+
+
+static void bench_inv_3_way(void)
+{ // Simultaneous inversion of the three public key denominators
+    f2elm_t z1, z2, z3;
+
+    fp2copy(bench_z[0], z1);
+    fp2copy(bench_z[1], z2);
+    fp2copy(bench_z[2], z3);
+    inv_3_way(z1, z2, z3);
+    bench_sink ^= z1[0][0] ^ z2[0][0] ^ z3[0][0];
+}
+
+
+static void bench_hash_G(void)
+{ // G(m||pk), as in encapsulation
+    unsigned char out[G_BYTES];
+    shake256_inc_state state;
+
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, bench_m, MSG_BYTES);
+    shake256_inc_absorb(&state, bench_pk, CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(out, G_BYTES, &state);
+    bench_sink ^= out[0];
+}
+
+
+static void bench_hash_H(void)
+{ // H(m||ct), as in encapsulation and decapsulation
+    unsigned char out[CRYPTO_BYTES];
+    shake256_inc_state state;
+
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, bench_m, MSG_BYTES);
+    shake256_inc_absorb(&state, bench_ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(out, CRYPTO_BYTES, &state);
+    bench_sink ^= out[0];
+}
+
+
+static const sike_bench_phase_t bench_phase_list[] = {
+    { "ladder_A", bench_ladder_A },
+    { "ladder_B", bench_ladder_B },
+    { "traversal_A", bench_traversal_A },
+    { "traversal_B", bench_traversal_B },
+    { "fp2inv", bench_fp2inv },
+    { "inv_3_way", bench_inv_3_way },
+    { "hash_G", bench_hash_G },
+    { "hash_H", bench_hash_H }
+};
+
+const sike_bench_phases_t SIKE_NAMESPACE(phases) = { CRYPTO_ALGNAME, bench_setup, sizeof(bench_phase_list)/sizeof(bench_phase_list[0]), bench_phase_list };
@@ -0,0 +1,30 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: internal phases of each parameter set timed by the benchmark suite
+*********************************************************************************************/
+
+#ifndef BENCH_PHASES_H
+#define BENCH_PHASES_H
+
+
+// One phase: run() is timed, it works on inputs prepared by the setup() of its parameter set
+typedef struct {
+    const char* name;                    // e.g., "ladder_A" or "traversal_B"
+    void (*run)(void);
+} sike_bench_phase_t;
+
+// Phases of one parameter set
+typedef struct {
+    const char* name;                    // CRYPTO_ALGNAME, as in sike_kem_t
+    void (*setup)(void);                 // Draws the private keys and computes the kernel points used by the phases
+    unsigned int nphases;
+    const sike_bench_phase_t* phases;
+} sike_bench_phases_t;
+
+
+// Phase descriptors, defined by each benchmark instance (bench_pXXX.c)
+extern const sike_bench_phases_t bench_p434_phases, bench_p503_phases, bench_p610_phases, bench_p751_phases;
+extern const sike_bench_phases_t bench_p434_compressed_phases, bench_p503_compressed_phases, bench_p610_compressed_phases, bench_p751_compressed_phases;
+
+#endif
@@ -0,0 +1,122 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: benchmarking/testing all the parameter sets of the multi-level library
+*********************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "../../SIKEp434/tests/test_extras.h"
+#include "../sike_multi.h"
+
+
+// Benchmark and test parameters
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM)
+    #define BENCH_LOOPS        5      // Number of iterations per bench
+    #define TEST_LOOPS         5      // Number of iterations per test
+#else
+    #define BENCH_LOOPS       100
+    #define TEST_LOOPS        10
+#endif
+
+
+int cryptotest_kem(sike_alg_t alg)
+{ // Testing KEM through the dispatch API and the namespaced entry points
+    unsigned int i;
+    const sike_kem_t* kem = sike_kem_params(alg);
+    unsigned char sk[SIKE_MAX_SECRETKEYBYTES] = {0};
+    unsigned char pk[SIKE_MAX_PUBLICKEYBYTES] = {0};
+    unsigned char ct[SIKE_MAX_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[SIKE_MAX_BYTES] = {0};
+    unsigned char ss_[SIKE_MAX_BYTES] = {0};
+    bool passed = (sike_alg_from_name(kem->name) == alg);
+
+    for (i = 0; i < TEST_LOOPS && passed; i++)
+    {
+        sike_kem_keypair(alg, pk, sk);
+        sike_kem_enc(alg, ct, ss, pk);
+        kem->dec(ss_, ct, sk);
+        passed = (memcmp(ss, ss_, kem->bytes) == 0);
+
+        kem->enc(ct, ss, pk);
+        sike_kem_dec(alg, ss_, ct, sk);
+        passed = passed && (memcmp(ss, ss_, kem->bytes) == 0);
+    }
+
+    if (passed == true) printf("  %-20s KEM tests ..................................... PASSED", kem->name);
+    else { printf("  %-20s KEM tests ... FAILED", kem->name); printf("\n"); return FAILED; }
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int cryptorun_kem(sike_alg_t alg)
+{ // Benchmarking key exchange
+    unsigned int n;
+    const sike_kem_t* kem = sike_kem_params(alg);
+    unsigned char sk[SIKE_MAX_SECRETKEYBYTES] = {0};
+    unsigned char pk[SIKE_MAX_PUBLICKEYBYTES] = {0};
+    unsigned char ct[SIKE_MAX_CIPHERTEXTBYTES] = {0};
+    unsigned char ss[SIKE_MAX_BYTES] = {0};
+    unsigned char ss_[SIKE_MAX_BYTES] = {0};
+    unsigned long long cycles_keygen = 0, cycles_encaps = 0, cycles_decaps = 0, cycles1, cycles2;
+
+    for (n = 0; n < BENCH_LOOPS; n++)
+    {
+        // Benchmarking key generation
+        cycles1 = cpucycles();
+        sike_kem_keypair(alg, pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+
+        // Benchmarking encapsulation
+        cycles1 = cpucycles();
+        sike_kem_enc(alg, ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_encaps = cycles_encaps+(cycles2-cycles1);
+
+        // Benchmarking decapsulation
+        cycles1 = cpucycles();
+        sike_kem_dec(alg, ss_, ct, sk);
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+
+    printf("  %-20s %14lld %14lld %14lld ", kem->name, cycles_keygen/BENCH_LOOPS, cycles_encaps/BENCH_LOOPS, cycles_decaps/BENCH_LOOPS); print_unit;
+    printf("\n");
+
+    return PASSED;
+}
+
+
+int main()
+{
+    int Status = PASSED;
+    unsigned int alg;
+
+    printf("\n\nTESTING ISOGENY-BASED KEY ENCAPSULATION MECHANISMS (MULTI-LEVEL LIBRARY)\n");
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (alg = 0; alg < SIKE_ALG_COUNT; alg++) {
+        Status |= cryptotest_kem((sike_alg_t)alg);       // Test key encapsulation mechanism
+    }
+    if (sike_kem_params(SIKE_ALG_COUNT) != NULL || sike_alg_from_name("SIKEp0") != SIKE_ALG_COUNT || sike_kem_keypair(SIKE_ALG_COUNT, NULL, NULL) != -1) {
+        printf("  Dispatch of unknown parameter sets ... FAILED\n");
+        Status = FAILED;
+    }
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
+    printf("\n\nBENCHMARKING ISOGENY-BASED KEY ENCAPSULATION MECHANISMS (MULTI-LEVEL LIBRARY)\n");
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+    printf("  %-20s %14s %14s %14s\n", "", "Key generation", "Encapsulation", "Decapsulation");
+
+    for (alg = 0; alg < SIKE_ALG_COUNT; alg++) {
+        cryptorun_kem((sike_alg_t)alg);                  // Benchmark key encapsulation mechanism
+    }
+
+    return Status;
+}
@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals of SIKEp434
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P434/P434.c"
+
+
+#define SCHEME_NAME       "SIKEp434"
+#define fp2random_test    fp2random434_test
+
+
+#include "strategy.c"
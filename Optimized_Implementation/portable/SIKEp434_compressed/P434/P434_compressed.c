@@ -8,6 +8,9 @@
 #define COMPRESS
 #include "P434_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -162,11 +165,15 @@ const uint64_t Montgomery_one[NWORDS64_FIELD]    = { 0x000000000000742C, 0x00000
 const uint64_t threeinv[NWORDS64_FIELD] = {0x5555555555557C0E,0x5555555555555555,0x5555555555555555,0x3C30F5A8EB555555,0x9A84C9F93D7058B4,0x410E5C007655D5E8,0x1C70EFCA40721};
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P434_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 
     48, 28, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 13, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 4, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1 };
 
 const unsigned int strat_Bob[MAX_Bob-1] = { 
     66, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 32, 16, 8, 4, 3, 1, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
 
 // Fixed traversal strategies for Pohlig-Hellman discrete logs
 const unsigned int ph2_path[PLEN_2] = {
@@ -351,6 +358,7 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fpinv_mont                    fpinv434_mont
 #define fpinv_chain_mont              fpinv434_chain_mont
 #define fpinv_mont_bingcd             fpinv434_mont_bingcd
+#define fpinv_mont_safegcd            fpinv434_mont_safegcd
 #define fp2copy                       fp2copy434
 #define fp2zero                       fp2zero434
 #define fp2add                        fp2add434
@@ -366,9 +374,19 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2inv_mont                   fp2inv434_mont
 #define fp2inv_mont_bingcd            fp2inv434_mont_bingcd
 #define fpequal_non_constant_time     fpequal434_non_constant_time
+#define eval_4_isog_x4                eval_4_isog434_x4
+#define eval_3_isog_x4                eval_3_isog434_x4
+#define eval_4_isog_x2                eval_4_isog434_x2
+#define eval_3_isog_x2                eval_3_isog434_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add434_asm
 #define mp_subaddx2_asm               mp_subadd434x2_asm
 #define mp_dblsubx2_asm               mp_dblsub434x2_asm
+#endif
 
 
 
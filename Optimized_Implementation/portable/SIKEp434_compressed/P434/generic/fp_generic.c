@@ -166,6 +166,206 @@ void digit_x_digit(const digit_t a, const digit_t b, digit_t* c)
 }
 
 
+#if defined(GENERIC_INT128) && defined(_UNSATURATED_)
+
+// Unsaturated arithmetic: mp_mul and rdc_mont split their operands in limbs of 56 bits, so that the products
+// of a column are accumulated in 128 bits and the carries are propagated once per column
+#define LIMB_BITS           56
+#define LIMB_MASK           (((digit_t)1 << LIMB_BITS) - 1)
+#define MULADD(x, y)        acc += (uint128_t)(x) * (y)
+#define COLUMN(c)           (c) = (digit_t)acc & LIMB_MASK; acc >>= LIMB_BITS
+
+// p434+1 in radix 2^56, the three least significant limbs are zero
+static const digit_t p434p1_unsat[8] = {
+    0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00E3000000000000,
+    0x0058AEA3FDC1767A, 0x0020567BC65C7831, 0x00446CFC5FD681C5, 0x000002341F271773 };
+
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision product scanning multiply in radix 2^56, c = a*b, where lng(a) = lng(b) = nwords = NWORDS_FIELD.
+  // Inputs: a, b in [0, 8*p434-1]
+    digit_t la[8], lb[8], lc[16];
+    uint128_t acc = 0;
+
+    la[0] = a[0] & LIMB_MASK;
+    la[1] = ((a[0] >> 56) | (a[1] << 8)) & LIMB_MASK;
+    la[2] = ((a[1] >> 48) | (a[2] << 16)) & LIMB_MASK;
+    la[3] = ((a[2] >> 40) | (a[3] << 24)) & LIMB_MASK;
+    la[4] = ((a[3] >> 32) | (a[4] << 32)) & LIMB_MASK;
+    la[5] = ((a[4] >> 24) | (a[5] << 40)) & LIMB_MASK;
+    la[6] = ((a[5] >> 16) | (a[6] << 48)) & LIMB_MASK;
+    la[7] = a[6] >> 8;
+    lb[0] = b[0] & LIMB_MASK;
+    lb[1] = ((b[0] >> 56) | (b[1] << 8)) & LIMB_MASK;
+    lb[2] = ((b[1] >> 48) | (b[2] << 16)) & LIMB_MASK;
+    lb[3] = ((b[2] >> 40) | (b[3] << 24)) & LIMB_MASK;
+    lb[4] = ((b[3] >> 32) | (b[4] << 32)) & LIMB_MASK;
+    lb[5] = ((b[4] >> 24) | (b[5] << 40)) & LIMB_MASK;
+    lb[6] = ((b[5] >> 16) | (b[6] << 48)) & LIMB_MASK;
+    lb[7] = b[6] >> 8;
+
+    MULADD(la[0], lb[0]); COLUMN(lc[0]);
+    MULADD(la[0], lb[1]); MULADD(la[1], lb[0]); COLUMN(lc[1]);
+    MULADD(la[0], lb[2]); MULADD(la[1], lb[1]); MULADD(la[2], lb[0]); COLUMN(lc[2]);
+    MULADD(la[0], lb[3]); MULADD(la[1], lb[2]); MULADD(la[2], lb[1]); MULADD(la[3], lb[0]);
+    COLUMN(lc[3]);
+    MULADD(la[0], lb[4]); MULADD(la[1], lb[3]); MULADD(la[2], lb[2]); MULADD(la[3], lb[1]);
+    MULADD(la[4], lb[0]); COLUMN(lc[4]);
+    MULADD(la[0], lb[5]); MULADD(la[1], lb[4]); MULADD(la[2], lb[3]); MULADD(la[3], lb[2]);
+    MULADD(la[4], lb[1]); MULADD(la[5], lb[0]); COLUMN(lc[5]);
+    MULADD(la[0], lb[6]); MULADD(la[1], lb[5]); MULADD(la[2], lb[4]); MULADD(la[3], lb[3]);
+    MULADD(la[4], lb[2]); MULADD(la[5], lb[1]); MULADD(la[6], lb[0]); COLUMN(lc[6]);
+    MULADD(la[0], lb[7]); MULADD(la[1], lb[6]); MULADD(la[2], lb[5]); MULADD(la[3], lb[4]);
+    MULADD(la[4], lb[3]); MULADD(la[5], lb[2]); MULADD(la[6], lb[1]); MULADD(la[7], lb[0]);
+    COLUMN(lc[7]);
+    MULADD(la[1], lb[7]); MULADD(la[2], lb[6]); MULADD(la[3], lb[5]); MULADD(la[4], lb[4]);
+    MULADD(la[5], lb[3]); MULADD(la[6], lb[2]); MULADD(la[7], lb[1]); COLUMN(lc[8]);
+    MULADD(la[2], lb[7]); MULADD(la[3], lb[6]); MULADD(la[4], lb[5]); MULADD(la[5], lb[4]);
+    MULADD(la[6], lb[3]); MULADD(la[7], lb[2]); COLUMN(lc[9]);
+    MULADD(la[3], lb[7]); MULADD(la[4], lb[6]); MULADD(la[5], lb[5]); MULADD(la[6], lb[4]);
+    MULADD(la[7], lb[3]); COLUMN(lc[10]);
+    MULADD(la[4], lb[7]); MULADD(la[5], lb[6]); MULADD(la[6], lb[5]); MULADD(la[7], lb[4]);
+    COLUMN(lc[11]);
+    MULADD(la[5], lb[7]); MULADD(la[6], lb[6]); MULADD(la[7], lb[5]); COLUMN(lc[12]);
+    MULADD(la[6], lb[7]); MULADD(la[7], lb[6]); COLUMN(lc[13]);
+    MULADD(la[7], lb[7]); COLUMN(lc[14]);
+    lc[15] = (digit_t)acc;
+
+    c[0] = lc[0] | (lc[1] << 56);
+    c[1] = (lc[1] >> 8) | (lc[2] << 48);
+    c[2] = (lc[2] >> 16) | (lc[3] << 40);
+    c[3] = (lc[3] >> 24) | (lc[4] << 32);
+    c[4] = (lc[4] >> 32) | (lc[5] << 24);
+    c[5] = (lc[5] >> 40) | (lc[6] << 16);
+    c[6] = (lc[6] >> 48) | (lc[7] << 8);
+    c[7] = lc[8] | (lc[9] << 56);
+    c[8] = (lc[9] >> 8) | (lc[10] << 48);
+    c[9] = (lc[10] >> 16) | (lc[11] << 40);
+    c[10] = (lc[11] >> 24) | (lc[12] << 32);
+    c[11] = (lc[12] >> 32) | (lc[13] << 24);
+    c[12] = (lc[13] >> 40) | (lc[14] << 16);
+    c[13] = (lc[14] >> 48) | (lc[15] << 8);
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction in radix 2^56 exploiting the special form of the prime p434.
+  // mc = ma*R^-1 mod p434x2, where R = 2^448.
+  // If ma < 2^448*p434, the output mc is in the range [0, 2*p434-1].
+  // ma is assumed to be in Montgomery representation.
+  // Since p434 = -1 mod 2^56, adding q*p434 with q = t mod 2^56 drops the low limb of t and adds q*(p434+1).
+    digit_t t[16], q[8];
+    uint128_t acc = 0;
+
+    t[0] = ma[0] & LIMB_MASK;
+    t[1] = ((ma[0] >> 56) | (ma[1] << 8)) & LIMB_MASK;
+    t[2] = ((ma[1] >> 48) | (ma[2] << 16)) & LIMB_MASK;
+    t[3] = ((ma[2] >> 40) | (ma[3] << 24)) & LIMB_MASK;
+    t[4] = ((ma[3] >> 32) | (ma[4] << 32)) & LIMB_MASK;
+    t[5] = ((ma[4] >> 24) | (ma[5] << 40)) & LIMB_MASK;
+    t[6] = ((ma[5] >> 16) | (ma[6] << 48)) & LIMB_MASK;
+    t[7] = ma[6] >> 8;
+    t[8] = ma[7] & LIMB_MASK;
+    t[9] = ((ma[7] >> 56) | (ma[8] << 8)) & LIMB_MASK;
+    t[10] = ((ma[8] >> 48) | (ma[9] << 16)) & LIMB_MASK;
+    t[11] = ((ma[9] >> 40) | (ma[10] << 24)) & LIMB_MASK;
+    t[12] = ((ma[10] >> 32) | (ma[11] << 32)) & LIMB_MASK;
+    t[13] = ((ma[11] >> 24) | (ma[12] << 40)) & LIMB_MASK;
+    t[14] = ((ma[12] >> 16) | (ma[13] << 48)) & LIMB_MASK;
+    t[15] = ma[13] >> 8;
+
+    acc += t[0]; COLUMN(q[0]);
+    acc += t[1]; COLUMN(q[1]);
+    acc += t[2]; COLUMN(q[2]);
+    acc += t[3]; MULADD(q[0], p434p1_unsat[3]); COLUMN(q[3]);
+    acc += t[4]; MULADD(q[1], p434p1_unsat[3]); MULADD(q[0], p434p1_unsat[4]); COLUMN(q[4]);
+    acc += t[5]; MULADD(q[2], p434p1_unsat[3]); MULADD(q[1], p434p1_unsat[4]); MULADD(q[0], p434p1_unsat[5]);
+    COLUMN(q[5]);
+    acc += t[6]; MULADD(q[3], p434p1_unsat[3]); MULADD(q[2], p434p1_unsat[4]); MULADD(q[1], p434p1_unsat[5]);
+    MULADD(q[0], p434p1_unsat[6]); COLUMN(q[6]);
+    acc += t[7]; MULADD(q[4], p434p1_unsat[3]); MULADD(q[3], p434p1_unsat[4]); MULADD(q[2], p434p1_unsat[5]);
+    MULADD(q[1], p434p1_unsat[6]); MULADD(q[0], p434p1_unsat[7]); COLUMN(q[7]);
+    acc += t[8]; MULADD(q[5], p434p1_unsat[3]); MULADD(q[4], p434p1_unsat[4]); MULADD(q[3], p434p1_unsat[5]);
+    MULADD(q[2], p434p1_unsat[6]); MULADD(q[1], p434p1_unsat[7]); COLUMN(t[0]);
+    acc += t[9]; MULADD(q[6], p434p1_unsat[3]); MULADD(q[5], p434p1_unsat[4]); MULADD(q[4], p434p1_unsat[5]);
+    MULADD(q[3], p434p1_unsat[6]); MULADD(q[2], p434p1_unsat[7]); COLUMN(t[1]);
+    acc += t[10]; MULADD(q[7], p434p1_unsat[3]); MULADD(q[6], p434p1_unsat[4]); MULADD(q[5], p434p1_unsat[5]);
+    MULADD(q[4], p434p1_unsat[6]); MULADD(q[3], p434p1_unsat[7]); COLUMN(t[2]);
+    acc += t[11]; MULADD(q[7], p434p1_unsat[4]); MULADD(q[6], p434p1_unsat[5]); MULADD(q[5], p434p1_unsat[6]);
+    MULADD(q[4], p434p1_unsat[7]); COLUMN(t[3]);
+    acc += t[12]; MULADD(q[7], p434p1_unsat[5]); MULADD(q[6], p434p1_unsat[6]); MULADD(q[5], p434p1_unsat[7]);
+    COLUMN(t[4]);
+    acc += t[13]; MULADD(q[7], p434p1_unsat[6]); MULADD(q[6], p434p1_unsat[7]); COLUMN(t[5]);
+    acc += t[14]; MULADD(q[7], p434p1_unsat[7]); COLUMN(t[6]);
+    acc += t[15]; t[7] = (digit_t)acc;
+
+    mc[0] = t[0] | (t[1] << 56);
+    mc[1] = (t[1] >> 8) | (t[2] << 48);
+    mc[2] = (t[2] >> 16) | (t[3] << 40);
+    mc[3] = (t[3] >> 24) | (t[4] << 32);
+    mc[4] = (t[4] >> 32) | (t[5] << 24);
+    mc[5] = (t[5] >> 40) | (t[6] << 16);
+    mc[6] = (t[6] >> 48) | (t[7] << 8);
+}
+
+#elif defined(GENERIC_INT128)
+
+void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
+{ // Multiprecision schoolbook multiply using 128-bit integers, c = a*b, where lng(a) = lng(b) = nwords.
+    unsigned int i, j;
+    digit_t carry;
+    uint128_t uv;
+
+    for (i = 0; i < nwords; i++) {
+        c[i] = 0;
+    }
+
+    for (i = 0; i < nwords; i++) {
+        carry = 0;
+        for (j = 0; j < nwords; j++) {
+            uv = (uint128_t)a[j] * b[i] + c[i+j] + carry;
+            c[i+j] = (digit_t)uv;
+            carry = (digit_t)(uv >> RADIX);
+        }
+        c[i+nwords] = carry;
+    }
+}
+
+
+void rdc_mont(digit_t* ma, digit_t* mc)
+{ // Montgomery reduction using 128-bit integers and exploiting the special form of the prime p434.
+  // mc = ma*R^-1 mod p434x2, where R = 2^448.
+  // If ma < 2^448*p434, the output mc is in the range [0, 2*p434-1].
+  // ma is assumed to be in Montgomery representation.
+    unsigned int i, j;
+    digit_t t[2*NWORDS_FIELD], q, carry, carry2 = 0;
+    uint128_t uv;
+
+    for (i = 0; i < 2*NWORDS_FIELD; i++) {
+        t[i] = ma[i];
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        // Since p434 = -1 mod 2^RADIX, adding q*p434 with q = t[i] is the same as dropping t[i] and adding q*(p434+1)
+        q = t[i];
+        carry = 0;
+        for (j = p434_ZERO_WORDS; j < NWORDS_FIELD; j++) {
+            uv = (uint128_t)q * ((digit_t*)p434p1)[j] + t[i+j] + carry;
+            t[i+j] = (digit_t)uv;
+            carry = (digit_t)(uv >> RADIX);
+        }
+        uv = (uint128_t)t[i+NWORDS_FIELD] + carry + carry2;
+        t[i+NWORDS_FIELD] = (digit_t)uv;
+        carry2 = (digit_t)(uv >> RADIX);
+    }
+
+    for (i = 0; i < NWORDS_FIELD; i++) {
+        mc[i] = t[i+NWORDS_FIELD];
+    }
+}
+
+#else
+
 void mp_mul(const digit_t* a, const digit_t* b, digit_t* c, const unsigned int nwords)
 { // Multiprecision comba multiply, c = a*b, where lng(a) = lng(b) = nwords.   
     unsigned int i, j;
@@ -253,4 +453,6 @@ void rdc_mont(digit_t* ma, digit_t* mc)
     }
     ADDC(0, v, ma[2*NWORDS_FIELD-1], carry, v); 
     mc[NWORDS_FIELD-1] = v;
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
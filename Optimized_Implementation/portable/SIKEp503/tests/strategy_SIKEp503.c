@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals of SIKEp503
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503.c"
+
+
+#define SCHEME_NAME       "SIKEp503"
+#define fp2random_test    fp2random503_test
+
+
+#include "strategy.c"
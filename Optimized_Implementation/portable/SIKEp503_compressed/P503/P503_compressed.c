@@ -8,6 +8,9 @@
 #define COMPRESS
 #include "P503_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -156,6 +159,9 @@ const uint64_t threeinv[NWORDS64_FIELD] = {
 0x55555555555556A8,0x5555555555555555,0x5555555555555555,0x7555555555555555,0x7CF1276D98503E1C,0xCF0186C74B5465B9,0xA3B114D6FC634CB0,0x227636AD3027D0 };
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P503_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice - 1] = {
 61, 32, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1,
 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1,
@@ -170,6 +176,7 @@ const unsigned int strat_Bob[MAX_Bob - 1] = {
 1, 4, 2, 1, 1, 2, 1, 1, 33, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1,
 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2,
 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
 
 // Fixed traversal strategies for Pohlig-Hellman discrete logs
 const unsigned int ph2_path[PLEN_2] = {
@@ -357,6 +364,7 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fpinv_mont                    fpinv503_mont
 #define fpinv_chain_mont              fpinv503_chain_mont
 #define fpinv_mont_bingcd             fpinv503_mont_bingcd
+#define fpinv_mont_safegcd            fpinv503_mont_safegcd
 #define fp2copy                       fp2copy503
 #define fp2zero                       fp2zero503
 #define fp2add                        fp2add503
@@ -372,9 +380,19 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2inv_mont                   fp2inv503_mont
 #define fp2inv_mont_bingcd            fp2inv503_mont_bingcd
 #define fpequal_non_constant_time     fpequal503_non_constant_time
+#define eval_4_isog_x4                eval_4_isog503_x4
+#define eval_3_isog_x4                eval_3_isog503_x4
+#define eval_4_isog_x2                eval_4_isog503_x2
+#define eval_3_isog_x2                eval_3_isog503_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add503_asm
 #define mp_subaddx2_asm               mp_subadd503x2_asm
 #define mp_dblsubx2_asm               mp_dblsub503x2_asm
+#endif
 
 
 
@@ -102,6 +102,9 @@ void eval_3_isog(point_proj_t Q, const f2elm_t* coeff);
 // 3-way simultaneous inversion
 void inv_3_way(f2elm_t z1, f2elm_t z2, f2elm_t z3);
 
+// n-way simultaneous inversion in constant time, t is scratch space for n elements. The inverse of a zero input is 0
+void inv_n_way(f2elm_t* z, f2elm_t* t, const unsigned int n);
+
 // Given the x-coordinates of P, Q, and R, returns the value A corresponding to the Montgomery curve E_A: y^2=x^3+A*x^2+x such that R=Q-P on E_A.
 void get_A(const f2elm_t xP, const f2elm_t xQ, const f2elm_t xR, f2elm_t A);
 
@@ -6,6 +6,9 @@
 
 #include "random/random.h"
 #include <string.h>
+#if defined(_PARALLEL_ISOGENY_)
+    #include "parallel.c"
+#endif
 
 #define COMPRESSION 0
 #define DECOMPRESSION 1
@@ -571,9 +574,15 @@ static void FullIsogeny_A_dual(unsigned char* PrivateKeyA, f2elm_t As[][5], f2el
         fp2copy(A24, As[row-1][0]);
         fp2copy(C24, As[row-1][1]);
         get_4_isog_dual(R, A24, C24, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+        eval_4_isog_parallel(pts, npts, NULL, NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_4_isog_avx2(pts, npts, NULL, NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_4_isog(pts[i], coeff);
         }
+#endif
         eval_dual_4_isog_shared(coeff[2], coeff[3], coeff[4], *(As+row-1)+2);
 
         fp2copy(pts[npts-1]->X, R->X);
@@ -799,9 +808,15 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
         }
         get_3_isog(R, A24minus, A24plus, coeff);
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_3_isog_parallel(pts, npts, NULL, NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_3_isog_avx2(pts, npts, NULL, NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_3_isog(pts[i], coeff);
         } 
+#endif
 
         fp2copy(pts[npts-1]->X, R->X);
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -822,11 +837,10 @@ int EphemeralSecretAgreement_B(const unsigned char* PrivateKeyB, const unsigned
 
 static void BuildEntangledXonly(const f2elm_t A, point_proj_t *R, unsigned char *qnr, unsigned char *ind)
 {
-    felm_t s;
     f2elm_t *t_ptr, r, t;
 
     // Select the correct table
-    if (is_sqr_fp2(A,  s)) {
+    if (is_sqr_fp2(A)) {
         t_ptr = (f2elm_t *)table_v_qnr; 
         *qnr = 1;
     } else {
@@ -844,7 +858,7 @@ static void BuildEntangledXonly(const f2elm_t A, point_proj_t *R, unsigned char
         fpadd(t[0],  (digit_t*)Montgomery_one,  t[0]);
         fp2mul_mont(R[0]->X,  t,  t);                     // t = R[0]->X^3 + A*R[0]->X^2 + R[0]->X
         *ind += 1;
-    } while (!is_sqr_fp2(t,  s));
+    } while (!is_sqr_fp2(t));
     *ind -= 1;
 
     if (*qnr)
@@ -972,10 +986,16 @@ static void FullIsogeny_B_dual(const unsigned char* PrivateKeyB, f2elm_t Ds[][2]
             index += m;
         } 
         get_3_isog(R, A24minus, A24plus, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+        eval_3_isog_parallel(pts, npts, Q3, NULL, NULL, coeff);    // Q3 is the kernel of the dual
+#elif defined(_AVX2_ISOGENY_)
+        eval_3_isog_avx2(pts, npts, Q3, NULL, NULL, coeff);    // Q3 is the kernel of the dual
+#else
         for (i = 0; i < npts; i++) {
             eval_3_isog(pts[i], coeff);
         }     
         eval_3_isog(Q3, coeff);    // Kernel of dual 
+#endif
         fp2sub(Q3->X,Q3->Z,Ds[row-1][0]);
         fp2add(Q3->X,Q3->Z,Ds[row-1][1]);
 
@@ -1341,9 +1361,15 @@ static int EphemeralSecretAgreement_A_extended(const unsigned char* PrivateKeyA,
         }
         get_4_isog(R, A24plus, C24, coeff);
 
+#if defined(_PARALLEL_ISOGENY_)
+        eval_4_isog_parallel(pts, npts, NULL, NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_4_isog_avx2(pts, npts, NULL, NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_4_isog(pts[i], coeff);
         }
+#endif
 
         fp2copy(pts[npts-1]->X, R->X);
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -1412,10 +1438,16 @@ int8_t validate_ciphertext(const unsigned char* ephemeralsk_, const unsigned cha
             index += m;
         } 
         get_3_isog(R, A24minus, A24plus, coeff);
+#if defined(_PARALLEL_ISOGENY_)
+        eval_3_isog_parallel(pts, npts, phis[0], NULL, NULL, coeff);
+#elif defined(_AVX2_ISOGENY_)
+        eval_3_isog_avx2(pts, npts, phis[0], NULL, NULL, coeff);
+#else
         for (i = 0; i < npts; i++) {
             eval_3_isog(pts[i], coeff);
         }         
         eval_3_isog(phis[0], coeff);
+#endif
 
         fp2copy(pts[npts-1]->X, R->X);
         fp2copy(pts[npts-1]->Z, R->Z);
@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp503_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P503/P503_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp503_compressed"
+#define fprandom_test     fprandom503_test
+#define fp2random_test    fp2random503_test
+
+
+#include "test_inversion.c"
@@ -6,6 +6,9 @@
 
 #include <string.h>
 #include "sha3/fips202.h"
+#if defined(_AVX2_KECCAK_)
+    #include "sha3/fips202x4.h"
+#endif
 
 
 int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
@@ -35,12 +38,16 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     unsigned char ephemeralsk[SECRETKEY_A_BYTES];
     unsigned char jinvariant[FP2_ENCODED_BYTES];
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m[MSG_BYTES];
+    shake256_inc_state state;
 
     // Generate ephemeralsk <- G(m||pk) mod oA 
-    randombytes(temp, MSG_BYTES);
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    randombytes(m, MSG_BYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m, MSG_BYTES);
+    shake256_inc_absorb(&state, pk, CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ephemeralsk, SECRETKEY_A_BYTES, &state);
     ephemeralsk[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
 
     // Encrypt
@@ -48,12 +55,15 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     EphemeralSecretAgreement_A(ephemeralsk, pk, jinvariant);
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + CRYPTO_PUBLICKEYBYTES] = temp[i] ^ h[i];
+        ct[i + CRYPTO_PUBLICKEYBYTES] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m, MSG_BYTES);
+    shake256_inc_absorb(&state, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &state);
 
     return 0;
 }
@@ -68,27 +78,228 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     unsigned char jinvariant_[FP2_ENCODED_BYTES];
     unsigned char h_[MSG_BYTES];
     unsigned char c0_[CRYPTO_PUBLICKEYBYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES+MSG_BYTES];
+    unsigned char m_[MSG_BYTES];
+    shake256_inc_state state;
 
     // Decrypt
     EphemeralSecretAgreement_B(sk + MSG_BYTES, ct, jinvariant_);
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
+        m_[i] = ct[i + CRYPTO_PUBLICKEYBYTES] ^ h_[i];
     }
 
     // Generate ephemeralsk_ <- G(m||pk) mod oA
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
-    shake256(ephemeralsk_, SECRETKEY_A_BYTES, temp, CRYPTO_PUBLICKEYBYTES+MSG_BYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m_, MSG_BYTES);
+    shake256_inc_absorb(&state, &sk[MSG_BYTES + SECRETKEY_B_BYTES], CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ephemeralsk_, SECRETKEY_A_BYTES, &state);
     ephemeralsk_[SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     EphemeralKeyGeneration_A(ephemeralsk_, c0_);
     // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
     int8_t selector = ct_compare(c0_, ct, CRYPTO_PUBLICKEYBYTES);
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES+MSG_BYTES);
+    ct_cmov(m_, sk, MSG_BYTES, selector);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m_, MSG_BYTES);
+    shake256_inc_absorb(&state, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &state);
 
     return 0;
-}
\ No newline at end of file
+}
+
+static void shake256_batch(unsigned char** out, unsigned long long outlen, const unsigned char** in, unsigned long long inlen, 
+                           const unsigned char** in2, unsigned long long inlen2, const unsigned int n)
+{ // out[j] <- SHAKE256(in[j]||in2[j]) for j = 0..n-1, or SHAKE256(in[j]) if in2 = NULL. The inputs are absorbed in place
+  // Four at a time with the 4-way AVX2 SHAKE256 when it is enabled. Groups of two or three messages are padded by hashing 
+  // their last message again into the same output
+    shake256_inc_state state;
+    unsigned int j = 0;
+
+#if defined(_AVX2_KECCAK_)
+    shake256x4_inc_state state4;
+    unsigned int j2, j3;
+
+    if (__builtin_cpu_supports("avx2")) {
+        for (; j + 1 < n; j += 4) {
+            j2 = (j + 2 < n) ? j + 2 : n - 1;
+            j3 = (j + 3 < n) ? j + 3 : n - 1;
+            shake256x4_inc_init(&state4);
+            shake256x4_inc_absorb(&state4, in[j], in[j+1], in[j2], in[j3], inlen);
+            if (in2 != NULL) {
+                shake256x4_inc_absorb(&state4, in2[j], in2[j+1], in2[j2], in2[j3], inlen2);
+            }
+            shake256x4_inc_finalize(&state4);
+            shake256x4_inc_squeeze(out[j], out[j+1], out[j2], out[j3], outlen, &state4);
+        }
+    }
+#endif
+    for (; j < n; j++) {
+        shake256_inc_init(&state);
+        shake256_inc_absorb(&state, in[j], inlen);
+        if (in2 != NULL) {
+            shake256_inc_absorb(&state, in2[j], inlen2);
+        }
+        shake256_inc_finalize(&state);
+        shake256_inc_squeeze(out[j], outlen, &state);
+    }
+}
+
+
+int crypto_kem_keypair_batch(unsigned int n, unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation of n key pairs
+  // The public keys are computed in groups of INV_BATCH_SIZE, each group is normalized with a single inversion
+  // Outputs: n secret keys sk (n*CRYPTO_SECRETKEYBYTES bytes)
+  //          n public keys pk (n*CRYPTO_PUBLICKEYBYTES bytes)
+    const unsigned char* skB[INV_BATCH_SIZE];
+    unsigned char* pkB[INV_BATCH_SIZE];
+    unsigned int i, j, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < INV_BATCH_SIZE) ? n - i : INV_BATCH_SIZE;
+
+        // Generate lower portions of secret keys sk <- s||SK
+        for (j = 0; j < m; j++) {
+            randombytes(sk + (i+j)*CRYPTO_SECRETKEYBYTES, MSG_BYTES);
+            random_mod_order_B(sk + (i+j)*CRYPTO_SECRETKEYBYTES + MSG_BYTES);
+            skB[j] = sk + (i+j)*CRYPTO_SECRETKEYBYTES + MSG_BYTES;
+            pkB[j] = pk + (i+j)*CRYPTO_PUBLICKEYBYTES;
+        }
+
+        // Generate public keys pk
+        EphemeralKeyGeneration_B_batch(skB, pkB, m);
+
+        // Append public keys pk to secret keys sk
+        for (j = 0; j < m; j++) {
+            memcpy(&sk[(i+j)*CRYPTO_SECRETKEYBYTES + MSG_BYTES + SECRETKEY_B_BYTES], pkB[j], CRYPTO_PUBLICKEYBYTES);
+        }
+    }
+
+    return 0;
+}
+
+
+int crypto_kem_enc_batch(unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation under n public keys
+  // The encapsulations are processed in groups of INV_BATCH_SIZE, the ephemeral public keys of a group are computed with
+  // a single inversion and the hashes of a group are computed together
+  // Input:   n public keys pk          (n*CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes)
+  //          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes)
+    unsigned char ephemeralsk[INV_BATCH_SIZE][SECRETKEY_A_BYTES];
+    unsigned char jinvariant[INV_BATCH_SIZE][FP2_ENCODED_BYTES];
+    unsigned char h[INV_BATCH_SIZE][MSG_BYTES];
+    unsigned char msg[INV_BATCH_SIZE][MSG_BYTES];
+    const unsigned char *skA[INV_BATCH_SIZE], *pkB[INV_BATCH_SIZE], *in[INV_BATCH_SIZE], *in2[INV_BATCH_SIZE];
+    unsigned char *ctA[INV_BATCH_SIZE], *jA[INV_BATCH_SIZE], *out[INV_BATCH_SIZE];
+    unsigned int i, j, k, m;
+
+    for (k = 0; k < n; k += m) {
+        m = (n - k < INV_BATCH_SIZE) ? n - k : INV_BATCH_SIZE;
+
+        // Generate ephemeralsk <- G(m||pk) mod oA 
+        for (j = 0; j < m; j++) {
+            randombytes(msg[j], MSG_BYTES);
+            in[j] = msg[j];
+            in2[j] = pk + (k+j)*CRYPTO_PUBLICKEYBYTES;
+            out[j] = ephemeralsk[j];
+        }
+        shake256_batch(out, SECRETKEY_A_BYTES, in, MSG_BYTES, in2, CRYPTO_PUBLICKEYBYTES, m);
+        for (j = 0; j < m; j++) {
+            ephemeralsk[j][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+            skA[j] = ephemeralsk[j];
+            pkB[j] = pk + (k+j)*CRYPTO_PUBLICKEYBYTES;
+            ctA[j] = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            jA[j] = jinvariant[j];
+        }
+
+        // Encrypt
+        EphemeralKeyGeneration_A_batch(skA, ctA, m);
+        EphemeralSecretAgreement_A_batch(skA, pkB, jA, m);
+        for (j = 0; j < m; j++) {
+            in[j] = jinvariant[j];
+            out[j] = h[j];
+        }
+        shake256_batch(out, MSG_BYTES, in, FP2_ENCODED_BYTES, NULL, 0, m);
+        for (j = 0; j < m; j++) {
+            for (i = 0; i < MSG_BYTES; i++) {
+                ctA[j][i + CRYPTO_PUBLICKEYBYTES] = msg[j][i] ^ h[j][i];
+            }
+
+            // Generate shared secret ss <- H(m||ct)
+            in[j] = msg[j];
+            in2[j] = ctA[j];
+            out[j] = ss + (k+j)*CRYPTO_BYTES;
+        }
+        shake256_batch(out, CRYPTO_BYTES, in, MSG_BYTES, in2, CRYPTO_CIPHERTEXTBYTES, m);
+    }
+
+    return 0;
+}
+
+
+int crypto_kem_dec_batch(unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation of n ciphertexts under the same secret key
+  // The ciphertexts are processed in groups of INV_BATCH_SIZE, the j-invariants of a group are computed with a single
+  // inversion and so are the re-encrypted public keys. The hashes of a group are computed together. Implicit rejection 
+  // is decided for each ciphertext
+  // Input:   secret key sk             (CRYPTO_SECRETKEYBYTES bytes)
+  //          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes) 
+  // Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[INV_BATCH_SIZE][SECRETKEY_A_BYTES];
+    unsigned char jinvariant_[INV_BATCH_SIZE][FP2_ENCODED_BYTES];
+    unsigned char h_[INV_BATCH_SIZE][MSG_BYTES];
+    unsigned char c0_[INV_BATCH_SIZE][CRYPTO_PUBLICKEYBYTES];
+    unsigned char m_[INV_BATCH_SIZE][MSG_BYTES];
+    const unsigned char *pkA[INV_BATCH_SIZE], *skA[INV_BATCH_SIZE], *in[INV_BATCH_SIZE], *in2[INV_BATCH_SIZE];
+    unsigned char *jB[INV_BATCH_SIZE], *c0A[INV_BATCH_SIZE], *out[INV_BATCH_SIZE];
+    unsigned int i, j, k, m;
+
+    for (k = 0; k < n; k += m) {
+        m = (n - k < INV_BATCH_SIZE) ? n - k : INV_BATCH_SIZE;
+
+        // Decrypt
+        for (j = 0; j < m; j++) {
+            pkA[j] = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            jB[j] = jinvariant_[j];
+        }
+        EphemeralSecretAgreement_B_batch(sk + MSG_BYTES, pkA, jB, m);
+        for (j = 0; j < m; j++) {
+            in[j] = jinvariant_[j];
+            out[j] = h_[j];
+        }
+        shake256_batch(out, MSG_BYTES, in, FP2_ENCODED_BYTES, NULL, 0, m);
+        for (j = 0; j < m; j++) {
+            for (i = 0; i < MSG_BYTES; i++) {
+                m_[j][i] = pkA[j][i + CRYPTO_PUBLICKEYBYTES] ^ h_[j][i];
+            }
+
+            // Generate ephemeralsk_ <- G(m||pk) mod oA
+            in[j] = m_[j];
+            in2[j] = &sk[MSG_BYTES + SECRETKEY_B_BYTES];
+            out[j] = ephemeralsk_[j];
+        }
+        shake256_batch(out, SECRETKEY_A_BYTES, in, MSG_BYTES, in2, CRYPTO_PUBLICKEYBYTES, m);
+        for (j = 0; j < m; j++) {
+            ephemeralsk_[j][SECRETKEY_A_BYTES - 1] &= MASK_ALICE;
+            skA[j] = ephemeralsk_[j];
+            c0A[j] = c0_[j];
+        }
+
+        // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+        EphemeralKeyGeneration_A_batch(skA, c0A, m);
+        for (j = 0; j < m; j++) {
+            // If selector = 0 then do ss = H(m||ct), else if selector = -1 load s to do ss = H(s||ct)
+            int8_t selector = ct_compare(c0_[j], pkA[j], CRYPTO_PUBLICKEYBYTES);
+            ct_cmov(m_[j], sk, MSG_BYTES, selector);
+            in[j] = m_[j];
+            in2[j] = pkA[j];
+            out[j] = ss + (k+j)*CRYPTO_BYTES;
+        }
+        shake256_batch(out, CRYPTO_BYTES, in, MSG_BYTES, in2, CRYPTO_CIPHERTEXTBYTES, m);
+    }
+
+    return 0;
+}
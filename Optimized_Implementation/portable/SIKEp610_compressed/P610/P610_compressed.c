@@ -8,6 +8,9 @@
 #define COMPRESS
 #include "P610_internal.h"
 #include "../internal.h"
+#if defined(_RUNTIME_DISPATCH_)
+    #include "../fp_dispatch.h"
+#endif
 
 
 // Encoding of field elements, elements over Z_order, elements over GF(p^2) and elliptic curve points:
@@ -155,9 +158,13 @@ const uint64_t threeinv[NWORDS64_FIELD] = {
 0x5555555577AEEDA2,0x5555555555555555,0x5555555555555555,0x5555555555555555,0xDE11555555555555,0xC488963F0D7B28BF,0xAE18B2BDE10BF15E,0x463CB6074578F0A0,0x5BCDAB7A2CB98FBF,0x5831A321};
 
 // Fixed parameters for isogeny tree computation
+#ifdef _TUNED_STRATEGY_
+#include "P610_strategy_tables.c"
+#else
 const unsigned int strat_Alice[MAX_Alice-1] = { 67, 37, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 16, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 33, 16, 8, 5, 2, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 16, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
 
 const unsigned int strat_Bob[MAX_Bob-1] = { 86, 48, 27, 15, 8, 4, 2, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 38, 21, 12, 7, 4, 2, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 1, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 17, 9, 5, 3, 2, 1, 1, 1, 1, 2, 1, 1, 1, 4, 2, 1, 1, 1, 2, 1, 1, 8, 4, 2, 1, 1, 1, 2, 1, 1, 4, 2, 1, 1, 2, 1, 1 };
+#endif
 
 
 
@@ -346,6 +353,7 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fpinv_mont                    fpinv610_mont
 #define fpinv_chain_mont              fpinv610_chain_mont
 #define fpinv_mont_bingcd             fpinv610_mont_bingcd
+#define fpinv_mont_safegcd            fpinv610_mont_safegcd
 #define fp2copy                       fp2copy610
 #define fp2zero                       fp2zero610
 #define fp2add                        fp2add610
@@ -361,9 +369,19 @@ const uint64_t v_3_torsion[TABLE_V3_LEN][2 * NWORDS64_FIELD] =
 #define fp2inv_mont                   fp2inv610_mont
 #define fp2inv_mont_bingcd            fp2inv610_mont_bingcd
 #define fpequal_non_constant_time     fpequal610_non_constant_time
+#define eval_4_isog_x4                eval_4_isog610_x4
+#define eval_3_isog_x4                eval_3_isog610_x4
+#define eval_4_isog_x2                eval_4_isog610_x2
+#define eval_3_isog_x2                eval_3_isog610_x2
+#if defined(_RUNTIME_DISPATCH_)
+#define mp_add_asm                    fp_backend->mp_add
+#define mp_subaddx2_asm               fp_backend->mp_subaddx2
+#define mp_dblsubx2_asm               fp_backend->mp_dblsubx2
+#else
 #define mp_add_asm                    mp_add610_asm
 #define mp_subaddx2_asm               mp_subadd610x2_asm
 #define mp_dblsubx2_asm               mp_dblsub610x2_asm
+#endif
 
 
 
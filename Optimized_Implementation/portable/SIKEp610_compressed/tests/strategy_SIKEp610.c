@@ -0,0 +1,17 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: computing optimal strategies for the isogeny tree traversals of SIKEp610_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp610_compressed"
+#define fp2random_test    fp2random610_test
+
+
+#include "strategy.c"
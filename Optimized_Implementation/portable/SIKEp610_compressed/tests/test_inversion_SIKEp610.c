@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp610_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P610/P610_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp610_compressed"
+#define fprandom_test     fprandom610_test
+#define fp2random_test    fp2random610_test
+
+
+#include "test_inversion.c"
@@ -13,6 +13,19 @@
     #define BENCH_LOOPS       100
     #define TEST_LOOPS        10      
 #endif
+#define BATCH_TEST_SIZE       19      // Number of operations per batch test, two groups of eight and a remainder
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) 
+    #define BATCH_BENCH_SIZE   4      // Number of operations per batch bench
+    #define BATCH_BENCH_LOOPS  1      // Number of iterations per batch bench
+#else
+    #define BATCH_BENCH_SIZE  16
+    #define BATCH_BENCH_LOOPS  5
+#endif
+#if defined(OPTIMIZED_GENERIC_IMPLEMENTATION) || (TARGET == TARGET_ARM) 
+    #define BATCH_SIZES_MAX   16      // Largest batch in the batch size bench (make batch), batches of 1, 2, 4, ... operations are timed
+#else
+    #define BATCH_SIZES_MAX  256
+#endif
 
 
 int cryptotest_kem()
@@ -47,6 +60,57 @@ int cryptotest_kem()
     return PASSED;
 }
 
+int cryptotest_kem_batch()
+{ // Testing the batch KEM functions against the single-operation ones
+    unsigned int i, bad = 3;
+    static unsigned char sk[BATCH_TEST_SIZE*CRYPTO_SECRETKEYBYTES] = {0};
+    static unsigned char pk[BATCH_TEST_SIZE*CRYPTO_PUBLICKEYBYTES] = {0};
+    static unsigned char ct[BATCH_TEST_SIZE*CRYPTO_CIPHERTEXTBYTES] = {0};
+    static unsigned char ss[BATCH_TEST_SIZE*CRYPTO_BYTES] = {0};
+    static unsigned char ss_[BATCH_TEST_SIZE*CRYPTO_BYTES] = {0};
+    unsigned char ss_bad[CRYPTO_BYTES] = {0};
+    bool passed = true;
+
+    // Batch key generation and encapsulation, single decapsulations
+    crypto_kem_keypair_batch(BATCH_TEST_SIZE, pk, sk);
+    crypto_kem_enc_batch(BATCH_TEST_SIZE, ct, ss, pk);
+    for (i = 0; i < BATCH_TEST_SIZE; i++) {
+        crypto_kem_dec(ss_ + i*CRYPTO_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, sk + i*CRYPTO_SECRETKEYBYTES);
+    }
+    if (memcmp(ss, ss_, BATCH_TEST_SIZE*CRYPTO_BYTES) != 0) {
+        passed = false;
+    }
+
+    // Single encapsulations under one public key, batch decapsulation with one corrupted ciphertext
+    for (i = 0; i < BATCH_TEST_SIZE; i++) {
+        crypto_kem_enc(ct + i*CRYPTO_CIPHERTEXTBYTES, ss + i*CRYPTO_BYTES, pk);
+    }
+    ct[bad*CRYPTO_CIPHERTEXTBYTES + CRYPTO_CIPHERTEXTBYTES - 1] ^= 1;
+    crypto_kem_dec(ss_bad, ct + bad*CRYPTO_CIPHERTEXTBYTES, sk);
+    memcpy(ss + bad*CRYPTO_BYTES, ss_bad, CRYPTO_BYTES);
+    crypto_kem_dec_batch(BATCH_TEST_SIZE, ss_, ct, sk);
+    if (memcmp(ss, ss_, BATCH_TEST_SIZE*CRYPTO_BYTES) != 0) {
+        passed = false;
+    }
+
+    // Batch decapsulation with malformed ciphertexts, one zeroed and one all-ones, in different groups
+    memset(ct + bad*CRYPTO_CIPHERTEXTBYTES, 0x00, CRYPTO_CIPHERTEXTBYTES);
+    memset(ct + (BATCH_TEST_SIZE-1)*CRYPTO_CIPHERTEXTBYTES, 0xFF, CRYPTO_CIPHERTEXTBYTES);
+    for (i = 0; i < BATCH_TEST_SIZE; i++) {
+        crypto_kem_dec(ss + i*CRYPTO_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, sk);
+    }
+    crypto_kem_dec_batch(BATCH_TEST_SIZE, ss_, ct, sk);
+    if (memcmp(ss, ss_, BATCH_TEST_SIZE*CRYPTO_BYTES) != 0) {
+        passed = false;
+    }
+
+    if (passed == true) printf("  Batch KEM tests .............................................. PASSED");
+    else { printf("  Batch KEM tests ... FAILED"); printf("\n"); return FAILED; }
+    printf("\n"); 
+
+    return PASSED;
+}
+
 
 int cryptorun_kem()
 { // Benchmarking key exchange
@@ -92,10 +156,148 @@ int cryptorun_kem()
     return PASSED;
 }
 
+int cryptorun_kem_batch()
+{ // Benchmarking the batch KEM functions against the single-operation ones
+    unsigned int n, i;
+    static unsigned char sk[BATCH_BENCH_SIZE*CRYPTO_SECRETKEYBYTES] = {0};
+    static unsigned char pk[BATCH_BENCH_SIZE*CRYPTO_PUBLICKEYBYTES] = {0};
+    static unsigned char ct[BATCH_BENCH_SIZE*CRYPTO_CIPHERTEXTBYTES] = {0};
+    static unsigned char ss[BATCH_BENCH_SIZE*CRYPTO_BYTES] = {0};
+    unsigned long long cycles_single[3] = {0}, cycles_batch[3] = {0}, cycles1, cycles2;
+    const char* names[3] = { "Key generation", "Encapsulation ", "Decapsulation " };
+
+    printf("\n\nBENCHMARKING BATCHES OF %d OPERATIONS %s\n", BATCH_BENCH_SIZE, SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (n = 0; n < BATCH_BENCH_LOOPS; n++)
+    {
+        // Benchmarking single operations
+        cycles1 = cpucycles();
+        for (i = 0; i < BATCH_BENCH_SIZE; i++) {
+            crypto_kem_keypair(pk + i*CRYPTO_PUBLICKEYBYTES, sk + i*CRYPTO_SECRETKEYBYTES);
+        }
+        cycles2 = cpucycles();
+        cycles_single[0] = cycles_single[0]+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        for (i = 0; i < BATCH_BENCH_SIZE; i++) {
+            crypto_kem_enc(ct + i*CRYPTO_CIPHERTEXTBYTES, ss + i*CRYPTO_BYTES, pk);
+        }
+        cycles2 = cpucycles();
+        cycles_single[1] = cycles_single[1]+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        for (i = 0; i < BATCH_BENCH_SIZE; i++) {
+            crypto_kem_dec(ss + i*CRYPTO_BYTES, ct + i*CRYPTO_CIPHERTEXTBYTES, sk);
+        }
+        cycles2 = cpucycles();
+        cycles_single[2] = cycles_single[2]+(cycles2-cycles1);
+
+        // Benchmarking batches
+        cycles1 = cpucycles();
+        crypto_kem_keypair_batch(BATCH_BENCH_SIZE, pk, sk);
+        cycles2 = cpucycles();
+        cycles_batch[0] = cycles_batch[0]+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        crypto_kem_enc_batch(BATCH_BENCH_SIZE, ct, ss, pk);
+        cycles2 = cpucycles();
+        cycles_batch[1] = cycles_batch[1]+(cycles2-cycles1);
+
+        cycles1 = cpucycles();
+        crypto_kem_dec_batch(BATCH_BENCH_SIZE, ss, ct, sk);
+        cycles2 = cpucycles();
+        cycles_batch[2] = cycles_batch[2]+(cycles2-cycles1);
+    }
+
+    for (i = 0; i < 3; i++) {
+        printf("  %s runs in (single/batch, per operation) ........ %10lld / %10lld ", names[i], 
+               cycles_single[i]/(BATCH_BENCH_LOOPS*BATCH_BENCH_SIZE), cycles_batch[i]/(BATCH_BENCH_LOOPS*BATCH_BENCH_SIZE)); print_unit;
+        printf(", %.2fx throughput\n", (double)cycles_single[i]/(double)cycles_batch[i]);
+    }
+
+    return PASSED;
+}
+
+#if defined(BATCH_SIZES_BENCH) && !defined(COMPRESS)
+
+int cryptorun_kem_batch_sizes()
+{ // Benchmarking the batch key generation and decapsulation for growing batch sizes
+    unsigned int n, i;
+    static unsigned char sk[BATCH_SIZES_MAX*CRYPTO_SECRETKEYBYTES] = {0};
+    static unsigned char pk[BATCH_SIZES_MAX*CRYPTO_PUBLICKEYBYTES] = {0};
+    static unsigned char ct[BATCH_SIZES_MAX*CRYPTO_CIPHERTEXTBYTES] = {0};
+    static unsigned char ss[BATCH_SIZES_MAX*CRYPTO_BYTES] = {0};
+    static unsigned char ss_[BATCH_SIZES_MAX*CRYPTO_BYTES] = {0};
+    bool passed = true;
+    unsigned long long cycles_keygen = 0, cycles_decaps = 0, cycles_batch, cycles1, cycles2;
+
+    printf("\n\nBENCHMARKING BATCH KEY GENERATION AND DECAPSULATION %s\n", SCHEME_NAME);
+    printf("--------------------------------------------------------------------------------------------------------\n\n");
+
+    for (i = 0; i < BATCH_BENCH_SIZE; i++) {
+        cycles1 = cpucycles();
+        crypto_kem_keypair(pk, sk);
+        cycles2 = cpucycles();
+        cycles_keygen = cycles_keygen+(cycles2-cycles1);
+    }
+    cycles_keygen = cycles_keygen/BATCH_BENCH_SIZE;
+    printf("  Single key generation runs in ................................ %10lld ", cycles_keygen); print_unit;
+    printf("\n");
+
+    for (n = 1; n <= BATCH_SIZES_MAX; n *= 2) {
+        cycles1 = cpucycles();
+        crypto_kem_keypair_batch(n, pk, sk);
+        cycles2 = cpucycles();
+        cycles_batch = (cycles2-cycles1)/n;
+        printf("  Batch of %3d keys runs in (per key) .......................... %10lld ", n, cycles_batch); print_unit;
+        printf(", %.3fx throughput\n", (double)cycles_keygen/(double)cycles_batch);
+    }
+
+    for (i = 0; i < BATCH_SIZES_MAX; i++) {                // Every ciphertext is under the first public key
+        crypto_kem_enc(ct + i*CRYPTO_CIPHERTEXTBYTES, ss + i*CRYPTO_BYTES, pk);
+    }
+    for (i = 0; i < BATCH_BENCH_SIZE; i++) {
+        cycles1 = cpucycles();
+        crypto_kem_dec(ss_, ct + i*CRYPTO_CIPHERTEXTBYTES, sk);
+        cycles2 = cpucycles();
+        cycles_decaps = cycles_decaps+(cycles2-cycles1);
+    }
+    cycles_decaps = cycles_decaps/BATCH_BENCH_SIZE;
+    printf("\n  Single decapsulation runs in ................................. %10lld ", cycles_decaps); print_unit;
+    printf("\n");
+
+    for (n = 1; n <= BATCH_SIZES_MAX; n *= 2) {
+        cycles1 = cpucycles();
+        crypto_kem_dec_batch(n, ss_, ct, sk);
+        cycles2 = cpucycles();
+        if (memcmp(ss, ss_, n*CRYPTO_BYTES) != 0) {
+            passed = false;
+        }
+        cycles_batch = (cycles2-cycles1)/n;
+        printf("  Batch of %3d ciphertexts runs in (per ciphertext) ............ %10lld ", n, cycles_batch); print_unit;
+        printf(", %.3fx throughput\n", (double)cycles_decaps/(double)cycles_batch);
+    }
+
+    if (passed == false) { printf("\n  Batch decapsulation ... FAILED\n"); return FAILED; }
+
+    return PASSED;
+}
+
+#endif
+
 
 int main()
 {
     int Status = PASSED;
+
+#if defined(BATCH_SIZES_BENCH) && !defined(COMPRESS)
+    Status = cryptorun_kem_batch_sizes();  // Benchmark batch key generation and decapsulation (make batch)
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+    }
+    return Status;
+#endif
     
     Status = cryptotest_kem();             // Test key encapsulation mechanism
     if (Status != PASSED) {
@@ -103,11 +305,23 @@ int main()
         return FAILED;
     }
 
+    Status = cryptotest_kem_batch();       // Test batch key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
     Status = cryptorun_kem();              // Benchmark key encapsulation mechanism
     if (Status != PASSED) {
         printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
         return FAILED;
     }
 
+    Status = cryptorun_kem_batch();        // Benchmark batch key encapsulation mechanism
+    if (Status != PASSED) {
+        printf("\n\n   Error detected: KEM_ERROR_SHARED_KEY \n\n");
+        return FAILED;
+    }
+
     return Status;
 }
\ No newline at end of file
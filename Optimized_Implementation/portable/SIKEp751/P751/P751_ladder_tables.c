@@ -0,0 +1,4512 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: precomputed tables for the fixed-base three-point ladder on E0 for P751
+*********************************************************************************************/  
+
+
+// x(2^i*QA) for i = 0..OALICE_BITS-1, where QA is Alice's fixed generator, expressed in Montgomery representation.
+const uint64_t Alice_ladder[OALICE_BITS*2*NWORDS64_FIELD] = { 
+0x0F93CC38680A8CA9, 0x762E733822E7FED7, 0xE549F005AC0ADB67, 0x94A71FDD2C43A4ED,
+0xD48645C2B04721C5, 0x432DA1FE4D4CA4DC, 0xBC99655FAA7A80E8, 0xB2C6D502BCFD4823,
+0xEE92F40CA2EC8BDB, 0x7B074132EFB6D16C, 0x3340B46FA38A7633, 0x0000215749657F6C,
+0xECFF375BF3079F4C, 0xFBFE74B043E80EF3, 0x17376CBE3C5C7AD1, 0xC06327A7E29CDBF2,
+0x2111649C438BF3D4, 0xC1F9298261BA2E97, 0x1F9FECE869CFD1C2, 0x01A39B4FC9346D62,
+0x147CD1D3E82A3C9F, 0xDE84E9D249E533EE, 0x1C48A5ADFB7C578D, 0x000061ACA0B82E1D,
+0xE66E0241C9E945F4, 0xD287EA884AB5DC85, 0x909C028946E3D6E8, 0x165C6A1B8106BAA3,
+0x5BEB1AD5377A42F1, 0xDC800AD913461271, 0x0DFC2D120299417D, 0xA60F1618CA0CA576,
+0x19D06C041D575885, 0xCDA843BFCCB0962D, 0xA2C28022617A51BA, 0x0000678343173BD1,
+0x77D24C8509ECD14D, 0x01DAAFF8B38B3BF5, 0xD4B14E7A680960C3, 0xC526E806404E8647,
+0xE0CF93B6EA5131D8, 0x6939C20FF8B93274, 0x415D5DA0173B391A, 0xA21F747DD2388457,
+0x5C319413B1134F6F, 0x43DEB2F13C983FF5, 0x17235B9E786A2978, 0x000011314DE722FE,
+0x6F8A18B4B3C5BB68, 0x29898B23742D7794, 0x27D7C9D972EA4A60, 0x7F1D866E7A173C3C,
+0x7117E9A7050FED14, 0x39DEC890C822FDFE, 0x20D8D058DC62B59C, 0xA5C3CA7D18BB279E,
+0x2FB31171FD38B07A, 0x3061B7251F09E27F, 0xDA70B1C6B298486B, 0x00006C23CCC65DB7,
+0x9ECA2486818A03C5, 0x63F1B978CE094FBF, 0x2230CAF36FB9A9AA, 0x3B691AF4FBC48230,
+0x0763410CF82F4E90, 0xCD7564B6616A5064, 0xB83A4DB841C3E819, 0x74FF2DFEF0EDEB30,
+0x08DE8BEF22BBE1B0, 0x47424A79C5034467, 0xAAA517E6329EC124, 0x00001281123280FE,
+0xEEE7BF29AD6415E7, 0x7F1F0ABEAA7655FE, 0x78A6A4CB70CEB8FF, 0xB39918369653093E,
+0xB9D6BFE35EAF19E3, 0x211596EAC5AE8ADE, 0x60514D1A447B94C6, 0x133FB305D0A36837,
+0x55A1823FFE3EB50E, 0x1ECF1FF37CDB669D, 0x4469702FB6D3B6E3, 0x00001999F74EE3CE,
+0x9ECD7BCC818183ED, 0x5FEC71E935A5CE8B, 0x27FBC3374EBBD9A1, 0x97E2358E830F33B4,
+0x28A1BE8937B4374D, 0x0D0725B5FCE5A791, 0xF473EEBD0ADC19B7, 0xFFFFD30556A05256,
+0xA2183880CD06F8E7, 0x2164C98C50F5F5E7, 0x216DEBC95FF63B6C, 0x0000170810DEF0B0,
+0x844AFA729D685EB2, 0xA86902D79F764849, 0xC860F1FA6672E182, 0xADD2CE1A972B2100,
+0xF66CF294C3BC33DC, 0x40EC4A36A5CCB2F2, 0xDE0352965F6A89FC, 0xE72D1749BB9CBBB5,
+0x1F5EA00C05F7DA77, 0xCE6A6BDE43E7A7BD, 0xC0C993A7410A08E9, 0x000036CA58356C13,
+0x94AEAB78DD263ED0, 0xEE4DBFBDCF3B19E0, 0x514C75AE9B7CB290, 0xF413D3F94A08C546,
+0x30995553EF15F391, 0xB5965E1EC5D108DB, 0xF2F7839182B13C61, 0x4833DB250797C9C8,
+0x003AFEC6E6F6D966, 0xEC5F51DD86F27D1C, 0xD9066485DB28B57F, 0x000061C606F56272,
+0x8F4EDD7736563552, 0x9E87BB42D175C910, 0x748D40EA21D046BB, 0x341A0FE338C8963D,
+0x73553F808050FA4A, 0x64E76ACDB9E443A4, 0xD0F17DF006C01F54, 0x312DA7C74241D713,
+0x8234AFF23D15F311, 0x2486181F93113BED, 0xE15E9A18CF4AFA83, 0x00005C78FD9B5A7F,
+0x3BF13A492AD883E4, 0xB037674E498393E8, 0x3B05ECA46E4F3A97, 0xA285ACCBD25DF6DE,
+0xF9BBE62923A5BBB8, 0x2A768CFE693CB4E8, 0xF41CE9942335A40A, 0xD282B0EB35C4F61C,
+0x5473A01595B49390, 0x9D9505BFE764B496, 0xE603C6238C3F2237, 0x00004B4C80072984,
+0x0A273E5085F88B3D, 0x0F9923818D421680, 0x8317645934E17EA7, 0x10AC21F2228BD658,
+0x956D6652CFF134DD, 0xC8B72BC7EAE73F22, 0x9EB05FD8B2A60C51, 0x2D1C53B0B8C931AF,
+0xB8C25FD7FE1DDC5D, 0x28E529A5FBDC24A1, 0x27380668A90D1F6D, 0x000002AE1A41FF2B,
+0x9321E49974A19B41, 0x1EEF245423E094DA, 0x16A79B4C9F45B96E, 0xD0565E521512BE45,
+0xBFA7ACDF0BADFF27, 0xDCA1560E6F6C8CD4, 0xB791FECB8C1DF2CD, 0x3CFFDE8B77969C86,
+0x0B5DDD543FF49771, 0x3285852F53DE83E6, 0xEE8FB9493F4A19E7, 0x00004DF51C1CF270,
+0x44A50015A4BD1D5D, 0xA45A85BF7F102439, 0x9D26A8AA963318F0, 0xC9643CBAA529536C,
+0xA2D640E20BFD4CFB, 0xC91E063F99C432C2, 0xB5E05D11F82D36B9, 0x5761887D34A51FE6,
+0x806964E51B95B92D, 0xC22FF20DC82B18DD, 0xB4C408A98025D6EC, 0x00002AFBBC6B69FC,
+0xC5776299D695A17C, 0x3B71653CAE5F3852, 0x3C90698831274D0E, 0xD8AD6B5483BF9C73,
+0x8233B29FDA0C2379, 0xB6FD08DCC4151187, 0x2376F0D046C5BB4A, 0x55ADD80137892C23,
+0x096D4C9902E3DBED, 0xDED170226F651B9D, 0x304F5F52F85D6516, 0x0000326A97C97A7D,
+0x8D79B0CAB568A377, 0xE4209562B4E6A555, 0xADA5EE20F89CEB4F, 0xC745843646519E17,
+0x7F758A35831A96B7, 0x3E3573A5C29AA8A0, 0x523349940497A871, 0x09B3DA6EB232ABE4,
+0x40755479FCB80866, 0xA2D99B0B3571D764, 0xB5798C144AA3FDFA, 0x000019C6948C2787,
+0xBFE322FA9E01CD63, 0xDDB5C39B63920816, 0x501926E17823A02D, 0xC3779D37D86DF11C,
+0xA15A6C46D7B5191B, 0x5C7BA4BA8AEEB466, 0xF9963B278A41F410, 0x25C45AA2F3B25160,
+0x1284B684C7D279C0, 0x47FA04F58D12F196, 0x83B9CC69BB4E9709, 0x0000152B29B03C46,
+0x57B92584A82A305E, 0x3E701CC2898D1009, 0x6B3B4DBE87057B35, 0x595BFBCCA9888030,
+0xF7D93B272149D4E4, 0x89ABF138BF31F5F6, 0xC056369EA191A717, 0xF27496F1852E8101,
+0x272EDC51FE985EBE, 0x4FDFABE95F1DC90E, 0xF4420DDA6D8E31B2, 0x00000A0938669103,
+0xF6E0FC7EDC0B966A, 0xBA318E4144AD162E, 0xE03C2E7ADF1AECF0, 0x18A6D37DCBE40834,
+0x9D46AD779D61529E, 0xFBA98A79E2B1BC5D, 0x2DB1A5DAC126EAA4, 0x1306E002CE25D8BB,
+0x5C74301FA308BA30, 0x02773780DF6CA0BF, 0x3FEDF501DEA5D61F, 0x000069ED2B584AFD,
+0xB050221E64BFF546, 0xBE8FBE33D7322AB0, 0x4A7FFC9DCDF00480, 0x8B2C6567B2B05A7B,
+0xF413746D7CB4BF2D, 0x4B630B85515AE28E, 0x87B117BFFEBF6283, 0xEF43842EA0A03414,
+0x48248C349448F6B5, 0x84D8C6B6C119ADC9, 0xB274E25F9542D481, 0x00004E4EC7E2F6E7,
+0x18845F0C60FC6D5D, 0x8873BD9C18B9E7A5, 0xAFA6ABC9827B1013, 0xB3427A452C83B154,
+0xC80704A43F7FFBC5, 0x1F6A4D036CABCF32, 0xA35DB7F4326E4FE8, 0x5C25C2FA749AE760,
+0x0734EA1E6A1A5829, 0x9A0E617717CE4CE2, 0xF0A7332C7E2197A5, 0x00005EA3E420C3F3,
+0x089EEBBD1DE0637C, 0x1540DFADFDB6CB5B, 0x0A3060F7CEECB896, 0xBC59030EC8B95325,
+0x1B57DDD04FB8BAA7, 0x454E2D2DDC226615, 0x9855B6501A7E2B6E, 0xE0A9A9023989BD40,
+0xC1038FB6BBD3CE6B, 0x85BB83461CBDAF80, 0x95B63937D299A4B0, 0x0000352F41CC3589,
+0xAC1462F0C5286334, 0xE2CDFBD1AD6881D4, 0x5CE35E35764912B8, 0x9FF40D4AA0496371,
+0x4FF2F2A736E4BA8F, 0x52C2E816BB8981E6, 0xA2C5A89D4CC32413, 0x9B400AE64795186E,
+0xDE252F9083A51EF0, 0x289F872166E5661D, 0xF2F5E162BC365801, 0x0000003F23445983,
+0xA6C5C60EB963E95F, 0x011143291BA4F91C, 0x6BF9D701D20A7163, 0xF31C6F77392300E2,
+0x1C48957AF3E91AFF, 0x04E52AEE3B58E7C6, 0xC707894AE36B0349, 0x7AFFA0C2C8308255,
+0xEECA13CA0ADC2D79, 0xFDE09571B8A8C1B1, 0x768236DB7B3907A8, 0x00004472FD24BF25,
+0x6E7B358E8FEB03D5, 0x50CD85F0409474F7, 0xEFBF65D6EE29F99E, 0x83634FCF20B53844,
+0xEF12842CF1032789, 0x93B638C2BF48F336, 0xF109D943B4F5C10B, 0xF74AA3FCC8EA4D30,
+0xBBB88BE72366BCC4, 0x1ED581B3C400FEF5, 0x3EACCF4B2BB0A421, 0x00006897167838DF,
+0xAD253E07E7AF3C22, 0x5939CC2B4F8AFAAA, 0xD72358E8D9E82969, 0x530ED3300CA9FE88,
+0x81470256E9202716, 0x9601699BF6FB39FD, 0x6885EDE1E1C97D88, 0x7495D880E134E7F9,
+0xDF75D14128514718, 0xE7558694F108E49E, 0x4EF18D7B00D72968, 0x000055039E8EED47,
+0x1C936ADE134C86D1, 0x9E71BEB3FDFBDDF1, 0xE2D73677FEFA8C79, 0xCC5116900D89AC56,
+0x1025616DF0FD225A, 0x6D7277883EFB282D, 0x96A8170598EF3527, 0xA586BAB4EF955349,
+0x3946D844EE49793F, 0xAF67BAAB5CD02076, 0x16F64DD5112DD46A, 0x00002EDE8B197295,
+0x3418296FD213E0E7, 0xCBEE897608CCB832, 0x22306ADCE569A153, 0xECD8F6BB91F01E68,
+0x1B9D6C01D9F1A413, 0xFDF98375BC16EE02, 0xDAC16FCFE913A8DF, 0xB1DC3706E959CB7A,
+0x42EAA014E15C36C3, 0x2934390E08EA1978, 0xA6C168DB25EAEB30, 0x00002118B99FE35B,
+0x3D39B574D4DF3182, 0x1A37C297736181E4, 0xFD644A81DE386A8A, 0x6BEB42C8988A58F3,
+0x0BA1ADE6765713A8, 0x3CECE3341E436FE6, 0x52DEAC99D941359C, 0x1151485C13B1409C,
+0xEA2387C30A034B2B, 0xEE9632BEE0F590D6, 0x68ECADD20A27C594, 0x000068F6F655E5CB,
+0xC94382F659C1E590, 0xAE27B021A1CCB0A2, 0x50D384549C8ECF66, 0x9E06CB022C607132,
+0x88F8926A16309A85, 0x2E592244EB6ED06C, 0x575A6B358F38EC3E, 0x6556A5D1F4A9CDB2,
+0xA288BD76B7C0F437, 0x134E81DCED0B536A, 0x933685C880E0FCFC, 0x00004F39C6B18419,
+0x35051EA352E4B008, 0xB464DE9328ABC196, 0x91EAF0D2D6E7A5F5, 0x9DAE06D01F7CF851,
+0x192235052B8C649B, 0x77DD407FF9AEF20D, 0xAB735158B23E300E, 0x307B8AB9B5830A40,
+0x64A06F3981C144DA, 0x3464D2D6A566DE98, 0x4234E49E74BB1D9E, 0x00004C82F35775F3,
+0xF0FDB34D90DB4C17, 0x44EFDA6C5AC75910, 0xEF2B0A33449B3C31, 0xEC04C6056A208E47,
+0xC312288C5D8B7345, 0x620387BA2876B585, 0xFC6E675755516FD2, 0x8BA963CE2B67D583,
+0x4945C3BDA7BFBF6F, 0x3CAB39C697D8B9A7, 0x0EA80EE83C24B18F, 0x00002749E86597FA,
+0x6CC77EF964355F53, 0x968BB1A0D1F35625, 0x1C06E1CA56AD7972, 0xD7396CA053925671,
+0x0430E925517C8F2C, 0x9C10DCD9B4D97ECE, 0xFFF7083776F3DF18, 0x5D692EAF7B712351,
+0x56EF163470FFD075, 0x3B74483A7A367EA8, 0xD8A224077917B713, 0x000054CBFDD360CC,
+0xC7858C4DE1E5633A, 0xD64CB8D8DDF529A4, 0x2440F11D7F4EC7F0, 0x51706BC9F4362987,
+0xC47B2A4EA8C5634F, 0x89D903DB49CD3590, 0x900D147E5E38DDAB, 0x26937CB16847B2FB,
+0x07AF297419EF9250, 0x4E1C8312C3B9229C, 0x56E0C5CD4ED28455, 0x00000930E721FA59,
+0x343F6E14795EC178, 0x0CE458F57B9BD541, 0x42A10F7F11A07327, 0xF79DA4C05720CAE7,
+0x76458B9F303C0298, 0xDA0D2947F071D826, 0x32195EE7EB9DF932, 0x857FDC7E67F81F03,
+0x17AEC7336684390E, 0xED66BE9A8556B7D7, 0x2521637B11801C5E, 0x00000D96618F244A,
+0x7E8E27C7AAA4C948, 0x028001E6585FB472, 0x465A255C7847C0C6, 0x08324EE538880F8A,
+0xEEF9E0C7DB87B00F, 0xA32D6CA98CC4BDF2, 0x999D41EC6E0BDB7A, 0xDDE073FD395FAA7C,
+0x230035BE74EF41C7, 0xCD483752ABDF0E53, 0x8F8C355116952D10, 0x0000691BCA1B1240,
+0x5652D51D619AE604, 0x42E0789BAB95F437, 0x557F1A407D49E0F9, 0x49C91B88F8834BE7,
+0x1337D0C431071B36, 0x406CB7B9E0BCC649, 0x69A463D98EEFD985, 0xA408A5DB79FCD009,
+0x24798F6429DC81C9, 0x449961493C7C9E9E, 0xC32D03CF289261B8, 0x00001E455A6A8BFC,
+0x8D77D7946FD57D18, 0x3454789CA3F93614, 0x7282CF68DD3DD2DE, 0xA6ECC5917D48659B,
+0x90383DBB5EC57AA9, 0x6342EBEA923B2896, 0xE1001C1C37795111, 0xA30B61A005AB198A,
+0x3AE70638C7E32882, 0xB54E46C19443BF96, 0xC14DE7992BEBE136, 0x0000487F7BCAA911,
+0x8A02BB77DC69A87C, 0xC96141825AFDBED7, 0x42CBB7FD64DC3B11, 0x32612C943D3A2B50,
+0x415D3B48D1A74B60, 0xB6E0AB273E1AB9D4, 0x2B43E80AA8B2825A, 0x1D363F317DCF059A,
+0x36058B4AC8B26A0F, 0xD1B6CDBB278B186D, 0x03E2E569E0797012, 0x00002E1448356AC2,
+0x6795AC2259E21E01, 0x9943DF87809388B3, 0x0DF34280DAE1F6F0, 0x5A4B723786C00DE5,
+0xC07EC224E0EAE6BD, 0x728B9F194B61FD2E, 0xE4A4C06FCE18BFBE, 0xCF10A582BC57667A,
+0xEE42CAF43F3E504A, 0x537AFC6F5463091F, 0xFA110320B2E19641, 0x00001757EE928338,
+0x0874F70CCED8F9C4, 0xE0683220FEFEF95C, 0x1593261C3A197881, 0x85A90A5244DA59EF,
+0xD25286E5B8AE62F5, 0xA2C09F9F007747D2, 0x147370EB10CA5950, 0x51FBFC542E1CBC71,
+0xB9B6946B0EFEA2C2, 0xFAFF7C3534D99FE7, 0x17F3CAB799AEEEF2, 0x00000A8D0EAF0FB1,
+0xCE60CD67F9976189, 0xAA3E55B7CBBD2A68, 0x997702EC1AA8DB88, 0xBFB6017A305A10E3,
+0x77A0E8779059868E, 0x8004C81E489D5BE4, 0xD59C6E1769A66540, 0xD69A77CFB9EC6CCD,
+0x60211C50B613C901, 0xA584C09234F5D992, 0x3C21DF84DA0A177D, 0x0000099FFAAD0DFA,
+0xA208994860746CDC, 0x8C5AB038825D8498, 0x4CF283187155F83C, 0xCFA8EC1FAA33E32E,
+0x3E72C7CE8F97AF3F, 0xB8E395096641934A, 0x2EDEC2AFFCFAF220, 0xA92EF2C423A8CD51,
+0xF3098FC9F2118099, 0xE334BD1B853D78F7, 0xB27326FEF56BCA32, 0x000006282EBA974F,
+0xB115681AA6E3D2AD, 0xA757EFD3A5DCB51B, 0xECC821F6C6CB95C1, 0x73B1F1F7B2802887,
+0xBC8EE4277C251D91, 0x6B4F7A0BDCB4B434, 0x4DD6E857B7229B8B, 0x214FFF20B12EFF80,
+0x8C89CD9F4A629A87, 0x932605CA6743A3E6, 0x85ED9CE7BF52DD5B, 0x00006EA8D5C24464,
+0x1E729A177D3B30E0, 0x3EDD24503CD1252B, 0x1D9AA0FE4E4F9503, 0x97601DA3D5757CAF,
+0x6FC8D992719F2E18, 0x7681A56B037A20A4, 0x16C8867A5B0EAB69, 0xFF7361F0527CE617,
+0x8DC65FFABE40961B, 0x36B3D98AB6405562, 0x2E0B191E3EA964D3, 0x00003F76574250D5,
+0x8F1AC3E7063D4DDB, 0xFF8454B08C92190C, 0x7B6A9630FCAC445D, 0x793CF2B5DFA1705E,
+0x51F716A16D46AC7A, 0x59D881E114208264, 0x0AA096B679FBAA73, 0xA5033FC71FD76B2B,
+0x93996D5B3CA73AAA, 0x1A2F026D5A249F74, 0x77A2E4F676691E95, 0x000030CD96E23E2E,
+0xD23A233B33F92E9A, 0xBE3CDBF548A30896, 0x924578BD5E02E445, 0x2A20F8C8B6360A53,
+0x79CEDA8700F27056, 0x31460452BB7194FB, 0xC98FC1F53784C943, 0x3897D1BD29760CE2,
+0x7F58CD6F16109335, 0x90EEE79573AEB8A4, 0x7063DE68A9A940D3, 0x00001E597E8C4C00,
+0xB2B6A10DB310B61D, 0x6C96D80CA5BAB5A2, 0x5E232FE405C3523A, 0x44C123A200237B86,
+0x09975E7399D734A5, 0x3CB23FC26BC7F3E8, 0x5AC4D6EA34598C27, 0x55DA95CEE3487BCB,
+0xD465803B878A45D5, 0xB8A8D8E0B6AE6DB7, 0xCF66E7EC763DAF68, 0x00000AF95C175F5C,
+0xA57CF0CA7BF8D11E, 0xE2BA481715BC362E, 0x2E7BB39699165D1C, 0xED56150320DBADBE,
+0x2107655849CB58A5, 0x6D373E8CC63E4D21, 0xCC231F00FF5E8FF2, 0x8F41F075C104B261,
+0xBC24AD8A339DCD21, 0xD979AAB5C1C47CF4, 0x40570EB4B36D8222, 0x000022EDE533D71F,
+0xEA812E20D915BCD9, 0xACCE6637700802C7, 0xE62BDDCEDE684062, 0x2E79D9C09A75AEFD,
+0xBDB207880621BF8D, 0xD735CB5C7085F0DA, 0x00807820BF9EE657, 0xE402BB147CD89560,
+0xDE4ED645DC60AF47, 0x4BE49DB11112827E, 0x45DF32591B81679E, 0x00002EE0D0D42E5E,
+0xB9D9D512D30AA936, 0x2D6F3FCD3305AA54, 0x4848F998F8FBA862, 0xC6D8E5B769856DC4,
+0x0DA3FE9CF47E9E89, 0x2286ED4C305607CE, 0x3CF4AA98C44995FB, 0xD18A008F61BB86D1,
+0xF49FC55F87B07D2C, 0x2705C7CB15BF8DFA, 0x7B0F640F020EFBD4, 0x0000627DCFFA4A40,
+0x262D03DBDB10EEB9, 0x0C8B6EA69B982163, 0xE4119FD9420E7D54, 0xA0B8561ACC70634E,
+0xD593F7B981E78AEB, 0x293D92AE77D123B0, 0x73CD65BF09D5C0A9, 0x4AB0A4D9C24ECAD3,
+0x92CAF1635AB1CFB7, 0x007A862437DBD59E, 0xDC980A71E6E4A911, 0x00002D3F3282527C,
+0x1F4507D54475F53E, 0xE184A94420C3D9B0, 0x6D6F04CE02A38449, 0x6094B8CA198DE8BA,
+0xD98DD2DBE74856A6, 0xC6B8912BA0F276FA, 0xDA77E20F75BE4B39, 0x88AEA9924BC928E4,
+0xE25ED3E8F641499C, 0x68ABEEE05E9DA3FF, 0x63DA5AB4CDE1FE40, 0x00005364261E3979,
+0x3F9AC51395A3780D, 0xD887F2111E539FF9, 0x5F00BC2C380020D6, 0x6278C0C8F747F127,
+0xDA3754D0A9E118CB, 0x618CCABB040B9BF4, 0x02E7001B7BA09C38, 0xD90078CE57BF3707,
+0x860CA34B4947EB80, 0x277ED40B8A7A1110, 0xB37037613346C3A9, 0x000012231AB4D813,
+0x757183E6F97D206E, 0xA76F1FE303DFA337, 0x5311F1E27D6B43B2, 0x428FF3AAEE3C3651,
+0x1D9518DA5D042ECE, 0x278772342E6614B6, 0xF076F95B254C3990, 0x57239F1A80878A9F,
+0x1B10F5CAE8CB7E9A, 0xA0A7057585BB6BE2, 0xEF259693C80A89A8, 0x00002CBCD02E5F91,
+0xCE9BB4DAF0A3C252, 0xEDD050CFEDABBAF1, 0x592B967C0575F150, 0x60AA3DDACFF859D1,
+0xEC41A557F4875036, 0x87BD4A2ACB18473C, 0x5A49E4CA4768C8BF, 0xD8F67A34C150C9DB,
+0x5A450966B8FA0B22, 0xEC3ED24762A38E47, 0x87CCF0931BFA76E1, 0x00000287420F4243,
+0xDFF69584CE15D792, 0x2DC9EE9B4EFB7DAF, 0x3AD8293A771041DF, 0xFE43CFA5C5288578,
+0x15EB6AD6B4B32EB1, 0x06F3BB0BD7386B2D, 0xCEDED154D9219FAA, 0xCB65DB56FCD252B6,
+0x06505DE41C735263, 0x7340F4E7133EBABF, 0xBAC52D3B5E22933D, 0x000033D7A0E77E75,
+0xBBFE9748BECE62BE, 0x2FA5625AC80BB6B4, 0x768ED46D1DC90A59, 0xE0EF11AF76886F68,
+0x7EC36022E1E6E5AC, 0x8CEEB914AFE442D0, 0xB4B1126BD8E0B7FC, 0x77391B3FEFF3CBC0,
+0x8DC3E4736E09C785, 0xB3A911FF711E0C8F, 0x366EC2D59BB36506, 0x000046C995B6AE46,
+0x0C6A609BB8136CB8, 0x88A36667280E4C0A, 0xA24C65EB901D2D7C, 0xC704E605DE38A19F,
+0xB3B5D6B7C0B6F9E1, 0x064FBD60D65606D6, 0xECD5643DF89D75E2, 0xAF7B763EE3B13659,
+0x0C0C2DC8AC05717B, 0x5217EDE40F9F6620, 0x729B9E71CB657E03, 0x000031C7F6F07934,
+0xB6979678B6124623, 0x3B652C33376BC911, 0xBF70C25822A75390, 0x107E04ABD78A41FD,
+0x19710C3EB4432D66, 0x4994D5893A8FD4C4, 0xEBDC99790B0E0E9E, 0xC3140E4E2CD28EA0,
+0x6431B63361C94AAD, 0x10AB4BB0B0EAE914, 0xD601E68879BF7895, 0x00002FFDAE21308E,
+0xCABC7C4F93C68CB5, 0x1BB6F6A54C900ACE, 0x382564D063FBF126, 0x41ACEF32F006D33F,
+0xBC37030A4C9A4C2F, 0x1FD3F735752524EF, 0x2CDD0B679CB16CA0, 0x364CAAB2263A0BDF,
+0x2B5B316F9D210520, 0xE73D913BAD0FA960, 0x09B4D91D8762B8AB, 0x0000367142F4A257,
+0xC8B66805FD753706, 0x2A225725322E1035, 0x037BCE3C07C6651C, 0x664AA64D5773A8A2,
+0xCBE0CE322FE8A32E, 0x4995415AE257B554, 0xC5A6137D68EABF92, 0x04F9B72DD836AC31,
+0x5A17303D6852E38A, 0x8F0A9DA766519C3D, 0xDB2C625D66C97402, 0x0000170E961775AA,
+0xA1A704560CAD77D2, 0x153722DFCDDC3498, 0x6AF26141E9A8A3C1, 0x976BF8B26AC3E45B,
+0x09E936701DA86002, 0xB92A57C2924AEBD0, 0x8727040F6FD39504, 0xDED15D8F0A5AACFD,
+0x1A000D0316C8DFE6, 0x57F2679F7698140B, 0x99EFB13A39CF8DC1, 0x00001F0312B9F0C0,
+0x18D1600090153719, 0x06883DB38AD8FDB5, 0x576FD5CC84434B43, 0x27B70D2EEDEF18C9,
+0xBC1A024511240742, 0xD8F88B89A6535D0D, 0xA0360E1713EEB9A7, 0x27766C62405062D0,
+0xA07B495FBC3C0B90, 0x10EFB2B357980A44, 0x3C7FBE0C2E845E35, 0x0000506C95FF6E5F,
+0xA326A72A83DF587F, 0xDBD99D4264970024, 0xC659D1EC5CC0F9E7, 0x26301818E6CA0158,
+0xBE7BD3A70D6CE15D, 0x5A3EEC6CF218E8AF, 0x1AD90A073BA13F9E, 0xE7B28E7E6B9664E5,
+0x8C2FAB7AFE8237D9, 0xCDAB2F8B40EBD3AB, 0x09D7EDCCFBEB5815, 0x00005B4DF373EB23,
+0x2C990D9ECA58A3D2, 0x3061864A8519D4FC, 0xFAA7BAADE1E147EB, 0x03660B37F939E640,
+0xFC385FC14AA3A1E3, 0xAB0372C66982A7BF, 0xCB9C23ADD81A4870, 0x650F00F1804CA541,
+0xC79EF011FCDF5E8C, 0x10F2CE0B44CEF0D7, 0x6719C40746AA3287, 0x00003A2A197B111F,
+0x5F5DFB7B7146A0EF, 0x887BE267092A4C28, 0x26ACC0B73F6F5AF0, 0x8325B3E8F015327F,
+0x383906778A510152, 0xCCB589270723280A, 0xAA69703DEED372F0, 0xBBF9CE04FE6D1AC7,
+0x39ECE8B338E9D9AC, 0x4F75114E696CD253, 0x54B8D4AE666CA0A0, 0x00000C0367FC4B2F,
+0xC80BAD8DB31FF72B, 0x92F07F2CF23E1FDC, 0x6E64C90652903FAB, 0x37A47FC05CFAFCDC,
+0x576563803525E21E, 0x42A8DBB5E9EE9067, 0x7F26F6FC9A9CFF77, 0x1E74BED724D0B7DD,
+0x35491E6C7F3D181B, 0xC12D682A943AB16A, 0xED2BEA8F7C85AF40, 0x00003FC57E0C83C5,
+0xF38B153CD29E1C84, 0x327D5E4E5703DEE3, 0xEE047461F8129521, 0x01E0B384613BD191,
+0xFFB5B80003D27FFF, 0x42A2BB1EC35E03DD, 0x5458856F68F19248, 0x3FFC61B590EF90C9,
+0xA8212F89DBFB527D, 0x478CB6E8C78D8887, 0x959849CA7A9C52B3, 0x00000FF29DD62790,
+0x10884BE26120CD6F, 0x79A8616DE83EF25C, 0xEA61BD5CDBB01121, 0x4D22818FA6B78AF4,
+0x77ABE8D758819BED, 0x43442128DD182763, 0xD26DF708413E0D11, 0x492D33BC6378769C,
+0x0713ACC753966D51, 0xB38F73B014D01E7F, 0x096B38E11405C08E, 0x00006AB766E18679,
+0x76F05A74A51C489E, 0x8B85867B7678DC76, 0xD3811D2D4658BF89, 0xCE3C793F38D1143B,
+0xF4A1C1C9974A1EFF, 0x4DDBB8A3D6225EAF, 0x79414EBC00C52349, 0x2684FD9ED71442B4,
+0x12C6BA6E922EA7EE, 0x5C5444B22FF021A3, 0xC8442A3AEA54AA43, 0x0000514439728C6C,
+0xBB99B10EB21B542B, 0x53F6EAA2D4B15431, 0x1660C17A6C683518, 0x16B823B48BEA25D6,
+0x4829F1F953D2F4B8, 0x0B1BA4E0A5BE93FD, 0x9620571AF43E41FF, 0x5144560CA02617B6,
+0xBE75EB76C5ED5D54, 0x844292D011DADB1A, 0x66557436111F09D3, 0x00001C63F159C20F,
+0xDA2096FCBAFDD489, 0x7569DF15A3567AEA, 0x1BFE42ED7DF8F02F, 0x4C83758CA39EDE8A,
+0xF3ABFA64F6FBF70F, 0x47B025C8320BB893, 0x07CEB62BFFB182A7, 0x1E0923A916398BBC,
+0x080B7E8DFD402CD7, 0x1B1E820D0CBC1AC8, 0x94823B75AF535F68, 0x00003E059A8B6173,
+0xAE84591B7BC502F9, 0xD654FC073937D967, 0x6182E66A91F19CC9, 0xE31DA26B0350D20D,
+0xF499564695E4A59A, 0xB4267DA55F6C2C19, 0xB409A804CB80FC14, 0x99FF7ED20CB7768F,
+0xA01506F8F4D065A0, 0xEAF50FC36ECC5D1E, 0x9AF4C31AB28987AB, 0x00005A7E028D89C9,
+0x3520DA782510D7A3, 0xF0C076492D0854FD, 0x5D909CBCF1439BFB, 0x317A845D2F9D0620,
+0xC3C393F6A870A5E2, 0xA36112CB6548BF80, 0x682080619830BFA7, 0x7299497AEDA1682C,
+0xB7368BB059385695, 0xD9E3E552EE06FC0E, 0xFCBACFA0CBB22A99, 0x000046EFC4154F5C,
+0x7BCE396D768357DF, 0xC6972E8CC5D3CA52, 0x81015640C1DDAD54, 0x0B9AB579BF0A3020,
+0xD0235C1C286BCEA3, 0x120531438098C0F1, 0x0F9264D48E4EF556, 0xE8B58E1AAA8F4A07,
+0x11A1F46019CB14DC, 0xD2392D7AAAE503F9, 0x876CB4D522ABC201, 0x00003A07205E6011,
+0xD3470CE265FE6ED9, 0x2FBF6ABC70BADEE6, 0x7192D953A79CF896, 0x9FD2330B96F41737,
+0x77AADB08D121A1B2, 0xCD38F271EC01C1AE, 0xB75BD14AC72120CD, 0x11121421692A6F1B,
+0x4920CC26A05CCC2D, 0xD4147B25C7AE11D8, 0x130B60F982B8BD72, 0x00006CE19FCAD550,
+0x9A59A2980CEBFA09, 0xBE823DA0A96A6E86, 0x90CF49BEB3546CA7, 0x599B485DEECA34D4,
+0x0B52404C4C9241AD, 0x4C89175EDD286CD5, 0xC3D7DD48E5FFC949, 0x4670B86394D06191,
+0x2E3FA1DB289650C1, 0x66AD0A709E84F344, 0x68ED6EDE8C788CF4, 0x00001B9AC7B81C6D,
+0x164A36BEB00E3D58, 0x9686D236AB9A2754, 0x9F26894938A78E9D, 0x2FF2C916A9705A94,
+0xC6DED614A0CBDE20, 0x5E6E08094B418836, 0xC8076DFF6A9B9374, 0xBD4CC47DEE0675E6,
+0xBA1A9017F925131E, 0xA6394FD54B874F91, 0x54DDFBA144871440, 0x000032A5466C1D29,
+0xE97B0B327110850A, 0x7602F9DFA12AC410, 0xC56478BFFE507749, 0x79BBF2907AD2E571,
+0xDB0888E53C5C76C6, 0xD5A2EEAE733BD9A9, 0x57DDFEF8F2DD812D, 0x9A7E5D8945405B23,
+0x77A1308283ECFEB6, 0x96055B129BD2EF82, 0x971447A714A0C72C, 0x000051043799DCAF,
+0x9D2E7DD76654A35C, 0x21FA6947F5774328, 0xE51ADCC80B538399, 0xEC8B8169DFABC525,
+0xC9866C284A65300B, 0x6FF6466C6C5DAF3D, 0x181F1F6364F89B1B, 0xBD6673DBDD471FAC,
+0x744113801798059B, 0x1BB6F75071BAC332, 0x0A69CD362FE35B17, 0x0000035EBCABC34D,
+0x568B8F22071F7307, 0x3BA76BD75E0C4EDF, 0xF72AE1738F120DC8, 0x283015A65663000D,
+0xF07EBB184D0CBA84, 0xDDD73E5418886982, 0x9A054F7AA3C175F5, 0x550DA0939F600F4C,
+0xB4E44F98C4083E40, 0x444348E0A0678FF4, 0xABAACA4CF9E2790C, 0x000023306C97165B,
+0x2E162FF53758E4FC, 0x5911B10D4812B0DA, 0x32575223A8BD065A, 0x8848D661D62E8997,
+0xEC995E760B2C20F6, 0x1336C90B9F6B6DBA, 0x5F6F0199B2887705, 0x072A89A82BC09565,
+0x5E53B940D7620E1C, 0x91414C1150516467, 0x4BE78B0C28A93797, 0x000022D3BC91FECA,
+0xC6DCD9A9B4D7E75E, 0xAEFADC3DF76DE912, 0x6F8925C537F2B1BC, 0x6E171A426F26A682,
+0x35400FD2DC54457E, 0xEC5AF25D473A8938, 0x13FA91F590F294E4, 0xCC950C36F7F52707,
+0xDC871DC72C2E8A4D, 0x8A6A462DB5986749, 0x211E209CEAC88A19, 0x00006871C2DB2AAE,
+0xE7DEE14A5BA5C384, 0xACE55F5761951F36, 0x1425BA0B46E23337, 0xE9E4D95C5F28539D,
+0x0896150B2476CD47, 0xE890DC98106F0C3F, 0x7865A6684E7BB855, 0xDC329ACEC51B8974,
+0x3EF44F796B9C09A3, 0xA4A56AB98FE1571B, 0x8651DF9BED6B1EA1, 0x000037009FF40C77,
+0xDD9C7258C23C19F6, 0x8417FFCB80F64411, 0x311D181F87524D17, 0x97320A2D1A1B1AAE,
+0x46DE69A6FFCB0262, 0x4B86A880BCA11898, 0x0F876E7BC93C2EF0, 0x37EA908707ED7F48,
+0xDE5ABC508C343395, 0xC8D8503F9894228E, 0x71386F8E28B7030C, 0x00003545286BE230,
+0xB2F4EF08E7DB322A, 0xAA6D8C340A0607B0, 0xE8DE7044CEEEE4AD, 0x8EA1F22C5D9CBB39,
+0x0273DC37E654CA6F, 0xD46409A39747EEE8, 0x189F89CA04143BDC, 0x584FEADDF1893726,
+0x74C83EDD327D5D26, 0xF5F17D8AF4D89085, 0x45F785ECCBB02649, 0x00001E99E7A85FA9,
+0xEC0C97B80E28AD2F, 0x8C3075C92251D3E1, 0xA10D19806CC43F13, 0x2F2E22C1B8B0D14D,
+0xB9A7F6A86D01AF2A, 0xEB8DD953C37334C0, 0x823C128493BC94D9, 0x817BD720BBE5FEE3,
+0xB8CC1DB54BD8DE85, 0x93B2E09541AD2DC9, 0xFB357E9BA6994E19, 0x0000554A2FA4559E,
+0x718D0CFA1BE74B66, 0x66EEA7A3207A3AD8, 0x27726935B73AF6B3, 0xD9689AA479A496FC,
+0x0D99087EB0D67932, 0x5998D03127725DF6, 0x4FEB3FB648FB051E, 0xC5264CC829F01BBF,
+0x108A9E2A9FB1C312, 0x9CB127A3643BFABB, 0xB530626CEE774CE7, 0x00006B24E67F46E4,
+0x23D8A132B419DFF3, 0x11ECF9A15884FDE3, 0x4486FF6C7F22A812, 0xCC04913ED8B0D94A,
+0x2A23BF6F0892C25F, 0xBE7D311E92CE1182, 0x480077C8E5D99C58, 0x756253C5C0E05D88,
+0x5E1FAEFEBA144BD9, 0x8886EE43ADFE2BA7, 0xDA5302B6126722C5, 0x0000474371FEDC7F,
+0x7DA213FD6C9B3662, 0x51FD13652E58951B, 0x8F11FBF116DBE728, 0xEB0C15D29B8D348F,
+0xA67534B3A78D5614, 0x130B28D9DE83C613, 0x283E00A0AB347D64, 0xA0F8DBFA205E9115,
+0x0C24946E59BB9B83, 0xDAC090A699885605, 0x94A41668DDE6A11C, 0x00001B3C4536D888,
+0x44F93D797FECBF33, 0x5C8005088E66876D, 0xC69B70ECC7A116B0, 0x9C31A1F792CAB79F,
+0xC4564252CB1D5A15, 0x1E401B92CBEF73A6, 0x845BF208943DB64D, 0xB813F1C962D03CDC,
+0x83281FA815A74DE1, 0xC3948C47C626D116, 0x641E05D41E219123, 0x00003E711C69C578,
+0x8C8FC9C15989CF91, 0x6551FF36A68C72A4, 0xFF51360CB3AAE418, 0x48CB761ACC9EB5B2,
+0x94034D24D3C18676, 0x829BA6D56C4B7401, 0xDF01D791AA8526C8, 0xC63304D76C8BE40A,
+0x9EBB3A9E67729910, 0x3EE7AECCB9765F17, 0x60E89A74910CC5E3, 0x000027564EC74CE6,
+0xF0BCD1BA5B1ED4F5, 0xE1F795FB94F4DB50, 0x97F52FE6B81C6198, 0x7BE750F4558CCB37,
+0x20D73AB1F2F54624, 0x9EBDA0F7DB2A2D69, 0x489D8FB8E4859FCC, 0x2F990CD8D8DE3903,
+0xAA8A1CABC9A91D94, 0x25C126617F25350F, 0xF8ED9E1DB6011A47, 0x000008D32C2DC822,
+0xAAF057B989CABA7C, 0x9A39718D72BBB2A6, 0xE6A3318F6EB214FE, 0x18C5787F862400EE,
+0x3388E5883184465F, 0xE169E430B57E97F8, 0x8D856AA198822B52, 0xF202F5F7B20CEB14,
+0x7AED0B49994EB432, 0xC99D8200153FEB5D, 0xF88F1DA49ADC8B4F, 0x00001D840FCC8F0E,
+0x5C9E6F74175F31BC, 0x7770C31B4B849ACD, 0xD90CD418390C4010, 0xC118DE45142D2271,
+0xE115090A11870F52, 0x478D74DA3CA0E2E7, 0xA0E7329981997965, 0x321EE01F42FFC3CD,
+0x48C4BA6A3E063F05, 0xF55E01FAAD189BBA, 0x1FF0D998A543D919, 0x00002F2273C99C23,
+0xF32265C8F43D9086, 0x6DE88995B8D99A53, 0x78065CA89CE49E70, 0x36AA795385A023E1,
+0xADA9E76F5FF650F5, 0x2BC5A2E10E8C0B45, 0x43D473549BBB3494, 0xF45CA68E8A37A873,
+0x8BC3D6A99BD7CF0D, 0xC017832B8BC45CC9, 0x8DFE599A4C655BC8, 0x00000B98164F9AB7,
+0x544426E96D57E097, 0x2FEC3AFAA1E84808, 0x0EB800254E27FEC0, 0x6FB153C82F1CF599,
+0x380D0683DD25D228, 0x8138159788F32EF8, 0xDD87497ABF391975, 0xC857AE6D198134AB,
+0xF16914561D568EDF, 0x2E461DDC90403E88, 0x39BF08554FC97854, 0x00005B4D327EB81D,
+0xDEC7E605C4AAF587, 0x2296F7EEB9FAA7E0, 0xFAB80FD88CF32142, 0x228E57AEBB0D7F17,
+0x7F27B75A44760AFA, 0x074EAAE140085867, 0xF6B575D22628FFFA, 0x2D109CF789B9D2BE,
+0xD361E10084D33E33, 0xD16F4DE1CD32AC87, 0x677C9F2F230E6B07, 0x00002B9FED2B52C4,
+0x7B0DEB6D7E18F857, 0xB24D753078EE6085, 0x30672F661D5652CF, 0x12A3866CA15994A0,
+0x3EAEA618F32AD447, 0x7C1675CA532AFED2, 0x6D5B06956680138A, 0x75546A095C2B2964,
+0x88BC6F9134A25DA0, 0x446F0E154D5DE57E, 0x49F656AD039225BD, 0x000059B0ACBFE458,
+0xAE9F715437DFBF29, 0x9BB71DB08A88ACEA, 0x16F69FC37BCFA63E, 0x8FDC7C1101D6F974,
+0x115CD897214379F8, 0xCD412B8C98B64B05, 0x671144A1DA1F71FE, 0x58A354260D1C7F43,
+0xC00BAAE834C85117, 0xB93100410EA35F25, 0x35F08D3AB32CB9E5, 0x00006E94D82C8D9A,
+0x7F6240FC5018A924, 0xEEB75CC1CBEEF8BF, 0xC4395BCFB9596925, 0xA59ECA3C6AD4316C,
+0x871ABAF93854445E, 0x2710231A3F573047, 0x8766060647B45516, 0xF2CDE068DE1C9E0A,
+0xCFD40F8B80B33B13, 0x039325BFF883D950, 0x580284F742A02E6E, 0x0000050EC0AD832C,
+0xC36897DF19086E06, 0x5DB0B5B9E1648F53, 0xAC0815F0665A1563, 0x2FD7B7E240006112,
+0xF0ACCDA094BCD2CD, 0x81160155A5B8BDC9, 0x31C94F25083CA33A, 0x1F78BFFE35A9A556,
+0x32A2A67F8FBCD5AB, 0x29C17273EA914BB8, 0x6AFC7A71C8C7FE46, 0x0000161552A3A965,
+0x5D5FE257B3684D4C, 0x3B20F08861A448B6, 0x7DC0131F4B1A18FC, 0x2A909DDD6802AB15,
+0xC78E9C6089D114D7, 0xAAAD1DDBB0317A27, 0xE53C88AC2E4AD667, 0x602444D56256F459,
+0x7B7D7F3F01FCB829, 0x13D5C688ABAF8203, 0x0A5FB14C41F5B74E, 0x00000B99BA207CF4,
+0x24D92BA3F2AF26FB, 0x5E4CB89D5648C84F, 0xDA6018096E06659B, 0xF991BE1527789086,
+0xDF057D9E715249B5, 0x53A7902CDE34677D, 0x9261C9D569BE3852, 0x4CA9D669EF59AF86,
+0x53308F633C159CEF, 0x702BD4AD885314BF, 0x82A8646897DD9D71, 0x000002D4D4028B7B,
+0xDCA09E90D735ADD4, 0x9AC1FD76AD6F564B, 0x0588003286654048, 0x4647FD45D7603776,
+0xAAEDC3441A987A07, 0x227273F25AD8D4F2, 0x1835C4AA7026B51D, 0x3F2DE3AB4C7F513D,
+0xA02B10EBE1B9A66E, 0xC42334EF155A4B2B, 0xD73129AD19C5715F, 0x00001C3C338C08EB,
+0x246345405B6639B2, 0x7BB9F210C1339D2F, 0xBE1A326AEC486A69, 0x44BDA3F08BE4491E,
+0xB89F900F0ADCF62C, 0x3C97F1CAF8F49235, 0x22E80C6FCC0E7F22, 0x802A8296CE16029C,
+0x53249D321B5E9879, 0xCB83D62E4E9A563F, 0x7009FFBE406CE20B, 0x000043C892E12C1C,
+0x8CD14D9CD632327D, 0x52719A5CA3A8064E, 0x7957BE6815BA05BB, 0xDEF1478242092649,
+0xF5503CF5246F0C36, 0x62C2B6CBE4071F07, 0x2DA4117CB7F03CFD, 0x6C72B86A3306A856,
+0x48B26B87D16CD89C, 0x1A8D044FDD077CE0, 0x59EEF2B45A35B453, 0x000056CC2DDFAFA9,
+0xDE56AB8E783815B0, 0xE7D70BD2CB2F608A, 0x8B49A44231719F0F, 0xCB6C626B4DDBD077,
+0x962ADB3D8BEBF046, 0xB9A21442C160DDEA, 0xA217118ECCD660A1, 0x3E2AA9EC120D0F50,
+0xA68CCE2A420A8D55, 0x9AEE7959D8143270, 0xD6F177B1224851D1, 0x000066E6E82C9BF0,
+0x2B572CA135BEB8C2, 0x2CBE512AC8399728, 0xAE32CDC380B66678, 0xC2C2F494321C0F6D,
+0x9B31FF3A70B85B3B, 0xD2B18443975433DA, 0x599A5149913F110D, 0xD214B72117EA57E6,
+0xEC23993890E21D84, 0x6175B8E80E227A45, 0x0E7D62B025A60D42, 0x000013C69AFC13D1,
+0xDDF42FA903678A08, 0x76A076679512911A, 0xC81592B2EE978F6B, 0x16504E8D8AB4048B,
+0x5ECDD4C322CD89C5, 0x0BFAE7C6B90CDF8B, 0xEA8429B0D8EC6939, 0x4AD287E04DA277CF,
+0x02113CAD19CA0C53, 0x36EE1BD2C44219D3, 0x5AD9FA667D060D8B, 0x00006B7944AD9784,
+0x8737461A24BC2724, 0xF04E8C6DD3FEB094, 0x985C5DBC7979E169, 0x56767AAAAE086534,
+0x79D41320B23D758F, 0x20F57FBDBDCE7595, 0xFE7C7FA1AC6D2E81, 0xB9D4A3AF81DC080B,
+0x6161FB5A0150293B, 0xFF54DDD5D9BAA0B2, 0x44DB2A6AC2886308, 0x00000E0FD7CCADE7,
+0xAAE6404606190295, 0x5CF4D89B8570154D, 0xB4E095FA706A1DCE, 0x827BE8B483CB97D7,
+0xDCB3073104CBD78B, 0xA55C959327F5527E, 0x3D73EE1C60C2FB8A, 0x49E387070E97D222,
+0x936E388CE9A89C36, 0xA4603FC4C435A4B5, 0xDCFA0D82DDB78518, 0x00004B8416ED71AA,
+0xCB11AB4FB7A9C180, 0xE8666D5B4E4B455E, 0xC4383577AD6869A2, 0x49EBFC82BC6B970E,
+0xC10E2A1346B0BA5D, 0x47BCB38DFBD4C8F4, 0xF0031B5FDB53F411, 0xC0979907277C3001,
+0x4F6BB44B525958D9, 0x604F11759DED632A, 0x5146B5F881F52C1A, 0x0000372B8E4866B4,
+0x9805268E4999C568, 0x9A1CD60190DEE01F, 0xF5E3BA7F5704C88A, 0x18D816EFC7706B58,
+0xDA2DB98877C19B9C, 0xFDA358811555ECCC, 0x548B40E457727C56, 0xEA2F3E1ADED888CB,
+0xB5ED0728A3430088, 0x53680093492A1B75, 0x286B5E179DB95E79, 0x00001FF7482B069D,
+0xDE7C74E1CF5C7348, 0xEB6390B82A7793B5, 0x1EEB77D78E0BE689, 0x0DB8AF09E5286531,
+0xBBF8F92E7CB593B1, 0x7D268FEEED6E0BFC, 0x11D80760056D30C2, 0x1C2A9DB29051A0D8,
+0x4209D02CA11D3D3C, 0x7EAE1F4406376E1E, 0xE5D5C583A7789A75, 0x000036D90530CABB,
+0x0EE84D9A4ABA1E99, 0x319DE058B84A96EF, 0xB5D92FAC0C835F01, 0x00D41B28DAE30D68,
+0x6B474BE0FC27D264, 0xC595A4F60A672222, 0xDAB23EF4EE51D62B, 0x0960E70D481EFDA6,
+0xB8C0DB7C162D2B1D, 0x6BABB8681B850433, 0x3FA17D363A3293C6, 0x00003D4E6150E39D,
+0x6336C76F34059B47, 0x96FCC2D51555AC32, 0x0D16AD78F69263B7, 0xEE1C31F950FDB5EE,
+0xA12C06BC424DA418, 0x73908CFF7C6891B4, 0xAA62BE01951D2834, 0x61B10DAAD225E610,
+0xA4B25E7AE75DE83B, 0x7E7C6676637DFD2B, 0xB9AC9C61A0AA1831, 0x00001415C39BD9FE,
+0x7D54A9008F0FC12A, 0x46F1CF4BEA54F170, 0x73BAECCEA6AF5475, 0xD2694F3D5B99175B,
+0x48229F31EB08735A, 0x49B4714967DD95BF, 0x5A7180F63D10B05C, 0xE2CE3B08165CA2C3,
+0x92382FBC10B32B4F, 0x34EC0F8A219B3BE0, 0x8C828FA344D39F57, 0x00003B543F773102,
+0xDE50E8538AA3B67F, 0x426E42E74AF156D9, 0x007ED0975B6206C9, 0x359EDD8FAC6212CA,
+0x175C11DBCD5361E3, 0x08D09C12B40F97DC, 0x221AA94898A97558, 0x7B4971F1FFB4DA50,
+0xDEF2B65ED6C469BD, 0xEED1D2E6ECBE093B, 0x7FA342136B48615B, 0x000017E3132F3852,
+0x43C042015926AC61, 0x0AE4A504360C835B, 0xD9DA29605158E339, 0xFB8F372FE18B3F3A,
+0x509CCE190798E90A, 0xC38094218EA1425B, 0x94D82A5BDFA7A1A7, 0x98A7B4B18EDB1E99,
+0x23F3736C9BECBAD6, 0x2D183C0F791FD66E, 0xCF011BC35648D10D, 0x00000131E72AD8F6,
+0xC31AC88C06659111, 0x87A0564D425D47AB, 0xEB133D8F28E077E4, 0xE4D7A1827428A12B,
+0x1824B7F94A2F7707, 0xD0FAB461F7D02400, 0x597CF01E3F22DC9D, 0x60CE8A65755742EE,
+0x385AAF3D47C48251, 0x5537B9B63B6DE8C7, 0x3641546EC8DE618E, 0x000044E3A65E1EF0,
+0xB02BB0BE4E7C6D1D, 0x5CC3A4BCA4C6F173, 0x18386468CCA6A3C1, 0xBDF5C589EB81C8C0,
+0x36B01129A0FECDA1, 0x71D331914AB4DB23, 0xAC73422D1D12EDFC, 0xD2628B131D6F39C7,
+0xF05C7B710522768E, 0xB6FA2B97F09CB5BE, 0xC8FC971F4D3C0A2D, 0x00006BF491FDD197,
+0x057E2056A408703F, 0x62202040C2816083, 0x11AB9CADB5D7436A, 0x9BBE55ACA815FA14,
+0x5A3B4E98F238D973, 0xC187B390ED6F81A3, 0x3203B8357881565A, 0xEA85205DC96F7C9F,
+0xEE0AD644435CD8C9, 0x0A77A64826C2CAC5, 0x5BD8CAFF91128793, 0x0000382BF5A7E6D8,
+0xBE3FA6613855F334, 0xFC3087D894EA8FA3, 0xC16BA432805F5EBF, 0x691B345F23734D42,
+0x5A63ACB37A636E98, 0x349E5F861F66E05A, 0x1B2994AB06BED64C, 0xF66420BDABE87AFA,
+0xE36CB913462FAFC5, 0xF5D41C45822E31E2, 0x7BBA9B62C2F05871, 0x000047CFFCD565AF,
+0x63339D4F517EDE28, 0xB067DBDF0BC159A9, 0x655C5BF1A8DCD02C, 0x5DE4EB84102BFF32,
+0xD843E8DD677EC882, 0x689A02D33B5DC7B4, 0x418E77F53D2D7A62, 0x352E155B688F2303,
+0x75AE59D678FCA0EB, 0x0168036F7B53898C, 0x7CA97A633EBDFA05, 0x00005152A6053350,
+0x7524FBDBF6534FBB, 0x2032A4D848B285DC, 0x2729995AC29BE398, 0x449AA789389C5440,
+0x04ECF3A223A7B17E, 0x7B0424D60673AA5F, 0xF0633CB633D7EABE, 0xA535E59D317957BF,
+0x5DFC77142B83554E, 0x22BC9E5DA4F7AE67, 0x27C7A010D0CEBE7F, 0x00002CEECFF53915,
+0xF7DB771D19B6C196, 0xDC424FF0836EE810, 0x6EBDE3CC9280C9BD, 0x08D165F26D2A0472,
+0xD1E78A12359FEB83, 0x44C95EFF59142F34, 0x421095C7C3E5B485, 0xAAC0DEF895025A3C,
+0x190872244458FBC3, 0x7A613AF043243EA7, 0x47860538CEB802E9, 0x000009F0F0D98FBE,
+0xF61492A63D60CD67, 0x467D1B1747430C85, 0x1AB2DE9F85B2E141, 0x016F806B5435723A,
+0xC9BA3762CF5FB4EA, 0x86D9884207C789B0, 0x08814176FCA4B424, 0xA23E5EE769E646AC,
+0x837563311694E5F2, 0x64BAAB3851DF3F42, 0xA0BBA3FA3673939C, 0x0000227114691193,
+0xC4732EA46EC09FC8, 0x4C39737B757CAF32, 0x31666FFBBEA77C9F, 0xA30B7842F6CBCF5C,
+0x53EB5A376A0A175A, 0x3600E8134FFD3DB3, 0xC280EFC5175927E8, 0x7A0900E080F864E0,
+0x6EB0FD1CDF64161C, 0x7AECC31648893C18, 0x3011D2EE3CF08B64, 0x00005456BBB30E77,
+0xAEC13CDD61A7351A, 0x1C0C6EDA341EFAAC, 0x9A6DA31DC8E1205C, 0x8DE5E9FDAFB0DEF9,
+0xE3C1E0352B0C9A0D, 0x577B5D23B51FAED7, 0x314D33FFA4099D64, 0x7831B81D62F9CB8E,
+0x06C808123302168B, 0xE748CEC9F1BC921F, 0x627517A02ABAC512, 0x00005ABE8D69CD20,
+0x1FB58AC66287FA7E, 0xF5342B8D59039A81, 0x198B6AE69BCFF9D4, 0x8A8015196035C0EA,
+0xDDEA0FA0DDB0B335, 0xD9A170368AD17851, 0x2944E43EA470AD39, 0x12FAF675AC34F7D8,
+0x78E8981AAF21C4BB, 0x2D492170E913C7E4, 0xD0C5FE1ECC0479AB, 0x00003AE09D007068,
+0x4354194882CC2832, 0xF5CAB183C17C3B09, 0xF5BEFDA33A6C6DBE, 0xF2C355F271A8576F,
+0x16E448B2470EBF2E, 0x3338975AA002FF81, 0x5CB06D718DDD39B1, 0x459741DBEF7DEDCA,
+0x3CC38929EADB9ECA, 0x941A41BB9C1FF291, 0x683FF32DC69F519D, 0x000064F90E76A74F,
+0x4C6C86B5E3D612B2, 0xC5EDED418A328FBA, 0xC55E7D93B5C78044, 0x11905F3B539B3BEC,
+0x14AF4B1A341516C1, 0xEAC3131EC1FA68CF, 0x5D8EB7773FE12347, 0xF2E8A44F8EF85BE2,
+0x3ECF7516EB430A1F, 0x7CF71AFBB542CFED, 0x8E81499BA31F0985, 0x000069F33861969D,
+0x0A06421E68B3BEEC, 0xEB8F919DCCF78AA8, 0x57D79F14799EE276, 0x0EF3D7B467CA29B4,
+0xFA2172BDA9926BA6, 0x4AE091A9D04F3F70, 0x33D8626494327893, 0x0D2F9FFDC9357C77,
+0x9B3F47A099E7097D, 0x5AB8C068FB6A937C, 0xD79F6FF38A252161, 0x000008BF8C5D4CD5,
+0x21645D32AE1730B7, 0x2FDAEE95FEA93381, 0x7CF7AE8D2BDF356B, 0x015E2176057A86DE,
+0x90C141D207E99084, 0xE28BF36962036336, 0xEFD9DA9012E3AE96, 0xBF274B926A7362CA,
+0x33F01847D6A95AE4, 0x74AC2A361FCBDE33, 0x90B834FFF40A7B31, 0x0000613E677710FC,
+0x8EC3F720B045AFEF, 0x3D00689BB01D5D35, 0xC3412A3E3791F136, 0xAFCE0EFC8EE75620,
+0xBC2DC96254AC011D, 0x0EAE4793CFA142FA, 0xC23EA4F7667DDB28, 0x49F6DD6502745E94,
+0xAA3945E96B82DC87, 0x93135571FD04B3F8, 0x2F4B521913A3BD67, 0x000047F5414DF6EA,
+0x95C6DE3C9DB8C2BC, 0xFADA469BE6D7C9EC, 0x24758BFBFB72B983, 0xCD597F20D6F00BA6,
+0xF8DEFE1EA0904FC6, 0xAA9FAE6583E2264C, 0xA65DCCD49FAC8F6F, 0xD87A76AFEA4DDA21,
+0x7B208910778680D4, 0xCC5347A8A49F7D53, 0xE0163A0C25DA5737, 0x000035A964ACE368,
+0x25B330098852FF89, 0xCDE2C5AA7380DD24, 0x134CE28FF532061E, 0x31979A97B62D22B0,
+0x9A7C12FB541203B9, 0x3B3D78E3952C08C3, 0x3FD02EC6C9B237BF, 0xB46B3D2E5C719671,
+0x53B2EEF7B964BDBB, 0x32C1C6617B21E6E9, 0x87C8BBC1AFB88D54, 0x00000029FAACD4BB,
+0x3B922917A8D64BF3, 0x9CFA47A068C1B22A, 0x8A8A218886468434, 0xDCDF6EF68A1BAC8F,
+0xCC14BC178660F087, 0x4F9A59B8AD08C54E, 0xBBB8FFD87460AD00, 0x6D02B8F18D531219,
+0xE217D4A7EB556109, 0x10DDE1720646A51E, 0xA76A228921C1210D, 0x00000ABD422AA724,
+0x57CFC49AA85AF95A, 0x67713BE87A16046E, 0xA3C72E5425CCA88B, 0x95ED48CDBDB16F26,
+0xBE587A036B91FE40, 0xFC1A9ECD2D97DD6A, 0x177C1C25A49427C0, 0x18E4355C4C3CEB4C,
+0xFFAB4E52991C5323, 0x9E914F4552C82419, 0x2C294FF6AD5181FE, 0x00000640304F005A,
+0x91E29F149F885A4C, 0x6CAB530826A7C1FF, 0xBCAEFAED06A99849, 0x7E418669264768F0,
+0xAC679F2CEF66F9D4, 0x1DAE3786C7981EC7, 0x412FBB0CC8C0B861, 0x9C83182FA26945C2,
+0x262306D065B00842, 0x5A34C17B6BC3809F, 0x9C9CB914299B818A, 0x00000E04ECBD8B8D,
+0x338B215860BE95BE, 0x1B8C6CCA783423E9, 0xB3F19ABF02474A06, 0x5C26C79FB2BB935F,
+0x30593A03D8E3DDD2, 0x899BF77D5224847B, 0x102B66C11447D81C, 0x1BC9D35C0C6264F6,
+0xE80B49A2CBDD6288, 0x8E69F3B835BEE761, 0x8C7FD619B72AF875, 0x00004CE082D76F0D,
+0x2C7893B428ADD461, 0xC6B3170B05066649, 0x0B4CD411F75E6C43, 0x5F5441402D989775,
+0x2C7A52ABABDBF84C, 0x106EB1113AE103E5, 0x9E3CA3606B092E84, 0x6E79C0602CA9BEDB,
+0x04E395A348BBBD54, 0xCD4616625CEEF170, 0xE48D96D49B015C09, 0x000022308A7D0410,
+0x42D16D73119705CA, 0x80AAE52AD49B38AD, 0x4A0AB439CC73CB92, 0x1F4E5974BD6FA217,
+0xE4A8FA94CD9CCEC6, 0xA6552D05A7716076, 0x812DBB449445DAA7, 0x75005B1257C8B7AF,
+0x262252033227D92A, 0xDC563F36B6DA623A, 0x082F5EEA8CA39B55, 0x00004F5ED59A761C,
+0x694A54D70F5F1F01, 0x8CA67DCA760A0302, 0xF53AA7E6636CC74F, 0x127C3AC1FB54E422,
+0x4887DA5CA5E34B83, 0xD4FB6233F7974B92, 0xA8180E9BCC26E620, 0x62B649B10CE67149,
+0xC7F10E9FB8C6D0DB, 0x35D4FDB9EF490CE6, 0x5C3C5CCA6989E95C, 0x00000860B098CCF5,
+0x779AF15060F442E4, 0xC3CAF323F670214B, 0x59ECA628D543A244, 0xB3ED5E288C4D2EDE,
+0x8A2C6100E8FB2F8E, 0x60E6F6683F1A49C0, 0xF61226A6716F9ABC, 0x31EA12329E8489D9,
+0x0659975770D1BA96, 0xFD873E404B7ED1F0, 0xFD9A83B0CDE14532, 0x000048DD57EA62C2,
+0x32E13327A086FDFD, 0xBFD0C04FCA9D51C0, 0x70D0062F0495656D, 0x66639C5E4B13DAA4,
+0x41823638566D6FE9, 0x4CAABC7BDCCB62FE, 0x4E87BAF0D10280D6, 0x2148C02EA7E2E28D,
+0xCF278DE278D3BF8B, 0xDBA94BD95FF3FB79, 0x0D18C7D28AB52FB6, 0x000033E13076CE73,
+0x2AB3C4433C8D7A64, 0x69109D03413173F5, 0xEF9678DFF02410EF, 0x6C264B4C3EE5A54E,
+0xF0912419A6141E1D, 0x801E5F4D777BE3A5, 0x45C34961174404F1, 0x954F6BD805DD246F,
+0x543775700883E598, 0x06556D420B8D5F1C, 0x7D511935547741B5, 0x000059E47EB60D18,
+0x86395F5700287E6C, 0x6D1DCE06C651F921, 0x73430CA4AF289423, 0x23BC2E1BCA4FDE1C,
+0x689667A619CAAD65, 0x6DD5F1DDD6815106, 0x8CC79517AE6B8BBB, 0x7B5EAF34494D85DB,
+0x3FBB69F509E349DE, 0xE0028EC47DBADD50, 0x4F024316991E0F04, 0x000054227C547F9C,
+0xEA18C3CFB2AF8D16, 0x73536A6A9CEBF4E7, 0xA4602DD1EE445967, 0x744BFA0E2C780BF7,
+0x3C12A4677B6F25AB, 0xADBC5EF2D2DB24B1, 0x750ADF9A6021482B, 0xBD588D958B6726EC,
+0x1445F61C35B51ABF, 0xFF5B9CC82C796D90, 0x78E4C96252D939E4, 0x0000447E0F7E6FA8,
+0x0039522FD927DEB8, 0x2236721172FD6614, 0x7B9CC0C5FF1527A0, 0xB47E440FB8D3A1E6,
+0xE0DC85FBA186B0E7, 0xF342C6E222F076C3, 0xEECF677BC45597DC, 0xA2522D5785A9DFE0,
+0xF497713C4FA11CB8, 0xCD713ED46511A288, 0x5EC42401BA2A2DD2, 0x00005C685AEE9367,
+0x16A26522A2B889D7, 0xA8AF7F1217050425, 0x2CB7ABED1C295A92, 0xB3D3A5EFADD4AB3A,
+0xF5EBAA98B314FE44, 0x6284985D2FFB7B1F, 0xE6115010086D7447, 0xEFB2B6AF009D0A5C,
+0xC2D2B446EA30363E, 0xE70E413A4EFDD741, 0x5A72B9CB40C5B307, 0x000051A2DECB8958,
+0x0716BA9C1B70525F, 0xDF9B1B5117964348, 0x5D58BDCCC5FE3456, 0x042B7FEB368F1F17,
+0xC42EAB290B10A2FC, 0xBDBC1D47E8A5A628, 0x634433F7AE9B2599, 0xCC0F7B868022BFDC,
+0x8946078893DFF787, 0x97F07132396ECD34, 0x4D93B40AF7A78326, 0x0000515ACFA1C0B7,
+0x7C1DBD399DC80247, 0x1C1D1CB543103EA2, 0xF7233A09BD70DCB1, 0xF07C3073C327DD71,
+0x1CFD3C524AF82A75, 0xB7A9B8C77E62D2FF, 0xD1AE8CC8575CF0A9, 0x4135F7B61F0EE280,
+0xDC12E78FA554CBCE, 0xB1AAC9DCC94D0728, 0xCB7D2D2F3094DC38, 0x000032F9F3EEDB50,
+0xDBCB9B85FCE0FDDD, 0x0BB7B5BD0E836B30, 0x97B5217B4F927970, 0x4713A18F568824E7,
+0x02E142E022E1340A, 0x0FABE9EA656A5143, 0x8AAA6C3A34710160, 0x3D9AF95A69B3FD7E,
+0x165171348446CC60, 0xD71A8691ACC8CC40, 0xC5189F005DC52B86, 0x000015DAB442D363,
+0xC065D808122F2C56, 0xC7C2597B4AED0077, 0x24ED6ACFA47F2BEB, 0xF260852DCD61292D,
+0x6F37AD944C775842, 0x01801E38D8D1E2B6, 0xA8C724086E3814A0, 0x3E340DEC1DFF8A2E,
+0x30137F7B82563EDB, 0x26713D5FDA5B3F9E, 0xDC113872C5AA9EAF, 0x000017819AE9715D,
+0x9B7A752DCDD4E33A, 0x811183403B44B3BD, 0xCEDCA8A114E3BCBF, 0x0E552E39D153BFD3,
+0xC936352F27389784, 0x40BAEFD95A500AAF, 0x051AE7054E68EC74, 0x52E65500FF86ABB5,
+0xFC0A524560FE6962, 0x700CD147455917D5, 0xE584609060096F65, 0x000036926E43C490,
+0x3F4A4DD9C2051A99, 0xA7D04B1B2DC1716B, 0xA3C1DB88DB870449, 0x825BAC6834BE692B,
+0x42818A67E807D0BA, 0xD1DDB1DDD30032BF, 0xB28E26B9E372F1BF, 0x77D3CE3517F34C8F,
+0x4FD967703A236B7C, 0x706E8EB9A5A68DA0, 0x47D11705E8732412, 0x000047163D0CD482,
+0x5FE70EB91722838E, 0xA4766778F8A57EDD, 0xBAD3A259F21AEA48, 0x69233161BE9936BB,
+0xB7D2E9590BCD0FD9, 0xE8EED794A3D223AF, 0x0753E2A545FE6897, 0xB6E29F336559F000,
+0xE828545E65899668, 0x22B073DB819FB1DA, 0x70160AD5EFE7C3B4, 0x0000029C4A8C5FC9,
+0x9C8EF011B22A11F8, 0xE35F4792C982A63C, 0x472F8B415E330E64, 0x6069A79F3F0C267F,
+0x25340812A3589AEC, 0x5249CCE728934FB4, 0x169D34ED345B5731, 0x87DF36BC633CAAA9,
+0xDA930DF6E9D26A2C, 0x2AE3FD5F9AD8E909, 0xF9E7B044058042A5, 0x00000B1A0A82D10E,
+0xEAEC37BEBF7B25A8, 0x1F577AF4AC3524DE, 0xD022382CCD25C42A, 0x69B2598F76A25B4E,
+0xAEA8B80761740F71, 0x1E92E9D885CC5029, 0x3BA034223E6A3AE0, 0xD46CDC9E74F6CBBA,
+0xB1E01F3C2670E661, 0xB9E3323A0A4CEF2B, 0xA707C53B4EA217BE, 0x00003A3449CBFEB9,
+0x07A225A3CCC9DBDF, 0x203E219E740398E0, 0xE53E5FE49BE2CF2C, 0x66094284F6D09158,
+0x0C4BF0A87BF8BAA4, 0x3941DACF9769FF20, 0x7C8984E817AC05AB, 0x6DFCD10B668EDAE9,
+0x0E07EABE7BAAC99E, 0x40D594F7F83F0C16, 0x0741E6EFC10140DB, 0x000010D54CA99E92,
+0x807C4DF8B02BC7CC, 0x564DF437FB2FEE44, 0xDDEFA2DAC14302FB, 0xDBC96D7CA7E5208C,
+0x4E7583F98DAD637C, 0x548F6F0868A60AFE, 0xFA7052D77FC8D590, 0xB3CF31163E66BF6E,
+0x802EF0850739B592, 0xC2F432BB791458B9, 0x47025D92C5FD22D3, 0x000028A1A7CDFE90,
+0x5054DA83CAD59CE4, 0x3CD618F303D667A0, 0xB3FF078DB47A39AB, 0xA5540851EE648994,
+0x8FFF824F95C700BD, 0xEC9562E80829B741, 0x56CCA59A7A415879, 0xA62E00D6F8468611,
+0xED84529E444BCF9D, 0x5D0633B6E493C629, 0x674EAC20CA09974F, 0x00002FB893C8F481,
+0x051C0A28A78045D8, 0x95CD52CBEBE4DA33, 0x5E850AF3ED8F3B14, 0xAFBB53231EB3075B,
+0xFF60BDEADF8A4599, 0x9FF1ADA3AA340696, 0x1900D628F6EAE1ED, 0xE19FE1BACFF4D648,
+0x9B8EE4206E22E036, 0xFE667893F1CDB147, 0x920D8C14634BC034, 0x0000582A9F10A7E6,
+0x313B62B1C1F459E5, 0x6EA9969D9E106066, 0x6840B54F538EFD7E, 0x5E9DD56966D244AF,
+0x65B820D051635AE5, 0x72292C7CD0369252, 0x4C4A4ABF8707DE7C, 0x13C47F458C3BFC9D,
+0xE439E2A57CDCC385, 0xCA42A736F79C7D1E, 0x7809935E84923756, 0x0000619ACA808D4E,
+0xEBFC645B53ED56E9, 0xD58F8691FE0C12B2, 0xF0B0216C63D5AECA, 0xB98687DF83377DF2,
+0x177E95E71BCEE635, 0xF84DE2939F88DC68, 0xA04B572ACDA12758, 0xE16248958E8482B9,
+0x6775C5BDB71DB794, 0x4709C219244C6768, 0x3BD13D0AB804A4D8, 0x00003C427A58B0A4,
+0xCC9AE5B0B1A1AFC7, 0xE6B49027B68ACFD5, 0x5F7D11CEA75B40A7, 0xE66022A289478DE2,
+0x2DAA7D6719ED79BF, 0xAC263B798C2E4A69, 0x2BBC4AB3C23665E1, 0x0826E968A44EDE0D,
+0xA413548A65408ABF, 0xEB8EF79DE5477050, 0xFFF5393E483AF8C2, 0x000008C2711E2195,
+0x2C520A740ACF1900, 0x701574BD6D783656, 0x51E689CDF0058A83, 0x63E23AD78BF26018,
+0x2AF50B91568C3786, 0x2E923788284933F4, 0x2E8671F4ED24332F, 0x98E4AC2A46F5104F,
+0x5DB1EC90054CE8E0, 0x1BCBD8E42D437563, 0x95E387631E7854BF, 0x00005029ED211497,
+0x99EE6077D8037552, 0x8D893731348DC0FD, 0xFD7AB4A7AF33DA2C, 0xF34E3E7BD7E7F5F9,
+0xB72EE782B38EAC84, 0x99E4F3BBAF222C0B, 0x6FE23C76EB307BCF, 0xD9CA0215EBF3789C,
+0x64327C327CE8C636, 0xF59C4B51B4F6E15A, 0x518AE748E273A30D, 0x00005C7511AC079B,
+0x6DD5D9E94227A9A8, 0x3450090EFB55F621, 0x918A9DA1318FEE4D, 0x0E1E9A9F5F412993,
+0xCF8A7206EFC3AA95, 0xFF9181068134241A, 0xCD09E44BF24BEA78, 0x7CF6AFDEC70A3117,
+0x5CF8749F297FBECB, 0x0FB8918D4C5985E2, 0x7DED1CD710123010, 0x000034E0420509BC,
+0xDDE80A958770A328, 0x05E79F7CB30BB992, 0x97CCD8585165CFED, 0xD83DD87E08C97822,
+0x6D5AE361846F2838, 0x1AD972DF88849FBC, 0x941BE8FE0693FD1D, 0x1B59E7BD12E73D1E,
+0xC2CEE80B3AEA1472, 0xB319C894D5029B31, 0x6D18468431918F17, 0x000013E99A53F4A8,
+0x8D2B2F8BCFAAFC85, 0x7F95F37447C38FBD, 0x9665967763FDC0F4, 0x4EE403813EC8EAC0,
+0x9D64559B40144399, 0x9DB8E25D53232CB5, 0xB42DE80B21EDA92F, 0x123F693C3D34CAB3,
+0x82899E41B7667845, 0x03104AF8CD083EA4, 0xCE2684FC25018630, 0x000042978D43D9F1,
+0xDA0EE278FA6D5ACB, 0x121789B2334BAB72, 0xAB8378D44380DFA9, 0xE0645326E5B2A52B,
+0xC1F955B219B91A0E, 0xE7EA6482E5C749D2, 0x743387F2E2945608, 0x27445AE89DD1B9D3,
+0x725D42B2CD8077EB, 0xD688C3FABEF0A4B3, 0x58D1BC7594538848, 0x0000376A33694C77,
+0xC950DF1474710D99, 0x297D557128E89FEA, 0x09024519CD857EC6, 0xD945769DA50BD535,
+0x86F7E966B8B93118, 0xB0873965DC163C31, 0x258BB7DCAD185BD5, 0x92158771825D2858,
+0x5F2A04151931E830, 0x5B0E163252AF0A1B, 0x9211B8EE17B8C8EB, 0x00004D05AB024ADE,
+0x107CF75A13F1E998, 0x8258C0E6C43A1686, 0x44734ECB9FAEDEDE, 0xE19FE09919FF0A3E,
+0x448C0A19460C2ED6, 0x1CFCA14AC6157657, 0x59FDFA6D6B77BD6C, 0x9E2C34903BEE710D,
+0xDBD238967F49FDE3, 0x4C3A19C19817C964, 0x97DA8A0F59DE33BE, 0x00006F1E26685DFD,
+0x24550D50713B19B9, 0x006C035C99E2E550, 0xF41CE8DABC3CDA4B, 0x594B3DD5B125021D,
+0x982E662FB9C68540, 0x63AF99C735396D5A, 0x3EC0AEE14213F4A6, 0xD3104AE58D182F08,
+0xACE07200D9A8B8DF, 0x2B827691B51D8707, 0xCC4064B776A5B2E5, 0x000052EE0042FC09,
+0x54976997B3F9298D, 0xA07857A86ED65301, 0x6720ECEAECFBB4D4, 0x64921508AE95B462,
+0xFFBE58D2E1D3D849, 0xD2605393F7CC6087, 0x1D6603C7FD182357, 0xE0C1338C2877634B,
+0x2FDE3ED2FAE9CB87, 0x3E507A137EBC6E34, 0xD1F592051617FBC8, 0x00001966800CE079,
+0x84EEA215F2DEE09C, 0x8CC8C88E86697BB9, 0x8EBC626B81776B01, 0x8C62454D930B90B4,
+0xD9CB474C62925623, 0x9159E24F0D7E279B, 0xB5AECCCC86E30F92, 0x6BB647ABC475387F,
+0xE966FA279EC11A1A, 0xAB4954A5E419A78A, 0x0F109781CA324B2A, 0x000052D9DD095E34,
+0xA332C2FA250A1A2F, 0x83E7D3C8E5F4246E, 0x9C239DB99F3E8E38, 0x806D7F60102F2E77,
+0x4C674075F540BA41, 0x79E38C8FE05AB07C, 0xAD39B8E470D05793, 0x9D1B3BBC3954701F,
+0xC829059B7C9FC9BB, 0x50DF40D2E5820739, 0xF349CA383FDB89DB, 0x0000309732BEB460,
+0xE958867DE789D849, 0xBAC2D9F10F584A03, 0x6FAC99B4266A6494, 0x20963631181EB8D5,
+0x6C84C7804238EF15, 0x7B1DCDF4C86C60EC, 0x491978B873E9F67C, 0xBE5C3E409B619BC4,
+0x9386CE745018616C, 0x8690FC1DBAEBEB15, 0x7123C097CCC3CAEB, 0x00000866A22D774A,
+0x1C0DEF8F8C522D86, 0xA8063D53F2B0DBA2, 0xEEC4EF2C1A4763B3, 0x2AFA6973AC0C9FCA,
+0x2B2D1221F81E2C74, 0xFA25AA33DBDB1195, 0x7E622123655FAA6F, 0x30D0E527730D0442,
+0x1989CA617F6FF9B0, 0xF25CF61BE8825135, 0x2B289D5602F75CA2, 0x000046AC7D86EF2D,
+0x884FCF7A3199CBED, 0xA9C19D5FD556BEF0, 0x5703C4F1B1C6938D, 0x7182D26FCA916CAD,
+0xF484C346653063FF, 0xFFCE86687A55660B, 0x790B2F9E15F0A20C, 0x61AEDE64B6B11BC9,
+0x83959A41D13DAA53, 0xEC265F866A3F7EC4, 0x2454FC6F53CB2289, 0x00002E847C810289,
+0xC5A7D94C681D68EF, 0x3029693606A5B4D2, 0x9051A6F07E96CAD9, 0x2005CFD0642CAE38,
+0xE3F6E3C3C51F076B, 0x52F9259322A70222, 0xDA511599DD911366, 0x5C9DF78FE332BA37,
+0xD7B816D5B5DBC23A, 0xB2F03CC31FB34957, 0x45049DF9D5228470, 0x00001CCA3F69CC74,
+0xA6B3F43B1FDAE765, 0xC06E41F239CFB3A0, 0x0750A6061792B0B2, 0x4E44D0790ABBEFF2,
+0x970F9FFF0B4AFB9B, 0xA1CF900B14CF922C, 0x6305571A0DFB1703, 0x8477A6F13AEA7A88,
+0x6B63ED948BA6D2E6, 0xC8427D7CCFC9439C, 0x2922F7B2F39BC206, 0x00005B6BDC09A88D,
+0x5F44E27BC9B62B26, 0x3C47F86F9BDC29AC, 0x11268FFF2216E189, 0x47221143635C3E91,
+0x38ACC61F42717420, 0xE06A3E7FBEF4CC3B, 0x479835C8C0634DCD, 0xCDABB44BCC362808,
+0xEFA1728AFAA76725, 0x7359DC9BF54CE08A, 0xDA602D277FAD1A04, 0x00002CFF28EAAF33,
+0x9FB6237F67DC2BF4, 0x1BEAEB8BC9822975, 0x7D77048F7DCEB3C8, 0x1539EA6CF7DD93B0,
+0x7884391FBD5A5787, 0x53C6865E6E3A919C, 0x7770F6816E1EA525, 0x778DA462EFC952F4,
+0xDDD16D27B805228F, 0x8C67A650EF3D879D, 0xAB1963B6040D19F6, 0x000016F34059B32C,
+0xD63C5C772D167FCD, 0x2E0A6803D7B02FA9, 0x67FD807CAFDDC8AE, 0x8E63B836BE41EF2D,
+0x861950BEBC3E336E, 0xAEC861FF89850081, 0xDF1A1C22F218CDEC, 0xE0E4B6830C9FE7C1,
+0x98DB2FB18BBCC642, 0xBC6EC3ECD79BE949, 0xD27B9C9D96D70FC2, 0x0000639E4EF8FCE3,
+0xB958FD3402A5615C, 0x02051A8F6A81D0E9, 0x02320080232B3238, 0x8C3DE09615FCA94F,
+0xCC1F7844BFEE22C8, 0x7BDFB84EE5FA13F7, 0x76B0924D107F630A, 0x50F40FAAB87BEEDA,
+0xBAA92CE0A332B802, 0x417D52A996D53BCF, 0x89735031A325306E, 0x00004D1290605657,
+0xB8B589B3F7D6D33B, 0x4601331A9209B0BE, 0xEE2C47CCFF57A91A, 0x3B88F4D12FE8D7FC,
+0x67E1ACED86AA41D5, 0x90A86C0C208CE5E0, 0x61935237DBFFDE7B, 0xC1DEAF707E6BBF2A,
+0x18187278F7978DBF, 0x86DDF72FD21141E8, 0xB79D2CB16BA325BF, 0x00004AC2BCA0EFAD,
+0x7A9ED07985BCA651, 0x776393BBA929B66D, 0xE77E2AD1282EE3FE, 0xF53DAF07517FFE23,
+0xCA9328E9C00467C6, 0x3D1D348E8E784789, 0xEF85D2B93EA29F31, 0x5DC4406D5FF1BFB7,
+0x364C46285D89581F, 0x96832CB3693D5243, 0x73AD945E22B0A896, 0x0000450A2AE8FA87,
+0xDF27B6DB94EB16EB, 0x2D9E048C8E36313C, 0x578730A9CA521FFA, 0xBDE5539AF9B6FD64,
+0xB9D87E727A6873A7, 0xD609436C081BD35F, 0x064F215E1EC57F04, 0x0406FD45D23D2437,
+0x6DCA967E92FB5640, 0xCFC032E633798D55, 0x6E3034F499EF8ACE, 0x00006D4055C686BC,
+0x0450DBAD7826E64F, 0xB8591B5589D0E4CC, 0x154F688D59D5EDF7, 0xEB824173E395FE3B,
+0x9E8DAAE6323E90D5, 0xDF36BE55CE833AE4, 0x85552D6A89816FB3, 0xF45AFC0F718F85AF,
+0x0957711FE0EDEA69, 0xDB1C052B68290E72, 0xB6618DF267699305, 0x00004286DB7D57B4,
+0x32C038D671BFEA58, 0xEE579932191F5695, 0xD3A1463735EF53B0, 0x7EF4022AF1D1DDB1,
+0xA87DD32354BB7A3F, 0x7BDEEE767E3C96B2, 0x0330DC5589C9C1A0, 0x8C67F3E60CBDC136,
+0x9053B984D098F515, 0x2D3C0240C3FC9B40, 0x82C6E7F762D20A82, 0x000058DC82192D53,
+0x86C10DA455B71682, 0x7CFA753F7B11BC21, 0xA30CCB8982447FD2, 0x2A82B6AE7E053D11,
+0x94C2A11F97B7EC42, 0xCD6B606CF96C0423, 0x299577AC040C2B58, 0x357DE478EAA1320C,
+0xFB121AD08922622A, 0x0942D8AD1F89F14E, 0xE977C262400DCE85, 0x0000322C67473129,
+0x7D51FCDA7E9464A7, 0x65427E0DB1FCAFFA, 0xBAF988BBFEBA52CC, 0xAEE6B3B1B1F2E3E1,
+0xED19B98501126F4C, 0x989F7AA450CAE3A9, 0x2429CE94E10C8FEB, 0x20C6339422A34EB3,
+0xE57640D5759323CB, 0x06D3B23484981058, 0xC8CCEF5C18FC5847, 0x000038C5F51BF3D9,
+0x785B98B4576848B5, 0x99F989946D3FBBBD, 0x06E196608F008AF2, 0x906CCCBF8F52BD05,
+0x14B43A11ACD26807, 0xA02C16B051BE926F, 0xF95309979FDE1BFF, 0xC858CC9097163C20,
+0xE3C96DC5C6415FB0, 0xB47E73EA5F05DA70, 0x22EB6B25BA78EEBE, 0x00001D14D8C000AF,
+0x4FA79C01F062564F, 0x04121E46A1CBA6CD, 0x309ED7FF2C590F68, 0x5C7DB14AADB23DEC,
+0x8933084BA48A77C0, 0x9AB121DEFB586223, 0x7BB04C5E3916424C, 0xF56182FF1900F4DD,
+0xFEEF0431A1347C2C, 0x900E70F5F595DE75, 0x2A193C8EB94ECBDC, 0x00001352A9F38A87,
+0xED85D58FAD5B8A16, 0xFF6DB6D9E13BDD6A, 0xE2AB082D8B231EA8, 0x39CD8AD4430A8A52,
+0x036FC229281F0F52, 0xD932230D2F480B08, 0x1214186FFDE149FE, 0x97D4012C402F9054,
+0xFCC10B4A4F737610, 0xB2FC85C214865E74, 0x120BA05EF9282541, 0x00002C1B70B9A387,
+0xCE2A95FD37AA2EC4, 0x087C2A2F54FA5B08, 0x483DFC12607C0BE6, 0x8C903D19FC0E630B,
+0xE81745DBE1D44522, 0xD18A0417891B6EC9, 0x44FB3EBAB6FAD7AA, 0xB8691F3C4194584D,
+0x1CD2B6B9A083BA53, 0xEFFE8A986435FE81, 0x8FF75CDBF9178A47, 0x00004F2EB0696D5E,
+0x90DD4341AAA168C9, 0x28B782682479CFB0, 0x75634E12A6DC6F6B, 0xF6212EE16C3DF656,
+0xBDD660A56E681001, 0x20F9DAC4BF5B06A1, 0x93204E341122F28C, 0x4DDA6BFD50115FB2,
+0x7BAAF2C8FE1739DF, 0xAA69F33C243D13CF, 0x0CD9D75D6429E2AA, 0x00001C67B15DD2A3,
+0xC65885B37A543F92, 0xC95E1FC22F0E96FC, 0xE1716CDE1F2A6D2C, 0xA389937FAAF271F0,
+0x008FB2040B38084E, 0xC43295470FB7B5DB, 0x5A3AC9C54F9C2A7D, 0xC8F2F611B806AE99,
+0xCD9B7C7D1DEE7D45, 0xFEB4F5EE7FB7C441, 0x0B6916C23E86C657, 0x00002717036082CF,
+0xDE89E18DA7201987, 0x8402E06ED299E8DE, 0x5EEB85297FE61587, 0x747D52B32B32E496,
+0xC06202C52666C4B4, 0x1CAFE19D25365F8D, 0x2DFF371AE4675FFE, 0x7489CA10AC4DBA4F,
+0x524DBB641D0C1DE7, 0xDE742C0E2D53607C, 0xFB82D68BEA1A4630, 0x00002A714B420993,
+0xACD0FBC10734EA96, 0xAC939614EE86D95E, 0x7402AD40135A57C3, 0x475A112313BA088B,
+0x95D2B52AA220A62A, 0xFE52BB50BCFDFC40, 0x4C2E252D9D68705A, 0xD3D70FB4B7A8B366,
+0x024693495FC465D7, 0x69EDE37966AE591D, 0xD545A3D64909D52A, 0x0000402AC17CF819,
+0xFD2CFF66AE70F37F, 0xA35652277151EEE8, 0xEBF7414762F56792, 0x8E63979C40EAAEE5,
+0xCE8D40B197B18FF2, 0x81A13696C499B9C0, 0x1CF13C0E0D7DB872, 0x0267BF7278B8AC69,
+0xA3100F5BD05C3EBB, 0xEB3F9C610527AF22, 0xB8B79546C798F831, 0x0000351AA9666C4F,
+0x333F96F7680A2002, 0x78C89A2C5A6712EC, 0x11996C79C8E45AA1, 0x12A9763064A1BADA,
+0x3D2021D99FEAA851, 0x092D02C025FBF49A, 0x53943E2FDC28E046, 0x773F63998AC924B8,
+0xBC087004336F5EB5, 0x02FC558772DC29B3, 0x66E9E83A8F2BA86E, 0x0000517BD86B04D5,
+0x7DB668E8F5F2CA7B, 0x3CCF52A85CB91D6D, 0xFD68C719262C0204, 0xE1B8BF932CAD5C79,
+0x4C04540FCDC02FA0, 0xBE624CEEB3896304, 0xA0D13DEB3B63D31F, 0x349990FB0C0F0BED,
+0xA60F58349442E7BD, 0xF7F0322DEC9EE10C, 0xE4339E37ADBFC199, 0x00002148135D9E8A,
+0x4D9888D41F005A3F, 0xC63EDD3BC9E6AB3E, 0x65905BD14D114D9E, 0x4E5283F9A062434F,
+0x6171167E653487AE, 0x9BB1DF05F273E6A0, 0x526E38F68AF63FAA, 0xA5CFE239970ACCDB,
+0xDA12E056AFA670AC, 0x26F576E9FF0E5DE6, 0xB16C28E36F9A470C, 0x00003711E3F9822A,
+0x1552DB93D5A6E4BF, 0x7859BBB8217911B7, 0x15A14043FDC27467, 0xA8DE48ABCC5F3162,
+0x31801A9AF8E8F31B, 0xBCF6B325B253BAD3, 0xBDE7EEA8F68BDB8A, 0xC25F42D963971F73,
+0x429DC3EAC51BC131, 0xC16C983353D2D456, 0x9CB2FBD0D27581E9, 0x0000160829732E87,
+0xAA9B222E3B7D6298, 0xF61C28842ADA048D, 0xBD365733BBAE88BD, 0x1B3994B37CB2F846,
+0x5A9300B4ADDFFFBA, 0x48C287B77C509456, 0x3B6D23A255C4C724, 0x00B2C8F96FEC9434,
+0xB5C74911A448B3FB, 0xA53BDE0DA9667348, 0x021E5E7ED23D65D9, 0x00006852670AE18A,
+0x7BB3488013E451ED, 0x13A29BB93E5AE0D5, 0x839C3A65300FDD02, 0x6C07C5B36B230C7F,
+0xA5DD254CAC43ABB0, 0x933CDD0243054377, 0xBCAB530EDF28F5BD, 0xAD4D6BDCBC1F09DB,
+0xD813B4015665E020, 0x148BBE16360FA365, 0x738D21525AB0FFE1, 0x0000393185990AA8,
+0x61DA901449157273, 0xC13843E4B3DB91D9, 0xACD56F1667918ABF, 0x70D2DFD007761BAA,
+0xF6539DC081DBE454, 0x07D454A0BF90BB38, 0x7E4B8904B9E49286, 0x0A889183B32E9F87,
+0x3A1627C61C111B3C, 0x447A1C0EEFDC3806, 0x154F96A382390643, 0x000018BD53169A93,
+0xC5CEB86EBCE1C5A1, 0x4CA677F66BDD7E83, 0x74F547B8810B1873, 0x2A3BCCDA38EB96C3,
+0xC0B6471C8FD9F72D, 0xBF8D50674FD0BF14, 0x55FA9ED76986BB82, 0xA4E5B1CE69173613,
+0x0B77B5CB74FDED2E, 0x563B276FE266C6F9, 0xB23843A44F188FCA, 0x000004795023F6B8,
+0xD7CE70D7AB57E78F, 0x5CF1D18E375D09D8, 0x7EE5BB3910842CFC, 0x08531FF8D7AE88E9,
+0x62F5E560BC0D4DD5, 0x70F3784C680A2C1C, 0x5B388D4CEC8B414F, 0xC92C7C09382F658C,
+0x92226E4AD21B3325, 0x97679F0718D2CBFD, 0xEBA9F54D2BAD2936, 0x00006BF6774558B7,
+0x6886CD18DA19FEFF, 0x1D62C8EBEB35FA72, 0x95A16CEDF5328E87, 0xE725FC7C991C563F,
+0x56C105329D1E6577, 0x1E7EFB6B4C48E6D4, 0x8F5AC52C2B85D337, 0x94CC2ECA9AF6EF5A,
+0x273B7A3E8A9133FA, 0xD48FD1C6D95D7980, 0x57B129CB64FE422D, 0x00000D40A2CE8619,
+0xCCEEB282D0DF8229, 0x32CAE06A1E76B644, 0xD7DFD1BACC7D601F, 0x25404AF78D02C5AC,
+0x7B374FD3703A6F02, 0xE985E955723FFAAD, 0xAC1522F932586F75, 0xF641DA8F77D48D10,
+0x0E4F12374D730BA7, 0xEA575B7E23517E1D, 0x99B980D312FEE06B, 0x00003A922997CD86,
+0x668A2F19F581D8FE, 0xC007C1A7708CE473, 0x133E4E44E17FB406, 0xDE74D7BAF830258F,
+0xBC4B5398207C9C8E, 0x6B41E4DC3B72E53F, 0xCB235CF82C0BE884, 0x450F86B98A5D3C59,
+0xCB587CF322E71792, 0xC8179E57C3A7AAA5, 0x77C86AB0AB981EA6, 0x00004FBA8FC766D9,
+0xA067DF8C3B7F254C, 0x8FF0A00C7A486A30, 0xF9DCEC13E1D3E30A, 0x9318E920C7230729,
+0x59EB7B1E1F2053A1, 0x0A052161E4E47BBD, 0x8034ECD624726E03, 0x513CA3AB307E56B0,
+0x6ABAAD779F1CEE91, 0xF4A321053D36EE16, 0x1F2AD84A4D02F512, 0x000050ADB110BB67,
+0x79E86350089D50D1, 0xA5AAB94E7903EA36, 0x2A27B54C6A22915E, 0xF3419CDAF1B1B1E5,
+0x849A3FDD568553BA, 0x924E14B2566B38A1, 0x78289A2119936E4B, 0xC2D59B5364764863,
+0x89B3FEFE72CC2E37, 0xA4591C31FF48B49F, 0x7F2B9E96AFFC79DB, 0x000032D649790598,
+0xC8D8C8A37BC5065B, 0xD2A24E309BEFA58A, 0x2815D1E6F8249DEB, 0x89F98E61EC09962A,
+0x987610129678809B, 0xCCF3A934297C1D4C, 0xB06DBD328B08E2B8, 0x877BD6D6615092B4,
+0x9FAE2C1E8226F5C4, 0x2647043456D83162, 0x30E0F274D3C187E3, 0x00002A33FA2335F6,
+0x2A4ACDA657B3701C, 0x0CA963814801F54D, 0x60987445BEA56DC1, 0x4F4F7C20228B6E46,
+0x2F11D6B81D2BE756, 0x687E39C562C30F8C, 0x0E24030E7ED34EDC, 0x3A4BD5241B52AE7F,
+0x49653814A11DBE01, 0x86C4CBC933B56C12, 0x8B2A73112AEEFDAA, 0x00002A7195B0C635,
+0xB9C3D577C50832CB, 0x5244C5D198BEED76, 0xD5C1C35FD525A0CE, 0x618169F6045685C2,
+0x3FEE15A963AB8D5B, 0xCD6ABB3BC681BB5F, 0xE6470EDA1968327F, 0x9E000D30F5996F77,
+0x0B1B531660004D14, 0x6A4CF0DE08971A7F, 0xC8D7F958AB1A7D76, 0x000013F6475B092B,
+0x0971ED860D18ADA0, 0x518AAABA144E160A, 0x0D9755ED4C7C232F, 0x6A3EA726DC191280,
+0x65B2067B2E57AE10, 0xB37E4034D65A681A, 0xB40766E3A480BD6B, 0x58FA9E9AFB01A1EE,
+0x707B44C5568D1947, 0xBC655554579780BD, 0xACEE324AEE77D90F, 0x00000DF3E5F1DED1,
+0xF9257E2C9942BFFA, 0x13877CE55F2011B0, 0xBE93EFD489B0D544, 0x03AAC548B7F83296,
+0x238557D17B5B5F6F, 0xA417A0354CEE205E, 0xF99D6996E1A05ABB, 0xE5FCE397A1BC822B,
+0x9C17581B42E47A82, 0xA5490E5CB648BE6B, 0x2F39521A18325DFB, 0x000023C43C89236D,
+0x3B0FE25C60FD0F99, 0x571A0C32E14C31D8, 0xC5BAAE2E1A25E905, 0xF7F29550F32B244B,
+0x268BAC20AF6E913D, 0x0CAF19D456FA436F, 0x8EBB4615F082FA1C, 0x2D554CDF5811C92F,
+0x59D168DD8F47083C, 0x53F61C633D6F5F6E, 0x3707035761E9C5C3, 0x000049F0CFA9209A,
+0x86C9A109A31DF519, 0xB0C1ABA7C3468FC9, 0x700CC37FF1B25B20, 0xF315AB7C5860DBF4,
+0xB32025E0E31B4494, 0x430CACC93BD0BF7F, 0x590CBA2E32BA1400, 0x4BADB09BCDF3A41E,
+0x8275F76B47DBE888, 0x14590CFB2D32C805, 0xAE005FCEB724690B, 0x0000562E8FB42364,
+0xB0C5BB421B9A10EF, 0xD0873BF25A8E0D00, 0xF7A3E1AF748CE956, 0x32B837494F08A030,
+0xB08D182B5DE7AA57, 0x9D62830E7552126B, 0xC53AB0648F8A94D7, 0x344DC04DB6E744E1,
+0xA90AE5726C8FFD3A, 0x957BCA0918BC1B13, 0x697CCB9FEB88DED0, 0x0000604924A661A6,
+0x6025764D611948AD, 0x26492AB0D39A8746, 0x81E2DFD468FD1DFB, 0xAF04B897ED8D9EA9,
+0x4BBEBB2FB7D45E2C, 0xEB1437971BF2E880, 0x82A41EF4F7EC7BAE, 0xC5893F1A9167ED01,
+0x5C9798CBBCB7AEB3, 0xCDE8BD6F25EE947D, 0xB1C3EA3F2C56EACE, 0x000013977D1D9065,
+0x151A08F94D6E5D29, 0xA036DBCE36815FF3, 0x202496369051C8CA, 0xD8A2FB38A822CD2E,
+0xDDE3637F0288D425, 0x62F286355829AF65, 0x829B784988582177, 0xD534DDCF82CBC34D,
+0xF8F1DEAE3DE441A1, 0x818734BAC5BBD250, 0x01B5AFC1FDAF8C75, 0x0000634F48278AAD,
+0x49B446C59BF76239, 0xF879C72B64E64562, 0x4AC19A66BCC7F564, 0x4364ACAA1E9932B4,
+0x8234E583C71536DD, 0x526621863D58928B, 0x6ADA75DEA7FEDE49, 0x49BC6A92EACA7918,
+0x38E2AA18C26CE2A8, 0xF99F81A8B5193E5B, 0xABBFDCF165EE5B00, 0x0000121BAC9BFA87,
+0x66D065E80491F72C, 0x3019A2BDE458DFB9, 0xE8B0ADB8513C58ED, 0xFDB27DBB1E5C3E90,
+0x46D3D0DD55AC3359, 0xFF342E8580435FA5, 0xF1C7E6C1BE93A6D4, 0xB043EAC2B90C4D96,
+0x2E9735D971684E6A, 0x79DC75B208C73E14, 0x33E08972AE2FFF04, 0x00004C245795DB5F,
+0x8560B779B39A15EC, 0x5FBE14E23C3786AD, 0xD514EE1B1BE7AA81, 0x4C403B5BC155CC12,
+0xB452EB3C0F3FDF5A, 0x57C3155554D40C63, 0x89DB6DDB2256C466, 0x93C8DB78BA6EB112,
+0xE32D40DA726169C6, 0xF0F0C21041E33C2E, 0x71DE45CB03FD5E38, 0x000023B389BBAB7C,
+0x5883764CD252ED21, 0xF3CB7496C4E8CCEE, 0x7554B18E2A702A05, 0x3BB509CF7D86F5CA,
+0xB14E6EC05D52B335, 0xC488042BA35BD796, 0x2E2F27641049A62A, 0x7D99D8B627F9EA04,
+0xE3788326C22FC8C7, 0x5A04B0B4918E5A9A, 0x70AC2C931DE5CAE4, 0x00006916E82891C0,
+0x1D74A8E37A04A4FB, 0x0753D94B8EFC25B4, 0x52F272BD8F794748, 0x625FF4CB2FF1FEE3,
+0x6267E4B174A97112, 0x17155379EF7238FB, 0x134690BB279F907D, 0x508FE78E6DEC88B4,
+0x2DEAC420289B734C, 0x5376A559F675A47D, 0x2DD78B3ECA4451E2, 0x00001A57E689BEAB,
+0x098C725A3F445A55, 0x785E6CCF8D630A41, 0xB7A3DFFDA8F29C27, 0x84D9E2FE6C6B691A,
+0x8C681985F4F4FD16, 0x75EA88347A53A87B, 0x28D7314226109909, 0xEA01CB194E6293F9,
+0xCE16432D3C581F9D, 0x8D8EE639AE01F6A4, 0x9573933F7D51356C, 0x00004B4FD17E91D0,
+0x322BF22B760FDBFE, 0xFAFC93CA3CBC05E5, 0xA24900990FE9D952, 0x43BB2E6A0A148F6A,
+0x1BDBB2C22BEF42B0, 0x04AAD3D8C248CF9B, 0xB6D3137B9B4DF28E, 0xC82C0E7B32639B03,
+0x816403F327533CD3, 0x21FCC2DFA29368DE, 0xE6C27B53D53264D9, 0x0000343710A26E73,
+0xC68D4AB9BCC05C03, 0xAD8D809F19C07C94, 0xFA91756DDFC0FB30, 0x0B8671AA525288A1,
+0x5E82BDD3D21D0593, 0xE142CB7C3F650FF2, 0x4F717156161A0EB9, 0x94F0B916BC2C3A03,
+0xD82C251713946637, 0xCC78641DBF4B05F5, 0x274F8BAE2575490E, 0x000048B380FE210B,
+0x26EC1CB5D663E162, 0xFD89E503D9C0CDB4, 0x0578A911C770C703, 0x77ECC4A4E251EA67,
+0xF392E63E994E9770, 0xC3D279D016326836, 0xA364F52A1B61FC08, 0x1DD1E5D770DBC3CA,
+0x98117E488FC16729, 0x4C82ADA2255417C2, 0xB44430EF3CF5D16A, 0x0000154E2F7193AC,
+0x1056B977000A8824, 0xF4EDB6307D65F1D1, 0x7C83D75102A6742B, 0x4B2BCCCC4A3A0D0D,
+0x6BB1517C0B196AE1, 0x098903D1E72E20B0, 0x5D3481B341B07060, 0x4853FEF1DCD7717B,
+0xC863D5891766E1CF, 0xE7AA307F53E7625B, 0x867A20FA40E7D72A, 0x00000CEFBDDC4172,
+0x1CDC54C00E77F67C, 0xD825DE597F67D5DA, 0x57D1FF99C628806F, 0x0940BD48293D32CE,
+0xBA33720C391ECC08, 0xE8FEE7CA1B71B526, 0xEB179C1B0B30BD6B, 0xD10ED4EA450F1A04,
+0x0969265F340B479F, 0x6D4880C54FF654A4, 0xBFE74AAB547112BC, 0x00003FDE0A94EB7D,
+0x8D3A33259A571C04, 0x6F3270D9D216B719, 0xDBB5CE6900909967, 0x3EC4C76BB8930DF6,
+0x4DB5BED22C35BD67, 0xE4BF867D5F566EB6, 0x1DB405A870B62C19, 0x907825001CB44BAD,
+0x16E2A410A0147B93, 0x08A8C7583F1AA716, 0x001C9B32C0DFE331, 0x00000C72B29A8F97,
+0x3C00F8E44420B987, 0x524C99E29F7F8B53, 0xE88FC753C9FBEE88, 0xC5A4F3577B89BD31,
+0x721CF4E66847D983, 0xA81CC60F7169124A, 0x9825AD229E01F31D, 0x84A641EB7A793B4F,
+0x1062276A2426991F, 0xE241BE684576C79A, 0x1FE236008F366350, 0x00005108757FACA2,
+0xE0BCD89D58F3734F, 0xB8155296CCF6081E, 0xD4E8516EF561CA80, 0x508D01648758906B,
+0xB6780A47845A5765, 0x5CFD92B9194879E8, 0xCC78BE25395FCDBC, 0x6EA06F4F3EFFDDE2,
+0xA3FE9EC62B3121EF, 0xEACCBE8BDFFAF39A, 0xACF6671B8976ED10, 0x00001899A28E759F,
+0x4B26710D18F32C7F, 0x61225F5C4B91F4DF, 0xBEF74BF7DD4EFACB, 0xDD334E3448E57CB0,
+0x920334721BE1D5CD, 0xCF13F15F82981507, 0x4B1E47B6044F938C, 0xE706B5B5D572BC7C,
+0x0E61BFBACA991AE6, 0x117BEBED151F9E6C, 0x91F02F283E8F9224, 0x00002015411DB442,
+0xD61CD3CE57A434F7, 0xAF0128D7784758BC, 0x6975AD099707DABA, 0x44E0C872259A6984,
+0xA53D78096E647A09, 0xDDF842F9E4AE6CF7, 0x4D43D8C1B0BC8342, 0xFC0F22439238A6E3,
+0x4994AFF1F94ECB9A, 0xBE23D3CC79449E52, 0x93EDE4FB16BCDFCF, 0x0000522CFD9066E2,
+0x74807B2A7537A30C, 0xF3DA11966569AC80, 0x2FB82E6E60945264, 0xA572C125DFB0CA1D,
+0xDD00191C979B7300, 0x01CB4143AC3AD2ED, 0xDBAB28DB197254D3, 0xB01C1DD202F6EC81,
+0x6225F49520AFA72E, 0x7F59B73B3520BB0E, 0x45C3333D157EDECF, 0x00001CBF56990A04,
+0x46015A7366DCE371, 0xBFE326B50EBB9D70, 0x584C228F42929422, 0x1435E26916050E03,
+0x697599A5ACC74DCB, 0xA0257870E518B2B5, 0xA3EE471DEC9FCE29, 0xBF0D92574F4A3010,
+0x6E9F9DD5AA63024D, 0xD546B8A50EF9180B, 0xF4AB61041AE97A3D, 0x0000566D2C229331,
+0xBCEEE989CFF4567E, 0x9D3A7AB844582886, 0x79DB61BAD4646CE8, 0x86B30526032B304A,
+0x68D616937765B4AA, 0xCBE9B3B228AC543F, 0x689F3DCB9119DFE9, 0x1E7912BBE22BB27E,
+0xAECEF36F355A1D35, 0xAA1688E4AF308759, 0xE76030D9E604FFA6, 0x000000BAF4EAEF07,
+0x4A4AE654E3A131A1, 0x26F72906E1DEBD1F, 0x902DDE7435056574, 0x0FF61C04520DDB8E,
+0xFBE951D189DE9D64, 0x1ADD9BEF20F1ADB1, 0x3D38D21B4A67E874, 0x2128791A0A8FB4C0,
+0x35FC08D2F485EE2C, 0xC36A7BDB4D0723BE, 0x957467D475DBAD29, 0x00005870C9E1377A,
+0x7D5B1432580B796D, 0x1E9C7389D63D14D8, 0x55DA19823FFD4823, 0xBFF91BBF82049D78,
+0x28150A158F22D9B7, 0x1ACB03E42E119505, 0xB5B3A7F4AE02A20F, 0x7F421804E725C8E6,
+0x0D7EF286DB2C801C, 0xC379F5497556A15A, 0x0E64ED1EC925DC4A, 0x0000235F277C7DCA,
+0x1779E0EAF47F218E, 0x40CFEBA9FA6134F1, 0x7178DBA03C216E8D, 0xF476244DAB8275C7,
+0xA682EA5C71A3800A, 0x9FB06FA53E4A4BA7, 0x740FACBEAF8120A4, 0x9AF6A562AD219783,
+0x680CFB9D21A6A3AB, 0x386F50856FED3B68, 0x7B6F7307E104302C, 0x0000045499B4BD94,
+0x7FF72A0FC8698D81, 0x35405F8B189D38A3, 0x83E4B4C97DAEC076, 0x03F776C4D89EBEC1,
+0x65ED118ED0AF8FAD, 0x58F774247C8DE2F2, 0x5B201B733DF4AA81, 0xDFCB57B67C9FA76F,
+0x1AA741AE4BB5B8BA, 0x50496241F323F201, 0xAF1C57652E93236C, 0x00005E78919D48F6,
+0xAFB7C1DBFE9CF25D, 0x48D996908E4C4CB4, 0xC543CCB6FC61D800, 0xF6B3E508A3C3DDCC,
+0xDDC8B754F865D846, 0x56244EC95DA4F1DD, 0x007EA25285318DBC, 0x0417A3C115205588,
+0x94228D38654DC907, 0x6A45FC8122B0102F, 0x2B1C596158AE99CB, 0x000038573527C67F,
+0xE8D765BD829A2D19, 0x5AE70E357EC5593E, 0x8DE75A615FA17AFF, 0x3F5C5F9FDEC57EA3,
+0xE1110C013E454E37, 0xB2F121B74E45F283, 0x34847171EDCC1B86, 0x0EAA94C3816FA9BF,
+0x7C2FA32ECDFCB3AA, 0x4E1921E66133B3F0, 0xC2F8671855EE2CFF, 0x000011F841F44422,
+0x32F743712C04C362, 0x53F0685DD5F57F00, 0x13086CC836FBCBD0, 0x98A8151255387F0C,
+0xFBF5D2C2ACC1339B, 0x11A727B2E42E74E3, 0x7C7EAE3A969DB0DF, 0xA3B5B5D465910179,
+0xACD712468BED31F2, 0x531FC6CE41CA6572, 0x26DC60B2FFF61E4B, 0x00004F447EB644C8,
+0x8C9E31A8613A0B95, 0xE728005F7F568679, 0x7DA834E5F67E0DD4, 0xED122AE1B8FEE77C,
+0xCB9387EC79C6418B, 0x6DC5ED46063BB07D, 0xCBB0F04024988FF6, 0x0267DDCCA99D2875,
+0x984FA591CBDF100B, 0x8E7C0B6B715678A9, 0x3E3C529B663E361E, 0x00004AC2E8DD3313,
+0x8281CE1FC59C468C, 0xA709A1FDFA0AC0C5, 0xDA7C98E14DA3F753, 0x2C65EB50122152AB,
+0xFB7F52A46BFD4A1D, 0x386BCACD728F4E3A, 0x558F483C63D8D707, 0xC1184D55D3EB0BFD,
+0xA726941676FE8E0D, 0x2F1645F875F99CD3, 0xB92CC5F53A3DB797, 0x00001233A19C8D8E,
+0x0090D2F96FFB0B37, 0x92879E878A151BF2, 0x6F30BE827A22F4C8, 0x8BDAD2E76BA6E4E7,
+0x3F21DBD84480C1F9, 0x0753D7FB4F0FE2C5, 0x02A2EAB28062F082, 0xD5BCC117A2AB04A0,
+0x23867BC390D3A0AF, 0x051F95C5D6F84B02, 0x7A02E10D656CF804, 0x0000244906ABD4C1,
+0x7A5EE85BD96F0A9F, 0x9851EA874A646231, 0xC93D429A4CDF16AA, 0x291986529354B34C,
+0x88F4121C78009B1B, 0xA35BC50BB9B6C797, 0xCE7F455075955C97, 0x7FF6DD78F4A06878,
+0x6FF85DDD19B2789A, 0x1BE3248AC3242056, 0xE5F75618C91BD2F1, 0x00002812F79703E0,
+0x8B3C4B29A9621C76, 0x07574EE667FBD5C6, 0xC7AD107D043FBC03, 0x6BBDE9EDA54B07C4,
+0x19969B1B84E086B4, 0x4D6ACD8B852D86DF, 0x3E24D393EF0EFCBB, 0xDBD651E3C4F3E8D6,
+0x35A49343E53CECD9, 0xC3BC249722EAD992, 0x0BD4D6E0B7800EDD, 0x00003DAD815C5835,
+0x5F2ED52303B26427, 0x2D55190357A83A25, 0xEEC68E438A1BBDA7, 0x709AB513C2C917BE,
+0xF179C689D9B11992, 0x4CF73E04B2188C04, 0x81F1625CDFFC9079, 0x8D4739834086F39B,
+0xD3254E2164701CE2, 0x210E60CCA7016849, 0x47CB73C178FC98CD, 0x00006614FDFAC440,
+0x15337093F735DFE7, 0x0F2491DEC0689016, 0x572240221888B70B, 0x3880F987EAB6FAF0,
+0xC0FE29AB598E3183, 0x67660CEB2688C77D, 0x15167D92F0E3BB91, 0x8E35EC9C92EFEFB0,
+0x5355FF8D796E58B9, 0x70C11E841218A7C0, 0xE1FB2D52F11FAE27, 0x000010316079E7C3,
+0x63E4FF346FF030A0, 0xA121E646BC9EA9B0, 0xFA47576632091D15, 0xD11F89649919B772,
+0xAE720106ACED6C2B, 0x7CEA8898C58B7B20, 0xADB47E2DF1EE47C2, 0xBB508D89EFF32F32,
+0xB8D283C2C13343E6, 0x0DFF4E94A5497691, 0x83BA09E28EE40707, 0x0000387EE1E05DD7,
+0x82E1BD43F87C0B07, 0xA8E5860DF045348A, 0xE162FE1C1606B7C0, 0xD7FACC25EF3B8DD0,
+0x2D8692ECA1CA6C49, 0x7060FFCAB32BD688, 0x2C4EE5C1AC9AED37, 0x01A9DF6A093CC375,
+0xE1CDC1D4D032734B, 0xE8151806ED0296F9, 0xB02F336BD14F9120, 0x00002FABFD56B6E3,
+0xC841AAC85EBFBC54, 0xF9B6ACDC1926E953, 0x3EBE7BD141D217A4, 0x136CCFF4CAF8D27F,
+0x6575DCCCF92D1D6D, 0x5AEDA2D78BD6C460, 0xD4ED1DBEC455888C, 0x9D23AA4CECF83260,
+0x9E4396482201AF6C, 0xAA7EA3C6EFA7BD49, 0x4CC8ABFEDBC1AF51, 0x000014383836A22C,
+0x72AE08EC57BD25E6, 0xF8D59B47E23085A3, 0x7570EC61E0C07470, 0x05BF46CB61F8C953,
+0xCAC433E366F9DDC6, 0x4C40BDE4B2AF3824, 0x4C0F49E295BA348D, 0x76DDCC478AEEC82D,
+0x5B3D982BA487BC27, 0xB86D5D79C192B342, 0x63B40EF822EA0B87, 0x0000327AC28E3D7F,
+0xD862C22D3BBF6A83, 0x8A66A5963B4902C9, 0x052C5FBE27C382E9, 0x1744D47CC6BB9D67,
+0xE34ADB41976DCE3D, 0x57158B8FAB005E72, 0xCE65F7415DBAF5E6, 0x54D4B6987F57F6DC,
+0x01F96FA35B45847C, 0xBCA047B5D5C57B32, 0x0FE2B51E8760D040, 0x000027B66EFECFA1,
+0xD5300F1AE0EB6297, 0xA934AA7504D79963, 0x865A8D176AFA4003, 0x8226A47A6F030FB2,
+0x16AEB4CD10706B63, 0x2166A6D94FD0C77E, 0xE784E667EF29C5FD, 0xAF5C84DD0515FC4E,
+0xD46CE86CCC0571F0, 0x215B07FCE5C99A1A, 0xF6755FC3001C9EE6, 0x00003B3AEEFA345E,
+0xE2CA1FE098BAFAB5, 0x567E0CCC0CE5E2F4, 0x86F315EF971F328E, 0x91C99C78F90E6E22,
+0xC8F53B0938EB92E8, 0xBC783EAC3FC665BA, 0x8E4941326839C3F2, 0x54AA49858F7BC0B9,
+0xA003E1925F188320, 0xB2181AAA07D0EBD5, 0x24B056275301A0D4, 0x00001982EB37CD63,
+0xB6623F4F029CDBF2, 0xD61DAAAE1538700E, 0x769FD6037B1BD497, 0x346437B837952BB0,
+0x210C7AB2435613D9, 0x65F640E4BC18D68C, 0x80A264849825F4D2, 0xC140BE31EF867B94,
+0xCF12801D768B2ECD, 0x554714A896E20F28, 0x7566C93999BA18C3, 0x000035EA84BE322A,
+0x249B395AA41928A5, 0x8EBD0237CF421C37, 0x9295818975AC6537, 0xC56636D2F842447C,
+0x9591BF46A85940C0, 0xCBC9DD0BC52D5F0F, 0xF48123F7433B1D8F, 0x00D91E4E214FC82F,
+0x7B1F77677840EFE7, 0xD54A36BCAC3A3F39, 0x3F0EBB3ABFB78317, 0x00004530606DEFCD,
+0x7E9F7ACAD13C1978, 0x42C695E67C574737, 0xAA835CB2A2374509, 0x58037F5138275622,
+0x4DAD2FA06DF29FA0, 0x3A904A58518B9DEB, 0xE546097DFB1F42EA, 0x4B17552EBE6ED86A,
+0x7B2B3E492C01B6E5, 0x7AE6CE4716911DA9, 0xB0670ACF544B7BD2, 0x00001EE8D41DF90F,
+0x855E513486B9E162, 0x450BB59590DE5920, 0x0149693488D11F7E, 0xBAA007E489EEF3F6,
+0x0F65D448754E7D22, 0x06E96070163DE14F, 0xC6D083BD972C6C7A, 0xBCE229BA35EF0BB2,
+0xC9BDE3095D018F6A, 0xA487EC530C62B2B9, 0x950C648CA8CCAB43, 0x00003B87E4019F15,
+0x2A9D2540A4A7EF1E, 0x59E4302328EEC0E4, 0xD28560D37D115BEB, 0x8CDA7C71538697DB,
+0x949DA52EEA484672, 0x8E69FAB9960B29AE, 0x4F237FF509173511, 0xC185AB663358D3D3,
+0xDF4D3996C5A1209D, 0xDC1E6D71E42C22C1, 0x9EB8880AED272BAF, 0x00005AFC823E7BA7,
+0x4C801A9B5F1D116C, 0x4768E956FB7F06CC, 0x15797D6089BAFC55, 0x2EAD899C2DECD490,
+0xBDBD2517A7A71599, 0x2D29CD9C122C55EA, 0x315D7D79EF8E481B, 0xFB5BB589F9FC4245,
+0x67E3D99731FC0222, 0xA1B713DDF1BA4767, 0x4A5EEF410AC3C0C1, 0x00002F8B1EC3AB7D,
+0xE7D087EFF4172343, 0xC4CEA8596C2318D6, 0x6D2E5BB14A8B1526, 0xA0DE75D8C1BCBDD0,
+0x79E67F0002523ACC, 0xAA39CEEB60CC5ECB, 0x242FCCAA8887F2E5, 0x67118C5C79D91614,
+0x698C26AFEA639DA5, 0xC3B78E4916C9573D, 0x9089E5ABBF6EEEBA, 0x00004FEB427A542F,
+0x4AF3A448056361EE, 0xBF349FA10DA1E972, 0x9D5A3F4FC9B1F735, 0x0A2813F5536E0223,
+0x33056150B67A03D3, 0x56B80391B39D1016, 0xD4E631E6B5FFA78B, 0x68165196A7029D40,
+0xCF02FECCA12066C9, 0xACC5531E22628766, 0xE65B7F3563527144, 0x00006F9789BFF01A,
+0xCD18015EFD4894CD, 0xF6D1AC9D7258B58E, 0xB3FA04FA0332F64B, 0xBCE4F0E0E9D26B70,
+0xB7C47B30C2427DC3, 0x8B120A99B9B768BD, 0xB2DF7F8F69A99C5B, 0x2E4711558459681D,
+0xDEECB3281B4F26BF, 0xBCAEED437AB088BB, 0x824256B4C9A9BE3A, 0x0000637CE366CC5E,
+0x37828675E2C3B9AB, 0x2CD9D69292096FB8, 0x5FD241E87CB37C0A, 0x6897BF7FA765106B,
+0x9979F288219D4F36, 0xF2430E463C568C55, 0xCDB5950A0791090C, 0x54C24EBD97D9A610,
+0x9D8DA73DFE956D0A, 0xD850D859E675E7BF, 0x969DF155298BD6B6, 0x00001B758B3032DA,
+0xD347A11CA90AB78D, 0xA90BF1250BE070E4, 0x5E6928E0FCE5113B, 0x6FCBBB5BB1FABE27,
+0x1FC5095978129368, 0x98F6B635F0C60127, 0xE81D55E2F7E997FA, 0x29C7D61C3A1ACABC,
+0xD713D2D80CE565E8, 0xF4A3BFEB1BDFF6F0, 0x124D3C4854A45865, 0x0000004B23474F56,
+0x6F0CB863C958610D, 0x8B2B2DB5B3723F97, 0x2130646F3DE88FF8, 0xDE8D73D3E21C70CD,
+0x3CA367D2E4780E4D, 0x8B6E3FBBBBDCBE44, 0x30950A5F551D0634, 0xAD8F3A49E7A87BD2,
+0xA901AB59D28876A5, 0x3248B38935A16F4D, 0x351BA43D54B9B95A, 0x00002752F9D62BAB,
+0xD47CDA4AFC12EFAD, 0x5371204D0102DF45, 0xC1549C822EE82CE5, 0xD9B645C759EAEA45,
+0x595D1BDB27DF125F, 0x1A1BC2638A9C8E0A, 0xED8FB6DB077DE39E, 0x3A8991EFD94F4586,
+0x341A27FAF37A77B2, 0xA44A951E9F68B3FA, 0xDE10C07F49F92FEC, 0x0000489012EA7439,
+0x7845653F60403B6D, 0x269B17F22828287E, 0x9D76CB0F946A885A, 0x83470414BB6EFE1F,
+0x9559959E33B2FAB5, 0xFEC51DC568D6CECC, 0xB76FD407860F77B6, 0x355A8CDE439538A6,
+0x94D114938F78DF00, 0xA7A1495E5C8B5A06, 0x05D3E405E2322E22, 0x000013642DD5C85A,
+0xA0D64D07AB6C10CD, 0x05E3F227773FF913, 0x104DF6900D25E6BE, 0xAAE3C674E11F2950,
+0x7D75FBD087D671FE, 0x5B44E693CC47BBA7, 0x2FD983A2AB33E599, 0x739B3DDEA5DDEA18,
+0x2845BDD74CDFBF9D, 0x5471F723093CCC13, 0x8ACF715F2152169A, 0x00000D4142F323C0,
+0xA37A37FFE05569AD, 0x2C2209B437ABAA11, 0xC638261220036C79, 0x2B9C7FF85BF5588C,
+0x7E3702A9E2C48693, 0xE8D32F348C8E2B35, 0x359792EF1BEB4C53, 0xBA5F098FB53DA2B3,
+0x405B67A5620EFCDE, 0xF7DA4CE8387D437C, 0x5EADE09C8BA91039, 0x000019F60756090E,
+0x45D2325D30DDE23D, 0xC5287DAB73425784, 0xCA49FE337962A641, 0x575163150344D9C1,
+0xEA3763577F17F6FF, 0x532B19EBB298A4B2, 0x6B0203E60EA16185, 0xC1670C56F64AD0D3,
+0xC745E976BA173188, 0xB667080B482C811D, 0x174287279C7EE46C, 0x00006158F5CBACDC,
+0x7FED24693E658A39, 0xDD44D1CC3D9881D0, 0x66EE16A7BD0DA3E8, 0x8AF16D9F4206712F,
+0x111E7E43EEBD33E7, 0x8BA52F3F09FE588C, 0xB3C00386F8A51473, 0x2AC7E69A6BF85FE8,
+0xC384C11F28A66741, 0x8F0C39B0A15D183A, 0x1604C8F7AA730409, 0x0000203E1A330B13,
+0x5CACDE990E78A088, 0xA4D87219368B008D, 0xD9F34D69BCD1A3A0, 0xCF931B5E1F877208,
+0xFECC321C2DE82617, 0x2BBBD953655F2548, 0x0D9A4E7D2F61BF96, 0xF360AF3FB7164BC6,
+0x19CB5F51F06DB5A3, 0x6E74A79F4A6105D0, 0x507B93796D222AA9, 0x0000314F3CE75376,
+0x6F7137C2C8DC9FE3, 0xFABD33221DF547DD, 0x9EFE97F4BC5BA0D6, 0xF9796ABD71C4A8BC,
+0xA600C737B9E3E3F6, 0x7AF7E0BCFF089212, 0xE6D893135BE6944B, 0x661A4AD64387007D,
+0x5808DDBE7C33430A, 0x2B176AC677CF7BC7, 0x03E2D198705273EC, 0x000037B58D37AAB9,
+0xDE9620D6D81925CD, 0x82557E652EA6BA4E, 0xDCABB4A6844EA604, 0x488989834669E162,
+0x3E49E91C28C783AE, 0x470FF0E1AF38DAAD, 0x9D72AF7EEE301AD3, 0x786D35D246E8455C,
+0x5C26FCF4B013EAFA, 0x82153F09781E7A52, 0xA9040440FBB8E53A, 0x000010797D957B8E,
+0x1901255ACCBB368A, 0x62584A200A52FCA3, 0x33AA0F86898A0B3D, 0x831FCE1969BF6156,
+0xC57AAA3160D2D75D, 0xB5FAB5CF26A2191B, 0x5781721023DDD5F0, 0x35F7FA648BEF39A1,
+0xE6C4C03137E81D85, 0x3D4C3FADCE47B02D, 0x0155F274C5EA924B, 0x000041D92B79C2F7,
+0x7C62DFB446DEFB15, 0xB21B07E0CD0FCA1F, 0xA9934A4E3E82565D, 0x2E1DE83E6D340AF0,
+0x0411E7E26DDE15AC, 0x90644494407F541B, 0x9B054767F0FB4C99, 0xDC4BA6E4F0BB8A56,
+0x74B501001E94A513, 0x9FB9A778B192E762, 0x8BC8E0F7980F2BD1, 0x000058C2F1CCA038,
+0x7B95C1863C862E24, 0xB7CD4C394D0106C7, 0x8057DC671F801C93, 0x92F8CF0C50A93AC8,
+0x9DAA3FE6BAABAC13, 0x5660AA5392CF8E53, 0xAC047FE09B726CF4, 0x831B210E956CDA54,
+0x580A89602869D20D, 0x3329CB4CC9BC9FA9, 0xF73B89322AED2E59, 0x000010715C42D8C5,
+0x2EE62FA3018C8A1D, 0x87D7E9668574A0C2, 0x608BA42A849B7273, 0x9A7B15546AE516C4,
+0xE07C3C17A6215A8C, 0xB178C4597877C183, 0xE224CB6F3970DE41, 0x89CB288D77E44D68,
+0x5691DEB3801E32E5, 0x28C593C44BD28766, 0x08BA5F3476F7B487, 0x00003FFAE894D36B,
+0xF0DDD423737E9ACD, 0x1E1063FC2032F1EA, 0x7E56D1A1B4C1D25E, 0x9D89F091EC130CFD,
+0xF8ED73C5DCDF7281, 0xE74C6BEFA20E7F00, 0xAB87DAD890F9DB42, 0x94FF369178642321,
+0xCC67158794D66886, 0x49289B0BE47D22C4, 0x1ABA24C974D1CFDA, 0x00001D44E29976C5,
+0xEB3328A410C38970, 0x5C593D3652A4BFFE, 0x4B880AEC7B9D9A0A, 0xF14B68EBD41B185A,
+0x0ACAA965285E07F1, 0x04156EABDC4DE125, 0xA9F522C5F009115F, 0xDE43BC0913CAE87C,
+0x026C44B844744821, 0x6DD79821363390EB, 0x8BAF71E6679C0F0E, 0x0000444EABEB7C6E,
+0x06F67A146BBF7EED, 0xC1BA584D46552374, 0x4928E54F58F6E096, 0x826A460A7E2CBA71,
+0xC62C90DE18C291A8, 0x1BD18C3FB17293FC, 0xC5F095C3D85C3316, 0x273F0A040D652913,
+0x056C79E24A81D7F8, 0xDB662DF57531E675, 0x0193332B70079CB7, 0x000036485B81D3BD,
+0x3AEF9B6697CA0AC6, 0x4926391607F0973D, 0xCBDFE5399E2D1A7D, 0xD4828123BE1FEE7F,
+0xEEBFF5AEF0AEDC80, 0x215C67CD97AEA113, 0x21DA596C75559DAE, 0x28E7E19106571239,
+0xC480C46B5F8CEEC5, 0x8CE35FBEB7C2EC70, 0x69B2C8FF2983681B, 0x00000BC32170DF25,
+0x250FE5AD69B7E5E3, 0x5B305DF569C77C71, 0xA7EE8E4C30452599, 0x2F1CAFBD45469E9F,
+0x6D440606571D3DFC, 0xEC71AC3E93219583, 0xA57E823BD9B64139, 0x505A5582FA5A861D,
+0x2C796E9005877355, 0xE78574800810D8FC, 0x4D35BEA4829BF88C, 0x0000570F1A066B31,
+0x44ED1BD1DE6C5C72, 0x56D7237DA77B4202, 0x567BD5923EAE2786, 0x27CA0CAA4ACFD6B4,
+0x967FA7797C298EC0, 0x6F4A9E2348AD50AC, 0x9D3DE1E3AD4ED9DC, 0xE38F840FBF3B3577,
+0x37327146EDAC0BDC, 0x49E7FF947B155211, 0x7C30D80C621718D0, 0x000030C6AC76DD0A,
+0xBDE63281F5473A19, 0x87F832AF93AC4CE0, 0xD0E220BC78D5DC7F, 0x0B96490E5D276721,
+0x01E3027295599D72, 0x5C028D2556BBF818, 0x06305A2B9A59CDB9, 0xF56E89EFBF02ABA8,
+0xDC15DE25F4C9E370, 0xC7E11ED019E17C97, 0xA76AAEFA8FE02BB0, 0x000040CC1CAD49B4,
+0x02445C65758DE323, 0x556C031F5000430B, 0x55D02B82DDACBC00, 0xEDF1BB43040DA8A6,
+0xC65F5346F492CA6C, 0x31B2CD8071C15F90, 0x3C27A439BB1C289B, 0x5704D233CD8AF61C,
+0x0A9D166611EE4446, 0xEBFAE4557B1A97D4, 0x25D5D9C831FCAE38, 0x000006613DFB00A6,
+0xA363D49E0D45A176, 0xEB92025539C33F65, 0x716DE083631645F6, 0xA293607EAA89CBEE,
+0xFF210EDC1617D252, 0xF421ED032F208DB3, 0xE3E87308EFB3B2B7, 0x5FC0738CD8ADDB2F,
+0x7EC28451B37549F1, 0xD9B440B3687E94BB, 0x208243E9DEFD1F1B, 0x000068E9DC943A7A,
+0xCA30C2841E50C880, 0xAEAF32E889968FA6, 0x548D3AE292E8D3E8, 0xB36528D1C9203C23,
+0x1CE0FC485E7A8764, 0x5D0E43A2A1A4CF5E, 0x561DAB37771DB2DF, 0xDAFD168F827AF793,
+0xB4402FBA40917BAF, 0xBDC9910E5CF36835, 0xDC291AC5F70AEA07, 0x000010C2A95638C7,
+0xA88C94B61805F406, 0xCB43A1CE1884A3C7, 0x68EC529D913FBEA6, 0x5A4C89A310876515,
+0x89694DFB1ECDE87C, 0x4E2891E26D1C218E, 0x90DBE439A3A3856A, 0xBB9B2CC6F9377387,
+0xB9E1823184DC62CD, 0x1B75372E2E02F412, 0xD2632FB5B95ACE00, 0x00004721EACF0A25,
+0x032D5E846D0B6244, 0x0023B1DAC63A6D4B, 0x96BBF1F650BFBE83, 0xA70B3136276EE731,
+0x3439248612B2EDA3, 0xB9267F3CA33144FA, 0xEAD9ECCC864D822F, 0xB84E4C1116063543,
+0x2E8F98542BA92665, 0x88B81ED9C335CDC1, 0x585F82A9580A7DE7, 0x000052F519D95E3F,
+0xE233EFCB4D097777, 0x0861CDE9E493AD3F, 0x3C6E1184444286BB, 0x95709F343D4F3363,
+0x86063E43A1BFF08D, 0xCE97B0D38CDDC9F8, 0xC2EBA81A71B72E43, 0x6883BEDD02032D5F,
+0x7A3E7CD2E12AF208, 0xA818464B1FF3D5D0, 0xC444763C85EA7DE0, 0x0000561986376F92,
+0xE2576C7CAA8DC901, 0x5BC0EE5A1C91ED90, 0x2583B2CE2AFB2C69, 0x0D3A6C8F2ADF08E1,
+0xB1D7073A321BA6E3, 0x4C8ED14273105368, 0xA58E07178D07CDCA, 0x991E2E02A7F97C72,
+0x016A0908744CBBED, 0x90047DEC2651C464, 0x28797A4742940C39, 0x000051FD5F8A6DF9,
+0x12F1D20D5AA2CAE3, 0x8A12AEF09C155057, 0xAF0569FB2CC0BB48, 0x781A30B2DB2B8ED2,
+0x8B0D38FE01D878CD, 0xE99332B98A1746E4, 0x357AAEF29A202E4F, 0x0144E2BAA1497840,
+0xEC11A7C398111AF1, 0x637775431D657C00, 0x79148ABB407844BD, 0x00003954A2310F0B,
+0xB3317E01C5CE540D, 0xCA628F3D37FB2E3D, 0x1FD880F94DC36687, 0x235B293D6B120D6A,
+0x1AA678EDBB47914B, 0x3944133EE219FB2C, 0x53E757C0B28E3525, 0xC348344BD681E48D,
+0x9F48E4A4E6156595, 0x6ECF781C57704478, 0x36C9ABFBF4832101, 0x00001A36B1171E08,
+0x2D25177FE19620FB, 0x09C6D4F288138A30, 0xD4307C54425BAE48, 0xB974697AF5A80E54,
+0x62CBC6927AD3B05F, 0xBC1E8E8B053651CD, 0x665AA3B4D4BA97AF, 0xDBB4170C3D9EA50B,
+0xCCF0B2E37EFCE4BF, 0x2ACDF3F0FE5E29BA, 0x056B21EE2CEE5F4D, 0x0000438B203A5C8E,
+0x0D006E830540702D, 0x229E95544D694026, 0x4DB2E88F581CE6EF, 0xAC072D495C85C02D,
+0x6F998331369C4C02, 0xF44E52648D51F3B8, 0x9F815815800E09E4, 0x9DE76D75ABDBEB3E,
+0xDC9997F8C215C54E, 0x3E916A1E1070C8FD, 0xC8F440085F20135F, 0x000022840DB7317D,
+0x1D24EB4017E8FFA0, 0xF79A7147D698717E, 0x764238389F66EA30, 0x5721565D77147C89,
+0x770CD18BF3B0F09E, 0x21F3280A394D35FC, 0x062B058391DFC2CC, 0x0ADEC36F0AF3E40A,
+0xEF7841AAA9416861, 0x857F2CFF5A79F3D2, 0x65F2DE7E5C107D9F, 0x000005341608E718,
+0x5423999EA4EBAA41, 0x46301955D1FD0F25, 0xF2757ED2C0D45C7D, 0x6D41AAC7D197AEC1,
+0x941E643839B2D5FE, 0xD35F31BCA8FE2C97, 0x085AE17A58CDEF62, 0xAC15D4EC5DAF6D27,
+0x662003037F41FF11, 0x79D0B9C637F6D291, 0x8CA900FC5F23EBC9, 0x000035C57B01EB20,
+0x61D88F5BD4134DD3, 0x818BA0719EF0AC29, 0x564B25D99B81DBA4, 0x8BF70146D33C15E8,
+0x42D21AF1E682480B, 0x114BC58047B62D9E, 0x153D5623590214B0, 0xEA3F7F5C657E00F8,
+0xF949C6A3E1479A19, 0xD29E506FF99F5163, 0x2200BA2E7A0EE4BE, 0x00002BCA174174B1,
+0x0455BD80A3027B1F, 0x744FB3B831B5D353, 0xF594AB8AD1AA41B0, 0xE75EE96C288171B4,
+0xC42A1FFCD005834F, 0x98AA6873FA6FEE4A, 0xA6778B41607FA615, 0x87C84EB6DE02EE06,
+0x3BE008ACE3F7A98C, 0xFAC644DDC763A341, 0xD3B5D627FFE0E5D4, 0x00004793669E6275,
+0x6B51C2C6065A15C8, 0xCC7D7EFA2E3F9E68, 0xFD62792076466F0A, 0x9AAF4CB2D7D4D307,
+0xB7023B747D818A7F, 0xE569282A92BED498, 0xCF0F68A7EC9679D9, 0xCF9A2C1E9F8E511C,
+0x4E57C512B9A88306, 0xB802027D2A61D495, 0xAE870B5920F1DC5F, 0x00003F71A270B153,
+0x58DC7B25DB4F3287, 0xA566A66B5234F025, 0x4F723F1B3936B272, 0xF946C6228FD2C377,
+0xD235B39DF57992C7, 0xF09CB7961E988B08, 0xD6A9D6204494F022, 0xA26A0A746817AC88,
+0x1D907CFC0F90E8BC, 0xA72559E70018772D, 0xF4BA2EE6D130EE39, 0x000047341037C9A3,
+0x987E56A964C63642, 0x1F74A56D78592B0D, 0xEBED450C61F98BC8, 0x51B6F4D46237562B,
+0xFB5077A2F56C68FA, 0xD43B0E52AD3FE915, 0xD3FCFF8D8A25D9D6, 0x8AB4A5B3BD7ECA32,
+0x43F2B5B212189F84, 0xD814D999008C8857, 0x96A70DAC66C83BB4, 0x000033ED6993788E,
+0x4B3E223CD4792401, 0x01271EE77B12E528, 0xE29AA039516748EA, 0xB0B8EF9142D5B47E,
+0xEF399CE41AA25910, 0x93FB105B8D47E5CB, 0xB9F307228523E614, 0x996B9C527FEF011C,
+0xCB2D9337DF3E5A4C, 0xF7FCC0C25232EB55, 0x5965C64FDD94F3F2, 0x000035816FDFD6A6,
+0x0DD9D112078A92FB, 0x68D7BDAE978985BC, 0x1FCBAB7F0E49FF10, 0x4EA29FE55809B874,
+0x05535B1B32F4DEEC, 0xF1EB0E5AE2E78719, 0x8BC3E839579D43C4, 0x7EEE50C14381E3E3,
+0xEDF1EDB072A4C542, 0xF3148CFB7C6A2F2E, 0x91D79527DB5FBE9A, 0x00005ED0ADEFA316,
+0xCB80FBB569EB978F, 0xD97E1A293C9FA29F, 0xD67D8B91030B425B, 0xDA7601FCB23B3575,
+0xCAC979E3C0D0BC14, 0x4DBFAF93A4224407, 0x1ACA7666D4F58A4E, 0xEF5FC4267AFAACF8,
+0x2B041ACEEB6B1088, 0xC68D624CDEE47313, 0x5BC8AC129A0C3336, 0x000002892395DCDB,
+0x120F85AD5B412D5B, 0x411DBDA1F72D4695, 0x66122CF48FB46B85, 0x2F454334C538533F,
+0x9702BF12FBD1B603, 0xA67F0642E964A2C4, 0xFB9C987C89A8DDF3, 0x4CC7821DAAD37B8C,
+0x2D25D8F042226B49, 0x83E80B2FCE81E466, 0x363CF3DAFD9DD4D6, 0x00005670DE22FAE0,
+0x546CC9D7B70A30A9, 0x8AF03B09C20A51B1, 0x47E757A8BC44D449, 0x59366FE52384ADFD,
+0x894D113211659D7E, 0xF2FDFF1545394BCD, 0x5617466B5861AF0E, 0x751B9C522B280F45,
+0x8193752010F67CE5, 0xB520598D0C890480, 0x30174F1337AB34F0, 0x000055B031746C9D,
+0x329F60C8CA898C2E, 0x63AD2BE9C4235291, 0xB789F33128E95164, 0xE9EAF2F1427DA2D3,
+0x4D85A44352DF97F0, 0x9603602D6F9657E5, 0x5B8ECE2800FB622F, 0x2DB4D849392B96CC,
+0x43D660960B165A90, 0x0181362CEA36F40E, 0xAB789529213DAD0D, 0x000046478C646A79,
+0x30FD93847544FEA4, 0x8B79BF1951052C1B, 0x7DDCE2AA58464E02, 0x9F4DA2380EAC45C7,
+0x044D24141436F51E, 0x854689EDCD1DEF2E, 0x0BD7C707216B53F8, 0x725CBE55A25330B9,
+0x9BEF913232510050, 0x53B9174B052729EB, 0x1C01099D0F1084C5, 0x00006464A02470C9,
+0x005ABCB37BB57015, 0x908190A948AAA799, 0x862E778BFB885ACD, 0xAC73A7E049EAA5B3,
+0x0CFA493451FA26AB, 0x38642065D2BEC208, 0xA1A2AACFF7D1D0E7, 0x13404CB98441F724,
+0x35B829FFD0C47D37, 0x1A87DA2FF14560A5, 0x8DAA213C751FC370, 0x0000252753D98BC0,
+0x27356C32F9B2646C, 0x438E1F69E27A56D8, 0x4003336A37154953, 0x09190277E84EC46E,
+0x32BFC49995CDB8E2, 0x76208380CABD3F3A, 0x8C02B627AA83AE05, 0xAB45A2A11DC706A1,
+0x44C9DF5EDC1C3041, 0xB65B29A91DB37ED2, 0xEF313813A6FAB7E6, 0x000013D7C699491E,
+0x901EC70DCAFE21A5, 0xB322D5D0BED6730A, 0xFBB6BAC49CA112B3, 0xA04BAC19E0415DD3,
+0x2E45AC8E891A0DE8, 0xD4C5873F8E44B7E6, 0x28BBEECF843112AB, 0x874ECD2951EB5BBB,
+0x84705DCCF30C970C, 0x4160F2BF061857A5, 0xECF1E0A0080E4453, 0x00002E5E67310349,
+0x22B45CE57EDE4DBA, 0x546796AA0CDD011F, 0x8ECB0CC651D6DB7A, 0xBB7275D4D13E48C7,
+0x93B83483F02EC996, 0xFD27DB338A22DB46, 0xBBEB000ADBD90ADD, 0x8BA7ADCBF0563432,
+0x14F1D06261B99061, 0xAFB8B48986B0416D, 0x8A216B0DC72FAB49, 0x00004CC3E020DF03,
+0xFB0F62D51F198A15, 0x2C7C1CEE323058DF, 0x6DEB9538794CC727, 0x8BEF0D462068E4A9,
+0xF78EBCC5B3439C8A, 0xC2C1F9D52EFB3B0F, 0x2177E12A55630E3E, 0xA8EEFFDF271076C1,
+0xE0860BD51DC40062, 0x0B230CE40C91D0EC, 0x24A15716601C200F, 0x000025F2C00A4A54,
+0x10D1110D7F460953, 0xB19E6B780D646E8E, 0x6CDD9370B7349769, 0x63585B2482894961,
+0x86AD16A8B47FA1F4, 0x50179F6196883835, 0x4073D64203F920DC, 0x5310ECC0AEB8F69D,
+0x68259A642C72E155, 0x1042AA346D02D6CF, 0x695C8A6C1B204480, 0x0000639671BA97D4,
+0x25CC9BD835C72684, 0x1DDE5684CF731F67, 0x81D70B55B1D7534B, 0x9A0A3C928D70ABC2,
+0xF638894EB10C9B06, 0x6EF27F16A952BFB5, 0xCCD355FEC0955320, 0x7E62791A8E31B43A,
+0x4BA39CAC540EC822, 0xCAE2D90ACB034DF4, 0x72CA3B2A50FC36D4, 0x0000106016B38282,
+0xF48FA9C496B32F37, 0xD1173703EBD70045, 0x68D63C7EF1239961, 0x893241A903ED7F94,
+0x9A45EF459C1839E8, 0xEE79FD511FF4F45A, 0xBD72D63BDF05D0B6, 0xEF11E789D5EC6CD5,
+0x18BB327E2A81575F, 0xB82E07EE07CE0939, 0x6827D7159BAB7B7C, 0x0000187B2F35B75C,
+0xEEC0D78574DE10A2, 0x99FCFB8295F8C8DB, 0x68E0D0A5177C6665, 0x17369038BA109674,
+0x2815E599C585A4F0, 0xB0235384AA280276, 0x87BCF411E9431E79, 0x90BD64F363C4FB1C,
+0x9CB670EC21CB9D3A, 0xCC4AE811596DB273, 0x7C370EB63A74DDB1, 0x00005A7CAC122943,
+0x5A952FCFA1B0FC93, 0xC00BE36418BCE3B4, 0x50657AAF3F4F3305, 0x6873B407E0D0CD00,
+0x336E71B1871469B6, 0x62EDFC37AB24280D, 0x91CF0BE06FB335EB, 0x5396558DD388F7D9,
+0x956C2F1BC40955BB, 0x45B131A2759B933A, 0x671AC490CD03E7FE, 0x000001FF0B5DF338,
+0x7BD796B0D3F234A3, 0x4059E8FED4677B4E, 0xC600ABB4BD9E7DE4, 0xB46026496B54B93D,
+0xE61CC366B50FCE32, 0xE2D4E2ECBA40A401, 0x6BD77873C2025C8D, 0xFD98C07823DB7296,
+0xC089EA01718DED77, 0x5641196CADE12623, 0x189D35B83B0A8E1D, 0x00006B0FD7F57F86,
+0xC0BCC3B30C9047CC, 0x15CE1FC52795975E, 0xFD29EE41A54049F4, 0xABCAB3D738FA7319,
+0x4EF1390B27E0B890, 0xDA4E7CA1EDE1486E, 0xBC1278A488F5F839, 0xF874AD45CEE7F77A,
+0xA5870077A2CCF1CE, 0xA60F5C34D2A69DE2, 0x9AE0502D3715220E, 0x000057A7ED61B029,
+0x435FBB97ABF563F8, 0x83B92AA53FA38299, 0x19231FC8E12CAD24, 0xCB9E507ECD2FC07B,
+0x9FFCB783DBF0E736, 0xB4809967EA24C489, 0x31C0FA32E0296E5A, 0xB498188855EAA927,
+0x179CDDE7783ADF21, 0xF0D54DB768F9BCDF, 0x72E7D7765268E5E0, 0x00005AD49FB2F56B,
+0x8C9B70FB099E7FBA, 0x3FDA0036D4AFB41F, 0x06FE09A8B72537A1, 0x8B3FAAD2AAD6AF09,
+0xA4928BB09B967685, 0x4F6B77FFDE63E267, 0x425BC2EADBBF959E, 0x772C9E590D504C32,
+0x72D94C3E923B4EFF, 0x486BFFE9E389E1FC, 0x705EA5CE50AD4521, 0x00005A115D281276,
+0xFC9E959ED0D0903B, 0x4199E812BD1DDCCB, 0xFE5E6546F8CD3972, 0x781792F767C865B7,
+0xA179C7FAA8364877, 0x695BC283CDFDC802, 0x04F8B19FD52A8FA9, 0x8E96A9AB03152384,
+0x9E0987FA1E1B1B56, 0x9D581209D9863687, 0x941B13E806050C21, 0x00002D9C86A231DE,
+0xF9F513144121A3F4, 0x1438788376D8B454, 0x46F30DB74374F030, 0x02B675AB0F7C8D4F,
+0xD4198E0175046701, 0x1CAE80C994467338, 0x97FE63BF3EF47A37, 0x8B5642A04F178954,
+0x18471C29DED2E1C0, 0xBB80380D6AF457C6, 0x4318E33B72E43574, 0x00000F087F34CADD,
+0xB9C4E9FEE34C4526, 0x266C5702E8D3FFB6, 0xA20F7B2BB522663E, 0x044AAB14FEEE60B0,
+0x817F3A17CF43D97C, 0x93BFBDF4CFB43499, 0x49D67359C721B6B7, 0xF330F0DE25A2B05D,
+0x51F36AA22D17CE96, 0xDD0AB1F2244569D0, 0xB6D6BD536D57E581, 0x000060B27BF1124C,
+0xFC11D90AB62BCF44, 0xA389C942A3E127FC, 0x3C7126F81FF6A40C, 0x114791192C803D03,
+0xA5D0902380C126C9, 0x97EF426DF015193A, 0xBD6DA2EEDC5E678A, 0x0CF1C827623291AA,
+0xCD8A39B797374727, 0x028F67541A08FAE3, 0x3C99401E5FA60AC9, 0x00005DA6ECAE3BBB,
+0x575FB9B5082EC92C, 0x16506918A79F0E04, 0x8092997D7FE830DE, 0xBBE3C98885798CA2,
+0x630F1517D3B62620, 0xCD5B70A40906739F, 0x53172F97258798F8, 0xCF81364F6F0599EC,
+0x6AADF2134D19CA5F, 0x7A4FCC5F0BEE7432, 0xDE5D456E120B6BF9, 0x000053C2D6ACDE7C,
+0x921DB3DC0A498EB3, 0x038A1AA33F86F6BF, 0x415D406A3F520EFE, 0x05D5C075EA31BC3D,
+0x7053E34AB88EC43D, 0xD4FA66A861E39383, 0xD93E3951A21D5BB7, 0xF638098683BD7C52,
+0x87E0A4410335DFE9, 0xA99FB970903F4DDD, 0xACC477D86C63A325, 0x00005307405995B2,
+0x117E3163B731B16F, 0xE6E529B4A91F6422, 0x7D3C5072E9062E7E, 0xFB7599A6699D25CB,
+0xC9A764F623A50C79, 0x3723F52D185C45EE, 0x2EA8E5D06BB9043E, 0x1027DCE686FF0ADE,
+0x0416147DDB350EF9, 0xEB1BD10C7F309797, 0x7F315C83CB6B9D99, 0x0000253D73CDEF5D,
+0x08360DD4695ACFCD, 0x80A94DAE08344C95, 0x492FD76A68424ADA, 0x35D212A4C6672AD9,
+0x4BD28B7CE666EEDC, 0x120E4F37AE2E5284, 0x981FDE77CF9214B9, 0xDE56CC9578E3F1D8,
+0x025F72C6B53970A3, 0x1B7C90D10600C716, 0x9DD727578A0D9300, 0x00005BDDD0B07DD0,
+0x98B5226D0246CEE3, 0xCAECCA620215747A, 0xBEEC50425A3CDF40, 0x3A1944392CB3E11D,
+0x554F4BDB94B40E18, 0x90B4768225535936, 0x0A5D555E16893B56, 0xB7DD47D759DAD568,
+0xCF67E112471D3010, 0xFEF0152111F60B54, 0x4791B04DE336776E, 0x000066BB80347588,
+0x5D0E357B375DB71F, 0xEE35B0833179A4B3, 0x915548731C18D51E, 0x960EAB871C859B8F,
+0xEDFB2BA552880DE9, 0x24955C2B67B018C3, 0x27360C9AEEA127CD, 0x547F19AA01E5C340,
+0x074E5CBB7AE8866B, 0xA75A31DC2230651B, 0xF791711A47C692BF, 0x000006BD83C2D666,
+0xA155D5C654F2C6E2, 0x182ADB8A0366BF19, 0x33CC59F2083B957A, 0x441424646E53CDC0,
+0xA2BC9B9A0BEAA2C1, 0xEFD0A694EA080833, 0xFAB58CB056018EE2, 0xE0B4122A3C8A1E3C,
+0x6D94798C1FFC70C1, 0xC35C9D42D9CC03D2, 0x21A28DB64FAA1EFB, 0x0000492496346F4F,
+0x0EBF354B856C8409, 0x4F88CA9AB08DD359, 0x2247A55A66FFD381, 0x7651A9BD8625F04E,
+0xC87B0D36B7F0DE27, 0xDB24E993F75F2DEA, 0xA826AE21AA48A2E5, 0x83CAEDFF61318D9E,
+0x2F262FD056A655F0, 0xC7FF318EEFC5D20B, 0x1B0F620F1027B228, 0x00005C13DB20E80D,
+0x497C422627E89C89, 0x2188768BB4382B58, 0x03A8035579BE8FAB, 0x5D4B869D3DEA292C,
+0x0F0EF8AB18270842, 0xB358EC0E8BDF3533, 0xECF41EFBFAC6F7DC, 0x34F291BA65A953EF,
+0x8A549D139DF17213, 0x03B132D4882DB661, 0x7509542211D4DC6D, 0x000011F55A0CA857,
+0x641984CA655B74E3, 0xD53E25964F9F5101, 0x3EAF0584F610F6F8, 0x67493328D6BCB65A,
+0x495B07FEECB846BF, 0xCC0B3572FC195472, 0xB8CB04217E0CE218, 0x02C012E812C0BFAB,
+0x7FFF2A5B7ECBFB50, 0x4BC8F60D86A3F2A2, 0xD4E84E08290512F9, 0x00000EDDAFCDDE5E,
+0x3B44AE1C301C2D65, 0xAF7802A6D2A16B9D, 0x33826E3EE0792C79, 0xAC41E99B6AABA821,
+0xD68B33D4E5E70885, 0xB1D7830F75E19EF4, 0xE4778EFF0EE82E5F, 0x464065D3FCEFD060,
+0xCF8C08E486389C9A, 0xC43BB655F59CCA00, 0x16398E80DD413AA3, 0x000044D16D8AF062,
+0x57FFC8C900485297, 0x37ECA8AC88CD5148, 0x52D2C577777D1835, 0x0BF2A06486C46EEB,
+0xAF80A461112A82D3, 0x22AB22B530DEB4E2, 0xC8F115165F670ABC, 0x6C6D8F6FB9B48F83,
+0xAAC7A6D4FFB2D880, 0xED436722C16A7816, 0xDE3F371446D49CF4, 0x00006A9DC6037FB8,
+0xB4F01E8AD409CBA0, 0xE2966CB9D8AF1FAF, 0x38FC24BF2A3DAF36, 0x0BF284B348589603,
+0x658800516137997E, 0xADC9DD24040905EA, 0x43CDD05FAC1740AF, 0xF84FF4B669D899D0,
+0xBCF4033460845509, 0x45BE70703FC63CF4, 0x86569AF137B491CE, 0x000054BE77A385EE,
+0x85903B11845C0E02, 0xB4155F6B0FE0215B, 0xA95D4A01A81D688F, 0x320C30ABC3DB1CEA,
+0xBF865E138F47CACD, 0x450F62F8BEE96F0B, 0xAD56D9CB2C043C84, 0xFE2B1575BE22836D,
+0xB50120A661A4E505, 0x18A2792033C0B54A, 0x5A17A82626319DB9, 0x000016A05F7DDC42,
+0x336495EF48D99F94, 0x8B42C783AF3751DE, 0x1B3E9C16D7F43D74, 0x384F95C07605A813,
+0x6BD3C382AE354482, 0xD4BB42080FFA6C82, 0x9433CDBFF3AC5DC9, 0x7ADB651626A845EC,
+0x4A8901C3AF5A60AD, 0xFD1A1720EC7F9478, 0x84A72EB5DE739C78, 0x000063CCFD7FFC71,
+0xAF90A0A59321661F, 0x443E80F05D9C8BFE, 0xDF89BD2AC7BE4672, 0x54A82C5937B15DB1,
+0x66908D9F6D010388, 0x9E232F1387BA15D0, 0xF117181B9BC0CE06, 0x4620FDDBDFDC8E81,
+0x6E2CF1D26EC0A3F9, 0x05646C26D74BF2F2, 0xD107BD55F4EAA10B, 0x000051223872F3C6,
+0xC3571379ABAAA6D8, 0xE6F2CC0F9C7EFB6D, 0x122DC8128A966B26, 0x7260BA4E95D7020B,
+0x9A78EEA44393AEC0, 0x8B76F1F5D56A0425, 0x41A9F86C7D407C81, 0x93707DE89439B3C2,
+0xF3F468E46F876FA4, 0x6748722803FEDED0, 0xD0B38B6F83A7C859, 0x000028FCA332D21D,
+0x8698045A62550095, 0x83EE10E35B10D0E3, 0x1A4F15958707B2C7, 0x77E1EC62E83A7ECC,
+0x9DCE12CD206E748F, 0x2AD859C0894E1D2E, 0x451663A575E50FB7, 0xB092FD8DD3630DA5,
+0xE8F4764C10B2A132, 0x13277CA86176DB49, 0xD3A2B1E7CA994CD2, 0x000027026C77677F,
+0xBAAA6CE6557A1299, 0xCC694EC2EAA2DC63, 0x2566A8BC0785409C, 0x11E672643E0C4F3B,
+0x2A60838F1FF3CC1B, 0xF38FB961D314CD27, 0x34B36A3267C80579, 0x5235804FC75D3AF2,
+0x1C6EB36DA46A044D, 0x2E2458C5CAC1B860, 0x243BEBF9CD2C71AF, 0x000023AEBCDF97C7,
+0x79361EF3DC716F8A, 0x7A796969F626983F, 0x9B907AAA60F15778, 0xEEEDD3A48C7B6842,
+0x01F5A4C5417420BD, 0x61D154A6BA4C6986, 0x8F679726FAA1865F, 0x8D5C72295EEBA75A,
+0x610396360A6A1565, 0x36EAB7EBA0728D44, 0xADD029D4ED686AD3, 0x00001D3C16773D1A,
+0x9CFE46900E5B5B5B, 0xAA0FF8DB8E2C4280, 0x96FE2B5F32CBC4C9, 0xB1A604FECF615ADB,
+0x16E4A66A1B91B6F4, 0x8D1C4C9770E1B147, 0xF5E0EE45C4CA4ED0, 0x9C054F0674AF5C12,
+0xAA3D8D4B0F9BBF9D, 0x24BDEC4BF428252F, 0xF33FA2B4AC639B34, 0x000005D5037BF7C4,
+0x3085F3A3CE0D9DCC, 0x12742DFD15F1ECEC, 0x12D3114343FE78C9, 0xE8D18C9704378B4F,
+0x6477A89A44F4DB9B, 0x4CDA51E1E9C8C407, 0xEE0A9FD6C534B74C, 0x681528DD5CE9D063,
+0xC7FC732654752121, 0x6C687889980CFB3A, 0x87F148AC823E999E, 0x0000139301E4D6A1,
+0x36181E4BD2D274BE, 0x9A53455E930888FF, 0x2BB5CCFB17C1FAE8, 0x3114F0C28959D318,
+0x314D2660C02BB6A8, 0xE737D1CD157225ED, 0xA1F803CD312E452B, 0x95718759FB9B0180,
+0x516996040AA07581, 0xA978FF9ABBADFFAA, 0xB4FA452DC6745015, 0x0000067E7C2E60F4,
+0x04A778C4A1F4C756, 0x64DAE8243AA8BFD2, 0xE775C09C77A8436B, 0x409E2026D26DBFC1,
+0x11F001756E9FA2A7, 0xA4A625CAF6100614, 0xEF2C7434ABAE2B7D, 0x3F9F4E7C4EEB0D9F,
+0xF9DC92B558A559AE, 0x42B8DAE6912562C9, 0x032792D4C33599A3, 0x00000514AC7CEDA7,
+0xFB90AD82A7986680, 0x6BDB42278D95D6A2, 0x0D16A5A4F68A79A5, 0x2A84EAA8FA1A83E4,
+0xF2D7C5208D34E483, 0x195138F96659A600, 0x0883A496FE3C7743, 0xB3D3D4A55F7D59EF,
+0xB7C4352474F6D77C, 0x075D82270AE8F282, 0x646806FFC5980E43, 0x00005BB0AF9C02BB,
+0xB450686DDEBA32B0, 0x958FBB6842BC7694, 0xA61EA0764B49CB43, 0x98FCFB997938B466,
+0x94CFF836DEE6E5EC, 0x1557936BF07776AC, 0x69E0EDBD6917C8C8, 0xD9B2E4A31A3E4969,
+0x662B2D0970F4D13D, 0x6DBA68D9822A44FB, 0x4EB9D8547B7987BC, 0x00006B22F220039C,
+0x8D6C9626BC7B8E60, 0x10A4DE0E9002C86F, 0xDDC2214E1F4259FB, 0x348CF301059CF423,
+0x21B1E282186B667C, 0x0AA9043D3107A472, 0xE7A7E1C9B8087426, 0x098370AE33AAF5FD,
+0xE3A0864C08AF797F, 0x14DA0A76407AE3CA, 0x3B030DD9F9B6F207, 0x00002B01F74C7D3F,
+0x0FE4948265DA58F0, 0x06440E22731D83FB, 0x3C1123AEE2B606EA, 0x6DB740A30E9262F9,
+0x923B8FAE7CEA699A, 0xF12F33A1C770FDA6, 0x28F78C71443FF928, 0x434BE068D290995E,
+0xB58E42029C03FC87, 0xE1F00AE20F92F4E3, 0x0AB81468CBC2C20C, 0x00006983CB0344BA,
+0xA5653636B00465CD, 0x4C214DDD2B3AF339, 0x452B963FB12FFB3D, 0xAB6627826B1DA824,
+0x4229F663BFDF44C9, 0x1EB0AEE90F201B9F, 0xB6290CF1390AFDF8, 0xBD27EFA43295354B,
+0xDFD2313BC8559E9C, 0x76F832CC2F90FC54, 0xF0ACB890005C04E8, 0x00005CC129387C84,
+0x4525EC12F7C43E9D, 0x1D935F223E07B2EA, 0x4F846DE2404578AB, 0x8BFABB52924C9B5D,
+0x3CC37FC8A5D3FEE8, 0xF32262EF5F5F3286, 0xBA42DB71CEFDADFC, 0x7783724B2A5C1638,
+0x0D43A532D1982509, 0xB7CC70DB05AE0E7F, 0xC0A832565640504C, 0x000036E6199D31CB,
+0xF65EF91276C59430, 0x0D963989616E42B7, 0x8F165AB052A627AA, 0x93B785CE735D2B6A,
+0x987755EFB65DB442, 0xCEBE7B687B2B0CA2, 0x1B69EF5F745B21B3, 0xAE5DC0C665BDEA65,
+0xF3173A0228CF3380, 0x34398DF1011EFAEC, 0x1B93CC6F77FBDE47, 0x000062DF37285546,
+0x52D3BE69C0D6C37C, 0x95162583EAE8104A, 0x2B58E941BE66D298, 0x1769BB0A59CFA763,
+0x8679A5204842F6E3, 0x1F5841CFCC8E6F83, 0x854393F029C92302, 0x7D7F95C94A6F3F30,
+0xB977EF4E35CF1564, 0xE1B28349215F581E, 0xFF93243E647CE5AB, 0x00006EEEC0A6F2C8,
+0xA7F988CF9E46D6AA, 0x35C98BBE87AF0D19, 0xDFA6C7B54A16E00C, 0x3918FBC87CEBDC0D,
+0x4FDC068F31CD5088, 0xB2945532FD3D5F9A, 0x3C943704C321564C, 0x71960C84E3331BFF,
+0x3C656D0FEA996BE5, 0x6F6A337D891E9751, 0x796845293FA1FA10, 0x000012656B6F9A96,
+0xB3F84CB2BFEA6587, 0x8EE6B05B5AC73ABA, 0x2DEB03C8D403E7AB, 0x6F6523BA1EEC1CF5,
+0xC4731E31E5237F3F, 0x4D7C45AE31FEF22F, 0xB0755D51F949577D, 0x0E1ABF35B292E581,
+0x785E173B54B4B7DF, 0xFB9606641F4A4892, 0x8FFC4AAECE16D929, 0x0000605E05B0C092,
+0x5E2AC42BAA1ED132, 0xD77DF794106D1199, 0x929CD9B6BF7A7931, 0xEB3179B0F624E847,
+0xD673FF7F82588E3A, 0x5151E7409F165A29, 0xC0DF30BE2EB6F5EF, 0xBDA0EC85FF57CF60,
+0x2F4C7C86A0C605C5, 0xDAB1C5FBCB2EE618, 0x71F68BC3F80AACE1, 0x00004ACFCC592529,
+0x03E90018697ACAC7, 0xBACCA8B74247521B, 0xAB29153C9DA491B8, 0xF504889AF44BCB35,
+0xE69E375D01EE612E, 0x3E941AD07CF415D4, 0x67BDD8F5D17D8442, 0x2FF8C12DBAF9A3AE,
+0x2DF87C612D3FBDBF, 0xC94543AA3E9EA467, 0xE0D8B15E5FC74E2D, 0x0000313001CB3089,
+0x1AC249500B0318A6, 0x0369B4AC7276691C, 0xC7B26CBB1C31BA98, 0x9138D20D784DCE87,
+0x4F67CA40AA52810F, 0x0B51CABE429E5CED, 0x301EE21EE0D097C7, 0x10BA5A020F6FEF19,
+0x855D961DE4AD46B4, 0xE2FC3513AA05DAF1, 0xA15B28D46F576A2E, 0x0000503D2FB62619,
+0x6E66A57AA02FF985, 0x170178EC27970F12, 0xB336FD4E33D97FF1, 0x871235E01FB03B47,
+0x8729E683529B05D6, 0x3A1A47D9DCEC067B, 0x43B3F0C8F5F60CCD, 0x836532CB848DE379,
+0xEDC0D85B8B2513C4, 0x8EECA583451A2F1E, 0x8B96682564868D24, 0x0000134CBCB34AA3,
+0x050AE73E433C3037, 0x0219D57BA82E7B84, 0x0C4D434DFB26EA46, 0xF2132CFB1BEA4F3D,
+0xCB31BE6FBB4066C5, 0xB90B07193B0DBF22, 0x913BECEF6D449EDE, 0xC664AE743D6E31C8,
+0xBEE608C6FF3228A7, 0x969352E580022EEB, 0xEC4C81CE6B5FEACC, 0x000039C023668DB0,
+0x0F32CEE3D8A6F989, 0xA6EBE1129E7B886C, 0x169AC0728C7D5B77, 0x19F25049E4D6A37C,
+0x05806DC6A24D477A, 0x9A5EA7AE7128A772, 0xE364A2B2B113C7EC, 0x15FFD247B4DA3258,
+0x6B025C5A6C13CE74, 0xFB3F86DE1FE72252, 0x102E52986297AC60, 0x0000354765A4B33A,
+0xE2EAE3DE508F72C7, 0x07D648B44DBCBB3F, 0x16D54AE1FF934433, 0x0094E3719CBB243B,
+0xC3AFBBA763643EDC, 0xED35A60F752B51DF, 0xE1DDE6726896EB88, 0x13032C58C9E924A6,
+0x54CD55960CED6D81, 0x31330ADBBAC5EA37, 0x4E18DA689E8CE818, 0x000051F673529E0F,
+0x5D6621F374574EC6, 0x042A4FAFB5EA0A28, 0x39FE92E0E9918EB2, 0xF2EB4EAEA2AB5FCE,
+0x5ED7F0D3F7E6B4B6, 0xFF48A6BD26C77876, 0x14FF032C158F6901, 0x4EE13326DF5E3D3A,
+0x6255F5E5B2EFF6BF, 0xC441EF77A2BBDB58, 0xB51F6FB8254A50D8, 0x00003851514E5FCA,
+0xC0671601DE964DE6, 0xA28AA6B2C0CBC228, 0x241EE753C916EA63, 0x4207002E713B8AC7,
+0x212180625404260D, 0xFD05FCFE02B07434, 0x19F1CC8F73DA9E2D, 0xE149A2B8BEEFEBE1,
+0x19148D4E791990CF, 0xEC494B0571AA8390, 0x115A41E6D824C8E5, 0x00001BD1C00515D5,
+0xCC9542F4516EEE7D, 0x7A0C13D1449CB878, 0xF13F2AFD75C5FBB7, 0xB34D14F9C63DFCDC,
+0x8554C28401F18477, 0xB4BC152987764C52, 0x536FAE6D67B95D9F, 0x36E9AFB76F91A2A7,
+0x907AFFADFEC42A2E, 0x6D481B1BC1142480, 0x426CE34D534EA3C7, 0x000014F39D15AD5A,
+0x3989D2460A2C259B, 0x0B7F2623C71A8832, 0xECE54693632A81DD, 0x81D1E671E5D0C7C5,
+0x35C23B693ABC736C, 0x12E057F95CBABBAE, 0x0EBC19FC100D1513, 0x7424F1378F7FF121,
+0x88DBE34C04693D68, 0xFC6152D2EC4E828A, 0x219C2E0B6AA0004D, 0x0000322551611A92,
+0xF1E5E481CCCD0156, 0x57BB0D2DC2D9CA18, 0xA97B55FFC79DF15D, 0x77148529C113125B,
+0xC9B61306A59558A8, 0x190A1A2C9206BD06, 0xD48DCBD308576A4A, 0xC479CEF84A7316C7,
+0x53991FFFDE9A2328, 0xDF6A7496DA8A2F1E, 0xB7FFCA7C963C53F1, 0x00005B57A7A34C84,
+0x4993AE6C1265D569, 0x1F903E1A939B6185, 0xEBFC37F76CB91774, 0x8A70AEF42F83669B,
+0x13CC5088CA22CCCE, 0x9C9B2844175E8D81, 0xFC166024C504872A, 0xC05A1AF9E57B7002,
+0x124D6217C830A1FE, 0x0EE98EE1E4C98B01, 0x9E2B1333D896024D, 0x00000DAB5BB74619,
+0x0EB1D6D07E64EC2E, 0xA85A3C29DF3457D2, 0x596080C5B1B58BF9, 0x4F82878DF1F7117F,
+0xE9A93677F4F79813, 0x444E52CE7F948807, 0x4F2797E879EADC17, 0x6BE3B6EBF4AA6CEC,
+0xEB40709FBF438723, 0xD94177AD32ADA7D8, 0x989958F8CE4B21AD, 0x000050229A8794BA,
+0x794214F496340A52, 0x9DD1D878D1B0B336, 0x2A9FD140C7475FF2, 0x111C6C0FD11C9A44,
+0x2C621D045EE26911, 0x4EFDA9D0B73C754E, 0x8BCCDD18DCCAE407, 0x99AE8462CF993276,
+0xBC0CCF0703CC7AC2, 0x3B1E65809C7EC48D, 0x8620D001E16EE59B, 0x0000506AE1DDF64B,
+0x6D3C821A3979158B, 0x8A84A1AEA79AA66B, 0xE07FFF632ED50FA8, 0x8DDE756A49B55949,
+0x5F910E41CCA6647D, 0xF9C18D63C1B9EE5F, 0x89228BE888A48242, 0x3B3AA99A2E0B9090,
+0x7252033252B10E9E, 0x307F93B7AA8F7E59, 0x6F499A06B16EDC28, 0x00003DBAF7F453CF,
+0x25309FBA6E7524E6, 0x903FB5ABE74DE612, 0xACADABD429297EFE, 0xD96F01841256B8CD,
+0x19BD2FCD7E3C1C10, 0xF7B2B1B1169D8111, 0x14B6B4D8019D3A2E, 0x905B6E3245623C24,
+0xAB2492E8045F5F88, 0x850E86B9E2B29D8D, 0xB793BF71989872DE, 0x00002ECD2A3D24EF,
+0xFB921CBFCD476EC7, 0x666D01DAC4CD1CFA, 0x9423A8F6FBD05BC1, 0x74089FDF1FE9FB91,
+0x647AE62D34D50850, 0xA7D66C41396FC4E3, 0xABFCFAB65C29D762, 0x1FB509A4324A0733,
+0x044D595C7F98DD6E, 0xE19671C8D2590745, 0x4E069AB18B358DBE, 0x0000544FE07166DC,
+0xB19DD007334C8B52, 0x767460C1FB52288C, 0xD5EDB19789AAE1D5, 0xC76FDD1CF1DE251F,
+0x5CACCC3ABB60170B, 0x186F2DB9D57FDBAB, 0xB7D87342E8E2EF59, 0x3338B00FA04B1A99,
+0x200F494198F995A4, 0x98A1806E5A420D59, 0x2DE8C133A1ACD4E5, 0x000031E6E7520F66,
+0xA3F2CAF992F06EF5, 0x28446A9C1C15A47D, 0xA685E6031B8555EE, 0xD9EE99D0B16C01FA,
+0xE4D7F4FBC12D01EB, 0xC9872D6AC7BC153D, 0xAE6D2845BC47C914, 0xCFCC315B1C86FADC,
+0x95185D5D016FF945, 0xBCF303D65515DA26, 0xA8A9144E44BBC1F5, 0x00006A8E289E0D1A,
+0x7BAFF70DA81104C3, 0x41027E4D9DB49C4C, 0xA7736D59342F4C96, 0xF04E40E360B6139A,
+0x845BABE47D424856, 0x528CE143E165E47E, 0x963B98DC6991618B, 0x022F8CC005868800,
+0x091256D17694A4BF, 0xC758EA7C6A148217, 0x6A361390D91AB361, 0x000006C5EC790EB2,
+0x48DBD791A3BC6F0B, 0xCFB5AFE5250468D0, 0xC0F1180ACA0AF0D4, 0x8A0BA9CB13AF79FF,
+0xCA1DCBD1ADB7B5D0, 0x4E4B6AB0BBB03DC4, 0xE8EEBBED2BA9AE19, 0x751226F7957BF621,
+0x0BE863E69C7E1324, 0xB0A96504741A1953, 0x88AD06A73315DB87, 0x00000E0934CE14E5,
+0xAE9075931D52C2DF, 0xCA4D1B44D97A0FD6, 0x1AEC69A0BE6A7791, 0x073FBC7B02ED9B84,
+0x5E416CEDA9D727E8, 0x9F4A6B80A010E7C5, 0xE067FD0A087BB024, 0x19D497DA9B64C5CE,
+0x94949C523BBAC246, 0x0EACEB9D9655774C, 0x10596569B1C3D454, 0x000043686E10951C,
+0xDDF182CA3CFE0BD0, 0x4BE4967888A65D84, 0x4EAD42F8AD9F6184, 0x32C907C7E945F04D,
+0x856CC8399BE6A3E1, 0x855CE4C9B8B429EB, 0x29A0B9E49D9514AE, 0x677980D541ADBF11,
+0xADF099E435E07B0A, 0x13E9E57EFCCD71BD, 0x5127146AA128F3C2, 0x00005997F198999D,
+0xBC16F59E5B0D6CAC, 0x1B26B0611C9E434A, 0x55D3AC756B997C74, 0xC0746010083AD7D7,
+0xCD8855E9920EA321, 0xDBCDC53B9274BE78, 0x21017CEE1B45CE54, 0x499EAD8881814FD4,
+0xBC88F4B6747A93C0, 0xC1ADAAD8FF1774EE, 0x2F1DC28AB603ACC9, 0x0000226D290621C1,
+0x06357F13A8252D07, 0x86D147EFABDDA069, 0x3EA50BB674540E29, 0xB4BA3C1D693D3443,
+0xE0F644FD8AFD45A8, 0xFAA0E9D54339A3DC, 0x718E54409A2FFFFD, 0xD3C70B191B178622,
+0xDB6D970164CD7AE3, 0x88CF9AAA553989A8, 0xD4A759F25436E714, 0x00004E9D4C9D5573,
+0xFDFB8CFAB27C3597, 0xDEF15E4047F5E0A3, 0xB1211FCB849F7D58, 0x0B7DDFC003F846FD,
+0x34DB20BD38E7D691, 0x6928A6D6ACB2C7D1, 0x73BAE4FA6E22D602, 0x5BE5D1150EEF6124,
+0xEDD182C6FF8DF48C, 0xFC5227678A646E64, 0x8D8069A4D4D6DE67, 0x000059DB4DA55E16,
+0x6436C4CEA3B20664, 0xCCDB0F8023149006, 0xC4A266D0C0720597, 0xD4B5CFBF6F7E4F6D,
+0xFEEDEC73E769B5DF, 0xF6B93C2094FBC3E5, 0x7F6D2DDFAA1224AF, 0x28FD8304E3C2B9D3,
+0x8DAD40A46EA50820, 0xB3D63157BE15B2E8, 0xD772C8140B6C28AF, 0x000004C29327FD76,
+0x228FCA044FB478CE, 0xE6F5F8E31D0550CA, 0xCE2676DA5E405D1A, 0xEF06152014D6577F,
+0x9876F23C2C72296A, 0xA400A8223264BCDD, 0x69F99A9BD5A54EE5, 0xC33950A9FE942409,
+0xC0D6CB5E5A4867AA, 0x1405C9EEB7662DF0, 0x8402698D2CDB82B4, 0x00005645108CCE2E,
+0xF0C9359837282A42, 0x4EF14FE60F474603, 0x9C59022B3ADE1AB2, 0x5FA34263B0AFE8BD,
+0xBB833EC2F85AB8FE, 0x62E9590E6A6BFB66, 0xE2D4619F0AB5D9C7, 0xAF90292EDBBBB706,
+0xD516F0455C2A0662, 0xB0FA89D0EA5E36DF, 0x4C20DD6C829E97AF, 0x000013596BF0DCD4,
+0x7A02CB843EAAE886, 0x2E18679DE6C83EE0, 0x8608BDC2BC7EE8C3, 0xCE1DAA4BAEF813A3,
+0xDC8D63FA258C7BA2, 0xE25F752010C6F764, 0xD313FF6AA628BF00, 0xD3F807936E60A44E,
+0x55E97A8555045E59, 0x5EF256ED7CD9556F, 0x1F55731BE0FF10DB, 0x00004A01AFB24ED6,
+0xB507B5EF568B3707, 0xCB1EC69803801F51, 0x6135F5A4F1F6CF33, 0x2AD166E67CB4B4E6,
+0xFE5A5EBF7B71C94F, 0xCC9C39ED8DC340F5, 0x50B1170B07E8D2E0, 0x558983B967FC943F,
+0x7D40190954CE17F1, 0x9DCB23742D895AA1, 0xEB984562D37095CF, 0x00000ED863CA5A97,
+0x49C61D84300E72A3, 0x3EC5A3B0CD6E4025, 0xC75D5727D90A25DC, 0x6628924F0B321E5E,
+0x6C13041908DC2D8B, 0x7B3B3A5F388D1D0D, 0xD5118A485AA2FF03, 0xF5AB2E54665E325B,
+0xDFF9FF7097C89D34, 0xCE7E629F698D47F9, 0x79451AE1E0945BAC, 0x00004268C0F5BBC9,
+0x712635E19CD4842A, 0x14BB1F7D565533FC, 0x2C0909B0D15C83E5, 0x699B1D3AA0D845CC,
+0x5F2CAAC5A5A9BBF1, 0xD8BF85ED9BDFC221, 0xF10798DF030EA2BB, 0x0248027A0FC4A9ED,
+0xB4436367E506204E, 0x42D740A1C3D29951, 0x574186231695244C, 0x00003F4ECAA90D6C,
+0x0D1F0E9F80CE2F54, 0xF9CED94695EAFAA3, 0xC8FA4B6EC94D15A3, 0x3F5BBFD6CD293966,
+0x66B217F2B17F1511, 0xC008A8CCB62BC61D, 0x8370375D19C27F5A, 0x3190A8F181EAA9D1,
+0x24FF5E250E0FF62B, 0xB92E9C2BF67FD75E, 0x2AD775379A08FA0C, 0x00005C5EF69A9204,
+0x53AFC9E43D0269D8, 0x0C22C1AA55120577, 0x12955B9A2B53E8A1, 0x6BF955DC59F5E5B1,
+0x5505C074BB9ACFA7, 0xA94BD82703527260, 0xBB31772832B17364, 0x88455AF6E623920A,
+0xE867B6FD3A4BE84C, 0xF94D328A9FC05F4C, 0x49202420B91B5DCF, 0x0000634801B0DBA1,
+0xAE62D2D17B703F81, 0x3A16DF384258CC90, 0xFF8D668B9CFF9005, 0x194B73DC4A0EBC97,
+0xED4B1C6F39FCCBB9, 0xEB6368734A4549AF, 0x20E3BEA1A354E124, 0x5E6239AC2D900487,
+0xC5DF0AFCC8D5D83D, 0x1F980212C866A0A1, 0xBDCB9D223647388B, 0x00004BDFC86FE73A,
+0x5090A1BAE9AD5CE3, 0x0FCB3BB2A4703D2D, 0x6A7D028FEC905710, 0x38A6CDCEE3F1F908,
+0x0C6699F997204ADD, 0x1FA2B27E1F521EBD, 0x53F25FA74ACAC8D5, 0x7BBF4419495809CB,
+0x6F466653D91E46DE, 0x0B80657418E95426, 0x425B14D5C1B092DB, 0x000046D6E0517130,
+0x7F3B51EB4DF10707, 0x721A0C2FBAC37C8E, 0x3762DC1C2435859D, 0x36A93433356F1F68,
+0x888A56C5080FE73E, 0x201F3D9231740BB9, 0xF693A5B23E04D2B3, 0xE75AAFBDB4707ECF,
+0x6D734511479266BF, 0xC701DC11161DE798, 0xF3E7407ADF926CA0, 0x00001F9C78527625,
+0xC57338C1A2578969, 0x6B33C0602405D935, 0x1D4669A557DA99CC, 0x13C66BB41BF77BBF,
+0x31B3612D4F5F4751, 0xA7D13282D0B77EF0, 0xAB8CF35AF619AE03, 0xEE7F927151C5B380,
+0xEEA466A103136880, 0x167734C38116CE5A, 0x34851E1B15ECE6FB, 0x00006EC8F763BA22,
+0xB1EC221D198C6942, 0x3014A5CB89BC0B20, 0x515CC42BE177C41D, 0x4E4FCA3B2F0B2364,
+0x4A9535CD703E3357, 0x0F14F3F77CA12296, 0x91AA91D89C7A670B, 0x29EC1277A6D49ACD,
+0x80295AE80D8CF1AE, 0x1F2E8EF5DC7DBCEA, 0xD457F251E8F56AEF, 0x00000A600B602848,
+0x0945D8B6A14AC599, 0xA9877DCAF1D0C81D, 0x410243917818E514, 0x627D01EA83F79B9A,
+0x8220F0C213B1A54B, 0x683FFA0FBC099A7E, 0x5CBDCD9559B2D9FA, 0x49D4E35D836B196F,
+0xB62F74BB87297159, 0x8BA819169FF7E147, 0x65AFF9E754118824, 0x00003B5C7752463E,
+0x7C333BB163DF2433, 0x525346DD4B86ED2C, 0x5868FCE7E69C94DD, 0xE900631B5A581B38,
+0x89745F5D896F284B, 0x3D8327FC99DA4947, 0x0916A067359531C6, 0xF441B96F77A04EBC,
+0xF0D0EF7AF65FEE71, 0x43E4F46AB392FC70, 0x7C62A9013F1A8F38, 0x00002B368B41F179,
+0xE6D4418EC830BA45, 0xA1F1D47B3462F449, 0xAC284D2274069876, 0xA390A9BC9FF1273B,
+0xE39FFF5A0C99DB64, 0xA1184A48DBE47A07, 0x15EF3D838E4A5A7F, 0x05A93AB4FC77A335,
+0x15283A6666F094C2, 0x769EFF1149FFEEF7, 0x55A2A4EB034D1960, 0x000033E5A08EDD12,
+0x3FAA46862B8594B0, 0x11CEDB2E6F223929, 0xB8655A945DE8C0CC, 0x9A7F6CED1FA20A5C,
+0x3E8F9C8FC2A210D5, 0x8B8A451455633D58, 0xBA5F93679FADD76A, 0xD8799FAEADFDB609,
+0x5AEAECD66D31C495, 0x6220C2CDB8202D84, 0xBA81C8602736946B, 0x000016DBB51ABC0C,
+0x55F940491EF1899E, 0x87646699F864AF7A, 0xC049776207D67CAC, 0xA3C41B2349F2205F,
+0x1B8CA2686EAEEF4A, 0xCA9A36AE4012EF67, 0x145558F834EABEE2, 0x3D01AFE35AA16A9F,
+0x24B0D15F0B84DD7F, 0x9035779C158D0AF0, 0x61ADEA740252C911, 0x000005DCCAC417D7,
+0xA34151CD67788105, 0x36A51120A7923EDE, 0x0143918A49A80254, 0x08ACEF206999E282,
+0xBBE29B6DC94A757C, 0x9570DE8EAF7341BE, 0x14C37041D8D8E6F2, 0x650A24F523CF4AB6,
+0x40DD356237DF8915, 0x391E6E27D7AE958C, 0x11C619F62BCE5C15, 0x00006E8B690651AE,
+0x1D20FC477AB4D22D, 0xE4246774FFD8BB15, 0x87E7AD8CE33A65D4, 0x3126872BBDEEA20F,
+0x9A69FF9B541C1014, 0x2774F25B128FA24D, 0x3F04C00E1948719A, 0x17518AF914AFC0DC,
+0xCCEB9B506CDC922F, 0xA96C4B6C5281C75C, 0x93C3744E1ADE1161, 0x0000594CAE8E4A5A,
+0x2AC43EC950DB329F, 0x73A8C10B458A9928, 0xB02EDF2614D1B96B, 0xC35DB64D65624BD3,
+0xF1547D6BCA918D09, 0x77A01AFE703E463A, 0x0D3E9329F336139A, 0x642EA6E65CA005A5,
+0x3CE3EECF95D4C8C5, 0x30B5912CBB686E32, 0x0E018125F69BB0F5, 0x000052DC47EEFD22,
+0x8A46096AA2D0BD20, 0xFDC28F4ED49D2181, 0x1D4AD71DB6844040, 0x8E22A882309569D1,
+0xD4538AB26C3DC2BC, 0xF14E790C53B963C4, 0x73E7ABE3140FC006, 0x44BF538FD85F81D3,
+0x351B535D98BC8E1C, 0x1D532499859F8600, 0xE9FE4F13AD9BE717, 0x0000680BA6196BDA,
+0x0B5153910F204003, 0xA2200F00F7066CD6, 0x0834CB2CE90DB79C, 0x0240ABE88AFEFB18,
+0xD166F1BE8184DBCB, 0x6073FC6479B2E44F, 0x76EB89FCE17E2FD8, 0xDF59DD59ABB3902B,
+0x4DB90CB7926BA67E, 0x2B4CBC7B4FC701A9, 0x05E2379094F52DDB, 0x000034B302CC6B71,
+0x7FA14A89AC82C191, 0xB378E37965E6B4C6, 0xB32ECD659AD26AC3, 0x9204FA00124F50EE,
+0x288DAA2A8F6067C4, 0x2BD24AFB3F982967, 0x303A40EC50DDE3D0, 0x998F540C66434493,
+0x55A80A673804A2CB, 0xE5DE81419A412B58, 0x6061C7F892EBFBDB, 0x000001F869D37914,
+0x9801F113265ED655, 0x2324CB71AAC92551, 0x3CD1B4322FF7AE27, 0x89D2658AE4D1244D,
+0x4DFC2E843D1C9481, 0xD1C87119DBEC6E79, 0x864C2EB3311C5D3F, 0x6CEE92CFF6EFA5A3,
+0xC0D09F5CC512D754, 0x8AA518F519C06756, 0x3935612A85BAC5EE, 0x00005CAC5193A580,
+0xEA0DEC648DE70978, 0xA374C699482258E4, 0xC16014774E192A44, 0x9ADFF44D265B804F,
+0xAAA9EF6035AF3021, 0xCC08508E85A93BFF, 0x26D1E7B9AF70BDD4, 0x926CE4C0576EBCE6,
+0x8867855C49F52D8B, 0x96DA60CB69B19A3C, 0xB34C41E4CC56745C, 0x00003DE840207647,
+0xE9CA71E7A0B15B30, 0x5F7B579CE843AE3B, 0x79B09288CADCA0C8, 0x295053886BC9E140,
+0x2BDCAEC1F201353B, 0xD694B49298F300AF, 0xE29B55A54449A705, 0x74935C00189D317E,
+0xA075EF380B7C8832, 0x9FF316A2FA112760, 0x934EA04924BA1B2C, 0x000060773E75B9B7,
+0x9E7CAF9B6B1F4444, 0x0604110D67C1A338, 0x883E5A36EE04D04E, 0xDC6AE0E78D235C9E,
+0xD68E64FF5E29C0AA, 0x74AA267C9047222F, 0x607505635BAF2E93, 0x3C91978B310B6DC7,
+0xE6A1CDD07F3F5C02, 0x42A5A630ECDF9C02, 0xF780E0B422C3E644, 0x000024FB8C829F80,
+0x1D6E90B7286E59B2, 0xBF8067F0D25A3D7B, 0xBD871CF11A752BE1, 0x019D178EEC701620,
+0xC83A96A530F9D8E5, 0xFB2C659DD68E7D6A, 0x3624C5C888A82E20, 0x38365DE9289CF363,
+0x4BA49B375D84AA97, 0x278E16C8FE5D1587, 0xEE7A5BB73981D2F5, 0x00003BD2DC7DD05F,
+0x1F2A1A361A434ADF, 0x6AE4BADE26D9F6DA, 0xB3DA5B637BC0BAF2, 0x027860E8EFFDBEAA,
+0xC84C2E655D746D8A, 0x6D8E94E136076843, 0x21CA2913ADFBD40D, 0x3C37FAE357022E4D,
+0x5AF4CF77313F17CC, 0x68A357600C47EE0C, 0xAD2606109922CEF5, 0x000067F649CE8E28,
+0x50A78B4FABE72947, 0xA9362B0E1678FF1C, 0xB87CDF66E7F8A5BF, 0xB05944E69265EB9F,
+0xE79AE368FD31D47A, 0x3C8F35A1587542D9, 0xDE958162EEC2780F, 0xF0BF0FA118F779AA,
+0xB4694B54EBF1FC49, 0x95AA424A7F1E1434, 0x7A2BCF0D85259941, 0x000041A0B466CBD8,
+0xAA74AEA8CA721FE4, 0x8793C4517C7AC38D, 0x5DA9E41C8C614CC3, 0xC886D44FEFF02D7B,
+0xE9A3DCC28F5FB0B8, 0x717F59C80043085F, 0x8BD4EF118B903330, 0x4E3E3764C761B9DD,
+0x5634558580418A41, 0x1A3D21E818797C10, 0xA81CE7B4460F05FD, 0x00006E4C6F6FB34C,
+0xE8802FD9D28F9145, 0x716F5DC6EE2F168C, 0x8272E4B84D22CA22, 0xB720CFB9AAFBBA7C,
+0xD3A23279C5E266F8, 0xFBA353393B54D10F, 0xF70345D8B566D5CD, 0xA4EDE0B10F49B6F8,
+0x0CCE3CF9D09B78A0, 0x8F9D157847D9825F, 0x4C40DCA78F96ABC5, 0x0000254802444B06,
+0x728960074389F851, 0xFCCA96B74A5D114D, 0x5C870E45B0FF1E38, 0xC0B7F0C6A9F78DFF,
+0xB29A133397BC6770, 0xBE9D74373EF7F507, 0xC5CF1F29C188465D, 0xD39CDD61A7A95643,
+0x12D35487D8B54B44, 0x64CF5F9839AA557C, 0x7A57525742B8A111, 0x0000394B0A28806A,
+0x2F9DCC9D4363D9C0, 0xBDF7F0459C5550D8, 0x11887B55292BF109, 0x5A4A109DBCA53018,
+0x2525EAAEDA8EDFB9, 0xEA1289AA9AC019ED, 0xCCCA9356A61ED976, 0xA9261803D4A01296,
+0xA891993F25D5FED0, 0xB26AEDB1D2A25A43, 0x73D5FF45A4462B9A, 0x00005E0091884722,
+0x1D58C327BDBF351A, 0xA4583E13F7CFC68D, 0x4E11A6F339A4A7E2, 0x62B55AE9FC3F106B,
+0x65C446960A9C3543, 0xFE4922AFE6E5883E, 0x17A2F97240B79C4C, 0x7AAE7D165618289A,
+0x213E43DE5F787E5B, 0xEAD79B098CC88691, 0x804590D8EE3DDF25, 0x00000FAEC58DDEB1,
+0x68F98982182DB716, 0xE9F6330DB3FA2445, 0x6892C7BAC0685CC1, 0x4D1089680C246DFC,
+0xC319E5EF93D41C20, 0xB257173078CB1A2C, 0x2AFFA1731113546D, 0x80A773A4E3C6DFC0,
+0xC3C8CD4B847F3FC2, 0x40E2557FEF8A701F, 0x874F538C257FCEC3, 0x000012E3B8018E62,
+0x3D7CEB6C37CF6A9B, 0xD6465562A13D52E2, 0xBF042FB0259CF48E, 0x0CEF9A8333CAD6DD,
+0x29EB2EFA0C6C3E98, 0xFC25551E53057D67, 0xCC18966373D3B808, 0xD5E8E28D68109525,
+0xC84960162D9C5771, 0x920F82FCE1D0ABA9, 0x5AF722132548874A, 0x00006EBCB26BFF55,
+0x9E27DE5053B93796, 0xAA49AB773E1CD5A3, 0x8168FE19F6DE2EDE, 0x6599426AEB7D1108,
+0xDC7BE367EA8C32FB, 0x86B8B38994975430, 0x8567E79DCCCFF0FE, 0x50F95E1E0AB063AC,
+0x6997E5DA2812F8B1, 0xE9C3A9C69FD21275, 0x81861C050DA7CA2C, 0x000055D293E1F681,
+0xA70360B593DE713E, 0x498CD27B10C6C3EB, 0xAAE8C02900155411, 0xC7F0B6EA2EDA455A,
+0x5376CC1F94C8C2E5, 0x8FEEF807139DCFB0, 0x91524BA998180012, 0x9AE2D7BB7427313B,
+0xB4D7D556AB394CB1, 0x451F46D039B3F36A, 0xD198E98E24CBA1D7, 0x00006E1F693D100E,
+0x8E4149CEAD75BE17, 0xDA1D295804EB15F8, 0xFFBBA9469783B0C9, 0xC9FDF9F681196B81,
+0xC72ACD6BBCA92026, 0x052CC66B800E716C, 0x17A31F3B127CC765, 0xB51DEB3FAFBB6C82,
+0x54E5D1AD16E648EA, 0x0C95C1DA97FD2F59, 0x80941244E4C71E0F, 0x000024BC68483686,
+0xDCC1DC94DE935E7F, 0xC6D69523DC7FAF16, 0xBF1DBEAD6BF01658, 0xDE85197C0C6951AE,
+0xC3E8837DD8A9B1C0, 0x62947786D24D3C9E, 0x9E4EFDC5A1517632, 0x9064DB98F0A91A65,
+0x573EDFBA64AF2528, 0x8954E673DA71BB91, 0xEF06B53D50063A83, 0x00000F1A160060DD,
+0x6EC250D981C95CBD, 0xD9F51B483D2A3E83, 0x36D5EA66A8E84534, 0x055F3BD7D32D38D3,
+0xF987C339FF9AB974, 0x5B0564E2605E68C8, 0xA0C9181211D0557A, 0x11F126BBE7918F3C,
+0xB48FAA823AD6F016, 0xF79362935A17801E, 0x44B18598CA1BE62A, 0x000009674A924284,
+0xDC8413F38427C5F2, 0x4F0E471977922C45, 0x4B07C787BBF5A7B5, 0x736AEF18B423AC1B,
+0x0D5EE99F67A13FC5, 0x960F3F0BDB0DA9E9, 0x8F0C4FBBD6ED5F38, 0x0EBB0AE52914A699,
+0xE314CB3B1E23D0CE, 0xF9F3C35D05A8A3F4, 0x09E2634E952DA201, 0x000014DE5A4BC3EE,
+0x06EE75D41BC566F4, 0xCB488489B595E6BB, 0x34BDA20C4FE6822F, 0xEF72A4CF9A9DD712,
+0xCB45E2F52D6305FD, 0x09CD79B9CC34A882, 0x5E3BD5D3E59B72F8, 0xB6B6F91C16B92ACB,
+0x330BA8CD2EE4C975, 0x0CE7910A4B8C8983, 0xAF90228949E229CC, 0x0000212BE43B37B9,
+0x50BDD8927954A808, 0xEDE021BBB6DA799C, 0xCF322BE02385E71F, 0x141AFDB47B2ACD32,
+0xD4228CBFF6878073, 0xCF3B67BD786754F0, 0xC345FD73A165D655, 0x741E24975039C00A,
+0x35EC55217C17CF38, 0xF4312F9094DBD78E, 0x35D336E10418149F, 0x00001CC383D43D3C,
+0x7028DCD79758A2F4, 0x3DFACA6F5A3FF134, 0x2914C7D690BAE6F7, 0xCFF4860AF90D16E0,
+0x4E7ADBBEC045B606, 0xA5F1408F7CA2DCA6, 0x6445CFB18F25E851, 0x49F6AF04B7DCB1A4,
+0x5B5F30F12AD84656, 0x3A541DBBC1FF415D, 0x082B516BEBDBB6AE, 0x0000602DF35A2395,
+0x3EC3BA4FCA54C4C0, 0x0F128311C1310D74, 0xAF68D2EEB20A1867, 0x7B53B64E4A57000A,
+0xFFDA8BC6D666F36B, 0x26FE032E1458F56E, 0xD7150AD0C02294DD, 0x27169667B1F77EF4,
+0x65A0BACE35308450, 0x755F2527D75A6618, 0xE34A2D48DFCBAAB5, 0x000062C4298842A5,
+0x2F2AD5DBF5047C72, 0x8968BFC4382C269F, 0x9BADC7DF50E1613E, 0xF31C7A8229936285,
+0x1103CD8320368458, 0xEDA404B44CF95FED, 0x062B99E66416D641, 0xE50D25A5755CE589,
+0xE776C5361BC4CF44, 0x62BB76F6A8BBD5FF, 0x85F74C65C29409B1, 0x00001C3A78BC300F,
+0xA59A45D5E2B6C3FE, 0x9451F1B6A1F17B40, 0x603798AF7095AC3F, 0x2C2740AAC7C122ED,
+0x530ABDEF61A5D416, 0xEC7BD5C3B10CA653, 0xDBAE44BB7F8EC8E3, 0xE19C8510F1DB1844,
+0xDC77A4FCAE25A058, 0xDAEB5902FF8A8C11, 0xC6A716AB6AA22C27, 0x00000396213B9D6D,
+0xA95E123B2EAF92C4, 0xFE1B01FE5EB110B7, 0x74144F612CD53509, 0x7D834A2C63AD205C,
+0x83D9D166F1565A8D, 0x7DCC5A778F2E0DC9, 0xF3DB02B2D6EDDB00, 0x0AFAC117F65B7C21,
+0x997A2CA94784EA26, 0xE037FCB2AAA5171C, 0xE47196F3C7371FE7, 0x00002350B81A8CF4,
+0xF43AB36DE65F24A2, 0x013706EA067F0AA5, 0x12BE5F27F0D521EF, 0xDC4AD355C19CF270,
+0x3DA91F82E7C7F6CB, 0xE901CC7DE978F8CE, 0x66B4EAB3FCFBFF51, 0xE24FD7169A1ECCD9,
+0x081B89CFC5A20881, 0x4D9F633E2F4AB7AC, 0xBE04A40836ADC199, 0x000023DDA047B615,
+0xD687800A1D37A97B, 0xF7A080E63056F1F7, 0xF34A218AD1E8C663, 0x76EE504EED4F169D,
+0x6B9999A9FDF38CE4, 0xF002CD0413A51BAC, 0x68E414D4E7DEBED9, 0x4773601DF8CAFD0D,
+0x8B92EAE2CBF6D5F9, 0x25207F717EC42626, 0xA999E6BB85939D14, 0x0000142E21D00FDC,
+0xB0D7325EC2022E23, 0x149BE848C27E4FA2, 0x9DAFD7C0C3DB3A7A, 0x5F9F7C8AAC77D881,
+0xEFCDF54FA0F007BF, 0xCD1F5B0401427099, 0x391E16A33C339EA2, 0x84F39395745EB651,
+0x733236BAA29D4787, 0xB8B1C888C72670EA, 0xE8DEB80BFA961ACE, 0x0000666E90BF1232,
+0x153DCEAFAE480FCD, 0xF37C4B503454E4EE, 0xD61902A5625875EA, 0xD88E44774A36A19A,
+0xA7710D435A5676C7, 0x6295EE0AF4EB3595, 0xB2BE4BCC71DED9CB, 0xCEF3044A6FC894C8,
+0xF14AB8AB431A3692, 0x623029C919605590, 0x756A99C1142DDB0F, 0x00004D6841B10384,
+0x89E71001AB2DB920, 0xC77BE1DE3EF485B0, 0x9499397BF6256EAB, 0x6D93B85DA4F306EB,
+0x13A66D678CB8247D, 0xC573A3CAF308ADC0, 0xE2FCC17918FCD2B8, 0x67056C2C683E7484,
+0xB86CEFB8382C9652, 0x04699D96CCC86299, 0xB0B23340144A7836, 0x000042EF9C4B73AB,
+0x666AF0C9B0DD96E2, 0xC07C1B541FED1F9D, 0xC44DB831EC4D99D7, 0xBE04CEBF59B1AA26,
+0x95AE91F333ECCF3F, 0x3D049BCFE99070CF, 0x2FE497C81CF8B02A, 0xCCC5EBE9A1075BD7,
+0x3896D06BDAE56A81, 0x7AAFFAEF5DA4EDD0, 0xF3C520B372363E6C, 0x00001D0BC7AD0717,
+0x42255427465097FC, 0x7AD5646992A9263A, 0x68B6802101C38C64, 0xCA3A785A03F299AE,
+0x969352C4EEB00135, 0x9CEB15A4CE7CB10F, 0x4C9065977EFB47F6, 0x50E4F7F71929B677,
+0x7928FF5E4AFB07EF, 0xBDA42FFDB204C5F2, 0x5FF8CF8F58DD396C, 0x0000504079CC35BB,
+0x3F78674434898076, 0xC0A3DDECA74B2B95, 0x5DFFF376596E8955, 0xC4D16719682B4842,
+0xA41F1E50F9664FAC, 0xE1E3D9531CA90E7F, 0xAEA1717F93DE96F8, 0x24C6B6B65691AB95,
+0xBE9CABAEE56BB837, 0xEA0D85AE336B404A, 0x119ADEDED9225D11, 0x000017F893A735F5,
+0x27E1E909889E87AC, 0x236CC66DCD771AB5, 0x584AF6055BAE0CBA, 0x54426CCDDA3B2FCC,
+0x0F6619CF919CACCC, 0x414D6975B7329DA9, 0xB934252A48F70536, 0x76716EFBDE93D12F,
+0x193B332D817A207C, 0x9184AE2B6BE32C4D, 0x63C0BB66C875E4AA, 0x00004ACF17F2EB21,
+0xD292BFC37EFA2CCE, 0x731B36F1F2AF35FF, 0x095FA1D29C54FE07, 0x66F3DFA51C957D00,
+0xB57141CF37BC6263, 0x264E536936903D8C, 0x79616467F8F30549, 0x1E01CD1B6BA6C6AD,
+0xF7F71FE588E765EB, 0xBF5C914F13DE9B38, 0x1B263E3699F6A8EA, 0x00005C574372A26C,
+0xC0D4F1D470298225, 0xFF276A366D9AD8D3, 0xF6E20166CA4C28E5, 0xF23DAD7E7B149D64,
+0x31A6FCF15ACFBB4C, 0x866816A94E5CC00C, 0x64BFE10A5BD2DCD4, 0x56909A291F27E759,
+0x774A4B3F8510202B, 0x83B07FF35928DC5C, 0x8911DDE6B7D1A4CF, 0x00001EB8DAAB69BA,
+0x1FEB956F70A0F59C, 0x243E42A0F1A8FFF0, 0x2993AEB9BB07890E, 0x246A31839975E3A3,
+0x23EB49D22B09DC73, 0x0946418566219402, 0x3894E99BC3AE9D49, 0x43B71BFABE7D9159,
+0x2CD49956E2C48FDC, 0xB9D03E996C4514C0, 0x8CEB38AE795BCBA3, 0x00003E07F5A58627,
+0x342D7CA290E2BEB8, 0x4BF0ECD956A21EED, 0xAD22B1B801D35E7F, 0x6B524019B9FF815F,
+0xE0A63F9BAAE6946C, 0xEFE8A1D4BFC2A8CB, 0x5F02E7E5E133CF48, 0xDD9446F2AC76B6F1,
+0x4353B7CEB62626E9, 0xC833ED09E099841B, 0xEED6FD5738AC4E54, 0x00002DD83AE88880,
+0xEA6BA0A3D521B750, 0xFE277F2C0F776FE4, 0x251D0750F0850EC4, 0xE5ED88711B9757C4,
+0x8E7C2DD7265689DF, 0xA0FE6684756632C4, 0x844F4A8A56FADF39, 0xED01F7ED1EB2BBF6,
+0x57654266B25EFF3C, 0xBECE13576090571F, 0xD5174E84DAA7B769, 0x0000428E67C11B4A,
+0x9EE0AE47B1F33138, 0x08DBC4AC0B78D9C5, 0x3CDAC1FD27927947, 0x91945F39C19B41D3,
+0x8AA1E4BCCF067919, 0xD02289CA58E29B99, 0xDFAB78096FF97E06, 0x8DD074DD55763CFD,
+0x12AE997DBE3F5D22, 0x67D102DCB2BF8011, 0x7E40EE6102CD39F4, 0x00004E38C9C52292,
+0xFA9C4A30A90E48FB, 0x47A8F749FF7BF83A, 0x8E39AB8DA045F35A, 0xE0C8A87BF38B7D7A,
+0x1F0D525B904CAF70, 0x8D8FD876E84920D6, 0x27BB15F8B3A1790C, 0x3CF52FEBB631F1E0,
+0x8A1D01C83F23FD8A, 0x790A2CA834D4493A, 0x70E7A7000331A496, 0x0000237F899F30E6,
+0x715A8DE184DB75B0, 0x5E80A92B614AFE58, 0x73751E4C85FDCA0D, 0xBB1AC2911AF566AE,
+0xAC07F6986398040B, 0x40001C636CA81937, 0x7331658F4CEF3A7B, 0x9547298EFB1EBC5B,
+0xA7676263C363D1F6, 0x8B8AD7110BA76760, 0x08B1FD41D959B878, 0x00003F5F8F84135C,
+0x07019736EA5F4AB9, 0x07C5D717861AEC1F, 0x0FA0540F38D30000, 0xBACE0540343D1108,
+0xDC58F71F13FF0DB8, 0xBD58FD22BF46B650, 0xD344D8B271C38FAD, 0x90E8D4EDEC4BF790,
+0x0D325BC7660D376D, 0x4109EA986EBDFBD6, 0x382FC33777B4ABA3, 0x0000459E07EBA89B,
+0x868A321DB2E01E6D, 0x40EE0F69FF1C4306, 0xD875613C1384B9D1, 0x8077D298AC17B90C,
+0xEEAEC1268ABCFC89, 0xDD7404C2355C71E9, 0x7AA075354DF82ACA, 0x6E600C9EF618C76A,
+0x49B549A1FE05E470, 0x487D04150D78DD13, 0xE057C081745BA5C5, 0x00003007086030C4,
+0xDDCADCE2A645CD13, 0x1DBCA8367E91A479, 0xC912CF43C949D7C9, 0xE419627BFAB07BAE,
+0x98F453952B96C57F, 0xFCDAE10E0FB4427E, 0xDB31C3186572D8BF, 0x626631F33650B401,
+0xBF5771CE626659AD, 0x027B9F19609F5F68, 0x22B0D4BB2D7E8A30, 0x0000365A3DD02CD0,
+0x941785A9FF6EF3B5, 0x012D1619FB6CDAF0, 0x4E523780A5D007DB, 0xA9840257999EDCA9,
+0xC75E6EBEE8A4D847, 0xD84A0030D233DED9, 0xFF785AEAB98DF3CD, 0x10BF1F1D77CFA23D,
+0xCF2C00D9402D4661, 0x5700A54CC253B193, 0x74283C685C4FA563, 0x00000827970DDE8D,
+0x0CAEB9184E6D97D5, 0x03CF48B472CBE9EF, 0x5BE6322BB1700E1B, 0xE1882001B84DFDD3,
+0x10CE7AD92A53EB1B, 0x6274C13DC4EF5BF5, 0xFA4B08CCBECEFB69, 0x7DC7647597D89560,
+0x4A3480F8564DE3E7, 0x907388CDB90D5C3C, 0xA1B54843C05D447C, 0x000044094BB1AFDA,
+0xF97B6F97BB30E696, 0x74710375E386EFF3, 0xCCA7E6BBEA0F05FF, 0xDB94A3859A15C6FC,
+0xAD4FACCAF758193F, 0x0BAE9810DD35170C, 0xA51048F64E735C5C, 0xB30FCEB31E0D2174,
+0x60A31951A2B10CD1, 0xECF5D15E740DCD35, 0x86AE9B08B0C1CDFD, 0x000039BF4FCAF4AB,
+0xEB8431218E4B0CC8, 0x3BCDCFF21CAADEFF, 0xF6F31D3929245937, 0x2CBB2CB62A20A030,
+0x7946A40DB4F19736, 0x10D658254ADD36EF, 0x844A22A4D3B8174B, 0x96BA755D13AC3909,
+0xD8A8AC99EEEDF47F, 0xC38A2E6B4DF506E7, 0xEB807C7C62E122F9, 0x000023390F7EF653,
+0xF57BD5E445DF86F5, 0xFD88D412A73E2619, 0x79C9385D7340780E, 0x54DC45B168E6EF6D,
+0xFB1DABAE8CAF75FE, 0x086D11933B08482A, 0xE113029D15F5D482, 0x9316C65BC226BB87,
+0x3BE91984712BD146, 0x80D8D6C1A63E1024, 0xEC8E510575375901, 0x00000634C97D9D08,
+0x2CED5431138730A5, 0x1A67DBF26F33C1D4, 0xD144B799A22EFBEE, 0x62FB54443428C044,
+0x2B0A8147D579F5CC, 0xEBF2561A21BDE94D, 0xD277BB9420ED0DA6, 0x358A86904E348168,
+0x6FAC5F5580FEA8A8, 0x95AD5A1A57B6DE94, 0x417B9CD0BDD9D9D2, 0x000034545DB4101B,
+0x57AB18465433D5EB, 0x7731F12CC1F7EEF3, 0x6C08F62A0530FB7A, 0x355D8C88EE3D8C96,
+0x17E848206A7D5AD0, 0x1FC72AE30C4215B0, 0xE2C020B455B389A8, 0xC97858016F92DC7D,
+0x50BCC683487DF9BF, 0x833D36F7568DB278, 0x80289F436D19E7ED, 0x00005ECDEB89C2A1,
+0x6E10E020850FC3EF, 0xA4D135F6FEA35266, 0xF1E2FCCF84DDFBA2, 0xF4BD096221A37BDB,
+0x831FB6F13D3EC68D, 0xF2B758BFD657D501, 0x5FC063F54A307B93, 0x705F8FCBC332DCD1,
+0xE48F5F18020E019D, 0x8FAB7C7A5C2BC3A5, 0x598F2218A903AEC5, 0x000069A46040C122,
+0xFD3E16639026AD1A, 0xC3536DB9D3F49750, 0x7FEBCBBFE94837D7, 0x26A6983D0F7660C7,
+0x53D2608FE5144EC1, 0x94BFF79A830165F5, 0x7A6091174004D042, 0xD5949E912AFF1C6A,
+0xB9AAD53788DC9BFF, 0x4A4CB6EC4E9F0F21, 0xE0BBA03F3A5BBE72, 0x00001B1110A4DD96,
+0xFDFF56B1EB59EF62, 0x4DC2112577A54DB0, 0x928E48BD0E8D4CE1, 0xBCCE73FD74751B78,
+0xE9ED20EBD1B072B2, 0x207C61377AB1465E, 0x46A03B7B30C0213D, 0x01AF28D2EEEB3EAE,
+0xD4D5E3ECDB1DD5D9, 0xE21D3F96F747A10D, 0x0B48C217B7D5C154, 0x000036E416D49F18,
+0xAC3E403C080D7450, 0x279A48F3295423EE, 0xE2FEDE592A20595C, 0x81ADAA606A1C8E5E,
+0x0D940F99F84D014E, 0x031A0C44D2A270AF, 0xC41FBA666FA35CEF, 0x8CB34C88957C46C8,
+0x6C84B77758516B69, 0x5E3B1EE8B7DD3CA7, 0xCBC2DB0A7BF8B7DB, 0x0000074044C8C2C8,
+0x5EF6709D50DCE0D5, 0xA44EB044DC870145, 0x6AFAB2DDED0295E6, 0xF14D5F11DB8D8428,
+0xDB30F479BECE9438, 0x62D8C0BB73BC3C0F, 0x78737C351121550A, 0x85A3209A2BB1BAA5,
+0x69C60BD4FFD4FE4A, 0x6FE1AA203A608208, 0x7EFFC9DF637C9F03, 0x000031DF77973F7F,
+0xCCD9B9F7C8719F65, 0x5CB4E85D113F3CC4, 0x544A5DB6403969E7, 0xBA2632BB09FFF66B,
+0xA97984853E0982ED, 0xE957C2184F9945F7, 0xBD3F3C16CE3F851B, 0x79B651E43CB9F64C,
+0x41C66442D4AE5454, 0x0A04DBF5E49C1201, 0x29A5C1B8147FD083, 0x0000303D5A14AD02,
+0x1F456E473B9153BC, 0xEA1025783966A266, 0x7C39007F5D034361, 0x11877E7B0C6478D8,
+0x8B2CA55050D0D8A8, 0xB3EDB7DED2A6B32E, 0x4C9FE2FD5968C33A, 0x0B8F27EEB106BD69,
+0x0EE7D85B93B0106F, 0xD86C838D46DD466D, 0xDBF5073E3E335A37, 0x0000059B4BAD206F,
+0x86FBB549C2E0AF1E, 0xA4E6F0A31CE06218, 0xD965F53AE547A716, 0x1DBFE744833C3F5D,
+0xBAFE9C45F954F5EF, 0x9246280AC525ADD2, 0xBA9BF403CF9AD6F3, 0x70466D7F50667E44,
+0x6EE88414CDB4EAAE, 0x2255D335513CED97, 0x1B87A9BAA529933D, 0x00004E02279C70ED,
+0xFB96F5E16841C592, 0xB31F58244B5FFA3B, 0x576691DFD0CBD482, 0x7F2818B13CD5CE38,
+0x08678FA1F2206FE3, 0x3617F247A8896ED2, 0x9F9AB192DA764B61, 0x9CAF6592324BFB27,
+0x2F0C31CE5575FAD3, 0xE9BCC711718426AA, 0x95CF3C403761B97D, 0x00001BC3D10CA8D4,
+0xBAD21E2B7435F89A, 0x2F55EE93D210338A, 0x8F5761E46EF40F9B, 0xFA78D0635ABF79AF,
+0x78CADC36C94083A1, 0xE52952D826F2926C, 0xD82B0861FA0820CB, 0x32B31109AA9377F7,
+0xFE94A30360173C84, 0x01EE15A0B2DAC080, 0x6A17FF1E1A49551B, 0x00002BA46D793BA7,
+0x3A7CAB2346702CFB, 0xEB4B8EB95C6A5E53, 0xAA52A756ED5EF0E7, 0x59B0B7881EDBC21F,
+0x5EE57D7EB1E7AC7F, 0xCE7EE320927AA098, 0xAF6B41EA48AD0A2A, 0x4D1D2049DCD3E3F4,
+0x2C1CD62CAFCCE52F, 0xD529EDA3974269B8, 0xCB62B3030E5CE728, 0x00004B755BBFDE82,
+0x1BD2E75C71C777FF, 0x2871139CB1434A79, 0xE1DA454F1DF4135E, 0xA34B000F9B2DE107,
+0xA0D43561B2AEFF48, 0x89FA12824413BE42, 0x2C534C10D4502932, 0x2DF7D7F9FC920768,
+0x6A114D3E7C303CC1, 0x84F44A5F7E0E2E8F, 0xD06CB98BB9368412, 0x0000548B532C9C22,
+0xA25A5DEACCB092FB, 0x8F7707A449D06B93, 0x96D09E361C6D0DE3, 0x938E03BAEDFFEF53,
+0x8B13A25D62262027, 0x5046644E979646A4, 0xF8609D14D8C263F5, 0x999C818B7EAA2D44,
+0xB224B20D1ADB4652, 0xD9FD755694E74D37, 0xF28A65C7B4E9B3CB, 0x000068F96E03E46C,
+0xD109879E693E593F, 0x1114204E674D99CF, 0x682C1D1A2FFAAA18, 0xE65501B0D6FE0968,
+0x44BF93B35FA85160, 0xC075153472633AF2, 0x750B38B38F108F87, 0xD69D05246003BD70,
+0xF8A4F7389200DEAE, 0x531C88C0FEC8C6AE, 0x328276302729CD6A, 0x00001A21C50789F6,
+0xF7BAC9D71D6600CE, 0xFCF36FDE66C8C73B, 0x8B0594D61606FAF1, 0x73BC2106802C34D6,
+0x2F72FE1A75372793, 0xE36CC7369F6C40DE, 0xDC224CC5C5139C37, 0xA7A3D797E40B6EBC,
+0x50F1C4F0B1A55DD3, 0x6B70C3D8F367ED8A, 0x84063CF388EC9FD2, 0x000056F04FC6F218,
+0x876159E00C95C73E, 0xE6CCF0F8E3DFE904, 0xC058FBB9B07B6D05, 0xB452ADDA2B38D66C,
+0x991459B4166CF74C, 0xC318FB29BC20C8EF, 0x176450A3CD6CAA4E, 0x79697D8C3AA5CF61,
+0xD99135A01C9C6FD4, 0xF7C4A51B0F50D41F, 0xE6FDAE564F6B4ECE, 0x000054618F7EA627,
+0x5C03BD37FA80976C, 0xDB232D3E8CBC1F97, 0x74EE45521A6AE5C2, 0xFC5C95AAB84E9F84,
+0x93B74F1B65CE1EC0, 0x416782D3891E4111, 0x61C09410C6839895, 0xD7FF9DDD2EB8BB84,
+0x20DAADD1BFD528FA, 0x0D14D999740FA0A7, 0x784D0DCDDE370A86, 0x000017801182745E,
+0xB034482DCD40AA15, 0x15A1CDCA5E34A2C0, 0xCE5AA45BE367DEDB, 0x50E5CA08159B4EF2,
+0xEC5F49F6C4245ADF, 0xD8F34EEDB3875AEC, 0x98A8E48148AC175E, 0x9195A4D2F8E67CF0,
+0x7FD675FFFDB3D6FC, 0x7213EC3FB492BD9E, 0x14535939A0EE162A, 0x00002A4491E90C97,
+0xB0DC80652C7A7044, 0xE3112A69D015116C, 0x56D12D505C7B794C, 0x88B7C44C689B4309,
+0xACFF01D115E04A08, 0xEADCF5C7DD1EEE48, 0xB8D27DFAC7F520D0, 0xA3CD7C62BC373DCE,
+0x7D5FD14EC02664BC, 0x1AED5B7F5605A7B9, 0xE247FCBE20771C8D, 0x00000042F0DA7DB5,
+0xB52CCEB3FD443810, 0x1068623540C78508, 0xE43DC7F4087F74DB, 0xD8436CE5C1C811C8,
+0x6143E65E315709FB, 0x01B18A6035798052, 0x2F9D4E8CB97E6CC5, 0xB148592258432A5E,
+0xF49638F80E435BE8, 0x2BD80B64B4434DC7, 0x1152627A65D0FF75, 0x00000AF77340A847,
+0xD79139DB557DBE1C, 0xAE7F5426317ECCD9, 0x4F7DEEC3B649DE7A, 0x4C696B10C1AF7076,
+0xBBA9F89EB958A040, 0x163AA0890A72EF57, 0x48FE38914CB13508, 0x6FDB4B663EE32380,
+0x1EBF1C06D7723DB6, 0xAEC40F52E9D927F5, 0xD0E149ADB6AACC50, 0x000042BC98BC67FC,
+0xB38F631973E9E76D, 0xEA01EE358F1BB36E, 0x3F07D51119DB1AEA, 0x970B987FAE9EFE22,
+0x22B748AFAAD04DEE, 0xDC4C2004119B6A8A, 0x52D5AA0FD6789151, 0x115FD3810D5FEAC3,
+0x47012EA0AD23461A, 0xD87A2136CA262226, 0x836737D43FBBC233, 0x00004261C9F2B274,
+0x576C67290FFD1EF9, 0xDB03D7EA1721DA4F, 0x0C297936F6717D13, 0xEB23279C111CED45,
+0xFE94479D7E5F972B, 0x283526AE977BB380, 0x84A4E98C9AE71C18, 0xE8BF39E0A9FCEFD6,
+0x282256D179836A5F, 0x4D9DD5DA3FD61E0D, 0x0DF7EA543C3FA0ED, 0x000041D195327E68,
+0xBE7B7E6BC33CA5F0, 0xE51D92C5166525F6, 0xD2BB7F9E9A8AC164, 0x8DE9C0771041FB1D,
+0xEEEC9584375927CB, 0x506B7207951B6E09, 0xD7BA05C7F0F78C24, 0x572BA5AE61BFEC9C,
+0x33B82CCAFABDDA74, 0xB1C838854A487185, 0x9D6C8F064C4A478C, 0x00004102AB197AD0,
+0x180CD10FB39CD4DB, 0xA587AD8D8F5AF808, 0x1A6B5B82018818B5, 0x84482628988DC4FB,
+0x6A7D80560C100669, 0xA81F255813ABB906, 0x3C362E3A51CC32CA, 0xB42159A3B8EE18FA,
+0x86D925AC61AFE61A, 0x7E33DE3DDF6C3F38, 0xFA95A9BB48EC19AE, 0x0000003994A3B6B3,
+0xAC9F03F67A401179, 0xB6090AB0C1AC64C3, 0x9C36EBD649144FBD, 0x3541987C58B779C0,
+0xC5019C86C18C6409, 0xAFE6C58158B09996, 0xA4FFBEE6402BBA93, 0xC9A56860907C391F,
+0x358789264AED643D, 0xA01A3845A950778A, 0x57F4A052A416731B, 0x00002EF65E392C05,
+0x8EEDFF00F036BBFB, 0x35A2FEA63A42D576, 0x645F6590D0F4844E, 0xE20E2194DDB53200,
+0x8970B0958F55005D, 0xCEEA6E9329478549, 0x8401BA96D07AD72B, 0x927689DE9D073C19,
+0xC302BC9980FD1606, 0x4AEE0F381FFC0043, 0xEA2CDA6D98CDE3A6, 0x000006729C710F8A,
+0xF91FDC2A31276023, 0xB154D1E76FFDDE62, 0xCF8EEAFB94D5CE43, 0x77EAC5C14E1FB1ED,
+0x6D98A5DC07575EA8, 0x1EE3A1848A7812B1, 0x93F57D4F8279A92F, 0xFC97B05DD8028CA9,
+0x0E92B9A91D8A3E2A, 0xC0F9134A43AA49F4, 0x9BB8A5694C69BB67, 0x00000973C3F95B73,
+0x216C70F40EF5162B, 0xE0E9EDE5EE087CE5, 0xF897249F205AC920, 0x36CEA36E6B57ED63,
+0xE24FF2FE08B85DF2, 0xED2E0D5E80166B76, 0x0BCFC8E1FBB68C04, 0x7A5B971513EC7D77,
+0xF46B85F459F39C35, 0x73AA29227BE36B12, 0x065D614D6708820C, 0x00004C75F0CCFE5D,
+0xD2C74939EF229961, 0x44DA0852468E47A1, 0x63CACDA6650FBD54, 0x5D5AD5DBFCFE963A,
+0xE546D77207C85002, 0xDFE5A42DE4D5D42E, 0xD43E878D57326DEE, 0xE2F3087DC337DD03,
+0x9A94A0FCE7ADC53E, 0xED1C38E87CEF3C3D, 0x0BAD3E190F7EA0D9, 0x00000F739B27357D,
+0xBC0DE78B51349B44, 0xB568CD1AC04CAD5E, 0x07DD1489D6FD4652, 0x169A59B5D529EAF1,
+0x958F47AA9BAC8C92, 0x2EBE67CE29D8C1FA, 0xAB27DD265741E8F5, 0x843366AE9C0FB538,
+0x9EEAFA272637840F, 0x70D7EAB43689EED5, 0xC36D97F92AD4C445, 0x000069B26E6D8384,
+0x2673721F359E293E, 0x563BE85C4A5C9A2A, 0x1ECEA365B077E652, 0x1C87FF710003A991,
+0x849E1B79FE25FA7A, 0xBC0D06350D55F2AD, 0x6B97D9B0BDC61FB2, 0xC6A80D4A43A86123,
+0x80CE21562AA351E2, 0x4CE979A1AC52195A, 0x94DFC342D07581BC, 0x000069631B54E935,
+0x8DA79EADCB6021DA, 0x6A8503AABD9220DF, 0x9785F596257D7B94, 0xD6533AFF8F65D5A2,
+0x163A449586876933, 0x2B406A6555D364D1, 0xA0C4F0269DC00B96, 0xB52FF78611CEB06C,
+0x0B527D7D0848ED51, 0xDBCD37DF8B6A33C1, 0x720A00C11B07E1CE, 0x00003C4276FC8341,
+0x15D5D0518382CDF3, 0xB9336987BA55BAB2, 0xAAF898B575C0683D, 0xAAC7C50FB349DD1D,
+0x504EACE7CF24F79A, 0x70CFB7C2CE1074C2, 0xC2687A6B85D9C6D9, 0x5C381E830C820CF8,
+0x3D472A50FB4B2305, 0x41F4A2B0C569BAE1, 0xD48D3568F5F08156, 0x000063F34012C88D,
+0xCE1D5556CDEA7474, 0x54EB28D6E42B792B, 0x7A679537D521D1D9, 0x3A8EF13A24CF52B0,
+0x05EC8F168BC3B51B, 0x6CCF9D367ED39B62, 0xE08AA51D584B4AA1, 0xBE326B27CFFBF8A9,
+0x741CF296C66C9CF9, 0xCC57677D9B13C4DC, 0xBE8C6732799257A7, 0x00002935FF99E4C5,
+0x6E6861F8619804AA, 0x7E229756FE7F4FFA, 0xFDED6CDFB684CA39, 0xCFB5225FED034C66,
+0x4552D0CD9D137075, 0xAE56208F1AE80435, 0xFCC0174D3C44FBB7, 0xAC27C6CD3807C6A3,
+0x25AA11B08B662848, 0xBB572B6EB052E53C, 0xDE8FBFBF2BFC43E5, 0x0000348012C5F3BD,
+0x4709E72AFED6B108, 0x1ABD53AE6F2825DF, 0xE79C3B94B6221276, 0xD3FDE78EB9B09ADA,
+0x1DE46C1A28112D0B, 0x8D0498AB46870500, 0x8E24286682DB80FA, 0x1A19BE00B8A454F3,
+0xEE99DF558C484D41, 0x09420FE7A1CD55A9, 0xA6B7DE6F6552C0E5, 0x000069AC8B5E9D8F,
+0x1E880469259F4DE9, 0xD73CC9570DB040D1, 0x5A7584473689729D, 0x6A6C1824CE18BC7D,
+0x78A51CA230DE96F6, 0x90BAC4C761F6CF43, 0x1D4E6774B37CEF64, 0xA46E33E6C9697D26,
+0x9936B4B8E8576FD5, 0xF8E37B1D57685FC6, 0x7FD75A4FD157BB97, 0x0000148747DB81B0,
+0xE50F4FDFAFC33BDF, 0xC7D0DA03FAAED967, 0xD40B6092242ABEA7, 0x8D17ED878F2FE694,
+0x2E9633593C9C195C, 0x61DCDDD3644FBF50, 0xC35826D0297E96BF, 0x1471F7341E6A5486,
+0x0D83E6A700E6CA88, 0x27B460F8356C6142, 0xB1A7324C7F254C4F, 0x0000413A0C92FA57,
+0x7114C455C9C18348, 0xE5C6E87F2146B7DD, 0x7D49A5ECF136AC26, 0x98827FA2AE5F460A,
+0x1BE8ECDF44064CFE, 0x9491B51D393B8958, 0xD6E9741CF0C6B46B, 0x5AA14C7165EA9008,
+0x0D765EA019F49D27, 0xD662715D24299D47, 0x6EC12DD79F06B2D0, 0x00000FD6FCBB8A81,
+0xC6429E4A5B45FEA4, 0xB31FD6C10D175ABE, 0x20705FDF5BBBAA3F, 0x47F9ADD6A52E1F66,
+0x6D5EF75F6E62A73F, 0xF165B31BE1EC5008, 0x9EB5AA4115845F85, 0x896D0D4AE1B8054E,
+0x3DBA7219FFC92BBB, 0x74C97B12A3782059, 0x00C2B856F2D11F78, 0x0000582C84720724,
+0xA9D1645FB8FBC8F4, 0x98492C33FD87FD69, 0xEDA7F197D4034AE0, 0x5BC8C1268679C04D,
+0xE1FE3CAE949BCCCD, 0x70803AE413F99308, 0xBCAB02812E1F1DF0, 0xBB7C34B51EECACE0,
+0x027891FA49EA83C2, 0x34FFF810B3DD2457, 0x1828973E7671199B, 0x000065B7C67CD0C3,
+0xD3ABE813AA6DC155, 0x9F3F0E9312AB796F, 0x1D4706EB6D156387, 0xCFC789E8B377E63B,
+0xBF8D4CF22020F308, 0x4B8BC83E5E0367E0, 0x39C0F54FC71E1CD0, 0x4E99B27657CC450F,
+0x60155A13BC919478, 0x712385EAACB887CB, 0xC3AD59B1AE889906, 0x000002A8B3F50D47,
+0xA151998C4E5CF934, 0xCED65F8FD8FAA2EE, 0x7C9490FA5873D5ED, 0xAD5350876119D6C4,
+0x65FDFC3A8F0B3A97, 0xC1CD927C36250DB2, 0xCDE8FA4549FAFF5F, 0x86E5C1828A9BE17E,
+0x197F9F275F8748A3, 0x3D686673AABEE748, 0x908E5A07FE611DB5, 0x00004E16F023ED07,
+0x36176EFF3D2E0B7E, 0x24479BC913847072, 0xD04207540B4611CE, 0x97273875E8203CA9,
+0x287D58D2648595BC, 0x64502AEEB17201A7, 0xAC10174328A10D19, 0x8C819830EF676E8D,
+0xEFA0A3339F41B127, 0xB99BBF6CD7C359E0, 0x09F68E97827CC339, 0x00003C51FDB4EE2B,
+0x52F3606BCA5C3299, 0xAEFDD37EAA089278, 0x1CF8EE351B38EA11, 0x0D893BF42B250EF7,
+0x96BCAC15A81601A2, 0x88F86D6875FC894C, 0x7EDE9546E9BDEE64, 0xBEF44D65529B752A,
+0x0A883EDAF1CC52F7, 0xFB6ACE30C5561C92, 0xEB1A0149067C35CB, 0x00002CD0AE83B22D,
+0x02D2BE801C1AB3D9, 0xE3F817406F0745FF, 0x1CEB7B2F9EB9BDB8, 0x527C3BDB99DCD811,
+0xF7D941AE0C3EDFC6, 0x85714DCA8333CE36, 0xB305B4A747E639BA, 0x2EF920A8813F0F68,
+0x73A58B083B475D03, 0x5805163E730508B4, 0x09AB224208E0596F, 0x0000185005E88622,
+0xE09ADA727F023CC7, 0xF6C661F462DCE6C1, 0x78C9C0B5B49A5155, 0x8D8E3A76B453775D,
+0xC1DFE270D938AACC, 0xFD86CC7A0E368CE1, 0xE22CFB16B36D1CF0, 0x9000F982856FEB65,
+0x528AFA8B8FC8E2D0, 0x490C577CDF8EED1A, 0x6CFD221B6AB40CA2, 0x00000AB2B23A971E,
+0xC8D645CCF0841058, 0xF8B904AD7002294F, 0x37330EFD9E2B1136, 0xD3C658897C1E90E7,
+0x8F8DF02E123C1D5C, 0xD76AB414A21B24CC, 0x824EFAA91ADAC80C, 0x89777D5E924B56D3,
+0xB062705B463321AB, 0x3CB7D4338F06AB91, 0x922C0863B69D9CB9, 0x000007828A2B8ACA,
+0x8CCF54C58AE24B34, 0xBA664DC795133B3C, 0x09DC4435A1042107, 0xA23948B2C050FA8C,
+0x36B6972D8F87C75E, 0x53D76FE97B3DF573, 0x6818E0DBA7819271, 0x2C7BB066D31E9190,
+0x0E30D03D0D4FFC9B, 0xE0FA4ED4C81F23CE, 0xBC8ADAED0A7D457B, 0x0000560BD3C2B5B3,
+0xE0B9F71394C5DBCE, 0xFC90D569ED22A176, 0xA8CE9D2D827090C5, 0x0706C4CF9BB62433,
+0x3604A89463EB80FE, 0xA5415D551391C4EB, 0x02994C5523D1F1A8, 0xD0E4D0B370996A89,
+0xDABE303A94D8C20C, 0x6400AD06C82689CC, 0x1AADF81540A500BC, 0x0000673C6AB9769B,
+0x5AF03121D6C253F8, 0x9B7F427A25400B6F, 0x5054C79EBCE3FAB9, 0x6BEF41F65F8A41C7,
+0x4CE55225D6A12BA9, 0x3C58A1B545AD092A, 0x91E0DC09741D91F6, 0x8412B11BCDFD4454,
+0xDE8B8CAAEFED72ED, 0x0246E8C60F76B46D, 0x5777B4E9C449CC18, 0x00003A702BF3F18F,
+0x263941B066E76EF8, 0xE0AF5A9890C45820, 0xE795CC0F499181AF, 0x568186B6502B5F35,
+0xF90D1866466260BC, 0x400C11D114FEF287, 0xA6D8FCF51464D3C8, 0x4A7EB22FBD32CE8F,
+0xCFF6C5018BAAFF79, 0xD35AFD8418547C80, 0xE40C297CEF75A284, 0x00002ED6834A8EA9,
+0x6E7835E1C22A8CAF, 0x18132E65670AADCB, 0x036C15A3AD72FE56, 0x9CA48273343BFDF2,
+0x5DAE982A9A2AD01A, 0xC9F7B82613C0C065, 0x4C70930A624EEEE2, 0x67DE545E9B1ADA6F,
+0xE7771CB42BB6F63D, 0x08D8C8C79AF41AEF, 0x2C1F6DC1CD5F24B4, 0x000003A225DE74E8,
+0x3223EB1E994DBA7D, 0x499976B8D44CCAF5, 0xC4884E625DB5C100, 0x02A3FE438E30346F,
+0xD9709E2AD0277444, 0x476E3EC434C47975, 0x8A8F22C4E6A9868D, 0x56EEFA73B321E4F9,
+0x9B1B74D5C7A876CC, 0x7E61DAB21DCC1118, 0xD05BBC7F47ACDDAB, 0x00005911CAF4418C,
+0xA0B83F8862341F78, 0x604773E2E3A57F72, 0xF3FBD52044D2962B, 0xDBCA684A91FD79E0,
+0x590138B4612099A1, 0xFBD47C83DBAD0BB7, 0x71873766E86D87EC, 0x45E151B966933698,
+0xB4EF9CC105C3BE4E, 0xDEABA418E71B3628, 0x0733F51CB75CAF69, 0x00000754AB05607B,
+0xB314A28ED0749F9D, 0x69B51D543A99B763, 0x2D66FE5BC63E07C7, 0x062F095B514876F4,
+0xEABEF5BB4CA04557, 0xCDDF02B38F992C44, 0x68878AEAD37D146D, 0x368BA55E03067F85,
+0x11DEA4492502FDC0, 0x9320E0F59CEAB7D4, 0xFE273AF923CE506F, 0x00001F758D72BB15,
+0xD9AD0556B2258A13, 0xCA6C46E199092BDF, 0xDCD52D1E20A527E9, 0xC861972C19A1F75D,
+0x0C32D4579256AFB6, 0x3276B83EDFE42A4D, 0xDC8C016AAB5FB5AB, 0x39C4A32968E0053C,
+0xE6DCF75F50346500, 0x4F55FAAF1D6D50A6, 0x2ED5E12269518AF3, 0x000057C84AF99AD8,
+0x2BB4FF785CA83C04, 0xB6740FA3C6C4E25A, 0x4B2A20B2A5EBF83B, 0xF08EEF2CBDBE1A4D,
+0xF708CF1D91DF8C99, 0x4D9C081EF46A7855, 0xE04FF5D6D9D0B3AF, 0xECC00724340C154F,
+0x33A338869B4A8AA4, 0x8D7D34A44DFB872E, 0xFA7364FA8C8DDE4C, 0x00004C799ECE4BA6,
+0x32F320C107606828, 0x52C00387C0E5B060, 0x9465F652B3797DE0, 0x6E01D0B18D66802A,
+0xE86444C379394402, 0x6FFD61DC38B5D998, 0x9DEF7E59FCDB754F, 0x6F646BE76E582E29,
+0xD58EA4C1C3CB7EBD, 0x11F730AEDA1895B9, 0x021E197498A125E2, 0x00005032B644C0E3,
+0x5F3C8F13AE506258, 0x6C9014093EEA5B45, 0x68B22E5C109CD6A7, 0x16596DBC00E51FAF,
+0x3A1F70A6B3872C27, 0x10ACEB3AF628C06A, 0x0ED62E1BDFAE41E2, 0x3C526547C7C8A9E3,
+0xC0A84FC73D33AE7C, 0x3C0507E460FB7AD1, 0xFB060AFDA95A01E2, 0x00003FBED6DCB7B5,
+0x35EB82C7BC38CB68, 0x66B3A327CCF6B824, 0x1248A1449E280983, 0x9A512572C87E148B,
+0xE1BA28486F21DA92, 0x03BE7B4CE7F5C641, 0x96F17687EBE67D90, 0x169D79A712840382,
+0x1D18C22C59F4BA22, 0xC47349E88A0D1B4F, 0x0EA2FDE97EDE83BB, 0x00005C1DD62EB936,
+0x634A4C9949D0472F, 0x0C002E8AD64368A5, 0x7713357EC42BEE5A, 0x46B3AE3FCF6FB878,
+0x90C5DAB8E9C11D52, 0x4337B705E03F7296, 0x00AF4D6558A1C437, 0x11CBAA217C296779,
+0x2004C1FCE7A2B231, 0x64125F120A18AA06, 0x41D4F1896F26ED8D, 0x00005D4E4435D9E3,
+0xD028A07B2D2506A6, 0x71EED57636DB2ECB, 0x95B7567E4726BC65, 0x11B9464B64F68C59,
+0xACC8C996F7884D19, 0x72D5CCC7F58CB178, 0x0F16435428978523, 0xB81CF3FB0D25509D,
+0x49BE2D5C3ED87B4E, 0xAC7B82A53DFB1A1F, 0xC6780E2D7B54CF10, 0x0000637A36167454,
+0xC602FD631C002576, 0xF2FD0DBC9EB6C386, 0xC89CA3080FE92B10, 0xE93424EF9CB5F3EE,
+0xD5E12B768A4BB16F, 0xA6E9EBCB4DB7A297, 0x2E3EA3B82508133F, 0xE5F73CCDD3427D05,
+0x006891D256830727, 0x341BBAB6CD9890A3, 0x191DEEB0C248DC5D, 0x00006F4E9F244789,
+0xFEE54E3945C1264E, 0xD529CD70D77EB241, 0xB2E5C6465621739B, 0x489B0DA5B4615EE9,
+0xBEB82B6C01957C2C, 0xEDC7321F78D58C79, 0x8AA970A7895FDA8D, 0x5F9FA67B93F5F572,
+0xCD5FA16D7F2AFADD, 0xCF59C0C1C36E5E51, 0x23CFC61BDF9B469A, 0x00000A0B005B5824,
+0x16DD2B85034F5A72, 0xB5E2B9D98B7D7C9B, 0x738C191742E63DD8, 0x9932227EF843F405,
+0xA66DC36B523D7C58, 0x25F25F47C4AAEF33, 0xACE841DAC2EB63A0, 0x80B5DE06FDBC4166,
+0x5A23BAAE36B71443, 0xED35F9F8306E0788, 0xE8ACD7A5072DE01F, 0x00001BAF90AB608A,
+0x7370FCE8B03E50F5, 0x458BCFCEEFBBA423, 0x547C789D06C39757, 0xFA5A13FCD25E6C24,
+0xCAF652C566958CC4, 0x724C60BE23A2BB51, 0x11598EA8F21A068D, 0xDA32E3395D29E7FF,
+0x17B0C45219A37FE8, 0x4E17286726550FA4, 0xFEA01E84D2E11DCE, 0x000067F3B3E62B1E,
+0x429149C531F331D5, 0xD2B33C0717B493E3, 0x702A7C8819E0FB40, 0xB2D05B1EEE9F4B92,
+0xF5B69683595025DB, 0xD16E920D6CA89968, 0x58A0194224342910, 0x6922F7D9FA6A96A9,
+0x49225D9D4B2E6BA1, 0x3A1F8CF0C651D650, 0x62C5BE5580EC2EEE, 0x00001DE2D0A27CE3,
+0xBAB83CC46795F783, 0x92B2A44EA34D9328, 0xDC8F0189E281686D, 0x7EA46FA5059AECEB,
+0x818DB8A7A09F6A90, 0x6DB4A03D8877E013, 0x9FDC931F75FEE7C1, 0x9DF20BCE31C0AB1F,
+0xFF4E1D9DD8F0E6E3, 0x99245855B70C4BBA, 0xC4423F1491A21E18, 0x00002B458D9A1986,
+0x42BC1C47C3294331, 0x0B0719080CBE65B2, 0xEB05ABE936009150, 0xFEB24494DB25F8DF,
+0xF2A80DEFAD133273, 0xE32025C33451FE7C, 0x8D7C0A65EBB693E5, 0xCE7512FBCF3DE4F0,
+0x6AC52B2D3ABE74BB, 0xB0CCB3D2ED351F23, 0x7E5A8CA6B8BA69E0, 0x00002B6DFCF8EFF1,
+0x1A442BE7FB6A6E62, 0x133904CA01DA7BFD, 0xFF4A417D49E4E1D7, 0x899A85F29419615E,
+0xF65FBA458BBF1901, 0x09600F123AA2A189, 0x99130D6C6892E8A3, 0x15BB3F6693F13E72,
+0x33610F5904FAC356, 0xF8E5579D416EF377, 0xDDCCF22A4C11C04E, 0x00000499363115F2,
+0xCEA5D4EB9B8AB408, 0xAF837FF65D1DEBB0, 0x2A7CCE3703DA72E0, 0x3AA12CCE4A8E5197,
+0xB96BFDA62BAA1DB8, 0x580E01313361CF90, 0xCFF77CF5022BDE8F, 0x6C4F2152D8ACC61E,
+0xA6CEA662506E5E3C, 0xED507632928E2411, 0x87C68B6832946672, 0x000016314539AEC9,
+0x05FD2FD2A2E7548F, 0xC53687A466B10BDC, 0x36368DF99305191D, 0x28079217EC0FABA1,
+0x0889B71EF9CC1D91, 0x47E38A18C0F78DAC, 0x9FBE7CA73AB50DEE, 0xDB6FDD069B145E17,
+0x4893E9CEDE899589, 0x5A2EC61B14D5B0B2, 0x7F3CBF02588D31F7, 0x000044C6A8DA2270,
+0x89E186D73BD37B46, 0x614F37EB9890FED3, 0x884EAC1BF602AEBC, 0x0B6B1DC11962EB30,
+0x3D41C92E2CFFE690, 0x7A7FC39E532B62EC, 0x9DC6ECF1B7A1F269, 0xEE30C99E9201CD2E,
+0x2685C3D2A54D6A94, 0x3D11305E2AD23365, 0x5443981B098AD364, 0x00006E636FDBB55B,
+0x3CE01B8BB2107C6E, 0x0F02AA1B776417A0, 0x4D9EED3B7094BD55, 0x77F772960D1F4B60,
+0x780D64329E70D7E2, 0x5326921BB8DB490F, 0x3277B42EC9A4055B, 0xB454CA34BE0E2E81,
+0xD464F8B26F7CD898, 0xFD3E800CFA42ABDF, 0xAAFADA92F534AE25, 0x00003A9709D5B67C,
+0xB835171AEA6BF8B9, 0x78ADC3BB075DD911, 0x325B533C977373DF, 0xBB34C95DB384FAF6,
+0x98A836AC86C766A3, 0xF34DB479497EAAB0, 0xA4DF4226D21860F2, 0x0290765FDA9D1A68,
+0x3FEC34937CA7DC77, 0xB65F4F04F8D63333, 0x88069A43DF74B811, 0x000016A7FD7AAE57,
+0xF762A620DFB4EE20, 0xA96471FAE7681DE7, 0xC7544C465D82344D, 0x9CFAE03FD0F78E0C,
+0xBB0F45EB2EA1BE1D, 0xA40EAA0F137D14C3, 0x545912814EB13ABB, 0xD519D9AD64BE0FB6,
+0x623932A93FD46531, 0xA3F5A13F91204B81, 0x5CBEC808926B5145, 0x00004A2C9A56E8B9,
+0x710BAFE4806CF023, 0xE5C02E4296CEBA92, 0x55DCB9E079A72585, 0x888AEEFE7C62E8FB,
+0xC743B2F770CA2E6C, 0x97A41F155612ABCD, 0x372BD03B142377EA, 0x285517B7350A0177,
+0x8AF38A3B16067CBC, 0xE0F176D67BF8C2E9, 0xADB07152E5244BE1, 0x00005E45B4F4203D,
+0xD74394E12917FBFF, 0x1E36E96356B6E26C, 0x27045DB3BC413B58, 0x57DFF847F4A11287,
+0x9F4E1B038E0608E0, 0x344C6CBE0EF9A4F6, 0x6379B81AF6666437, 0x9D754743F11FD3BE,
+0x6B62A3970F78DF78, 0x436AEDA9C7EA997E, 0xFF5918DAB07736AD, 0x0000545FF0647FBA,
+0x499DFA92764E5376, 0x24BCAFF5209A1F07, 0x27419D98D8DB2D44, 0x60199816112F7D10,
+0x591FCBF5CEE97C54, 0x5D4CE639611479B1, 0x1EAC552021A5E4A2, 0xAE3B9ABEC39530C0,
+0x0ED5AD7CFAA4A3DE, 0x374C380784117B3D, 0xB65BE15C33E6A9EE, 0x0000449ED1FB0665,
+0x62E0284836D75F5D, 0x6CAC2C258F9E630E, 0x0C4F3A8915B90025, 0xF890F63E8CFAE44E,
+0xE162D19EDE3E69E1, 0xA4DC939C5DBD1446, 0x5BE2820A7430F6A5, 0x4B3EDEFC7D63ED78,
+0xD8ADAECB556B94EC, 0x102FFE28083B87FF, 0x9869093705E34E9A, 0x00003290307E9275,
+0xD6A8ACE8FD71035C, 0x20D03D44E5FB6FD9, 0x03F7199501F06BAC, 0xD08AFFD70BAE4DF8,
+0x00AD4F2550F52F30, 0xBF3221D30632F78F, 0x5218B963A1C3CD45, 0xA9D2AA2A621CC6BC,
+0x74EF0D4CB07B6213, 0xDB46FF5AF66215B6, 0xB03149FB7A001D2E, 0x00001052561BB875,
+0x6268BB2E080C6BA6, 0x13A3FE76F5C75B0D, 0x5D11B49D8766FE39, 0x0D982A7FA064F34E,
+0x06EDF971EC099430, 0xB50FAA72B43154D3, 0xE994E386E6C46019, 0xD6963E684F93C449,
+0x6FB32A4923600F39, 0x86AE8E04740872C0, 0xBB7AC7498C6D9875, 0x000068C2F873FEA6,
+0xC564ED568077E92A, 0x11B1ACFAAC42752E, 0x91EDE0FB8BD9FB00, 0xAD6F7E6798535CDA,
+0xAC0708A501BA98E5, 0xC948CE381D748D29, 0x2DB1F03BFDE3F4E7, 0x7770AFA426826A58,
+0x69979BEA149686D5, 0x09C6759876390F08, 0x002903E4D6220DC8, 0x00005C192DCA21C3,
+0xE9BB00C4BA44F7F1, 0x86F1B348433FD41B, 0x1F4A7651F80E51B0, 0xD763D93A274D5952,
+0xB3E3E9902C3F96BB, 0x2E8AF6D4E2ADA69F, 0x523555F100F58632, 0xC99FB17E1CAF7859,
+0x29AB335FA8D8D74E, 0x03355ECDF2E9A3B0, 0x1D9BC5F0B80B4249, 0x0000355D927185B6,
+0x37F89CBA4971A40B, 0xEFC0060A7578944A, 0xE70E96D5647CBEB3, 0x8B9012B8D70BC741,
+0xD3F333F10F46BE5F, 0x8C07C171877FF936, 0x67DC96EAC6013967, 0x3CB1062889258D80,
+0x60449EC4583BED90, 0x8CC9F60B47AA7E03, 0x7487AEA6054F2475, 0x000052489292DD83,
+0x528DEE2BF604AC32, 0xACB9B8595F1735B6, 0x829F4D4C57A2826F, 0x3C6169F5C6ADF400,
+0x6EAD3E884193FD38, 0x8DEF45B7ADFB07AA, 0x76021818CFFFADB3, 0x42D679C0E9709906,
+0x097713E0B6C29A7F, 0xB4258C2963FBB3F5, 0x7842AFA4B3B9714D, 0x000029A53B3FA5C5,
+0xFC2D9880E683D443, 0x275199700CAE23B3, 0x43A4D2B31652EF86, 0x9CB385EB30D1587D,
+0xE488ECD10405BCAA, 0x48F737B68D8CC962, 0x9459F5B828234CC2, 0x01EBD9E1D01CE2AA,
+0xBC6C565A83EAEBD9, 0xFC333E5B0C91F9E7, 0x30D31D8E8587544E, 0x00003036A76ED6E0,
+0xD57F309DA8172654, 0x1185313D2656EA06, 0x00CDE305488F33FB, 0xA2F57FAB22B70A60,
+0x8F8D413CEC4A6F72, 0xE2CEB984062B0F8E, 0x967772FEDF987165, 0xAC104FC791368448,
+0x8309A7B0A967B53E, 0x99CB9B1A8E3127D9, 0x713F5F1DC4EF4069, 0x000001F1F3A55126,
+0x94BBA8F9DC6F8AA0, 0x018192C4CBE598EB, 0x3079F5FD61F7862A, 0x0B45FFD111DB8560,
+0x515F1412339E2E79, 0x1B8A7D0450C1C490, 0x05DD7FB026BA29C6, 0x2B8F43EF26EFB9C6,
+0xC645435C6E40D04F, 0x1F7594F92897EB55, 0xF7E7765BCAC84B2F, 0x00002AC5CFEE0666,
+0x01B7491FB992D69D, 0x3CCD78EEF54AD739, 0xD09493F074629B45, 0x0A55D86E87154F37,
+0xBA19C1FD6A8423E3, 0x730A00F76418926B, 0x5044231603FEB347, 0xCE83EF43D04CC44D,
+0xB48AB005BDAB9937, 0x037778F61E3A7B9F, 0xAB26EC9F060C0FA6, 0x0000408E7287A9D1,
+0x21354BFBC466D61C, 0xEC34FB60EE6FFF73, 0x8F20A86AAEE5D6A3, 0x50DB714D2C4A251F,
+0xF884752F292285F5, 0xF73FE90C89365DB0, 0xBD14657CCA06B9D4, 0x491FB4E013F707AE,
+0xF696D74207D12E46, 0xF69F0360183F643E, 0xAA67473E44CCE9D2, 0x0000468BF09E2871,
+0x55904639E1D92D27, 0x2EA283DCDABF81D6, 0xF1C0164A032E7760, 0x3B523B47EF06CC4F,
+0x7DFE56CB406F3614, 0x911892C8F2B24DF2, 0x589DFDC575B32C3F, 0xAFF3705A8C0979C1,
+0x95C0504CCF98BDEB, 0xAE119E0F48FE9EAD, 0x93026BB21BDFA594, 0x000060FB0A18003F,
+0x6269F811E0BAA21E, 0x9E01E5BC9786F227, 0xD5645B2FFF0A33D6, 0x751CE09A07429722,
+0xED001283CDBE16B5, 0x0C8DAC7883C12CA4, 0x2C1CBEEF59FA7326, 0x50DD85DF6B6A60AA,
+0x93B83D3E06E43989, 0xFEAC4CBED797A946, 0xD1DC3407DBFF8423, 0x000004880D429F21,
+0x2F999E5153589928, 0x1F105E430507BFD3, 0xCB998F91C2DC8B2B, 0xDA1479346015D202,
+0xCEB9F5F21DDD258D, 0x199A01D207A44F11, 0x815511DCAF6D3A9E, 0x39F38CE528D7307F,
+0x5B7FC65E0DABD54A, 0xAE97029BAF76E36F, 0xB1FD8D81A32926CF, 0x000054EAF0A958E0,
+0x7900AECBF028F0FB, 0xC8EED5C9E7CD86F3, 0xA604D659E73BEA4E, 0x06211824C578F2A4,
+0x6C84AC51AB1AB3ED, 0x0B2EFA14060214F4, 0x74ECBACDE5C73CEB, 0xE6BEC372A679346A,
+0x91A30FEECA67D7ED, 0x4605424595326D53, 0x775ED3D34C0553C3, 0x00001728191EA9A2,
+0xE9C6BA0A807B71DC, 0x9F991ACE21EB2B9A, 0xC4F899CE517CFEEE, 0x69AAFECD78EE93BF,
+0xDDA2C962E9F23965, 0xC10AE885CCA21FEF, 0xD451663D902EB847, 0x4FA03FD9E84E1537,
+0xFCA3E4469EE2A8D6, 0x79B0173E3D4624C5, 0xC473E60D5DB2D46C, 0x00003B56E7417A6E,
+0x02F918B6AE26DB1B, 0xE338C227E8C51B61, 0x8B824E68108EC475, 0x6CF6471467768258,
+0xCC4360AD35C90977, 0x0EC16483A85C756E, 0x206610880E348F55, 0x6158F51A220671DA,
+0xBCB6743E3F323518, 0xC89AB78B795E8080, 0xAE5EBC79DE8CB25C, 0x000017FD0A45571A,
+0x8D14B8677C6BF1D5, 0x06AD104C5B88B24A, 0x3CE8AA9E633841EE, 0xA1F6C36EF4DC9120,
+0xC017921C1DA7BCC0, 0x5D3E9A022ACB9B7A, 0x71BF643FA0937F31, 0x230C5F540A15A67E,
+0x2AAE65D257675475, 0xF31E8C2080270857, 0xAA6BA54CF8EDA70B, 0x00004B7DB2DC33B7,
+0x5458C2FCCECD8882, 0xA47760B4F0A37327, 0xCD1E879BD2D4F9F3, 0x5010D867068D98F2,
+0xD62F9F874CED64CE, 0xF0BB423208CBD647, 0xCA830652608D0381, 0xC495D57347F761A3,
+0xDC211C9376F6DE52, 0x7ADB672E71EE9006, 0x99882D7091A07E44, 0x000046D5BDF50140,
+0xF3EEEE6CA3ED1CCA, 0x123B881C797EB3D1, 0x3D58E7E1053CEE14, 0x48060C495CABE2A3,
+0xBC1372670D555A0A, 0x7DE45521A3F651F2, 0x2449B69ADD6DF80A, 0x95F759E8EDF5902B,
+0xAB5E3DEDB4AFAD5F, 0x686EFFD100BE5ABF, 0x8F3344B74984DB8E, 0x00001547B1FA5D78,
+0x797C864CC81285B2, 0x41B7C617B95BA053, 0xC3C0F12FFC9D6438, 0xF728A1DB5AD60373,
+0x9091600489D4DFA8, 0x63A8F11CE9678127, 0x670D3C829EEA3972, 0x05CC4E79F9E94033,
+0x709D74785EB7706F, 0xBADC039F8E7DCB90, 0xC7B4D4F6A87D674D, 0x00006C1BAE3D78E2,
+0x2673EB085B326DD3, 0x846D577BC8BA83D0, 0x2B8BDB8294BE342E, 0xE8C187C1B9ED2E5E,
+0x8F42EC2442C0F5E5, 0x2CCCD94668A6B728, 0x61D9700B04F494B4, 0xF51C84632D6660DA,
+0x1A42E2E53738AA1D, 0x9324619A92FE3D1A, 0x86A51156821DFBAA, 0x000061C49DB53998,
+0x36844A5D650E9628, 0x78FEAA01E453ED64, 0x414FAECD5759BB04, 0x154E1EAFB4E2232A,
+0x66D1DA83D7E57BE4, 0x9129894BF83E70F7, 0x27A94A441F808C9F, 0x0EE0E39308BBA88D,
+0x069A854AA19AC124, 0x3F6D44F243703DF3, 0x0927B0E947C06C32, 0x000059127F22508C,
+0xF36E513F0F134AC5, 0x3AC381F22966C008, 0xAB3B13D575AC117F, 0x177646942A85A685,
+0x7FFDADF697AD908D, 0x1245564A8048C704, 0xEE46B448CF1DF31D, 0xF571484730EB28DB,
+0xC7907074A4AAFDF8, 0x6298DA3FE7A64B51, 0x0A9C760EB5CED8A4, 0x00003C9EA0639712,
+0x83CE0BA3D69B710C, 0x62B02015C0A65CC5, 0x6C65EE52D6ABA79D, 0x2632B6BCE00CF86C,
+0x7B8A5B58056AE0AD, 0x63582E68FDA827F8, 0x74727D6B1474AE3A, 0x234D08BD0EE27839,
+0x79EC9B4C07C1AE54, 0x3654077A127622FA, 0x90E8D66F2B5B7D71, 0x000025A80E0DDD58,
+0x03BD5E27026FB94C, 0xB6715C1484A960F2, 0x07F53CD7FBD3AAC8, 0x158D769BE9F244E3,
+0xE948B4085058AEF4, 0xED00904A6FF9AA93, 0x5B9962A641B08FF4, 0xBA170B7E7DF65D1E,
+0xB2022603767950D0, 0x568C3311C29C7983, 0x087DBFF4B29BA351, 0x00004454EE238F60,
+0x2DC23CE13D086598, 0xEC01CC42C4A5FF63, 0xA67EE129426C2C7E, 0x8C6705B4E48EA0E3,
+0x8164679646613D7D, 0x185ACF4B034502FC, 0x3EFB1C5A487B3531, 0x7586476C03ECEB61,
+0x7E777DFEC68FCF8C, 0x95AFF713D7AA5BAB, 0x8BA14C71246D1C28, 0x000004369F440188,
+0x2F3FB2C43A4DBFC3, 0x67208011595C234D, 0x0C7181679B8E4C74, 0x51E259395B8D33EE,
+0x5DF42EF7882FF8C3, 0xD1933570712C256A, 0x49C151EE6E1E8B87, 0x123DBC3EBB02A525,
+0x0AD2257A9CBF3524, 0xCBA44496E6D62903, 0x4951DC48C851514B, 0x00003549307AF981,
+0xC3922ADEE686CF83, 0x6A3E7B2EA6E1716D, 0xB3D800CCD36BFB19, 0xC2178DBC2AD7E58D,
+0xBB6DF48B00F2A361, 0x22ED5FC9EF6E9193, 0x46211CEDEC30E9AF, 0x8F567416FB7E7F07,
+0xD11DB4BF33F3EF35, 0xC7E26AB0D8C828A1, 0x8BF097CFAF04874E, 0x0000615611BA6895,
+0x2B231EAC5C957FB7, 0x7F2D461F979E5C39, 0xD349B351674A31D8, 0x5827FCBCD6C7FA28,
+0xCE2D32A1F7F69A5B, 0x3A9621AF797CF86A, 0xAC8D3DA3324FC2F6, 0x32FD08DF2C5CC476,
+0x28D3FD46A962C3EA, 0x903432A0F59E11C2, 0x5707539E14D93878, 0x00000EC611829B18,
+0x108820E4F12C55E7, 0x5DEFF161BD1D6E4F, 0xB3F4D012D4F1AE85, 0x3BA293E8B1944D38,
+0xE54C76DBEA9179B9, 0x44D965285F5B794B, 0x3CE2834512D35B16, 0xA793638482DD3992,
+0xE856D51B3A553160, 0xA08E93BA60988E05, 0x1D64B8CC1668C8ED, 0x000061BEDFF34C17,
+0x19A3A3405CF1F8CB, 0x3FBAB67185107CE5, 0x293956613AE0DB47, 0xF008723A37603756,
+0x52ECC22E7997B85D, 0xC7097BB2A53545C4, 0x79F3EC4B888A276C, 0xC6250FA525C634DC,
+0x0FAF4740E7E3A101, 0xE9B3F082877C354D, 0xFCF793D98CC8546B, 0x00002B59F848FFE5,
+0x3BD76EA83669CF01, 0xE323E9C59128E3D6, 0xCCEF7E2A5C59319F, 0xBD5300C141ECB202,
+0x3E89FF5A8CA1E699, 0x06A4FB96BEC9FDD8, 0x46DA41D58943FDE4, 0x841C38FD513686D7,
+0xCDC940B54CB3C2B0, 0xC6F47BE99D813566, 0xE9CFDE4284590D1B, 0x00005C520EB9207E,
+0x6A329A3005CE9A9C, 0xFFD31D2FD2D38353, 0x59831157BF0FFA37, 0x9FA6564905F1170D,
+0x7E3D6D21C3DAEB35, 0x496FDA6DB81FC71C, 0xB1454B3F6D5464E1, 0x1ED46F8404F4BE85,
+0xF6B36CF5EC8A7B11, 0xA4DB7F41004974C2, 0x1F837985F7FB6B44, 0x00000EC600587AAE,
+0x5230EC5D7C0F4B75, 0x71CD8B69C5F0AFF9, 0xDE1F8C6498FCAE21, 0xA39BAC84DE9D92B4,
+0xC73F8F7AD228F6F9, 0xC4E35BF578FDEB48, 0x27D0E26553C88F5D, 0x041478ECB921B3FD,
+0xFDF3EEAA68C2A3C5, 0x499ED70E80B7BD10, 0xC3BC27960486C584, 0x0000157DE48C6172,
+0xB20BFC717BF473DB, 0x50D3BC058A74CB3A, 0x147185C1AA3B5893, 0x5F4BAC4CDDD538A1,
+0x0D1CE9EAC147487F, 0x824DDC022E33B308, 0x9453D07A07DCF145, 0xE714FFA2AC1E332C,
+0x76F485E634CDD3E0, 0xB9D890471B7A755A, 0xEFF355D77C618C3A, 0x00004661692E7FF5,
+0xE651DB98459075EE, 0x8CE73B2D26A96BEE, 0xEDB202497D38CA46, 0xEFDF47A6ED6B9A3E,
+0xE91B79574BE84761, 0x1754E6E965614772, 0xDCB2D0D4858C77CB, 0xC49ECEC713039BAB,
+0xEA8D3DED12A97FAE, 0x0C229DDD048D9286, 0x82EEF6CE39B80845, 0x00006E0138C24AD0,
+0x134FB1CD451BC9F1, 0x745090E9F879562F, 0x8E80C820E3FD9AB2, 0x36B17AA63019A3B7,
+0x4D1600ED416F9671, 0x40AD7C0CC5F5DC86, 0xE6978773FD366AF2, 0xD53455CA2502474B,
+0xCB896F4538638B6E, 0x20EE1E64F1C56F01, 0xD04DFED52187931D, 0x00002813D6232D6B,
+0xE10F5F318F3B91B2, 0x666A0CCCC412789A, 0xE08873111CBD1EBD, 0x1ED044BC0E90C05A,
+0x8AD2A245794EE701, 0xBF1F448042B0DDD2, 0x16927B0B4F38F655, 0xA5233919F1B9C411,
+0x06942B1E09CDB293, 0x150DA89A229436E6, 0xFFF4B5886862F473, 0x000049862DE0E9B5,
+0x078E40EFA8B8AAE3, 0x5C1BA24868872FCE, 0x8D89E4F1DA727DE9, 0x5C59DCDE70AA13F7,
+0xA49DB5EFCE394175, 0x7495D5FF7DD41F3D, 0x1B2BC7706E53CC75, 0x0F807DBD8EC54AA0,
+0xC55E8A864FBAD54D, 0x3FB6317DE4BB2025, 0xCEA6A3441F5D75CD, 0x00000E315D3E6D3A,
+0x85BFB8DBDD54EB89, 0x3D2BB983CB888A80, 0xB3E3B52C533649B8, 0x17FA55EC9C06409A,
+0x35633BBE7DAE86F4, 0xED8EDE100EC54E88, 0x0B2C3A7C42E32390, 0x1563B7C43A5F2C4B,
+0xDF4CA7BAE81EA189, 0x0062CAEDFC665A0D, 0xAE06DB0929DE368E, 0x000004F48E7AA66F,
+0xEEF8AE9C1C9C2B1D, 0x23974DAAFD35DAD0, 0x42F058588A0E2E14, 0x6B54BED540C57D0D,
+0x2C183CE286608E1B, 0x7044A072768F1768, 0xFDB1A90A43F66D9D, 0x844229990E0EAEF0,
+0xD861A3C45644252A, 0xB9DD177F45EB8DB2, 0x6FC739FC5CD34ADE, 0x00001F5FD4B55A09,
+0xEA1BFFBB669468F7, 0xABE57CD0CCDBF114, 0x43AD2BE82C8AC376, 0x064AB3E1E9E633FE,
+0xFCC0227999301251, 0x2A863F66C3EB943A, 0xB905141BB9DB9128, 0x0F9ED9B9DCD46FCB,
+0xECD2D5A7AF32F024, 0xAF6456D187D99EAF, 0xE08E2E0E9B701FA4, 0x00003179040A1D53,
+0xA50FD865FCF13873, 0x85860F6173C534B5, 0x0EEEF4FA1E0E4E58, 0x2C0A6B3343244CDE,
+0xDD7AB936E6BD1F13, 0xBA399D677F7E6E04, 0x67F3743A396426BB, 0x01D10992E1297AA1,
+0xFE0C78F8BDD5FBB1, 0x3E26FBF6AF85DBA3, 0xDA87EEA0F8930DE3, 0x0000344BAB335DF8,
+0x191D6A1AE367259E, 0xCD4BF751E7789837, 0xC36883C3B068AD10, 0x22BDD59D78D2CB79,
+0xBE0F72677AEBF166, 0x537409F074561380, 0x07E3816B65A4911F, 0x478B7B030F55EA97,
+0xF4C97F9456A9D328, 0xE8ED99A20A784094, 0x7EB0CA25286FB86E, 0x0000214117C26373,
+0x5AFC27FD36C10ED8, 0xC3F440CCF2A07616, 0x13774EE463345140, 0x68DF9AA9A4B4B8F2,
+0x5CF5CC04F89BDB84, 0x3E94DB7951E1626D, 0xB2D4F3EE50ACEC73, 0xB01976BD2B7EA471,
+0x3D0F95FF62CEA961, 0x799BCE0C22D94D18, 0xB336AE2CD14A3BAD, 0x00001D5F882E974C,
+0xD3C8A8D8F419229C, 0xF4712D18CF338100, 0xD50A460FB98C32C8, 0x6B8A88F853CED0FE,
+0xD3BFBBECE51CDA4E, 0x465746539A46BEA1, 0x8E90E9EFEBA3A544, 0x872DF9F56544F21C,
+0xB4B1FBC8B2570676, 0x57DF8D2D45DE257B, 0x3FD73E2934B66D4C, 0x00002FE6E5ADC4AE,
+0x43B83151732056BC, 0x74BBC0FF4C8370D5, 0x5C832250490EBBC5, 0xF9DE4C3E87CD40B8,
+0xF4CE1063D6751A49, 0x3FD4403523DA7C14, 0x630E1976704E120A, 0xE7A51914A3CE35EA,
+0xAD84500EBB12310C, 0x8ADD439CC075FB77, 0xCAB1296E93928AE4, 0x00002DEB74FA168F,
+0x8ED39F0637BE2EE0, 0xEDB5B121BF80EB4A, 0xF04A9D3AD2A4403D, 0xFD2A88B39A044778,
+0x792C0F0CEDD3F06F, 0x0F0449EDF24C5355, 0xC69E314299E72325, 0xB69891F159FE1763,
+0xE29B641C76C6ABA6, 0x6F972E291D54D257, 0x1BD1CFF40AF01068, 0x00002EF8629BD661,
+0xE92287200C3A5E20, 0x0830CA33A2FC6E76, 0x2A3D78D3413EFB89, 0x463C6EE3DBC90F68,
+0xCC12F73FBBBD6FCA, 0x2E036731F0D52E12, 0x82399F938E350723, 0xBC23A5EDE50C181E,
+0x820DB17A110B9659, 0x969A4B1F2AB43E39, 0x0EC3F4A672B3D58B, 0x0000409AE335004D,
+0x0343C06FA80FA5B0, 0xBE9AB15515132F20, 0xB2E8B7D3231EE61A, 0xF993D1E2C1F0A623,
+0xDC4BAF0107B46D6F, 0x4F340D0637D1AB40, 0x187C76346AD5D8FF, 0xCDF52EA45A6F0680,
+0xA37FE1F89AAC428B, 0x0CC44CDC79B3D2F2, 0xAB9B1D53B38AA5D4, 0x00005A8AF9F8137C,
+0x62A9497EC0FFF7F4, 0x0B2DB2A74E924AD9, 0x9BB2EF292544C4F7, 0xDE1F5418298D8129,
+0xF9F3B147DA2C7B2D, 0x90855F7451DB77B2, 0x4B159A5D4469F253, 0xD20865CF5C346D52,
+0xE5D588F3A8B288D3, 0xA02427ED5272787D, 0xE2F62E95ED2AF5A4, 0x000004C624EB7DB7,
+0xB16640C0B4F84F74, 0x45ED2D713C06FBB3, 0xF83C0615ACC91D00, 0x3B15B2D1579B7FA9,
+0xBCCB23288AE218C1, 0x42FB8E20EDAE9AB3, 0x784CD57F739529DA, 0x4951E4FC05221D61,
+0xDF951D0D548BCB25, 0x9ACC8B3F38CE0854, 0x73936C8B87C3E8E7, 0x00000335C692CFF3,
+0x611424FBAED8A3D1, 0x8D0992C02210BB29, 0x22AF9D1123E7D310, 0xE126D29C3D390519,
+0x1371CFABAAA41469, 0xF281EA25127B3204, 0xE48D721EA1DDB342, 0x8CDBCB0D5FC44E61,
+0x2D158D9374E7A8AF, 0x49C43343F47C8BF3, 0x18E6E556D6071796, 0x00004518435A4A3F,
+0xC4064AD7CB8B99FA, 0x9FBBF7F602E32709, 0x09CC8454724024F0, 0x2EF6EB765125D615,
+0x765BF691576E6819, 0xB524C9E56EA1AE52, 0x2B99D20B87B2B252, 0x322FF05FDEC24AF4,
+0xF05DE34808B94421, 0x2C8A9D7AC368512C, 0xDEDB38219F6450F9, 0x000037497491645C,
+0x867D290E1FC4B625, 0xB9EDC34EE6A28858, 0x5B9044C83DA19A93, 0xFF82A23FBA7CF072,
+0xE50A30FC678BAF34, 0x0516CB583C10308E, 0xCEDB296CE18D5372, 0xBCEC5CC87ABF6039,
+0x2C99396D96C67E17, 0x3AC4D1A81DC43548, 0xC48BA3A25C511F7E, 0x00004DD104C9C5BC,
+0xB46F9B90FD9E0B72, 0xB9299D30224D69B8, 0x9FB62C1A7F64EF86, 0xC3F7D0D25021C5DD,
+0x3A2FD29258BC9B6B, 0x8A14BF0543A66E5F, 0xFAFD25245A3CB9B8, 0x95CEA861F6E8F4FB,
+0xF46D8DE1F0350267, 0xAF09ADF06BFD3CDB, 0x6DE6207FB1D57F0B, 0x000006DB5482C4D8,
+0x69865945CB7696FA, 0xEFC8D4667553538C, 0x69DE9623F0BED689, 0x5DCE8DE34AF3BA58,
+0x25956DBF9069C181, 0x899CE7FFFA806951, 0xB21BEC4646E2E46C, 0x34B1F5944C727FF2,
+0x377ED38963DA2F2E, 0x41DFFDE4C7162464, 0x2984C6585F1CF3EB, 0x000019DE9A64AAF4,
+0xC553BF43C03E00F6, 0x318520A7D4228545, 0x6349A3F94E262DEC, 0xB3EEEE35B9CD7172,
+0xCB3989D7EE32B791, 0x5EB08F802CAFCF77, 0x9B04F57EC4C7A814, 0x4508B2DBE9177CB2,
+0x115F5AF9687754D1, 0x5A42AF71A54C129D, 0x1845DF7748211847, 0x0000692108F61282,
+0x14782C5E279A9967, 0xDCA3523E92E9731A, 0xA76ACE413CFC5E39, 0x2C7018CCB11F9835,
+0x23556CAAD928931A, 0xA9718C86717FA93C, 0x8A1047E13C4698C0, 0x0C40738127A53411,
+0x12699E104E59EF82, 0x33CEBC4270F39C44, 0x3FF330766F34DB08, 0x00003522131A162E,
+0x461D824C873EC99A, 0x50E567570C36D5E9, 0x2196A8AD7DBDEC69, 0x2BF8F4341AC96A64,
+0xD015F9A90021A3AE, 0x3FA55528E94C0E13, 0x5596E93189F72C04, 0x0B4D01A1A63760F6,
+0x27A5A7AA008E921D, 0x3BDCFEE80465601E, 0xD539831DD67C41ED, 0x00003C74BA605324,
+0xB689841E4122402C, 0x1E0357949CE75D01, 0x3A46D2FFC56F0740, 0x0D75F406EE0BAD78,
+0x5C9219C1D44CD303, 0xC59D00ADA68E2F3E, 0x1059F3C205C69084, 0x137756F092C82F86,
+0x7B1AF5CCFC0B0C8A, 0x1046501843BFA88D, 0x5C1962A6166574E5, 0x00005C25FB807696,
+0x580E8F42A40511BB, 0x344CA2CBBB4CEB83, 0x057D70C39055A548, 0x8963959650869E57,
+0xCAA5AB57FE60AC05, 0x5AB4EB730A500497, 0x67DDCD1E80666ADE, 0x02D5CD64866B5E07,
+0x553492C5CA5E954E, 0x4E7C755F946039C9, 0x8717074B76DB9413, 0x0000323BF88F6E77,
+0x2D17C022E923B037, 0x51FB48953FFA5476, 0xA4E89E2074B39CC8, 0x9FAF75784A5EFABB,
+0x024F64C286DB6D46, 0xC1E926F27F4E4F88, 0xB437B006FDDEB409, 0x6E3A86D350BEB185,
+0x49625D1967E64823, 0x1EE141B3239F325E, 0x61891F20CF10F421, 0x00000B171060B100,
+0xCB026B3969C1301A, 0x864BE1748B816025, 0x4EF8057298690BD5, 0x8AB774D183A5DBC2,
+0xFEB55F97A7D50728, 0xBC6A102EEF7720F8, 0x6C4DBED3CBA79D03, 0xDC89596387E86D2E,
+0x04CB035F841EB2E5, 0x8EB610D1293C9CAB, 0x35A98626BBE37D65, 0x0000359895E7872F,
+0xB9E7E605A7A8EFE0, 0x0F244FBF151E56DA, 0x64E13B3BB2DC2402, 0x07A17F02A9BFC31E,
+0x42EC4A57BA0A9FA1, 0x73411F1BFFC819BA, 0x1FB218EF52909546, 0x0DE3A95713372D1F,
+0x7A70D9EE055822F0, 0x8CA2221F8D158299, 0xE101D742ABA5C49F, 0x0000207E9B8C29AE,
+0x71AC4844CEF271F3, 0x3574E9E57D1E698B, 0x9EBBB3CAEFC2DAC8, 0x5FBB665BC10A1B4B,
+0xB32B63FBCE74C2A7, 0x7C478AFC6F987BD6, 0x1AF191E721CC053F, 0x4BA3A7A83901AF31,
+0x1BF4A417478FD44E, 0xC8D3F5560BE3970D, 0x4127987F41C6C575, 0x00003CDFAAFE2F73,
+0x9AE4FBAE29E0C30D, 0x468B448888C53B62, 0x40BB1E050D328FC6, 0x5BEF4E5416DC3286,
+0xF72F30F48F40642C, 0xB0ECE4364DF3A2BA, 0x057564CDF11386B2, 0x4A858C283C52E174,
+0xAA58AE6A4986F135, 0xF73DDC1749D35BEA, 0xE5A57788976658D1, 0x00005C4D15D9918F,
+0x3A02370072E42C73, 0x2AB04870D709CE5D, 0x552543CACF9FA652, 0x24254B8E7F07E0CC,
+0xDEA651B497B55538, 0x76F7AEBD69810364, 0xFFCDD8F187785BB4, 0x4FC095F200F5FE3A,
+0x0D2B2F007321460D, 0xD50A69373E762192, 0xACCC8DEF45848E5E, 0x00000595296F95D9,
+0xA7585C81F0862899, 0xACA0715CF8CDCCA4, 0x83844D4649AB21F4, 0x93F9221179804C89,
+0x1E95A283206CC1DD, 0xFE1623BF677E514D, 0x13BDE067D1DB6CBE, 0x0227B96823CE2474,
+0x8973CEAF486498FB, 0x92A4B3DD7353F5A3, 0xE73E38ACD0C9470A, 0x000008AE6A178CB6,
+0xF1BC19467351D701, 0x831C707AC2446ED3, 0x3E8F8C97EDCD9C2E, 0x9C57A39A74CAA4DB,
+0xCC132FCF5843BA4B, 0xDFD12ACC1947AF5D, 0xC2D64636DFFCC34B, 0x01F91DB1B73C91E1,
+0x1CBCDD3F7B9CA247, 0xC36AB2231A3DB43F, 0xBF28ED872929D8C9, 0x00001B9E3BDA7D5C,
+0xCD06B9F22D1D9FFD, 0x1389F87B490F4DB5, 0xEFF14D36FBCF40B5, 0xDA5452D5E950BAB1,
+0x96471E68F4F4AF91, 0x5E40521203A289AE, 0xF0B98AB115260E8A, 0xC7FA365C1A014F30,
+0x1E9CC01DF6A4A9F7, 0x164EDA2FA6F34092, 0x663CFAFED1E68B72, 0x00000174AA593E8B,
+0xB1499DFFEA2718E9, 0x15A5D3328578147F, 0xD3245D1BF543EA71, 0x3744207411DB66C4,
+0x3D1CA8011969D5CA, 0xAA6EF2F57358E964, 0x4A469C18B69FEC28, 0xA9F6FD54C0B40A2D,
+0xD9ADB34281BB67A1, 0x02FCE04060EDDF5B, 0xAABDD34E74D6AF4C, 0x00000FEF1AB18CD2,
+0x3946F84E9A610526, 0x00D2E8F08F240B7E, 0xC37E447AFCE86499, 0x1D957243A40334A1,
+0xCC3365DE34536632, 0x9CA684EF598DE9B9, 0x09122441D933C698, 0x90321D795CD9BA44,
+0xA501B1EBDB850F56, 0x4F11D49537A98E04, 0xE322C97E95A5C9AE, 0x00006AA5711EDFE6,
+0x16220AAD5FEC4022, 0x60ED37E5013A0DB8, 0xE2E54D40A5EC2E9C, 0xE954F90B842766E8,
+0x6DF2DFB43285D994, 0xBA2F902633186F8E, 0xD31980238D0EED6D, 0x793A4BBF6BFE76CD,
+0x16860943D8531858, 0xED11210CE8C5BDDD, 0x5899E47C8B60E489, 0x000001D206463F35,
+0x7A6A145356194859, 0xF87DD735FF47441C, 0x8B55024AAFF18BEA, 0xE76A4F6CDABA546A,
+0x49F289174690B200, 0x385136D11A137923, 0x1AF483BD23B58E20, 0x8AF549BF76FD3F0C,
+0x66BCDFD668C3E737, 0xA2AD7E34204F3245, 0x62F380D46FAA9364, 0x00002187149ED686,
+0xEB6B1846F5FADD61, 0xCF820A4E09102106, 0x0D27E034EC88AF33, 0x0F816524FA60A049,
+0x6DFF60591ABEDD03, 0x2A42214130643FB2, 0x1E654B8F2A72828D, 0x91080EA0466A22A9,
+0x08CEC041508E5861, 0xAB708E17673E75C5, 0x3232FB2BC17C9CBA, 0x00004A93C2F38E0D,
+0xAE3B88829EE1A178, 0x631B667D1B388D3B, 0x9E0FA96989EB56AC, 0xFFFEA772CBA2F210,
+0x4B1749518AE6B0DF, 0xD0F94EE5F13528BB, 0x5F08FEFB4520303E, 0x837270E69A605E35,
+0xAE1F27251C79E11D, 0x1D465F4BEE7A9698, 0x7315AEBD72AB8401, 0x00003FD2F943895E,
+0x637BD91A80F5E53F, 0xE6A04558BE50AB8C, 0xE693E4238BCF77EE, 0xAD521800F0B0451C,
+0x0BDE2CC6B3688130, 0x166E456096BDC29E, 0xC4FC19C917A691F4, 0xFC8F1A451225202D,
+0xBF438C02643F622F, 0x5EFF9703C108029F, 0xB0A7B91C98911CA6, 0x00000AE715643937,
+0x08BF00D6FCCEE454, 0x04687BB9D7D921FB, 0xBC328A8D1CFC424F, 0x3A1EA3FF244B803D,
+0x12B320C18F89C896, 0x12ED635CB3A57EF8, 0x8439404E2B002DB8, 0x8D135917CCA0C99A,
+0xEBB6D2D63634989D, 0x7217B64A8F4C3112, 0x36533C551BBFDCE4, 0x00002E595A6791E1,
+0x1253A3AD36C987D8, 0x3A5A3F33EAA053D0, 0xEC7D530375C063F0, 0x33D3341CC7AC77A4,
+0x44D58CE45218A166, 0x512E3DFBB032B274, 0xC313BF7597882881, 0x0E82E23B804A5E81,
+0xF2D469B9EC888C5B, 0x88C35689DEDCD96B, 0xD847C507A2EE1CC0, 0x000035CEC5F7B431,
+0x94239554CC6A6E01, 0xA545614A97A2ED17, 0xA82876665908418D, 0x92841528DAA40A55,
+0x01FEE5AC2940AFDE, 0xEC1A39A99FA6F4A1, 0x66020AA731C57B56, 0x6A8D8095F27EBCE8,
+0x9C4B587DE31D40FC, 0xEEF81DBA92D677D5, 0xDE9AE742C78D2F79, 0x00004A412A51B895,
+0xF2A971BFA17013F8, 0x2FE12819F48DE450, 0x098AE42313307EDE, 0x12E207D4B4317D58,
+0x6A8BB2DE00C003A1, 0x4C1EB291BE896D43, 0x9C38151AA2FCEBA9, 0xEA44DDFDF915CD88,
+0x041D876DC936B953, 0x2268EF57E1C7087D, 0xC338B22103D64EEE, 0x0000267E299C0BCE,
+0x152007FDB1851693, 0x27A7D07510C069D2, 0xF3E4CFA9CA642ADD, 0x0E59B1F58A8B91A0,
+0x79DC6B8B51135FF6, 0x41EEC6EDCCF0F0DD, 0x4B2F32F93210E6F6, 0xDF32838EE225D334,
+0x114926AFEE795355, 0x4975A57F0670148B, 0x80CB226F553C5DF5, 0x00003E88E62F46FE,
+0x175E1F7E4283BB39, 0x2C767DE06BCEDE29, 0x53A67C1551760292, 0xD49952936C4E11F0,
+0xB44AE53E99F40975, 0xB1038020D470AB24, 0xECB3DD9002022A99, 0x261C8AE035443350,
+0xF1F727BD8A752420, 0xDBD83FF264E8D1E3, 0x46CEBCDB806E2291, 0x000044DD175825E8,
+0x59E2469E2D2478FE, 0x71D93EC41F3A4590, 0x8362114DCCE2D771, 0xA944F72AA204A0D6,
+0x743CB2BA98F7E3EC, 0xA5A4F434271A747C, 0xEF6C60E0C8223446, 0x519B1E8ABDC10C47,
+0xEF30EBD7720B5964, 0x26468C6532BBB663, 0x85D78C0ED2799900, 0x0000018E08DBA553,
+0x6C1668AD7ED00771, 0xF81C858BF0EFA2ED, 0xB86079011EDAF839, 0xD456EE7D472F4DC0,
+0xDE3070CA25CCC84A, 0x42B58FD3B22CF73D, 0xC6A3925162EDCF0B, 0x9AFB097356C517E6,
+0xDCA6F57D4EBA5780, 0xD33FED30AE3B9396, 0xBCA0F9320D447E9B, 0x00002F2441A14AD0,
+0xD7D4C52B53293D66, 0xC926D254DFAB8296, 0x1AFFCE3CE395CCEC, 0x05DB3A243B98DF09,
+0x823DFA32E15D396B, 0xF8B8709F74BADFB2, 0x27E4DEBF651858D5, 0x106348570B46DA72,
+0x35F9C600887816CA, 0xD84E648F726FFC04, 0xCC0DBFA188B779FB, 0x00001B21D0FADAE0,
+0x6AD0546911E9968E, 0x3C549EC4C039C02E, 0x468FFBD3487E09F1, 0xE8421F236CC3BED7,
+0xE906A971C80ABE4C, 0x142420AFBAE54DD4, 0x7D6BCDE8982893B3, 0xA3D7A5178CA228C7,
+0x7DE06850D1F6F809, 0xF80B29A2E2175549, 0x8B72A091BA4F6919, 0x0000364D5246D66B,
+0x747BE6AF64D321BA, 0xA571CAFE66842180, 0xA1DFED84C491C5EF, 0x17A315CC684139B6,
+0x233D6891CCCAFB67, 0xD124C618D235C87D, 0x80B531964BF6DDDE, 0x9E38B5B4122C3308,
+0x900244EA21D96D0E, 0xBAEF75F51769F9A0, 0xC49170281FC4C27B, 0x0000501605A36EAC,
+0xAC45EAAFA446F456, 0xF1924FF31D17EC8C, 0x791A0E949C049B96, 0x98703950A6FBD3A7,
+0x80315BF35024E2B8, 0xF32435F83B95ACBD, 0x35E2D594B00B43F3, 0x22DD0552146B7AE8,
+0x8500440FB92C9510, 0xBA56134D1D84A29A, 0x8D906EAD243CBC0C, 0x00005C649AAA439F,
+0x2712B923FBD9FD49, 0xB5D3C804C27B734D, 0x107980AE1751CCEB, 0xB9A3E441AF6CC7F3,
+0x7135D65962F2ECC7, 0xBF627A64405C26BF, 0xB85EE606137D7E78, 0x74087DDF57A48A03,
+0xA4FAABB8C8E0E7DD, 0xBB53CF34CAFEA343, 0xE1375456E9216A0A, 0x000046D237554AB9,
+0x4AD4267C3CA4E691, 0x1A8B89040706CC35, 0x3DD407ABDB7DD049, 0x25BAC34DEE00EFCC,
+0xF52D7C64327168DB, 0x96097E3A75FC97B8, 0x64A0B111B4B13474, 0x37EE17E6111FF793,
+0x27AEEA5B37D9B493, 0xFF0483AD3628BD87, 0x4B11D6BD04E5BC6E, 0x000005F1C68A78A4,
+0x97F977210034BA6F, 0x74DC3EBD864A986B, 0xF4498119C7C179FC, 0x5CBB2F632876AD0E,
+0x499CC977171062BB, 0x0802053CFFACE2D1, 0x9631D6DB8DA00964, 0x319226BDC6A4626D,
+0x8C31DA2470BE9B9F, 0xC312ED6728C66B52, 0x33832C999A4BBAD8, 0x000049746094D04C,
+0xFBFE4CC54D73599C, 0xE3321898AF6032B4, 0x17C2047FBF8FD6C0, 0xE132BA9AE7C663D9,
+0x741D5884F6107C89, 0xE181BF01389CA137, 0x958B0D0A6EE934CA, 0x85101B0EF9762DD0,
+0x4E18ECE2E9B6CBB7, 0xB63D95A488F5C40D, 0x2E5FA894BB85097D, 0x000045F586A0C3D4,
+0x341F584887E478DD, 0x830EBB433BBAC7CA, 0xB145AA7044CB0F63, 0x58BA5E54EE6F57B8,
+0x0BCE88E0FBC34E11, 0x1AC7B0CDBD498A7B, 0x58233F69CCCBA19D, 0xEA038F02A6CAEE4B,
+0x8D8DED3612717D41, 0x1785D3E2F595002A, 0x36307C376F743FDF, 0x000047F19C499776,
+0x17DC619FECD78ECD, 0xC943921B580AFD85, 0xE101343FD8E7D017, 0x68040F7592ADBE09,
+0x23E6BB9FC07CD7C7, 0xFB265B45675FF809, 0x5CBBE31476E52AF8, 0x79F419C719BC3EB5,
+0xA214932296672FAF, 0x4C39B777D29998E4, 0xF0E9E65EAFB78685, 0x000061282A234570,
+0xDF4F31208FD444F4, 0x924B077DC8781521, 0x0A21A5C8CD3ACE5D, 0x3A05D73D527EC2AA,
+0x53342012CADB55E9, 0x4C93F435420A7E86, 0x3B3023EF980B9FAE, 0xE3398FDAE93062CC,
+0xDA53723CBC191560, 0xF83B5707ADA18578, 0x9531F2338C7FD4BC, 0x000051ADFF26B50B,
+0x96AF00D8E68C207F, 0xC40519BA771C6672, 0x6F7FFE09F8415CD9, 0x879775D8DD158CA3,
+0x51C32EEE835B2273, 0xCC2C3B0189D868BE, 0x5C7D83A812DD7EF5, 0x3C0C2764CA333F03,
+0xB3FAA315F66CA15E, 0x37D9C56B932F3C48, 0x5B52D1247E566FB8, 0x000002DA640CA46D,
+0xAB1D5FAF33D9C963, 0xA9CC8A698F8523A3, 0xD0F285EC478601AC, 0x95729AE7B6144DA4,
+0x4FFDF604F54CBECA, 0xA2E054AB1E6190E8, 0x77DE7289D2B40D73, 0x5D863E1F7D0B6C22,
+0x2C16A35ECF9922B5, 0x9269DD5FF3E3A4AE, 0x04C15435CF402FB6, 0x000048BC1DB243D0,
+0xC299751F867E0BE1, 0xF20A084D65E58133, 0x48CF409AF91DF60D, 0x9841EC0FA7BA63C3,
+0x8AE19A415C4B0AC5, 0xD09C6564242F69CC, 0xD82FB507D8B92A42, 0xE0D28810E774F27E,
+0xCB3E2482696FDD13, 0x9374101E2BF14E3D, 0x0068FFBAAD4FA4D9, 0x000013B77532B660,
+0x69DD9066649AD26B, 0x005C149FD6582AFE, 0xA59AD5BADA89BE25, 0x98681D9AFF97DB75,
+0x01DBBB9ED6B0DC80, 0xB25E5F2E81E7CED4, 0x794F147602420058, 0xFB6B140C11760633,
+0xD204502DB209F76F, 0xD2D849C2AD89928A, 0xF1F8BACF041916B2, 0x000027401C4BB8DE,
+0xF538983C1C0CE7DE, 0x3E736EB795D60387, 0x01A0DC683455499D, 0xB034216C834576ED,
+0x2BF2DEEB2E81BDD6, 0x8DD57E974DDFB4C1, 0x9A60F90E557009FD, 0x169EA3BF8B825B14,
+0x46C271461561E806, 0x1ACEE32E2B181C2D, 0xCF9F36C7792886EE, 0x00003641681F6B2A,
+0x929E39E7F95798EC, 0x177C2FEF3DEFBF61, 0x63B6C57FE6FD2876, 0x152D67C84F49076A,
+0x3864E165AEA7FF17, 0x934D6C447E4137C8, 0x7DD3CE352427C16B, 0x0D895530696D46C4,
+0x29ACD7B60EBF54FA, 0x7F90147A4D974F3F, 0x916CFEA38D299E6C, 0x0000114C2F3C1DFF,
+0xEA495941CFB8B6AC, 0xDAB6E126B45BD99E, 0x591A6CAF2CBB752F, 0xE82E495FD43D318B,
+0x690B93A78784E4E5, 0x3118C4F4B72172D9, 0xBD5A09AFD2BEC31D, 0x80BD7145D467A25A,
+0x116CDA0636B2C69C, 0x6F87C0DF3CB9C3F8, 0x88A76B7E0B790B96, 0x000037E2D25D5CB5,
+0x357A42A74279B088, 0xCD5E623C9401D738, 0x2E7DD74CD766E39C, 0xB3629CEB98DA3C38,
+0x490E84D56ED7A736, 0x3DC0C83052C793C3, 0x529267FF1A020E3F, 0xDB64B73956F1D808,
+0xA7591FB12D883B04, 0x61D69DA89A68CCFA, 0xB07BCDCF8781AAB2, 0x000034EB20121E5C,
+0xBBC16E840CD666D0, 0xB655EE5DAFF5B487, 0x316EEC071C2996EB, 0x6F4F9EE0F8B82780,
+0xE94016AF6257EBEE, 0x81E7D578A80FDE7C, 0xC4B1FF41A8FDD591, 0xAE2BCA657C7855F9,
+0xF5CC2BDE99E3FF0F, 0x0EDDCA1DB9ACC179, 0x816A26E5E95CB345, 0x000053886A39F6F5,
+0x464EE26A553F1BA8, 0x462F6A6844F67205, 0x9B266ECDD522F397, 0x487D083D434B51DF,
+0x72935EA958424381, 0x60CE844F153F205A, 0xB6FA07A5FEB7A82E, 0x18F876876F0F6F71,
+0x2CE9F12F87975D4D, 0x24D4CF26582047BF, 0x55BCCAE4342A4C8E, 0x000050A50AC327B0,
+0x27B6AF63A08DB3FE, 0xBB0A8A04E619B2E5, 0x171F338ED6A34574, 0xA0D5A307122286C8,
+0xA1C1C6344E986D9B, 0xE98DD17301D64180, 0x97B4FDE6536FFAF0, 0x525E02B4CED7ECF1,
+0x59AF460051D1DFB6, 0x4E1B83746E671EEA, 0x6FDAD01A6571A3FD, 0x0000008D72AC2974,
+0xC93A06547D714F93, 0x8D964AE47DD26AA0, 0x5CADE7B4EDBDA74C, 0xECB972F32732DEE8,
+0xF6BFE0A2A9529EA1, 0x1FE24722945AEF49, 0x314096109D8DA983, 0x5B63950FB1215FDC,
+0xF5D20F388FD640F4, 0xFD2181DAD3B3AD38, 0x34C8AE65A80F3F78, 0x00005633510847DE,
+0xD411D490A80F68A2, 0x53EEB967DB687A21, 0xFD3C83E1DFB572AB, 0x4DF7B8A367C5F1BE,
+0x003196B6A488E2E9, 0x047069E45567F182, 0x62A7A2AC8A17C657, 0x91C7ACB7B75422FD,
+0x1E000AE0CE3D6516, 0xB98BE253FEBF0B18, 0xFFF171CC58C5F859, 0x00006056682E346D,
+0x48E473EBA6CBBBF2, 0x97EB6158FCD424B7, 0xFE0CCBEAAAF2B0CC, 0x02C9B372F500DF53,
+0xC07BF3ED2405C8A4, 0xA1B8D83F922DD418, 0x164499FBA30D6465, 0xB8F10467FD0187C4,
+0x670D70B2925E102F, 0x299944B7C83757BF, 0x11D79636F5B9834E, 0x000040FB68161C30,
+0x174C1FA6D3EEF13F, 0xA449C1D89784CE2D, 0x3CD1469785E4A701, 0xAE19B2E07080875F,
+0x4516F6AB00ED5B69, 0xC411E8E8E2A7F52D, 0x356C7E86CCF6D4DB, 0x54CDD6534958BEF9,
+0x7025DB365AF73F80, 0x23C1DD4A222C44C1, 0x8EB9F557733DA0F1, 0x00002DCD3807363F,
+0xA94DAF101F42F23B, 0x5EDC013316446EAC, 0xD2D266996B9CB403, 0xD18DE402821C53FA,
+0x3162FAA3EA588B58, 0x557297484E1BBE76, 0xFD8BE47A20EAD123, 0x5CCBD23438B97D88,
+0xB767D295C800A343, 0xD8F43D6DF80286EF, 0xB5CD95211CB40169, 0x0000502A75799ACA,
+0x1BCBDA2A01B207A7, 0x8C4B1FD27EAE7775, 0x9F83D318E58F6935, 0x29D487C522ADD084,
+0x6FEB4500A69C9AD4, 0xEBD7E8B1050465AA, 0xB12EC929E25C6D4A, 0x5999E72ED99D58E7,
+0x089BF40042B1F5CD, 0xA1AE4D90D1AC1747, 0x59D9164F0C3AC49A, 0x000032BDCC15CC04,
+0x499F75E267D125D1, 0xCED94F46912FE8FB, 0xF788A5EBC03ABA10, 0xD478B693E376EDF2,
+0x82B960F12A4A339B, 0xF733342375F8F26A, 0x33A28FB30577A20A, 0x88AEB137DACC9089,
+0x311F12F67E923E87, 0x0BBCF1D906B867C0, 0x33D0252A6D8FB8FF, 0x00000E32DE33D571,
+0x92A531EC5F077E80, 0x7CC77E14256D29FC, 0xCAE6308B2A49B221, 0x9748A5B5AC63DD5A,
+0xE830E96463A97993, 0x548EB3CA5BD23253, 0x5B49C43284A7A7C8, 0x26C0F77132CB107D,
+0x207CEC6904018F9C, 0x985AE96BC50ED6B3, 0x2BC49A98D8914045, 0x000004B1DFE1B276,
+0xD9FC54FCA2A36965, 0x34BD8AD37795AFEC, 0x272FE24FD8518A3C, 0xF2A579C815412870,
+0x0D6D8F553A64E425, 0x8A7678B410433FCD, 0x4383D0C3DE568885, 0x629E0E3DAC2D1C36,
+0x64D4C495661C4737, 0xC162EF55110AC339, 0xC4F0C92253D9B9ED, 0x0000678EC9E6FDE5,
+0xA1FE0813D1CCA295, 0x74CDD68BD75FF050, 0x045BF832AB63A300, 0xEDD610338D421FE9,
+0x73C1E982106AB9D8, 0xA71F2A1C53C1AE01, 0xDE7CD7210AE76F2F, 0x1325F12253F42767,
+0x8B2266F7259398F9, 0xD5F69E7E181ADEA3, 0xBAA04178D622A256, 0x000065093BCD8975,
+0x22B5E7DC67A80696, 0xD3E8E3B91A68EBD3, 0x6D12AD36425A3813, 0x236928E05BC8C54B,
+0xA0460F28809958D2, 0x1A8004E4E0089D1F, 0x207653FF2C44474B, 0x7405C4CCAA337218,
+0x5AB368038E4425F1, 0x5BAAE6CF041E6AA1, 0x90FC7475702C8E8D, 0x00001275757C3720,
+0x9CBC05B9C2E8326E, 0xCE7888018C21AAC8, 0x549716894A33E9FA, 0xDA88751C165DD739,
+0xA39660EEEB7EC791, 0xB11C923A41C2C83A, 0xD01F08982751FA3B, 0xF1F234F9983B9A74,
+0xB28D52B0CFE4E6C3, 0x2C7185CF9F539192, 0x30FC3EC81657B71E, 0x00004AA0454C7C5A,
+0xA0DBFF7F4C4DC0C1, 0x8C333CA5ABBCD62F, 0xCA99ED462B6B3C19, 0x6D7E836800FA920B,
+0x3F9455D21393170D, 0xF55532B2A28D057F, 0xCFADBE0D34CDD1C5, 0x6A57C2DB2EAEF02F,
+0x033B6EA070653335, 0xFFA28D3DFAF0D093, 0xCE59A33D7750356C, 0x00006E3055F7D621,
+0x8230E35563149E21, 0xA3D8933AA451E19B, 0x5BDB4C42C6DFFD7E, 0x520823EEC31B139C,
+0x04D893DF4CF7010B, 0x11C0EBF16270EBC5, 0xDF54FB9C0063ADDE, 0xEF9A71A72FD4E948,
+0xAF42CAC112A324AC, 0x6585140763A696F4, 0xD1C3E2A9F306FEEA, 0x000036880EC5E07E,
+0xA88E8428762B906C, 0x61CC672C418B3764, 0xC492D8789A40103F, 0x00887FAEEB0695BE,
+0xBE466457AABE59D9, 0xE3C1D6DF99AA8F08, 0x80B23E951F1169FD, 0xF7BC1AF761DB5C7C,
+0x64151981CBC32DE9, 0x8ACDA4A4535B2CC2, 0x2369E8362035A138, 0x00005A5ADF2251AC,
+0xADC802571243FA38, 0x04A06C52887D1D10, 0x6D84E6F22B9FE63E, 0x6B574BFA608B34A1,
+0xE7F62CABC1C7C859, 0xF84604106149B2E4, 0x9A79638EA0E4825E, 0x6E63C21EEB864701,
+0x887EBAB1736A7799, 0xF54DAF7C6395315C, 0xC87B48D16F43C1D5, 0x00003C6CA0E9C8F2,
+0x430900F5B4D0842E, 0xD34EC87D8A357016, 0x200B496A007B28E4, 0x92CF0C114AD0E7A7,
+0xBC86002A76FFB357, 0xD87B02A28F5A3FB5, 0x6013A0C097A86730, 0xD6173A8C9C75BE0A,
+0xCE6CF2127D833630, 0xE1FBB5173E1E15C8, 0x016BDC0509A109C6, 0x0000311AD05E43DF,
+0x2E3001DF1226B0CA, 0xE3870CC8AFBA1EE7, 0x11B4684C6E6C9C1A, 0x66C4A9ABDF3BDCDB,
+0x4340C0B8C5176DB1, 0x313B9BDC367D839F, 0x2AF5AD4A7AEC9026, 0x2654B107CF8FE949,
+0x5028CE8BA4451398, 0xAFB640A4DC2C1AEC, 0x1A92C80A429CB085, 0x0000532B98911DB3,
+0x8F29DB312B31E7C2, 0x2ED118222514BB09, 0xECE530786DD6DA29, 0x20E3FA36E9B7713A,
+0x4A315B97551EEE29, 0x72781E76A987014F, 0xD9EA52EDB4A7CE6C, 0xD4957A85C1E42AD1,
+0x38D211BF0BBF56FA, 0x3D46DEA8B3E4273B, 0x9ABE2C32911862ED, 0x0000414E4444E64B,
+0xB3550F676A1B026B, 0x94F067DB9EE3EA0D, 0x0E50F8F57687CD8D, 0x4DC5C360F32A011A,
+0xC23841C3BD90E82B, 0x0E240F5EC54C6B89, 0xA7B7D0C019D9CFD3, 0x13CA352D26528B9E,
+0x6D7D6DA89FE36973, 0x269CCBC01B187BC1, 0xA5CA5F72ACE549DC, 0x00006174023FE235,
+0x8966E963BD9FCC5D, 0xE47BDF7BC5BC33D4, 0x6EE6CE758EE63696, 0xADEAB9282469288F,
+0x963F1B8AE1580F93, 0x30E0D88B376DBEC2, 0xDAA9473BE179A5A3, 0x2D865CB851B0B63B,
+0x956D2CC4A67F90C8, 0x14F8A802A8C8F78C, 0x630BB6AC97EAF296, 0x00000F499F3E4CE8,
+0xB16CA453A5BA4321, 0xD2E239ADE9345C7F, 0x59459E006E642819, 0x4A6B7D70B4B2F314,
+0x6D42F1218F232FB2, 0x159C7B4DACE8D6DE, 0x92A0888B29A8B4A9, 0xF61EFDECC175179C,
+0x5C139B0E65012B93, 0x3E863A24319738E0, 0x05054FD4DF0373AE, 0x000062A9BA7A39D7,
+0x1E58CB9A004525D7, 0x2E6FC83DD428A8AE, 0x3DF3F5B6F4A19B69, 0x25E84E83952CC88C,
+0x43F26ABDCA2F84F0, 0x4E566DBE97D6B9BE, 0x8774B5081C5BA25A, 0x551FABBA7BD39303,
+0x509F2F28C1ABE73F, 0x9F1A5DC06AA9BC74, 0x179B8106CA3B46C8, 0x000014349CE3A4AB,
+0xE3D662E3E51302B2, 0x5995755A48524881, 0xB16EB3DAE37E1851, 0xF13108EA22AC8108,
+0xC93A3022B682550D, 0x2F4654BCCC109832, 0x4F6DFCE8E3529558, 0xC3F69337DF85F7B9,
+0xABE6349D40C35D1A, 0xE75573E5ECB810B5, 0x7E72372D7ED36CD4, 0x0000469149A0DDD0,
+0x7779522CA82944D6, 0x3889F1EFD609656D, 0x337A724C8DECBBF7, 0xA62A4F31737BB6EC,
+0x4042E8714196718E, 0xA0A11BDF22A19548, 0x104C4151CDB5EC59, 0x66B3EDA8B570736E,
+0xE09765C70B2F8549, 0x7AD75C42FAC3D447, 0x153C0C9DF8A77BFC, 0x00001CFEAA686965,
+0x215ADC7115D1170E, 0x37B7ABE5B64C662E, 0xCA8833D8A8EF526A, 0xDA5C5806CDD8A942,
+0xAC2573490B1D14D8, 0x7624068E28DCE5CF, 0x326AE0FA066F9030, 0x1B31D578FE40A065,
+0x46653FBCFEE01935, 0xE12E604758399A27, 0xF3D2B0FB5C8803D0, 0x00001741BAA0A14B,
+0xB193426C025AF38A, 0x3CD3377729BFCF9F, 0x90B7279622E018B8, 0x6EF0624936EC2E4E,
+0xDD623F925FFE258F, 0x6716017A28F13D77, 0x5C9D861B101395E2, 0xB080C957550E8DDC,
+0x2A5045A0D4E63264, 0x4E7D6D66A32F57AE, 0x91E710330AC26140, 0x00001D28A17B9087,
+0x130B964AED9A13F4, 0x25289C3BFF53DEB2, 0x38798F51362A374A, 0x5E38B810E62A5FD0,
+0x2074ED30F80AFD42, 0xE253260A72A58EA3, 0xA6FEB42F30CA22CE, 0x30353E313FEABCEB,
+0x6C756E0FD5072674, 0xE6DD96123CE6F934, 0x773EB608BC04B4C1, 0x0000562B757126DD,
+0x3F5E79DA66CB5E2B, 0x818EBFEF0DAFC4DD, 0x75BB18F4F277C278, 0x2690B83886632BC5,
+0x2E70DACB92B0938F, 0x51F0F587166BAAAA, 0x5312685D68D100A4, 0x2B9E369C28B6BCBA,
+0xA1CB73436B5896D2, 0x3149A373AE517C70, 0x92CFCF388BB492EF, 0x00006B7AF226C3D0,
+0xF8D193BDC25B4498, 0x3218C5F88231A4F1, 0xBE748F082875493A, 0x29CA5BD6C60CD7F2,
+0x8481168FF5EDC231, 0x129DB500F7C8778A, 0x72E586BE8D868478, 0xB585EFCBF70DEFBB,
+0x871AF241369381EA, 0x1F33966244367517, 0xFCAF2E0E3BD6967F, 0x00003B85F0CF08D5,
+0x19873F54D083CC8A, 0xA630F25D9833C7E5, 0x7EEC7CDFB5C7F0A2, 0x99FAF222930A732A,
+0x5E7E9AE1376495DC, 0x6FECE561D5841182, 0x71FCA7D6752EB270, 0xFCB2B02535757FDD,
+0xB94C43668CE4A74E, 0x6F0872F98094EF59, 0x32F2A4FDCA6DFBDF, 0x000062661B1C3BC4,
+0xD2B427BAE26BE178, 0x8F5C7147DDF2BD0C, 0xA964B691CF532ACE, 0xD85F1B1078129B5E,
+0x8B77CCF071B2E995, 0xABA814AB8E416EF7, 0xCFDE5511A3F7C2CB, 0x565AC5C73022F4DC,
+0x2F35404EDB5535D3, 0x3114704B2692A366, 0x085371BB480CF829, 0x0000422406FE59A3,
+0x1B92C95E57769FAC, 0xB2161EB482109BF0, 0xE58B986FC12EC192, 0xBFB8C62DF34D290A,
+0xE1CD5A22AE3E0B09, 0x0448792D318D3258, 0xA7F60F0D77CAF73C, 0xE931C2E7079DF68D,
+0xC5201D2EC0DCBAE0, 0xB0C1AFAEC060D728, 0x2ACF15FEF35C348E, 0x000024BE0195047C,
+0xF6C0ABE0E12DACEC, 0x800EF75B7A3D87B6, 0x3BFACAB2D8AE0872, 0xD1C2EA6A1B03602F,
+0x4508DD924D37D417, 0x6BEB10214A0402EA, 0x08A30EEBA6B82D62, 0xC044EE084DB3FA10,
+0x2AB72714748191AF, 0x5CC9F46F644EC04A, 0xCADCCFE73303432E, 0x000044B11621C872,
+0xF9A8378605B2221D, 0xF4A8299C17EB6F11, 0xABFBBBAE852F3561, 0xED2518A78603A619,
+0x866C724EF4379322, 0x4FA52E68457D3A22, 0xC3107AD557B69758, 0xA551275C2EC6BBAD,
+0xC5F1118C9991D3F1, 0xF26593BB433DA38E, 0xF2F0F1481F78AA03, 0x00006DAC5E8E935C,
+0xE2A625934744BDFA, 0xB481C5112BF7E70C, 0x51AE260B0ED688D7, 0xA11C785E8BD2A8D6,
+0xB1995D4CE876D5F2, 0x28C1023A84750803, 0x1AAE0DA4DDBE195D, 0x7590A4DFF1D03DAF,
+0xFB565AB7E3DF0909, 0xE437183D05DE7DDA, 0xF11FBA88648AB6F0, 0x00005404317B8139,
+0xC1F06ECA83C84521, 0x97BA4AE91DCE47ED, 0xB846CCB53BF19030, 0xDCD2832BF08B7E78,
+0x2C72E1A7EA37CBFC, 0xF8532AFD2DB4B430, 0x71AB3908CED0C43F, 0x1E6316DB4511C408,
+0xAE7D54323C65A99B, 0x10EFEE00CB9C007A, 0x3ACECF5BD5075DD2, 0x0000278C446EB683,
+0x2F548997E878EF52, 0x69F0404B73143E93, 0x938A0C1DAF9E69F8, 0xAF5EB6036362C92A,
+0x52BAF67A1EE5D8EC, 0x437A5009D7A72CFC, 0x339CF00149A88FD5, 0x397E0DF461B984A3,
+0x056472077124DE89, 0xD354FF4D4403A5C6, 0x1FF4D3D71FEC74F0, 0x000067E73AC74EAF,
+0x2C5548CBEFB74DA5, 0xBF291B0F567FB7FD, 0x1C414A9C8D2D92AD, 0x68FA46C8B452905C,
+0x5AB13C9AA30E7727, 0x1A1BE17E38E3AC5A, 0x91A0FBDDF2CF4881, 0xA512F7B1AB5A6C6F,
+0x7F871D7B44134D82, 0x2ACC3E25D541B503, 0x65AB95FF6C59EE1C, 0x000035C37C78927B,
+0xA80694A23BA8F175, 0x456C3380A1DBD28D, 0x4D4A61E14DB9500F, 0x709A0CD75948EFC3,
+0x8571A38B939E0C9A, 0x934EAFDA7D37DE5E, 0x62782A46C196F219, 0x9563833AE81F3B02,
+0xE4FC7F56B49437EC, 0xDAC46BE88663549F, 0xE015F185A135F8DC, 0x000050FAF4DFF690,
+0x9C95DE9A756B3B3B, 0x56A8E9CA931A1F9C, 0x3C55E4D193B1C982, 0x3E9685DA937F74F3,
+0x62DFDE0910EB0AFD, 0x1EBC5A1333032896, 0x8DFE70B78E1AA7D4, 0x469FE9A842346346,
+0xC93FE83C69926034, 0x5511FB940A36C7D8, 0x6F6D1188564E3A0D, 0x00001EB502C547F3,
+0x08784580C861D464, 0x1E81BEC3498138A9, 0x94E4CFACF804B25D, 0x370FF1AA03530C05,
+0xBC644EA2AA93D2D6, 0xC6655F81007244D1, 0x3B72768EAB263937, 0x8894911508DBD742,
+0xAEFF475E6F12148E, 0xFF73CDD0323197E1, 0x7A0C64BD5A2ED2D5, 0x0000546A53BB4850,
+0x2D5B8E244683992C, 0x5006E268071DCA95, 0x4DFFFD71CA40BB47, 0xF5DA577D36173C64,
+0x799EEA77670D7DD7, 0x9905559C0B6C2FDF, 0x1D1D8BE607E79AD3, 0x755797DF375DABF9,
+0x3D872397AB5898BC, 0x7BA403076F84501C, 0x451FA625F35D7DB8, 0x00001FDFCFDD7E70,
+0x8166E0982C92083C, 0x70435E2CD1F8270C, 0x99BA947105E79EA1, 0x61DA13D62119770B,
+0x3CB1CC7081CC941C, 0x5027BBE06F27B813, 0x1CF83F765F089F27, 0x047234DCB26F74FA,
+0x74B558C2A525118C, 0x3AA11835E9881F0E, 0x5C3DBCEFB9932C34, 0x00003713555B974B,
+0x5DE1A7DB3B1D6833, 0xE5838027959308C9, 0xAAA4288E301D1F74, 0x5CDD38A3443F8A33,
+0x475F4443B39A593E, 0xBBD7C52E2B997708, 0x2D167D246CA4A707, 0xBC93269074579205,
+0xA5274E3CEC3FEE82, 0xDF2247C4740535C7, 0x58BF71942C0AAEE0, 0x00003D323F4E6C23,
+0x0910BD1FB5C29164, 0xA3E813A313CB4EDA, 0xF4464160521726F6, 0x9B81EB5B854194B9,
+0x23AA51A5A6658F01, 0x6860DD27D091B7A2, 0x056DAF4CF2145A6F, 0x53D88E066A2D07DB,
+0x622F7728F8368859, 0xA8297825B0A9E131, 0x1B4639517FC408CB, 0x000021967FCAEC11,
+0xBC530CCA8ECE68BF, 0x2FAE0133445F99A7, 0xFE16BD838FD01945, 0x13985D4E5434823D,
+0xAC890DF42E8CE8A0, 0x5FE4C21BECB7BFB4, 0x2C9E1A20A5DE7BBA, 0xAEBB5CB6FF958D60,
+0xD6AB7DB21BE6ED5A, 0x02F2BB685C90FA73, 0x2A0361E2D4B97310, 0x000068E897EDDACA,
+0xCA5D655632E0CDE9, 0x1343DEF9E328EE64, 0x5DD3A28F8110153C, 0xAE6EAFC3D9844738,
+0xCB0EEDC1C1148146, 0x4345275F8017B0AF, 0x84C82CE050FFA80A, 0xEC8328FC464DE20D,
+0x013595088927472C, 0x11D78666449FCD3F, 0x66CC96C44603B9CA, 0x00005D4D17A1ECD0,
+0xFD9174C818942890, 0xDCBAC79EFD3EDC13, 0xD04373674CBA877A, 0x3BEB03054E688C73,
+0x97F9667B24F4AE6B, 0xCA18E00164979335, 0xF264EB6457BFB971, 0x53D5BFA2F109FA75,
+0x97B3C8D020FC5027, 0xE54AE96F92209C35, 0x1EA58AD33B4464F3, 0x00002898A862B423,
+0xB172CA20602532A8, 0x5E07AF4755364037, 0x9FAB14CF080B5989, 0x18CF1D06074C57CD,
+0x7C2D3CD3F18178D0, 0x1FAA21BFA9790752, 0xA19738F419F1424D, 0x7B13A52A00D5D4BB,
+0x9E9978E2FEACA067, 0x8A9DB1FD063E6EA1, 0xBA3FCB5F28957CFE, 0x00002FC63A8A9827,
+0xF34449B9C7DCB16C, 0xFDB177BB6C87ED36, 0x522C63D59D990338, 0xCDF59A16FE12A97D,
+0xDF0321D883733FC5, 0xFFA239AFB3CB57EE, 0xB4F37BC80A4B5E94, 0xC325854CF8E50F9F,
+0xDDEAD738162FF5C3, 0x052AE7B2882BBC8B, 0xFAA1F1CB264858F3, 0x0000054C0B18DD12,
+0x64B0ECC0B44AE8C5, 0x736E22D26651AB04, 0x071D1DB3320BFC64, 0xB5A77FA76309D7C1,
+0x91314450C9BC0C84, 0x1DC773E38180738C, 0x1F19726ACDC2D397, 0x0A68F76CE1AD1F81,
+0x1C66FF54E0AE64D6, 0xCD795FDED1C0C30E, 0x972F7F46FDA70404, 0x0000093D1FA7955E,
+0x96F79AA6BCBEE2F1, 0xE29779D7A802767B, 0x0CFF9F69C1B37864, 0x0D6A89301FD42E7B,
+0x6AE24628834D785C, 0x09D808E2BA99C9BB, 0x82929BFADE8736DF, 0x7E570F760F0B962C,
+0x1FD99FAB535FFE20, 0x5F24743D1F15A5FD, 0x3182F2766B7397D1, 0x00005673702F2E68,
+0x976B8AFFC9A9B4D1, 0x4C75090434E9522E, 0x73E37C5F3719B347, 0x3CB3226292AEF776,
+0x19438B5202C7FAEE, 0xD7150A6644CDB429, 0x87D172D812F150BC, 0xC01CD719C5C7D3F6,
+0x95942B82D98AA480, 0xC9C5E099FE1E82E2, 0xBCCA2AD01797AFFC, 0x00003AFD53544F6E,
+0x810E7B374D80A8DD, 0x06BFDB1EECC0FE49, 0xE9E252BD161AF721, 0x76748B7AEA418C65,
+0x7800E7457341EC95, 0xD92A0AE0417A3963, 0xFFF92D9F702833DD, 0x278B3BAF56EC8DD2,
+0xFF34D0ED28C23411, 0xC5DD697725437EB7, 0x3399343F3BA00A28, 0x000043510CFB1A6C,
+0xE23DCB3C2C10848C, 0x997E4FA1D809DA45, 0x2469CEE8FE6F6568, 0x4414924B83068D26,
+0x3F4EE2E10D3076A7, 0xDDC48B0DAB35F91A, 0x44E316D7D5E7DB38, 0xC94AEA1D6CA024EE,
+0x6866C3E359772B71, 0x188BF0AA4BD5EABF, 0xA9E34C3C4EB0136B, 0x0000021F3DE78C46,
+0xBF3C8DAEF48B8B5E, 0xEA75B3D4E5B85F89, 0xF58B92199C62895D, 0x1204CB7AF55E65D4,
+0x48FC8AAB0EF6EBF6, 0x315A53B0EE714C48, 0x31475AA06090E724, 0xB348AF59EFEBC059,
+0x140346D7A611087F, 0x4845DFCCBEC6CDF7, 0xFB867FB2C10E6EB7, 0x00000690111EF92E,
+0x1B508441AC821A6C, 0xEDFEBBEAFE21935E, 0x5214A01518DBF26E, 0x4DE3AF4CA8946734,
+0xA8C1364F1E1A2728, 0xCC636845B65FEA87, 0xFE61E9A2969919C1, 0xC44C58859C599C32,
+0x06E5E6B071B0F779, 0x2464C4F008A4FF48, 0x8B8F80DFFF5B5629, 0x000057C6A2F7D86C,
+0xA73620EC6678B80F, 0x03EC3E9EC380BDE9, 0x3D44D17B3AA20DA6, 0xC7A64E7B7D1324E4,
+0x9117033175E2B0E6, 0x15334872ACB129A1, 0xC939987FD15DE93F, 0xA24091CCB7F0C0C2,
+0x39023808DBE56A5C, 0x9E738D891D98844A, 0x066B0217FF1D227D, 0x00006886EF9E0CCA,
+0x035569998254C153, 0x8DB02940588B3BB8, 0xB68B6FB7145252C3, 0x40A49C517B5EF3B1,
+0xDB209A6E444FAF50, 0x74D078225D45B06F, 0x03F8A5A66A09753A, 0xE486D2C937170BF9,
+0x1019027C6BBFA8AF, 0x12B4F97721BFFB9A, 0x1FC7DD67C0173593, 0x00002CABEABC4D75,
+0x49E1F249896FE1B3, 0x72ED3E75F5911C0D, 0x63375FF517991458, 0x5B26C686D12B772E,
+0x7BF467E7CADB3DD1, 0x305B8BC858040044, 0x90A3EC12AD8A1270, 0x91C2591A9E8624A0,
+0x991BF2A1BE281DC9, 0xD7E2123F68E51CBD, 0x7B86786A47C4B34A, 0x00004871701CC508,
+0x1065BCCC4D1A7926, 0x270BFF3493667CD8, 0x2D981C461BF76CDB, 0x6988862B712AC1AC,
+0xCA580F0F0E77FE64, 0x77917C917878E989, 0xE580EEB707F1774C, 0xF70FB0D6898ABAB4,
+0x10096940FC5DF9FE, 0x54AD2777DFB64B3D, 0x2C1DAC2100B81E58, 0x00000185DBD5E98B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00000000000249AD, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x8310000000000000, 0x5527B1E4375C6C66, 0x697797BF3F4F24D0,
+0xC89DB7B2AC5C4E2E, 0x4CA4B439D2076956, 0x10F7926C7512C7E9, 0x00002D5B24BCE5E2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
+
+// x(2^i*QB) for i = 0..(OBOB_BITS-1)-1, where QB is Bob's fixed generator, expressed in Montgomery representation.
+const uint64_t Bob_ladder[(OBOB_BITS-1)*2*NWORDS64_FIELD] = { 
+0x8E7CB3FA53211340, 0xD67CE54F7A05EEE0, 0xFDDC2C8BCE46FC38, 0x08587FAE3110DF1E,
+0xD6B8246FA22B058B, 0x4DAC3ACC905A5DBD, 0x51D0BF2FADCED3E8, 0xE5A2406DF6484425,
+0x907F177584F671B8, 0x4738A2FFCCED051C, 0x2B0067B4177E4853, 0x00002806AC948D3D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2E0D1D363CA6633C, 0xE1A17692A3231EF8, 0xFBD02C077D24BCAE, 0xBAA5C761E0418C74,
+0x3E6C61FAB1B890B4, 0x0DCE7FEABCF4DF6E, 0x6D73033986A967A8, 0x66AD2EFE19924C90,
+0x8164811ADAF95A5C, 0x61EA7B9B5311DABA, 0x0DEC8681D7F3B177, 0x00005D7FDE6C9D19,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC9F0EC6DB707F574, 0x4947F652F5943C87, 0xF84D37C5E84ACA03, 0xFFC0063983DE1489,
+0xA01E0F25CC6F7323, 0x59CBA020B840060F, 0x7DAE914F1776941A, 0xC0D643EEB2E01799,
+0xB078ED1626C7293B, 0xCF015DED48146D22, 0x8BE5DB11B11AF620, 0x00000A2FBD41F220,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD1D75FE3D81E577A, 0xECF294090BBA58AC, 0x6145C7DE557F6B07, 0x5ADC70EA71A74E73,
+0xA9DB8A68EBA86F62, 0x4FD1305BB60C3044, 0xB66A9ECF75397799, 0x7C07CAC2FD1823F5,
+0x0938EBBCA56FB95C, 0x4A107854E95E80AC, 0x5002A7D5C3CCD726, 0x00001C2727444270,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA4F72EECCA45FF48, 0x66934D7A8FBDD3C4, 0x1F275CDAC0A91032, 0x0BFA6F8BEE4A6F64,
+0xBD128FD20700D8F2, 0xB43AB496BD56A777, 0x57469855C12001C0, 0xBBEFC1EFE6E21C10,
+0x73F7F0CA209DCCC8, 0x35245AC5A9C4ECD1, 0x6EE63CF12F262592, 0x00005775E186CDF0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88A0DD5804318CC2, 0x9BC860A1D7C014C2, 0xA3463FB4A31D4B7A, 0xFC8199EF7916B91E,
+0xBF2C94B40335A280, 0xF004A8F2125FED34, 0xC92DE2EF649164C9, 0x923086AAB2C0D59C,
+0x0C814DAA990D6231, 0xEDD7A057A74FA0C8, 0x5A90777AE6640F98, 0x00000267D33A8738,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCB0EABAE5A515611, 0x10DDA877428DD7B3, 0xC09AD24AC3C60736, 0x07458D33FD2CFA23,
+0x0413B399A839338C, 0xB61937028C967BE3, 0x9FD5FF7650A1B8DD, 0x36F21119A9A764F6,
+0xC977F0A0B460C1F9, 0x0FB87C606E55D793, 0xF205B17C1B384462, 0x00006890A5101151,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6D120BA2C22239A9, 0x1BE77D83E139F5D1, 0x2B8918E0FB22C3AB, 0x0FBD131695AE2469,
+0x7CC21EB492D494C2, 0xB7C35E143ADF7DE8, 0xE6F6124B27B38CF0, 0xDA16242009DAFD50,
+0x3594C01CD769DF5F, 0xF3201A8B3D66197B, 0xD9462BAF7FFE1248, 0x000050D1115225D7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB8763C215F618C86, 0x7BCBD618CDD290F7, 0x0FCF716CCA5BD957, 0xB8B6C816511A025B,
+0x68FB929506F1D735, 0x4DFCCAE13CB92E50, 0xFA4B7B6FED95E058, 0xCF842A50720166E5,
+0x8D840DF06B8EB68D, 0x103067704F53D00F, 0x06DB7D1D461B949A, 0x000018E01E561938,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6840567D5E7E998D, 0xF5AEC264FDC549B6, 0x5FE03F5A34731EFE, 0x449CA4D23984B0BD,
+0x7FBE3EA89BDD6570, 0xFB249F1A98740AC1, 0x1508F1CE51E711E5, 0x3E6EB7DE052E26A1,
+0xE70683E3D316FE5A, 0x6CFBB3AE066434E5, 0x7C55C3F9B5E3FDAB, 0x000057EB894F87A1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x991AA2D47F1796AF, 0x1032BE2BC4B1DD5F, 0xA6C97852EEFB9F78, 0x74A11656EDFC8234,
+0x26B73BB2F2C1A030, 0x811F78B30FCFD6D0, 0xCC8C6D82EEFBBCA4, 0x977C07574FF96AF1,
+0xC77D73AFF766644A, 0x7AA289EA38FC3EA0, 0x50C671291BFD27F2, 0x00003964AEA03954,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEADA2C6C1BEDDC57, 0xCA03B9F52AE90E6E, 0xADF9C66058B2ED87, 0xE412FA6E62609E6F,
+0xFD234622EE86D2F4, 0x855C8CF360B92426, 0x7EA3763963729F1C, 0x4690BA57EF28F8FF,
+0x3B36CB04B88ED945, 0x769D2C202891D5A4, 0x84655416025E5524, 0x00005A3B850609B0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x338692C9AAF20CD3, 0x96E18CA5EF50B2C3, 0x5F27484B1BB54D63, 0x95B86DDEDDF96C53,
+0x65413DA6A28BF882, 0x9C02EE522FDE0D59, 0x3859310A3A1E04D1, 0x1F4CFDA80C1E068F,
+0x3ECE16F2AC5DB5DE, 0x6BCD79A2217AF981, 0x4235A03EACEA46AB, 0x000023134DEEBDAF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8718875E7BB857DB, 0xD476FAF2978EA168, 0x4B65816B78A16A35, 0xCCD8D0974F04DDF5,
+0x9CE1F3680731C761, 0x132DB338ED48DBC7, 0x5322A8965D2B456C, 0xF0B1B75F45A8F2EB,
+0xC1C1D4F501F8D798, 0x7EE08A3A59480A06, 0x5EFC8E62D7C2DFB6, 0x00003E0223FBED94,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0D2FFE966866F6D, 0x4382BE48DCBA97E1, 0x717BCA74B3E0E8F6, 0x9E254ED73E00692F,
+0x8F9E3CF26C18BB37, 0x87AE76CC981B796D, 0xC8DC970A658E13E5, 0x363196D157577D36,
+0xB3092BA7DD0AAACE, 0xBBB5E3226AEAF9D2, 0x7466E2950149D5C4, 0x00001622AC0918E2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x73B781E2D8F42E54, 0xC4148F7C37F87A28, 0xD323C0D1F7943543, 0xA0579ADDE8122705,
+0x196A87C1537E0DDD, 0x4BD80B5CC4A34FE9, 0x60F7EC0604245170, 0xE98238D943EF1A30,
+0x597D853D8E255527, 0xF260663EE3BF2B89, 0xE4ACD8CBD4D296C8, 0x00000CF8E7F1A740,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8B6D0D58648351F5, 0x5414E30DB9028870, 0xD3BDAB2ADF0DD300, 0xB06F858FBDD35465,
+0x08F01C9893AFAB13, 0x2618E209A6249AA3, 0xC94B7C883D2332A3, 0x75CFC41BDFF40B62,
+0x7D340844F1B0747F, 0xF02A89372C1E046F, 0xF63C4C890307A4E2, 0x00006BEF680C1D74,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x683321E35681A7A7, 0x521D92EED051619A, 0x58C552A209FA01F6, 0x3CE3F52F16EBE494,
+0x63A261DFA1C613D2, 0xF7CA0E5543934840, 0xA9B81639BCECBDA3, 0x1132440DE2C74170,
+0xAC55D6C8C66F6264, 0x683AFA7A587B5A11, 0x38AA1FC2E54B602C, 0x00000E06D20C03BA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0E66278D190C6D53, 0x203929B57D193E8D, 0x918EC6DF319FDF41, 0x91FFE907A3BBD7E5,
+0xDE0516AA76375C60, 0x925310D75B646EC0, 0x509339EC71473165, 0x690653A4C22689C8,
+0xA9D0F4A8A51AF536, 0x490B3364A86128FB, 0xFD2F97DEE076018C, 0x000009E0428507C5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x592029539B66E990, 0x80E5ECB675576A6D, 0xF72C086009E03910, 0x0050CFA711432B95,
+0x376C6421321DBB27, 0x5199B2547D9B0EE5, 0x9D49CDF2D31ED21C, 0x3794764468D63CC1,
+0xF0333BF452FA258D, 0xC5C34BE11E3EF7D0, 0x7029DF4DBAB5BC60, 0x0000198A26E1EC61,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7EE3B49ABAB82751, 0xABDE3AC258A48C55, 0xF6EDBA5A5CC9FC82, 0xFFA8C72BC902DF5F,
+0x3306FBACB36C9ADC, 0x8307A5C98A7B12C1, 0xAEBE13C649741B17, 0x80D4B3F3B8076730,
+0x912549AC07B767E3, 0xE65BFEAFED24315E, 0x21BE49D80956CED5, 0x0000207243AB4691,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2247447E22482EF7, 0x57063CE78D3F9528, 0x925714DB15149E05, 0xFF666CA3C44A4B8E,
+0x0B9CE8CF9CD2EC68, 0x9AF47260C6A53783, 0x483BD68620899CAC, 0x6063C9AC82436A57,
+0x3BEF273A07E40F3C, 0x86839E21284E2CFE, 0xA2EF781299F27998, 0x00002226D7F558D5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA53F89637B55D244, 0x633564BBAE69EA36, 0xC6E31744DBEE2380, 0x51082375E28B5762,
+0xDD13C4BDA88FADCB, 0x113B73013D74BCE4, 0x56CA50570F251506, 0x1A9EBA103EA360B4,
+0x03814BAC3B052A24, 0x0F47020E6240EF42, 0xA82890824D66FC25, 0x00001A29D915E582,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33A317604CCA6169, 0xCDFFE91D870178F3, 0xCAF1116A9068C444, 0x47FB2290093794AE,
+0x9BB30CB6B4DD4E37, 0x7336EDCF0DB5E9BC, 0x6E7D28DAEB0B9ED1, 0x82317F1669BB8484,
+0xB80F6497FFD78268, 0x26147EACBF89DED3, 0x669BA9C2602C5FB6, 0x00000F39B0999DED,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4AFF5886F721AA2, 0x313F3F06888AFDC9, 0x913ABE6E5EAADDF1, 0x7978290820C71D21,
+0x31E5431F95780C37, 0x21D5449494E6C0A6, 0x0D3F65766553CEAD, 0xA64CA9D5AF6217B3,
+0x72EF869CC59D8F65, 0xAE68C971804FEEC6, 0x99EF48BE446BAE5D, 0x000001A0F7E838E8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6DD41AC6DCF23D4C, 0x32948AD9AA6813A9, 0xA84527F9FB8C2609, 0x4240C274B0E14109,
+0x417F75CB8A627214, 0x5081E35AAA04D1CC, 0x983B9AC9FDEEAA47, 0xDA7508285FC9742F,
+0x1D3FE3B76D8B5E53, 0x09107EBA4DF2A419, 0x8FFFB68AB3E1C97E, 0x0000198BCD3D67E6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x95A9D589A4A31A8C, 0xBB833918685FC097, 0x02BAAB0E85228E11, 0x624038E38A04D767,
+0x7BED51400B038E81, 0xF4C2C3731A367565, 0x7B605A226B7CB323, 0xC2823B507CF2D347,
+0x461FA58C5DDB699E, 0xA9ADA272019D7328, 0x71FBE63B90FDE427, 0x00005C7F9017E298,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED95DE6AA1808845, 0xD04DCB95F4705476, 0x1B9450BFA41EB870, 0x22F4645AB47CDE43,
+0x7FA48A82B37DC58E, 0x8C54C83608A53CAA, 0x3CA0E043325E56F1, 0x1E6DB0BE468E8344,
+0xBA241182081BCFA6, 0xBE841F2D325A2B88, 0x2408E233F7350956, 0x0000269D2B5AACC7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B6781CA1687CEAB, 0xFE8C5CE54180876D, 0xD34029ACD96DC6A4, 0xE712DC3E0B6F7A09,
+0x7FEE1211E6A2A24B, 0xE68FA706A4879834, 0xCF693E66E8DA50C9, 0xC1ABEEE5325D86CE,
+0xDC0AEC28CB2D7175, 0x0577DE3C1DD8B890, 0x8612A0F4863B0425, 0x00003A4C282634E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB17657CF6377C6D1, 0xF42C8097E8D7619F, 0xBF8378A3B7E69CCA, 0x1A55A40500F0123C,
+0x1A8D285D79964BA8, 0x838A86C1EE3E3D5B, 0x0FD721C635843293, 0x7B8A5B9B8160EB5D,
+0x9382C5B8E99E037B, 0xC65179E01B2F2FC3, 0x8A95617A14C2AF17, 0x000041EB7063C5E9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB64CC3F2BBA20431, 0x4C49765E6BE58B49, 0x98ABC03124469D1D, 0x22CE2AB09DA7813C,
+0x54FAAFE05D7B14C8, 0x0BE356E566650FEC, 0xE9C220B23195AF83, 0x66E741D0DA9FEA60,
+0x078275C89A37DF03, 0x4E86FEA3881D5CCB, 0x854DF9D52E89CE20, 0x0000206C12D9973D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x19E50C682A63C1A4, 0x7A0E29B22FD2F3BA, 0xE4B52E5BA6FDFA66, 0x38C27D5FBE0EABDA,
+0x1BC1D479A9A8079A, 0xF4A1A93B3959B89E, 0xF47CB7D09D5A734B, 0x631380DA068B1F1D,
+0x3605E36B348D0DB0, 0xF89271718AA6CBAE, 0x7170725D03A5AD68, 0x00004738DCBDA2E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x49FF473407514A1C, 0x6BE87700AC35202A, 0x4D24E98D7EB93DAF, 0x89409913E5324022,
+0x827F5D9E58B72ECE, 0xA88F9CE2E9A8BDBE, 0x949626D09A6EDEEB, 0x3D3BC32B38C50D29,
+0xC149C90DE889B5CA, 0x04750FC72D648766, 0x51DA033F3C0631DB, 0x000044485CAB9136,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2E19D8888AB460FF, 0xAC0B0604E0CA1883, 0xEB1B7E66E15CEC37, 0x3FC7524897BBE8BF,
+0xD4D949601A24D5FA, 0x8B97965254EBCD6F, 0x23DA0DE2210918CC, 0xB6DDA01AFFF9C903,
+0xE7ABBE21C73E2D64, 0x6071922F8C933CB2, 0x8EECF4A323CB76CF, 0x0000148101E9127B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD12BBD4C4A0347BE, 0x3A81CCD236FD9543, 0x0B653BC231773700, 0x038B630414F4AF2B,
+0xF76FAFC8C31EF3C1, 0x044C3049668A3E20, 0xEB1402D8882564B6, 0x1FF59B57B8AA52F2,
+0x0C7B8D6C4A0F801B, 0x96355C95B87C2D75, 0xA46F92D91EE60F52, 0x00006AF8B37E015E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x97437BDC9BFAA827, 0xAA3A31BA66DCDB12, 0x1798435C940ECB4C, 0xB2114C35F962A822,
+0xAD14AA8625A9347C, 0xD495E06356D0BF6A, 0xFF9AB4998DF3B499, 0xEA1A70785B98C3EF,
+0xE7950F58C12F75F9, 0xAE392F81C62C6774, 0x65E57684FC371AB7, 0x000043583AD18EE1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1AEA6160A4595908, 0x469FACF25F220312, 0x8CEF5FC5334A3144, 0xDAC8B637670CA7B1,
+0x04BE61C4438D76C0, 0xC007C80A0A416EA4, 0xF2C2DD470E8CB5E1, 0xE0AB333D356B202B,
+0xD646C0D7DCB4D8E2, 0xCA88F8C5FF164063, 0x38913202185B530E, 0x000002FA7EA19679,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x73A4D1E50897A82F, 0xBF102A4B503C5EE9, 0x7EE898F365091D81, 0x2DD4A2ADED532BCD,
+0xBF202B87C935B5B1, 0x79476E27F63B1594, 0x38E8C2AC98C5E0E1, 0xD199CFBBCF821079,
+0xA4AAA434405DBADA, 0xD68D60B7CE6CB031, 0x11781761786D89E4, 0x00006727DD176E5A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFE43B866761E0195, 0x415AFA243D9CF4E2, 0x3BF34D1C221B5483, 0x9EFB4BCEC787729C,
+0x97EE02A512C3EF87, 0xB6EF675F1E95397B, 0x1553A4ABCCC2CC52, 0x7A26E211B01370CC,
+0x33961DAC7921AB5E, 0x097C2440DF4FF1F1, 0x7764AC8085A78D4C, 0x0000185590B9E776,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED8C58D2CD58A1AC, 0x73769BD3F7E8E520, 0x789EB7F94190D712, 0x8C0676BC9014B6AA,
+0xF759E47B2B7C0B31, 0x269A117998F4905A, 0xDBB75E74F20D03CA, 0x3A3E0F12A54FC568,
+0xE87B55F88F8D0FE4, 0xFFFDA08CB9A3DAD3, 0xE81479A3740A59C3, 0x0000592C08A36FA7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9E9D1B417242336, 0xB25AECCDA2863012, 0xB9CEF1B5B2AD9D03, 0x9968A27461B67939,
+0x1D5BAECD19CB9FB6, 0x5D7EA21A3D52E895, 0x3D583AE3A8CCA216, 0x2AAA28216E2849F2,
+0x050708609E71E415, 0xC99DBB158807DF36, 0x6E9CBBEEE6AC4603, 0x000052CA9CA9BC4D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDCE2A339C510029A, 0xC1576616F3397117, 0xD9D5680363754062, 0xCAE303C6AA45622C,
+0xE552B761115D9DAF, 0x75B5EE68D1694CA8, 0xACEC4A92D1F283D6, 0xA6F0BFE0672C3C60,
+0x8980E520F959B857, 0xF886BEC55DA9B8E7, 0x8464CF1F59875DB7, 0x000046C164324017,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1F4EB3466DF246F4, 0xBBACCD2AD501E20D, 0x543801861BC29318, 0x78843A28741AA7C6,
+0x5110E46B2F478ECB, 0xD0CC3E086D3EE12B, 0xD601479316845C74, 0x7D48C70E3A25AB04,
+0x2D5A2CC969742F30, 0x0E933B709AD4A3D5, 0xEBBA0D3655EAD354, 0x000015C235666345,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF23D3CDE6A333F96, 0x7A3F61702418DF61, 0x34AC1D1ED73FFF5B, 0x630F35197B59B77B,
+0x27A9E193DE1EB836, 0x97319AF1B0829B7C, 0xFA55D17E721DD743, 0x8842526894BB468D,
+0xD8B072756C23C4E3, 0x17AEF5986E457973, 0x8C64A574E3F4E344, 0x00005887E7AEAAC0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3BD412F58A2F0B56, 0xEF54421B55374780, 0xA729A074FA58D590, 0xE2034A8832918EE0,
+0x69A1DCE3B61974DC, 0x8F857A147D07D5DA, 0xE51E91CF4858BBF1, 0xD3952EF47191E9C3,
+0x4AFB60C724F020F7, 0xDB700A639C390A79, 0x4B91F6097F3CA374, 0x0000291EE8F5D38D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x473B4FACA8878D86, 0x10BFFFB46CD85C68, 0xE58D194FEA8452C2, 0xB58D1F3DEB2DAA30,
+0x939DF0F6928504B3, 0xF9F51F4754FA7925, 0xD34400FF5149E28D, 0xC8BFA6BEB18A3CD4,
+0xB69F7CA997949D80, 0x9E7936D4F42E1669, 0x54ABA94CA7A72F95, 0x00003D7AAFB6F1B3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x75A567F1A6E69063, 0x6A375E0861DADC54, 0xC54C89950DB29435, 0x3532CC526642D6D7,
+0xA2D9C324011E6446, 0xE48A2C7324E205D4, 0x3D4473096F934940, 0xD0BA70A14E698C59,
+0x09594D56EC9D5251, 0x8D5E80F269EEA358, 0x98AE7D96FFE0901C, 0x00005459F22520AE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x885CE8729899B012, 0xCBFF0388C0D2FA96, 0xC746B88DF80AAC07, 0xEB022422061F9337,
+0xBCF5B1BE927FD756, 0x0CAE91D2E15DC756, 0xC9CE9309FCA15798, 0xB1183FA4C5FC8D03,
+0xAA5A64BAD462033B, 0xF1E5EC5BB20E32C3, 0xBFF2DEB5F8352F32, 0x00000000E9846C1A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x32200B89579D1F8F, 0x15D58576985CEB5F, 0x4FBC5AF1F203BF45, 0xFAF1340C02D751F3,
+0x433662F9EA80C6C5, 0x762F4EFE3B555D30, 0x1B7EB1097A8BD6A6, 0x1ECBC4092746AC53,
+0x550D92561A37559E, 0xE210E35747DC89E8, 0x2F01207B07166FFB, 0x00002DB8F918D101,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x354339181D075B27, 0xC604C3A13B964E04, 0xA4592F95CC26FA1B, 0x0A3CE5BBF1AD00FC,
+0xA8DD10DCE0D5517D, 0xAC1733CA81BE755F, 0xA99C1167CF984DA0, 0x50E080E1A9EE85A9,
+0x1E99767900D7AAA0, 0xE75D12560AB250F8, 0x376564DFBD807B56, 0x000034E70FDC8527,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2594F8CB2F6E492B, 0xC4B97D12490B1E6D, 0xF7884CC6E8B1B6E4, 0x744BCB046D4C59CF,
+0xA560890FDA7E8BCD, 0xBE6FBA16211473B9, 0x3B0D918DD20368D7, 0x8EC1D753F116F15F,
+0xB6FC74E29B754A92, 0x33C6F807B227E40B, 0x4F367EC5E637AD70, 0x0000695872BF4065,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7957852669454AB0, 0x1AC3F1DC3AFCE705, 0x636D70556DB820DD, 0x664479EBCEF2EDE2,
+0xBE0FF3F26878578F, 0x1FD2CEE8497D6914, 0xBC45EAD7EAFC711A, 0xEBB28F71ADB890B4,
+0x168D32A6770CCB7D, 0x34967C216B3427BE, 0xF10195802E9FD56C, 0x00006DC96C9DB344,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x66E754946092FE2A, 0xAEBE26081FC47CC4, 0x708942773D664FD8, 0x782D38F98017D964,
+0x5D0C700AC208F9CE, 0x1B614831E10854B9, 0x83C6E876AF178BFD, 0x3F782973CB8A083B,
+0x96D70018663E306A, 0x392B857005CC1ACD, 0x14B6C44DCBB05AD1, 0x00004A3850754EFF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDBAC75DF2BC33B2F, 0x4AB39938528D823B, 0xF7079F95CC787378, 0x671272EB6034EEE9,
+0x4770361F768558FF, 0x914447A17D9A983E, 0x738E5F1EA73ACEDC, 0x26699DFC4AC96B8E,
+0x13ADD3CC8E65B5F5, 0xCDC8A78CFE8BB104, 0xDD89396479060635, 0x00003DA2B3D555C4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8EA0CA65FE54809C, 0xE6EA3227CBE1F6C5, 0x8DDEA490CEA7A26B, 0x568666D8A936C842,
+0x53B709BCC25E55E6, 0x3E26D400D3439582, 0xD7E55FA323042562, 0x0DDEA2B19364F8D5,
+0x1E8278FB3FFDEF67, 0x8B048132AE309828, 0xC9FF76CA7A7298F0, 0x00000BA112A4711A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x80F0BF576CD0C197, 0xFFD9A811CB363973, 0x484C29426EBCDDA4, 0x0011CE20E0AA3164,
+0x4448F64DCD394158, 0x4C5561B543AAADE0, 0x8F1FDD19E4674760, 0x48CE224905FFA50C,
+0x2CB0532A482B8124, 0xF37420E99FFD6BFF, 0xDA20A04D2EFFEAA3, 0x0000669846BADD22,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD0A61D55B51C2F34, 0x8682F5B1E0989D59, 0x25B30E7B51BFDDEF, 0xFDEBB4D106970D11,
+0x209D9C102A7B6F69, 0xF756BE06176790B7, 0xAD00F3F20634E19B, 0xB0A5FF97CD8EC0CB,
+0x2DC17D56F44AA5C5, 0xE58B1DA52DB5E98F, 0x5628E388A7392A4A, 0x00004D60934BE5D3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x212E9C26CA6CF26A, 0x3A3B264F9726E61D, 0x80A93F50C0F0148D, 0x68405BADCD0534C1,
+0x04832DEDD44D9A8C, 0xF122F52509A8B6EA, 0x00DBD1FE06EF6A0F, 0xF39B86E9D875C1DF,
+0x76E3DC0B77CC0687, 0x8A25AD0D5DF9DDC4, 0x6C24C91BCBDF4452, 0x00000D0C8476AA4B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF32E386E48DFD69A, 0x6C57F7387C0976A4, 0xEA8C92F5A7238356, 0x86436E034CBF8FCD,
+0x3A7719E11F8E7143, 0x906573718900215A, 0xFC86DC7DCAFF51C1, 0x4D8CD5F3FAA8627F,
+0x9703420CA3A37DBD, 0xA35ADA74DF4C8098, 0xEB75714E0131E20C, 0x000060447F44E060,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A5AD4524F3CEB70, 0x0336B5AADC7C4784, 0x46CD6A6B0811C1D0, 0x4319A87967D4AA37,
+0xC86B9405EE8E12EF, 0x5C0C002EE3B906FE, 0xE41779CCDBCB8BCF, 0xA527D5EC1DD79343,
+0x1A8BFC0508783B85, 0x9E82D3935206076B, 0x41BBCF6BE74A8F87, 0x0000294FC77B3C66,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x99C833370F04CDB0, 0xC43B7E623E097026, 0x3DCC5CFEFA7EA23D, 0x560D92D92FB1513D,
+0x2BC3C8E04DD504B0, 0x53268DF73F5A05C1, 0x523B7B914426B75C, 0x9136B4045950D064,
+0xA6F25320E21B24BA, 0xA1B9821CF34953B2, 0xD489F4271787BA59, 0x00002E4738BAA466,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x879BF06B9DC4D4DC, 0xC11A01FEE69EB831, 0x4474FB254FE64A2C, 0xDAC5DB0540348D70,
+0x632A1B54FCA2C169, 0x524D58467F18F03D, 0x15889DD00011C713, 0xE19045F27EABA1D0,
+0xE755E0A8A845FC75, 0xEA60FFE6527A6AFD, 0x904D245634C61F42, 0x00002B7543B41FF6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x84361D93DFF81B8F, 0xAEF7834A3E99340F, 0xA7B48AB764EA4843, 0xB0BE95555284CB05,
+0x008F15AAB62FFC2B, 0xA7A8EC06ED32C2B8, 0xF4103FD95870F289, 0xEF948BFEFFA5DA09,
+0xFB2CD29BD5796BF2, 0x86E835D5BF2F2364, 0x74E9FB1A852CAC41, 0x00002A9492B1777D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9FB4A4486AA4FB5C, 0xBA95BF4D83F81E65, 0x52C726C794CAF3BE, 0x3EC63CE37C1BEB06,
+0xD9E12F0782DF5E65, 0x4FD57A9CE2C84ED7, 0x02078F4C0737E762, 0x014E50BBF09D46B9,
+0x3DE6F8A36D000AD8, 0xB83D170E433000E2, 0x23E425B94CDE1641, 0x00005A67B1B3DF7D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA6947F2702D32667, 0xD7D7460F2FCBBA28, 0xEAB597429359C8E8, 0xE3F5CFDB94EF266F,
+0x0027F59F3A6612F9, 0x3F57648903929EE1, 0x6FA8F330BBD08C58, 0x27D38D8CEA10A70E,
+0x98B9C7A073B0FC22, 0x3CC33542CD73A0F5, 0xAC6CFF8F892738E0, 0x000000B7D8124424,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC72FFCC254AB1E5F, 0xCB2D6F34006F6904, 0x7A5D93307E96BD53, 0x367C266F3AC526CC,
+0x41670EBAADBF69E7, 0x83D2B39E17BDA945, 0x495B474B145A70A0, 0x53A0DC0C1837DB04,
+0x42BF15C3A9AF13A1, 0xA8EE371BD6096550, 0x995A35A087FBF2D3, 0x0000536836F08C7A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEB7A15ED23319E2E, 0xAC42878961071877, 0x5715B0392EA434D8, 0xE52C506C2751563A,
+0x97230903EE612ED5, 0x881B2756679D8EA9, 0x0A0B0B7CB8A18681, 0x015264D6C6A3E470,
+0x99C0048149176A81, 0xA92919025DA9389A, 0xE0530C941E70522F, 0x0000317734B9B43D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79A56721AB13CB32, 0x14B5D880049A836D, 0x14FCAD8B469839DC, 0xDBB7CA10001144D4,
+0xF4F09D88E95B291C, 0x73F9D74E8D8AEAC8, 0x495200D246254E96, 0x2A959DBE08F6D301,
+0x8DD326E3BBF06C39, 0x5C36087AB02CEF1D, 0x074FA273DC13A0FA, 0x0000332108D6510E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3E25969488A9B526, 0x50057B50DAA74142, 0xE264ECE05AF30714, 0x08D4285F1956ED49,
+0xB03C0980802A7094, 0x39B8C5B54628126C, 0x3B99EF024DF868F3, 0x1752AB28B83F79FD,
+0x51E04BE5CD962551, 0xD6B2D992B1BBA359, 0xB59CF028FB42B3C1, 0x000000B09B1F3977,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC47D35F53330BE60, 0x5B0581EF83E0DEAB, 0x9FF8075EB0595E1E, 0x8EBE5A9E0D7A0819,
+0x976CC3959E3598BA, 0xF36334222117C8EC, 0x3757A46634DBF562, 0x641EC8E5C4803542,
+0x0AB57BAD3F3FB4C3, 0x1BE6687D12424DC2, 0xDE227E412390A264, 0x0000520BE13FB507,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA6926DDCC1BA45F6, 0xC75B888CBBC54916, 0xED77B48D6E904500, 0xAC23851722586354,
+0x3B065E249C467FEC, 0x4F88F14A9DD97188, 0xEF8062AA7148A764, 0x6BECBADBB86738F7,
+0x06418F4CD25CA0B3, 0xF1B5612ADFC5DA54, 0xB2A35505965304CB, 0x00003644A82BBCD4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A5F39DBFD1EF59E, 0xDC9F9B75B8423280, 0xBEE39AA90774C0CE, 0x602E9CFE74996D97,
+0xDF3D8853C80E9AD9, 0xC398A1F9C58D056B, 0xEB7B926DEE36E683, 0xB1A609E9446DDB6B,
+0xF41AF94029805CAC, 0xF4D65DA49E69FABB, 0xC203AA8451B1B239, 0x0000084BE8DE6A98,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1FAEF3E439ED86C1, 0xADA47BE11D0E4DC4, 0x519F806AAA591BAD, 0xC259C8054730AB2B,
+0x05F2D46A13C398F0, 0xCF59F6615DAB1A3D, 0x40A2E1C1BC1861A5, 0xBA3720448CE0031D,
+0x3B999B1FDA1149AE, 0x7776EB92CE037183, 0xC37DAAE939A38EF6, 0x00005639319EE221,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8BCB8E00AA2C0867, 0x1E1FFEE1240D952D, 0xFD6A4EB64AE42BFB, 0x9083C7763B168140,
+0x04E428CCA49C75B3, 0xD53A755D87E6B2BE, 0xEE7BCC07193DE5F6, 0x80046989D67618F4,
+0xA355808F8AF964D7, 0x06568E4EB9E1C2F8, 0x4FAEDAF72B4650CA, 0x0000306E79C578C2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x17B9379322C82C90, 0x33F1F868DAACFFBB, 0x31206E75462C4E7A, 0xDDD9CAAF00459207,
+0xADE42D78A38AFF85, 0xF6F008A5F216333D, 0xAEC1B16A8B1794CD, 0xC48C3CAD6572E0FE,
+0xB94261847F8CC1B0, 0xCDE702C67CDE6BC8, 0xC664830805D71D9B, 0x000005C32532B0D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x948FFC5EC0A1D3FB, 0x6C96E727C757BDA7, 0x4072DAFEF37BBCD1, 0x403F8B6719D71D15,
+0x785DA3DBE3058BEF, 0xB9ADB110CA116512, 0xC18685968DBE3013, 0xF7801FE2265A5F49,
+0x08C60271E87B059B, 0xA2D99D331810649D, 0x71C989C83EF24BB9, 0x00003AA2405BE2C5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x37254590531020EE, 0xE8F8F3229B4BD135, 0xC28181BE56B30ABC, 0xF7B86324CE7CEA16,
+0x34FFC6A415D4C29D, 0xA817FF397539B053, 0x3D22180C79BC3A49, 0x475FE88335A55C4D,
+0x03BB283782FCB5AB, 0x2179EE6B959D259F, 0x129549CF8F41464B, 0x000063155E4A1C2C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBE3ACEFEA30C856E, 0x75EBF4135FEC7239, 0xBB04927EB79BD621, 0x40590CEDD716DCE1,
+0x45548584146926C7, 0xF4225A422E498A32, 0x6005A140262069C0, 0xC16458E3E14495FA,
+0x377CFAEBFF9FDCD6, 0x75BEC1ED147613AF, 0x4AC3556AD81578FB, 0x000023BCB029EEBF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x28E98CE3EA52654E, 0xB015157CBA9B08B0, 0x70CC3D6C7BD74F81, 0x7BE667090B68959C,
+0x8210F4B8E026B679, 0x8D9FE49C9F38BC7B, 0x439ADB67BA5225C7, 0xB019F09FC1DA410E,
+0xF1697A3D5D1C7F0B, 0x5183E52B07C37A57, 0xBE2D74D940773F9F, 0x00003DE461B3A434,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x50B3DE04EDEA564E, 0x436BD99487989861, 0x3057CE479398D37D, 0xB035DFE8D4E40361,
+0x62CFA15234CF49E6, 0xA97B00607CD7E30C, 0x608FBF9704B7B2E2, 0xEAA593FAB5E27673,
+0x8FBEEDFB99E0FDB9, 0x7D7D4E2543ED8517, 0xF8969B3EF66F06DB, 0x000006E024C6CB3B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x34EB82552DE82A65, 0x4E651740B76F686B, 0x001FE18DA1E798DB, 0xCF259BB0C35BB3BE,
+0x00A8CE5E1CE1E43C, 0x51BE90E5268B9EE1, 0x5B147E604A51FDA6, 0xAC5441FCB764474A,
+0x18A6A930CCAAFBC8, 0x0EB40F3416907917, 0x7DD81FB7690B54F9, 0x000059EC1567656D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x84D72B2FB9BAC15A, 0x4A8F101328C069AC, 0x8D119769016711C5, 0xEC95D82AEAC5BF41,
+0x5152A239B5C496EC, 0xAB3B0AD017CDD6F3, 0x48EF507F7CA15D30, 0x09168E4DE12F9FF1,
+0x6800702C45D2CBEF, 0x800E55413A8E9474, 0xEF6132DAFD187A51, 0x000066B23020EAAE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x47B548C933E1C068, 0x3BB983114C8F409F, 0xAD5140B4C255D0FD, 0x8ABB89AAD3037D59,
+0x41ADC2045EE22DC8, 0x236B4309AD81ADF0, 0xC8A0E0F9E311A769, 0xEE2E001A93E12E86,
+0xDB1137468CB8F23A, 0x49D7BBEC7EE01FE1, 0x2EBFD542744B2481, 0x00005D02AC3E7526,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4FB688D03B4F4E60, 0x70EA1F89FE79E868, 0xB6CF46189606E4C8, 0x63F76C316B68FA46,
+0xDA22E46C64E16ABC, 0xD01AE0DF961EE814, 0xA3370CE32F7A93B6, 0xDB8E9DF5401441FA,
+0x4972DCC03E045525, 0x3EE289671F8F6516, 0x7CAF5CF3B0EEEB3B, 0x000059C8C8392F99,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA209FB23E8E11EC1, 0xC093515EF7C87E71, 0x22A31BDEFBB8D0EC, 0x70CDB846B4ACF31B,
+0x6AA3F88A594EFEDD, 0x3AC64C9A6984CFAC, 0xF1DCB8CC996B7418, 0x40E084F6B06D8C32,
+0x1FD281D2D763D3E0, 0x301BE67D71270D2B, 0x20FB9BD2FC40109D, 0x00004AC60A165D39,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0CD1FE04973E120C, 0x021E7E824670C212, 0xCB6D7CF6433D0BA7, 0x6CA4D8775EDF5016,
+0x6AF724096ACF1150, 0x3E3A8609833E0797, 0xA5F064EC5BC254CD, 0x6C54C46023140865,
+0x358271DBA3289036, 0x14F18A4B4DF1F69B, 0xCE2C82506F75F508, 0x00004EB1F98625C9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD37ADF493D900945, 0xDCE1F5143F254AA3, 0xDB2F4DB198935BFE, 0x89B71A4465B0FA1B,
+0x79D5478DD6AF01F5, 0x57BAD3E9C388BF24, 0x646EF522AB1403DC, 0x9AA035F678E2B75B,
+0x56D3B77837559F48, 0x45A049A5EC5B2F4E, 0x65EEC232786BE996, 0x00004CE40170F880,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8994C4481C5B1BF9, 0xEF247C63FE974DBA, 0x970FE1014F926909, 0x5BAA9A79B4DCB328,
+0x57E617D5BFC44503, 0x50FF2CAFD66FA87D, 0x5C96200B1135F81F, 0xACE1CB5765A692B7,
+0xFC1581F4FF869314, 0x06FD4FD89B6DC8EC, 0x38BABDEF6C601648, 0x00001975F255CB4D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6F3FD18A48A578C6, 0xC46758DB280B891D, 0x77EDC24B0173C885, 0x35D4D553F39FFE34,
+0x97BCD50B116D06A7, 0x70234707B03E548D, 0x2F84CBE30AB73720, 0x381D5B7DC3D95B99,
+0x76ED343F3BAE9C58, 0x987EFC629645C15A, 0x40F1C88D08AF334C, 0x00005B83D0BC6BBE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A5A353948E500E3, 0x07FE2C84326C8256, 0x56D827E08F649221, 0x1512234319EB61E7,
+0x1F4AD7E7139F7E5C, 0x53AD6F7CE7F563AA, 0x90B315ADDCEDBC85, 0x17CA560E3046E120,
+0x19AC20B5F4B9189C, 0x7229F5A337FFF0D9, 0x99E4E6925F020421, 0x00001FAE76048586,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA41FCFB44097F80A, 0x0B8A22F0DBC2D1B4, 0x2D7B05319511F7C3, 0x7C0AE70CED0DB325,
+0xDB4602CC7D3C7937, 0x5B6BCF917469603A, 0x95750FDE976DCCE1, 0x5C90B0FBB5D3C285,
+0x661651FFAC208B84, 0xE8BF18017C24C938, 0x4D2A9D8ADCF0B687, 0x00000A2FB83180F6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x895B17F1B8820160, 0xE690F57B118A3A09, 0xFFF35223713DDED2, 0xDC65F80C83988741,
+0x6B272D6C3B8A6A0D, 0x5B76B4C0A8DF3F4C, 0x6FE428D21E16B07C, 0xF4F393BD93ADA65C,
+0x9CC8A6A5B2D98D6F, 0x6453669CA8B2358D, 0xBC1BA9E8E049CE96, 0x00003C07435C8011,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x91F74F89452BC967, 0x88FCCDC3A99EEEBF, 0x00C59BC89122D969, 0x386FA784F3A7C1CC,
+0x89A0C8D1325004CF, 0x33AF0EFAF1448A63, 0x7646BB9FE138AF0E, 0x30FDE6B12AC17159,
+0x3BC2EC8C9D8AC9E3, 0x861CB8C80DEEFE69, 0x9C11D8B6D47B7E7B, 0x0000052B44ABAE40,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB8592CD0A86D4349, 0x1BE30A2ABF7FEC2F, 0x4FD7411CF8E45394, 0xA44D13B10BA26953,
+0xC80010A465BCAE0F, 0xDFA7F483AD64AB6E, 0xE28550FD820EA07D, 0x0B2477CAB4DD769F,
+0xAD05F3DAE6F2890E, 0x6A929B15ABD6E166, 0xBB9322597852BC7D, 0x00006877D7CB80A2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B8DF0549A4FA805, 0x1616EB835DE34756, 0x2DBEAC49FFFDA66B, 0x309167AFC983357C,
+0xC7D572A455AAFECA, 0xD009F5FF07A29429, 0x548A24D4CBCEAD00, 0x473766F1E5104269,
+0xCDE6F37D36389627, 0xB57DEBEF50BAB164, 0x6EFD05DFE22A1E5F, 0x00004F07054547F7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDF6C8FD8D2284CA9, 0x66B912542EAAED71, 0x922ECDE5C0E2D8D5, 0x2E132384469881A4,
+0x7B533C73DF340786, 0x46752381A3C75A7C, 0xDCB97253A5CD413A, 0x85D2A1190CA7EA43,
+0x43957B31DAE666CF, 0x96E69BE6F0DAB581, 0xF169D969552A04CC, 0x00005A43A52887E8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE1FEE9B387BFFAB1, 0xFF920149867B67B8, 0x87ED2AB2A565180C, 0x53A94E60DE2B3265,
+0x632E2937D5AE53CA, 0x75D1A1B338D989F4, 0x1BB0AB6D01647813, 0x00942E445E41DD73,
+0xE5B5CB8A1CDB4563, 0x013447ECDAA31A38, 0x827E82E7F9977103, 0x00004E32BF66FFC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9D8679F270A1CDDA, 0xADA7D017FC9B2F4F, 0x22A731CFFB7BC4D3, 0x7DF7B24B4FC07E4F,
+0xF17338F61FC7DB79, 0x8A86E122E678FCC4, 0x9797EBFBB8D75938, 0x099A36B5AF4D1DC0,
+0xBFAAF0B0DE16C335, 0xD749C159B264876C, 0x13A9FB18A8A184EE, 0x000007BA28A272DF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDDEC014E3E47ECEF, 0x44514F55CC2BB58F, 0x3C1322CA7BC3DA59, 0x7CA085FDE49F6C8C,
+0x9F4D63A3C9AAF59F, 0x737204C8DBCC75E5, 0xA3CB726DC982DCF0, 0x335962D09A1FF9E1,
+0xDC8868F77581A03F, 0x1E30C27B30CE31C6, 0xCEDBD9889143AE80, 0x0000600C827F2355,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00A6758C3A6DA6EC, 0xD1EE2760051A43C5, 0x1C09E7E44994F46D, 0x732384389920E9E0,
+0xFA6C27B6016092E5, 0x3E5E5305C955E61C, 0x8656BFF1372E8D05, 0x4342C6D594E73280,
+0xCD3DF007BF6B6FB0, 0xA4C4A49F34009551, 0x4AF6451838A00367, 0x00004D80AB565B41,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8092831B5D2DE327, 0x86D2026E9766E4E9, 0xB1416262A438D5C1, 0x7F3AB2CC8D1B517C,
+0x67601AAF2425FCFF, 0x21EA5B915824EF15, 0x9DC69748DFC93EA1, 0x1887EE064C2A261C,
+0x4F6B2DE322331C1D, 0x7988C0BAC5E38907, 0x6CA422D24A7F811B, 0x00003222D2833458,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB29F460B656F4915, 0x1B47B463596D9DAB, 0xFBD9BB6541BB3C17, 0x9CC4F3B2E7D20AD6,
+0x3DA43798457F2BD6, 0x514134FE75224659, 0xD86426E10C28D38E, 0x088E72ED8B553CEC,
+0x8B3B89D87BAEE190, 0xB42E5F5DB158FE17, 0x32FAC173B5F4CE20, 0x000007791D4FA784,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3D91ED7FAD682863, 0xF29A16BC56B757D0, 0x7ACD385565E8614D, 0xF5030CBF6893F7AB,
+0xF83BD7113F222ECF, 0x792E3C8479B70536, 0xBC7716657138E5A0, 0xB512AB82768C748F,
+0x3FEEE99DE47EA122, 0xB7277BFAC6742594, 0x4D3AF973AEB23074, 0x000067A0FED49C75,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7F965BE0C9C8CB4E, 0x35BA4F32ED10A164, 0x565ADF9EC036EC7E, 0xB2C2C85FD995A9FD,
+0xF855437C998E54B5, 0xB8D03CBCD70ACD73, 0x33F42D63DED79271, 0xFB0B0C0D38EBE127,
+0x4583B6B8429EB174, 0x12E08C04976F6BF3, 0x35D932AB1A4D6901, 0x000046EBC397E693,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x23B55794B7C7FAB5, 0x6E226EAA01A4EB07, 0x1A4DAC4659C3556B, 0xA447675CC2746024,
+0x1DA1498CEBA575B4, 0x50886AE6E32BCDAB, 0x4E521940FFFD00D0, 0x1A54ED7BE6C3C53F,
+0x3188F9B6D98BFE46, 0xD34A65D08982465A, 0x132DD61D0C626ADD, 0x00003294E9C91B72,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x386BC1B845EF69CC, 0xAA7D9D23B396B648, 0x45F79BEB15010168, 0x2AA90EF8D219754C,
+0x0B5C68422A920DB1, 0x81372F921D806ECA, 0x1B05B7DC1850C1F2, 0x26A84B3B16381B09,
+0x1B57A46D8FF69DD6, 0x6953CE53B5C68313, 0xA543827501406DEB, 0x0000540A505485B7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA38DCF25025C4CAD, 0x8B814BBA30505440, 0x513EBEC82DF60A65, 0x76E9A6FB7B46B330,
+0x477CFCE222D1E04A, 0x311F156954228B71, 0xBBE5B6AF1B8A7200, 0x4A84C5F9A402C9D8,
+0xE15EF34A1DCC9355, 0x2D0BCE9BF40ABF83, 0xA7CC114F55AF9B56, 0x00001D213F2657C3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE5B867FCB614D465, 0x510B5C876445A47A, 0x812A2F581BAC587C, 0x6E7359ED7C6BC1BE,
+0x4E35C53A0C786456, 0xE35E0ABF13870F11, 0xE80977D5B1F11087, 0x8336F063FCD16155,
+0xB9189F7369A2C7CF, 0xACECBA037DC376C6, 0x3E401D22FB5063F5, 0x00003F129741BFD0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBBC19BBF4C5A326A, 0xA3DB5912F971CDF3, 0x28B1F333BA919336, 0x95B807851C85A962,
+0x571DF3C294BEDF8C, 0x3C207AAD2087C811, 0xB4FA03A5F3869B49, 0x5BAA4107685F39D7,
+0xF7319062AB9F8601, 0x988C047DD7A1F442, 0x92125EDAF43F16F9, 0x00001B223DEC7FB4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x69A0221AA7344AFA, 0xACF3C145C5D330A3, 0x12C4852707DA0424, 0xAAE4CB574BDCC084,
+0x0269ABC79FA77731, 0xDAEB905B95AC7C7F, 0xF27FAC31FF7F0A21, 0x60DD3E9ECAA54D4C,
+0x5421EB9614BD6D91, 0x91880549823CB872, 0xA865F9A18249F7BA, 0x00003505C28F2243,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x36E84498F42E31C0, 0xF44C91A249140A10, 0x676E5DA83F2EC457, 0xB7BAE817315E9AEE,
+0x61051EFDCFF0267C, 0x38AA169441EFA0E5, 0x28C1E7130E08B300, 0x1F4A98F38397C432,
+0xB453739FCB6CFF9B, 0x1375684A65BC8F01, 0xC887B3A0A85D2599, 0x000022276EFE3BE1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4E284DB12E98855D, 0xA7D60E949BF296EB, 0x0215EE68A4AA7B4D, 0x3D24697CDA61FF2B,
+0x0D4BE19D47FBB7EA, 0xDF92B0EA1CDD5919, 0x190E1F4E5481DBF4, 0x899D2840B911841D,
+0xDC6BA829723A79EB, 0x33E33C0EA61898CA, 0xCE87AA4A17775741, 0x0000085A4EC5E188,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE5F9CE77D623C37B, 0x40B66F0880228D81, 0x71C3A4EB57328ACF, 0xCC7A43DCDFB51F0E,
+0x3BFFCAD8E3F41D6E, 0x159B086390AFA24E, 0x169B361AE0EDFD9D, 0x18CC54C0F39C13B8,
+0xDBD173A9B203DF55, 0x81E59204A435E920, 0x892BF4FA82AB3064, 0x00004C62D54592E5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD13792594A63DB5E, 0x22F1816162A646CD, 0x175BA018E56B2051, 0xF786CA411EE1AAAC,
+0x09A2AC1903E1A789, 0xED60BD29ADC5CDD8, 0x76E540CA23CA5AB8, 0xE1AF2D31067E56AD,
+0xB330C90F6BB64798, 0x7DA75D8C72ECD54B, 0x5F4F3722D41911D6, 0x00001FE335FF9B52,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x04D20B8AA586A488, 0x836E850E1A72BEEE, 0x07A0FA52292EA768, 0x86B735BD5E55A6AE,
+0x33E719845969F6DD, 0x72E84CF69CFABF77, 0x8D02FB14D78E9C77, 0x4C06E57000D3ED37,
+0x0758BDFD38E2913A, 0x9FA099463FDFF024, 0xB608B64086346CF9, 0x000012D10218A1F7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB25C589F20684307, 0x90D3E72945F73B50, 0xB5C47D3940250DAF, 0xA742B3DC756875AF,
+0x2A1022782E47133C, 0x48E8CA4613E40B05, 0xC15342B493F81C13, 0xBD4EE9FBBEA954EE,
+0x0BC25E97A131F36F, 0xD17C99EF7C9D693B, 0xAF3DB9F8C7607D43, 0x00003CBF51DB8795,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x643D753F07D3431D, 0x42880464B1A75F2C, 0xA2F59CBD80457CCB, 0xDB1F0882E9DFBEAA,
+0x0BCB9A625B115425, 0x0B5D33ECF24E9D15, 0x4968B05439794278, 0x428FCD14DB5B459A,
+0xCF71DD8F3B203967, 0x7A63412860E5148C, 0x98DF5CD5F1647247, 0x0000222E03FCD556,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDA7072DCF9C776AE, 0xB23E1652238D9416, 0x90A1814B8CFA1C03, 0x01FDE96178132340,
+0xF6E5A67A5C4DCD5C, 0xE2D571ABA70084B6, 0x154F88F3637227D0, 0x9CE5E2697B8FE4DC,
+0xEE2C9290D2DC845E, 0x2EEF3AB2CB3FE475, 0x017C8607EED45A00, 0x0000363202B5A98E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAC932B142F53040A, 0x85470623A49B8B14, 0x2A3EA4A7A25CB6D6, 0xB967F14AD5DEE524,
+0xBAAA5CB3860A99D2, 0x2E1ECC42082A87A5, 0x17403167DE1A3608, 0xC6C4B5DCB9D26EF2,
+0x4336297E9CB4836E, 0x8E843238598B2B0A, 0x696AAF8B76C7DA7F, 0x00005B2E3DA4ECDE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB2742B320BD10586, 0x26C5342D119366C7, 0xFC2EE0DCE5E4BFF1, 0x267FE837C89C29A4,
+0x1E18A28243DFC319, 0xE491FA8A78C6F3EE, 0xF3E7FCD93680C52D, 0xD2C17C8B1EAD8839,
+0xBBB64F2F980ABDF4, 0x8FD72BFC74431FBF, 0x2492733193ED606A, 0x0000307EEE92F870,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDC8952CD3487DF8C, 0xF499D452E174AC12, 0xCE429E957C43EE90, 0xC9583C3045E24E12,
+0xEF281B14C6FFAC5A, 0xF626DA569A8A815F, 0xD5BB7DF247A1DF32, 0x21AAFC3E1FF05530,
+0xF8336B5AD147E7F9, 0x15CD273BF8EEC124, 0x238443F95A618610, 0x0000344736A2ADAB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x07428DB487B63C2F, 0xB8673C2B2ECB112D, 0xA19A6B222B73BD4C, 0x2881A991ED208BDF,
+0xDCBA6A89C7741AC6, 0x83ED6395D7461EE7, 0x455809B18FD7A1D1, 0x6B8D64756884F8A0,
+0x3D16CA9F3D098E5D, 0xBF5508441D0EB411, 0xFF6A80ABAB7C8937, 0x00006EDEC211324B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5FC7638505338EB3, 0x1F39D1C440F3C709, 0xFC46BF7C444EF293, 0xAADA7710D8477556,
+0x569CCB3ABEC347D1, 0x9AB4C86019F2CBF6, 0xA723650A2C019159, 0xDA83213D0BDB5E64,
+0xCE07C3D8872B0795, 0x8F56EDE3F2DC6103, 0x172A00E7CA0474EF, 0x0000428988C88BCB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x59BB4E636C0C4822, 0xFFAD0DC3AB0BABC6, 0x3B5C56C850DA09CE, 0xCA01902C5D57EFA6,
+0x41D37AB10213C6FB, 0x6909FB56FB7D9A17, 0xC76984FECEBA2FF1, 0x4C1CA650EC868AD1,
+0xDAAA785B3145E78F, 0x3DD27E0CA89B9599, 0x7EB3E09C035194B2, 0x0000000654CB84DF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED6AAB6D7A20F2F5, 0xE4940D03792C85D0, 0x59DC543A723C824F, 0x45DDCA3F43DE9EFA,
+0x973F0751CF017826, 0xC7DD9A560E83B743, 0x07A2467C842143EB, 0x94CF434F0E79F48D,
+0x9B4F9CA2EFF42A30, 0xC70087982202B56E, 0xC65572C1656A95A6, 0x00006E8906981483,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE6B77215D6097F4C, 0x6573FB24BFAD0531, 0x4085BA2FECD24848, 0xA5FEE3F6F9E19106,
+0xFC7B05E43C894AAA, 0x5F9A915F2179DD94, 0x51D795633F63B083, 0xEB61857D30B8F305,
+0x19C3FEFC52321778, 0xD3ED6149638ABC39, 0x7B93D2641508E780, 0x0000510A6B3F2F58,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC9836E326CD0B24F, 0xFF0C7217DE5FC6F0, 0x8B4ECA782D8E4CD9, 0x1C25CDB3742A609D,
+0x036FC15A95081105, 0x6012A3E4FD8C9BA0, 0x1EEA20F369A73986, 0x5F8E324ED12CAC47,
+0xE60C20E9F7A5FF60, 0xA032CD7CAF97DC64, 0xCE72E3A96C536DA4, 0x000033716D5134B2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA0B9CABAC12B2429, 0x492EE3DBD19CCADB, 0x5DD8159E71CA56BB, 0x6ACA4F6D4BEFBD22,
+0xB9B29273477D604B, 0x6015FEA7C1C001DB, 0x6893C6A6C82D2A54, 0xF49490EBDD4B03C5,
+0x8887A62103FB7473, 0xBEB3B9477D3EB8A9, 0x613A4C5034D3F2F6, 0x000049393137D4EF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDC469F51E2C77204, 0x2D45D6CA01218C2A, 0x67803D9576557AAD, 0xFFD1A8878C78E236,
+0xC2E306A587013512, 0x9BD66072C465B13F, 0x74E00BB76BFFCF0A, 0xAF683BA14CC9AEE5,
+0x95F376F4AA431756, 0x98C58E0471B60DCF, 0x05B0D37887A1CC27, 0x00003007E3A8E770,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD493AB5C7BB87634, 0x6EE17B1420F7E0C4, 0xF71991DA9B491102, 0xEA9F14D7994E46C7,
+0x4EF4F45D85D4CA04, 0x9B96DA50BA2FBA4F, 0x4FAFECF2705F14A4, 0x2B99CE90C7C72082,
+0x780B6C507E8A1385, 0x63EA66DC9D6A8997, 0x779D403B98BDF774, 0x00005A36F7E00753,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7D68F3C9338CEC1F, 0x1A27EE13929CCD37, 0x5E5A44197F532114, 0xFD29EE1CAE9D7426,
+0x0D33113BB430A9ED, 0x8E90F0B5E84B80F5, 0xBAFD6E49CA00F63D, 0x254D8211C9D5F4BC,
+0x75B5BF0C1B5565DD, 0xDC2F5279B1EAC419, 0x6599A60714BC9812, 0x00005294158820D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9B060D1D158C353, 0xB3DBAE160886E9FA, 0x13C5D31CC6452F66, 0x14558704229B8D47,
+0x3331922746D048F2, 0x365D3610352CBFA8, 0x1A2AF00791F3E82A, 0xFFDABD61A52D4970,
+0xCFF75FD4BE33BE70, 0xAB6BCE4B22A228EA, 0x80425C47429EF633, 0x00004F40FFAFB0B2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x28B5DBA08B8CD261, 0xB7176995ECF39FA9, 0xE6F568BBD969E938, 0xDD7F21F5EB0E5DE2,
+0x6E577163FE80E781, 0xEAC84A94967D72AF, 0x60EBBE858C2FE1BD, 0xA87D08265BBB886E,
+0x7663648EFF84FB47, 0xDC0FE588DBFAB394, 0x15BD431606FE21B8, 0x00006EED432F7DAC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x786BDD658A9B61B6, 0x420F42BDBCB69E1F, 0xF787CA603C8329F5, 0x22F113D7598C3064,
+0xE14876583C0B405F, 0xA88D642D26E98267, 0x8326CEEEB6D4CEF5, 0x5687FFCCB0431767,
+0x2FF9EE4882FCD322, 0x3E3384F33AD13E16, 0x8CADC27E9855C720, 0x0000463E8399087A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x93C7663A5E1129D7, 0x93AB246866CA555E, 0xAE619B66F79DB8BC, 0xBF867A52B5D61205,
+0x644DEBBFC5AE8F67, 0xE45B30013732D129, 0x2715619682B6F2EF, 0x8D55BC9278632375,
+0xFBA5EC60686B1ADA, 0x919C18FC1D10E0C2, 0xCFF85D6F1C48D4BB, 0x00002659A3FD112E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79377B43FF64BAFF, 0xE10F4DC830DFBEF8, 0xDB66F12B82BEA229, 0x5979C5AA8413E495,
+0x4A1C078EF65642D9, 0xB4614309D1479ACF, 0xC1599CDEF2B00A25, 0x94A9B7A655BA87FE,
+0x32B8A443F4CC2069, 0x9DE59EA22AA51ECE, 0xB42F076B781C1AA7, 0x00006C9ED3ED6CB7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5EDB54E479640E4, 0xD235CAB7BEFCA709, 0xEAB15C8100C30866, 0x1F0E50B4627F6344,
+0x11CCDCBBEE6A3A33, 0x5E3AFA04111C9B4B, 0x295EB45DD210CC0C, 0xEB18A9825088840C,
+0xB1A3870FC0F5D900, 0x236F49C97A639E48, 0xC95E0080214D23BE, 0x000013DB8777B4AE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xED0B2ED64316DC60, 0x47EB265D845561CE, 0x8B3F4CE23D588BFE, 0x27FA6925C56D1C91,
+0x609687A17E31613C, 0x60CFF1AE01867279, 0x6F42547DA49E1909, 0x9A31B7012174BCAB,
+0xCFAA2A35529FB7DF, 0x18FDF4D976D48CF1, 0x7D643977E126D7C5, 0x000011D82BA87251,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x487969D6628F81AB, 0xAC8935A0650118C7, 0xABDF66C0D46BFA41, 0x85F4521E47A8A75F,
+0x4DA40AF6106C247E, 0x0FC3610983E43693, 0xEABD94F30F076CCE, 0x074689816E91A933,
+0xD5F0551710C6FEB1, 0x4BDB0A42DD5F391B, 0xE66E99F8B76FB610, 0x0000480BD1BD962D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC0B55CA3A7F6ADD1, 0x9A8EDD2E390EB3D1, 0x33C6D2F62AD57654, 0x95150B23FD69C3AB,
+0xE89A13EE19B3BCA3, 0x606CD8F6C6545894, 0xC4CEAC8AB60455C7, 0x25CA9024E38828DB,
+0x6C6C38A4537CE757, 0x829596D7CA2AB0C7, 0x96604EF56F467808, 0x0000620F2C94FA30,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3D772E86C6408746, 0x0BD86BBC578F4F0D, 0xE0E4DEEDBD141ED9, 0x4BABF5EE9A9B90C9,
+0x7B570E44AFE97424, 0x684EB955CF48C5AE, 0x4963FA7D4F0F1F9C, 0x7F4A130C6A636655,
+0x4003EE760571638E, 0xE2C4DB8A5D32A1D4, 0xA80F4A2120E06C31, 0x00004FE109C7A854,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x63E46A5AFD3B742B, 0xB1C0A235BF35B1E1, 0x190CC73023C2591B, 0x8F4DB6038269BC4E,
+0x7E401A36D166A7D7, 0xA9F14645958B51E9, 0x2EF86BB737AF19DC, 0x0E5E249240BD2DDD,
+0x6ADF60780B331659, 0xCE616F192A36D809, 0x77655DEAAF87FC23, 0x00001BA7396A7D03,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3C9AF2B82CE3AF62, 0x959745F1C6B96FD5, 0x8F92ACF572B8E49F, 0x0EE8EA5CF8C19E9C,
+0x89CBEA70240FDC0F, 0xA0973BAC0CBE5F09, 0x33DEA54FFE0627C3, 0x025CBE736E83A7DE,
+0xD76906121CF8E928, 0xE5A63000B1CDA702, 0x3EC5D631DF23847C, 0x0000644FFA3F62E3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7C6830311C5AFD7C, 0x3978E260CD3D4D15, 0x8B9549CE6E2B7987, 0xB4035F28B67F9EF4,
+0x87920613975C12DA, 0x1FE3FF176FD08D2E, 0xA0F73DA7F302E429, 0x92934DDDC3DD6678,
+0x1E496643793F0F88, 0x5C8743BE87B8A68F, 0x54E44F30B4F124D5, 0x0000333E70286FA3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5FC53DDACECB9F9, 0x40C89E83E3B1C63B, 0xD91F1F784D27CC9E, 0x439084E13CC8A386,
+0x3FF30A21C7C5065A, 0x0138FDE60C0F8DC3, 0x556E612532044CFD, 0x15F3D8A4D136B7AE,
+0x4F04F6E1294A44AC, 0x36A82EB1AF0C2C3B, 0x7B121151B9BF63E6, 0x000006D1CF4DF598,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB351A0868A753B72, 0xEF81E765B0DF692D, 0xB219494DBB21FE7E, 0xE44E0CEC85A2F130,
+0xF7DFA52F76A6C308, 0xECE3EB3112510A13, 0xA507037D1E514844, 0xFB11E7AA610D970E,
+0xB7BE0D7A20F65093, 0x4A664E59E30CE768, 0xA2DB683305969DC1, 0x000067C7BFC977FC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x59070B7A8639F5A1, 0x318CB6C59AC1842E, 0x24A61642F060CF0B, 0x9DC16179988B8363,
+0x1ADA1A9724127C5C, 0xFDB67EF1923623F9, 0x941D2CC205765397, 0x3966929F67741B0E,
+0x5D2ACC372DFE1CA8, 0x8441D680FD9306A8, 0x991F3CD67BF52D47, 0x000010FD0C66E574,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2566326DBC69F9BF, 0xED0948C01E36501A, 0x0895A92CCE677562, 0xEFAF13E1277221DB,
+0x073EB9CF60C0AFC1, 0x53DE018783E96B9C, 0x87CC535CB774CD9F, 0xAB223DEE87284D50,
+0x2B7B47FFEEB030A2, 0xF39C5DE2D397323B, 0x50A94BC559934B69, 0x00002479A27E1E2D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE29EDBC3C46427FE, 0xFAB6B3DB19231D5B, 0x866AC59B976D526B, 0x3E199D9DD6AF3D2A,
+0xC26FA3019781F6D2, 0x58F5939BF0FD8F03, 0x6CA1694C0A9DB945, 0x3749A42C65DC002D,
+0x82C2DF314B823C71, 0x7493226638BFB612, 0x64DCE17CC1B4D4CE, 0x00004822651FC49F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB04147360F870C67, 0x5FD02948B6F5D066, 0x83560C9BF802E8BC, 0x30B7382EF5F9022E,
+0xC251F428B1526929, 0xEAF00132F3B93FA7, 0xA147C3CFCDC4DD97, 0xC0E0417FFE4249BE,
+0x34895E804B8452EF, 0xC4ED6C2A03FF26F4, 0x94D003FDE51312D7, 0x00006295005EA72E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00EDC544D3258A2C, 0xA60AEFE2232E0567, 0xA79B5FF12DA60F71, 0x558CA559F38F6141,
+0x6CE3DD0FE0075F04, 0x2ABBD6817C739DA2, 0x7F0AEEA540E198E1, 0x5B3338305A884426,
+0x953D1145F26E0190, 0x0573F962422F1A28, 0x03A031C18AADEE5F, 0x0000232C9FDC039C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE22F7C2D3E0C59F3, 0xC8F76FF41ABED9C9, 0xBCD6C83C0A2C2CAA, 0x25131137D0C9F6D2,
+0x09B8A4849D78CA94, 0x0FD88EA9BDC818C8, 0xDEA668BF302DE2CD, 0xB0F065961B320D39,
+0x1588A6D09FF05B9E, 0xDDB2F9BC3F7AB7E9, 0xA627EE7C99B976B6, 0x00002799F44EF388,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC1B81B553D34A920, 0x66080332C4C89768, 0x1D8BDCBAF9D4F7B7, 0x79574945982D2EC4,
+0xE8D4B66C5AC7C313, 0xA4C2B6BA354B2AF5, 0x079D677CBDC92FF1, 0xAF3B4CF1D947ACBE,
+0x98A1145436E18480, 0x0D4FBD908F20EDF9, 0x87451331BA3F3533, 0x00001C82FC646098,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x476574904CDF53C7, 0xD845C3B382886FA8, 0x6A2006DAA730844C, 0xFE749B375434BFC0,
+0xAB37FDB095AF9A31, 0x36BC85ED9B1E0B5F, 0xCA3851712D0A3FA1, 0x1372B999883AE012,
+0x193FE28B2E1BFB3B, 0x1BE8BBACDA77056E, 0xBA8D60F81DC9BE08, 0x00004B63C6D9F19A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA8474285C9986520, 0x5AB55DD49175FA54, 0xB1B915FDE1D3F041, 0xE17E56C3C2985143,
+0x7D893D5B71C91B29, 0xF97D29AFE92C320A, 0x0C0DAD0246B0454D, 0xD5CBEF2460D6FEA2,
+0xE786ED44994B2599, 0x91C1BB7715B74A0B, 0xCE9BCE0D3DE4A4FE, 0x00003731DCA8C17C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x45F491490F985A00, 0xFF8ED9CBF2453217, 0xAA17F407D9F46910, 0xF306DE5A7CF5E7A2,
+0x4D6135714CFAC1DE, 0x8A97622B76A4CF68, 0xA2E35E7953F5B247, 0x6B08AF8F839E5DB6,
+0xA261409A64CD30E1, 0xD48D727E487076A0, 0x765400F81663F253, 0x000029168F4C4A6D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD94AF374D5FC5935, 0xFD99B5FCB1DF1E4F, 0xF06E3A196165C19A, 0x69573EF70BE8265B,
+0x5BC3609BFECF748D, 0x764CB3332CDD6D70, 0xB40176DB3C0B82B0, 0xFDA261E8C8AEBA7C,
+0x265962B908F29CB9, 0x18C05E730489D0BE, 0xE931932D92DA9E94, 0x0000509D23EE24EF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x83B0A90755514BFF, 0xC74FE4D7F463617E, 0x2CCC73FF68E9C76B, 0x842273205FCA8C07,
+0xE7C44B661957C05C, 0xC27366603C1818DA, 0x06BC052E47EC865B, 0x4C0A8C1E1A66063B,
+0x0FD16F85D3C189CC, 0xF59ABE4D1EAC0801, 0x9D3872482AE57117, 0x000017334597F579,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5270ED39A5057B9D, 0xF7351558BB99FEFA, 0xD9D4624ED8873B45, 0x737AD6A48A9EC0B9,
+0x4CFBA303C4686602, 0x45343D18B36138D9, 0x2597BA2694EFE9D1, 0x9F113235A652598A,
+0x9536A88F6E0DC71C, 0x1A221CA1139F75C1, 0xE5938669D66A4518, 0x0000170E82A47092,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFCE2CA62B0B3BC1E, 0x53E5B0E9EF1088F2, 0x74C2EBDA8D0F48AD, 0x635B5FD0B66B5133,
+0x51E8900FC722DA92, 0x6F70CDC4E823F02F, 0xD74EDB11E5C540CB, 0x28A20287CE683FEA,
+0x27FD04BEF3621572, 0x9ED264BDA0526D73, 0xDB2F50851640B2C3, 0x00004CB7B13D649E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD61E18F43B2D2EAC, 0xC07602AD43394390, 0xF47D3C5F3A6185C2, 0x08F82EECABCEEBE1,
+0xB111F90E073BF45E, 0x4ABB0165FE4DE306, 0x1DCBF687D7CADD04, 0x432A5FCDA5B6AABB,
+0x3A9784C2A92C3649, 0xE6A82F4F71690828, 0x0C93EAF751177D78, 0x00005200D1B35E20,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2280A9F7D861EC3B, 0x0FF5BA93F5F79A7E, 0xCD2456667BBE3FD3, 0x3ECF508D50769A48,
+0xD5EB8B15C1DFEAE6, 0x4FDB1AC69AD4455B, 0xA905E333F29B1114, 0xEC650AC7E2CF33DF,
+0x9BEA18F2B14975F6, 0x1DF2E7E2320162F9, 0x7439C158AA2BAAC9, 0x00003260BFCDF012,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x29C8235ABB37DD2E, 0xB41E741FA6434910, 0x509896C764928FC1, 0x525DC30E1858FC46,
+0x70851B3D00FB042F, 0x5CFAF2920A458ACF, 0x99490D9BB4E6F522, 0x746D8FF8974FD30D,
+0x955E3ED33F1162E0, 0xE1D25911A9FAE5EC, 0xBAE50882BF1071CB, 0x000037F91207B5F3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA41755EA53EA6FED, 0x2C84F55019ECC215, 0x0DB11C91FB12B496, 0xF9328D1AE22D7ED2,
+0x6356056664D63B70, 0x0D1E40BD82309C2C, 0xD5EAF21655A2DBBF, 0xA2F7DCD7F0E5DD1A,
+0xFEDAEC91BE38A0F5, 0x69C0381F96C40A59, 0x3412EC85FE3794AD, 0x00002BC9D5EA3EE5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9216CD86C0F35CFD, 0xEA748078EDAA7758, 0xA0F1B7AB3752EA7D, 0xE23D2542F9B4135D,
+0x0FABBA74635D4CA5, 0xE22FE9CD2124DA02, 0x550DF3F2B9C7FF7C, 0x70950E92EF91481B,
+0xE2DA1C90C0E318C9, 0xCDB701C3BDCCE107, 0xA2D57AADD615B378, 0x00006F7CD87CB251,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x07F8A57BEFF71F6E, 0x304D4D4311A83B1D, 0x1C12DE0713A2D40A, 0x25BC9D95D5BE7D5E,
+0xE57984F337A63490, 0x4B779B11D234185F, 0x351BC0B35AE0235C, 0x22821C4F29C4B790,
+0x9362B6019D890207, 0x5C08756EFCAC13C5, 0x88C224CB7FDCEC24, 0x00001731615AB61B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3A780D7570EE9B9D, 0x7423F584E2A3836B, 0xFC3F161996CC585A, 0x3EEEFB0767713150,
+0xF69F02683E3046AF, 0xA3D34C8F376E82C1, 0x16341B543AC50F6F, 0x3A6922C0608838FF,
+0x12F1B34645897821, 0x76AF444BDFCC19B4, 0x43FD71C82ACF5829, 0x00005807F0AB628B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3DF471800EBBAB84, 0xDF714CB9A6168A0D, 0xC119254A2AB0B407, 0x7FF76E083401AD1F,
+0x4340AC48760166A3, 0xA500516A28D28B97, 0x9B59B3AF27439F0C, 0xF1E343942BD87CA8,
+0xD2240D9F8B717F93, 0x393464C9B9807BD8, 0x8D12EDF59593343A, 0x000038D2FC9C01A1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33DC869BD1DDD1C6, 0xFA8D880391F16935, 0x1EE8D12B64CEE8BE, 0x7881965C60FDE102,
+0x852734E73FB2698E, 0x912B3488794A7BD4, 0xF8712934390556BE, 0xCC08129A7BC26167,
+0x52417ECF790BAAE0, 0xF51BF4388A9CC58F, 0xF166B27FCF257A9B, 0x0000478DFDF9570B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5BF351EB1D76BE5D, 0xE2B8F38226D9AB98, 0xF027BBD8FF189156, 0x432CBC2CCAD595C6,
+0xAFCC5028745E2CFC, 0xF836B86D7A245EF4, 0x4FF825244F03654D, 0x656CA81B656F149D,
+0xF25C84B25A518B7A, 0x7C484C1080962028, 0x4A8FE4C04A92EE05, 0x00000C46FF5F04D0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1790F0416DBC3C3D, 0xCF6701C6A116AE45, 0x827BE109151242E9, 0xA164B4DAE9DB1D84,
+0xCC9A302FCD018FF0, 0x0CC12BEB52DF87C1, 0x069E5C47ADBBBDF8, 0xA22F8502B07EFED8,
+0x66E19049C83519C4, 0x141FE9FD8140919E, 0xFAC89F5762AC1183, 0x00002060344964E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x64A0F2BC487E6358, 0x8EC93B4D2426C61D, 0x28C3CC310DAF6319, 0xE1DC5B37A96AA181,
+0x05AE72C4F9737905, 0xB581E3A1201EE7C1, 0xB81CC55000A60446, 0x23162836393097F8,
+0xFC8E0D6001C392F3, 0x344DB1F913D10057, 0x047B7EA17AB26B67, 0x000054A1EDE2ABD9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x74160105ED76FCB9, 0xDD8F1CDCABFED371, 0xB712809DC681E3F9, 0xA3860BC5908DF4C6,
+0xC548EA82BEF4D8AE, 0x0B862909CCC5974A, 0x60CDE6CEFEDC1D7C, 0x69C3453C1BB15AFA,
+0xB16C362D5409493C, 0x5B3D1D6C900FB974, 0x1282E8DE068E107C, 0x00000C0F47C3A51D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7452756D91EA9AAA, 0x852BA0B5B5010535, 0xE98ED0DAE9075F0A, 0xA352E85D104FB9E2,
+0xF61BB2190522B431, 0x2394BD437414099C, 0xE8853A450FA20447, 0x21FE06B39390378B,
+0x5FD08629035D6C1E, 0xEED12D906D0701A1, 0x6DE79F176EC47E98, 0x00003538C8355CFD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7B8F61626F064215, 0x0024F894DC01E685, 0x89534103A8628CF9, 0xEF0BA7BE250A9BDE,
+0xBE7C1BA79D894CC7, 0xA5337A631B42943D, 0x8E43145BCB82A7D0, 0x0D9945D9737A8A7F,
+0x6B284541B32A3DAE, 0x7347DA5841C87160, 0xADC7D7A855643C19, 0x00000541C0153C43,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14C69D4111A02A1A, 0x3F2A16FC7769B1B2, 0x947D479F1B126298, 0xF4BD1E1AF3467C02,
+0x78408E328EEA6C8D, 0xD9A1512C7ABF8DB7, 0x44B67F05A17E693E, 0x39E5012EB98C5699,
+0xD454F63F772F234F, 0xC1258BAA9BB2EEE0, 0xE8CB7781A7DDB888, 0x000054799BD7BD55,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA54E0B0B43287F5A, 0x95683C336F36F62C, 0x3A26487F1BE162D3, 0x451C2B4BA1DD57BC,
+0x2F32A7EECE66C473, 0xABFC2FB6F85CA62F, 0x81AAFA93659C7E03, 0x784BE9DFB4C60B11,
+0x17711A45A45548E0, 0x7633EB43041EDF53, 0xCDDA42F038747E5F, 0x000001EF767CC19A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF89AB18DA0E9BA5D, 0x5882D9C5E0A631DE, 0xE149CEBE03B20EDD, 0x0FE9E3ED0D73B742,
+0x4AB1D3CC4E636FA2, 0xBB38479C68AC32A8, 0xC936D083EF2BF387, 0xD925ACC7E65503F4,
+0x17353D592C44307B, 0xD79FE412A2AF77A2, 0x5A844C6046A0DFEE, 0x000037AEF82129A8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D9A5EB969D3796C, 0xF042CE3F680C56D6, 0xCE238489E3DC63D7, 0x78A38316FBE38717,
+0x6ED00E1E581BBED0, 0xE3BB8DBB02B29248, 0x0CA5CD2DFE7D4AC3, 0xF2D3DC5B588C4079,
+0xE5E52EAC1B936CCF, 0x13D9970F6EC32ECC, 0x7BAD989272C46B64, 0x000064B48574FD9D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E793184ADA3C79B, 0x667FF878A89F77DF, 0xFF1E995A404D58EA, 0x775C7166135D4F7F,
+0x814D8527F6346974, 0x45710F2DFE4E5614, 0x04C3239BCF98B75A, 0xED2DAD77701F6C58,
+0xD7FEF11967F5C3EB, 0xC890345BFA5A3F45, 0x5BB6AF86F9B9B504, 0x0000222453402F1B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1379CB08B0828ED9, 0xC3B58C33373D5714, 0x6C67AF96EBF11859, 0xFDE27BE1EF629274,
+0xFACF2DB2C9ABDD91, 0xFF9C476C94B81239, 0xED15F6727BF522AA, 0x45A06FA8FE44ABD6,
+0xCFFA7E38BB488FAF, 0x04473DD5ED18CA75, 0x4096AD3447437DD9, 0x000065BA2099017E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xEF0CB16F545A54D0, 0x9D21D9F86DD5E16B, 0x94CFF773F20846F5, 0xF41CA6868C323342,
+0x1786503B0E729FE4, 0x1732806555407A75, 0x9540DDE5128F5F79, 0x240E429761F03B04,
+0xEF06471DD8D43A83, 0x4963FBB51B84FC33, 0x9F6CE55C69BF7A92, 0x00003368EE594F43,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x343C5ABE6398C2B8, 0x70C98D902D7060B1, 0xC84E1CB800F2B31C, 0xDDEE3C868669A6F3,
+0x19D8219AA430B26A, 0xD9F334262C528FF1, 0x08F94B6BCB7F34EF, 0x79256615BA2D5527,
+0x969936481ECF9CC2, 0x16656BB5412AFA84, 0x74CBB7BB14D86172, 0x00002B202A66DFD2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x11CB0F50DA8F11FB, 0x8E4AAD6F9E956280, 0x34C31567B1E82293, 0x0CE64DEC95C40F63,
+0x6EECCC82E1A1DD2D, 0x3BA62B98F70F9962, 0xA286EE9AF6772484, 0x662F195CF8A1BEFF,
+0x2BCC5AA06437CB2A, 0xC50F2DB98B2EACDD, 0x46CEAA73E1DD1051, 0x00001C22B4E972C5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2986D6E3ACB3F1BA, 0x4D111854170CF434, 0xC2D4E800C7E41063, 0xDD41630FBEFE41D1,
+0xEDF70AC7943AE64A, 0x7ECB86A2A3288BAB, 0xB6F1491D7E490B64, 0x2E09DA1CF21809B3,
+0xC01241316BAFD37F, 0x64BECEB6A7C37E8A, 0x04D26E68FFCF99E5, 0x00003EF10D714077,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x87B20A05483EA888, 0xC7CD60054CC6E0F9, 0x0D073761757E6B4D, 0xF6B68BE70ED8A717,
+0x04A8851437C1C0AE, 0xD50FDD5D508718B3, 0xE554F0D8E707DCA0, 0xD9F5CA72189F0D09,
+0x55B24E1BDC496C3A, 0xEAFFFBCBFE9FA26B, 0x349C25E89C42A352, 0x000010DA6035D4BF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD5766E7F67FC730C, 0xC66CA62E57F55B9E, 0x1A7BCF9AD7F08B15, 0x3712907A896FD7E2,
+0x77C6F3478EDF4D24, 0x81E93FB43D11B77A, 0xC0994ED18377DA42, 0x338FA6B71993C2A7,
+0x9DCF6D708F9E5839, 0x86B0DEF29EAD2A40, 0xCE74FC8542AACF44, 0x00005DD35FA0E902,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x93B9809B49995D53, 0x0EDEE397822B0261, 0x6A762673A1798CB5, 0x0D670DC19C08E546,
+0x4E72730D9291DA0D, 0xC70DD5F3BB001BEA, 0x6592A2C88118554A, 0x7BFE89373F09624D,
+0x29F2A41E5D250BB5, 0xD10FE4A2499157F9, 0x1A560249C21122CE, 0x000010A44BD3C0CC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x082A4FB97DFC1FE7, 0x9DCD105F7EB5421A, 0x2EFCB99E12C5BFBE, 0x9629803D7DB8FA50,
+0xCCDA5AE6B7FEF819, 0xF2B143479619CA3F, 0xDDA281FFA99BA92B, 0xD0AE1DA0AD5706F9,
+0xE370AA79C09C08CC, 0x89BFA5B87BFC6933, 0x2A5021952FB7A1F0, 0x00000B78715A5BF3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x955330731C74978E, 0xCDFEC76F82C7EDA0, 0x69EA2F325FD6F574, 0xDEF695C94267CEDD,
+0xB7628BB1C3331935, 0x54EC30A48FBF0F35, 0x5950B370FF593391, 0xED52064039976BD5,
+0x58C8D37A717033DC, 0x1667C76A5BB83905, 0x9E2746EF14CBD29F, 0x00001B6183367832,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0F03EB6C08123CB1, 0x99E0A9249DD9574E, 0xC0892D028E8332C9, 0x70F3AE8A8F2AFD8A,
+0x674EEADCD734EE2C, 0x1241C942C94545BF, 0xA5BF3D03AC1DC1F4, 0x2CED69BD5D3C72C1,
+0x75126B9E07B36022, 0x6C7E5DF111F6736A, 0x24CC2AB4B1A50DD8, 0x00005C4BD0113DA2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x27691C5D5AB10FB8, 0x8FB055CDD0B1BD1D, 0x5F16CC61062CE986, 0x3937AB862A552046,
+0x411E416C1A3D3133, 0x47D778497C531474, 0xC3E62EB86CF08888, 0x306A0534CEE40231,
+0x7A349AC4CC7AEB2E, 0x164A089E96CEAAE1, 0x11D548AB06419CAE, 0x000052CE491D6FB8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB5E8FE4BD3C22B09, 0x00B98CC3F781E83F, 0x4984284A093285DA, 0xA7BBACF15E0789F3,
+0x34425047AC84AB4D, 0xAB293DDCAD5FCD2A, 0xBC00072B63FF03F1, 0xC4FDA3045D9C6A84,
+0xC72525BF89FBB258, 0xE57101098BD73973, 0xA8401C186DBBF6CE, 0x000025509DC03957,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33A060C0E747AB3F, 0xBBDC56EBCB15A25F, 0xD51ACB58325996BA, 0x73391C8BE72E167D,
+0xAA68E93F9EA99B42, 0xB7A59DFD4A1D4578, 0x3138556E5A3E2AE5, 0xC92E1982396EF3C7,
+0x340D86B200DB62ED, 0x286E3A26FAB372B6, 0x016E6E019B85F376, 0x000013BD48B3CD92,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x029F8D2A1F1AD337, 0x14955F0659F79E52, 0xA16C1050B903B25F, 0xB2E983F789C26A35,
+0xFF7A1ED1B67AB0DD, 0x2A273188B7E203CB, 0x09C632BCC2D5C4AF, 0x02BE6B8EF6F319F7,
+0x4FB141A5DD25C0DC, 0x54073FC2173E0C7A, 0xEEB5BBD5E20EC46B, 0x0000088C2BE04D12,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB7D9CE32A95ED52B, 0x53F1EE5FAC0BFF9C, 0x8777B0582FE962B8, 0x9794FBFD1B22B5E5,
+0xD54604357BA20B0C, 0xF4332DEEEC7F302F, 0x9EE29E93B5D05688, 0x19D8988DA46E3DC6,
+0x59A8BD32E6EB64C8, 0x75C4C86F98FDD23E, 0x0206C5CE2D184870, 0x000033421054E14B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCFF7078D9459951F, 0x7E4ED8CA57402604, 0x9AE38FFDE9AF6B6B, 0x30AF757C42353234,
+0x5594AA4B877BBD09, 0x28A781E265E3FDF1, 0xF58DEFE0DA73AC80, 0x7709C8510ECB260A,
+0x17B79F1AB8E8DE07, 0x23C42891C29C6D3B, 0xF757C850C7D8907A, 0x00001F696B87E3FF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x51CEBAA4FE62177B, 0x324F7E58E9266C13, 0x868458EA7240D9AE, 0x0D42892CDDDCAE34,
+0x04BB14225F68CEB1, 0x4887963B352A857F, 0x9E2D102FFEDC6F18, 0x84DA791E2F2A023F,
+0x7094769E6AF80D8E, 0x923D5759F612AD80, 0x28D1BD283F27712C, 0x000024DA26150FE9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x529B6CB5AE658B8B, 0x47CD082B9B136B51, 0x25DF413314C68089, 0xB6F0709A7D893844,
+0x1B824BE3DF592C6B, 0x8532F2E92E8CE2EB, 0xC3BFE1FA8319D141, 0x4A0F179659D5FAE8,
+0xD4DD2832B14A996D, 0xA28B99DCA068C6E9, 0x639EFA3F181E3A54, 0x0000222505490698,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x29EA72EB452D62C5, 0x4D19C8FD0C98E57D, 0x48C43EC1EA878F09, 0xDC2C8ABA9DF9CCED,
+0x5803F7C04E6467E8, 0x20D95885ACE23DC6, 0x4DE50BB1906273C1, 0xEF69FA1768359F0D,
+0xD8BFB660DAB7AC24, 0x0D295D069AB22CB3, 0x1568F746C787EFB5, 0x0000547E7E44F684,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x035DA506DB5C5A7D, 0xBFD0A29066531053, 0x749A4043763E4617, 0x636B8ABD10E4B5F8,
+0x4925484BD7184CB5, 0x3B1674592F5C7119, 0xC22EC5F72578074F, 0xB4BA99FE25EC3DE9,
+0x989167D6A3880428, 0x86BF2E691C0D81F7, 0xF91BDF5C0F2F322C, 0x000031342A70CF3C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14331BA922316563, 0x86A207DEE3EA5978, 0x45B46E3BCAABED12, 0xDDCCC7460D395862,
+0xAFAD60A100D0AB52, 0x68CFD4EFF20E58C8, 0xD4986219484C5EB8, 0xC1B51789D7EB8F64,
+0x9B487FFB248E8979, 0x35E560A93FF59D5B, 0x8B5342DD51482059, 0x000008CE042C1920,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9F9635A3047FC665, 0x3DE134D9B16D240D, 0xE3221958BBE82CB0, 0x5956309CF2EE0762,
+0x08FD79BA85456F60, 0x9588C43474592A09, 0x2FCA145156B2743D, 0x055B152CFD7B841A,
+0x1BC608B1F1860C80, 0xCAA1E270D8309517, 0xCCFB4044D797ADA7, 0x00006C745CBEFBFB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2B5FB666220B3605, 0x06A1D236047504F2, 0x81ADEA78DB1899AD, 0x9141DAE91803513E,
+0xA19FDEE7F813FC81, 0x180383C8E390B7D2, 0x16261476ECA9F810, 0x0FA565FE03B8DAF3,
+0x71D7624997A0E988, 0x0FC0735F1D212812, 0x12F634585B0BFE29, 0x0000673D72E9D210,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x50BCEEDBC1F08F9F, 0x843D393E0529075C, 0x9EA9B3D46DC0B9F8, 0x65C24A1801133168,
+0xAAAB3A075AAA7870, 0x328F76C3FDB4F441, 0xB415BB42F408E010, 0xA543057E6482B647,
+0xAEDEE8D0CE207FA3, 0xC140AFE7FAAF2844, 0x0E66F9ACEFCCC32D, 0x00005961A7EDE081,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD950B3E2BF074082, 0xC69709D721894E86, 0x8B937ABB338068F8, 0x06295DDEE06C2B7B,
+0xCE9BCF81CE90E731, 0xD54DBA38C37151B4, 0xCA2A30E353D974D1, 0x0586BA70E9E957E7,
+0xF8442A104D4B1AF9, 0x278AB2B7480C8627, 0x453FDCA99EBD8E49, 0x00003C21809CABE5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x33351236EE4393E8, 0x70DBBBD4BF9B25D8, 0x457AAFFDDC0C300F, 0xEEB4B33CD214ACEC,
+0x364134F43E916E39, 0x4DDEFF8B81A0D6B7, 0x3C11425BFDCC4C32, 0xCBEF6D6B0B418625,
+0x40D60B3A138D93D0, 0xAB18EE6A261A2183, 0x99BC84E96EB4C3D6, 0x0000137B35D05463,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3764AB2CFF7CF89F, 0x761A68E629278754, 0xB9FFCABA7E9B4A36, 0x89FCDA6BC52A97C7,
+0x2AABA77A673EEC92, 0x1A6BC427646125ED, 0x91CAFFACED9B8BEA, 0x70CFF4ABBC0DECDB,
+0xF202BF773FB6DCB6, 0x4F3CCC7BB5C93338, 0x431B2FBDBA587A95, 0x00003C71164214ED,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B6788AE19679E0B, 0x1E7A44C8F346CFA0, 0xCF3AC768E7567193, 0xD8D03A152870B52B,
+0xE9BF1F893AE1DB6E, 0x2EF2619DF4992E71, 0x70B4503EBF45F9B8, 0x5DD82329F1DDF394,
+0xFE5BB3BED1D48EB7, 0xBF7C42C7A77340AE, 0xB77F909984580D28, 0x00003213ACC147F9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF893DB41D8727825, 0x473621D271024A09, 0x6BC4DEC2732137A4, 0x520A7511210128D3,
+0xA937A557FDD65DC2, 0x4B6410EEE1C701C0, 0xC8FAB9D367CDF819, 0x057899E047F83832,
+0xC016DEC62112335B, 0x3671DF8F8AE60174, 0x3A679FC601AE37D9, 0x000002F802CB7D87,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA38456C6B4FF9A0E, 0x14904C58CE235A79, 0xDA099F8D19CCD2DB, 0x4DF282DC2D8A3197,
+0x40199382E850944D, 0x0D04F5CD3E08EDBE, 0x3B408D3E0B020F90, 0xBDB3E9BB2FB1624C,
+0xEF853D42E50D4AB1, 0xAC8BF0D34B41BD94, 0x1DE10B9CE0968B47, 0x000037CE16B2545E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE91ECCA2EBAC2E0D, 0xDC32E920A3155239, 0x00E9A734D127FC57, 0xA41851148D02E232,
+0x718FB39F89A0A46C, 0xE6F0A22A20E317BC, 0x311DDA08F9DB3578, 0xE68AC2D9D4B178AB,
+0x167DC96387392F21, 0x98DD67EFC4358395, 0x36BD1E7251714583, 0x00003A9622328F27,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x599B12451D848995, 0xBDEFC01F2870420E, 0x7AD96EA8DD89A405, 0x9C90C5B4F2FF89B3,
+0x6279E0DA9757DBCD, 0x815090F4921AB70E, 0xBB31897F4BFCE1CD, 0xD71CC7C404EC1DE2,
+0x7C9AE24CC200D234, 0x2B201E7F00244BB6, 0xB7662373912DFE92, 0x000062F849C35C76,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0EA0E52EE6933422, 0x67DB17D81D15F56A, 0x526BE2D2B8D4B1F0, 0x0B0EDA2617592DBE,
+0xBC5499A150BF20C1, 0x2D29A1436DD5B9A0, 0x3C4DC867693CC500, 0xED7335E0D03918A0,
+0x25EF6B0B6875CA0E, 0x327849FC8F6C4DC8, 0x8913121FAD219320, 0x0000130A7BC0744A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE39A6D44C9B5F2D0, 0xA308E229C952FB08, 0x1E9F384C3C4F6025, 0x22F1CE3D29210FB3,
+0x68142EC45AA07ECA, 0xF16E29205416D643, 0xF50BCA74B35D4049, 0x5F179DFF300C2469,
+0x31CF45AA8DA930DD, 0x15F588C0BC4AC60B, 0xB594F70162E4BC2D, 0x00000190A27A7FB7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD84C323310A449A4, 0xA2E4503172458199, 0xD52E577EC5CC0683, 0xD3453422BBFB4D60,
+0xD9312AA4A0EF5F3D, 0xEDE83DA25A01FCDE, 0xE2C56E41A878399F, 0x0462D03D075D11D1,
+0x52AFFB4CF71E8F39, 0x58589B59B3AF6D00, 0xA111993C489F9608, 0x00004A1AB6ECEE3F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6067DB8B6E1AF81B, 0x6BBAB7E8B6343EA9, 0x8968348124E53138, 0xFB77C864854E872A,
+0x298FDB5E1C736E80, 0xC1BBB2D995E2F517, 0xED2C6389446B3BF8, 0x8E551B8E586EE3BF,
+0x4BA7287032FB1513, 0x559A34683BE4B766, 0x24F3B873FD6F165C, 0x00005490A8C0034D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xADC0830C55D72992, 0x08BDD048E078550E, 0x35767734B9CD83E3, 0xA04BF3C21C4A9C2E,
+0xB75BB2710CE2F38C, 0x4E85AA41F7F62489, 0x9D780A637C68F1F7, 0x826B4FC4BCC6807C,
+0x9AB415A1AD0E7CA7, 0x5527F13CEF9FB157, 0x05E71F59685A4B46, 0x0000317BBD572B7D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1FFEA4A0424E305F, 0xE3BD8ACA098F2A24, 0x859A342D42543060, 0x6B1AE4FC726199C0,
+0xA45F1486E7EBE32C, 0xE7AF00AD72A11C48, 0xD928D3C724C06869, 0x047DB390C4D581D2,
+0x4AD256509DFF051F, 0x0E63056E227784F5, 0x02C3594263F2E888, 0x000017C800868F64,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x02F25354B62B10C5, 0x104657AC9C722C81, 0xB9CAD41B18BFE438, 0x050F677D5E470D6A,
+0x7BBD012ACA9FEA54, 0x39D68948F36A8B99, 0xD5FDB052429E7AAE, 0x5D3CCFEAF63F4127,
+0xCFDED05EDC3C156D, 0xD80011B7A615A8C6, 0x3A05F4A3D547D963, 0x00004E2F0417A211,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4B1F4846BE1331FC, 0x98795BEA144A56A5, 0x14FF765633035E49, 0x620A001A8379D6F1,
+0x1573974A805686D2, 0xB6D1D5A4824F9F56, 0x515F8968EA1D344D, 0x7595334B58059C57,
+0x31E6771897CA8368, 0x987913996084CC2D, 0x6C50A9A6C9E459AD, 0x00000D0495CA63BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x508D6EDB5091F087, 0xFE59CF699685C1F2, 0xA8E59AD450257B54, 0xE136F089D86D57FB,
+0x304FD83298764944, 0x6E7E20B94BBEFCD7, 0xC9D762A227391AD1, 0x7CD5987BB4877045,
+0x319EB24A1CA0DF52, 0x020B90D9DDD7F9EC, 0x443DBDAE10D9946C, 0x00005033070D5303,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0CA223A4A9636507, 0x66C3736982779C88, 0x45770092BAD3C384, 0xF983168813AA2FF1,
+0xC8A6F507FA91C0FD, 0xAA24A20A9F857959, 0xA3724FA8226536E5, 0x98F775D9C6BD3D52,
+0x1FF3050E619BD4B2, 0x79261996417158D4, 0x60D7E79F0E443C25, 0x00001CE6CDA62768,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5DDFD29F3DBE8565, 0xFDB4BF031B624D91, 0xB9EC12CDEF71B725, 0x1FA8840FB8904BD9,
+0xAD13B2190972415E, 0xB2ABB1A4F0C0645C, 0x4A37D80A138A525A, 0x7AE3CAB78CFC09B8,
+0x6F37311B7F416C39, 0xBEDB1FFAA28110F6, 0x75D43BB736233E1E, 0x00005B67CBBE3815,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFC6386B71F29879B, 0xE66D642FA3010D06, 0x65A097250B71D2F3, 0x64922C5C1282636A,
+0x0B79718B06028244, 0xBF353E87737E346B, 0x6C3551D897A0711C, 0x5E3D79CB2F3BF6D3,
+0xAF8D7C6089FAE5A2, 0xFF04D9A9DB023629, 0x5FA43E25CA813F00, 0x00005D5EDD7CBE89,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x665941D4CFB92176, 0x9BCADDF535D07611, 0x8F212514AE71C879, 0xE39E6504B34F4C1E,
+0x6ADBBB9679A0D3F2, 0x2FF8F1E74F2D70B7, 0x667467895573766A, 0xCB2C350C41448ADE,
+0xC8B97EB7D2C885E7, 0x54EB108569374D51, 0xB968A887242A0E7E, 0x000035F36D19DF3E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x67189147AD9169EE, 0x03FA28EC98AA0938, 0x05194B250F40D6A4, 0x62D0BAE52E16EF59,
+0x02D7AA713CF7ACD0, 0xFA85B83E2D81B71D, 0xD27841C113B98257, 0x8553BCBBEE1ED406,
+0xC447A96F13D8B978, 0x66F3913FFD0F5983, 0x1CDEF4009C4E20DD, 0x00002B660AC52F45,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x898019DACF59F138, 0x56570AA659E73841, 0xEE59C5E94E8DF8A3, 0xAAFA874283CEBD7C,
+0x36D7BDA8F68FB1B1, 0x76AA81C8B82C8FB1, 0xA2DD079605D41EB8, 0x7355174658327275,
+0xCAADF87A8492FBAB, 0x0A53736DCDF5B999, 0x0CC538BA04F09CCC, 0x00006B21A2FC73D6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x68A2A36C0E20845A, 0x0074F40F62969811, 0xD54D8EBB9A344DF1, 0x7166DCA3EC9DBE88,
+0xBCE025DC1C04EE5B, 0xD4703D07C1CEA2D9, 0xB2343848B41FF5F6, 0xC7EBB7006C4BF6D3,
+0x5563CA8B07828511, 0xE1CDC83AD634821E, 0x2EE608E9EB839B3F, 0x000013529E297BA8,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE360A1027D935BA6, 0x84892DC9C1A413FC, 0xB993E0FFCE963CB6, 0x9AE3CD1D80A7DE95,
+0x3977BFC16AAB9386, 0x0F05F6AE5EE74FE1, 0x283344C549F00415, 0x5C07931828CF7BF1,
+0xFF02272D02908649, 0xEDC692B446A0F3C9, 0x42F87A82FC6E3817, 0x00004B8417DAC920,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1D41094B0698C8F7, 0x2C455A21D2757983, 0x862C1C6810095F42, 0x65BE329CE9955D64,
+0x13A4B9D6016F11F5, 0x7A71D14C9DC670B1, 0xA149D173ECCD026F, 0x1F6C43E1C785075C,
+0xF8704D7768C1FE62, 0x1E7E3F7B66473A84, 0x68A5A1B4BD11AB57, 0x00003BBEF8FACDDA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6FED282250941053, 0xD716653B614AF58C, 0x89AAE827977A4E06, 0xEABC872C3ED7947D,
+0x46EF289826317BF0, 0xE5CDEE1B672679E4, 0xF2A261B3E3C10631, 0x6E62DF76D457929F,
+0xE1A8FC7CF865190E, 0x6EE50B0BED288796, 0x1F316F42AB3CB955, 0x00001185878B3B67,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8FD087157297E8EA, 0x72E6778DB6094B49, 0x412BBAEECE7DBE08, 0xC35242AA9E2CEBF0,
+0x5CF3F3E28DA98EE2, 0x2D65F493149DE11D, 0x61CA8CE11E2A27AE, 0xD3B28937D3B4D2AC,
+0xC562743E9490461B, 0xAD3C5BCAE0341F81, 0xD7AC72346FF76AAB, 0x00006E9B2CE93362,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x455394E284B79CAC, 0x18C638456EA0790A, 0xF10A548D088E83B9, 0x38D98EF8BFE20CF1,
+0xBBAB190F42C5C66A, 0xA6ECB9BF3350CAF9, 0x4FF600A2C9A6583B, 0xFF0E084D55C51398,
+0x5634CFF3ACD36848, 0xD062274C7BA97C7D, 0xDA619E6C55D8C1A2, 0x0000689954F4CA12,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x48C95E4A09B3BEC8, 0xAC5DCB3B936E232D, 0xDB509CA40E7A6242, 0x7FAF5F9798672C48,
+0xC2E19338FB893C0D, 0x1FF875DD1332057D, 0x4E4A8134CF7A4654, 0xE09E49B86EFC04CB,
+0x2A71DAF9686E0F72, 0x7981EFBCB7C83E15, 0xC847AA5F0B08A1B1, 0x000010093B7F5D1E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDE2374878CCC41AF, 0x088F3A2F9E71328C, 0x14F8BB9EF13466C8, 0x3658B6DFA460EF9F,
+0xE2B1A91EC5060A08, 0x30A51BE5F685165E, 0x1C8C86931B8F571F, 0xAAFACA502582FC07,
+0x7B83722E2A08A550, 0x854F1FAE4799E2C7, 0x001D0A7229ECF6ED, 0x0000638281CC1D5E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2C7774041DE97B3D, 0x5321041DE686F1EA, 0x6F984AF0259D1678, 0x8D6158D5E985B104,
+0x394CEFDCA39E3625, 0xE18EBA33C62301D8, 0xF66B3097EF336E07, 0x45CDAB6A33435D55,
+0xA6B128BAE858F8F0, 0xB1749CDE43E1E399, 0xA1F3D61256894662, 0x00006A65EA8DBAF0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5B520F2EF170A895, 0xF786AAF61CCA9386, 0x795665D2CD6F2FF5, 0x35B62EE7CCF6D342,
+0xB1EB05E18832672A, 0x3A19AFB686E21330, 0x56451FD0A29CA42E, 0x1D17B8B287E5E62E,
+0x3109C29C2FD73BE1, 0xC6F9D73A71A882DA, 0x1DD2A1B81CBCA194, 0x00001DD536822ECE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x533868F73EDA33CD, 0x9E0C00BF3EBA6513, 0x6F19DAE89B67C5CE, 0x161175E09815B17E,
+0x642EE48DFB9699F7, 0x8EA03D17668E44FE, 0x25928CB0D3238722, 0x5CCD721791FA20FC,
+0x27EDFCDAF471B774, 0xA747A9F91012E6B2, 0x47A963DC2A6BEA0B, 0x000044FDB0979AC0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x46D5ED98764E464A, 0x129C732A95BD3EB0, 0xA51037B028B85B5E, 0x2573B2C1B85D39E3,
+0x56F057778EB9EBF3, 0xBC68F9E1ECFEC716, 0xA940894391885719, 0x14AE59B4B9923047,
+0xA4A290090D1FC39F, 0x5EF01F58CCAC47FB, 0x2E88D971DE27908A, 0x00002A24560ED2C3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8D8AEB1151B8E819, 0xB7630BC4283A4063, 0x8C50CED48509A487, 0xAC8F3FDAF44B1DFE,
+0x9242BD1079A19588, 0x09782301ED4099FB, 0x5C5C8E3D483D7D63, 0x6B4AEE94D2DB9B31,
+0x8A3520285462B83A, 0xC54DF623D7F3072E, 0x9582F948DA5FBFA6, 0x000022A6FDC30C13,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB5DE04C7870D0FA3, 0x8B5A235B2A72106F, 0xEA433088AC95A479, 0x173979C20E850938,
+0xC0AC265250AFA276, 0xFB8152C0693DF961, 0x1E86CC11D3B13A20, 0x0352CDD0C1EDE30B,
+0xA1E1021BD6308EC8, 0x2D952BC248292DB0, 0x5269AB79A71C71EE, 0x00000D79488BB5BC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7140C60E2D2C1B78, 0x4CB6753551E06A20, 0xFC6BF93C7F066473, 0x5A4727A803D7D179,
+0x18AF5C596582E194, 0x6D8355E0B8AA6062, 0x4997E22B62B3C827, 0x9672CFCCD79E9E3A,
+0xA573B12F797CFC16, 0xDA5C5BD88E458320, 0xE384015A14F2D138, 0x000028FB8D81C0F7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD90FFFB04C8F2AD4, 0x63BD854A78DB9D75, 0x72175D22A8D4B958, 0xC48B340D05F8E96A,
+0x461A62EF6416FB55, 0x5001E856C22103CC, 0x17776BE63A2D3081, 0xC6C0D009871709B6,
+0x88847653F844E349, 0x3E001F6A734263BE, 0x12B537DDF82F9A2D, 0x00000A94C29B8F99,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x89325C120E14E8B9, 0x5CC6D7D88BABE137, 0xAB2E08B8D76335EB, 0xE3AD8A839E88E8D0,
+0x60CA7FBE6480D1B5, 0x00D3AB6BD2046B76, 0x78E63CBE2623A1D9, 0x25AEB7729C42B132,
+0x1933E5B8D1AD0CD7, 0x855F2D21959DCDCC, 0xCA2ABF8FBE3BD878, 0x000016A6373C366D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBD5E1A5F8F324D50, 0x33F367B8FFB7E547, 0x2206C814F44AA604, 0xF2BAD48948ABEC27,
+0x943A0FB64426773D, 0x59F7D746B6DBA388, 0xBD5A8152B62DC603, 0x24152F5DAD02A5DF,
+0x8897D081C6E946B9, 0x3147B988D34FA5A1, 0x0010B5E660E8860C, 0x000053CA251C3A82,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA32F853AE66B8A6D, 0xE661C5FE030A86DD, 0xC4AAC2A2EF532CE4, 0x86564FA4A4AD3C7E,
+0x84E5C885C65E314D, 0x2BA4DA53213BA24A, 0x86E783C264411063, 0x3A201E3E055F7CFE,
+0xA7659922E0763FDE, 0xD01DA36A87C85F58, 0x5A0AE8F22C6AEB9B, 0x0000495ED91152E9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x063BF5B9B2CA789D, 0xCB0F5DE44912633B, 0x26DCF599518F4881, 0xFB83FEB9EE4B0952,
+0x409BD74ACD095CED, 0xFB5A3C8736479B03, 0x5D529435D60E6209, 0x6F5568B8A68A9B0D,
+0xC62AF27828D0CE58, 0x22EC7CE185F7CA52, 0xEBC36A731F68081E, 0x00003A35B88984FC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2A561AACC154B2DE, 0x52466BF6CF4F114B, 0x50ABF7D912ABA598, 0xA8E15539C7FB79FD,
+0xB6201205B5B72540, 0x95973B13BDF2D8C4, 0x50801C6302EC32A3, 0x64E6A72096409344,
+0xA544C665E72E84BD, 0x378ED8EA894B3BD3, 0xBA9D9E3F4B086DC2, 0x0000499F68E75887,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x709EA95958F25EAD, 0xE8F56564ACE95DDB, 0xDD2245E2B595B2E5, 0x7D0CF19FBE7A9713,
+0xC3D70A05BC923150, 0xA69DF866E28912DC, 0xA90CA02CA3BE83F1, 0xEC1858FF93274B1D,
+0xD143EDD402E4E230, 0xFF44F971BE7733AC, 0x35532BC4632103CD, 0x000048A6C9556E56,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4BBA6785EF9083B6, 0x21F7FA281851AD0F, 0x676230AE6EB0CF74, 0x0A114AD5FED6368B,
+0x15A15D5D3AB973F2, 0x8D97846261DC4A08, 0xF13269E2C96774EA, 0xC94B6353A05967C8,
+0x1774D5E48AE0AF3E, 0x83C40E391D75B26A, 0x193ED106A8451990, 0x000064981095C9B7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6439261BB011A00E, 0x85AF3ED9652A09D4, 0xB0A927217BB6157E, 0x2EB0D7C22C038EC9,
+0xA04F230E3C2A8D01, 0x3DB422890CC891FB, 0x0FF12F1355CC88D0, 0xF9F0C397E390118A,
+0xECCEFAE8FFBA8D1A, 0x7242391ECFE69F8A, 0xC842C52C4DBF60D2, 0x00003BE91E6851B0,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB36EDC6FFCF3C57C, 0x73BA87175D9B9B88, 0xB07B1AB2503F31BC, 0xFAF395BF468730F3,
+0x58D4EA1BA7B022BE, 0x7AD9A722310F8983, 0x4A6CC141D40378E6, 0x5B07A1B4F3586D25,
+0xEA9F6E332B78D961, 0x426D5B30B82B0447, 0xB83F2FBDACB146BD, 0x00002B78D3C33A34,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB774F850B5DC6F46, 0x85403E66CE381A6E, 0x96150751CA643E73, 0x7AFF54F01EA936E2,
+0x5ECB167414F6A3AF, 0x11C3694CBC20B1CA, 0xF4CFCEEBA81778BA, 0x661939068073168F,
+0x5FA157BEE9D7F3A0, 0xDA2C0B0A216271D2, 0xFADA994D5B90568C, 0x0000245015DEC9F7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x346B42849E7BC072, 0xCF7015545347BC99, 0x7AFBE561B6CA7DD7, 0x3F736B5BEF1FE8DA,
+0x8E54EF603FD9D4DE, 0xE923A186CC2898B5, 0xFE2D575C3066DD49, 0x5D985DB05A283B8C,
+0xF4849E773A1832AE, 0xBF0309D03EF9A89A, 0xCD0C1F268C95F54E, 0x0000148AC24D76DE,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDF1DCCBBE15946A2, 0xAD72825CB8C8EF12, 0x327B24C6C762E838, 0x60EF9474C5F757C0,
+0x974F70FE0A7E01E3, 0xCF10AC9FDD431773, 0xDD1B90F258E704E1, 0xB871EE725B83132C,
+0xDB49439707009505, 0x126824CA5142033E, 0x24609473C5D7E1B8, 0x000006D396AA3418,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD429CD6FA018EDAF, 0x3CE02A353E8742C7, 0xCB547F02699EE5BE, 0x97EC22D051405BB3,
+0x4679568E563AFD94, 0xE578B35E78CC9D09, 0x09D9C7DC6B78B814, 0x1388EFC8CE0905F9,
+0xDB5D23192D6FE79E, 0x272F2F258EEEBD02, 0xEA3788C97E2EC0C9, 0x0000581DA3C3DAE3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB43EE0B97746A34E, 0x2C7C67F906E2886D, 0xBFFAB3B3313D596D, 0xF399016AE32C79A3,
+0x801E078392260358, 0xA6E1DCA151BEC23F, 0xA8958ABF81793B9C, 0x1F939CC6E3ED266D,
+0x8E0639A432ABD19E, 0x864E0DB0826F2DB8, 0x02A196C2B3C95F41, 0x00005DE19BEE7FA1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x954EE8C26D0FF11E, 0x90A168A5881B0817, 0x03FB51C7EFEF9E0F, 0x607DAED7038F3AE6,
+0xDBB614136F46D2EC, 0x59227C7E4F811A35, 0x5BEF8329ECAFAE7D, 0xE57C0BC7D2152FA5,
+0xA3F119DEDD0A4330, 0xAB5CF1BEA5E37F88, 0xC33532C73AD31986, 0x000057B4BD051047,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B654002C3909C4E, 0xCE5EA0E47E221EF2, 0xBE4C9C86B9BC87CD, 0x3CB75865AC8AE134,
+0xBA0B5AF5152C83D2, 0x07D6C5DDAA9A4822, 0x745627466D37817E, 0xA9E67F98A63C5C18,
+0xBEACFD061ECF2FAA, 0x662AD5D7D0B16D6C, 0xA0CDFDCF0591E147, 0x000044F320346BC6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A35ADC2B128B136, 0x57957B6F5D9D182C, 0x6FE548272189BC18, 0x90F661D6D649B97C,
+0x74F6632BA41DC7EC, 0x9E3C30B6111565BB, 0x9657B3CD488BD56F, 0xB80AF746E79206E9,
+0x493DB511DE359743, 0xE3E9B46303106B49, 0xE3933E0B56078ED8, 0x0000252DCFD961EB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCE5EFBE73D772FE9, 0xEB6AA8447A4630FD, 0xE6D084F41175994F, 0xA9D5BBDA499A33DA,
+0x3E3CB0F376340123, 0x4067524BA13951DE, 0xEC9BE8967C405BC9, 0xF65F12C0BC4BA1B3,
+0x7F37041A041A7638, 0xD6C24AFA8E963FB0, 0x084E2DF4FD39191D, 0x00002DDEDCA057C7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6743C341F4F06456, 0x849E4FF104CEAB71, 0xD35EB9BA751AF3EA, 0xF1F5388471A554BA,
+0x1B14BE77603F2315, 0x4429F72114DFA186, 0x7FFAD456BA52C2E8, 0x67C7ADAFF0B05AF2,
+0x1BB360F6F16DE8A2, 0xB73BEB9B4E9EDC00, 0xA639A0E75476569E, 0x000053343CC2C4E7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCE37BAFC9747FA87, 0xFD8176385D1619CC, 0xF5145D9F33F477BD, 0x62A6A1EFB57B5574,
+0x92560A79CFE8337B, 0x1A8C0B054F5D3125, 0x790B2950A03F0934, 0xA07A8911A0AE57FD,
+0xB327A005BC946DD2, 0x4E13715E754E893E, 0x301424AFD2D883DF, 0x00001B594640DB63,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCBAD72AF97AFE730, 0x2F7B782772C461C3, 0x62F79F27357157BC, 0xED9B762F70699458,
+0x12CA025C3BBCE930, 0x0A8D97A7EF602467, 0x1D99831E88D486A4, 0x1F3EC03266266C2F,
+0x24BC4F4F528B29D8, 0x780B0B6291E9FFD9, 0x2E54E3A69FE347A8, 0x000001CA322E043D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B5DF32F0E0C4CFE, 0xAEE429C9DB235AED, 0x25F729B11AE43E3C, 0x83C52652030BC481,
+0x356A95D26D8B5C61, 0x9F2E44C9FFDDE29F, 0x1270C9AEB4C2BFA9, 0x19137332938E553C,
+0x6707EA40D6F8EEC9, 0x040E20321891016D, 0x94ACE36B8E0438FC, 0x000028A41D650240,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6C2438082A95BB5E, 0xD9FC064080F81889, 0xCE0669FFA584A10D, 0x0E2AE0E108A0343E,
+0xA820BD54DB0E2687, 0x1707841F13FB4F8F, 0xBD8AEED7E40A3DEB, 0x3FBB7BFACDAFAE39,
+0xFF322FD7FC967966, 0xCBE81CFCB8FB3FE7, 0x8490F9833D01C7CC, 0x00006F9527428829,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0FAA776D7461B8DA, 0x6BB65A09D481F6B7, 0xC6D81B787A616302, 0x31C3FF30B01930A1,
+0x9276C5689B818BE9, 0x45316347A2EC536C, 0x7F3FB8840D1AF1D5, 0x66349B9BCF32C459,
+0xDA4D21454976B53E, 0xE2B0B80C573A9676, 0x255EF8671E2B7E07, 0x00001F565B244345,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA5313E0C4C698E00, 0xFEE907FD2EBB2EFA, 0xF36D2E0C7ED6A332, 0x94C4B39FE991EF8A,
+0x69DA23ACE022617F, 0xABE3B7935274185A, 0xF52B2D55EE93D833, 0x0FEB4EF59F93BA3E,
+0xF581669C71884170, 0xDEA1A7849E4AA3CA, 0xCF40C6C68A38155D, 0x00006EFCE13624F9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1AF2A8DA8EE834FD, 0x9C93847D5F3250FB, 0x188C838FF1C6E6A0, 0x4FA9E0F03AEC73CE,
+0x9F4F0159BE6526FB, 0x2133BE715DAE5904, 0x9218198B2B8050C1, 0xB7D231C09CB36AC5,
+0x36F73C7121CCE04D, 0xF24354F4BCCE61E7, 0x0F67F01BBC50F27C, 0x00006005D4CAEDC5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x60A857D7EF5B6BC3, 0x5FC3FA746C3CD0D2, 0xCC5119F2EC77A38E, 0x244F8D284B013AAF,
+0x93D0ECFBA9CF8267, 0x202B88245BB779B6, 0x54B5483895C1A38E, 0x2B4B8B5838AE4454,
+0x6D08C498830EA07F, 0x3B8B3D19F73EF90E, 0xD4D2E66572CE46A9, 0x00003D2523FBD365,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE9F56C12A01C004A, 0xCF177A68F30BC924, 0xC3B2F0CB263F5FAE, 0x62513B4BACF12295,
+0x72064B808D33CE8B, 0x1852BDE19703092B, 0xDD0541FA1839C2D8, 0x97A82B5CC1B132AC,
+0xD511880994DBB858, 0x0218AA2A79EA7EF7, 0x8FFFC466AF8E31C2, 0x0000456CC70B8E3A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x81D0C959F8AD1A3B, 0x621AA63770424871, 0x6EB36764D8C41689, 0x817FBF47DFBCC3E2,
+0x9061572B8F0FA901, 0xC1FAF6615A0CAB9E, 0x8364CF10FFDB62E7, 0xD24FE16ADD35DC6E,
+0xCD3FAD73201CEDBB, 0x4A920989EE56E8F1, 0x56CE7E0FACF5E22D, 0x000027A0D155F979,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x01DCBC344632044F, 0x4E4261C56983174B, 0xB9FAD75A3CC9562E, 0x29AE34B9B04CE6BC,
+0x160429A852163F61, 0xD6515579BC8DC1CD, 0x59130BC97FC9FF3E, 0x5BB38BE1F1A35570,
+0x49B766D0C4F62283, 0x714D08695587F261, 0x783519A50714704A, 0x000011D06645540A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x95107ECC3935637A, 0xAB32B5D6536644BF, 0x3DBA92C6AE16298A, 0x5FF0048402B215E0,
+0x024D5F0BDDA6A4AA, 0x884BDC35E4441A57, 0xA8142673ACDDEC52, 0x9BE6524289D72078,
+0x51FD626C68A1BCBA, 0xA8EF91499B468040, 0x790755DB2562650F, 0x00002BBA1FDB416E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x38EE7CA9B87D7ED9, 0x272FDBF06DF16460, 0xCDB01911E8498FFC, 0xAAF793F12DE5D44D,
+0x75F324A239CF96D6, 0x71E2AFE95A1E4997, 0x05023EA016BF4CFF, 0x2D27FA2B9640266E,
+0xA480134688D35028, 0xE8283AA4F116B48B, 0x1CA90067F166F9AF, 0x000062BEC30C2A82,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC3388E91655F2E0B, 0xD70573F0D08A3BFA, 0x2C32961242541148, 0x41EB7ECD4423FB12,
+0xE9490A807F19EDF4, 0x6DBFA5451AFD11AA, 0xAF3D6C1363ADC4ED, 0xF7B8192D7A65CC12,
+0x29005809A04E8408, 0xAFDF53AE99909683, 0x12AB6E8556CDB8C5, 0x00004A2D20F45DF3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD91930C3A246CE7A, 0x13D3DA72266D6B3E, 0xEDFA17E724E3F28E, 0x57CD1B45F6A57C85,
+0x6642C2B846C00653, 0xFF0FF2295FEDB0D1, 0xB0E83B372391D26F, 0x0B421FADF3D1849A,
+0xC9D597506119E08F, 0xC2717EC7A4E86E4D, 0x9D470B0C4F6C163C, 0x00000427F9C1032E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x67C4898A9CB00237, 0x419ECFFC50F09C59, 0x6BB5CF3F899F419D, 0x12134D1125FA181D,
+0x9DA4481E36F563E0, 0x4278BE744B73A05A, 0x2706D699F48C12F7, 0x14C8480BF172A373,
+0xE490908EE93D01F1, 0x8216D1E5C1E76749, 0xFEF2806CD2FA9B69, 0x0000618869E2DC37,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1099DC3DAE5344CB, 0xD9587F0128A2DE4F, 0xE7EB335FED3EC131, 0x24028AB60E5566EB,
+0x108F5AA5DB9141E8, 0x59ED87C9A4BB8D9B, 0x15599E0BEE962C45, 0x936E54B5BE238FA3,
+0xC0919AE9A9CB3319, 0x8E3102A108312372, 0xC8A7CAF026D2ACFC, 0x0000391FCD994181,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x95C68563CBA22E8C, 0xB61B451CFF2596B1, 0x773BB893C58FEA1C, 0x2B468A8259F0F0AA,
+0x24DEF0CD080DACA4, 0x8BD2C795F9901E9E, 0xFFF397B90F62795B, 0xA4FD1E4729474A79,
+0x446CF560EF269617, 0xC69EEF83189CA6C5, 0xA3F22C218599D391, 0x000029838509E160,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE4BBBCAD77196E13, 0x9F72A4AB3F27B626, 0x2EF68CA41A3A5A83, 0xD85421D53665DB85,
+0x0D34B7D4231011D7, 0xA892290719242A87, 0xF4B877873272257B, 0x7EA9A2F31AEC175D,
+0x31FFBF4CED9D3471, 0xC40B3D26EE47BCD1, 0x50CD0843CDE62747, 0x00002D134351D6C6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE3B8BCF326A0DB41, 0x4297017E5E9587E7, 0xE84787BA11065247, 0x7C40E4C6436ADE57,
+0x1EB3EA18B4E167C3, 0x0D1C2C65DBBC4F1B, 0xF22407079C737E40, 0xC56F11B0DB3CDAB4,
+0xFDDD86D11987DC13, 0x6579B6B714204A62, 0xE35FE45839701E65, 0x0000593DD510917E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5ACDB6B06B997218, 0xB2B0798011B7A49A, 0x9036CD842DD6AE52, 0xE77B005500B2215B,
+0x8D4DBB327EC69CF0, 0x86E49F758EEED57C, 0x62F0F77E4BEA11A3, 0x68E13E5C46FB0CAE,
+0xB67D1229AEB6BFE5, 0x5143EE1E468FECE1, 0xC1C9A2ABA4EC47F4, 0x0000271DA751C8B1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF39DAE2334A3145E, 0x7C3C83D671BD2F39, 0x725D12FA97670DD9, 0x36EBA5D50F685ACA,
+0xD9DDDA5566326C7A, 0x1043637D4ED0145F, 0x8759A6AF2DD0210D, 0x49DBB38C7A1E611B,
+0x6AA74C7F8A7ED4A5, 0xCA201303D4857B05, 0x88EFDF121841E12F, 0x000031119CB9E713,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6D891C673B542122, 0xE96E0625382F3308, 0x6166443223FCA3CC, 0xC3EB46B55061EFFC,
+0x0F9089C0B193FEFF, 0x7D3BA84537DE64FB, 0x9B08742C55B24229, 0x81F945ACDF7D1FD7,
+0x21EE128398C721BB, 0xC7810B317328A0F5, 0x5D8BDB8FE15719A5, 0x00003D5CC2B424EB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE579330F2DFE9F13, 0xFA44D27873FB5580, 0xE1079DF440BECC99, 0x20847FEB7AB9F176,
+0xDE454231340CD256, 0x45D9332AFF4F53BB, 0xFF8CC6235394B21A, 0x7FCD5506C6E4EDD9,
+0x9857F4682ADAED3C, 0xD5574C589A29072C, 0x64D7452B62E22953, 0x00003E8862532830,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3ABF652978F2B462, 0x45035A6B3D66BABA, 0xDFBE731C629BFDC7, 0x63DE05EA04B2A63B,
+0x0354DA53E5FEF465, 0x40218F8FCC77F062, 0x640606B49AEDB77F, 0x910A1AA7672C948D,
+0x7A089DDD3F30D678, 0xEB97173B3CB59EE6, 0x070C01B8AABAC12E, 0x000068000F8DC28F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x08BB2A97C4AC70D6, 0xDD29EB8E8C3F13F4, 0xAB2E310ED80391E9, 0x7AD642D4E4ECE282,
+0x51C930312F7153D2, 0x787FD493558D5B00, 0x936EE32C88CE55F1, 0xE4EAB0EF39D33795,
+0x1B463BC346616F32, 0x4BB76CFC98707689, 0x337BBE2F5554F07F, 0x000028C2F9264B7C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD1372C93C9D3060, 0xE9E93A141BA17AF4, 0xC100F40187BAB70E, 0x6670FFFCAACA1E1F,
+0x36CCBC562EBF70E7, 0xC0D0D34CDE4E21F3, 0x9F747730377F47CC, 0xF492470ED61E3545,
+0x1A19BA3D330005F8, 0x11039CF989EA2853, 0xCE628B26DD9FE609, 0x0000028BDAA3C4D3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3F74655423D91CDA, 0x7E0233A402C908B5, 0x07CF71758BCB9FF0, 0x80411C2FD43CDBEF,
+0x48BF4A2398699CE3, 0x4E81782E2B52C1B9, 0xC28B9DE97D5A65DC, 0xD7A70B1824221B24,
+0x05E507DB89192C3C, 0xF4BE07E80BBBBF72, 0xCA8AB12F54FD7B4D, 0x00005B2C07A8D799,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3FC7AA9ABABEEB0A, 0xC2E452239FACABEF, 0xF1D44A68D21D3C37, 0xFB2BE1903AA41FD0,
+0xF286BF1BF02CB238, 0xBCABD65A22D321AD, 0x3ED829BAA4383A4A, 0xACEFF4D2D00C21C0,
+0x51168CE226AFFFE2, 0xBF67149449AF93A6, 0x8815C6F4AD9AC254, 0x000000A23A394836,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC28919725E8C693C, 0x30CD0C0599CE8A71, 0xD8180BC76EDCE0E3, 0x5463AB4912768C1F,
+0x8A832BC61204C6D3, 0x0625DDFEA6711F2B, 0xC5692F65D80F0E5F, 0xACA02B5587AADC94,
+0x4E6A8960759B1288, 0x3C1971ADD08FB4F0, 0x143B3C78A6DA5424, 0x000060A6406128B7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB20AB5987ACAE2AC, 0x26F765E9451B2EF6, 0x293290691642946A, 0x8600767CB064E439,
+0x71FB2AB46DF88EA2, 0x80E82369B7FD8AD1, 0x132164BB85093E2D, 0x1FE0775662B15722,
+0x2E779A1E86D37D7A, 0x38322ADC61F7944E, 0x854D8F76805CA050, 0x0000495D8C9168E3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x95634893DD78FCCE, 0xAEAC2BAB2301F24F, 0x6258DE6356CE5A19, 0x99E916CCC2DDE620,
+0x68E58875ECDBB880, 0x7C24F412A0113E79, 0x5CFAEEC0B6C6524A, 0x0473E7F7113F574A,
+0x6F39C48B863F621F, 0xED75DAD7023EDA7D, 0x4F42A9F75225D735, 0x00005B24CA7FCD01,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0F3C5C92C89BA7FE, 0x83B37506215497C9, 0x974757B1C25E2AC7, 0xE945C0BB05380021,
+0x20DB8B79D7AAD59D, 0xE8CB13A90D014F46, 0x4A2475E5111792AC, 0x0A8B443E07B39D14,
+0xE55147E57200FA53, 0xD3A83E4FA5EC5003, 0x99F82A2703C39981, 0x000029A7A29C2565,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6F420B0201DE250E, 0xD30BEF7C70B226DE, 0xC984A19B4965F526, 0xC1D870662D0096D4,
+0x38E4A7D46100E25F, 0x79138152E00BB662, 0x4F7608C026FB1A94, 0x3E253C9563731587,
+0xA9EE9FAAAF60F72F, 0xF894D1C2821EE457, 0x87BA8E3CE6ECEF4A, 0x00004A506AE088A6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE96EC531942A069E, 0xC4915C87BD2B48F3, 0x9687C52822D78F2E, 0xEB017BF479E9EBFE,
+0x92BC5FBCC2CD8F74, 0xE9DF183F56FDACE8, 0x3F230E3E8784EE8E, 0xC300EB807D93405C,
+0x40A6770FCA77A852, 0x3ED52BF1AA15643A, 0x3635B2ADCE4F8492, 0x00003AFD9E53E9C3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA58F8635B604B33C, 0x342F9090273B3A19, 0x45A1C5461ADC2D81, 0x6069C539371E6BAD,
+0x6B5E3E6DBF8D086E, 0x2C58FA86C4114064, 0x151DCFDCA34AE7F4, 0xD9FDE9F8C0B5A3FA,
+0x5165E1DA10BE9065, 0x4E36F5AE1E44CF78, 0xCD1AACEA22E81641, 0x000029AB97E915CC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD5FB01562A9F2E2, 0x145F7AEB152AEC29, 0x9A76CF3BAB5CBEC7, 0xE7D3AEDAB73A1157,
+0x5407E2619581C174, 0x7ADD2BFC4B4F453C, 0x5562F6DA041CEEFC, 0xBE03479A83AB9804,
+0xBA1D158B8F2CA74B, 0xA0DBD9894231F8B4, 0x330F7BBAB791D390, 0x0000033EF2BCCB10,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE71CF8E6FA3D6D2E, 0xF763FFF733DC8363, 0x21FDDF62FC83ACC3, 0xA1D3ED9BC4456780,
+0xBBF624E8627096CD, 0xD19D35CC00BB4977, 0x73001D06154376BA, 0x3889CC26B402FEBD,
+0x34C49F974C0DBF6E, 0x6C95FE501EBA2AAC, 0xC487B361E09EAE62, 0x000022E33C69DD20,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x92FCA3DCA99725D2, 0x9B11D80AE4CDF5AC, 0x17EECAD4D5EDCF0B, 0x5729E8B6FEDED93C,
+0x10074A89B68FF0E3, 0x0594C8FCCE24A485, 0xF92D86CB95CCE8BC, 0x74CA7B0FE1E8A04B,
+0x0CF4B7C4B9AEB63C, 0xBAD08904AFA04556, 0xBC471D50AB32F8A9, 0x0000678EFF0A8C55,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x222BD2EEA79C71D1, 0x73F183D86BC6CDD0, 0x2A39715BF95A232F, 0x2F5B915E01F92D63,
+0xA386CF703F14499C, 0x8BFB70D7873A32D3, 0xD02A820C45C2FA18, 0x2F7E33FC7A4647F4,
+0x0B7235B4000B6DB7, 0xB2BB9FB1178A8589, 0x0CDD9C85A667A9BC, 0x000056B4FA3840C6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1B6DBDFDCDF4D775, 0x4F34BCBEE2B15B4A, 0xB860AF300FCBCE11, 0x7279D5312BD5055A,
+0x2AEE96D33613D0E3, 0xF82472F557CD8137, 0xF0D0AC49ED29661D, 0x0E69DECBBFD6F1C7,
+0x31797F46A40ACB1C, 0x3E0AE030C52D14CE, 0x505DEE72A29CFED9, 0x0000572C28F95575,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE54DE70B057FABBC, 0xC115ED29079BE758, 0x4FC62DD3227DD9A2, 0xE8E14D2E7E0F8BC9,
+0x965D1365561D5519, 0xC1FBB8F193AD92D9, 0xC4AE4EFAEE1A8EF3, 0xEE91B469C17133EC,
+0xABF39E56CC9121B7, 0x8364F32560D4611C, 0x3243CCEA8170CB3B, 0x00001317D9A85C6B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1C4227837263FC45, 0x74B8F2EFFA510EDB, 0x42D77AA4FA65B33A, 0x4C740AB52EE47626,
+0xF26B9223B16BC797, 0x119FCE97225CB62B, 0x32FE39F962D909FF, 0x3654B1E45A8F272D,
+0x2626264D58E5AF2D, 0x461BC65C11063C0A, 0x67835E9AC8114A75, 0x000058FF2580B25A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE206942AC4874F97, 0x1D310CF31D63A008, 0x8FDEE1BEDE9BFCA7, 0xC1ABA27A61EBF2BC,
+0xBB255F5D3F370870, 0x9B2E050C49D12BA6, 0x9C89FFA54A3F70E3, 0x223428C63B07E14F,
+0xFB7C7F77A8594E40, 0x9F3DF67680B5CF74, 0xFED58C5B5326EB93, 0x000019E0322C296C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x00F8957138F0DEEC, 0xB244D8672DF4BCA6, 0xD5A207AAEF3E0075, 0x164BFD8F151EFD95,
+0x33999D1297A51670, 0xD1F277DA4ADCC2DA, 0xECF70075466B08EF, 0xA9B2E6062E0CFB37,
+0x24662AC37C1D2745, 0x2C36AA73213606B2, 0x29AA8C167FEF1E2D, 0x0000438D77273D17,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x052111E641251899, 0xFFC75C6F38E60E53, 0x5ADF7FEAD8B44A30, 0xF4A0C12A0BD83B5C,
+0xBF7559568C75FF06, 0x0D4EF5787B90F838, 0xAA2B53D5DA190346, 0xEED0357AC57F810F,
+0x3A0D9C94CD934768, 0x58FE4188AB5FAC06, 0xED2F5F172A16F5A2, 0x00003F68FE076507,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4D24E47B77FE4712, 0x7449AA8B59A4ABED, 0x4E9676BF4269FCD6, 0x7589E5DDD4D49ED7,
+0xDB669C1944272B14, 0xA11C2DED4FE3EFA7, 0x759D73E48CEC08DB, 0x5B98FA390FD07F6B,
+0x398651F2DDA80F31, 0xCFA476CE9A9947EA, 0xE58B69DC4DDD96AB, 0x0000605EFDE6AE1C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B77B1FDA3E79ABA, 0x649A39F5E98708A8, 0x7BC72D0F301D5210, 0x0E4E1A2F18A1065E,
+0x6FAD65102E70A77C, 0xEF77EFB9844ED421, 0x42C0D360C446D6FC, 0xBCA37D46C380E08F,
+0x18D459FE7D639945, 0x1AE73A6505B6CF66, 0xD0A9144B403597D3, 0x000058946F4D3911,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6DDFC00B8BFA53A5, 0x478F249BA23F308D, 0x2812059F9FE3CA13, 0x91BED2ADE5A113FD,
+0x676D0EE6149AC448, 0xBD1AB8EFA3D6B971, 0x561872047AAB0ABD, 0xA04884D2543690B1,
+0xECB29F7876E3AFF3, 0x7C69C121C18395EC, 0xB84F10F5CA3484DA, 0x000007ACBE9B0D1D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xFBD96779C7474EE7, 0x408A8FA68D663A73, 0xDCCE3F7DF204C448, 0x4034517827F89E24,
+0x7F8AED301922DB3A, 0xC6337493D073FEC7, 0xD255164EBE55DBEF, 0xB81B66FAFD900027,
+0xD5B9B02C070807E9, 0xF8A16793FA47C181, 0x17A5DA92E52423BE, 0x00005DF5BE1C18A4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x82F9BACBDE969970, 0x0D9BBBA1D76A973D, 0xBCEB1BE1A009D829, 0x0F8A884C8C158855,
+0xE46356D43632A828, 0x0ED664626D8ECB9B, 0x170BD76B9B5BF2C2, 0x9787564828332EA6,
+0xA7AA071C06E8C589, 0x16B222971ADB8EA5, 0xA251CC3D4CA62953, 0x000039C310DF1672,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x384485A80447FFFD, 0x5DADAC3933167125, 0x1F723A22CB323ACE, 0x2B548599DB953F56,
+0xB82FE20DA193748C, 0x6417C97D4CC929E6, 0xF65D657577CDC980, 0x562955FEE1494DF8,
+0x2BBDAB34059B47B0, 0xB3EBB1416DC2528E, 0x71AC6C351149F7B0, 0x000028B996C2F7CB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC4A16A5168A123E8, 0x7FAAFAD2392DEC71, 0x42E9407FB6B841B5, 0x309A888A0A5BEC7E,
+0xBA8CCA1D7916642C, 0xD45C2E57A5F0E042, 0xF7D3B3D289E901CB, 0x7AFD739E7763B00F,
+0x7B44A50E1C906C5D, 0xCF2A477535F4B644, 0xAC10DAAD11FA7010, 0x000057F27FADBDCB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x40E97EC14ACEF586, 0x54E6AEA891610D02, 0x9205B840908400FD, 0x4430082A490BB511,
+0x1E6390EDCF93F626, 0x32AEB67538236E66, 0xAEF4A6443C27B157, 0xE48657ED22CE5339,
+0x8CBF3005FAC81434, 0xA6FA863C437CDADB, 0x39484DA9FCAE7D11, 0x000041F7FACE2046,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7272280421A3056F, 0xCB1759FD12435E9D, 0x1EDED64027902FA9, 0xA7602D4032AE5630,
+0x9B92445C18E0943F, 0xAAC50EFD35D68BC6, 0x2C312028CBE2E950, 0xC18554286D30671C,
+0xB3D3B0C152E48FAF, 0x614128C3F50F1E5C, 0x6882BF98F877EE21, 0x00004D19A469E3D1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAC407DF2EAA43A2E, 0x4542966276D5A958, 0x4D22E9E17F8B0FCA, 0x9B325D310C714033,
+0x1292BD0B4EC00690, 0x34C6D6C598AD5F44, 0x2FDECF7EAD4241C8, 0xD95118B861C81F61,
+0x878D69DA4C37ED98, 0x364F90D3B5A77A5D, 0x2DDCFE2A5DDE246E, 0x00000752F7BBA86F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAFB8136DC0B9497D, 0x2A7168C125A0B02F, 0xFF67FE612C61ED6D, 0xF37100EC84AE68F3,
+0x2401C1864A9426A1, 0x91AC31BA4A0D9E69, 0x7774CAFCD9F134E5, 0x04F37994ED2E33F6,
+0x9FADC0415D034086, 0x78B03E3AF74DE0FF, 0xEE2C595997EF62BC, 0x000059299F660BD6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA6EFDDB3449F964E, 0x6421BE9A3F9DF2B1, 0x69EA1C42BDEB2157, 0x7B32641BC2E71117,
+0x3221044847EA9035, 0x88231E5C74D2C84A, 0x70235BFCE6CC426F, 0xFDF4A860867886F3,
+0xA19C4E4AA349AADB, 0xDCFD5119724FE53A, 0xCCD620DE5CCF94CA, 0x000052742A2E54F7,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x06EE01368075FE0D, 0xDC8765D44EBCE1A3, 0x13DC84BCCD6A16A4, 0xB14F7D2E4024C27A,
+0x7BD36E8F03288FCB, 0xDE5E896F71DF4382, 0x44D4B2DB61432865, 0x6700DC26FD60B8B3,
+0x53FD0B46DE0C2D1B, 0x439BADDEA4ADA528, 0x06CDB56975A49691, 0x0000269D40EAD72A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x67467063713B464E, 0xDCA33EDC68428DB0, 0x4917C20661A57B84, 0x52B582717B03CD9F,
+0x5AACB0F16E06A2E6, 0xDA22213458C3610C, 0xC2692EED5026BFB4, 0x6AB90194CB04F99D,
+0x0E8733625C6742F1, 0xDB432AB46CCBAD0F, 0x4334CCFA9D9AB0F3, 0x0000147867F6FD02,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC44921A2714B384C, 0x0B3F9508A8ED91F0, 0xC7F7498106C256AE, 0x65EEB20BBC6AD342,
+0xB164E20FBB5FA083, 0x4535898A5848FB98, 0x85770D9F0FCE4926, 0x5057726D7C13BB5C,
+0xD45115A4770FA977, 0x7F802B78239C1584, 0x82D0D08112238D75, 0x000055F3E4855DD6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAEBCDF67410EB7B0, 0x6D092AB322B96FEB, 0xF55B5330757C38E0, 0x872CEE821B36D1BF,
+0xCFF58DAF55A312EB, 0xBBC1732D0B84307C, 0x0865B11F2748091C, 0xBD897CB2A711C850,
+0x88DE6D7F05908B38, 0xE7A59548A6E85922, 0x1908160AD297ED48, 0x0000127D653CD523,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA3FD8B17704B3BA6, 0xE546B29833E3FA7A, 0xDF9DE1C7538177A1, 0x82C050D75AD98B58,
+0xD33FD640ED8C1DF8, 0x302AF39F3D51C036, 0x99719FCDCE53DC41, 0x9C5E6ABBA6251DA0,
+0x115973A2B4601AD5, 0x0DF23E0F9AFC8643, 0xB47E20F8AD958F56, 0x000008E8484084C2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA348C17745D8E6CE, 0x27B8E72546407A22, 0x106551B24A2FEBE9, 0x2CCEB108806AB498,
+0x194C9D0DA96BC60D, 0x5DC88D38B4DBA9EA, 0xA2C66C98421D2E62, 0x8AD172C84B121F39,
+0x444F564D4F2B27A1, 0x3935FAE326EED44B, 0xDE45956A95B6F430, 0x000061FC751AC992,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x1C010F7CDB60A8EE, 0xFBC10CA0F6A381DB, 0x7BD1ED97C700E0EC, 0xD587D05B23DAD609,
+0xB6E9231F7EBAC42F, 0x6CD305B5A94CF8B7, 0x625AE2B783FF0604, 0x0FD3E915BB142EE4,
+0x3ABC312F4ADB5890, 0xD97AB657A5774D0E, 0x71BDDE2071A999B0, 0x0000139AACD623DD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE5E60E96A919063E, 0xEBA452AEF0FC9E9C, 0x11792DA5A864258F, 0xF5032D105C8BA4D5,
+0x365563DB262F355B, 0xDA7B5E1216E9B2C6, 0xC1819B7A6149F4C3, 0x38A18289566EE3D5,
+0x2143CA6359D7E545, 0xED9879871545415F, 0xDC1A7F25E4B87D78, 0x00005827B5B92F40,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xBB9FE0CB5CFC26D6, 0x79A50952D7F0A06C, 0x77695B609B20F5EA, 0xCE566E7BA5843412,
+0xB99138AA984A2B34, 0x1DC8E41DA14D9394, 0x3877B262D439E01E, 0x8F583E5DD259BA8D,
+0x9AE0B189285682B9, 0xB06924EBC7712A29, 0x729C6F067B8182D5, 0x00006DD0CDD3007E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC9662E4E8AFABB72, 0x45B71D0DC5C94AC2, 0xDC6113D14A0391EA, 0xFB3546138368D3E6,
+0x99FF4B0C1F4AC85E, 0x5A301871BB12CBA2, 0xB534C8651CDCD3B9, 0x22E5E71365255FF4,
+0x499F845CF38D8561, 0x7DB02073EB298DDB, 0xB7BFD4B21F83AE88, 0x00003FFB9206D12E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE2738EB0A52BDEDC, 0x9C020112189D0DA6, 0x8E8586792C6588CD, 0x262BB463E27DB931,
+0x85901EFDEDAF8F17, 0x892F09B58F30B8C8, 0x97E5CA70E7B333AF, 0x6CCB93250ECAF3D2,
+0x61FF95CE3CAD2894, 0xF190636894DBE1CF, 0xC1F4DE271D807E26, 0x00004B56589A3180,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x14CAB3CA10398814, 0x3366EE4EF645C394, 0x942B10897F356F59, 0xE8A966232FBD398B,
+0xB215EDA7ED2EF871, 0x2DB913D546935977, 0xBE45EED737FB3947, 0x4662D70B1D303F56,
+0xAD3B367613FD7606, 0x1A99F7B411B8D29C, 0x05F2CF32895680E0, 0x0000613CBCA4F733,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAE2631A8EB41CAF7, 0x8EB1781D932AE962, 0xAE648375394408D3, 0x26234EB3C9A12570,
+0x060FF7EA02C501EA, 0xD4D4E91BC70B38C6, 0xA4AAF36D591475E3, 0x1CE3F54474C4BD91,
+0xBB5C2478B0ED6F20, 0x6AAA6E182D5A7ADC, 0x6BA15087A52D93D2, 0x00005D32E1FB4DCB,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0C32F8EF93BD7E66, 0xF4CC35A8BB73B00A, 0x4891EB97F35D3F2F, 0xF6B2BD8BA5898395,
+0xCA4600EF4D1A2A65, 0x2D468E870E84FB66, 0x9EEC64436483D043, 0x2D591CE55C5A204F,
+0xD0D01EFADB40B928, 0x72697C130FB42C86, 0x5360D90CB206C3CD, 0x00006CD468045E56,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5E57B1F8F2348A75, 0x3EFF065EF4C5CFFA, 0x60E910FC7905515E, 0xAB3222EBA381919A,
+0x497C0372126351B0, 0x6E536E595A12C6E4, 0xF338CC2176258521, 0xD1DE8D2177EC7D9C,
+0xD43714050475501C, 0x5B96BBB1A7CA61F9, 0x0B0768157BF13318, 0x00002C93B1E194C5,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0D3CAA9BED497AD4, 0xA47F61BE5433C6CB, 0xD6CBCC5F001E5A77, 0xF35CEBF99A870B9B,
+0x26542260C12CF7E1, 0xFA1A61E3818FCFED, 0x2BBDE7A002AEC4EF, 0x7FA74E0906370AE7,
+0xB74AA2C9B6F30A6D, 0x4A7F3A79EAC3F286, 0x0028267B591BBD95, 0x00006F952BC34132,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x827A14C9A145EBB3, 0x4B5DC1F9456E5BA2, 0x915F85C173E7D849, 0xC4B8BD81964681CA,
+0x4EE4D7F5EE189B33, 0x645B0E80CC4C3407, 0xEE6ABF57AD01C6D8, 0x972F175E6A4EFC6B,
+0x45ADC288E1EBCA3D, 0xBF57D2E9D7E1EE7A, 0xE9A435D36E8680F7, 0x000069CE026CA41F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9A1433C90628F98E, 0x1EF4A69B810D4FBB, 0x68C58312BC2E3AC1, 0x0D75E748B606D21E,
+0xFE7A098C7043B947, 0x57971C811AD4C6FB, 0x7C0DF886D309A9F4, 0xAB47815D189838F4,
+0x63536F793B487213, 0xE3154E0EC8E40B02, 0xB450D0244E71536C, 0x000022125BA298C2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5C68EDF48039F163, 0xC68DB4CB49A71BA2, 0x62BCFECA4BB47521, 0xBFFC98B4A724486A,
+0x61CE1EDE6FC6FDEE, 0x6680F0C08EA969E9, 0x97FE9A4240D66035, 0x25A5ED0519ECC4C5,
+0xEFC4A822FFE54436, 0x89A0F7D6EECC6D6D, 0xA79FAE1BE588DCF4, 0x00001B494C288BCC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCB2E7CE6488201B5, 0x971BBBC86299C190, 0x63E776B89C37B2CC, 0xF0C17E14C1E45CE5,
+0xA15C63BB31ACCCBD, 0x6BDD69CF82383180, 0x6B3B11263E7467A4, 0x681B18C5FA7FCC19,
+0xD884B22C16F3561E, 0xEC2C10C8A22635A2, 0xA6F7003953927A59, 0x0000267BDB478BA4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xADAFCAD7ABAB027B, 0xEB3C729E1C5A70F1, 0xB332C3B075BE24E7, 0x17F16CB00B23A098,
+0x5981267E3D0852AB, 0xA238322B446B48FA, 0xAE07677756AB1727, 0x9F952A11CDCEBD36,
+0xDE40C9217BE71A80, 0xF549E7F8DD4599E1, 0xA229B88B1F601464, 0x000047D1658F0633,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x88B1F848B655D69F, 0x48DE88BBD1B2802F, 0x97CC20D82C99D595, 0x53336442BFEBBBF6,
+0xCDA39F84DD55F997, 0x86DC7C9AA7448799, 0xEB1D351A4D9DA507, 0x79AD5E54832B59B6,
+0x6461910E50169ECB, 0x6CEE13BC98F686D5, 0x682B2AF23559E322, 0x00004FDC7067EF8C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC367385AF4C12260, 0xD6EF91946F0D211B, 0x280524351AF1350E, 0x26376BB66AD88D25,
+0x0138CFAFC2A5D597, 0x6629F0504C822B23, 0x9C5BFE73BA562709, 0x19DEDD97F5E5600A,
+0x438BB0C976D087E2, 0xC85936DFCABA895F, 0x0131BE1BD4811F69, 0x0000587800D886A6,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6A173A0DCE753018, 0x3C72612F64F13352, 0xEBECE0239A785039, 0xD5A18FD228DDF87A,
+0x21C33C9749954091, 0x9E6E9F02F57D123C, 0xF145D8F542C720B4, 0x799BF76DE09AC905,
+0xDD175F899628FCB4, 0x658C300A4628DE2A, 0xFE08F04DD53C9E52, 0x00001F49FE250C4E,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x253162527CFAED2C, 0x14B7397B5A83D35C, 0xA52B3D0D9E282C91, 0x971B59AA3596F9D3,
+0xA8F5C8BC3EFE8177, 0x1261C48204E4F0F4, 0x4A5E3D052B1D3325, 0x0A3E96E3B6B5DFF5,
+0xB8DA5E9B5BD09911, 0x5AC30FA1558246CE, 0x8B8D663E9B849A26, 0x00000B704596B74F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x537D889A1F7F53AC, 0x55C8AAEC39E373BD, 0xFD6C23D87542F739, 0x6D33150144EC2091,
+0x46100B28BDC96247, 0xDE338C95EF647AAD, 0x96D845113B351182, 0x77245881C8253AD4,
+0x27FBA839B7140EF1, 0x271CB634EBE30C1E, 0x1589911CF1E3E83A, 0x00002416939A1BB3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xC6B7ADD784538D03, 0xA256C0DB447EE798, 0x17B1E8739DCC1051, 0x138B6F3DFE236611,
+0xFA53A4D0D66384E2, 0xA40E1EDDF0DE6898, 0x72820A209CA84363, 0xEACDE3A9A43D72B4,
+0xD35FE48EBBB80568, 0x6F0A35547B0E7342, 0xFE2CFFF7F76DEB58, 0x00006194E41B47D2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9B9B12CEAF7C9E7A, 0x129BAD3D7BB3958F, 0x4E5FC1CEB16D329B, 0x33648BFF98FE15E6,
+0x5C71FA5C210D76F1, 0x7FCC77728919980E, 0x70822C407EAD3CB5, 0xF9CA7F99F0A7B18B,
+0x66937B39DCAF6002, 0x59A4FB8DC06BC0F2, 0x8C997ED22AFC21AC, 0x000040957FCA8980,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xE706E64B791F0BC6, 0xA7065C0271DBB78A, 0x353D4EDBE60A15FD, 0xA01A0D6F34DA64A1,
+0x5F2990E40A7057AF, 0x5680F988D6B176BF, 0xE05E09751D0301C5, 0xDED441A7A578CDFE,
+0x69FA15F6B58AD1A9, 0xED0CCCEC520B2FCE, 0x6424DF8AE7296F7C, 0x0000657C16957E77,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xDD410B15D0D5F599, 0x6924F629767E782B, 0x57D41111C31DB30E, 0x8A92C1BAA5FA411C,
+0xF9DB23A1E1515FDC, 0x06CCF7D376CAA49A, 0xD7B21C9D315AA218, 0x8CA44B39E56B0E83,
+0xBCFDBF4099DEAD17, 0x12D7C61CB1CECC74, 0x24202AB2C8E2E72C, 0x00006889EC714536,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xA26ADB9FA3F13EB7, 0x5D3027954BEAEC97, 0x9B5559EA4ABC1C29, 0x1F7C2DCF22957CF9,
+0xD827F299E85F2C10, 0x2280219D7F4F6925, 0x021B9FEC2F246572, 0x77A99BF2B15F176D,
+0xDCC0363AF8433859, 0x1EAA120B53880E11, 0x5ED293E2135FC511, 0x00001B13F79BF788,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x156371FC3F62AC9D, 0x2711B45C46EDC09A, 0x4987FB242CAB5677, 0x7BA92FEB955CB931,
+0x8518280ECD62F302, 0x8545F1772FF96B19, 0x4775EB11E964E9CF, 0x3882C3F514D9729E,
+0xE88E9EC784FBCC1A, 0x07F7CFBBD8917570, 0x0E77B987FF82667E, 0x00003B8A087CBBFC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0A2ED6EB40C8E096, 0x62DE64BE58575BAD, 0xC1211EB259521E6E, 0xAF0AF7A286E950B8,
+0xE08E81991B568CC3, 0x32ECC95B0859A505, 0x6B50FCE5C6E5C5F2, 0xBD1ED04A70406EE6,
+0x76025520E7AE9BBC, 0x4BD5CBC62C992E22, 0x460349AC0D0D51BB, 0x000066629650EFB3,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x52B48D9BC5802E10, 0xA7843B4A5002EE29, 0xB44F257E85B21D25, 0x5250F66A412F7467,
+0xF266D5CF1CC0AA11, 0x60AD0F01FADA7843, 0xF986B442C5B11224, 0x05E55CAFA3BB178F,
+0xC2120A758CA63808, 0x800088BB3AF7444A, 0x6863E8D6B2F98A93, 0x000051D2E2E97FC9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6037C4FC8BE96E5D, 0x84B47B099018B76D, 0xAB2E16F259356240, 0x4D45114FEC0385E2,
+0x63BE7ED0BF8160C0, 0x3FA9AC2FCE6AE37E, 0xDA7B5938045C95EF, 0xEE863ECD7429702A,
+0x63F90942820A5A63, 0x4708CDE92EE12843, 0x3EAF71AB88F71BB2, 0x00005E6A2D0CFF1C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAC47044C89BF71EC, 0x8F56CE98C71ECE3B, 0xB9527C3A73A392AB, 0x65B471B73E8AA1A8,
+0x0EB70CDE9D36A4F9, 0x5FF75C9C2A5603A8, 0xE114AF1205E6BCA2, 0xE04019CA58162D34,
+0xCCBFBA95814C57D5, 0xC55CB5BDB1503DE6, 0x0D295B48561201B1, 0x00005DC8A8C7CAE4,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x50D15886E823FB96, 0x2C8499C1479E85CD, 0x9DFF39D6E2053159, 0x9134D369A5D239E6,
+0xF214417F1271BDA5, 0xDD248EB1F4C11A83, 0x8AE29231901E18FE, 0xEBC7983516BC9FDB,
+0x6C2215BF5C239050, 0xC79A22A6EEED129F, 0x61EF73C5E3DC11B5, 0x000033A11CC754CD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x6901A944EFF2E99C, 0x2C0A9017EC60AC51, 0x285DBB6884DD20FA, 0xC3E7A58A487EA833,
+0xAD114713123EF6CB, 0x97A511474E0FA42A, 0x5171CA759583CB25, 0x2A24DCD0A0AB402E,
+0xFC741CAA12076906, 0xCD2971AA445D3A0F, 0x68C4CE91F4FB86C1, 0x00004836A316C595,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x52B1FA9C057F5317, 0xC8365FACD725A56B, 0xB30F49D4472865B6, 0x56537BE87C73BC23,
+0x385A2BB471637CF1, 0x08DF8219277AD415, 0x246E4D7EDDEABE5A, 0xB9B6C7DE04B50919,
+0xA1AAF8ACE8BFEE13, 0xB7A23985A5D5A118, 0x37E58F73D2792BF4, 0x0000522BA652A1FA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x41A1550DD73071FC, 0x943B56E4E0D0AA70, 0x7E576216208A6CD2, 0xBBDB7F3E4F9AF41A,
+0xEF33B4D12BA85E04, 0x6A76D52B836508DA, 0xC6D981F5A871BA98, 0x220A50E1D08E899F,
+0xC9C59245C6BAAC34, 0xB0841D601020D9D1, 0xEB7C096638D82DF8, 0x0000019DAFF66BA2,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x3B1E22AB86CBE9D0, 0x5A7C1A891678DF97, 0xB19B2BE42FB50A75, 0x9709DD1311981E17,
+0xFB7A6CA6E8BDE311, 0xCEC1FEC845384293, 0x7E028D8E92694B2E, 0x270A91F8B66D376F,
+0xC75ECF600066AC92, 0x99615BB07010A10C, 0xFE96B24443964B10, 0x00002E06AA3495A9,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xB230343C361A34F5, 0x986A66A05E603BC5, 0x8D230282B7996FEC, 0x354DFA257473297A,
+0xD8E13168CA08CDE0, 0x6B5669CC00D2FAF9, 0x7DF4F8A54EB2FD73, 0xE1EFD8002CD9B327,
+0x37453534376F3D0B, 0xEDEC52539C84316E, 0xCDA00696D5154948, 0x0000227389B3763C,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xAD55D10D808AF35D, 0x6EBAB8B7E2F8A105, 0xC1A7A920AF29F9AD, 0x926D52758EB6BC0D,
+0x55874986114BAD29, 0xAD7C337AED248242, 0x31E6881F1B2DA90C, 0x11A90EC0168E87C4,
+0x99894CE5102174A8, 0x4909CDB4C34A6D5F, 0x1F521C63CFE447F8, 0x00001E8A3E92A6E1,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x8B8DD0731EA09180, 0x6925FD1718AB75FA, 0x8DC0BC16E83E95C6, 0xD18D77B051D5AB82,
+0xF09309F8BAFA1CCB, 0x477D55DD31066645, 0x5F7588A1BC94D8CD, 0x64D0B5D528A3DEAA,
+0xC0C3FAC33F42AA0A, 0xDC5646F5A3BFB7D5, 0x0BACF6BB2CA36689, 0x00002AF850708882,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x9FB4E1CAA0168D3A, 0x898BF4ADC071CFC5, 0xB6B880F1938FC347, 0x4B60023E3804007E,
+0xB8D5934CF932DA66, 0x02A59DC140D6DFC3, 0x2A134EBD6938D494, 0x3C90B77116FD2C13,
+0x0AD0E78E3E7C4C5B, 0x0B1F85B175F23378, 0xD78712490174D41D, 0x00004C62A3C3EB7F,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x102CA39F052B9B84, 0xBD67A8BD756EB9F2, 0xB6487B7C4FC378F6, 0xA91D345FB4BE5085,
+0x9BB0CFBA32919021, 0xE5E27A96CEEAF5B8, 0x35C2F6267F9C358D, 0xA41FF63CBE4AD1B6,
+0xC7B802EAFC02EA2F, 0x71967DA3CEA71A80, 0x2C2A2501BCE92BF8, 0x000036C68E07CDEA,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0B53843D8254FCE1, 0x3CEACDD0FC72ACA0, 0x5D44CCB681C0A07F, 0x640D8A55190FB197,
+0x0511428D3CC052CC, 0x6A5A3FB380E95D7E, 0xC2178EAF5234BCB1, 0x73926850A73323FF,
+0x4DD0CE4C76FC4B65, 0xAFB9AB029453B07C, 0x13E9D5A0731DC91F, 0x000006A858AA391A,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x4A4EBE98E64E36C8, 0x709EC82D29E63880, 0x5ECC91DB9D15C8F1, 0xB5CE1B8C1E810ADC,
+0x64CE61CC5DF69A07, 0x308B09E7E62F904E, 0xF6223B562811533D, 0xAFCC3B622116F59F,
+0x288EBBE15068A85E, 0xB6A461E26352874A, 0xF79A2EB5084A7BA3, 0x000058B1C9F04520,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD9917EC0711F6216, 0xC05DCC520D4EE1F0, 0xE04A016FC0898199, 0x48A084901949DBB1,
+0x7D3275B096EB35C8, 0xBC4A7674300E1D7D, 0x82CAC7F99F3ECD73, 0x8E609D25A6DCCF8C,
+0xE5EF6AB68C0D9DEA, 0xAA0A914D586D9CD5, 0xB6BBD8683B17F6DF, 0x000041397FD6BD57,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xD49B3113CCCE0843, 0x50C38CC2718F1529, 0xFD482EF30CFFE34F, 0x32D2B14DC7560D20,
+0xB886576B89075ADC, 0x43536180A21D1104, 0xB1E03B84BDBA6DF1, 0xE0F249A294F925D8,
+0x9E3135542455958E, 0x3B7E22A756C5C214, 0x8B3F3A9259470E01, 0x00006FD887B58E96,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5CB07BDDAE0E1FCA, 0x51F4E2679B46A793, 0xFBFFC0FF936AB068, 0xD14982254C65D977,
+0x9BF5350D288316B1, 0x689160418C31BD53, 0xE333D9063BA96254, 0x37BEBF62D70BDCE5,
+0x25A518C878E96581, 0x9D8B186FB71D415D, 0x59FAEDF5EA354ECC, 0x00002EAD26F5FECD,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x2CCA28A18E1E3316, 0x94300FA707F38FDA, 0x364708B27754D61A, 0x93647A78A94A34F2,
+0x77F152D864AF990E, 0x40EAA1048B46203E, 0x7F0FDF67F493447A, 0xAC999BA78846984E,
+0x0976DB6FC9AF65D5, 0x3A9F64CC01DBAF23, 0x4611577229247408, 0x0000313AFA40DEEC,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x5D9A2DD8F913F570, 0x6AFF410F31257194, 0x22763C370D3793C8, 0x80E1964330DFA7D8,
+0xD0F77DC3DC29DED1, 0x7A04DBF434F52AF6, 0xE9604C5DBE1C9C31, 0x7A9C0F56DB6C2FF3,
+0x342564D46B90AFA8, 0x034E02A71AE42828, 0xF23A382F3AEAD466, 0x00001DF25430F567,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xF8DE020734E1B651, 0xFF9A03D04D96E901, 0xAD1DBCD40860F6EB, 0xD76A4C9ABBBACF08,
+0x477BA82B802C813E, 0xBA8BC193B42CBF26, 0xECCF2D53D8D13FF8, 0xFA8D123F26636792,
+0x27ABEC580DE706F4, 0x471DFCABFDA883B3, 0x57E5D47FCE062901, 0x0000105970D9153D,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x7E4B9A7EE8C200C3, 0xE02B3101B75EA957, 0xB1CA7410DF8CD5FE, 0xEC41D4FC4F90B33B,
+0x2F81E3B9E7C48A5A, 0x573FDBF65A39AB14, 0x4BFFFEE1F423C1B5, 0x25D690F72A4AE3BB,
+0xA4C6D96575E5673D, 0x336B1D2330E0FE9A, 0x0C4169A81689D770, 0x00000C80B942CDAF,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x79AC19878B21A767, 0x5C6E54BD0244A64A, 0x187FB0C2968442AE, 0x319E02D3A3F6D2E9,
+0x4D498FEFB047D513, 0x4837350C32593898, 0xB8B0672CA8056F10, 0xA017324128C76B39,
+0xCF04D536C230FD35, 0xABC8851DCA78CA76, 0xF2C29E338B077925, 0x000001DA3762DD2B,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0xCFA8E12AF7DC81DB, 0x9EA53FC8B23775B1, 0xE995D5892147E830, 0x70D1B1F81EF825DE,
+0xBA0DE3C7EDAC5EC2, 0x4550295665CC49B4, 0x70345E831F651B82, 0xA954A7B3BC329FB3,
+0x44EAA1456132F63F, 0x36E729EB372598EA, 0x613F29AF9754BD70, 0x0000238B61695D70,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000,
+0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000 };
@@ -15,5 +15,17 @@ void shake256_absorb(uint64_t *s, const unsigned char *input, unsigned int input
 void shake256_squeezeblocks(unsigned char *output, unsigned long long nblocks, uint64_t *s);
 void shake256(unsigned char *output, unsigned long long outlen, const unsigned char *input,  unsigned long long inlen);
 
+// Incremental SHAKE256: init, absorb any number of pieces, finalize, then squeeze any number of times.
+// pos is the number of bytes absorbed into, or squeezed from, the current block
+typedef struct {
+    uint64_t s[25];
+    unsigned int pos;
+} shake256_inc_state;
+
+void shake256_inc_init(shake256_inc_state *state);
+void shake256_inc_absorb(shake256_inc_state *state, const unsigned char *input, unsigned long long inlen);
+void shake256_inc_finalize(shake256_inc_state *state);
+void shake256_inc_squeeze(unsigned char *output, unsigned long long outlen, shake256_inc_state *state);
+
 
 #endif
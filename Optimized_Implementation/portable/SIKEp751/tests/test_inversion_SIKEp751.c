@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp751
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P751/P751.c"
+
+
+#define SCHEME_NAME       "SIKEp751"
+#define fprandom_test     fprandom751_test
+#define fp2random_test    fp2random751_test
+
+
+#include "test_inversion.c"
@@ -0,0 +1,16 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the fixed-base three-point ladder for SIKEp751
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P751/P751.c"
+
+
+#define SCHEME_NAME    "SIKEp751"
+
+
+#include "test_ladder.c"
@@ -6,6 +6,11 @@
 
 #include <string.h>
 #include "sha3/fips202.h"
+#if defined(_AVX2_KECCAK_)
+    #include "sha3/fips202x4.h"
+#endif
+
+#define KEM_BATCH_SIZE    4    // Number of batch operations whose hashes are computed together
 
 
 int crypto_kem_keypair(unsigned char *pk, unsigned char *sk)
@@ -35,12 +40,16 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     unsigned char ephemeralsk[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant[FP2_ENCODED_BYTES] = {0};
     unsigned char h[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};
+    unsigned char m[MSG_BYTES];
+    shake256_inc_state state;
 
     // Generate ephemeralsk <- G(m||pk) mod oB 
-    randombytes(temp, MSG_BYTES);    
-    memcpy(&temp[MSG_BYTES], pk, CRYPTO_PUBLICKEYBYTES);        
-    shake256(ephemeralsk, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    randombytes(m, MSG_BYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m, MSG_BYTES);
+    shake256_inc_absorb(&state, pk, CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ephemeralsk, SECRETKEY_B_BYTES, &state);
     FormatPrivKey_B(ephemeralsk);
     
     // Encrypt
@@ -48,12 +57,15 @@ int crypto_kem_enc(unsigned char *ct, unsigned char *ss, const unsigned char *pk
     EphemeralSecretAgreement_B(ephemeralsk, pk, jinvariant);  
     shake256(h, MSG_BYTES, jinvariant, FP2_ENCODED_BYTES);          
     for (int i = 0; i < MSG_BYTES; i++) {
-        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = temp[i] ^ h[i];
+        ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] = m[i] ^ h[i];
     }
 
     // Generate shared secret ss <- H(m||ct)
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);      
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m, MSG_BYTES);
+    shake256_inc_absorb(&state, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &state);
 
     return 0;
 }
@@ -66,7 +78,8 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
   // Outputs: shared secret ss                      (CRYPTO_BYTES bytes)
     unsigned char ephemeralsk_[SECRETKEY_B_BYTES] = {0};
     unsigned char jinvariant_[FP2_ENCODED_BYTES + 2*FP2_ENCODED_BYTES + SECRETKEY_A_BYTES] = {0}, h_[MSG_BYTES];
-    unsigned char temp[CRYPTO_CIPHERTEXTBYTES + MSG_BYTES] = {0};   
+    unsigned char m_[MSG_BYTES];
+    shake256_inc_state state;
     unsigned char* tphiBKA_t = &jinvariant_[FP2_ENCODED_BYTES];
     
     // Decrypt 
@@ -74,22 +87,188 @@ int crypto_kem_dec(unsigned char *ss, const unsigned char *ct, const unsigned ch
     shake256(h_, MSG_BYTES, jinvariant_, FP2_ENCODED_BYTES);   
     
     for (int i = 0; i < MSG_BYTES; i++) {
-        temp[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
+        m_[i] = ct[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[i];                         
     }     
     
     // Generate ephemeralsk_ <- G(m||pk) mod oB
-    memcpy(&temp[MSG_BYTES], &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);            
-    shake256(ephemeralsk_, SECRETKEY_B_BYTES, temp, MSG_BYTES + CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m_, MSG_BYTES);
+    shake256_inc_absorb(&state, &sk[MSG_BYTES + SECRETKEY_A_BYTES], CRYPTO_PUBLICKEYBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ephemeralsk_, SECRETKEY_B_BYTES, &state);
     FormatPrivKey_B(ephemeralsk_);
     
     // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
     // No need to recompress, just check if x(phi(P) + t*phi(Q)) == x((a0 + t*a1)*R1 + (b0 + t*b1)*R2)    
     int8_t selector = validate_ciphertext(ephemeralsk_, ct, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], tphiBKA_t);
     // If ct validation passes (selector = 0) then do ss = H(m||ct), otherwise (selector = -1) load s to do ss = H(s||ct)
-    ct_cmov(temp, sk, MSG_BYTES, selector);
-    memcpy(&temp[MSG_BYTES], ct, CRYPTO_CIPHERTEXTBYTES);  
-    shake256(ss, CRYPTO_BYTES, temp, CRYPTO_CIPHERTEXTBYTES + MSG_BYTES);
+    ct_cmov(m_, sk, MSG_BYTES, selector);
+    shake256_inc_init(&state);
+    shake256_inc_absorb(&state, m_, MSG_BYTES);
+    shake256_inc_absorb(&state, ct, CRYPTO_CIPHERTEXTBYTES);
+    shake256_inc_finalize(&state);
+    shake256_inc_squeeze(ss, CRYPTO_BYTES, &state);
 
     return 0;
 }
 
+static void shake256_batch(unsigned char** out, unsigned long long outlen, const unsigned char** in, unsigned long long inlen, 
+                           const unsigned char** in2, unsigned long long inlen2, const unsigned int n)
+{ // out[j] <- SHAKE256(in[j]||in2[j]) for j = 0..n-1, or SHAKE256(in[j]) if in2 = NULL. The inputs are absorbed in place
+  // Four at a time with the 4-way AVX2 SHAKE256 when it is enabled. Groups of two or three messages are padded by hashing 
+  // their last message again into the same output
+    shake256_inc_state state;
+    unsigned int j = 0;
+
+#if defined(_AVX2_KECCAK_)
+    shake256x4_inc_state state4;
+    unsigned int j2, j3;
+
+    if (__builtin_cpu_supports("avx2")) {
+        for (; j + 1 < n; j += 4) {
+            j2 = (j + 2 < n) ? j + 2 : n - 1;
+            j3 = (j + 3 < n) ? j + 3 : n - 1;
+            shake256x4_inc_init(&state4);
+            shake256x4_inc_absorb(&state4, in[j], in[j+1], in[j2], in[j3], inlen);
+            if (in2 != NULL) {
+                shake256x4_inc_absorb(&state4, in2[j], in2[j+1], in2[j2], in2[j3], inlen2);
+            }
+            shake256x4_inc_finalize(&state4);
+            shake256x4_inc_squeeze(out[j], out[j+1], out[j2], out[j3], outlen, &state4);
+        }
+    }
+#endif
+    for (; j < n; j++) {
+        shake256_inc_init(&state);
+        shake256_inc_absorb(&state, in[j], inlen);
+        if (in2 != NULL) {
+            shake256_inc_absorb(&state, in2[j], inlen2);
+        }
+        shake256_inc_finalize(&state);
+        shake256_inc_squeeze(out[j], outlen, &state);
+    }
+}
+
+
+int crypto_kem_keypair_batch(unsigned int n, unsigned char *pk, unsigned char *sk)
+{ // SIKE's key generation of n key pairs
+  // Outputs: n secret keys sk (n*CRYPTO_SECRETKEYBYTES bytes)
+  //          n public keys pk (n*CRYPTO_PUBLICKEYBYTES bytes)
+    unsigned int i;
+
+    for (i = 0; i < n; i++) {
+        crypto_kem_keypair(pk + i*CRYPTO_PUBLICKEYBYTES, sk + i*CRYPTO_SECRETKEYBYTES);
+    }
+
+    return 0;
+}
+
+
+int crypto_kem_enc_batch(unsigned int n, unsigned char *ct, unsigned char *ss, const unsigned char *pk)
+{ // SIKE's encapsulation under n public keys using compression
+  // The encapsulations are processed in groups of KEM_BATCH_SIZE whose hashes are computed together
+  // Input:   n public keys pk          (n*CRYPTO_PUBLICKEYBYTES bytes)
+  // Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes)
+  //          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes)
+    unsigned char ephemeralsk[KEM_BATCH_SIZE][SECRETKEY_B_BYTES] = {{0}};
+    unsigned char jinvariant[KEM_BATCH_SIZE][FP2_ENCODED_BYTES] = {{0}};
+    unsigned char h[KEM_BATCH_SIZE][MSG_BYTES];
+    unsigned char msg[KEM_BATCH_SIZE][MSG_BYTES];
+    const unsigned char *in[KEM_BATCH_SIZE], *in2[KEM_BATCH_SIZE];
+    unsigned char *out[KEM_BATCH_SIZE], *ctj;
+    unsigned int i, j, k, m;
+
+    for (k = 0; k < n; k += m) {
+        m = (n - k < KEM_BATCH_SIZE) ? n - k : KEM_BATCH_SIZE;
+
+        // Generate ephemeralsk <- G(m||pk) mod oB 
+        for (j = 0; j < m; j++) {
+            randombytes(msg[j], MSG_BYTES);
+            in[j] = msg[j];
+            in2[j] = pk + (k+j)*CRYPTO_PUBLICKEYBYTES;
+            out[j] = ephemeralsk[j];
+        }
+        shake256_batch(out, SECRETKEY_B_BYTES, in, MSG_BYTES, in2, CRYPTO_PUBLICKEYBYTES, m);
+
+        // Encrypt
+        for (j = 0; j < m; j++) {
+            ctj = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            FormatPrivKey_B(ephemeralsk[j]);
+            EphemeralKeyGeneration_B_extended(ephemeralsk[j], ctj, 1);
+            EphemeralSecretAgreement_B(ephemeralsk[j], pk + (k+j)*CRYPTO_PUBLICKEYBYTES, jinvariant[j]);
+            in[j] = jinvariant[j];
+            out[j] = h[j];
+        }
+        shake256_batch(out, MSG_BYTES, in, FP2_ENCODED_BYTES, NULL, 0, m);
+        for (j = 0; j < m; j++) {
+            ctj = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            for (i = 0; i < MSG_BYTES; i++) {
+                ctj[i + PARTIALLY_COMPRESSED_CHUNK_CT] = msg[j][i] ^ h[j][i];
+            }
+
+            // Generate shared secret ss <- H(m||ct)
+            in[j] = msg[j];
+            in2[j] = ctj;
+            out[j] = ss + (k+j)*CRYPTO_BYTES;
+        }
+        shake256_batch(out, CRYPTO_BYTES, in, MSG_BYTES, in2, CRYPTO_CIPHERTEXTBYTES, m);
+    }
+
+    return 0;
+}
+
+
+int crypto_kem_dec_batch(unsigned int n, unsigned char *ss, const unsigned char *ct, const unsigned char *sk)
+{ // SIKE's decapsulation of n ciphertexts under the same secret key using compression
+  // The ciphertexts are processed in groups of KEM_BATCH_SIZE whose hashes are computed together. Implicit rejection
+  // is decided for each ciphertext
+  // Input:   secret key sk             (CRYPTO_SECRETKEYBYTES bytes)
+  //          n ciphertext messages ct  (n*CRYPTO_CIPHERTEXTBYTES bytes) 
+  // Outputs: n shared secrets ss       (n*CRYPTO_BYTES bytes)
+    unsigned char ephemeralsk_[KEM_BATCH_SIZE][SECRETKEY_B_BYTES] = {{0}};
+    unsigned char jinvariant_[KEM_BATCH_SIZE][FP2_ENCODED_BYTES + 2*FP2_ENCODED_BYTES + SECRETKEY_A_BYTES] = {{0}};
+    unsigned char h_[KEM_BATCH_SIZE][MSG_BYTES];
+    unsigned char m_[KEM_BATCH_SIZE][MSG_BYTES];
+    const unsigned char *in[KEM_BATCH_SIZE], *in2[KEM_BATCH_SIZE], *ctj;
+    unsigned char *out[KEM_BATCH_SIZE];
+    unsigned int i, j, k, m;
+
+    for (k = 0; k < n; k += m) {
+        m = (n - k < KEM_BATCH_SIZE) ? n - k : KEM_BATCH_SIZE;
+
+        // Decrypt 
+        for (j = 0; j < m; j++) {
+            EphemeralSecretAgreement_A_extended(sk + MSG_BYTES, ct + (k+j)*CRYPTO_CIPHERTEXTBYTES, jinvariant_[j], 1);
+            in[j] = jinvariant_[j];
+            out[j] = h_[j];
+        }
+        shake256_batch(out, MSG_BYTES, in, FP2_ENCODED_BYTES, NULL, 0, m);
+        for (j = 0; j < m; j++) {
+            ctj = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            for (i = 0; i < MSG_BYTES; i++) {
+                m_[j][i] = ctj[i + PARTIALLY_COMPRESSED_CHUNK_CT] ^ h_[j][i];
+            }
+
+            // Generate ephemeralsk_ <- G(m||pk) mod oB
+            in[j] = m_[j];
+            in2[j] = &sk[MSG_BYTES + SECRETKEY_A_BYTES];
+            out[j] = ephemeralsk_[j];
+        }
+        shake256_batch(out, SECRETKEY_B_BYTES, in, MSG_BYTES, in2, CRYPTO_PUBLICKEYBYTES, m);
+
+        // Generate shared secret ss <- H(m||ct), or output ss <- H(s||ct) in case of ct verification failure
+        for (j = 0; j < m; j++) {
+            ctj = ct + (k+j)*CRYPTO_CIPHERTEXTBYTES;
+            FormatPrivKey_B(ephemeralsk_[j]);
+            int8_t selector = validate_ciphertext(ephemeralsk_[j], ctj, &sk[MSG_BYTES + SECRETKEY_A_BYTES + CRYPTO_PUBLICKEYBYTES], &jinvariant_[j][FP2_ENCODED_BYTES]);
+            // If ct validation passes (selector = 0) then do ss = H(m||ct), otherwise (selector = -1) load s to do ss = H(s||ct)
+            ct_cmov(m_[j], sk, MSG_BYTES, selector);
+            in[j] = m_[j];
+            in2[j] = ctj;
+            out[j] = ss + (k+j)*CRYPTO_BYTES;
+        }
+        shake256_batch(out, CRYPTO_BYTES, in, MSG_BYTES, in2, CRYPTO_CIPHERTEXTBYTES, m);
+    }
+
+    return 0;
+}
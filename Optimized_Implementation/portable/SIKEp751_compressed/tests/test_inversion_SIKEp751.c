@@ -0,0 +1,18 @@
+/********************************************************************************************
+* Supersingular Isogeny Key Encapsulation Library
+*
+* Abstract: testing/benchmarking the field inversions for SIKEp751_compressed
+*********************************************************************************************/ 
+
+#include <stdio.h>
+#include <string.h>
+#include "test_extras.h"
+#include "../P751/P751_compressed.c"
+
+
+#define SCHEME_NAME       "SIKEp751_compressed"
+#define fprandom_test     fprandom751_test
+#define fp2random_test    fp2random751_test
+
+
+#include "test_inversion.c"
@@ -35,11 +35,11 @@ void ostoi(const unsigned char *to_dec, size_t to_decLen, mp dec);
  *
  * @param to_dec
  * @param to_decLen
+ * @param p Finite field parameters
  * @param dec
- * @param p
- * @return
+ * @return 1 if the decoded integer is not smaller than the modulus, 0 otherwise
  */
-int ostofp(const unsigned char *to_dec, size_t to_decLen, const mp p, mp dec);
+int ostofp(const unsigned char *to_dec, size_t to_decLen, const ff_Params *p, mp dec);
 
 
 
@@ -51,11 +51,11 @@ int ostofp(const unsigned char *to_dec, size_t to_decLen, const mp p, mp dec);
  * Octet-string-to-field-p^2-element conversion
  * @param to_dec
  * @param to_decLen
+ * @param p Finite field parameters
  * @param dec
- * @param p
- * @return
+ * @return 1 if one of the decoded integers is not smaller than the modulus, 0 otherwise
  */
-int ostofp2(const unsigned char *to_dec, size_t to_decLen, const mp p, fp2* dec);
+int ostofp2(const unsigned char *to_dec, size_t to_decLen, const ff_Params *p, fp2* dec);
 
 /**
  * Field-p2-to-octet-string conversion (encoding).
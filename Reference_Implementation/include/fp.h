@@ -19,8 +19,48 @@ Prime field F_p arithmetic API
  */
 typedef mpz_t mp;
 
+/**
+ * Available finite field backends
+ */
+typedef enum {
+  FP_BACKEND_GMP,   // mpz_t arithmetic, reduced with a division after every operation
+  FP_BACKEND_MONT   // Fixed-width limbs in Montgomery representation
+} fp_backend_t;
+
+/**
+ * Maximum number of limbs of a modulus supported by the Montgomery backend (up to 768 bits)
+ */
+#define FP_MONT_MAX_LIMBS ((768 + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS)
+
+/**
+ * Precomputed constants of the Montgomery backend, R = 2^(n*GMP_NUMB_BITS)
+ */
+typedef struct {
+  // Number of limbs of the modulus
+  size_t n;
+
+  // -p^-1 mod 2^GMP_NUMB_BITS
+  mp_limb_t pinv;
+
+  // The modulus p
+  mp_limb_t p[FP_MONT_MAX_LIMBS];
+
+  // R mod p, i.e. 1 in Montgomery representation
+  mp_limb_t one[FP_MONT_MAX_LIMBS];
+
+  // R^2 mod p
+  mp_limb_t r2[FP_MONT_MAX_LIMBS];
+
+  // R^3 mod p
+  mp_limb_t r3[FP_MONT_MAX_LIMBS];
+} ff_Mont;
+
 /**
  * Finite field parameters and arithmetic, given the modulus.
+ *
+ * Field elements are held in a backend-specific representation, which only the functions of the vtable
+ * know about. Integers (private keys, exponents, the modulus itself) are always plain `mp` values.
+ * `fromInt` and `toInt` convert between both.
  */
 typedef struct _ff_Params ff_Params;
 
@@ -29,6 +69,12 @@ struct _ff_Params {
   /* The modulus */
   mp mod;
 
+  /* Backend of the arithmetic below */
+  fp_backend_t backend;
+
+  /* Constants of the Montgomery backend, unused by the GMP backend */
+  ff_Mont mont;
+
   void ( *init )(const ff_Params *p, mp a);
 
   void ( *add )(const ff_Params *p, const mp a, const mp b, mp c);
@@ -63,6 +109,10 @@ struct _ff_Params {
 
   void ( *zero )(const ff_Params *p, mp a);
 
+  void ( *fromInt )(const ff_Params *p, const mp a, mp b);
+
+  void ( *toInt )(const ff_Params *p, const mp a, mp b);
+
 };
 
 /**
@@ -72,6 +122,16 @@ struct _ff_Params {
 void
 set_gmp_fp_params(ff_Params *params);
 
+/**
+ * Initializes the Finite field parameters with the fixed-width Montgomery implementation.
+ * The modulus `params->mod` has to be set beforehand, it is used to precompute the Montgomery constants.
+ * Elements are still stored in `mp`, but hold a*R mod p and are operated on limb-wise with the
+ * mpn functions of GMP: no allocation and no division in the field operations.
+ * @param params Finite field parameters to be initialized.
+ */
+void
+set_mont_fp_params(ff_Params *params);
+
 /**
  * Imports a string to a multi-precision type
  */
@@ -180,7 +240,7 @@ fp_Invert(const ff_Params *p, const mp a, mp b);
  * Checks if the i'th bit is set
  *
  * @param p Finite field parameters
- * @param a
+ * @param a Integer (e.g. a private key), not a field element
  * @param i index
  * @return 1 if i'th bit in a is set, 0 otherwise
  */
@@ -224,7 +284,7 @@ fp_Negative(const ff_Params *p, const mp a, mp b);
  *
  * @param p Finite field parameters
  * @param a
- * @param b
+ * @param b Integer exponent
  * @param c = a^b (mod p)
  */
 void
@@ -278,6 +338,26 @@ fp_Unity(const ff_Params *p, mp b);
 void
 fp_Zero(const ff_Params *p, mp a);
 
+/**
+ * Conversion of an integer to a field element
+ *
+ * @param p Finite field parameters
+ * @param a Integer in {0, ..., p->modulus - 1}
+ * @param b Field element representing `a`
+ */
+void
+fp_FromInt(const ff_Params *p, const mp a, mp b);
+
+/**
+ * Conversion of a field element to an integer
+ *
+ * @param p Finite field parameters
+ * @param a Field element
+ * @param b Integer in {0, ..., p->modulus - 1} represented by `a`
+ */
+void
+fp_ToInt(const ff_Params *p, const mp a, mp b);
+
 /**
  * Decodes and sets an element to an hex value
  *
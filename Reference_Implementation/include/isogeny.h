@@ -112,4 +112,166 @@ void iso_3_e(const ff_Params *p,
              mont_curve_int_t *isoE,
              mont_pt_t *isoP1,    mont_pt_t *isoP2);
 
+/**
+ * Relative costs of the steps of a strategy in the projective x-only arithmetic,
+ * in units of one fp2 multiplication (squarings are counted as multiplications).
+ */
+#define ISO_COST_DBL 6       // xDBL_proj
+#define ISO_COST_TPL 12      // xTPL_proj
+#define ISO_COST_EVAL_4 8    // eval_4_iso_proj
+#define ISO_COST_EVAL_3 6    // eval_3_iso_proj
+
+/**
+ * Computes an optimal strategy for traversing the tree of an l^(e*n)-isogeny with n leaves,
+ * where every step is an l^e-isogeny.
+ *
+ * The strategy is given as the sequence of the numbers of multiplications by l^e
+ * in the order they are done by `iso_2_e_strat()` and `iso_3_e_strat()`.
+ *
+ * @param n Number of leaves
+ * @param mulCost Cost of a multiplication by l^e
+ * @param evalCost Cost of evaluating an l^e-isogeny at a point
+ * @param strat Strategy of n-1 entries
+ */
+void iso_strategy(unsigned long n, unsigned long mulCost, unsigned long evalCost, unsigned int *strat);
+
+/**
+ * Computing and evaluating a 2^e-isogeny, following a strategy
+ * @param p Finite field parameters
+ * @param e e2 from public parameters
+ * @param strat Strategy for the e/2 4-isogenies, see `iso_strategy()`. If NULL, falls back to `iso_2_e()`.
+ * @param E E_{a,b}
+ * @param S S with exact order 2^e2 on E. May be modified internally.
+ * @param P1 P1 on E (may be NULL)
+ * @param P2 P2 on E (may be NULL)
+ * @param isoE E_{a',b')
+ * @param isoP1 P1 lifted to isoE
+ * @param isoP2 P2 lifted to isoE
+ */
+void iso_2_e_strat(const ff_Params *p,
+                   int e,
+                   const unsigned int *strat,
+                   const mont_curve_int_t *E, mont_pt_t *S,
+                   const mont_pt_t *P1, const mont_pt_t *P2,
+                   mont_curve_int_t *isoE,
+                   mont_pt_t *isoP1,    mont_pt_t *isoP2);
+
+/**
+ * Computing and evaluating a 3^e-isogeny, following a strategy
+ * @param p Finite field parameters
+ * @param e e3 from public parameters
+ * @param strat Strategy for the e 3-isogenies, see `iso_strategy()`. If NULL, falls back to `iso_3_e()`.
+ * @param E E_{a,b}
+ * @param S S with exact order 3^e3 on E. May be modified internally.
+ * @param P1 P1 on E (may be NULL)
+ * @param P2 P2 on E (may be NULL)
+ * @param isoE E_{a',b')
+ * @param isoP1 P1 lifted to isoE
+ * @param isoP2 P2 lifted to isoE
+ */
+void iso_3_e_strat(const ff_Params *p,
+                   int e,
+                   const unsigned int *strat,
+                   const mont_curve_int_t *E, mont_pt_t *S,
+                   const mont_pt_t *P1, const mont_pt_t *P2,
+                   mont_curve_int_t *isoE,
+                   mont_pt_t *isoP1,    mont_pt_t *isoP2);
+
+/**
+ * Computing the 2-isogenous curve. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param P2 Point with exact order 2 on E
+ * @param A24plus Curve constant A+2C of the 2-isogenous curve
+ * @param C24 Curve constant 4C of the 2-isogenous curve
+ */
+void curve_2_iso_proj(const ff_Params *p, const mont_proj_pt_t *P2, fp2 *A24plus, fp2 *C24);
+
+/**
+ * Evaluating a 2-isogeny at a point. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param P2 Point with exact order 2
+ * @param P Point to be lifted to the 2-isogeny, replaced by the lifted point
+ */
+void eval_2_iso_proj(const ff_Params *p, const mont_proj_pt_t *P2, mont_proj_pt_t *P);
+
+/**
+ * Computing the 4-isogenous curve. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param P4 Point with exact order 4 on E
+ * @param A24plus Curve constant A+2C of the 4-isogenous curve
+ * @param C24 Curve constant 4C of the 4-isogenous curve
+ * @param coeff 3 coefficients for `eval_4_iso_proj()`, initialized by the caller
+ */
+void curve_4_iso_proj(const ff_Params *p, const mont_proj_pt_t *P4, fp2 *A24plus, fp2 *C24, fp2 *coeff);
+
+/**
+ * Evaluating a 4-isogeny at a point. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param coeff Coefficients from `curve_4_iso_proj()`
+ * @param P Point to be lifted to the 4-isogeny, replaced by the lifted point
+ */
+void eval_4_iso_proj(const ff_Params *p, const fp2 *coeff, mont_proj_pt_t *P);
+
+/**
+ * Computing the 3-isogenous curve. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param P3 Point with exact order 3 on E
+ * @param A24minus Curve constant A-2C of the 3-isogenous curve
+ * @param A24plus Curve constant A+2C of the 3-isogenous curve
+ * @param coeff 2 coefficients for `eval_3_iso_proj()`, initialized by the caller
+ */
+void curve_3_iso_proj(const ff_Params *p, const mont_proj_pt_t *P3, fp2 *A24minus, fp2 *A24plus, fp2 *coeff);
+
+/**
+ * Evaluating a 3-isogeny at a point. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param coeff Coefficients from `curve_3_iso_proj()`
+ * @param P Point to be lifted to the 3-isogeny, replaced by the lifted point
+ */
+void eval_3_iso_proj(const ff_Params *p, const fp2 *coeff, mont_proj_pt_t *P);
+
+/**
+ * Computing and evaluating a 2^e-isogeny, following a strategy. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param e e2 from public parameters
+ * @param strat Strategy for the e/2 4-isogenies, see `iso_strategy()`
+ * @param A24plus Curve constant A+2C of E, replaced by the one of the isogenous curve
+ * @param C24 Curve constant 4C of E, replaced by the one of the isogenous curve
+ * @param S S with exact order 2^e2 on E. May be modified internally.
+ * @param pts Points on E to be lifted to the isogenous curve (may be NULL)
+ * @param npts Number of points in `pts`
+ */
+void iso_2_e_proj(const ff_Params *p,
+                  int e,
+                  const unsigned int *strat,
+                  fp2 *A24plus, fp2 *C24,
+                  mont_proj_pt_t *S,
+                  mont_proj_pt_t *pts, int npts);
+
+/**
+ * Computing and evaluating a 3^e-isogeny, following a strategy. Projective version.
+ *
+ * @param p Finite field parameters
+ * @param e e3 from public parameters
+ * @param strat Strategy for the e 3-isogenies, see `iso_strategy()`
+ * @param A24minus Curve constant A-2C of E, replaced by the one of the isogenous curve
+ * @param A24plus Curve constant A+2C of E, replaced by the one of the isogenous curve
+ * @param S S with exact order 3^e3 on E. May be modified internally.
+ * @param pts Points on E to be lifted to the isogenous curve (may be NULL)
+ * @param npts Number of points in `pts`
+ */
+void iso_3_e_proj(const ff_Params *p,
+                  int e,
+                  const unsigned int *strat,
+                  fp2 *A24minus, fp2 *A24plus,
+                  mont_proj_pt_t *S,
+                  mont_proj_pt_t *pts, int npts);
+
 #endif // ISOGENY_REF_ISOGENY_H
\ No newline at end of file
@@ -26,6 +26,14 @@ typedef struct {
   fp2 y;
 } mont_pt_t;
 
+/**
+ * Represents the x-coordinate of a point on a (Montgomery) curve in projective coordinates, x = X/Z
+ */
+typedef struct {
+  fp2 X;
+  fp2 Z;
+} mont_proj_pt_t;
+
 /**
  * Internal representation of a Montgomery curve with.
  * - Underlying finite field parameters
@@ -123,6 +131,31 @@ void public_key_clear(const ff_Params* p, sike_public_key_t* pk);
  */
 void mont_pt_copy(const ff_Params* p, const mont_pt_t* src, mont_pt_t* dst);
 
+/**
+ * Initialization of a projective point
+ *
+ * @param p Finite field parameters
+ * @param pt Point to be initialized
+ */
+void mont_proj_pt_init(const ff_Params* p, mont_proj_pt_t* pt);
+
+/**
+ * Deinitialization of a projective point
+ *
+ * @param p Finite field parameters
+ * @param pt Point to be deinitialized
+ */
+void mont_proj_pt_clear(const ff_Params* p, mont_proj_pt_t* pt);
+
+/**
+ * Copies a projective point. dst := src
+ *
+ * @param p Finite field parameters
+ * @param src Source point
+ * @param dst Destination point
+ */
+void mont_proj_pt_copy(const ff_Params* p, const mont_proj_pt_t* src, mont_proj_pt_t* dst);
+
 
 ///////////////////////////////////////////////
 // Montgomery curve arithmetic - affine version
@@ -212,6 +245,20 @@ void get_xR(const ff_Params *p,
             const mont_curve_int_t *curve,
             sike_public_key_t *pk);
 
+/**
+ * Recovers the coefficient a of the Montgomery curve y^2 = x^3 + a*x^2 + x from the x-coordinates
+ * of two points P, Q and their difference R = P-Q. Uses a single inversion and no square roots.
+ *
+ * a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ-xR
+ *
+ * @param p Finite field parameters
+ * @param xP x-coordinate of P
+ * @param xQ x-coordinate of Q
+ * @param xR x-coordinate of R = P-Q
+ * @param a Result: curve coefficient a
+ */
+void get_A(const ff_Params *p, const fp2 *xP, const fp2 *xQ, const fp2 *xR, fp2 *a);
+
 /**
  * Conversion of public key parameters to the internal affine Montgomery curve parameters.
  *
@@ -225,4 +272,108 @@ void get_yP_yQ_A_B(const ff_Params *p,
                    const sike_public_key_t *pk,
                    mont_curve_int_t *curve);
 
+//////////////////////////////////////////////////////////
+// Montgomery curve arithmetic - projective x-only version
+//////////////////////////////////////////////////////////
+
+/**
+ * Projective doubling.
+ *
+ * @param p Finite field parameters
+ * @param P Point
+ * @param A24plus Curve constant A+2C
+ * @param C24 Curve constant 4C
+ * @param R Result R=2P
+ */
+void xDBL_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24plus, const fp2 *C24, mont_proj_pt_t *R);
+
+/**
+ * Repeated projective doubling.
+ *
+ * @param p Finite field parameters
+ * @param P Point
+ * @param A24plus Curve constant A+2C
+ * @param C24 Curve constant 4C
+ * @param e Repetitions
+ * @param R Result R=2^e*P
+ */
+void xDBLe_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24plus, const fp2 *C24, int e,
+                mont_proj_pt_t *R);
+
+/**
+ * Projective tripling.
+ *
+ * @param p Finite field parameters
+ * @param P Point
+ * @param A24minus Curve constant A-2C
+ * @param A24plus Curve constant A+2C
+ * @param R Result R=3P
+ */
+void xTPL_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24minus, const fp2 *A24plus, mont_proj_pt_t *R);
+
+/**
+ * Repeated projective tripling.
+ *
+ * @param p Finite field parameters
+ * @param P Point
+ * @param A24minus Curve constant A-2C
+ * @param A24plus Curve constant A+2C
+ * @param e Repetitions
+ * @param R Result R=3^e*P
+ */
+void xTPLe_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24minus, const fp2 *A24plus, int e,
+                mont_proj_pt_t *R);
+
+/**
+ * Simultaneous projective doubling and differential addition.
+ *
+ * @param p Finite field parameters
+ * @param P Point, replaced by 2P
+ * @param Q Point, replaced by P+Q
+ * @param PQ Difference P-Q
+ * @param A24 Curve constant (a+2)/4
+ */
+void xDBLADD_proj(const ff_Params *p, mont_proj_pt_t *P, mont_proj_pt_t *Q, const mont_proj_pt_t *PQ, const fp2 *A24);
+
+/**
+ * Three-point ladder computing x(P+k*Q), given x(P), x(Q) and x(P-Q).
+ * Note: add side-channel countermeasures for production use.
+ *
+ * @param p Finite field parameters
+ * @param xP x-coordinate of P
+ * @param xQ x-coordinate of Q
+ * @param xPQ x-coordinate of P-Q
+ * @param k Scalar
+ * @param msb Most significant bit of scalar `k`
+ * @param a Curve coefficient, b = 1
+ * @param R Result R=P+k*Q
+ */
+void mont_ladder3pt(const ff_Params *p,
+                    const fp2 *xP, const fp2 *xQ, const fp2 *xPQ,
+                    const mp k, int msb,
+                    const fp2 *a,
+                    mont_proj_pt_t *R);
+
+/**
+ * J-invariant of a montgomery curve with projective coefficient a = A/C
+ *
+ * jinv = 256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2));
+ *
+ * @param p Finite field parameters
+ * @param A Projective curve coefficient A
+ * @param C Projective curve coefficient C
+ * @param jinv Result: j-invariant
+ */
+void j_inv_proj(const ff_Params *p, const fp2 *A, const fp2 *C, fp2 *jinv);
+
+/**
+ * Simultaneous inversion of three elements, using a single inversion.
+ *
+ * @param p Finite field parameters
+ * @param z1 Element, replaced by 1/z1
+ * @param z2 Element, replaced by 1/z2
+ * @param z3 Element, replaced by 1/z3
+ */
+void inv_3_way(const ff_Params *p, fp2 *z1, fp2 *z2, fp2 *z3);
+
 #endif //ISOGENY_REF_MONTGOMERY_H
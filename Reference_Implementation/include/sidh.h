@@ -88,4 +88,36 @@ void sidh_isoex(const sike_params_t *params,
                 party_t party,
                 fp2 *secret);
 
+/**
+ * Isogen with affine arithmetic, see `sidh_isogen()`.
+ * Slower reference for testing the projective version.
+ * If the strategies of `params` are NULL, the isogenies are computed with the simple quadratic traversal.
+ *
+ * @param params SIDH parameters
+ * @param pk Public key to be generated
+ * @param sk Private key, externally provided
+ * @param party `ALICE` or `BOB`
+ */
+void sidh_isogen_affine(const sike_params_t *params,
+                        sike_public_key_t *pk,
+                        const sike_private_key sk,
+                        party_t party);
+
+/**
+ * Isoex with affine arithmetic, see `sidh_isoex()`.
+ * Slower reference for testing the projective version.
+ * If the strategies of `params` are NULL, the isogenies are computed with the simple quadratic traversal.
+ *
+ * @param params SIDH parameters
+ * @param pkO Public key of the other party
+ * @param skI Own private key
+ * @param party `ALICE` or `BOB`
+ * @param secret Shared secret to be generated
+ */
+void sidh_isoex_affine(const sike_params_t *params,
+                       const sike_public_key_t *pkO,
+                       const sike_private_key skI,
+                       party_t party,
+                       fp2 *secret);
+
 #endif // ISOGENY_REF_SIDH_H
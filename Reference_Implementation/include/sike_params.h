@@ -88,6 +88,10 @@ typedef struct {
   // starting curve with generator for Bob
   mont_curve_int_t EB;
 
+  // x-coordinates of the differences P-Q of the generators for Alice and Bob
+  fp2 xRA;
+  fp2 xRB;
+
   mp p;
 
   unsigned long eA;
@@ -101,12 +105,26 @@ typedef struct {
   unsigned long msbA; // MSB of ordA
   unsigned long msbB; // MSB of ordB
 
+  fp_backend_t backend; // Finite field backend of EA and EB
+
+  // Optimal strategies for the isogeny computations, see `iso_strategy()`
+  unsigned int *stratA; // eA/2 - 1 entries, 4-isogenies
+  unsigned int *stratB; // eB - 1 entries, 3-isogenies
+
   size_t crypto_bytes;
   size_t msg_bytes;
 } sike_params_t;
 
 /**
- * Set up the parameters from provided raw parameters.
+ * Finite field backend used by `sike_setup_params()` and the cached contexts.
+ * Can be set at build time, e.g. with -DFP_BACKEND_DEFAULT=FP_BACKEND_MONT.
+ */
+#ifndef FP_BACKEND_DEFAULT
+#define FP_BACKEND_DEFAULT FP_BACKEND_GMP
+#endif
+
+/**
+ * Set up the parameters from provided raw parameters, using the default finite field backend.
  * @param raw Raw parameters
  * @param params Internal parameters to be setup.
  * @return
@@ -114,6 +132,16 @@ typedef struct {
 void
 sike_setup_params(const sike_params_raw_t *raw, sike_params_t *params);
 
+/**
+ * Set up the parameters from provided raw parameters, using a given finite field backend.
+ * @param raw Raw parameters
+ * @param backend Finite field backend
+ * @param params Internal parameters to be setup.
+ * @return
+ */
+void
+sike_setup_params_backend(const sike_params_raw_t *raw, fp_backend_t backend, sike_params_t *params);
+
 /**
  * Tears down/deinitializes the SIDH parameters
  * @param params Parameters to be teared down
@@ -122,6 +150,28 @@ sike_setup_params(const sike_params_raw_t *raw, sike_params_t *params);
 void
 sike_teardown_params(sike_params_t *params);
 
+/**
+ * Cached SIKE parameter context.
+ * A context holds the decoded parameters of one parameter set. It is set up lazily and exactly once,
+ * lives until the process exits, and is read-only afterwards, so it can be shared between threads.
+ */
+typedef struct {
+  // Raw parameters the context has been set up from
+  const sike_params_raw_t *raw;
+
+  // Decoded parameters
+  sike_params_t params;
+} sike_ctx_t;
+
+/**
+ * Returns the cached context of a parameter set, setting it up on first use.
+ * Thread-safe: concurrent first calls set up the context only once.
+ * @param raw Raw parameters, one of SIKEp434, SIKEp503, SIKEp610 or SIKEp751
+ * @return The shared context, or NULL if `raw` is not one of the built-in parameter sets
+ */
+const sike_ctx_t*
+sike_ctx_get(const sike_params_raw_t *raw);
+
 /**
  * SIKEp434 raw parameters
  */
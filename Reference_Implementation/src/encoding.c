@@ -20,13 +20,15 @@ void ostoi(const unsigned char* to_dec, size_t to_decLen, mp dec) {
   mp_import(dec, to_decLen, -1, 1, 1, 0, to_dec);
 }
 
-int ostofp(const unsigned char *to_dec, size_t np, const mp p, mp dec) {
+int ostofp(const unsigned char *to_dec, size_t np, const ff_Params *p, mp dec) {
   ostoi(to_dec, np, dec);
-  int rc = mpz_cmp(dec, p) >= 0;
+  int rc = mpz_cmp(dec, p->mod) >= 0;
+  if (!rc)
+    fp_FromInt(p, dec, dec);
   return rc;
 }
 
-int ostofp2(const unsigned char *to_dec, size_t np, const mp p, fp2* dec) {
+int ostofp2(const unsigned char *to_dec, size_t np, const ff_Params *p, fp2* dec) {
   int rc = 0;
   rc  = ostofp(to_dec,      np, p, dec->x0);
   rc |= ostofp(to_dec + np, np, p, dec->x1);
@@ -37,8 +39,12 @@ static void itoos(const mp to_enc, unsigned char* enc) {
   mp_export(enc, NULL, -1, 1, 1, 0, to_enc);
 }
 
-static void fptoos(const mp to_enc, unsigned char* enc) {
-  itoos(to_enc, enc);
+static void fptoos(const ff_Params *p, const mp to_enc, unsigned char* enc) {
+  mp t;
+  fp_Init(p, t);
+  fp_ToInt(p, to_enc, t);
+  itoos(t, enc);
+  fp_Clear(p, t);
 }
 
 static size_t get_np_len(const mp p) {
@@ -53,10 +59,11 @@ void fp2toos(const sike_params_t* params,
             const fp2* shared_sec,
             unsigned char* enc) {
 
-  size_t np = get_np_len(params->EA.ffData->mod);
+  const ff_Params *p = params->EA.ffData;
+  size_t np = get_np_len(p->mod);
 
-  fptoos(shared_sec->x0, enc     );
-  fptoos(shared_sec->x1, enc + np);
+  fptoos(p, shared_sec->x0, enc     );
+  fptoos(p, shared_sec->x1, enc + np);
 
 }
 
@@ -172,12 +179,12 @@ int ostopk(const sike_params_t *params,
                get_np_len(params->EA.ffData->mod) :
                get_np_len(params->EB.ffData->mod));
 
-  rc  = ostofp2(pk       , np, params->p, &dec->xP);
-  rc |= ostofp2(pk + 2*np, np, params->p, &dec->xQ);
-  rc |= ostofp2(pk + 4*np, np, params->p, &dec->xR);
-
   dec->ffData = (party == ALICE ? params->EA.ffData : params->EB.ffData);
 
+  rc  = ostofp2(pk       , np, dec->ffData, &dec->xP);
+  rc |= ostofp2(pk + 2*np, np, dec->ffData, &dec->xQ);
+  rc |= ostofp2(pk + 4*np, np, dec->ffData, &dec->xR);
+
   return rc;
 }
 
@@ -88,6 +88,203 @@ static void gmp_clear(const ff_Params* p, mp a) {
   mpz_clear(a);
 }
 
+static void gmp_from_int(const ff_Params *p, const mp a, mp b) {
+  (void)p;
+  mpz_set(b, a);
+}
+
+static void gmp_to_int(const ff_Params *p, const mp a, mp b) {
+  (void)p;
+  mpz_set(b, a);
+}
+
+///////////////////////////////////////////////
+// Fixed-width Montgomery backend
+//
+// Elements are stored in mpz_t as a*R mod p, R = 2^(n*GMP_NUMB_BITS), always fully reduced.
+// All arithmetic is done on stack limb arrays of n limbs with the mpn layer.
+///////////////////////////////////////////////
+
+// Reads the limbs of `a` < p into `r`, padded with zeros to n limbs
+static void mont_get(const ff_Mont *m, const mp a, mp_limb_t *r) {
+  size_t i, s = mpz_size(a);
+  const mp_limb_t *ap = mpz_limbs_read(a);
+
+  if (s > m->n)
+    s = m->n;
+
+  for (i = 0; i < s; ++i)
+    r[i] = ap[i];
+  for (; i < m->n; ++i)
+    r[i] = 0;
+}
+
+// Writes n limbs `r` to `a`
+static void mont_set(const ff_Mont *m, const mp_limb_t *r, mp a) {
+  size_t i;
+  mp_limb_t *ap = mpz_limbs_write(a, m->n);
+
+  for (i = 0; i < m->n; ++i)
+    ap[i] = r[i];
+  mpz_limbs_finish(a, m->n);
+}
+
+// r = r + cy*R mod p, for r + cy*R < 2p
+static void mont_reduce_once(const ff_Mont *m, mp_limb_t cy, mp_limb_t *r) {
+  mpn_cnd_sub_n(cy | (mpn_cmp(r, m->p, m->n) >= 0), r, r, m->p, m->n);
+}
+
+// r = t*R^-1 mod p, for t < p*R of 2n limbs. `t` is overwritten.
+static void mont_redc(const ff_Mont *m, mp_limb_t *t, mp_limb_t *r) {
+  size_t i, n = m->n;
+  mp_limb_t c, cy = 0;
+
+  for (i = 0; i < n; ++i) {
+    c = mpn_addmul_1(t + i, m->p, n, t[i] * m->pinv);
+    cy += mpn_add_1(t + i + n, t + i + n, n - i, c);
+  }
+
+  for (i = 0; i < n; ++i)
+    r[i] = t[i + n];
+  mont_reduce_once(m, cy, r);
+}
+
+// r = a*b*R^-1 mod p
+static void mont_mul_limbs(const ff_Mont *m, const mp_limb_t *a, const mp_limb_t *b, mp_limb_t *r) {
+  mp_limb_t t[2 * FP_MONT_MAX_LIMBS];
+
+  if (a == b)
+    mpn_sqr(t, a, m->n);
+  else
+    mpn_mul_n(t, a, b, m->n);
+  mont_redc(m, t, r);
+}
+
+static void mont_add(const ff_Params *p, const mp a, const mp b, mp c) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS], tb[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mont_get(&p->mont, b, tb);
+  mont_reduce_once(&p->mont, mpn_add_n(ta, ta, tb, p->mont.n), ta);
+  mont_set(&p->mont, ta, c);
+}
+
+static void mont_subtract(const ff_Params *p, const mp a, const mp b, mp c) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS], tb[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mont_get(&p->mont, b, tb);
+  mpn_cnd_add_n(mpn_sub_n(ta, ta, tb, p->mont.n), ta, ta, p->mont.p, p->mont.n);
+  mont_set(&p->mont, ta, c);
+}
+
+static void mont_negative(const ff_Params *p, const mp a, mp b) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mpn_sub_n(ta, p->mont.p, ta, p->mont.n);
+  mont_reduce_once(&p->mont, 0, ta);  // -0 = p -> 0
+  mont_set(&p->mont, ta, b);
+}
+
+static void mont_multiply(const ff_Params *p, const mp a, const mp b, mp c) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS], tb[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mont_get(&p->mont, b, tb);
+  mont_mul_limbs(&p->mont, ta, tb, ta);
+  mont_set(&p->mont, ta, c);
+}
+
+static void mont_square(const ff_Params *p, const mp a, mp b) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mont_mul_limbs(&p->mont, ta, ta, ta);
+  mont_set(&p->mont, ta, b);
+}
+
+static void mont_constant_limbs(const ff_Mont *m, unsigned long a, mp_limb_t *r) {
+  size_t i;
+  mp_limb_t t[FP_MONT_MAX_LIMBS] = { 0 };
+
+  // Constants are small integers, fitting into a limb
+  t[0] = (mp_limb_t) a;
+  for (i = 0; i < m->n; ++i)
+    r[i] = m->r2[i];
+  mont_mul_limbs(m, t, r, r);
+}
+
+static void mont_constant(const ff_Params *p, unsigned long a, mp b) {
+  mp_limb_t t[FP_MONT_MAX_LIMBS];
+
+  mont_constant_limbs(&p->mont, a, t);
+  mont_set(&p->mont, t, b);
+}
+
+static int mont_isConstant(const ff_Params *p, const mp a, const size_t constant) {
+  mp_limb_t ta[FP_MONT_MAX_LIMBS], tc[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, ta);
+  mont_constant_limbs(&p->mont, constant, tc);
+  return !mpn_cmp(ta, tc, p->mont.n);
+}
+
+static void mont_unity(const ff_Params *p, mp b) {
+  mont_set(&p->mont, p->mont.one, b);
+}
+
+static void mont_invert(const ff_Params *p, const mp a, mp b) {
+  mp_limb_t t[FP_MONT_MAX_LIMBS];
+
+  // (a*R)^-1 = a^-1 * R^-1, Montgomery multiplication with R^3 gives a^-1 * R
+  mpz_invert(b, a, p->mod);
+  mont_get(&p->mont, b, t);
+  mont_mul_limbs(&p->mont, t, p->mont.r3, t);
+  mont_set(&p->mont, t, b);
+}
+
+static void mont_pow(const ff_Params *p, const mp a, const mp b, mp c) {
+  const ff_Mont *m = &p->mont;
+  mp_limb_t ta[FP_MONT_MAX_LIMBS], tc[FP_MONT_MAX_LIMBS];
+  size_t i;
+
+  mont_get(m, a, ta);
+  for (i = 0; i < m->n; ++i)
+    tc[i] = m->one[i];
+
+  // Left-to-right square-and-multiply over the bits of the integer exponent
+  for (i = mpz_sizeinbase(b, 2); i > 0; --i) {
+    mont_mul_limbs(m, tc, tc, tc);
+    if (mpz_tstbit(b, i - 1))
+      mont_mul_limbs(m, tc, ta, tc);
+  }
+  mont_set(m, tc, c);
+}
+
+static void mont_init(const ff_Params *p, mp a) {
+  mpz_init2(a, p->mont.n * GMP_NUMB_BITS);
+}
+
+static void mont_from_int(const ff_Params *p, const mp a, mp b) {
+  mp_limb_t t[FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, t);
+  mont_mul_limbs(&p->mont, t, p->mont.r2, t);
+  mont_set(&p->mont, t, b);
+}
+
+static void mont_to_int(const ff_Params *p, const mp a, mp b) {
+  size_t i;
+  mp_limb_t t[2 * FP_MONT_MAX_LIMBS];
+
+  mont_get(&p->mont, a, t);
+  for (i = p->mont.n; i < 2 * p->mont.n; ++i)
+    t[i] = 0;
+  mont_redc(&p->mont, t, t);
+  mont_set(&p->mont, t, b);
+}
+
 void mp_import(mp rop, size_t count, int order, size_t size, int endian, size_t nails, const void *op) {
   mpz_import (rop, count, order, size, endian, nails, op);
 }
@@ -128,8 +325,62 @@ set_gmp_fp_params(ff_Params *params) {
   params->subtract =        gmp_subtract;
   params->unity =           gmp_unity;
   params->zero =            gmp_zero;
+  params->fromInt =         gmp_from_int;
+  params->toInt =           gmp_to_int;
+  params->backend =         FP_BACKEND_GMP;
 };
 
+void
+set_mont_fp_params(ff_Params *params) {
+  ff_Mont *m = &params->mont;
+  mp_limb_t inv = 1;
+  mpz_t r;
+  size_t i;
+
+  m->n = mpz_size(params->mod);
+  for (i = 0; i < m->n; ++i)
+    m->p[i] = mpz_getlimbn(params->mod, i);
+
+  // p^-1 mod 2^GMP_NUMB_BITS by Newton iteration, each step doubles the number of correct bits
+  for (i = 0; i < 7; ++i)
+    inv *= 2 - m->p[0] * inv;
+  m->pinv = -inv;
+
+  mpz_init(r);
+  for (i = 1; i <= 3; ++i) {
+    mp_limb_t *dst = (i == 1 ? m->one : (i == 2 ? m->r2 : m->r3));
+    size_t j;
+
+    mpz_set_ui(r, 1);
+    mpz_mul_2exp(r, r, i * m->n * GMP_NUMB_BITS);
+    mpz_mod(r, r, params->mod);
+    for (j = 0; j < m->n; ++j)
+      dst[j] = mpz_getlimbn(r, j);
+  }
+  mpz_clear(r);
+
+  params->init =            mont_init;
+  params->add =             mont_add;
+  params->clear =           gmp_clear;
+  params->constant =        mont_constant;
+  params->copy =            gmp_copy_fp;
+  params->isEqual =         gmp_isequal_fp;
+  params->invert =          mont_invert;
+  params->isBitSet =        gmp_isBitSet_fp;
+  params->isConstant =      mont_isConstant;
+  params->multiply =        mont_multiply;
+  params->negative =        mont_negative;
+  params->pow =             mont_pow;
+  params->rand =            nist_rand;
+  params->square =          mont_square;
+  params->subtract =        mont_subtract;
+  params->unity =           mont_unity;
+  params->zero =            gmp_zero;
+  params->fromInt =         mont_from_int;
+  params->toInt =           mont_to_int;
+  params->backend =         FP_BACKEND_MONT;
+}
+
 void fp_Init(const ff_Params* p, mp a) {
   p->init(p, a);
 }
@@ -199,6 +450,14 @@ void fp_Zero(const ff_Params *p, mp a) {
   p->zero(p, a);
 }
 
+void fp_FromInt(const ff_Params *p, const mp a, mp b) {
+  p->fromInt(p, a, b);
+}
+
+void fp_ToInt(const ff_Params *p, const mp a, mp b) {
+  p->toInt(p, a, b);
+}
+
 void fp_ImportHex(const char *hexStr, mp a) {
   mpz_set_str(a, hexStr, 0);
 }
\ No newline at end of file
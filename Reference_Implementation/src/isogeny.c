@@ -6,6 +6,7 @@
 //
 
 #include <isogeny.h>
+#include <stdlib.h>
 
 void eval_2_iso(const ff_Params *p,
                 const mont_pt_t *P2,
@@ -370,3 +371,446 @@ void iso_3_e(const ff_Params *p,
 
   mont_pt_clear(p, &T);
 }
+
+void iso_strategy(unsigned long n, unsigned long mulCost, unsigned long evalCost, unsigned int *strat) {
+
+  // Optimal strategies S_i for i leaves, built bottom-up:
+  // S_i = (b, S_{i-b}, S_b), where b minimizes C_{i-b} + C_b + b*mulCost + (i-b)*evalCost
+  unsigned long i, b, best;
+  unsigned long long *C = calloc(n + 1, sizeof(unsigned long long));
+  unsigned int **S = calloc(n + 1, sizeof(unsigned int *));
+
+  for (i = 1; i <= n; ++i)
+    S[i] = calloc(i, sizeof(unsigned int));
+
+  for (i = 2; i <= n; ++i) {
+    best = 1;
+    for (b = 2; b < i; ++b) {
+      if (C[i - b] + C[b] + b * mulCost + (i - b) * evalCost <
+          C[i - best] + C[best] + best * mulCost + (i - best) * evalCost)
+        best = b;
+    }
+    C[i] = C[i - best] + C[best] + best * mulCost + (i - best) * evalCost;
+
+    S[i][0] = (unsigned int) best;
+    for (b = 0; b < i - best - 1; ++b)
+      S[i][1 + b] = S[i - best][b];
+    for (b = 0; b < best - 1; ++b)
+      S[i][i - best + b] = S[best][b];
+  }
+
+  for (i = 0; i + 1 < n; ++i)
+    strat[i] = S[n][i];
+
+  for (i = 1; i <= n; ++i)
+    free(S[i]);
+  free(S);
+  free(C);
+}
+
+void iso_2_e_strat(const ff_Params *p,
+                   int e,
+                   const unsigned int *strat,
+                   const mont_curve_int_t *E, mont_pt_t *S,
+                   const mont_pt_t *P1, const mont_pt_t *P2,
+                   mont_curve_int_t *isoE,
+                   mont_pt_t *isoP1,    mont_pt_t *isoP2) {
+
+  if (!strat) {
+    iso_2_e(p, e, E, S, P1, P2, isoE, isoP1, isoP2);
+    return;
+  }
+
+  int p1Eval = P1 != NULL, p2Eval = P2 != NULL;
+  int n, row, i, npts = 0, index = 0, ii = 0;
+
+  mont_pt_t T = { 0 };
+  mont_pt_init(p, &T);
+  mont_curve_copy(p, E, isoE);
+
+  if (p1Eval)
+    mont_pt_copy(p, P1, isoP1);
+
+  if (p2Eval)
+    mont_pt_copy(p, P2, isoP2);
+
+  if (e % 2) {
+    xDBLe(isoE, S, e - 1, &T);
+    curve_2_iso(p, &T, isoE, isoE);
+    eval_2_iso(p, &T, S, S);
+
+    if (p1Eval)
+      eval_2_iso(p, &T, isoP1, isoP1);
+
+    if (p2Eval)
+      eval_2_iso(p, &T, isoP2, isoP2);
+
+    e--;
+  }
+
+  // Intermediate points of the strategy and their positions in the tree
+  n = e / 2;
+  mont_pt_t *pts = calloc(n, sizeof(mont_pt_t));
+  int *pts_index = calloc(n, sizeof(int));
+  for (i = 0; i < n; ++i)
+    mont_pt_init(p, &pts[i]);
+
+  mont_pt_copy(p, S, &T);
+
+  for (row = 1; row < n; ++row) {
+    while (index < n - row) {
+      mont_pt_copy(p, &T, &pts[npts]);
+      pts_index[npts++] = index;
+      xDBLe(isoE, &T, 2 * (int) strat[ii], &T);
+      index += (int) strat[ii++];
+    }
+    curve_4_iso(p, &T, isoE, isoE);
+
+    for (i = 0; i < npts; ++i)
+      eval_4_iso(p, &T, &pts[i], &pts[i]);
+
+    if (p1Eval)
+      eval_4_iso(p, &T, isoP1, isoP1);
+
+    if (p2Eval)
+      eval_4_iso(p, &T, isoP2, isoP2);
+
+    mont_pt_copy(p, &pts[npts - 1], &T);
+    index = pts_index[--npts];
+  }
+
+  curve_4_iso(p, &T, isoE, isoE);
+
+  if (p1Eval)
+    eval_4_iso(p, &T, isoP1, isoP1);
+
+  if (p2Eval)
+    eval_4_iso(p, &T, isoP2, isoP2);
+
+  for (i = 0; i < n; ++i)
+    mont_pt_clear(p, &pts[i]);
+  free(pts);
+  free(pts_index);
+  mont_pt_clear(p, &T);
+}
+
+void iso_3_e_strat(const ff_Params *p,
+                   int e,
+                   const unsigned int *strat,
+                   const mont_curve_int_t *E, mont_pt_t *S,
+                   const mont_pt_t *P1, const mont_pt_t *P2,
+                   mont_curve_int_t *isoE,
+                   mont_pt_t *isoP1,    mont_pt_t *isoP2) {
+
+  if (!strat) {
+    iso_3_e(p, e, E, S, P1, P2, isoE, isoP1, isoP2);
+    return;
+  }
+
+  int p1Eval = P1 != NULL, p2Eval = P2 != NULL;
+  int n = e, row, i, npts = 0, index = 0, ii = 0;
+
+  mont_pt_t T = { 0 };
+  mont_pt_init(p, &T);
+  mont_curve_copy(p, E, isoE);
+
+  if (p1Eval)
+    mont_pt_copy(p, P1, isoP1);
+
+  if (p2Eval)
+    mont_pt_copy(p, P2, isoP2);
+
+  // Intermediate points of the strategy and their positions in the tree
+  mont_pt_t *pts = calloc(n, sizeof(mont_pt_t));
+  int *pts_index = calloc(n, sizeof(int));
+  for (i = 0; i < n; ++i)
+    mont_pt_init(p, &pts[i]);
+
+  mont_pt_copy(p, S, &T);
+
+  for (row = 1; row < n; ++row) {
+    while (index < n - row) {
+      mont_pt_copy(p, &T, &pts[npts]);
+      pts_index[npts++] = index;
+      xTPLe(isoE, &T, (int) strat[ii], &T);
+      index += (int) strat[ii++];
+    }
+    curve_3_iso(p, &T, isoE, isoE);
+
+    for (i = 0; i < npts; ++i)
+      eval_3_iso(p, &T, &pts[i], &pts[i]);
+
+    if (p1Eval)
+      eval_3_iso(p, &T, isoP1, isoP1);
+
+    if (p2Eval)
+      eval_3_iso(p, &T, isoP2, isoP2);
+
+    mont_pt_copy(p, &pts[npts - 1], &T);
+    index = pts_index[--npts];
+  }
+
+  curve_3_iso(p, &T, isoE, isoE);
+
+  if (p1Eval)
+    eval_3_iso(p, &T, isoP1, isoP1);
+
+  if (p2Eval)
+    eval_3_iso(p, &T, isoP2, isoP2);
+
+  for (i = 0; i < n; ++i)
+    mont_pt_clear(p, &pts[i]);
+  free(pts);
+  free(pts_index);
+  mont_pt_clear(p, &T);
+}
+
+void curve_2_iso_proj(const ff_Params *p, const mont_proj_pt_t *P2, fp2 *A24plus, fp2 *C24) {
+
+  fp2_Square(p, &P2->X, A24plus);               // A24plus = X2^2
+  fp2_Square(p, &P2->Z, C24);                   // C24 = Z2^2
+  fp2_Sub(p, C24, A24plus, A24plus);            // A24plus = Z2^2-X2^2
+}
+
+void eval_2_iso_proj(const ff_Params *p, const mont_proj_pt_t *P2, mont_proj_pt_t *P) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 }, t3 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+  fp2_Init(p, &t3);
+
+  fp2_Add(p, &P2->X, &P2->Z, &t0);              // t0 = X2+Z2
+  fp2_Sub(p, &P2->X, &P2->Z, &t1);              // t1 = X2-Z2
+  fp2_Add(p, &P->X, &P->Z, &t2);                // t2 = X+Z
+  fp2_Sub(p, &P->X, &P->Z, &t3);                // t3 = X-Z
+  fp2_Multiply(p, &t0, &t3, &t0);               // t0 = (X2+Z2)*(X-Z)
+  fp2_Multiply(p, &t1, &t2, &t1);               // t1 = (X2-Z2)*(X+Z)
+  fp2_Add(p, &t0, &t1, &t2);                    // t2 = (X2+Z2)*(X-Z)+(X2-Z2)*(X+Z)
+  fp2_Sub(p, &t0, &t1, &t3);                    // t3 = (X2+Z2)*(X-Z)-(X2-Z2)*(X+Z)
+  fp2_Multiply(p, &P->X, &t2, &P->X);           // XX = X*[(X2+Z2)*(X-Z)+(X2-Z2)*(X+Z)]
+  fp2_Multiply(p, &P->Z, &t3, &P->Z);           // ZZ = Z*[(X2+Z2)*(X-Z)-(X2-Z2)*(X+Z)]
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+  fp2_Clear(p, &t3);
+}
+
+void curve_4_iso_proj(const ff_Params *p, const mont_proj_pt_t *P4, fp2 *A24plus, fp2 *C24, fp2 *coeff) {
+
+  fp2_Sub(p, &P4->X, &P4->Z, &coeff[1]);        // coeff[1] = X4-Z4
+  fp2_Add(p, &P4->X, &P4->Z, &coeff[2]);        // coeff[2] = X4+Z4
+  fp2_Square(p, &P4->Z, &coeff[0]);             // coeff[0] = Z4^2
+  fp2_Add(p, &coeff[0], &coeff[0], &coeff[0]);  // coeff[0] = 2*Z4^2
+  fp2_Square(p, &coeff[0], C24);                // C24 = 4*Z4^4
+  fp2_Add(p, &coeff[0], &coeff[0], &coeff[0]);  // coeff[0] = 4*Z4^2
+  fp2_Square(p, &P4->X, A24plus);               // A24plus = X4^2
+  fp2_Add(p, A24plus, A24plus, A24plus);        // A24plus = 2*X4^2
+  fp2_Square(p, A24plus, A24plus);              // A24plus = 4*X4^4
+}
+
+void eval_4_iso_proj(const ff_Params *p, const fp2 *coeff, mont_proj_pt_t *P) {
+
+  fp2 t0 = { 0 }, t1 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+
+  fp2_Add(p, &P->X, &P->Z, &t0);                // t0 = X+Z
+  fp2_Sub(p, &P->X, &P->Z, &t1);                // t1 = X-Z
+  fp2_Multiply(p, &t0, &coeff[1], &P->X);       // X = (X+Z)*coeff[1]
+  fp2_Multiply(p, &t1, &coeff[2], &P->Z);       // Z = (X-Z)*coeff[2]
+  fp2_Multiply(p, &t0, &t1, &t0);               // t0 = (X+Z)*(X-Z)
+  fp2_Multiply(p, &coeff[0], &t0, &t0);         // t0 = coeff[0]*(X+Z)*(X-Z)
+  fp2_Add(p, &P->X, &P->Z, &t1);                // t1 = (X-Z)*coeff[2]+(X+Z)*coeff[1]
+  fp2_Sub(p, &P->X, &P->Z, &P->Z);              // Z = (X-Z)*coeff[2]-(X+Z)*coeff[1]
+  fp2_Square(p, &t1, &t1);                      // t1 = [(X-Z)*coeff[2]+(X+Z)*coeff[1]]^2
+  fp2_Square(p, &P->Z, &P->Z);                  // Z = [(X-Z)*coeff[2]-(X+Z)*coeff[1]]^2
+  fp2_Add(p, &t1, &t0, &P->X);                  // X = coeff[0]*(X+Z)*(X-Z)+[(X-Z)*coeff[2]+(X+Z)*coeff[1]]^2
+  fp2_Sub(p, &P->Z, &t0, &t0);                  // t0 = [(X-Z)*coeff[2]-(X+Z)*coeff[1]]^2-coeff[0]*(X+Z)*(X-Z)
+  fp2_Multiply(p, &P->X, &t1, &P->X);           // XX
+  fp2_Multiply(p, &P->Z, &t0, &P->Z);           // ZZ
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+}
+
+void curve_3_iso_proj(const ff_Params *p, const mont_proj_pt_t *P3, fp2 *A24minus, fp2 *A24plus, fp2 *coeff) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 }, t3 = { 0 }, t4 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+  fp2_Init(p, &t3);
+  fp2_Init(p, &t4);
+
+  fp2_Sub(p, &P3->X, &P3->Z, &coeff[0]);        // coeff[0] = X-Z
+  fp2_Square(p, &coeff[0], &t0);                // t0 = (X-Z)^2
+  fp2_Add(p, &P3->X, &P3->Z, &coeff[1]);        // coeff[1] = X+Z
+  fp2_Square(p, &coeff[1], &t1);                // t1 = (X+Z)^2
+  fp2_Add(p, &P3->X, &P3->X, &t3);              // t3 = 2*X
+  fp2_Square(p, &t3, &t3);                      // t3 = 4*X^2
+  fp2_Sub(p, &t3, &t0, &t2);                    // t2 = 4*X^2-(X-Z)^2
+  fp2_Sub(p, &t3, &t1, &t3);                    // t3 = 4*X^2-(X+Z)^2
+  fp2_Add(p, &t0, &t3, &t4);                    // t4 = 4*X^2-(X+Z)^2+(X-Z)^2
+  fp2_Add(p, &t4, &t4, &t4);                    // t4 = 2*(4*X^2-(X+Z)^2+(X-Z)^2)
+  fp2_Add(p, &t1, &t4, &t4);                    // t4 = 8*X^2-(X+Z)^2+2*(X-Z)^2
+  fp2_Multiply(p, &t2, &t4, A24minus);          // A24minus = [4*X^2-(X-Z)^2]*[8*X^2-(X+Z)^2+2*(X-Z)^2]
+  fp2_Add(p, &t1, &t2, &t4);                    // t4 = 4*X^2+(X+Z)^2-(X-Z)^2
+  fp2_Add(p, &t4, &t4, &t4);                    // t4 = 2*(4*X^2+(X+Z)^2-(X-Z)^2)
+  fp2_Add(p, &t0, &t4, &t4);                    // t4 = 8*X^2+2*(X+Z)^2-(X-Z)^2
+  fp2_Multiply(p, &t3, &t4, A24plus);           // A24plus = [4*X^2-(X+Z)^2]*[8*X^2+2*(X+Z)^2-(X-Z)^2]
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+  fp2_Clear(p, &t3);
+  fp2_Clear(p, &t4);
+}
+
+void eval_3_iso_proj(const ff_Params *p, const fp2 *coeff, mont_proj_pt_t *P) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+
+  fp2_Add(p, &P->X, &P->Z, &t0);                // t0 = X+Z
+  fp2_Sub(p, &P->X, &P->Z, &t1);                // t1 = X-Z
+  fp2_Multiply(p, &coeff[0], &t0, &t0);         // t0 = coeff[0]*(X+Z)
+  fp2_Multiply(p, &coeff[1], &t1, &t1);         // t1 = coeff[1]*(X-Z)
+  fp2_Add(p, &t0, &t1, &t2);                    // t2 = coeff[0]*(X+Z)+coeff[1]*(X-Z)
+  fp2_Sub(p, &t1, &t0, &t0);                    // t0 = coeff[1]*(X-Z)-coeff[0]*(X+Z)
+  fp2_Square(p, &t2, &t2);                      // t2 = [coeff[0]*(X+Z)+coeff[1]*(X-Z)]^2
+  fp2_Square(p, &t0, &t0);                      // t0 = [coeff[1]*(X-Z)-coeff[0]*(X+Z)]^2
+  fp2_Multiply(p, &P->X, &t2, &P->X);           // XX = X*[coeff[0]*(X+Z)+coeff[1]*(X-Z)]^2
+  fp2_Multiply(p, &P->Z, &t0, &P->Z);           // ZZ = Z*[coeff[1]*(X-Z)-coeff[0]*(X+Z)]^2
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+}
+
+void iso_2_e_proj(const ff_Params *p,
+                  int e,
+                  const unsigned int *strat,
+                  fp2 *A24plus, fp2 *C24,
+                  mont_proj_pt_t *S,
+                  mont_proj_pt_t *pts, int npts) {
+
+  int n, row, i, nstack = 0, index = 0, ii = 0;
+
+  fp2 coeff[3] = { 0 };
+  mont_proj_pt_t T = { 0 };
+  mont_proj_pt_init(p, &T);
+  for (i = 0; i < 3; ++i)
+    fp2_Init(p, &coeff[i]);
+
+  if (e % 2) {
+    xDBLe_proj(p, S, A24plus, C24, e - 1, &T);
+    curve_2_iso_proj(p, &T, A24plus, C24);
+    eval_2_iso_proj(p, &T, S);
+
+    for (i = 0; i < npts; ++i)
+      eval_2_iso_proj(p, &T, &pts[i]);
+
+    e--;
+  }
+
+  // Intermediate points of the strategy and their positions in the tree
+  n = e / 2;
+  mont_proj_pt_t *stack = calloc(n, sizeof(mont_proj_pt_t));
+  int *stack_index = calloc(n, sizeof(int));
+  for (i = 0; i < n; ++i)
+    mont_proj_pt_init(p, &stack[i]);
+
+  mont_proj_pt_copy(p, S, &T);
+
+  for (row = 1; row < n; ++row) {
+    while (index < n - row) {
+      mont_proj_pt_copy(p, &T, &stack[nstack]);
+      stack_index[nstack++] = index;
+      xDBLe_proj(p, &T, A24plus, C24, 2 * (int) strat[ii], &T);
+      index += (int) strat[ii++];
+    }
+    curve_4_iso_proj(p, &T, A24plus, C24, coeff);
+
+    for (i = 0; i < nstack; ++i)
+      eval_4_iso_proj(p, coeff, &stack[i]);
+
+    for (i = 0; i < npts; ++i)
+      eval_4_iso_proj(p, coeff, &pts[i]);
+
+    mont_proj_pt_copy(p, &stack[nstack - 1], &T);
+    index = stack_index[--nstack];
+  }
+
+  curve_4_iso_proj(p, &T, A24plus, C24, coeff);
+
+  for (i = 0; i < npts; ++i)
+    eval_4_iso_proj(p, coeff, &pts[i]);
+
+  for (i = 0; i < n; ++i)
+    mont_proj_pt_clear(p, &stack[i]);
+  free(stack);
+  free(stack_index);
+  for (i = 0; i < 3; ++i)
+    fp2_Clear(p, &coeff[i]);
+  mont_proj_pt_clear(p, &T);
+}
+
+void iso_3_e_proj(const ff_Params *p,
+                  int e,
+                  const unsigned int *strat,
+                  fp2 *A24minus, fp2 *A24plus,
+                  mont_proj_pt_t *S,
+                  mont_proj_pt_t *pts, int npts) {
+
+  int n = e, row, i, nstack = 0, index = 0, ii = 0;
+
+  fp2 coeff[2] = { 0 };
+  mont_proj_pt_t T = { 0 };
+  mont_proj_pt_init(p, &T);
+  for (i = 0; i < 2; ++i)
+    fp2_Init(p, &coeff[i]);
+
+  // Intermediate points of the strategy and their positions in the tree
+  mont_proj_pt_t *stack = calloc(n, sizeof(mont_proj_pt_t));
+  int *stack_index = calloc(n, sizeof(int));
+  for (i = 0; i < n; ++i)
+    mont_proj_pt_init(p, &stack[i]);
+
+  mont_proj_pt_copy(p, S, &T);
+
+  for (row = 1; row < n; ++row) {
+    while (index < n - row) {
+      mont_proj_pt_copy(p, &T, &stack[nstack]);
+      stack_index[nstack++] = index;
+      xTPLe_proj(p, &T, A24minus, A24plus, (int) strat[ii], &T);
+      index += (int) strat[ii++];
+    }
+    curve_3_iso_proj(p, &T, A24minus, A24plus, coeff);
+
+    for (i = 0; i < nstack; ++i)
+      eval_3_iso_proj(p, coeff, &stack[i]);
+
+    for (i = 0; i < npts; ++i)
+      eval_3_iso_proj(p, coeff, &pts[i]);
+
+    mont_proj_pt_copy(p, &stack[nstack - 1], &T);
+    index = stack_index[--nstack];
+  }
+
+  curve_3_iso_proj(p, &T, A24minus, A24plus, coeff);
+
+  for (i = 0; i < npts; ++i)
+    eval_3_iso_proj(p, coeff, &pts[i]);
+
+  for (i = 0; i < n; ++i)
+    mont_proj_pt_clear(p, &stack[i]);
+  free(stack);
+  free(stack_index);
+  for (i = 0; i < 2; ++i)
+    fp2_Clear(p, &coeff[i]);
+  mont_proj_pt_clear(p, &T);
+}
@@ -63,6 +63,23 @@ void mont_pt_copy(const ff_Params* p, const mont_pt_t* src, mont_pt_t* dst) {
   }
 }
 
+void mont_proj_pt_init(const ff_Params* p, mont_proj_pt_t* pt) {
+  fp2_Init(p, &pt->X);
+  fp2_Init(p, &pt->Z);
+}
+
+void mont_proj_pt_clear(const ff_Params* p, mont_proj_pt_t* pt) {
+  fp2_Clear(p, &pt->X);
+  fp2_Clear(p, &pt->Z);
+}
+
+void mont_proj_pt_copy(const ff_Params* p, const mont_proj_pt_t* src, mont_proj_pt_t* dst) {
+  if (src != dst) {
+    fp2_Copy(p, &src->X, &dst->X);
+    fp2_Copy(p, &src->Z, &dst->Z);
+  }
+}
+
 /* infinity is represented as a point with (0, 0) */
 static void mont_set_inf_affine(const mont_curve_int_t* curve, mont_pt_t *P) {
 
@@ -325,6 +342,37 @@ void get_xR(const ff_Params *p,
   mont_pt_clear(p, &R);
 }
 
+void get_A(const ff_Params *p, const fp2 *xP, const fp2 *xQ, const fp2 *xR, fp2 *a) {
+
+  fp2 t0 = { 0 }, t1 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+
+  // a:=(1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ-xR;
+
+  fp2_Multiply(p, xP, xQ, &t0);   // t0 = xP*xQ
+  fp2_Multiply(p, &t0, xR, &t1);  // t1 = xP*xQ*xR
+  fp2_Add(p, &t1, &t1, &t1);      // t1 = 2*xP*xQ*xR
+  fp2_Add(p, &t1, &t1, &t1);      // t1 = 4*xP*xQ*xR
+  fp2_Invert(p, &t1, &t1);        // t1 = 1/(4*xP*xQ*xR)
+
+  fp2_Set(p, a, 1, 0);            // a = 1
+  fp2_Sub(p, a, &t0, a);          // a = 1-xP*xQ
+  fp2_Multiply(p, xP, xR, &t0);   // t0 = xP*xR
+  fp2_Sub(p, a, &t0, a);          // a = 1-xP*xQ-xP*xR
+  fp2_Multiply(p, xQ, xR, &t0);   // t0 = xQ*xR
+  fp2_Sub(p, a, &t0, a);          // a = 1-xP*xQ-xP*xR-xQ*xR
+  fp2_Square(p, a, a);            // a = (1-xP*xQ-xP*xR-xQ*xR)^2
+
+  fp2_Multiply(p, a, &t1, a);     // a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)
+  fp2_Sub(p, a, xP, a);           // a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP
+  fp2_Sub(p, a, xQ, a);           // a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ
+  fp2_Sub(p, a, xR, a);           // a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ-xR
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+}
+
 void get_yP_yQ_A_B(const ff_Params *p,
                    const sike_public_key_t *pk,
                    mont_curve_int_t *curve) {
@@ -343,27 +391,7 @@ void get_yP_yQ_A_B(const ff_Params *p,
 
   fp2 *t1 = &T.x, *t2 = &T.y;
 
-  // a:=(1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ-xR;
-
-  fp2_Multiply(p, xP, xQ, a);   // t1 = xP*xQ
-  fp2_Multiply(p, a, xR, t1);   // t2 = xP*xQ*xR
-  fp2_Add(p, t1, t1, t1);       // t2 = 2*xP*xQ*xR
-  fp2_Add(p, t1, t1, t1);       // t2 = 4*xP*xQ*xR
-  fp2_Invert(p, t1, t1);        // t2 = 1/(4*xP*xQ*xR)
-
-  fp2_Set(p, t2, 1, 0);         // t3 = 1
-  fp2_Sub(p, t2, a, a);         // t1 = 1-xP*xQ
-  fp2_Multiply(p, xP, xR, t2);  // t3 = xP*xR
-  fp2_Sub(p, a, t2, a);         // t1 = 1-xP*xQ-xP*xR
-  fp2_Multiply(p, xQ, xR, t2);  // t3 = xQ*xR
-  fp2_Sub(p, a, t2, a);         // t1 = 1-xP*xQ-xP*xR-xQ*xR
-  fp2_Square(p, a, a);          // t1 = (1-xP*xQ-xP*xR-xQ*xR)^2
-
-  fp2_Multiply(p, a, t1, a);    // t1 = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)
-  fp2_Sub(p, a, xP, a);         // t1 = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP
-  fp2_Sub(p, a, xQ, a);         // t1 = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ
-  fp2_Sub(p, a, xR, a);         // a = (1-xP*xQ-xP*xR-xQ*xR)^2/(4*xP*xQ*xR)-xP-xQ-xR
-
+  get_A(p, xP, xQ, xR, a);
 
   fp2_Square(p, xP, t1);        // t1 = xP^2
   fp2_Multiply(p, xP, t1, t2);  // t2 = xP^3
@@ -393,3 +421,208 @@ void get_yP_yQ_A_B(const ff_Params *p,
 
   mont_pt_clear(p, &T);
 }
+
+void xDBL_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24plus, const fp2 *C24, mont_proj_pt_t *R) {
+
+  fp2 t0 = { 0 }, t1 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+
+  fp2_Sub(p, &P->X, &P->Z, &t0);                // t0 = X-Z
+  fp2_Add(p, &P->X, &P->Z, &t1);                // t1 = X+Z
+  fp2_Square(p, &t0, &t0);                      // t0 = (X-Z)^2
+  fp2_Square(p, &t1, &t1);                      // t1 = (X+Z)^2
+  fp2_Multiply(p, C24, &t0, &R->Z);             // Z2 = C24*(X-Z)^2
+  fp2_Multiply(p, &t1, &R->Z, &R->X);           // X2 = C24*(X-Z)^2*(X+Z)^2
+  fp2_Sub(p, &t1, &t0, &t1);                    // t1 = (X+Z)^2-(X-Z)^2
+  fp2_Multiply(p, A24plus, &t1, &t0);           // t0 = A24plus*[(X+Z)^2-(X-Z)^2]
+  fp2_Add(p, &R->Z, &t0, &R->Z);                // Z2 = A24plus*[(X+Z)^2-(X-Z)^2] + C24*(X-Z)^2
+  fp2_Multiply(p, &R->Z, &t1, &R->Z);           // Z2 = [A24plus*[(X+Z)^2-(X-Z)^2] + C24*(X-Z)^2]*[(X+Z)^2-(X-Z)^2]
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+}
+
+void xDBLe_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24plus, const fp2 *C24, int e,
+                mont_proj_pt_t *R) {
+  mont_proj_pt_copy(p, P, R);
+  for (int j = 0; j < e; ++j)
+    xDBL_proj(p, R, A24plus, C24, R);
+}
+
+void xTPL_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24minus, const fp2 *A24plus, mont_proj_pt_t *R) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 }, t3 = { 0 }, t4 = { 0 }, t5 = { 0 }, t6 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+  fp2_Init(p, &t3);
+  fp2_Init(p, &t4);
+  fp2_Init(p, &t5);
+  fp2_Init(p, &t6);
+
+  fp2_Sub(p, &P->X, &P->Z, &t0);                // t0 = X-Z
+  fp2_Square(p, &t0, &t2);                      // t2 = (X-Z)^2
+  fp2_Add(p, &P->X, &P->Z, &t1);                // t1 = X+Z
+  fp2_Square(p, &t1, &t3);                      // t3 = (X+Z)^2
+  fp2_Add(p, &P->X, &P->X, &t4);                // t4 = 2*X
+  fp2_Add(p, &P->Z, &P->Z, &t0);                // t0 = 2*Z
+  fp2_Square(p, &t4, &t1);                      // t1 = 4*X^2
+  fp2_Sub(p, &t1, &t3, &t1);                    // t1 = 4*X^2-(X+Z)^2
+  fp2_Sub(p, &t1, &t2, &t1);                    // t1 = 4*X^2-(X+Z)^2-(X-Z)^2
+  fp2_Multiply(p, A24plus, &t3, &t5);           // t5 = A24plus*(X+Z)^2
+  fp2_Multiply(p, &t3, &t5, &t3);               // t3 = A24plus*(X+Z)^4
+  fp2_Multiply(p, A24minus, &t2, &t6);          // t6 = A24minus*(X-Z)^2
+  fp2_Multiply(p, &t2, &t6, &t2);               // t2 = A24minus*(X-Z)^4
+  fp2_Sub(p, &t2, &t3, &t3);                    // t3 = A24minus*(X-Z)^4-A24plus*(X+Z)^4
+  fp2_Sub(p, &t5, &t6, &t2);                    // t2 = A24plus*(X+Z)^2-A24minus*(X-Z)^2
+  fp2_Multiply(p, &t1, &t2, &t1);               // t1 = [4*X^2-(X+Z)^2-(X-Z)^2]*[A24plus*(X+Z)^2-A24minus*(X-Z)^2]
+  fp2_Add(p, &t3, &t1, &t2);                    // t2 = t3+t1
+  fp2_Square(p, &t2, &t2);                      // t2 = (t3+t1)^2
+  fp2_Sub(p, &t3, &t1, &t1);                    // t1 = t3-t1
+  fp2_Square(p, &t1, &t1);                      // t1 = (t3-t1)^2
+  fp2_Multiply(p, &t4, &t2, &R->X);             // X3 = 2*X*(t3+t1)^2
+  fp2_Multiply(p, &t0, &t1, &R->Z);             // Z3 = 2*Z*(t3-t1)^2
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+  fp2_Clear(p, &t3);
+  fp2_Clear(p, &t4);
+  fp2_Clear(p, &t5);
+  fp2_Clear(p, &t6);
+}
+
+void xTPLe_proj(const ff_Params *p, const mont_proj_pt_t *P, const fp2 *A24minus, const fp2 *A24plus, int e,
+                mont_proj_pt_t *R) {
+  mont_proj_pt_copy(p, P, R);
+  for (int j = 0; j < e; ++j)
+    xTPL_proj(p, R, A24minus, A24plus, R);
+}
+
+void xDBLADD_proj(const ff_Params *p, mont_proj_pt_t *P, mont_proj_pt_t *Q, const mont_proj_pt_t *PQ, const fp2 *A24) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+
+  fp2_Add(p, &P->X, &P->Z, &t0);                // t0 = XP+ZP
+  fp2_Sub(p, &P->X, &P->Z, &t1);                // t1 = XP-ZP
+  fp2_Square(p, &t0, &P->X);                    // XP = (XP+ZP)^2
+  fp2_Sub(p, &Q->X, &Q->Z, &t2);                // t2 = XQ-ZQ
+  fp2_Add(p, &Q->X, &Q->Z, &Q->X);              // XQ = XQ+ZQ
+  fp2_Multiply(p, &t0, &t2, &t0);               // t0 = (XP+ZP)*(XQ-ZQ)
+  fp2_Square(p, &t1, &P->Z);                    // ZP = (XP-ZP)^2
+  fp2_Multiply(p, &t1, &Q->X, &t1);             // t1 = (XP-ZP)*(XQ+ZQ)
+  fp2_Sub(p, &P->X, &P->Z, &t2);                // t2 = (XP+ZP)^2-(XP-ZP)^2
+  fp2_Multiply(p, &P->X, &P->Z, &P->X);         // XP = (XP+ZP)^2*(XP-ZP)^2
+  fp2_Multiply(p, A24, &t2, &Q->X);             // XQ = A24*[(XP+ZP)^2-(XP-ZP)^2]
+  fp2_Sub(p, &t0, &t1, &Q->Z);                  // ZQ = (XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)
+  fp2_Add(p, &Q->X, &P->Z, &P->Z);              // ZP = A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2
+  fp2_Add(p, &t0, &t1, &Q->X);                  // XQ = (XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)
+  fp2_Multiply(p, &P->Z, &t2, &P->Z);           // ZP = [A24*[(XP+ZP)^2-(XP-ZP)^2]+(XP-ZP)^2]*[(XP+ZP)^2-(XP-ZP)^2]
+  fp2_Square(p, &Q->Z, &Q->Z);                  // ZQ = [(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2_Square(p, &Q->X, &Q->X);                  // XQ = [(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+  fp2_Multiply(p, &Q->Z, &PQ->X, &Q->Z);        // ZQ = XPQ*[(XP+ZP)*(XQ-ZQ)-(XP-ZP)*(XQ+ZQ)]^2
+  fp2_Multiply(p, &Q->X, &PQ->Z, &Q->X);        // XQ = ZPQ*[(XP+ZP)*(XQ-ZQ)+(XP-ZP)*(XQ+ZQ)]^2
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+}
+
+void mont_ladder3pt(const ff_Params *p,
+                    const fp2 *xP, const fp2 *xQ, const fp2 *xPQ,
+                    const mp k, int msb,
+                    const fp2 *a,
+                    mont_proj_pt_t *R) {
+
+  // Right-to-left ladder with the invariants R0 = 2^i*Q, R1 = P+(k mod 2^i)*Q and R2 = R1-R0
+  mont_proj_pt_t R0 = { 0 }, R1 = { 0 }, R2 = { 0 };
+  fp2 A24 = { 0 }, t = { 0 };
+
+  mont_proj_pt_init(p, &R0);
+  mont_proj_pt_init(p, &R1);
+  mont_proj_pt_init(p, &R2);
+  fp2_Init(p, &A24);
+  fp2_Init(p, &t);
+
+  fp2_Set(p, &t, 4, 0);
+  fp2_Invert(p, &t, &t);                        // t = 1/4
+  fp2_Set(p, &A24, 2, 0);
+  fp2_Add(p, a, &A24, &A24);                    // A24 = a+2
+  fp2_Multiply(p, &A24, &t, &A24);              // A24 = (a+2)/4
+
+  fp2_Copy(p, xQ, &R0.X);
+  fp2_Set(p, &R0.Z, 1, 0);
+  fp2_Copy(p, xP, &R1.X);
+  fp2_Set(p, &R1.Z, 1, 0);
+  fp2_Copy(p, xPQ, &R2.X);
+  fp2_Set(p, &R2.Z, 1, 0);
+
+  for (int i = 0; i < msb; ++i) {
+    if (fp_IsBitSet(p, k, (unsigned long) i))
+      xDBLADD_proj(p, &R0, &R1, &R2, &A24);     // R1 = R1+R0
+    else
+      xDBLADD_proj(p, &R0, &R2, &R1, &A24);     // R2 = R2-R0
+  }
+
+  mont_proj_pt_copy(p, &R1, R);
+
+  mont_proj_pt_clear(p, &R0);
+  mont_proj_pt_clear(p, &R1);
+  mont_proj_pt_clear(p, &R2);
+  fp2_Clear(p, &A24);
+  fp2_Clear(p, &t);
+}
+
+void j_inv_proj(const ff_Params *p, const fp2 *A, const fp2 *C, fp2 *jinv) {
+
+  fp2 t0 = { 0 }, t1 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+
+  fp2_Square(p, A, jinv);                       // jinv = A^2
+  fp2_Square(p, C, &t1);                        // t1 = C^2
+  fp2_Add(p, &t1, &t1, &t0);                    // t0 = 2*C^2
+  fp2_Sub(p, jinv, &t0, &t0);                   // t0 = A^2-2*C^2
+  fp2_Sub(p, &t0, &t1, &t0);                    // t0 = A^2-3*C^2
+  fp2_Sub(p, &t0, &t1, jinv);                   // jinv = A^2-4*C^2
+  fp2_Square(p, &t1, &t1);                      // t1 = C^4
+  fp2_Multiply(p, jinv, &t1, jinv);             // jinv = C^4*(A^2-4*C^2)
+  fp2_Add(p, &t0, &t0, &t0);                    // t0 = 2*(A^2-3*C^2)
+  fp2_Add(p, &t0, &t0, &t0);                    // t0 = 4*(A^2-3*C^2)
+  fp2_Square(p, &t0, &t1);                      // t1 = 16*(A^2-3*C^2)^2
+  fp2_Multiply(p, &t0, &t1, &t0);               // t0 = 64*(A^2-3*C^2)^3
+  fp2_Add(p, &t0, &t0, &t0);                    // t0 = 128*(A^2-3*C^2)^3
+  fp2_Add(p, &t0, &t0, &t0);                    // t0 = 256*(A^2-3*C^2)^3
+  fp2_Invert(p, jinv, jinv);                    // jinv = 1/(C^4*(A^2-4*C^2))
+  fp2_Multiply(p, jinv, &t0, jinv);             // jinv = 256*(A^2-3*C^2)^3/(C^4*(A^2-4*C^2))
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+}
+
+void inv_3_way(const ff_Params *p, fp2 *z1, fp2 *z2, fp2 *z3) {
+
+  fp2 t0 = { 0 }, t1 = { 0 }, t2 = { 0 }, t3 = { 0 };
+  fp2_Init(p, &t0);
+  fp2_Init(p, &t1);
+  fp2_Init(p, &t2);
+  fp2_Init(p, &t3);
+
+  fp2_Multiply(p, z1, z2, &t0);                 // t0 = z1*z2
+  fp2_Multiply(p, z3, &t0, &t1);                // t1 = z1*z2*z3
+  fp2_Invert(p, &t1, &t1);                      // t1 = 1/(z1*z2*z3)
+  fp2_Multiply(p, z3, &t1, &t2);                // t2 = 1/(z1*z2)
+  fp2_Multiply(p, &t2, z2, &t3);                // t3 = 1/z1
+  fp2_Multiply(p, &t2, z1, z2);                 // z2 = 1/z2
+  fp2_Multiply(p, &t0, &t1, z3);                // z3 = 1/z3
+  fp2_Copy(p, &t3, z1);                         // z1 = 1/z1
+
+  fp2_Clear(p, &t0);
+  fp2_Clear(p, &t1);
+  fp2_Clear(p, &t2);
+  fp2_Clear(p, &t3);
+}
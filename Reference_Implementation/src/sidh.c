@@ -55,6 +55,123 @@ void sidh_sk_keygen(const sike_params_t* params,
   clear_free(arr, bytes, MEM_FREE);
 }
 
+/**
+ * Isogen, affine version, see `sidh_isogen()`
+ */
+void sidh_isogen_affine(const sike_params_t *params,
+                        sike_public_key_t *pk,
+                        const sike_private_key sk,
+                        party_t party) {
+
+  ff_Params *p = NULL;
+
+  unsigned long e, msb = 0;
+  const mont_curve_int_t *E;
+  const mont_pt_t *Po, *Qo;
+  const unsigned int *strat;
+  void (*iso_e)(const ff_Params *, int, const unsigned int *, const mont_curve_int_t *, mont_pt_t *,
+                const mont_pt_t *, const mont_pt_t *,
+                mont_curve_int_t *, mont_pt_t *, mont_pt_t *);
+
+  if (party == ALICE) {
+    p = params->EA.ffData;
+    e = params->eA;
+    msb = params->msbA;
+    E = &params->EA;
+    Po = &params->EB.P;
+    Qo = &params->EB.Q;
+    strat = params->stratA;
+    iso_e = iso_2_e_strat;
+  } else {
+    p = params->EB.ffData;
+    e = params->eB;
+    msb = params->msbB - 1;
+    E = &params->EB;
+    Po = &params->EA.P;
+    Qo = &params->EA.Q;
+    strat = params->stratB;
+    iso_e = iso_3_e_strat;
+  }
+
+  mont_curve_int_t pkInt = { 0 };
+  mont_curve_init(p, &pkInt);
+
+  fp2_Copy(p, &E->a, &pkInt.a);
+  fp2_Copy(p, &E->b, &pkInt.b);
+
+  mont_pt_t S = { 0 };
+  mont_pt_init(p, &S);
+
+  // Generate kernel
+  // S:=P2+SK_2*Q2;
+  mont_double_and_add(E, sk, &E->Q, &S, (int) msb);
+  xADD(E, &E->P, &S, &S);
+
+  mont_pt_copy(p, Po, &pkInt.P);
+  mont_pt_copy(p, Qo, &pkInt.Q);
+
+  iso_e(p, (int) e, strat, &pkInt, &S, &pkInt.P, &pkInt.Q, &pkInt, &pkInt.P, &pkInt.Q);
+
+  get_xR(p, &pkInt, pk);
+
+  mont_pt_clear(p, &S);
+  mont_curve_clear(p, &pkInt);
+
+}
+
+/**
+ * Isoex, affine version, see `sidh_isoex()`
+ */
+void sidh_isoex_affine(const sike_params_t *params,
+                       const sike_public_key_t *pkO,
+                       const sike_private_key skI,
+                       party_t party,
+                       fp2 *secret) {
+  ff_Params *p = NULL;
+
+  unsigned long e, msb;
+
+  mont_curve_int_t E = { 0 };
+
+  const unsigned int *strat;
+  void (*iso_e)(const ff_Params *, int, const unsigned int *, const mont_curve_int_t *, mont_pt_t *,
+                const mont_pt_t *, const mont_pt_t *,
+                mont_curve_int_t *, mont_pt_t *, mont_pt_t *);
+
+  if (party == ALICE) {
+    p = params->EA.ffData;
+    e = params->eA;
+    msb = params->msbA;
+    strat = params->stratA;
+    iso_e = iso_2_e_strat;
+  } else {
+    p = params->EB.ffData;
+    e = params->eB;
+    msb = params->msbB - 1;
+    strat = params->stratB;
+    iso_e = iso_3_e_strat;
+  }
+
+  mont_curve_init(p, &E);
+  get_yP_yQ_A_B(p, pkO, &E);
+
+  mont_pt_t S = { 0 };
+  mont_pt_init(p, &S);
+
+
+  // Generate kernel
+  //S:=phiP2+SK_2*phiQ2
+  mont_double_and_add(&E, skI, &E.Q, &S, (int) msb);
+  xADD(&E, &E.P, &S, &S);
+
+  iso_e(p, (int) e, strat, &E, &S, NULL, NULL, &E, NULL, NULL);
+
+  j_inv(p, &E, secret);
+
+  mont_curve_clear(p, &E);
+  mont_pt_clear(p, &S);
+}
+
 /**
  * Isogen
  * (SIDH public-key generation)
@@ -85,54 +202,70 @@ void sidh_isogen(const sike_params_t *params,
   ff_Params *p = NULL;
 
   unsigned long e, msb = 0;
-  const mont_curve_int_t *E;
-  const mont_pt_t *Po, *Qo;
-  void (*iso_e)(const ff_Params *, int, const mont_curve_int_t *, mont_pt_t *,
-                const mont_pt_t *, const mont_pt_t *,
-                mont_curve_int_t *, mont_pt_t *, mont_pt_t *);
+  const mont_curve_int_t *E, *Eo;
+  const fp2 *xR, *xRo;
 
   if (party == ALICE) {
     p = params->EA.ffData;
     e = params->eA;
     msb = params->msbA;
     E = &params->EA;
-    Po = &params->EB.P;
-    Qo = &params->EB.Q;
-    iso_e = iso_2_e;
+    xR = &params->xRA;
+    Eo = &params->EB;
+    xRo = &params->xRB;
   } else {
     p = params->EB.ffData;
     e = params->eB;
     msb = params->msbB - 1;
     E = &params->EB;
-    Po = &params->EA.P;
-    Qo = &params->EA.Q;
-    iso_e = iso_3_e;
+    xR = &params->xRB;
+    Eo = &params->EA;
+    xRo = &params->xRA;
   }
 
-  mont_curve_int_t pkInt = { 0 };
-  mont_curve_init(p, &pkInt);
+  mont_proj_pt_t S = { 0 }, phi[3] = { 0 };
+  fp2 A24plus = { 0 }, A24minus = { 0 }, C24 = { 0 };
 
-  fp2_Copy(p, &E->a, &pkInt.a);
-  fp2_Copy(p, &E->b, &pkInt.b);
+  mont_proj_pt_init(p, &S);
+  fp2_Init(p, &A24plus);
+  fp2_Init(p, &A24minus);
+  fp2_Init(p, &C24);
 
-  mont_pt_t S = { 0 };
-  mont_pt_init(p, &S);
+  for (int i = 0; i < 3; ++i) {
+    mont_proj_pt_init(p, &phi[i]);
+    fp2_Set(p, &phi[i].Z, 1, 0);
+  }
 
   // Generate kernel
   // S:=P2+SK_2*Q2;
-  mont_double_and_add(E, sk, &E->Q, &S, (int) msb);
-  xADD(E, &E->P, &S, &S);
+  mont_ladder3pt(p, &E->P.x, &E->Q.x, xR, sk, (int) msb, &E->a, &S);
 
-  mont_pt_copy(p, Po, &pkInt.P);
-  mont_pt_copy(p, Qo, &pkInt.Q);
+  fp2_Copy(p, &Eo->P.x, &phi[0].X);
+  fp2_Copy(p, &Eo->Q.x, &phi[1].X);
+  fp2_Copy(p, xRo, &phi[2].X);
 
-  iso_e(p, (int) e, &pkInt, &S, &pkInt.P, &pkInt.Q, &pkInt, &pkInt.P, &pkInt.Q);
+  // Curve constants A24plus = a+2, C24 = 4 and A24minus = a-2 of the starting curve
+  fp2_Set(p, &C24, 2, 0);
+  fp2_Add(p, &E->a, &C24, &A24plus);
+  fp2_Sub(p, &E->a, &C24, &A24minus);
+  fp2_Add(p, &C24, &C24, &C24);
 
-  get_xR(p, &pkInt, pk);
+  if (party == ALICE)
+    iso_2_e_proj(p, (int) e, params->stratA, &A24plus, &C24, &S, phi, 3);
+  else
+    iso_3_e_proj(p, (int) e, params->stratB, &A24minus, &A24plus, &S, phi, 3);
 
-  mont_pt_clear(p, &S);
-  mont_curve_clear(p, &pkInt);
+  inv_3_way(p, &phi[0].Z, &phi[1].Z, &phi[2].Z);
+  fp2_Multiply(p, &phi[0].X, &phi[0].Z, &pk->xP);
+  fp2_Multiply(p, &phi[1].X, &phi[1].Z, &pk->xQ);
+  fp2_Multiply(p, &phi[2].X, &phi[2].Z, &pk->xR);
 
+  for (int i = 0; i < 3; ++i)
+    mont_proj_pt_clear(p, &phi[i]);
+  mont_proj_pt_clear(p, &S);
+  fp2_Clear(p, &A24plus);
+  fp2_Clear(p, &A24minus);
+  fp2_Clear(p, &C24);
 }
 
 /**
@@ -165,40 +298,55 @@ void sidh_isoex(const sike_params_t *params,
 
   unsigned long e, msb;
 
-  mont_curve_int_t E = { 0 };
-
-  void (*iso_e)(const ff_Params *, int, const mont_curve_int_t *, mont_pt_t *,
-                const mont_pt_t *, const mont_pt_t *,
-                mont_curve_int_t *, mont_pt_t *, mont_pt_t *);
-
   if (party == ALICE) {
     p = params->EA.ffData;
     e = params->eA;
     msb = params->msbA;
-    iso_e = iso_2_e;
   } else {
     p = params->EB.ffData;
     e = params->eB;
     msb = params->msbB - 1;
-    iso_e = iso_3_e;
   }
 
-  mont_curve_init(p, &E);
-  get_yP_yQ_A_B(p, pkO, &E);
+  mont_proj_pt_t S = { 0 };
+  fp2 a = { 0 }, A24plus = { 0 }, A24minus = { 0 }, C24 = { 0 };
 
-  mont_pt_t S = { 0 };
-  mont_pt_init(p, &S);
+  fp2_Init(p, &a);
+  mont_proj_pt_init(p, &S);
+  fp2_Init(p, &A24plus);
+  fp2_Init(p, &A24minus);
+  fp2_Init(p, &C24);
 
+  // Only the curve coefficient is needed for the x-only arithmetic, no y-coordinates
+  get_A(p, &pkO->xP, &pkO->xQ, &pkO->xR, &a);
 
   // Generate kernel
   //S:=phiP2+SK_2*phiQ2
-  mont_double_and_add(&E, skI, &E.Q, &S, (int) msb);
-  xADD(&E, &E.P, &S, &S);
+  mont_ladder3pt(p, &pkO->xP, &pkO->xQ, &pkO->xR, skI, (int) msb, &a, &S);
 
-  iso_e(p, (int) e, &E, &S, NULL, NULL, &E, NULL, NULL);
+  // Curve constants A24plus = a+2, C24 = 4 and A24minus = a-2 of the curve of the public key
+  fp2_Set(p, &C24, 2, 0);
+  fp2_Add(p, &a, &C24, &A24plus);
+  fp2_Sub(p, &a, &C24, &A24minus);
+  fp2_Add(p, &C24, &C24, &C24);
 
-  j_inv(p, &E, secret);
+  if (party == ALICE) {
+    iso_2_e_proj(p, (int) e, params->stratA, &A24plus, &C24, &S, NULL, 0);
+    fp2_Add(p, &A24plus, &A24plus, &A24plus);   // A24plus = 2*A+4*C
+    fp2_Sub(p, &A24plus, &C24, &A24plus);       // A24plus = 2*A
+    fp2_Add(p, &A24plus, &A24plus, &A24plus);   // A24plus = 4*A
+    j_inv_proj(p, &A24plus, &C24, secret);
+  } else {
+    iso_3_e_proj(p, (int) e, params->stratB, &A24minus, &A24plus, &S, NULL, 0);
+    fp2_Sub(p, &A24plus, &A24minus, &C24);      // C24 = 4*C
+    fp2_Add(p, &A24plus, &A24minus, &A24plus);  // A24plus = 2*A
+    fp2_Add(p, &A24plus, &A24plus, &A24plus);   // A24plus = 4*A
+    j_inv_proj(p, &A24plus, &C24, secret);
+  }
 
-  mont_curve_clear(p, &E);
-  mont_pt_clear(p, &S);
+  fp2_Clear(p, &a);
+  mont_proj_pt_clear(p, &S);
+  fp2_Clear(p, &A24plus);
+  fp2_Clear(p, &A24minus);
+  fp2_Clear(p, &C24);
 }
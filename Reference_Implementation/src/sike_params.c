@@ -6,7 +6,9 @@
 //
 
 #include <sike_params.h>
+#include <isogeny.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 const sike_params_raw_t SIKEp434 = {
   .name = "SIKEp434",
@@ -158,24 +160,63 @@ const sike_params_raw_t SIKEp751 = {
   .msg_bytes = 32,
 };
 
+// Sets up finite field parameters for the modulus given as hex string
+static ff_Params*
+ff_params_setup(const char *p, fp_backend_t backend) {
+  ff_Params* ffp = malloc(sizeof(ff_Params));
+
+  set_gmp_fp_params(ffp);
+
+  fp_Init(ffp, ffp->mod);
+  fp_ImportHex(p, ffp->mod);
+
+  if (backend == FP_BACKEND_MONT)
+    set_mont_fp_params(ffp);
+
+  return ffp;
+}
+
+// Initializes a field element and sets it to the integer given as hex string
+static void
+fp_Init_hex(const ff_Params *p, const char *hexStr, mp a) {
+  fp_Init(p, a);
+  fp_ImportHex(hexStr, a);
+  fp_FromInt(p, a, a);
+}
+
+// Initializes xR to x(P-Q) of the generators of a curve
+static void
+fp2_Init_xR(const mont_curve_int_t *E, fp2 *xR) {
+  sike_public_key_t pk = { 0 };
+
+  public_key_init(E->ffData, &pk);
+  get_xR(E->ffData, E, &pk);
+  fp2_Init(E->ffData, xR);
+  fp2_Copy(E->ffData, &pk.xR, xR);
+  public_key_clear(E->ffData, &pk);
+}
+
 void
 sike_setup_params(const sike_params_raw_t *raw, sike_params_t *params) {
+  sike_setup_params_backend(raw, FP_BACKEND_DEFAULT, params);
+}
+
+void
+sike_setup_params_backend(const sike_params_raw_t *raw, fp_backend_t backend, sike_params_t *params) {
   // Base curve -> Coefficients are null
   mont_curve_int_t* EA = &params->EA;
   mont_curve_int_t* EB = &params->EB;
 
+  params->backend = backend;
+
   params->eA = (unsigned long) strtol(raw->eA, NULL, 0);
   params->eB = (unsigned long) strtol(raw->eB, NULL, 0);
 
   params->lA = (unsigned long) strtol(raw->lA, NULL, 0);
   params->lB = (unsigned long) strtol(raw->lB, NULL, 0);
 
-  ff_Params* ffpA = malloc(sizeof(ff_Params));
-  ff_Params* ffpB = malloc(sizeof(ff_Params));
-
-
-  set_gmp_fp_params(ffpA);
-  set_gmp_fp_params(ffpB);
+  ff_Params* ffpA = ff_params_setup(raw->p, backend);
+  ff_Params* ffpB = ff_params_setup(raw->p, backend);
 
   EA->ffData = ffpA;
 
@@ -187,28 +228,14 @@ sike_setup_params(const sike_params_raw_t *raw, sike_params_t *params) {
   mp_pow(params->lA, params->eA, params->ordA);
   params->msbA = mp_sizeinbase(params->ordA, 2);
 
-  fp_Init(ffpA,  EA->ffData->mod);
-
-  fp_Init(ffpA, EA->P.x.x0);
-  fp_Init(ffpA, EA->P.x.x1);
-  fp_Init(ffpA, EA->P.y.x0);
-  fp_Init(ffpA, EA->P.y.x1);
-  fp_Init(ffpA, EA->Q.x.x0);
-  fp_Init(ffpA, EA->Q.x.x1);
-  fp_Init(ffpA, EA->Q.y.x0);
-  fp_Init(ffpA, EA->Q.y.x1);
-
-  fp_ImportHex(raw->p,    EA->ffData->mod);
-
-
-  fp_ImportHex(raw->xPA0, EA->P.x.x0);
-  fp_ImportHex(raw->xPA1, EA->P.x.x1);
-  fp_ImportHex(raw->yPA0, EA->P.y.x0);
-  fp_ImportHex(raw->yPA1, EA->P.y.x1);
-  fp_ImportHex(raw->xQA0, EA->Q.x.x0);
-  fp_ImportHex(raw->xQA1, EA->Q.x.x1);
-  fp_ImportHex(raw->yQA0, EA->Q.y.x0);
-  fp_ImportHex(raw->yQA1, EA->Q.y.x1);
+  fp_Init_hex(ffpA, raw->xPA0, EA->P.x.x0);
+  fp_Init_hex(ffpA, raw->xPA1, EA->P.x.x1);
+  fp_Init_hex(ffpA, raw->yPA0, EA->P.y.x0);
+  fp_Init_hex(ffpA, raw->yPA1, EA->P.y.x1);
+  fp_Init_hex(ffpA, raw->xQA0, EA->Q.x.x0);
+  fp_Init_hex(ffpA, raw->xQA1, EA->Q.x.x1);
+  fp_Init_hex(ffpA, raw->yQA0, EA->Q.y.x0);
+  fp_Init_hex(ffpA, raw->yQA1, EA->Q.y.x1);
 
   fp2_Init_set(ffpA, &EA->a, raw->A, 0);
   fp2_Init_set(ffpB, &EA->b, raw->B, 0);
@@ -220,31 +247,26 @@ sike_setup_params(const sike_params_raw_t *raw, sike_params_t *params) {
   mp_pow(params->lB, params->eB, params->ordB);
   params->msbB = mp_sizeinbase(params->ordB, 2);
 
-  fp_Init(ffpB, EB->ffData->mod);
-
-  fp_Init(ffpB, EB->P.x.x0);
-  fp_Init(ffpB, EB->P.x.x1);
-  fp_Init(ffpB, EB->P.y.x0);
-  fp_Init(ffpB, EB->P.y.x1);
-  fp_Init(ffpB, EB->Q.x.x0);
-  fp_Init(ffpB, EB->Q.x.x1);
-  fp_Init(ffpB, EB->Q.y.x0);
-  fp_Init(ffpB, EB->Q.y.x1);
-
-  fp_ImportHex(raw->p,    EB->ffData->mod);
-
-  fp_ImportHex(raw->xPB0, EB->P.x.x0);
-  fp_ImportHex(raw->xPB1, EB->P.x.x1);
-  fp_ImportHex(raw->yPB0, EB->P.y.x0);
-  fp_ImportHex(raw->yPB1, EB->P.y.x1);
-  fp_ImportHex(raw->xQB0, EB->Q.x.x0);
-  fp_ImportHex(raw->xQB1, EB->Q.x.x1);
-  fp_ImportHex(raw->yQB0, EB->Q.y.x0);
-  fp_ImportHex(raw->yQB1, EB->Q.y.x1);
+  fp_Init_hex(ffpB, raw->xPB0, EB->P.x.x0);
+  fp_Init_hex(ffpB, raw->xPB1, EB->P.x.x1);
+  fp_Init_hex(ffpB, raw->yPB0, EB->P.y.x0);
+  fp_Init_hex(ffpB, raw->yPB1, EB->P.y.x1);
+  fp_Init_hex(ffpB, raw->xQB0, EB->Q.x.x0);
+  fp_Init_hex(ffpB, raw->xQB1, EB->Q.x.x1);
+  fp_Init_hex(ffpB, raw->yQB0, EB->Q.y.x0);
+  fp_Init_hex(ffpB, raw->yQB1, EB->Q.y.x1);
 
   fp2_Init_set(ffpB, &EB->a, raw->A, 0);
   fp2_Init_set(ffpB, &EB->b, raw->B, 0);
 
+  fp2_Init_xR(EA, &params->xRA);
+  fp2_Init_xR(EB, &params->xRB);
+
+  params->stratA = calloc(params->eA / 2, sizeof(unsigned int));
+  params->stratB = calloc(params->eB, sizeof(unsigned int));
+  iso_strategy(params->eA / 2, 2 * ISO_COST_DBL, ISO_COST_EVAL_4, params->stratA);
+  iso_strategy(params->eB, ISO_COST_TPL, ISO_COST_EVAL_3, params->stratB);
+
   params->crypto_bytes = raw->crypto_bytes;
   params->msg_bytes = raw->msg_bytes;
 }
@@ -290,6 +312,45 @@ sike_teardown_params(sike_params_t *params) {
   fp2_Clear(ffpB, &EB->a);
   fp2_Clear(ffpB, &EB->b);
 
+  fp2_Clear(ffpA, &params->xRA);
+  fp2_Clear(ffpB, &params->xRB);
+
+  free(params->stratA);
+  free(params->stratB);
+
   free(ffpA);
   free(ffpB);
-}
\ No newline at end of file
+}
+
+// Cached contexts of the built-in parameter sets, indexed like `ctx_raw`
+static const sike_params_raw_t* const ctx_raw[] = { &SIKEp434, &SIKEp503, &SIKEp610, &SIKEp751 };
+
+static sike_ctx_t ctx_cache[4];
+
+static pthread_once_t ctx_once[4] = { PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT, PTHREAD_ONCE_INIT };
+
+static void
+ctx_setup(int i) {
+  ctx_cache[i].raw = ctx_raw[i];
+  sike_setup_params(ctx_raw[i], &ctx_cache[i].params);
+}
+
+// pthread_once() doesn't pass arguments, hence one initializer per parameter set
+static void ctx_setup_p434(void) { ctx_setup(0); }
+static void ctx_setup_p503(void) { ctx_setup(1); }
+static void ctx_setup_p610(void) { ctx_setup(2); }
+static void ctx_setup_p751(void) { ctx_setup(3); }
+
+static void (* const ctx_setup_fn[])(void) = { ctx_setup_p434, ctx_setup_p503, ctx_setup_p610, ctx_setup_p751 };
+
+const sike_ctx_t*
+sike_ctx_get(const sike_params_raw_t *raw) {
+  for (int i = 0; i < 4; ++i) {
+    if (raw == ctx_raw[i]) {
+      if (pthread_once(&ctx_once[i], ctx_setup_fn[i]))
+        return NULL;
+      return &ctx_cache[i];
+    }
+  }
+  return NULL;
+}
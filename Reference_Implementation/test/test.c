@@ -28,6 +28,13 @@ int main(int argc, char *argv[]) {
   const char *arg_sike_speed     = "sike_speed";
   const char *arg_sike_speed_int = "sike_speed_int";
   const char *arg_pke            = "pke";
+  const char *arg_sike_ctx       = "sike_ctx";
+  const char *arg_sike_speed_ctx = "sike_speed_ctx";
+
+  const char *arg_gmp            = "gmp";
+  const char *arg_mont           = "mont";
+
+  fp_backend_t backend = FP_BACKEND_DEFAULT;
 
   sike_params_t params = { 0 };
   const sike_params_raw_t *params_raw = NULL;
@@ -52,7 +59,16 @@ int main(int argc, char *argv[]) {
     goto end;
   }
 
-  sike_setup_params(params_raw, &params);
+  // Optional trailing argument selecting the finite field backend
+  if (argc > 3 && !strcmp(argv[argc - 1], arg_gmp)) {
+    backend = FP_BACKEND_GMP;
+    argc--;
+  } else if (argc > 3 && !strcmp(argv[argc - 1], arg_mont)) {
+    backend = FP_BACKEND_MONT;
+    argc--;
+  }
+
+  sike_setup_params_backend(params_raw, backend, &params);
 
   if (!strcmp(argv[2], arg_arith)) {
 
@@ -80,7 +96,7 @@ int main(int argc, char *argv[]) {
       printf("Need to pass the number of runs\n");
     } else {
       int runs = atoi(argv[3]);
-      rc = test_sike_speedy(params_raw->name, &params, runs);
+      rc = test_sike_speedy_fp(params_raw, runs);
       if ( rc ) goto end;
     }
 
@@ -94,6 +110,21 @@ int main(int argc, char *argv[]) {
       if ( rc ) goto end;
     }
 
+  } else if (!strcmp(argv[2], arg_sike_ctx)) {
+
+    rc = test_sike_ctx(params_raw, 2);
+    if ( rc ) goto end;
+
+  } else if (!strcmp(argv[2], arg_sike_speed_ctx)) {
+
+    if (argc != 4) {
+      printf("Need to pass the number of runs\n");
+    } else {
+      int runs = atoi(argv[3]);
+      rc = test_sike_speedy_ctx(params_raw, runs);
+      if ( rc ) goto end;
+    }
+
   } else if (!strcmp(argv[2], arg_sidh_int)) {
 
     rc = test_sidh(params_raw->name, &params);
@@ -14,6 +14,50 @@
 #include <stdio.h>
 #include <random.h>
 #include <sike_params.h>
+#include <pthread.h>
+
+// Checks that the public key matches the one computed with affine arithmetic and the naive isogeny traversal
+static int sidh_check_affine(const sike_params_t* params, const sike_public_key_t* pk, const mp sk, party_t party) {
+  ff_Params* p = params->EA.ffData;
+  sike_params_t naive = *params;
+  sike_public_key_t pkNaive = { 0 };
+  int rc = 0;
+
+  naive.stratA = NULL;
+  naive.stratB = NULL;
+
+  public_key_init(p, &pkNaive);
+  sidh_isogen_affine(&naive, &pkNaive, sk, party);
+
+  if (!fp2_IsEqual(p, &pk->xP, &pkNaive.xP) ||
+      !fp2_IsEqual(p, &pk->xQ, &pkNaive.xQ) ||
+      !fp2_IsEqual(p, &pk->xR, &pkNaive.xR)) {
+    printf("Public key of %s doesn't match the affine isogeny computation\n", party == ALICE ? "Alice" : "Bob");
+    rc = 1;
+  }
+
+  public_key_clear(p, &pkNaive);
+  return rc;
+}
+
+// Checks that the shared secret matches the one computed with affine arithmetic
+static int sidh_check_affine_ss(const sike_params_t* params, const sike_public_key_t* pkO, const mp sk, party_t party,
+                                const fp2* ss) {
+  ff_Params* p = params->EA.ffData;
+  fp2 ssAffine = { 0 };
+  int rc = 0;
+
+  fp2_Init(p, &ssAffine);
+  sidh_isoex_affine(params, pkO, sk, party, &ssAffine);
+
+  if (!fp2_IsEqual(p, ss, &ssAffine)) {
+    printf("Shared secret of %s doesn't match the affine isogeny computation\n", party == ALICE ? "Alice" : "Bob");
+    rc = 1;
+  }
+
+  fp2_Clear(p, &ssAffine);
+  return rc;
+}
 
 int test_sidh(const char* name, const sike_params_t* params) {
   int rc = 0;
@@ -51,6 +95,9 @@ int test_sidh(const char* name, const sike_params_t* params) {
   printFp2("pkB.Qx = ", &publicKey_B.xQ);
   printFp2("pkB.Rx = ", &publicKey_B.xR);
 
+  rc |= sidh_check_affine(params, &publicKey_A, privateKey_A, ALICE);
+  rc |= sidh_check_affine(params, &publicKey_B, privateKey_B, BOB);
+
   gmp_printf("skA = %Zu\n", privateKey_A);
 
   sidh_isoex(params, &publicKey_B, privateKey_A, ALICE, &shared_sec_A);
@@ -63,6 +110,9 @@ int test_sidh(const char* name, const sike_params_t* params) {
 
   printFp2("Bob ss: ", &shared_sec_B);
 
+  rc |= sidh_check_affine_ss(params, &publicKey_B, privateKey_A, ALICE, &shared_sec_A);
+  rc |= sidh_check_affine_ss(params, &publicKey_A, privateKey_B, BOB, &shared_sec_B);
+
   fp2toos_alloc(params, &shared_sec_A, &enc_sec_A, &enc_sec_A_len);
   fp2toos_alloc(params, &shared_sec_B, &enc_sec_B, &enc_sec_B_len);
 
@@ -123,7 +173,7 @@ int test_pke(const char* name, const sike_params_t* params) {
 
   randombytes(m, params->msg_bytes);
 
-  for (int i = 0; i < params->msg_bytes; ++i) {
+  for (size_t i = 0; i < params->msg_bytes; ++i) {
     mRecovered[i] = 0;
     c1[i] = 0;
   }
@@ -247,10 +297,10 @@ end:
   return rc;
 }
 
-int test_sike_speedy(const char* name, const sike_params_t* params, int runs) {
+int test_sike_speedy(const char* name, const sike_params_t* params, int runs, int64_t avg[3]) {
 
   int rc = 0;
-  unsigned int i;
+  int i;
 
   int64_t cycles, cycles1, cycles2;
 
@@ -265,7 +315,8 @@ int test_sike_speedy(const char* name, const sike_params_t* params, int runs) {
   unsigned char* ss     = calloc(ssLen, 1);
   unsigned char* ss_rec = calloc(ssLen, 1);
 
-  printf("Performance of %s (avg. of %d runs):\n", name, runs);
+  printf("Performance of %s, %s backend (avg. of %d runs):\n", name,
+         params->backend == FP_BACKEND_MONT ? "Montgomery" : "GMP", runs);
 
   cycles = 0;
   for (i = 0; i < runs; ++i) {
@@ -277,6 +328,7 @@ int test_sike_speedy(const char* name, const sike_params_t* params, int runs) {
   }
   printf("  Key generation runs in ....................................... %10ld ", (cycles / runs));
   print_unit
+  if (avg) avg[0] = cycles / runs;
 
   cycles = 0;
   for (i = 0; i < runs; ++i) {
@@ -289,6 +341,7 @@ int test_sike_speedy(const char* name, const sike_params_t* params, int runs) {
   }
   printf("  Encapsulation runs in ........................................ %10ld ", (cycles / runs));
   print_unit
+  if (avg) avg[1] = cycles / runs;
 
   cycles = 0;
   for (i = 0; i < runs; ++i) {
@@ -301,6 +354,7 @@ int test_sike_speedy(const char* name, const sike_params_t* params, int runs) {
   }
   printf("  Decapsulation runs in ........................................ %10ld ", (cycles / runs));
   print_unit
+  if (avg) avg[2] = cycles / runs;
 
 end:
   free(pk3);
@@ -314,7 +368,7 @@ end:
 int test_sike_speedy_int(const char *name, const sike_params_t *params, int runs) {
 
   int rc = 0;
-  unsigned int i;
+  int i;
 
   int64_t cycles, cycles1, cycles2;
 
@@ -372,3 +426,216 @@ int test_sike_speedy_int(const char *name, const sike_params_t *params, int runs
 
   return rc;
 }
+
+
+typedef struct {
+  const sike_params_raw_t *raw;
+  const sike_ctx_t *ctx;
+  int rc;
+} ctx_thread_arg_t;
+
+static void* test_sike_ctx_thread(void *arg) {
+  ctx_thread_arg_t *t = arg;
+
+  t->ctx = sike_ctx_get(t->raw);
+  if ( !t->ctx ) {
+    t->rc = 1;
+    return NULL;
+  }
+
+  t->rc = test_sike(t->raw->name, &t->ctx->params, 1);
+  return NULL;
+}
+
+int test_sike_ctx(const sike_params_raw_t *raw, int threads) {
+
+  int rc = 0;
+  int i;
+
+  pthread_t tid[threads];
+  ctx_thread_arg_t args[threads];
+
+  // All threads race for the first sike_ctx_get() and then run the KEM on the shared context
+  for (i = 0; i < threads; ++i) {
+    args[i].raw = raw;
+    args[i].ctx = NULL;
+    args[i].rc = 0;
+    if (pthread_create(&tid[i], NULL, test_sike_ctx_thread, &args[i])) {
+      printf("Failed to create thread %d\n", i);
+      threads = i;
+      rc = 1;
+      break;
+    }
+  }
+
+  for (i = 0; i < threads; ++i) {
+    pthread_join(tid[i], NULL);
+    if (args[i].rc) {
+      printf("KEM failed in thread %d\n", i);
+      rc = 1;
+    }
+    if (args[i].ctx != args[0].ctx) {
+      printf("Thread %d got a different context\n", i);
+      rc = 1;
+    }
+  }
+
+  if (sike_ctx_get(raw) != args[0].ctx) {
+    printf("Context is not cached\n");
+    rc = 1;
+  }
+
+  return rc;
+}
+
+int test_sike_speedy_ctx(const sike_params_raw_t *raw, int runs) {
+
+  int rc = 0;
+  int i;
+
+  int64_t cycles, cycles1, cycles2;
+
+  const sike_ctx_t *ctx = sike_ctx_get(raw);
+  if ( !ctx ) return 1;
+
+  const sike_params_t *params = &ctx->params;
+
+  size_t pkLen = pktoos_len(params, BOB);
+  size_t skLen = sktoos_len(params, BOB);
+  size_t ctLen = encapstoos_len(params);
+  size_t ssLen = params->crypto_bytes;
+
+  unsigned char* pk3    = calloc(pkLen, 1);
+  unsigned char* sk3    = calloc(skLen, 1);
+  unsigned char* ct     = calloc(ctLen, 1);
+  unsigned char* ss     = calloc(ssLen, 1);
+  unsigned char* ss_rec = calloc(ssLen, 1);
+
+  printf("Performance of %s, per-call parameter setup vs. cached context (avg. of %d runs):\n", raw->name, runs);
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    sike_params_t fresh = { 0 };
+    cycles1 = cpucycles();
+    sike_setup_params(raw, &fresh);
+    sike_teardown_params(&fresh);
+    cycles2 = cpucycles();
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Parameter setup and teardown runs in ......................... %10ld ", (cycles / runs));
+  print_unit
+
+  // Per-call setup, as done by the NIST API before contexts were cached
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    sike_params_t fresh = { 0 };
+    cycles1 = cpucycles();
+    sike_setup_params(raw, &fresh);
+    crypto_kem_keypair_generic(&fresh, pk3, sk3);
+    sike_teardown_params(&fresh);
+    cycles2 = cpucycles();
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Key generation with setup runs in ............................ %10ld ", (cycles / runs));
+  print_unit
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    sike_params_t fresh = { 0 };
+    cycles1 = cpucycles();
+    sike_setup_params(raw, &fresh);
+    rc = crypto_kem_enc_generic(&fresh, ct, ss, pk3);
+    sike_teardown_params(&fresh);
+    cycles2 = cpucycles();
+    if ( rc ) goto end;
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Encapsulation with setup runs in ............................. %10ld ", (cycles / runs));
+  print_unit
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    sike_params_t fresh = { 0 };
+    cycles1 = cpucycles();
+    sike_setup_params(raw, &fresh);
+    rc = crypto_kem_dec_generic(&fresh, ss_rec, ct, sk3);
+    sike_teardown_params(&fresh);
+    cycles2 = cpucycles();
+    if ( rc ) goto end;
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Decapsulation with setup runs in ............................. %10ld ", (cycles / runs));
+  print_unit
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    cycles1 = cpucycles();
+    crypto_kem_keypair_generic(params, pk3, sk3);
+    cycles2 = cpucycles();
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Key generation with cached context runs in ................... %10ld ", (cycles / runs));
+  print_unit
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    cycles1 = cpucycles();
+    rc = crypto_kem_enc_generic(params, ct, ss, pk3);
+    cycles2 = cpucycles();
+    if ( rc ) goto end;
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Encapsulation with cached context runs in .................... %10ld ", (cycles / runs));
+  print_unit
+
+  cycles = 0;
+  for (i = 0; i < runs; ++i) {
+    cycles1 = cpucycles();
+    rc = crypto_kem_dec_generic(params, ss_rec, ct, sk3);
+    cycles2 = cpucycles();
+    if ( rc ) goto end;
+
+    cycles = cycles + (cycles2 - cycles1);
+  }
+  printf("  Decapsulation with cached context runs in .................... %10ld ", (cycles / runs));
+  print_unit
+
+end:
+  free(pk3);
+  free(sk3);
+  free(ct);
+  free(ss);
+  free(ss_rec);
+  return rc;
+}
+
+int test_sike_speedy_fp(const sike_params_raw_t *raw, int runs) {
+
+  int rc = 0;
+  int64_t gmp[3] = { 0 }, mont[3] = { 0 };
+  sike_params_t params = { 0 };
+
+  sike_setup_params_backend(raw, FP_BACKEND_GMP, &params);
+  rc = test_sike_speedy(raw->name, &params, runs, gmp);
+  sike_teardown_params(&params);
+  if ( rc ) goto end;
+
+  sike_setup_params_backend(raw, FP_BACKEND_MONT, &params);
+  rc = test_sike_speedy(raw->name, &params, runs, mont);
+  sike_teardown_params(&params);
+  if ( rc ) goto end;
+
+  printf("Speedup of the Montgomery backend over the GMP backend:\n");
+  printf("  Key generation ............................................... %10.2fx\n", (double) gmp[0] / mont[0]);
+  printf("  Encapsulation ................................................ %10.2fx\n", (double) gmp[1] / mont[1]);
+  printf("  Decapsulation ................................................ %10.2fx\n", (double) gmp[2] / mont[2]);
+
+end:
+  return rc;
+}
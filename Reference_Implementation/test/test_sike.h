@@ -10,6 +10,7 @@
 
 #include <sike_params.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 int test_sidh(const char* name, const sike_params_t* params);
 
@@ -19,8 +20,14 @@ int test_sike(const char* name, const sike_params_t* params, int rnd);
 
 int test_sike_int(const char* name, const sike_params_t* params);
 
-int test_sike_speedy(const char *name, const sike_params_t *params, int runs);
+int test_sike_speedy(const char *name, const sike_params_t *params, int runs, int64_t avg[3]);
 
 int test_sike_speedy_int(const char *name, const sike_params_t *params, int runs);
 
+int test_sike_ctx(const sike_params_raw_t *raw, int threads);
+
+int test_sike_speedy_ctx(const sike_params_raw_t *raw, int runs);
+
+int test_sike_speedy_fp(const sike_params_raw_t *raw, int runs);
+
 #endif //ISOGENY_REF_TEST_SIKE_H